@@ -0,0 +1,27 @@
+/*
+ *  THIS FILE IS AUTOMATICALLY CREATED BY configure!
+ *  DON'T EDIT THIS FILE MANUALLY, IT WILL BE OVERWRITTEN.
+ */
+
+#ifndef CONFIG_H
+#define CONFIG_H
+
+#define VERSION "trunk"
+#define COMPILE_DATE "compiled on Linux/x86_64, Mon Oct 19 06:33:02 UTC 2026"
+#define ADD_ALL_CPU_FAMILIES     add_cpu_family(alpha_cpu_family_init, ARCH_ALPHA); add_cpu_family(arm_cpu_family_init, ARCH_ARM); add_cpu_family(i960_cpu_family_init, ARCH_I960); add_cpu_family(m88k_cpu_family_init, ARCH_M88K); add_cpu_family(mips_cpu_family_init, ARCH_MIPS); add_cpu_family(ppc_cpu_family_init, ARCH_PPC); add_cpu_family(riscv_cpu_family_init, ARCH_RISCV); add_cpu_family(sh_cpu_family_init, ARCH_SH);
+#define WITH_X11
+#define HAVE_INET_PTON
+#define strlcpy mystrlcpy
+#define strlcat mystrlcat
+#define USE_STRLCPY_REPLACEMENTS
+#define HAVE_POSIX_FADVISE
+#define HAVE_MMAP
+#define HAVE_FDATASYNC
+#define HAVE_PTHREAD
+#define likely(x) __builtin_expect(!!(x), 1)
+#define unlikely(x) __builtin_expect(!!(x), 0)
+#define HOST_LITTLE_ENDIAN
+
+#undef mips
+
+#endif  /*  CONFIG_H  */
@@ -12,8 +12,10 @@
 /*  Note: The ugly cast to a signed int (32-bit) causes the address to be
 	sign-extended correctly on MIPS when compiled in 64-bit mode  */ 
 #define PHYSADDR_OFFSET         ((signed int)0xa0000000)
+#define VIRT_TO_PHYS(p)         ((long)(p) & 0x1fffffff)
 #else
 #define PHYSADDR_OFFSET         0
+#define VIRT_TO_PHYS(p)         ((long)(p))
 #endif
 
 
@@ -57,6 +59,9 @@ void printhex4(int i)
 }
 
 
+static unsigned char dmabuf[1024];
+
+
 void f(void)
 {
 	int ofs, ide_id = 0, status, i;
@@ -107,6 +112,43 @@ void f(void)
 		}
 	}
 
+	/*
+	 *  Read the same two sectors again, using a single DMA transfer
+	 *  into RAM, and compare with what the data buffer gives us:
+	 */
+	printstr("\nDMA read of both sectors: ");
+
+	*((volatile int *) (DISK_ADDRESS + DEV_DISK_OFFSET)) = 0;
+	*((volatile int *) (DISK_ADDRESS + DEV_DISK_DMA_ADDRESS)) =
+	    VIRT_TO_PHYS(dmabuf);
+	*((volatile int *) (DISK_ADDRESS + DEV_DISK_DMA_COUNT)) = 2;
+	*((volatile int *) (DISK_ADDRESS + DEV_DISK_START_OPERATION)) =
+	    DEV_DISK_OPERATION_DMA_READ;
+
+	status = *((volatile int *) (DISK_ADDRESS + DEV_DISK_STATUS));
+	if (status == 0) {
+		printstr("failed.\n");
+		halt();
+	}
+
+	for (ofs = 0; ofs < 1024; ofs += 512) {
+		*((volatile int *) (DISK_ADDRESS + DEV_DISK_OFFSET)) = ofs;
+		*((volatile int *) (DISK_ADDRESS + DEV_DISK_START_OPERATION)) =
+		    DEV_DISK_OPERATION_READ;
+
+		for (i = 0; i < 512; i++) {
+			ch = *((volatile unsigned char *) DISK_ADDRESS
+			    + DEV_DISK_BUFFER + i);
+			if (ch != *((volatile unsigned char *) (PHYSADDR_OFFSET
+			    + VIRT_TO_PHYS(dmabuf) + ofs + i))) {
+				printstr("mismatch!\n");
+				halt();
+			}
+		}
+	}
+
+	printstr("ok\n");
+
 	printstr("\nDone.\n");
 	halt();
 }
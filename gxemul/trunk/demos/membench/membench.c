@@ -0,0 +1,86 @@
+/*
+ *  GXemul demo:  Memory access benchmark
+ *
+ *  This file is in the Public Domain.
+ *
+ *  Loads and stores one word per 4 KB page, round-robin over a number of
+ *  pages, so that the emulator's virtual to host address translation is
+ *  exercised on (almost) every access. Run with -N to see the number of
+ *  emulated instructions per second, or time the whole run.
+ */
+
+#include "dev_cons.h"
+
+
+#ifdef MIPS
+/*  Note: The ugly cast to a signed int (32-bit) causes the address to be
+	sign-extended correctly on MIPS when compiled in 64-bit mode  */
+#define	PHYSADDR_OFFSET		((signed int)0xa0000000)
+#else
+#define	PHYSADDR_OFFSET		0
+#endif
+
+
+#define	PUTCHAR_ADDRESS		(PHYSADDR_OFFSET +		\
+				DEV_CONS_ADDRESS + DEV_CONS_PUTGETCHAR)
+#define	HALT_ADDRESS		(PHYSADDR_OFFSET +		\
+				DEV_CONS_ADDRESS + DEV_CONS_HALT)
+
+
+#define	PAGE_SIZE	4096
+#define	N_PAGES		32		/*  Number of pages to cycle through  */
+#define	N_ROUNDS	2000000
+
+
+static long buf[N_PAGES * PAGE_SIZE / sizeof(long)];
+
+
+void printchar(char ch)
+{
+	*((volatile unsigned char *) PUTCHAR_ADDRESS) = ch;
+}
+
+
+void halt(void)
+{
+	*((volatile unsigned char *) HALT_ADDRESS) = 0;
+}
+
+
+void printstr(char *s)
+{
+	while (*s)
+		printchar(*s++);
+}
+
+
+void printhex(unsigned long x)
+{
+	int i;
+
+	printstr("0x");
+	for (i = sizeof(x) * 8 - 4; i >= 0; i -= 4)
+		printchar("0123456789abcdef"[(x >> i) & 15]);
+}
+
+
+void f(void)
+{
+	volatile long *p = buf;
+	unsigned long sum = 0;
+	int round, page;
+
+	printstr("membench: ");
+
+	for (round = 0; round < N_ROUNDS; round++) {
+		for (page = 0; page < N_PAGES; page++) {
+			int i = page * (PAGE_SIZE / sizeof(long)) + (round & 7);
+			sum += p[i];
+			p[i] = sum;
+		}
+	}
+
+	printhex(sum);
+	printstr("\n");
+	halt();
+}
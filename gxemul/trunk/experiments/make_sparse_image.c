@@ -0,0 +1,259 @@
+/*
+ *  Copyright (C) 2021  Anders Gavare.  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ *  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ *  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ *  OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ *  OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ *  SUCH DAMAGE.
+ *
+ *
+ *  This program creates disk images in GXemul's native sparse format (see
+ *  src/disk/diskimage_sparse.c for a description of the format).
+ *
+ *  Usage:  make_sparse_image [-c clustersize] [-b backingfile] [-s size]
+ *              [infile] outfile
+ *
+ *  If infile (a raw disk image) is given, its non-zero clusters are copied
+ *  into the sparse image. If a raw backing file is also given, clusters
+ *  which are identical in infile and the backing file are not stored at
+ *  all, so e.g. several installs derived from one base installation need
+ *  only store their differences:
+ *
+ *	./make_sparse_image netbsd-base.img netbsd-base.sparse
+ *	./make_sparse_image -b netbsd-base.img netbsd-www.img netbsd-www.sparse
+ *
+ *  Without infile, an empty image is created. Its size is taken from -s
+ *  (with an optional K, M, or G suffix), or from the backing file. This is
+ *  useful for creating a copy-on-write layer on top of a base image:
+ *
+ *	./make_sparse_image -b netbsd-base.sparse scratch.sparse
+ *
+ *  The backing file name is stored as given; a relative name is looked up
+ *  relative to the directory of the sparse image when it is opened.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/types.h>
+
+#define	MAGIC		"GXSPARSE"
+#define	VERSION		1
+#define	HEADER_SIZE	64
+
+
+static void put_be32(unsigned char *p, uint32_t x)
+{
+	p[0] = x >> 24; p[1] = x >> 16; p[2] = x >> 8; p[3] = x;
+}
+
+static void put_be64(unsigned char *p, uint64_t x)
+{
+	put_be32(p, x >> 32);
+	put_be32(p + 4, x);
+}
+
+static uint64_t get_be64(const unsigned char *p)
+{
+	uint64_t x = 0;
+	int i;
+	for (i = 0; i < 8; i++)
+		x = (x << 8) | p[i];
+	return x;
+}
+
+
+/*  Returns the size of a raw or sparse image file, or -1.  */
+static int64_t image_size(FILE *f)
+{
+	unsigned char hdr[24];
+
+	if (fseeko(f, 0, SEEK_SET) == 0 && fread(hdr, 1, 24, f) == 24 &&
+	    memcmp(hdr, MAGIC, 8) == 0)
+		return get_be64(hdr + 16);
+
+	if (fseeko(f, 0, SEEK_END) != 0)
+		return -1;
+	return ftello(f);
+}
+
+
+static int is_zero(const unsigned char *p, size_t len)
+{
+	size_t i;
+	for (i = 0; i < len; i++)
+		if (p[i] != 0)
+			return 0;
+	return 1;
+}
+
+
+int main(int argc, char *argv[])
+{
+	FILE *fin = NULL, *fback = NULL, *fout;
+	const char *backing = NULL;
+	unsigned char hdr[HEADER_SIZE], *buf, *bbuf, *table;
+	uint32_t cluster_size = 65536;
+	int64_t size = -1, table_offset, data_offset, nclusters, i;
+	int back_is_raw = 0, ch;
+	size_t name_len = 0;
+
+	while ((ch = getopt(argc, argv, "b:c:s:")) != -1) {
+		switch (ch) {
+		case 'b':
+			backing = optarg;
+			break;
+		case 'c':
+			cluster_size = strtoul(optarg, NULL, 0);
+			break;
+		case 's':
+			{
+				char *end;
+				size = strtoll(optarg, &end, 0);
+				switch (*end) {
+				case 'G': case 'g': size <<= 10;
+					/*  FALLTHROUGH  */
+				case 'M': case 'm': size <<= 10;
+					/*  FALLTHROUGH  */
+				case 'K': case 'k': size <<= 10;
+				}
+			}
+			break;
+		default:
+			exit(1);
+		}
+	}
+	argc -= optind;
+	argv += optind;
+
+	if (argc < 1 || argc > 2 || cluster_size < 512 ||
+	    (cluster_size & (cluster_size - 1))) {
+		fprintf(stderr, "usage: make_sparse_image [-c clustersize] "
+		    "[-b backingfile] [-s size] [infile] outfile\n");
+		fprintf(stderr, "clustersize must be a power of two, >= 512."
+		    " (Default: 65536.)\n");
+		exit(1);
+	}
+
+	if (backing != NULL) {
+		fback = fopen(backing, "r");
+		if (fback == NULL) {
+			perror(backing);
+			exit(1);
+		}
+		name_len = strlen(backing);
+
+		/*  Only raw backing files are compared against.  */
+		back_is_raw = fread(hdr, 1, 8, fback) != 8 ||
+		    memcmp(hdr, MAGIC, 8) != 0;
+		if (size < 0)
+			size = image_size(fback);
+	}
+
+	if (argc == 2) {
+		fin = fopen(argv[0], "r");
+		if (fin == NULL) {
+			perror(argv[0]);
+			exit(1);
+		}
+		if (size < 0)
+			size = image_size(fin);
+	}
+
+	if (size < 0) {
+		fprintf(stderr, "unknown size; use -s, an infile, or a "
+		    "backing file\n");
+		exit(1);
+	}
+
+	fout = fopen(argv[argc - 1], "w");
+	if (fout == NULL) {
+		perror(argv[argc - 1]);
+		exit(1);
+	}
+
+	nclusters = (size + cluster_size - 1) / cluster_size;
+	table_offset = HEADER_SIZE + name_len;
+	data_offset = table_offset + nclusters * 8;
+	data_offset = (data_offset + cluster_size - 1) & ~(int64_t)
+	    (cluster_size - 1);
+
+	memset(hdr, 0, sizeof(hdr));
+	memcpy(hdr, MAGIC, 8);
+	put_be32(hdr + 8, VERSION);
+	put_be32(hdr + 12, cluster_size);
+	put_be64(hdr + 16, size);
+	put_be64(hdr + 24, table_offset);
+	put_be32(hdr + 36, name_len);
+
+	buf = malloc(cluster_size);
+	bbuf = malloc(cluster_size);
+	table = calloc(nclusters + 1, 8);
+	if (buf == NULL || bbuf == NULL || table == NULL) {
+		fprintf(stderr, "out of memory\n");
+		exit(1);
+	}
+
+	for (i = 0; fin != NULL && i < nclusters; i++) {
+		memset(buf, 0, cluster_size);
+		fseeko(fin, (off_t) i * cluster_size, SEEK_SET);
+		if (fread(buf, 1, cluster_size, fin) == 0 && fback == NULL)
+			break;
+
+		if (back_is_raw) {
+			memset(bbuf, 0, cluster_size);
+			fseeko(fback, (off_t) i * cluster_size, SEEK_SET);
+			if (fread(bbuf, 1, cluster_size, fback) == 0 &&
+			    is_zero(buf, cluster_size))
+				continue;
+			if (memcmp(buf, bbuf, cluster_size) == 0)
+				continue;
+		}
+
+		if (is_zero(buf, cluster_size)) {
+			/*  Zeros must hide the backing file's data, if any:  */
+			if (fback != NULL)
+				put_be64(table + 8 * i, 1);
+			continue;
+		}
+
+		put_be64(table + 8 * i, data_offset);
+		fseeko(fout, data_offset, SEEK_SET);
+		if (fwrite(buf, 1, cluster_size, fout) != cluster_size) {
+			perror("fwrite");
+			exit(1);
+		}
+		data_offset += cluster_size;
+	}
+
+	fseeko(fout, 0, SEEK_SET);
+	if (fwrite(hdr, 1, HEADER_SIZE, fout) != HEADER_SIZE ||
+	    (name_len > 0 && fwrite(backing, 1, name_len, fout) != name_len) ||
+	    fwrite(table, 1, nclusters * 8, fout) != (size_t) nclusters * 8) {
+		perror("fwrite");
+		exit(1);
+	}
+
+	fclose(fout);
+	return 0;
+}
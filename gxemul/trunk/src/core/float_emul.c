@@ -49,6 +49,22 @@
 void ieee_interpret_float_value(uint64_t x, struct ieee_float_value *fvp,
 	int fmt)
 {
+	/*
+	 *  Fast path: Normal numbers and zeroes are already in the host's
+	 *  native format, so they can be used as they are. (The slow path
+	 *  below gives exactly the same result for these.)
+	 */
+	if (fmt == IEEE_FMT_D && ieee_d_is_normal_or_zero(x)) {
+		fvp->f = ieee_d_from_bits(x);
+		fvp->nan = 0;
+		return;
+	}
+	if (fmt == IEEE_FMT_S && ieee_s_is_normal_or_zero(x)) {
+		fvp->f = ieee_s_from_bits(x);
+		fvp->nan = 0;
+		return;
+	}
+
 	memset(fvp, 0, sizeof(struct ieee_float_value));
 
 	int n_frac = 0, n_exp = 0;
@@ -204,9 +220,27 @@ no_reasonable_result:
 uint64_t ieee_store_float_value(double nf, int fmt)
 {
 	int n_frac = 0, n_exp = 0, signofs = 0, i, exponent;
-	uint64_t r = 0, r2;
+	uint64_t r = 0, r2, bits;
 	int64_t r3;
 
+	/*
+	 *  Fast path: Doubles which are normal numbers or zeroes are stored
+	 *  as they are. Singles are truncated (not rounded), just like
+	 *  the slow path below does, as long as the exponent fits.
+	 */
+	bits = ieee_d_to_bits(nf);
+	if (ieee_d_is_normal_or_zero(bits)) {
+		if (fmt == IEEE_FMT_D)
+			return bits;
+
+		if (fmt == IEEE_FMT_S) {
+			uint32_t s;
+
+			if (ieee_s_truncate_d(bits, &s))
+				return s;
+		}
+	}
+
 	/*  n_frac and n_exp:  */
 	switch (fmt) {
 	case IEEE_FMT_S:	n_frac = 23; n_exp = 8; signofs = 31; break;
@@ -156,6 +156,7 @@ static void usage(bool longusage)
 	printf("                gH;S;  set geometry to H heads and S"
 	    " sectors-per-track\n");
 	printf("                i      IDE\n");
+	printf("                m      map the file into memory (implies r)\n");
 	printf("                oOFS;  set base offset to OFS (for ISO9660"
 	    " filesystems)\n");
 	printf("                r      read-only (don't allow changes to the file)\n");
@@ -165,11 +166,15 @@ static void usage(bool longusage)
 	printf("                s      SCSI\n");
 	printf("                t      tape\n");
 	printf("                V      add an overlay (also requires explicit ID)\n");
+	printf("                w      write-back cache (guest writes are kept in the block\n");
+	printf("                       cache until the guest flushes them)\n");
 	printf("                0-7    use a specific ID\n");
 	printf("  -I hz     set the main cpu frequency to hz (not used by "
 	    "all combinations\n            of machines and guest OSes)\n");
 	printf("  -i        display each instruction as it is executed\n");
-	printf("  -J        disable dyntrans instruction combinations\n");
+	printf("  -J        disable dyntrans instruction combinations and native"
+	    "\n            replacement of guest functions (bzero, memcpy, "
+	    "etc.)\n");
 	printf("  -j name   set the name of the kernel; for DECstation "
 	    "emulation, this passes\n            the name to the bootloader,"
 	    " for example:\n");
@@ -222,6 +227,9 @@ static void usage(bool longusage)
 
 	printf("\nGeneral options:\n");
 	printf("  -A        disable colorized output\n");
+	printf("  -B n      set the disk image block cache to n MB (default"
+	    " size is %i MB, 0 = no cache)\n",
+	    (int) (DEFAULT_DISKIMAGE_CACHE_SIZE / 1048576));
 	printf("  -c cmd    add cmd as a command to run before starting "
 	    "the simulation\n");
 	printf("  -D        skip the srandom call at startup\n");
@@ -281,7 +289,7 @@ int get_cmd_args(int argc, char *argv[], struct emul *emul,
 	struct machine *m = emul_add_machine(emul, NULL);
 
 	const char *opts =
-	    "AC:c:Dd:E:e:GHhI:iJj:k:KL:M:Nn:Oo:p:QqRrSs:TtVvW:"
+	    "AB:C:c:Dd:E:e:GHhI:iJj:k:KL:M:Nn:Oo:p:QqRrSs:TtVvW:"
 #ifdef WITH_X11
 	    "XxY:"
 #endif
@@ -292,6 +300,14 @@ int get_cmd_args(int argc, char *argv[], struct emul *emul,
 		case 'A':
 			enable_colorized_output = false;
 			break;
+		case 'B':
+			diskimage_cache_size = (int64_t) atoi(optarg) * 1048576;
+			if (diskimage_cache_size < 0) {
+				fprintf(stderr, "The disk image cache size "
+				    "cannot be negative.\n");
+				exit(1);
+			}
+			break;
 		case 'C':
 			CHECK_ALLOCATION(m->cpu_name = strdup(optarg));
 			machine_specific_options_used = true;
@@ -635,6 +651,7 @@ int main(int argc, char *argv[])
 	console_init();
 	cpu_init();
 	device_init();
+	diskimage_init();
 	machine_init();
 	timer_init();
 
@@ -772,6 +789,7 @@ int main(int argc, char *argv[])
 	 */
 
 	console_deinit();
+	diskimage_deinit();
 
 	emul_destroy(emul);
 
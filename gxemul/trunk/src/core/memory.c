@@ -33,6 +33,7 @@
 #include <string.h>
 #include <sys/types.h>
 #include <sys/mman.h>
+#include <unistd.h>
 
 #include "cpu.h"
 #include "machine.h"
@@ -137,6 +138,25 @@ void *zeroed_alloc(size_t s)
 }
 
 
+/*
+ *  zeroed_release():
+ *
+ *  Gives the host pages backing (part of) a zeroed_alloc() block back to the
+ *  host OS. The caller must already have cleared the range; it will read as
+ *  zeroes afterwards, and pages are populated again on demand. Only whole
+ *  host pages inside the range are released.
+ */
+void zeroed_release(void *p, size_t s)
+{
+	size_t pagesize = getpagesize();
+	uintptr_t start = ((uintptr_t)p + pagesize - 1) & ~(pagesize - 1);
+	uintptr_t end = ((uintptr_t)p + s) & ~(pagesize - 1);
+
+	if (end > start)
+		madvise((void *)start, end - start, MADV_DONTNEED);
+}
+
+
 /*
  *  memory_new():
  *
@@ -83,6 +83,10 @@ struct cpu *cpu_new(struct memory *mem, struct machine *machine,
 	cpu->byte_order = EMUL_UNDEFINED_ENDIAN;
 	cpu->running    = false;
 
+	/*  No CPU-internal timer or device event scheduled yet:  */
+	cpu->timer_event_ninstrs = INT64_MAX;
+	cpu->event_ninstrs = INT64_MAX;
+
 	/*  Create settings, and attach to the machine:  */
 	cpu->settings = settings_new();
 	snprintf(tmpstr, sizeof(tmpstr), "cpu[%i]", cpu_id);
@@ -165,6 +169,12 @@ void cpu_destroy(struct cpu *cpu)
 	if (cpu->path != NULL)
 		free(cpu->path);
 
+	while (cpu->first_event != NULL) {
+		struct cpu_event *ev = cpu->first_event;
+		cpu->first_event = ev->next;
+		free(ev);
+	}
+
 	/*  TODO: This assumes that zeroed_alloc() actually succeeded
 	    with using mmap(), and not malloc()!  */
 	munmap((void *)cpu, sizeof(struct cpu));
@@ -365,6 +375,382 @@ void cpu_break_out_of_dyntrans_loop(struct cpu *cpu)
 }
 
 
+/*
+ *  cpu_spin_wait():
+ *
+ *  Called by instruction combinations which recognize a guest spin-wait loop
+ *  (loading the same address over and over, e.g. waiting for a lock held by
+ *  another CPU), when the loop is about to go around once more.
+ *
+ *  On multi-processor machines, the rest of the CPU's dyntrans slice is
+ *  given up, so that the other CPUs (such as the lock holder) get to run
+ *  sooner, and true is returned. The caller should then synchronize the pc
+ *  to the start of the loop, and continue at the "nothing" instruction.
+ */
+bool cpu_spin_wait(struct cpu *cpu)
+{
+	if (cpu->machine->ncpus < 2)
+		return false;
+
+	cpu->n_spin_slices ++;
+	cpu_break_out_of_dyntrans_loop(cpu);
+	return true;
+}
+
+
+/*
+ *  cpu_interrupt_update():
+ *
+ *  Recomputes interrupt_pending (interrupt asserted and enabled) using the
+ *  arch-specific interrupt_check function. If an interrupt is pending, the
+ *  CPU breaks out of its dyntrans loop, and the interrupt exception is taken
+ *  at the start of the next run_instr call instead of at the end of the
+ *  slice, which could be thousands of instructions later.
+ */
+void cpu_interrupt_update(struct cpu *cpu)
+{
+	cpu->interrupt_pending = cpu->interrupt_check != NULL &&
+	    cpu->interrupt_check(cpu);
+
+	if (cpu->interrupt_pending)
+		cpu_break_out_of_dyntrans_loop(cpu);
+}
+
+
+/*
+ *  cpu_ninstrs_now():
+ *
+ *  Returns the instruction count to derive timer registers from.
+ *  cpu->ninstrs is only updated at the end of each dyntrans slice, and
+ *  n_translated_instrs only after each block of instructions, so one is
+ *  added for every call made during the same block. That way, guest code
+ *  polling a timer register in a loop sees it advance, and the values
+ *  never go backwards (each call is made by at least one instruction).
+ */
+int64_t cpu_ninstrs_now(struct cpu *cpu)
+{
+	int64_t now = cpu->ninstrs + ((cpu->n_translated_instrs &
+	    (N_BREAK_OUT_OF_DYNTRANS_LOOP - 1)) - cpu->n_translated_base);
+
+	if (cpu->ninstrs_polled_at != now) {
+		cpu->ninstrs_polled_at = now;
+		cpu->n_polls = 0;
+	}
+
+	return now + (++ cpu->n_polls);
+}
+
+
+/*
+ *  cpu_shorten_slice():
+ *
+ *  If this is called from within a dyntrans slice, and instruction count
+ *  when is reached before the slice would end, then the remainder of the
+ *  slice is shortened (the same way as at the start of a slice, in
+ *  cpu_dyntrans.c).
+ */
+static void cpu_shorten_slice(struct cpu *cpu, int64_t when)
+{
+	int n = cpu->n_translated_instrs & (N_BREAK_OUT_OF_DYNTRANS_LOOP - 1);
+	int64_t left = when - (cpu->ninstrs + (n - cpu->n_translated_base));
+	int room = N_SAFE_DYNTRANS_LIMIT - n;
+
+	if (room > 0 && left < room) {
+		int skip = room - (left > 0? left : 0);
+		cpu->n_translated_instrs += skip;
+		cpu->n_translated_base += skip;
+	}
+}
+
+
+/*
+ *  cpu_timer_schedule():
+ *
+ *  Schedules the next CPU-internal timer event at instruction count when.
+ */
+void cpu_timer_schedule(struct cpu *cpu, int64_t when)
+{
+	cpu->timer_event_ninstrs = when;
+	cpu_shorten_slice(cpu, when);
+}
+
+
+/*
+ *  cpu_event_schedule():
+ *
+ *  Schedules a call to f(cpu, extra) at instruction count when (usually
+ *  cpu_ninstrs_now() plus some delay). Devices use this to complete an
+ *  operation at a specific point in emulated time, independent of how
+ *  long it takes on the host. The event runs at the end of the dyntrans
+ *  slice in which it is due, and that slice is shortened the same way as
+ *  for cpu_timer_schedule(). A CPU which idles skips ahead to its next
+ *  event, since nothing else would happen in between anyway.
+ */
+void cpu_event_schedule(struct cpu *cpu, int64_t when,
+	void (*f)(struct cpu *, void *), void *extra)
+{
+	struct cpu_event *ev, **evp = &cpu->first_event;
+
+	CHECK_ALLOCATION(ev = (struct cpu_event *)
+	    malloc(sizeof(struct cpu_event)));
+	ev->ninstrs = when;
+	ev->f = f;
+	ev->extra = extra;
+
+	/*  Events due at the same time run in the order they were added:  */
+	while (*evp != NULL && (*evp)->ninstrs <= when)
+		evp = &(*evp)->next;
+
+	ev->next = *evp;
+	*evp = ev;
+
+	cpu->event_ninstrs = cpu->first_event->ninstrs;
+	cpu_shorten_slice(cpu, when);
+}
+
+
+/*
+ *  cpu_event_cancel():
+ *
+ *  Removes all scheduled calls to f with the given extra argument, on all
+ *  CPUs of a machine.
+ */
+void cpu_event_cancel(struct machine *machine,
+	void (*f)(struct cpu *, void *), void *extra)
+{
+	int i;
+
+	for (i = 0; i < machine->ncpus; i++) {
+		struct cpu *cpu = machine->cpus[i];
+		struct cpu_event **evp = &cpu->first_event;
+
+		while (*evp != NULL) {
+			struct cpu_event *ev = *evp;
+			if (ev->f == f && ev->extra == extra) {
+				*evp = ev->next;
+				free(ev);
+			} else
+				evp = &ev->next;
+		}
+
+		cpu->event_ninstrs = cpu->first_event != NULL?
+		    cpu->first_event->ninstrs : INT64_MAX;
+	}
+}
+
+
+/*
+ *  cpu_event_run():
+ *
+ *  Called at the end of a dyntrans slice; runs all events which are due.
+ *  (Each event is unlinked before it runs, so it may schedule new ones.)
+ */
+void cpu_event_run(struct cpu *cpu)
+{
+	while (cpu->first_event != NULL &&
+	    cpu->first_event->ninstrs <= cpu->ninstrs) {
+		struct cpu_event *ev = cpu->first_event;
+
+		cpu->first_event = ev->next;
+		cpu->event_ninstrs = cpu->first_event != NULL?
+		    cpu->first_event->ninstrs : INT64_MAX;
+
+		ev->f(cpu, ev->extra);
+		free(ev);
+	}
+}
+
+
+/*
+ *  host_cas():
+ *
+ *  Compare-and-swap of len (4 or 8) bytes of host memory: if the bytes at
+ *  host are equal to the first len bytes of oldvalue, they are replaced by
+ *  the bytes in data. Returns true if the swap was done.
+ */
+static bool host_cas(unsigned char *host, uint64_t oldvalue,
+	const unsigned char *data, int len)
+{
+#ifdef __GNUC__
+	if (len == sizeof(uint32_t)) {
+		uint32_t o, n;
+		memcpy(&o, &oldvalue, sizeof(o));
+		memcpy(&n, data, sizeof(n));
+		return __atomic_compare_exchange_n((uint32_t *) host, &o, n,
+		    false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+	} else if (len == sizeof(uint64_t)) {
+		uint64_t o = oldvalue, n;
+		memcpy(&n, data, sizeof(n));
+		return __atomic_compare_exchange_n((uint64_t *) host, &o, n,
+		    false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+	}
+#endif
+
+	if (memcmp(host, &oldvalue, len) != 0)
+		return false;
+
+	memcpy(host, data, len);
+	return true;
+}
+
+
+/*
+ *  cpu_reservation_set():
+ *
+ *  Called by load-linked instructions, once the len bytes at vaddr have been
+ *  loaded into data. host is the host address of the word if its page is in
+ *  the fast load translation tables, otherwise NULL.
+ */
+void cpu_reservation_set(struct cpu *cpu, uint64_t vaddr,
+	const unsigned char *data, int len, uint64_t granule,
+	unsigned char *host)
+{
+	struct cpu_reservation *r = &cpu->reservation;
+
+	if (!r->active)
+		cpu->machine->n_reservations ++;
+
+	r->active = true;
+	r->len = len;
+	r->vaddr = vaddr;
+	r->granule = granule;
+	r->host = host;
+	r->value = 0;
+	memcpy(&r->value, data, len);
+}
+
+
+/*
+ *  cpu_reservation_clear():
+ *
+ *  Clears the CPU's reservation, if any. (E.g. on return from exception.)
+ */
+void cpu_reservation_clear(struct cpu *cpu)
+{
+	if (cpu->reservation.active) {
+		cpu->reservation.active = false;
+		cpu->machine->n_reservations --;
+	}
+}
+
+
+/*
+ *  cpu_reservation_invalidate():
+ *
+ *  Called when len bytes have been written to host memory at host (or, if
+ *  host is NULL, to something other than host memory at vaddr). Clears the
+ *  reservations of all CPUs in the machine whose granule overlaps the
+ *  written bytes. Reservations without a host address are compared using
+ *  virtual addresses instead.
+ */
+void cpu_reservation_invalidate(struct machine *machine,
+	unsigned char *host, uint64_t vaddr, int len)
+{
+	for (int i=0; i<machine->ncpus && machine->n_reservations > 0; i++) {
+		struct cpu_reservation *r = &machine->cpus[i]->reservation;
+		uint64_t mask, a, b;
+
+		if (!r->active)
+			continue;
+
+		if (r->host != NULL) {
+			if (host == NULL)
+				continue;
+			a = (size_t) host;
+			b = (size_t) r->host;
+		} else {
+			a = vaddr;
+			b = r->vaddr;
+		}
+
+		mask = ~(r->granule - 1);
+		if ((a & mask) <= (b & mask) &&
+		    ((a + len - 1) & mask) >= (b & mask))
+			cpu_reservation_clear(machine->cpus[i]);
+	}
+}
+
+
+/*
+ *  cpu_reservation_store():
+ *
+ *  Store-conditional of the len bytes in data (in guest memory order) to
+ *  vaddr. host is the host address of the word if its page is in the fast
+ *  store translation tables, otherwise NULL.
+ *
+ *  If the reserved word is in host memory, the store only succeeds if the
+ *  word still contains the value which was loaded. If it is also writable
+ *  through host, then the check and the store are a single host atomic
+ *  compare-and-swap; otherwise the store is done using memory_rw().
+ *
+ *  Returns 1 if the store was performed, 0 if the store-conditional failed,
+ *  or -1 if memory_rw() caused an exception.
+ */
+int cpu_reservation_store(struct cpu *cpu, uint64_t vaddr,
+	unsigned char *data, int len, unsigned char *host)
+{
+	struct cpu_reservation *r = &cpu->reservation;
+	bool matches = r->active && r->vaddr == vaddr && r->len == len;
+
+	cpu_reservation_clear(cpu);
+
+	if (!matches)
+		return 0;
+
+	if (r->host != NULL && host == r->host) {
+		if (!host_cas(host, r->value, data, len))
+			return 0;
+
+		cpu_reservation_invalidate(cpu->machine, host, vaddr, len);
+		return 1;
+	}
+
+	if (r->host != NULL && memcmp(r->host, &r->value, len) != 0)
+		return 0;
+
+	/*  (memory_rw() invalidates reservations on host memory.)  */
+	if (!cpu->memory_rw(cpu, cpu->mem, vaddr, data, len, MEM_WRITE,
+	    CACHE_DATA))
+		return -1;
+
+	cpu_reservation_invalidate(cpu->machine, NULL, vaddr, len);
+	return 1;
+}
+
+
+/*
+ *  cpu_host_atomic_exchange():
+ *
+ *  Atomically exchanges len (1 or 4) bytes of host memory at host (backing
+ *  the virtual address vaddr) with the bytes in data, e.g. for ARM swp or
+ *  M88K xmem, and clears overlapping reservations.
+ */
+void cpu_host_atomic_exchange(struct cpu *cpu, uint64_t vaddr,
+	unsigned char *host, unsigned char *data, int len)
+{
+#ifdef __GNUC__
+	if (len == sizeof(uint32_t)) {
+		uint32_t x;
+		memcpy(&x, data, sizeof(x));
+		x = __atomic_exchange_n((uint32_t *) host, x,
+		    __ATOMIC_SEQ_CST);
+		memcpy(data, &x, sizeof(x));
+	} else {
+		data[0] = __atomic_exchange_n(host, data[0],
+		    __ATOMIC_SEQ_CST);
+	}
+#else
+	unsigned char tmp[sizeof(uint32_t)];
+	memcpy(tmp, host, len);
+	memcpy(host, data, len);
+	memcpy(data, tmp, len);
+#endif
+
+	if (cpu->machine->n_reservations > 0)
+		cpu_reservation_invalidate(cpu->machine, host, vaddr, len);
+}
+
+
 /*
  *  cpu_dumpinfo():
  *
@@ -493,6 +879,20 @@ void cpu_show_cycles(struct machine *machine, uint64_t total_elapsed_ms)
 		snprintf(buf + strlen(buf), sizeof(buf) - strlen(buf),
 		    ", stopped");
 
+	/*  Share of each CPU's slices which were cut short by spin-waits:  */
+	if (machine->ncpus > 1) {
+		snprintf(buf + strlen(buf), sizeof(buf) - strlen(buf),
+		    "; spin:");
+
+		for (int i=0; i<machine->ncpus; i++) {
+			struct cpu *c = machine->cpus[i];
+			snprintf(buf + strlen(buf), sizeof(buf) - strlen(buf),
+			    " cpu%i=%i%%", i, c->n_slices == 0? 0 :
+			    (int) (c->n_spin_slices * 100 / c->n_slices));
+			c->n_slices = c->n_spin_slices = 0;
+		}
+	}
+
 	debugmsg_cpu(cpu, SUBSYS_STARTUP, "", VERBOSITY_WARNING, "%s", buf);
 }
 
@@ -83,6 +83,7 @@ void arm_pc_to_pointers(struct cpu *cpu);
 
 void arm_irq_interrupt_assert(struct interrupt *interrupt);
 void arm_irq_interrupt_deassert(struct interrupt *interrupt);
+bool arm_cpu_interrupt_check(struct cpu *cpu);
 
 
 /*
@@ -116,6 +117,7 @@ int arm_cpu_new(struct cpu *cpu, struct memory *mem,
 	    arm_invalidate_translation_caches;
 	cpu->invalidate_code_translation = arm_invalidate_code_translation;
 	cpu->translate_v2p = arm_translate_v2p;
+	cpu->interrupt_check = arm_cpu_interrupt_check;
 
 	cpu->cd.arm.cpu_type = cpu_type_defs[found];
 	cpu->name            = strdup(cpu->cd.arm.cpu_type.name);
@@ -725,6 +727,17 @@ void arm_cpu_tlbdump(struct cpu *cpu, int rawflag)
 }
 
 
+/*
+ *  arm_cpu_interrupt_check():
+ *
+ *  Returns true if the IRQ line is asserted, and IRQs are not masked.
+ */
+bool arm_cpu_interrupt_check(struct cpu *cpu)
+{
+	return cpu->cd.arm.irq_asserted && !(cpu->cd.arm.cpsr & ARM_FLAG_I);
+}
+
+
 /*
  *  arm_irq_interrupt_assert():
  *  arm_irq_interrupt_deassert():
@@ -733,11 +746,13 @@ void arm_irq_interrupt_assert(struct interrupt *interrupt)
 {
 	struct cpu *cpu = (struct cpu *) interrupt->extra;
 	cpu->cd.arm.irq_asserted = 1;
+	cpu_interrupt_update(cpu);
 }
 void arm_irq_interrupt_deassert(struct interrupt *interrupt)
 {
 	struct cpu *cpu = (struct cpu *) interrupt->extra;
 	cpu->cd.arm.irq_asserted = 0;
+	cpu_interrupt_update(cpu);
 }
 
 
@@ -854,6 +854,8 @@ X(msr_imm)
 
 	if (switch_register_banks)
 		arm_load_register_bank(cpu);
+
+	cpu_interrupt_update(cpu);
 }
 Y(msr_imm)
 X(msr)
@@ -1255,6 +1257,9 @@ Y(bfi)
 /*
  *  swp, swpb:  Swap (word or byte).
  *
+ *  If the page is writable directly in host memory, the swap is done as a
+ *  host atomic exchange. Otherwise the load and store use memory_rw().
+ *
  *  arg[0] = ptr to rd
  *  arg[1] = ptr to rm
  *  arg[2] = ptr to rn
@@ -1263,6 +1268,19 @@ X(swp)
 {
 	uint32_t addr = reg(ic->arg[2]), data, data2;
 	unsigned char d[4];
+	unsigned char *page = cpu->cd.arm.host_store[addr >> 12];
+
+	/*  Fast case: an atomic exchange directly in host memory.  */
+	if (page != NULL && !(addr & 3)) {
+		data2 = reg(ic->arg[1]);
+		d[0] = data2; d[1] = data2 >> 8;
+		d[2] = data2 >> 16; d[3] = data2 >> 24;
+		cpu_host_atomic_exchange(cpu, addr, page + (addr & 0xfff),
+		    d, sizeof(d));
+		reg(ic->arg[0]) = d[0] + (d[1] << 8) + (d[2] << 16)
+		    + (d[3] << 24);
+		return;
+	}
 
 	/*  Synchronize the program counter:  */
 	uint32_t low_pc = ((size_t)ic - (size_t)
@@ -1293,6 +1311,16 @@ X(swpb)
 {
 	uint32_t addr = reg(ic->arg[2]), data;
 	unsigned char d[1];
+	unsigned char *page = cpu->cd.arm.host_store[addr >> 12];
+
+	/*  Fast case: an atomic exchange directly in host memory.  */
+	if (page != NULL) {
+		d[0] = reg(ic->arg[1]);
+		cpu_host_atomic_exchange(cpu, addr, page + (addr & 0xfff),
+		    d, sizeof(d));
+		reg(ic->arg[0]) = d[0];
+		return;
+	}
 
 	/*  Synchronize the program counter:  */
 	uint32_t low_pc = ((size_t)ic - (size_t)
@@ -1513,6 +1541,8 @@ void arm_pop(struct cpu* cpu, uint32_t* np, int p_bit, int u_bit, int s_bit, int
 
 		if (switch_register_banks)
 			arm_load_register_bank(cpu);
+
+		cpu_interrupt_update(cpu);
 	}
 
 	/*  NOTE: Special case: Loading the PC  */
@@ -1706,6 +1736,7 @@ X(ldrex)
 	uint32_t addr = reg(ic->arg[1]) + (int32_t)ic->arg[2];
 	int low_pc;
 	uint8_t word[sizeof(uint32_t)];
+	unsigned char *page;
 
 	/*  Synchronize the program counter:  */
 	low_pc = ((size_t)ic - (size_t)
@@ -1726,9 +1757,9 @@ X(ldrex)
 		return;
 	}
 
-	cpu->cd.arm.rmw = 1;
-	cpu->cd.arm.rmw_addr = addr;
-	cpu->cd.arm.rmw_len = sizeof(word);
+	page = DYNTRANS_HOST_PAGE(cpu, addr, 0);
+	cpu_reservation_set(cpu, addr, word, sizeof(word),
+	    ARM_RESERVATION_GRANULE, page == NULL? NULL : page + (addr & 0xfff));
 
 	if (cpu->byte_order == EMUL_LITTLE_ENDIAN)
 		reg(ic->arg[0]) = word[0] + (word[1] << 8)
@@ -1749,8 +1780,9 @@ X(strex)
 {
 	uint32_t addr = reg(ic->arg[1]);
 	uint64_t r = reg(ic->arg[2]);
-	int low_pc, i;
+	int low_pc, res;
 	uint8_t word[sizeof(uint32_t)];
+	unsigned char *page;
 	
 	/*  Synchronize the program counter:  */
 	low_pc = ((size_t)ic - (size_t)
@@ -1771,41 +1803,17 @@ X(strex)
 		word[3]=r; word[2]=r>>8; word[1]=r>>16; word[0]=r>>24;
 	}
 
-	/*  If rmw is 0, then the store failed.  (This cache-line was written
-	    to by someone else.)  */
-	if (cpu->cd.arm.rmw == 0 || cpu->cd.arm.rmw_addr != addr
-	    || cpu->cd.arm.rmw_len != sizeof(word)) {
-		reg(ic->arg[0]) = 1;	// 1 = fail.
-		cpu->cd.arm.rmw = 0;
-		return;
-	}
-
-	if (!cpu->memory_rw(cpu, cpu->mem, addr, word,
-	    sizeof(word), MEM_WRITE, CACHE_DATA)) {
-		/*  An exception occurred.  */
-		return;
-	}
-
-	/*  We succeeded. Let's invalidate everybody else's store to this
-	    cache line:  */
-	for (i=0; i<cpu->machine->ncpus; i++) {
-		if (cpu->machine->cpus[i]->cd.arm.rmw) {
-			uint64_t yaddr = addr, xaddr = cpu->machine->cpus[i]->
-			    cd.arm.rmw_addr;
-
-			/*  8-2048 bytes, implementation dependent :-(  */			
-			/*  https://stackoverflow.com/questions/11383125/do-the-arm-instructions-ldrex-strex-have-to-operate-on-cache-aligned-data  */
-			uint64_t mask = 2047;
-
-			xaddr &= mask;
-			yaddr &= mask;
-			if (xaddr == yaddr)
-				cpu->machine->cpus[i]->cd.arm.rmw = 0;
-		}
-	}
+	/*
+	 *  The store fails if there is no reservation for this address, or
+	 *  if the word has been changed since it was loaded:
+	 */
+	page = DYNTRANS_HOST_PAGE(cpu, addr, 1);
+	res = cpu_reservation_store(cpu, addr, word, sizeof(word),
+	    page == NULL? NULL : page + (addr & 0xfff));
 
-	reg(ic->arg[0]) = 0;	// 0 = success
-	cpu->cd.arm.rmw = 0;
+	/*  (res < 0 means that an exception occurred.)  */
+	if (res >= 0)
+		reg(ic->arg[0]) = !res;		// 0 = success, 1 = fail
 }
 Y(strex)
 
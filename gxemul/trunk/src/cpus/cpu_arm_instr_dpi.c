@@ -216,6 +216,7 @@ void A__NAME(struct cpu *cpu, struct arm_instr_call *ic)
 		}
 		cpu->cd.arm.flags = cpu->cd.arm.cpsr >> 28;
 		arm_load_register_bank(cpu);
+		cpu_interrupt_update(cpu);
 #else
 		if ((old_pc & ~mask_within_page) ==
 		    ((uint32_t)cpu->pc & ~mask_within_page)) {
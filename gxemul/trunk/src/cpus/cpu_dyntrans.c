@@ -177,6 +177,7 @@ static void gather_statistics(struct cpu *cpu)
 int DYNTRANS_RUN_INSTR_DEF(struct cpu *cpu)
 {
 	MODE_uint_t cached_pc;
+	int64_t next_event;
 	int low_pc;
 
 	/*  Ugly... fix this some day.  */
@@ -198,57 +199,42 @@ int DYNTRANS_RUN_INSTR_DEF(struct cpu *cpu)
 	 *  then interrupts are probably disabled, and the exception will get
 	 *  priority over device interrupts.)
 	 *
-	 *  TODO: Turn this into a family-specific function somewhere...
- 	 */
+	 *  Whether an interrupt is asserted and enabled is decided by the
+	 *  arch-specific interrupt_check function, via cpu_interrupt_update().
+	 *  That is also called when interrupt lines or the interrupt enable
+	 *  state change while running, so that the dyntrans loop below is
+	 *  left early and the interrupt gets taken here.
+	 */
 
 	/*  Note: Do not cause interrupts while single-stepping. It is
 	    so horribly annoying.  */
 	if (!single_step) {
+		cpu_interrupt_update(cpu);
+		if (cpu->interrupt_pending) {
 #ifdef DYNTRANS_ARM
-		if (cpu->cd.arm.irq_asserted && !(cpu->cd.arm.cpsr & ARM_FLAG_I))
 			arm_exception(cpu, ARM_EXCEPTION_IRQ);
 #endif
 #ifdef DYNTRANS_M88K
-		if (cpu->cd.m88k.irq_asserted &&
-		    !(cpu->cd.m88k.cr[M88K_CR_PSR] & M88K_PSR_IND))
 			m88k_exception(cpu, M88K_EXCEPTION_INTERRUPT, 0);
 #endif
 #ifdef DYNTRANS_MIPS
-		int enabled, mask;
-		int status = cpu->cd.mips.coproc[0]->reg[COP0_STATUS];
-		if (cpu->cd.mips.cpu_type.exc_model == EXC3K) {
-			/*  R3000:  */
-			enabled = status & MIPS_SR_INT_IE;
-		} else {
-			/*  R4000 and others:  */
-			enabled = (status & STATUS_IE)
-			    && !(status & STATUS_EXL) && !(status & STATUS_ERL);
-			/*  Special case for R5900/C790/TX79:  */
-			if (cpu->cd.mips.cpu_type.rev == MIPS_R5900 &&
-			    !(status & R5900_STATUS_EIE))
-				enabled = 0;
-		}
-		mask = status & cpu->cd.mips.coproc[0]->reg[COP0_CAUSE]
-		    & STATUS_IM_MASK;
-
-		if (enabled && mask)
-			mips_cpu_exception(cpu, EXCEPTION_INT, 0, 0, 0, 0, 0,0);
+			mips_cpu_exception(cpu, EXCEPTION_INT, 0, 0, 0, 0, 0, 0);
 #endif
 #ifdef DYNTRANS_PPC
-		if (cpu->cd.ppc.dec_intr_pending && cpu->cd.ppc.msr & PPC_MSR_EE) {
-			if (!(cpu->cd.ppc.cpu_type.flags & PPC_NO_DEC))
-				ppc_exception(cpu, PPC_EXCEPTION_DEC);
-			cpu->cd.ppc.dec_intr_pending = 0;
-		}
-		if (cpu->cd.ppc.irq_asserted && cpu->cd.ppc.msr & PPC_MSR_EE)
-			ppc_exception(cpu, PPC_EXCEPTION_EI);
+			if (cpu->cd.ppc.dec_intr_pending) {
+				if (!(cpu->cd.ppc.cpu_type.flags & PPC_NO_DEC))
+					ppc_exception(cpu, PPC_EXCEPTION_DEC);
+				cpu->cd.ppc.dec_intr_pending = 0;
+			}
+			if (cpu->cd.ppc.irq_asserted &&
+			    cpu->cd.ppc.msr & PPC_MSR_EE)
+				ppc_exception(cpu, PPC_EXCEPTION_EI);
 #endif
 #ifdef DYNTRANS_SH
-		if (cpu->cd.sh.int_to_assert > 0 && !(cpu->cd.sh.sr & SH_SR_BL)
-		    && ((cpu->cd.sh.sr & SH_SR_IMASK) >> SH_SR_IMASK_SHIFT)
-		    < cpu->cd.sh.int_level)
 			sh_exception(cpu, 0, cpu->cd.sh.int_to_assert, 0);
 #endif
+			cpu->interrupt_pending = false;
+		}
 	}
 
 #ifdef DYNTRANS_ARM
@@ -266,6 +252,22 @@ int DYNTRANS_RUN_INSTR_DEF(struct cpu *cpu)
 
 	cpu->n_translated_instrs = 0;
 
+	/*
+	 *  If a CPU-internal timer or a device event is due before the end
+	 *  of this slice, then start counting from a bit higher up, so that
+	 *  the loop below ends (within one block of instructions) when the
+	 *  event is reached.
+	 */
+	next_event = cpu->timer_event_ninstrs < cpu->event_ninstrs?
+	    cpu->timer_event_ninstrs : cpu->event_ninstrs;
+	if (next_event - cpu->ninstrs < N_SAFE_DYNTRANS_LIMIT) {
+		int64_t left = next_event - cpu->ninstrs;
+		cpu->n_translated_instrs = N_SAFE_DYNTRANS_LIMIT -
+		    (left > 0? left : 0);
+	}
+
+	cpu->n_translated_base = cpu->n_translated_instrs;
+
 	cpu->cd.DYNTRANS_ARCH.cur_physpage = (struct DYNTRANS_TC_PHYSPAGE *)
 	    cpu->cd.DYNTRANS_ARCH.cur_ic_page;
 
@@ -373,13 +375,11 @@ int DYNTRANS_RUN_INSTR_DEF(struct cpu *cpu)
 	if (cpu->n_translated_instrs >= N_BREAK_OUT_OF_DYNTRANS_LOOP)
 		cpu->n_translated_instrs -= N_BREAK_OUT_OF_DYNTRANS_LOOP;
 
+	cpu->n_translated_instrs -= cpu->n_translated_base;
+	cpu->n_translated_base = 0;
+
 	if (cpu->wants_to_idle) {
-		// TODO: More arch specific interrupt checks
-		if (false
-#ifdef DYNTRANS_M88K
-		    || (cpu->cd.m88k.irq_asserted && !(cpu->cd.m88k.cr[M88K_CR_PSR] & M88K_PSR_IND))
-#endif
-		    ) {
+		if (cpu->interrupt_check != NULL && cpu->interrupt_check(cpu)) {
 			debugmsg_cpu(cpu, SUBSYS_CPU, "idle", VERBOSITY_DEBUG, "not idling due to irq_asserted");
 			cpu->wants_to_idle = false;
 		}
@@ -409,53 +409,45 @@ int DYNTRANS_RUN_INSTR_DEF(struct cpu *cpu)
 		    DYNTRANS_INSTR_ALIGNMENT_SHIFT);
 	}
 
-#ifdef DYNTRANS_MIPS
-	/*  Update the count register (on everything except EXC3K):  */
-	if (cpu->cd.mips.cpu_type.exc_model != EXC3K) {
-		uint32_t old;
-		int32_t diff1, diff2;
-		cpu->cd.mips.coproc[0]->reg[COP0_COUNT] -= cpu->cd.mips.count_register_read_count;
-		cpu->cd.mips.count_register_read_count = 0;
-		old = cpu->cd.mips.coproc[0]->reg[COP0_COUNT];
-		diff1 = cpu->cd.mips.coproc[0]->reg[COP0_COMPARE] - old;
-		cpu->cd.mips.coproc[0]->reg[COP0_COUNT] =
-		    (int32_t) (old + cpu->n_translated_instrs);
-		diff2 = cpu->cd.mips.coproc[0]->reg[COP0_COMPARE] -
-		    cpu->cd.mips.coproc[0]->reg[COP0_COUNT];
-
-		if (cpu->cd.mips.compare_register_set) {
-#if 1
-/*  Not yet.  TODO  */
-			if (cpu->machine->emulated_hz > 0) {
-				if (cpu->cd.mips.compare_interrupts_pending > 0)
-					INTERRUPT_ASSERT(
-					    cpu->cd.mips.irq_compare);
-			} else
-#endif
-			{
-				if (diff1 > 0 && diff2 <= 0)
-					INTERRUPT_ASSERT(
-					    cpu->cd.mips.irq_compare);
-			}
-		}
+	cpu->ninstrs += cpu->n_translated_instrs;
+	cpu->n_translated_base = cpu->n_translated_instrs;
+
+	/*
+	 *  An idling CPU waiting for a device event (e.g. a disk read to
+	 *  complete) skips ahead to it, or to the CPU-internal timer if that
+	 *  comes first. The guest would only have been idling in between.
+	 */
+	if (cpu->wants_to_idle && cpu->event_ninstrs != INT64_MAX) {
+		next_event = cpu->timer_event_ninstrs < cpu->event_ninstrs?
+		    cpu->timer_event_ninstrs : cpu->event_ninstrs;
+		if (next_event > cpu->ninstrs)
+			cpu->ninstrs = next_event;
+		cpu->wants_to_idle = false;
 	}
+
+	/*  CPU-internal timer interrupt due?  */
+	if (cpu->ninstrs >= cpu->timer_event_ninstrs) {
+#ifdef DYNTRANS_MIPS
+		mips_timer_event(cpu);
 #endif
 #ifdef DYNTRANS_PPC
-	/*  Update the Decrementer and Time base registers:  */
-	{
-		uint32_t old = cpu->cd.ppc.spr[SPR_DEC];
-		cpu->cd.ppc.spr[SPR_DEC] = (uint32_t) (old - cpu->n_translated_instrs);
-		if ((old >> 31) == 0 && (cpu->cd.ppc.spr[SPR_DEC] >> 31) == 1
-		    && !(cpu->cd.ppc.cpu_type.flags & PPC_NO_DEC))
-			cpu->cd.ppc.dec_intr_pending = 1;
-		old = cpu->cd.ppc.spr[SPR_TBL];
-		cpu->cd.ppc.spr[SPR_TBL] += cpu->n_translated_instrs;
-		if ((old >> 31) == 1 && (cpu->cd.ppc.spr[SPR_TBL] >> 31) == 0)
-			cpu->cd.ppc.spr[SPR_TBU] ++;
+		ppc_timer_event(cpu);
+#endif
 	}
+
+	/*  Device events due?  */
+	if (cpu->ninstrs >= cpu->event_ninstrs)
+		cpu_event_run(cpu);
+
+#ifdef DYNTRANS_MIPS
+	/*  Periodic timer, when emulating a specific clock rate:  */
+	if (cpu->cd.mips.compare_interrupts_pending > 0)
+		INTERRUPT_ASSERT(cpu->cd.mips.irq_compare);
 #endif
 
-	cpu->ninstrs += cpu->n_translated_instrs;
+	/*  Interrupts asserted above may have asked for a break-out:  */
+	if (cpu->n_translated_instrs >= N_BREAK_OUT_OF_DYNTRANS_LOOP)
+		cpu->n_translated_instrs -= N_BREAK_OUT_OF_DYNTRANS_LOOP;
 
 	/*  Return the nr of instructions executed:  */
 	return cpu->n_translated_instrs;
@@ -898,6 +890,110 @@ have_it:
 
 
 
+#ifdef DYNTRANS_BULK_MEMORY
+/*
+ *  XXX_host_page():
+ *
+ *  Returns a pointer to the host memory page which backs the virtual address
+ *  vaddr, as used by the load/store fast paths (host_load if writeflag is
+ *  zero, host_store otherwise), or NULL if there is no such fast translation.
+ *
+ *  This is meant for instruction combinations which recognize bulk memory
+ *  loops (memset, memcpy, etc.) and execute them as host operations. A NULL
+ *  return value means that the combination should fall back to running the
+ *  guest instructions one by one, which will then take care of exceptions,
+ *  device accesses, and invalidation of translated code.
+ */
+unsigned char *DYNTRANS_HOST_PAGE(struct cpu *cpu, MODE_uint_t vaddr,
+	int writeflag)
+{
+#ifdef MODE32
+	int index = DYNTRANS_ADDR_TO_PAGENR(vaddr);
+
+	return writeflag? cpu->cd.DYNTRANS_ARCH.host_store[index]
+	    : cpu->cd.DYNTRANS_ARCH.host_load[index];
+#else
+	const uint32_t mask1 = (1 << DYNTRANS_L1N) - 1;
+	const uint32_t mask2 = (1 << DYNTRANS_L2N) - 1;
+	const uint32_t mask3 = (1 << DYNTRANS_L3N) - 1;
+	uint32_t x1 = (vaddr >> (64-DYNTRANS_L1N)) & mask1;
+	uint32_t x2 = (vaddr >> (64-DYNTRANS_L1N-DYNTRANS_L2N)) & mask2;
+	uint32_t x3 = (vaddr >> (64-DYNTRANS_L1N-DYNTRANS_L2N-DYNTRANS_L3N))
+	    & mask3;
+	struct DYNTRANS_L2_64_TABLE *l2 = cpu->cd.DYNTRANS_ARCH.l1_64[x1];
+	struct DYNTRANS_L3_64_TABLE *l3 = l2->l3[x2];
+
+	return writeflag? l3->host_store[x3] : l3->host_load[x3];
+#endif
+}
+
+
+/*
+ *  XXX_bulk_memset():
+ *
+ *  Fills len bytes starting at vaddr with the byte value c, directly in host
+ *  memory. Only the part up to the end of the page is filled.
+ *
+ *  Returns the number of bytes filled, or 0 if the page is not available
+ *  for fast stores.
+ */
+size_t DYNTRANS_BULK_MEMSET(struct cpu *cpu, MODE_uint_t vaddr, int c,
+	size_t len)
+{
+	size_t ofs = vaddr & (DYNTRANS_PAGESIZE - 1);
+	unsigned char *page = DYNTRANS_HOST_PAGE(cpu, vaddr, 1);
+
+	if (page == NULL)
+		return 0;
+
+	if (len > DYNTRANS_PAGESIZE - ofs)
+		len = DYNTRANS_PAGESIZE - ofs;
+
+	memset(page + ofs, c, len);
+	return len;
+}
+
+
+/*
+ *  XXX_bulk_memcpy():
+ *
+ *  Copies len bytes from src to dst, directly in host memory, with the same
+ *  result as a forward copy loop. Copying stops at the first page boundary
+ *  of either src or dst.
+ *
+ *  Returns the number of bytes copied, or 0 if either page is not available
+ *  as host memory, or if the areas overlap with dst above src (where a
+ *  forward copy loop would replicate data, unlike memmove).
+ */
+size_t DYNTRANS_BULK_MEMCPY(struct cpu *cpu, MODE_uint_t dst,
+	MODE_uint_t src, size_t len)
+{
+	size_t dst_ofs = dst & (DYNTRANS_PAGESIZE - 1);
+	size_t src_ofs = src & (DYNTRANS_PAGESIZE - 1);
+	unsigned char *dst_page = DYNTRANS_HOST_PAGE(cpu, dst, 1);
+	unsigned char *src_page = DYNTRANS_HOST_PAGE(cpu, src, 0);
+	unsigned char *d, *s;
+
+	if (dst_page == NULL || src_page == NULL)
+		return 0;
+
+	if (len > DYNTRANS_PAGESIZE - dst_ofs)
+		len = DYNTRANS_PAGESIZE - dst_ofs;
+	if (len > DYNTRANS_PAGESIZE - src_ofs)
+		len = DYNTRANS_PAGESIZE - src_ofs;
+
+	d = dst_page + dst_ofs;
+	s = src_page + src_ofs;
+	if (d > s && d < s + len)
+		return 0;
+
+	memmove(d, s, len);
+	return len;
+}
+#endif	/*  DYNTRANS_BULK_MEMORY  */
+
+
+
 #ifdef DYNTRANS_INIT_TABLES
 
 /*  forward declaration of to_be_translated and end_of_page:  */
@@ -1220,6 +1316,16 @@ void DYNTRANS_INVALIDATE_TC(struct cpu *cpu, uint64_t addr, int flags)
 
 	/*  fatal("invalidate(): ");  */
 
+#ifdef DYNTRANS_MIPS
+	/*  Translations saved for inactive ASIDs must be kept in synch:  */
+	mips_asid_cache_invalidate(cpu, addr, flags);
+#endif
+
+#ifdef DYNTRANS_PPC
+	/*  ... and so must the PowerPC software TLB and decoded BATs:  */
+	ppc_pte_cache_invalidate(cpu, addr, flags);
+#endif
+
 	/*  Quick case for _one_ virtual addresses: see note above.  */
 	if (flags & INVALIDATE_VADDR) {
 		/*  fatal("vaddr 0x%08x\n", (int)addr_page);  */
@@ -1281,6 +1387,30 @@ void DYNTRANS_INVALIDATE_TC(struct cpu *cpu, uint64_t addr, int flags)
 				// cpu->cd.DYNTRANS_ARCH.vph_tlb_entry[r].valid=0;
 			}
 		}
+
+#ifdef MODE32
+		/*
+		 *  All entries in the VPH32 arrays are now zero. If the
+		 *  translations have been spread out over many chunks, then
+		 *  give the host memory back:
+		 */
+		if (cpu->cd.DYNTRANS_ARCH.vph32_n_chunks_used >
+		    VPH32_RELEASE_CHUNKS) {
+			zeroed_release(cpu->cd.DYNTRANS_ARCH.host_load,
+			    sizeof(cpu->cd.DYNTRANS_ARCH.host_load));
+			zeroed_release(cpu->cd.DYNTRANS_ARCH.host_store,
+			    sizeof(cpu->cd.DYNTRANS_ARCH.host_store));
+			zeroed_release(cpu->cd.DYNTRANS_ARCH.phys_addr,
+			    sizeof(cpu->cd.DYNTRANS_ARCH.phys_addr));
+			zeroed_release(cpu->cd.DYNTRANS_ARCH.phys_page,
+			    sizeof(cpu->cd.DYNTRANS_ARCH.phys_page));
+			zeroed_release(cpu->cd.DYNTRANS_ARCH.vaddr_to_tlbindex,
+			    sizeof(cpu->cd.DYNTRANS_ARCH.vaddr_to_tlbindex));
+			memset(cpu->cd.DYNTRANS_ARCH.vph32_chunk_used, 0,
+			    sizeof(cpu->cd.DYNTRANS_ARCH.vph32_chunk_used));
+			cpu->cd.DYNTRANS_ARCH.vph32_n_chunks_used = 0;
+		}
+#endif
 		return;
 	}
 
@@ -1593,6 +1723,14 @@ void DYNTRANS_UPDATE_TRANSLATION_TABLE(struct cpu *cpu, uint64_t vaddr_page,
 		cpu->cd.DYNTRANS_ARCH.phys_addr[index] = paddr_page;
 		cpu->cd.DYNTRANS_ARCH.phys_page[index] = NULL;
 		cpu->cd.DYNTRANS_ARCH.vaddr_to_tlbindex[index] = r + 1;
+		if (!(cpu->cd.DYNTRANS_ARCH.vph32_chunk_used[index >>
+		    (VPH32_CHUNK_SHIFT + 5)] & (1 << ((index >>
+		    VPH32_CHUNK_SHIFT) & 31)))) {
+			cpu->cd.DYNTRANS_ARCH.vph32_chunk_used[index >>
+			    (VPH32_CHUNK_SHIFT + 5)] |= 1 << ((index >>
+			    VPH32_CHUNK_SHIFT) & 31);
+			cpu->cd.DYNTRANS_ARCH.vph32_n_chunks_used ++;
+		}
 #ifdef DYNTRANS_ARM
 		if (useraccess)
 			cpu->cd.DYNTRANS_ARCH.is_userpage[index >> 5]
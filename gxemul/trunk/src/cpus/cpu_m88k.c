@@ -67,6 +67,7 @@ static const char *memop[4] = { ".d", "", ".h", ".b" };
 
 void m88k_irq_interrupt_assert(struct interrupt *interrupt);
 void m88k_irq_interrupt_deassert(struct interrupt *interrupt);
+bool m88k_cpu_interrupt_check(struct cpu *cpu);
 
 
 static const char *m88k_cr_names[] = M88K_CR_NAMES;
@@ -131,6 +132,7 @@ int m88k_cpu_new(struct cpu *cpu, struct memory *mem,
 	cpu->byte_order      = EMUL_BIG_ENDIAN;
 
 	cpu->instruction_has_delayslot = m88k_cpu_instruction_has_delayslot;
+	cpu->interrupt_check = m88k_cpu_interrupt_check;
 
 	cpu->vaddr_mask = 0x00000000ffffffffULL;
 
@@ -392,6 +394,19 @@ void m88k_cpu_tlbdump(struct cpu* cpu, int rawflag)
 }
 
 
+/*
+ *  m88k_cpu_interrupt_check():
+ *
+ *  Returns true if the interrupt line is asserted, and interrupts are not
+ *  disabled in the PSR.
+ */
+bool m88k_cpu_interrupt_check(struct cpu *cpu)
+{
+	return cpu->cd.m88k.irq_asserted &&
+	    !(cpu->cd.m88k.cr[M88K_CR_PSR] & M88K_PSR_IND);
+}
+
+
 /*
  *  m88k_irq_interrupt_assert():
  *  m88k_irq_interrupt_deassert():
@@ -400,11 +415,13 @@ void m88k_irq_interrupt_assert(struct interrupt *interrupt)
 {
 	struct cpu *cpu = (struct cpu *) interrupt->extra;
 	cpu->cd.m88k.irq_asserted = 1;
+	cpu_interrupt_update(cpu);
 }
 void m88k_irq_interrupt_deassert(struct interrupt *interrupt)
 {
 	struct cpu *cpu = (struct cpu *) interrupt->extra;
 	cpu->cd.m88k.irq_asserted = 0;
+	cpu_interrupt_update(cpu);
 }
 
 
@@ -538,6 +555,7 @@ void m88k_stcr(struct cpu *cpu, uint32_t value, int cr, int rte)
 			    cpu, 0, INVALIDATE_ALL);
 
 		cpu->cd.m88k.cr[cr] = value;
+		cpu_interrupt_update(cpu);
 		break;
 
 	case M88K_CR_EPSR:
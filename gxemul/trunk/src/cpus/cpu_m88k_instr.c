@@ -1680,15 +1680,14 @@ abort_dump:
 
 
 /*
- *  xmem_slow:  Unoptimized xmem (exchange register with memory)
+ *  xmem_slow:  xmem (exchange register with memory)
  *
  *  arg[0] = copy of the instruction word
  *
- *  NOTE: The alternative would be to extend the load/store instructions
- *  to also include xmem, and thus implement a "fast" version (where
- *  the page is already accessible both readable and writable) and a
- *  generic version. (The generic implementation would then not need to
- *  have a NO_PC_SYNC flag, since they would always sync.)
+ *  If the page is already accessible both readable and writable in host
+ *  memory, then the exchange is a host atomic exchange. Otherwise (and for
+ *  .usr accesses), it is done as a load followed by a store, using the
+ *  generic load/store instructions.
  */
 X(xmem_slow)
 {
@@ -1717,6 +1716,29 @@ X(xmem_slow)
 		user = 0;
 	}
 
+	/*
+	 *  Fast case: the page is writable directly in host memory, so the
+	 *  exchange can be done as a host atomic exchange.
+	 */
+	if (!user) {
+		int len = size? sizeof(uint32_t) : 1;
+		uint32_t addr = cpu->cd.m88k.r[s1] + (regofs?
+		    cpu->cd.m88k.r[s2] * (scaled? len : 1) : (uint32_t) imm16);
+		uint8_t *p = cpu->cd.m88k.host_store[addr >> 12];
+
+		if (p != NULL && !(addr & (len - 1))) {
+			unsigned char buf[sizeof(uint32_t)];
+
+			memory_writemax64(cpu, buf, len, cpu->cd.m88k.r[d]);
+			cpu_host_atomic_exchange(cpu, addr, p + (addr & 0xfff),
+			    buf, len);
+			if (d != M88K_ZERO_REG)
+				cpu->cd.m88k.r[d] = memory_readmax64(cpu, buf,
+				    len);
+			return;
+		}
+	}
+
 	tmp = cpu->cd.m88k.r[d];
 
 	xmem_load = m88k_loadstore[ (size? 2 : 0)
@@ -1935,6 +1957,49 @@ X(idle_with_tb1)
 }
 
 
+/*
+ *  spin:
+ *
+ *  s:	ld    rX,rY,ofs
+ *      bcnd  ne0,rX,s
+ *
+ *  A spin-wait loop, e.g. waiting for a lock held by another CPU to be
+ *  released. If the loop is about to go around once more, the rest of the
+ *  dyntrans slice is given up (on multi-processor machines).
+ */
+X(spin)
+{
+	uint32_t rY = reg(ic[0].arg[1]) + ic[0].arg[2];
+	uint32_t index = rY >> 12;
+	unsigned char *p = cpu->cd.m88k.host_load[index];
+	uint32_t *p32 = (uint32_t *) p;
+	uint32_t v;
+
+	/*  Fallback:  */
+	if (p == NULL || (rY & 3)) {
+		instr(ld_u_4_be)(cpu, ic);
+		return;
+	}
+
+	v = p32[(rY & 0xfff) >> 2];
+	if (cpu->byte_order == EMUL_LITTLE_ENDIAN)
+		v = LE32_TO_HOST(v);
+	else
+		v = BE32_TO_HOST(v);
+
+	reg(ic[0].arg[0]) = v;
+	cpu->n_translated_instrs ++;
+
+	if (v == 0) {
+		cpu->cd.m88k.next_ic = &ic[2];
+	} else if (cpu_spin_wait(cpu)) {
+		SYNCH_PC;
+		cpu->cd.m88k.next_ic = &nothing_call;
+	} else
+		cpu->cd.m88k.next_ic = ic;
+}
+
+
 /*
  *  byte_fill_loop:
  *
@@ -2260,6 +2325,8 @@ void COMBINE(addu_imm)(struct cpu *cpu, struct m88k_instr_call *ic, int low_addr
  *  s00244844: 15b80168	ld	r13,r24,0x168	; [<m88k_cpus+0x1b0>]
  *  s00244848: ec4dfffe	bcnd.n	eq0,r13,0x00244840	; <sched_idle+0x100>
  *  s0024484c: 5853fd80 (d)	or	r2,r19,0xfd80
+ *
+ *  and spin-wait loops (bcnd ne0 instead of eq0, see spin above).
  */
 void COMBINE(idle)(struct cpu *cpu, struct m88k_instr_call *ic, int low_addr)
 {
@@ -2277,6 +2344,16 @@ void COMBINE(idle)(struct cpu *cpu, struct m88k_instr_call *ic, int low_addr)
 		return;
 	}
 
+	if (ic[0].f == instr(bcnd_samepage_ne0) &&
+	    ic[0].arg[2] == (size_t) &ic[-1] &&
+	    ic[-1].f == instr(ld_u_4_be) &&
+	    ic[0].arg[0] == ic[-1].arg[0] &&
+	    ic[-1].arg[0] != ic[-1].arg[1] &&
+	    ic[0].arg[0] != (size_t) &cpu->cd.m88k.r[M88K_ZERO_REG]) {
+		ic[-1].f = instr(spin);
+		return;
+	}
+
 	if (ic[0].f == instr(bcnd_samepage_eq0) &&
 	    ic[0].arg[2] == (size_t) &ic[-2] &&
 	    ic[-2].f == instr(tb1) &&
@@ -2825,7 +2902,8 @@ X(to_be_translated)
 
 		if ((iword & 0xffe0ffff) == 0xe840ffff ||
 		    (iword & 0xffe0ffff) == 0xe840fffe ||
-		    (iword & 0xffe0ffff) == 0xec40fffe)
+		    (iword & 0xffe0ffff) == 0xec40fffe ||
+		    (iword & 0xffe0ffff) == 0xe9a0ffff)
 			cpu->cd.m88k.combination_check = COMBINE(idle);
 
 		break;
@@ -44,6 +44,7 @@
 #include "debugger.h"
 #include "devices.h"
 #include "emul.h"
+#include "float_emul.h"
 #include "machine.h"
 #include "memory.h"
 #include "mips_cpu_types.h"
@@ -130,6 +131,7 @@ int mips_cpu_new(struct cpu *cpu, struct memory *mem, struct machine *machine,
 	}
 
 	cpu->instruction_has_delayslot = mips_cpu_instruction_has_delayslot;
+	cpu->interrupt_check = mips_cpu_interrupt_check;
 
 	/*
 	 *  CACHES:
@@ -459,6 +461,79 @@ int mips_cpu_instruction_has_delayslot(struct cpu *cpu, unsigned char *ib)
 }
 
 
+/*
+ *  mips_cpu_register_native_function():
+ *
+ *  Makes calls to the guest function with the given symbol name run the
+ *  host-native MIPS_NATIVE_* function func instead. Registering an already
+ *  registered name again changes which native function it maps to.
+ */
+static const char **native_function_names = NULL;	/*  NULL-terminated  */
+static int *native_function_numbers = NULL;
+static int n_native_functions = 0;
+
+static void mips_cpu_add_native_function(const char *name, int func)
+{
+	int i;
+
+	for (i=0; i<n_native_functions; i++)
+		if (strcmp(native_function_names[i], name) == 0) {
+			native_function_numbers[i] = func;
+			return;
+		}
+
+	CHECK_ALLOCATION(native_function_names = (const char **) realloc(
+	    native_function_names, sizeof(char *) * (n_native_functions + 2)));
+	CHECK_ALLOCATION(native_function_numbers = (int *) realloc(
+	    native_function_numbers, sizeof(int) * (n_native_functions + 1)));
+	CHECK_ALLOCATION(native_function_names[n_native_functions] =
+	    strdup(name));
+	native_function_numbers[n_native_functions ++] = func;
+	native_function_names[n_native_functions] = NULL;
+}
+
+static void mips_cpu_init_native_functions(void)
+{
+	if (native_function_names != NULL)
+		return;
+
+	mips_cpu_add_native_function("bzero", MIPS_NATIVE_BZERO);
+	mips_cpu_add_native_function("blkclr", MIPS_NATIVE_BZERO);
+	mips_cpu_add_native_function("memset", MIPS_NATIVE_MEMSET);
+	mips_cpu_add_native_function("bcopy", MIPS_NATIVE_BCOPY);
+	mips_cpu_add_native_function("ovbcopy", MIPS_NATIVE_BCOPY);
+	mips_cpu_add_native_function("memcpy", MIPS_NATIVE_MEMCPY);
+	mips_cpu_add_native_function("memmove", MIPS_NATIVE_MEMCPY);
+	mips_cpu_add_native_function("strlen", MIPS_NATIVE_STRLEN);
+}
+
+void mips_cpu_register_native_function(const char *name, int func)
+{
+	mips_cpu_init_native_functions();
+	mips_cpu_add_native_function(name, func);
+}
+
+
+/*
+ *  mips_cpu_native_function():
+ *
+ *  Returns the MIPS_NATIVE_* number of the registered guest function which
+ *  starts at addr, according to the machine's symbol table, or -1 if there
+ *  is no such function at addr.
+ */
+int mips_cpu_native_function(struct cpu *cpu, uint64_t addr)
+{
+	int i;
+
+	mips_cpu_init_native_functions();
+
+	i = get_symbol_name_index(&cpu->machine->symbol_context, addr,
+	    native_function_names);
+
+	return i < 0? -1 : native_function_numbers[i];
+}
+
+
 /*
  *  mips_cpu_tlbdump():
  *
@@ -1475,7 +1550,8 @@ disasm_ret:
 void mips_cpu_register_dump(struct cpu *cpu, int gprs, int coprocs)
 {
 	int coprocnr, i, bits32;
-	uint64_t offset;
+	uint64_t offset, value;
+	uint32_t count;
 	char *symbol;
 	int bits128 = cpu->cd.mips.cpu_type.rev == MIPS_R5900;
 
@@ -1564,6 +1640,11 @@ void mips_cpu_register_dump(struct cpu *cpu, int gprs, int coprocs)
 		}
 	}
 
+	/*  COUNT is derived from the instruction count; the register
+	    itself is only updated when the guest reads it:  */
+	count = cpu->cd.mips.count_base + (uint32_t)
+	    (cpu->ninstrs - cpu->cd.mips.count_base_ninstrs);
+
 	for (coprocnr=0; coprocnr<4; coprocnr++) {
 		int nm1 = 1;
 
@@ -1589,20 +1670,19 @@ void mips_cpu_register_dump(struct cpu *cpu, int gprs, int coprocs)
 			else
 				debug(" c%i,%02i", coprocnr, i);
 
+			value = cpu->cd.mips.coproc[coprocnr]->reg[i];
+			if (coprocnr == 0 && i == COP0_COUNT)
+				value = (int32_t) count;
+
 			if (bits32)
-				debug("=%08x", (int)cpu->cd.mips.
-				    coproc[coprocnr]->reg[i]);
+				debug("=%08x", (int)value);
 			else {
 				if (coprocnr == 0 && (i == COP0_COUNT
 				    || i == COP0_COMPARE || i == COP0_INDEX
 				    || i == COP0_RANDOM || i == COP0_WIRED))
-					debug(" =         0x%08x",
-					    (int) cpu->cd.mips.coproc[
-					    coprocnr]->reg[i]);
+					debug(" =         0x%08x", (int)value);
 				else
-					debug(" = 0x%016" PRIx64, (uint64_t)
-					    cpu->cd.mips.coproc[
-					    coprocnr]->reg[i]);
+					debug(" = 0x%016" PRIx64, value);
 			}
 
 			if ((i & nm1) == nm1)
@@ -1649,13 +1729,40 @@ void mips_cpu_register_dump(struct cpu *cpu, int gprs, int coprocs)
 		}
 	}
 
-	if (cpu->cd.mips.rmw) {
+	if (cpu->reservation.active) {
 		printf("cpu%i: Read-Modify-Write in progress, address "
-		    "0x%016" PRIx64"\n", cpu->cpu_id, cpu->cd.mips.rmw_addr);
+		    "0x%016" PRIx64"\n", cpu->cpu_id, cpu->reservation.vaddr);
 	}
 }
 
 
+/*
+ *  mips_cpu_interrupt_check():
+ *
+ *  Returns true if an interrupt is both pending (in the CAUSE register) and
+ *  enabled (in the STATUS register).
+ */
+bool mips_cpu_interrupt_check(struct cpu *cpu)
+{
+	uint32_t status = cpu->cd.mips.coproc[0]->reg[COP0_STATUS];
+	uint32_t cause = cpu->cd.mips.coproc[0]->reg[COP0_CAUSE];
+
+	/*  NOTE: STATUS_IE happens to match the enable bit also
+	    on R2000/R3000, so this is ok.  */
+	if (cpu->cd.mips.cpu_type.exc_model != EXC3K) {
+		if (status & (STATUS_EXL | STATUS_ERL))
+			return false;
+	}
+
+	/*  Special case for R5900/C790/TX79:  */
+	if (cpu->cd.mips.cpu_type.rev == MIPS_R5900 &&
+	    !(status & R5900_STATUS_EIE))
+		return false;
+
+	return (status & STATUS_IE) && (status & cause & STATUS_IM_MASK);
+}
+
+
 /*
  *  mips_cpu_interrupt_assert(), mips_cpu_interrupt_deassert():
  *
@@ -1666,11 +1773,13 @@ void mips_cpu_interrupt_assert(struct interrupt *interrupt)
 {
 	struct cpu *cpu = (struct cpu *) interrupt->extra;
 	cpu->cd.mips.coproc[0]->reg[COP0_CAUSE] |= interrupt->line;
+	cpu_interrupt_update(cpu);
 }
 void mips_cpu_interrupt_deassert(struct interrupt *interrupt)
 {
 	struct cpu *cpu = (struct cpu *) interrupt->extra;
 	cpu->cd.mips.coproc[0]->reg[COP0_CAUSE] &= ~interrupt->line;
+	cpu_interrupt_update(cpu);
 }
 
 
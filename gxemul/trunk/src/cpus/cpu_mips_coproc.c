@@ -413,19 +413,82 @@ struct mips_coproc *mips_coproc_new(struct cpu *cpu, int coproc_nr)
 }
 
 
+/*
+ *  mips_count_read(), mips_count_write():
+ *
+ *  The COUNT register is derived from the number of executed instructions:
+ *  it was count_base when cpu->ninstrs was count_base_ninstrs. (Note: The
+ *  value in coproc[0]->reg[COP0_COUNT] is only updated on reads.)
+ */
+uint32_t mips_count_read(struct cpu *cpu)
+{
+	uint32_t count = cpu->cd.mips.count_base + (uint32_t)
+	    (cpu_ninstrs_now(cpu) - cpu->cd.mips.count_base_ninstrs);
+
+	cpu->cd.mips.coproc[0]->reg[COP0_COUNT] = (int32_t) count;
+	return count;
+}
+void mips_count_write(struct cpu *cpu, uint32_t value)
+{
+	cpu->cd.mips.count_base = value;
+	cpu->cd.mips.count_base_ninstrs = cpu_ninstrs_now(cpu);
+	cpu->cd.mips.coproc[0]->reg[COP0_COUNT] = (int32_t) value;
+}
+
+
+/*
+ *  mips_timer_schedule():
+ *
+ *  Schedules the timer interrupt at the instruction count where COUNT will
+ *  reach COMPARE. (Not on R2000/R3000, not before the guest has written
+ *  to COMPARE, and not when emulating a specific clock rate; then the
+ *  host's timer is used, see mips_timer_tick().)
+ */
+static void mips_timer_schedule(struct cpu *cpu)
+{
+	int64_t now = cpu_ninstrs_now(cpu);
+	uint32_t count = cpu->cd.mips.count_base + (uint32_t)
+	    (now - cpu->cd.mips.count_base_ninstrs);
+	uint32_t diff = cpu->cd.mips.coproc[0]->reg[COP0_COMPARE] - count;
+
+	if (cpu->cd.mips.cpu_type.exc_model == EXC3K ||
+	    !cpu->cd.mips.compare_register_set ||
+	    cpu->machine->emulated_hz > 0) {
+		cpu_timer_schedule(cpu, INT64_MAX);
+		return;
+	}
+
+	/*  COMPARE == COUNT right now means a full lap of the counter:  */
+	cpu_timer_schedule(cpu, now + (diff == 0? (int64_t)1 << 32 : diff));
+}
+
+
+/*
+ *  mips_timer_event():
+ *
+ *  Called at the end of a dyntrans slice, when COUNT has reached COMPARE.
+ */
+void mips_timer_event(struct cpu *cpu)
+{
+	cpu->timer_event_ninstrs += (int64_t)1 << 32;
+	INTERRUPT_ASSERT(cpu->cd.mips.irq_compare);
+}
+
+
 /*
  *  mips_timer_tick():
  */
 static void mips_timer_tick(struct timer *timer, void *extra)
 {
 	struct cpu *cpu = (struct cpu *) extra;
+	uint32_t count = cpu->cd.mips.count_base + (uint32_t)
+	    (cpu->ninstrs - cpu->cd.mips.count_base_ninstrs);
 
 	cpu->cd.mips.compare_interrupts_pending ++;
 
-	if ((int32_t) (cpu->cd.mips.coproc[0]->reg[COP0_COUNT] -
-	    cpu->cd.mips.coproc[0]->reg[COP0_COMPARE]) < 0) {
-		cpu->cd.mips.coproc[0]->reg[COP0_COUNT] =
-		    cpu->cd.mips.coproc[0]->reg[COP0_COMPARE];
+	if ((int32_t) (count - cpu->cd.mips.coproc[0]->reg[COP0_COMPARE]) < 0) {
+		cpu->cd.mips.count_base = cpu->cd.mips.coproc[0]->reg[COP0_COMPARE];
+		cpu->cd.mips.count_base_ninstrs = cpu->ninstrs;
 	}
 }
 
@@ -501,6 +564,180 @@ void mips_coproc_tlb_set_entry(struct cpu *cpu, int entrynr, int size,
 }
 
 
+/*
+ *  asid_cache_vmask():
+ *
+ *  Returns the mask of virtual address bits which matter when comparing
+ *  saved translations with each other.
+ */
+static uint64_t asid_cache_vmask(struct cpu *cpu)
+{
+	return cpu->is_32bit? 0xffffffffULL : cpu->vaddr_mask;
+}
+
+
+/*
+ *  asid_cache_find():
+ *
+ *  Returns the saved translation set for a specific ASID, or NULL if there
+ *  is none. If allocate is true, then an empty set is returned; either the
+ *  ASID's old set (emptied), or the least recently used set.
+ */
+static struct mips_asid_cache_set *asid_cache_find(struct cpu *cpu,
+	unsigned int asid, bool allocate)
+{
+	struct mips_asid_cache_set *set, *victim = NULL;
+	int i;
+
+	for (i = 0; i < MIPS_N_ASID_CACHE_SETS; i++) {
+		set = &cpu->cd.mips.asid_cache[i];
+		if (set->in_use && set->asid == asid) {
+			victim = set;
+			break;
+		}
+		if (victim == NULL || !set->in_use ||
+		    (victim->in_use && set->last_used < victim->last_used))
+			victim = set;
+	}
+
+	if (!allocate)
+		return victim->in_use && victim->asid == asid? victim : NULL;
+
+	victim->in_use = true;
+	victim->asid = asid;
+	victim->n_entries = 0;
+	victim->last_used = ++ cpu->cd.mips.asid_cache_clock;
+	return victim;
+}
+
+
+/*
+ *  asid_cache_save():
+ *
+ *  Remember the current virtual -> physical -> host translation(s) for
+ *  vaddr_page in a saved set, if the page is present in the VPH tables.
+ *  (On 64-bit emulation, several entries may differ only in the bits which
+ *  are not part of vaddr_mask.)
+ */
+static void asid_cache_save(struct cpu *cpu, struct mips_asid_cache_set *set,
+	uint64_t vaddr_page)
+{
+	uint64_t vmask = asid_cache_vmask(cpu);
+	int r;
+
+	for (r = 0; r < MIPS_MAX_VPH_TLB_ENTRIES; r++) {
+		struct mips_vpg_tlb_entry *vph = &cpu->cd.mips.vph_tlb_entry[r];
+		struct mips_asid_cache_entry *e;
+
+		if (!vph->valid || (vph->vaddr_page & vmask) !=
+		    (vaddr_page & vmask))
+			continue;
+
+		if (set->n_entries >= MIPS_ASID_CACHE_ENTRIES)
+			return;
+
+		e = &set->entry[set->n_entries ++];
+		e->vaddr_page = vph->vaddr_page;
+		e->paddr_page = vph->paddr_page;
+		e->host_page = vph->host_page;
+	}
+}
+
+
+/*
+ *  asid_cache_restore():
+ *
+ *  If there is a saved set for the ASID, then re-insert its translations
+ *  into the VPH tables. The set is freed afterwards; the translations are
+ *  live again and will be saved anew when the ASID is switched away from.
+ */
+static void asid_cache_restore(struct cpu *cpu, unsigned int asid)
+{
+	struct mips_asid_cache_set *set = asid_cache_find(cpu, asid, false);
+	int i;
+
+	if (set == NULL)
+		return;
+
+	for (i = 0; i < set->n_entries; i++)
+		cpu->update_translation_table(cpu, set->entry[i].vaddr_page,
+		    set->entry[i].host_page, 0, set->entry[i].paddr_page);
+
+	set->in_use = false;
+	set->n_entries = 0;
+}
+
+
+/*
+ *  asid_cache_purge_range():
+ *
+ *  Remove saved translations in the virtual address range [vaddr, vaddr+len)
+ *  for a specific ASID, or for all ASIDs if global is true. Called when a
+ *  guest TLB entry is overwritten, since the translations derived from it
+ *  are no longer valid.
+ */
+static void asid_cache_purge_range(struct cpu *cpu, unsigned int asid,
+	bool global, uint64_t vaddr, uint64_t len)
+{
+	uint64_t vmask = asid_cache_vmask(cpu);
+	int i, j;
+
+	for (i = 0; i < MIPS_N_ASID_CACHE_SETS; i++) {
+		struct mips_asid_cache_set *set = &cpu->cd.mips.asid_cache[i];
+
+		if (!set->in_use || (!global && set->asid != asid))
+			continue;
+
+		for (j = 0; j < set->n_entries; ) {
+			uint64_t ofs = (set->entry[j].vaddr_page - vaddr) & vmask;
+			if (ofs < len)
+				set->entry[j] = set->entry[-- set->n_entries];
+			else
+				j ++;
+		}
+	}
+}
+
+
+/*
+ *  mips_asid_cache_invalidate():
+ *
+ *  Called from the generic dyntrans invalidation code. Saved translations
+ *  must not outlive invalidations of physical pages, or of everything.
+ *  (Downgrades to read-only don't matter, since saved translations are
+ *  always re-inserted as read-only anyway.)
+ */
+void mips_asid_cache_invalidate(struct cpu *cpu, uint64_t paddr, int flags)
+{
+	int i, j;
+
+	if (flags & (INVALIDATE_VADDR | JUST_MARK_AS_NON_WRITABLE))
+		return;
+
+	paddr &= ~0xfffULL;
+
+	for (i = 0; i < MIPS_N_ASID_CACHE_SETS; i++) {
+		struct mips_asid_cache_set *set = &cpu->cd.mips.asid_cache[i];
+
+		if (!set->in_use)
+			continue;
+
+		if (flags & INVALIDATE_ALL) {
+			set->in_use = false;
+			set->n_entries = 0;
+			continue;
+		}
+
+		for (j = 0; j < set->n_entries; ) {
+			if (set->entry[j].paddr_page == paddr)
+				set->entry[j] = set->entry[-- set->n_entries];
+			else
+				j ++;
+		}
+	}
+}
+
+
 /*
  *  invalidate_asid():
  *
@@ -508,9 +745,13 @@ void mips_coproc_tlb_set_entry(struct cpu *cpu, int entrynr, int size,
  *  valid, and is not global (i.e. the ASID matters), then its virtual address
  *  translation is invalidated.
  *
+ *  If save is non-NULL, then the translations are remembered in that saved
+ *  set before they are invalidated.
+ *
  *  Note: In the R3000 case, the asid argument is shifted 6 bits.
  */
-static void invalidate_asid(struct cpu *cpu, unsigned int asid)
+static void invalidate_asid(struct cpu *cpu, unsigned int asid,
+	struct mips_asid_cache_set *save)
 {
 	struct mips_coproc *cp = cpu->cd.mips.coproc[0];
 	unsigned int i, ntlbs = cp->nr_of_tlbs;
@@ -521,9 +762,12 @@ static void invalidate_asid(struct cpu *cpu, unsigned int asid)
 			if ((tlb[i].hi & R2K3K_ENTRYHI_ASID_MASK) == asid
 			    && (tlb[i].lo0 & R2K3K_ENTRYLO_V)
 			    && !(tlb[i].lo0 & R2K3K_ENTRYLO_G)) {
+				uint64_t vaddr = (int32_t)
+				    (tlb[i].hi & R2K3K_ENTRYHI_VPN_MASK);
+				if (save != NULL)
+					asid_cache_save(cpu, save, vaddr);
 				cpu->invalidate_translation_caches(cpu,
-				    tlb[i].hi & R2K3K_ENTRYHI_VPN_MASK,
-				    INVALIDATE_VADDR);
+				    vaddr, INVALIDATE_VADDR);
 			}
 	} else {
 		for (i = 0; i < ntlbs; i++) {
@@ -559,12 +803,18 @@ static void invalidate_asid(struct cpu *cpu, unsigned int asid)
 			// printf("pagesize = %016llx mask = %016llx\n", pagesize, mask);
 			
 			if (cp->tlbs[i].lo0 & ENTRYLO_V)
-				for (uint64_t ofs = 0; ofs < pagesize; ofs += 0x1000)
+				for (uint64_t ofs = 0; ofs < pagesize; ofs += 0x1000) {
+					if (save != NULL)
+						asid_cache_save(cpu, save, oldvaddr + ofs);
 					cpu->invalidate_translation_caches(cpu, oldvaddr + ofs, INVALIDATE_VADDR);
+				}
 			
 			if (cp->tlbs[i].lo1 & ENTRYLO_V)
-				for (uint64_t ofs = 0; ofs < pagesize; ofs += 0x1000)
+				for (uint64_t ofs = 0; ofs < pagesize; ofs += 0x1000) {
+					if (save != NULL)
+						asid_cache_save(cpu, save, oldvaddr + ofs + pagesize);
 					cpu->invalidate_translation_caches(cpu, oldvaddr + ofs + pagesize, INVALIDATE_VADDR);
+				}
 		}
 	}
 }
@@ -589,9 +839,7 @@ void coproc_register_read(struct cpu *cpu,
 	if (cp->coproc_nr==0 && reg_nr==COP0_WIRED)	unimpl = 0;
 	if (cp->coproc_nr==0 && reg_nr==COP0_BADVADDR)	unimpl = 0;
 	if (cp->coproc_nr==0 && reg_nr==COP0_COUNT) {
-		/*  TODO: Increase count in a more meaningful way!  */
-		cp->reg[COP0_COUNT] = (int32_t) (cp->reg[COP0_COUNT] + 1);
-		cpu->cd.mips.count_register_read_count ++;
+		mips_count_read(cpu);
 		unimpl = 0;
 	}
 	if (cp->coproc_nr==0 && reg_nr==COP0_ENTRYHI)	unimpl = 0;
@@ -840,8 +1088,30 @@ void coproc_register_write(struct cpu *cpu,
 				break;
 			}
 
-			if (inval)
-				invalidate_asid(cpu, old_asid);
+			if (inval) {
+				unsigned int new_asid = tmp &
+				    (cpu->cd.mips.cpu_type.mmu_model == MMU3K ?
+				    R2K3K_ENTRYHI_ASID_MASK : ENTRYHI_ASID);
+
+				/*
+				 *  Save the translations of the ASID which is
+				 *  currently in the VPH tables. (EntryHi may
+				 *  have been changed by tlbr since then, in
+				 *  which case the VPH ASID's translations are
+				 *  just invalidated too, without saving.)
+				 */
+				if (old_asid == cpu->cd.mips.vph_asid)
+					invalidate_asid(cpu, old_asid,
+					    asid_cache_find(cpu, old_asid, true));
+				else {
+					invalidate_asid(cpu, old_asid, NULL);
+					invalidate_asid(cpu,
+					    cpu->cd.mips.vph_asid, NULL);
+				}
+
+				asid_cache_restore(cpu, new_asid);
+				cpu->cd.mips.vph_asid = new_asid;
+			}
 
 			unimpl = 0;
 			if (cpu->cd.mips.cpu_type.mmu_model == MMU3K &&
@@ -997,6 +1267,12 @@ void coproc_register_write(struct cpu *cpu,
 
 	cp->reg[reg_nr] = tmp;
 
+	if (cp->coproc_nr == 0 && reg_nr == COP0_COUNT)
+		mips_count_write(cpu, tmp);
+	if (cp->coproc_nr == 0 &&
+	    (reg_nr == COP0_COUNT || reg_nr == COP0_COMPARE))
+		mips_timer_schedule(cpu);
+
 	if (!flag64)
 		cp->reg[reg_nr] = (int64_t)(int32_t)cp->reg[reg_nr];
 }
@@ -1140,7 +1416,7 @@ static int fpu_op(struct cpu *cpu, struct mips_coproc *cp, int op, int fmt,
 		break;
 	case FPU_OP_DIV:
 		nan = float_value[0].nan || float_value[1].nan;
-		if (fabs(float_value[1].f) > 0.00000000001)
+		if (fabs(float_value[1].f) > MIPS_FPU_DIV_ZERO_LIMIT)
 			nf = float_value[0].f / float_value[1].f;
 		else {
 			fatal("DIV by zero !!!! TODO\n");
@@ -1704,6 +1980,10 @@ void coproc_tlbwri(struct cpu *cpu, int randomflag)
 		oldvaddr = cp->tlbs[index].hi & R2K3K_ENTRYHI_VPN_MASK;
 		oldvaddr = (int32_t) oldvaddr;
 
+		asid_cache_purge_range(cpu,
+		    cp->tlbs[index].hi & R2K3K_ENTRYHI_ASID_MASK,
+		    cp->tlbs[index].lo0 & R2K3K_ENTRYLO_G, oldvaddr, 0x1000);
+
 		if (cp->tlbs[index].lo0 & R2K3K_ENTRYLO_V &&
 		    (cp->tlbs[index].lo0 & R2K3K_ENTRYLO_G ||
 		    (cp->tlbs[index].hi & R2K3K_ENTRYHI_ASID_MASK) ==
@@ -1750,6 +2030,12 @@ void coproc_tlbwri(struct cpu *cpu, int randomflag)
 			
 			oldvaddr &= ~dpmask;
 
+			asid_cache_purge_range(cpu,
+			    cp->tlbs[index].hi & ENTRYHI_ASID,
+			    (cp->tlbs[index].hi & TLB_G) ||
+			    (cp->tlbs[index].lo0 & cp->tlbs[index].lo1 & ENTRYLO_G),
+			    oldvaddr, pagesize * 2);
+
 			// printf("pagesize = %016llx mask = %016llx\n", pagesize, mask);
 			
 			if (cp->tlbs[index].lo0 & ENTRYLO_V)
@@ -1980,7 +2266,8 @@ void coproc_eret(struct cpu *cpu)
 		cpu->cd.mips.coproc[0]->reg[COP0_STATUS] &= ~STATUS_EXL;
 	}
 
-	cpu->cd.mips.rmw = 0;	/*  the "LL bit"  */
+	cpu_reservation_clear(cpu);	/*  the "LL bit"  */
+	cpu_interrupt_update(cpu);
 }
 
 
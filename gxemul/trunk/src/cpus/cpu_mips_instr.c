@@ -1140,8 +1140,8 @@ X(cache)
 {
 	/*  TODO: Implement cache operations.  */
 
-	/*  Make sure the rmw bit is cleared:  */
-	cpu->cd.mips.rmw = 0;
+	/*  Make sure the LL bit is cleared:  */
+	cpu_reservation_clear(cpu);
 }
 
 
@@ -1888,27 +1888,17 @@ X(mtc0)
 	coproc_register_write(cpu, cpu->cd.mips.coproc[0], rd, &tmp, 0, select);
 
 	/*
-	 *  Interrupts enabled, and any interrupt pending? (Note/TODO: This
-	 *  code is duplicated in cpu_dyntrans.c. Fix this?)
+	 *  Interrupts enabled, and any interrupt pending? Then take the
+	 *  interrupt right away, or (in a delay slot, or for software
+	 *  interrupts in the CAUSE register) as soon as the dyntrans loop
+	 *  has been left.
 	 */
-	if (rd == COP0_STATUS && !cpu->delay_slot) {
-		uint32_t status = cpu->cd.mips.coproc[0]->reg[COP0_STATUS];
-		uint32_t cause = cpu->cd.mips.coproc[0]->reg[COP0_CAUSE];
-		/*  NOTE: STATUS_IE happens to match the enable bit also
-		    on R2000/R3000, so this is ok.  */
-		if (cpu->cd.mips.cpu_type.exc_model != EXC3K) {
-			if (status & (STATUS_EXL | STATUS_ERL))
-				status &= ~STATUS_IE;
-		}
-		/*  Ugly R5900 special case:  (TODO: move this?)  */
-		if (cpu->cd.mips.cpu_type.rev == MIPS_R5900 &&
-		    !(status & R5900_STATUS_EIE))
-			status &= ~STATUS_IE;
-		if (status & STATUS_IE && (status & cause & STATUS_IM_MASK)) {
-			cpu->pc += sizeof(uint32_t);
-			mips_cpu_exception(cpu, EXCEPTION_INT, 0, 0,0,0,0,0);
-		}
-	}
+	if (rd == COP0_STATUS && !cpu->delay_slot &&
+	    mips_cpu_interrupt_check(cpu)) {
+		cpu->pc += sizeof(uint32_t);
+		mips_cpu_exception(cpu, EXCEPTION_INT, 0, 0,0,0,0,0);
+	} else if (rd == COP0_STATUS || rd == COP0_CAUSE)
+		cpu_interrupt_update(cpu);
 }
 X(dmfc0)
 {
@@ -2000,6 +1990,134 @@ X(cop1_slow)
 }
 
 
+#ifndef	MIPS_FPU_FAST_INCLUDED
+#define	MIPS_FPU_FAST_INCLUDED
+/*
+ *  Host-native floating point fast path for add, sub, mul, and div:
+ *
+ *  The result must be bit for bit what fpu_op() in cpu_mips_coproc.c would
+ *  have stored, so the same instruction gives the same result whichever
+ *  path it takes. fpu_op() computes in double precision on the exact
+ *  values of the operands, and then stores the result using
+ *  ieee_store_float_value(), which truncates (rather than rounds) singles.
+ *  This is done here too, but only when no conversion other than the plain
+ *  bit copy is involved: both operands and the double result must be normal
+ *  numbers or zeroes, and a single result must be within range.
+ *
+ *  Everything else (NaNs, infinities, denormals, divisors which fpu_op()
+ *  treats as zero, FCSR rounding modes or exception enables, etc.) is left
+ *  to the legacy coproc_function() code.
+ *
+ *  Register pairing for double precision values when the FR bit is clear,
+ *  and sign-extension of 32-bit values, work the same way as in
+ *  fpu_op() and fpu_store_float_value() in cpu_mips_coproc.c.
+ *
+ *  Returns 1 if the instruction was executed, 0 if the slow path should be
+ *  used instead.
+ */
+#define	MIPS_FPU_ADD	0
+#define	MIPS_FPU_SUB	1
+#define	MIPS_FPU_MUL	2
+#define	MIPS_FPU_DIV	3
+static inline int mips_fpu_fast_op(struct cpu *cpu, uint32_t iword,
+	int op, int double_precision)
+{
+	struct mips_coproc *cp = cpu->cd.mips.coproc[1];
+	int ft = (iword >> 16) & 31, fs = (iword >> 11) & 31;
+	int fd = (iword >> 6) & 31;
+	int fr = cpu->cd.mips.coproc[0]->reg[COP0_STATUS] & STATUS_FR? 1 : 0;
+	uint64_t a, b, r;
+	double da, db, dr;
+
+	if (cp->fcr[MIPS_FPU_FCSR] & (MIPS_FCSR_RM_MASK |
+	    MIPS_FCSR_ENABLES_MASK))
+		return 0;
+
+	if (double_precision) {
+		a = cp->reg[fs];
+		b = cp->reg[ft];
+		if (!fr) {
+			a = (a & 0xffffffffULL) + (cp->reg[(fs + 1) & 31] << 32);
+			b = (b & 0xffffffffULL) + (cp->reg[(ft + 1) & 31] << 32);
+		}
+
+		if (!ieee_d_is_normal_or_zero(a) ||
+		    !ieee_d_is_normal_or_zero(b))
+			return 0;
+
+		da = ieee_d_from_bits(a);
+		db = ieee_d_from_bits(b);
+	} else {
+		a = (uint32_t) cp->reg[fs];
+		b = (uint32_t) cp->reg[ft];
+
+		if (!ieee_s_is_normal_or_zero(a) ||
+		    !ieee_s_is_normal_or_zero(b))
+			return 0;
+
+		da = ieee_s_from_bits(a);
+		db = ieee_s_from_bits(b);
+	}
+
+	switch (op) {
+	case MIPS_FPU_ADD: dr = da + db; break;
+	case MIPS_FPU_SUB: dr = da - db; break;
+	case MIPS_FPU_MUL: dr = da * db; break;
+	default:	if (!(fabs(db) > MIPS_FPU_DIV_ZERO_LIMIT))
+				return 0;
+			dr = da / db;
+	}
+
+	r = ieee_d_to_bits(dr);
+	if (!ieee_d_is_normal_or_zero(r))
+		return 0;
+
+	if (double_precision) {
+		if (fr)
+			cp->reg[fd] = r;
+		else {
+			cp->reg[fd] = (int64_t)(int32_t)r;
+			cp->reg[(fd + 1) & 31] = (int64_t)(int32_t)(r >> 32);
+		}
+	} else {
+		uint32_t rs;
+
+		if (!ieee_s_truncate_d(r, &rs))
+			return 0;
+
+		cp->reg[fd] = (int64_t)(int32_t)rs;
+	}
+
+	return 1;
+}
+#endif
+
+
+/*
+ *  add_s, add_d, sub_s, sub_d, mul_s, mul_d, div_s, div_d:
+ *
+ *  arg[0] = the low 26 bits of the instruction word (for the slow path)
+ */
+#define	X_FPU_FAST(name, op, double_precision)				\
+	X(name)								\
+	{								\
+		COPROC_AVAILABILITY_CHECK(1);				\
+		if (!mips_fpu_fast_op(cpu, ic->arg[0],			\
+		    op, double_precision))				\
+			coproc_function(cpu, cpu->cd.mips.coproc[1],	\
+			    1, ic->arg[0], 0, 1);			\
+	}
+X_FPU_FAST(add_s, MIPS_FPU_ADD, 0)
+X_FPU_FAST(add_d, MIPS_FPU_ADD, 1)
+X_FPU_FAST(sub_s, MIPS_FPU_SUB, 0)
+X_FPU_FAST(sub_d, MIPS_FPU_SUB, 1)
+X_FPU_FAST(mul_s, MIPS_FPU_MUL, 0)
+X_FPU_FAST(mul_d, MIPS_FPU_MUL, 1)
+X_FPU_FAST(div_s, MIPS_FPU_DIV, 0)
+X_FPU_FAST(div_d, MIPS_FPU_DIV, 1)
+#undef X_FPU_FAST
+
+
 /*
  *  syscall, break:  Synchronize the PC and cause an exception.
  */
@@ -2072,6 +2190,124 @@ X(promemul)
 }
 
 
+/*
+ *  native_function:  Host-native replacement of a well-known guest function.
+ *
+ *  arg[0] = MIPS_NATIVE_* function number
+ *
+ *  The arguments are taken from a0..a2, any result is returned in v0, and
+ *  execution continues at ra. If the memory involved is not all directly
+ *  reachable as host memory, or if a copy would overlap downwards, then the
+ *  function's first instruction is translated and executed as usual instead,
+ *  i.e. the guest's own implementation runs (and takes care of exceptions
+ *  and device accesses).
+ *
+ *  NOTE: This assumes that the first instruction of the function is only
+ *  reached by calls, not by branches within the function itself, which is
+ *  the case for the usual libc/libkern implementations.
+ */
+X(native_function)
+{
+	MODE_uint_t a0 = cpu->cd.mips.gpr[MIPS_GPR_A0];
+	MODE_uint_t a1 = cpu->cd.mips.gpr[MIPS_GPR_A1];
+	MODE_uint_t a2 = cpu->cd.mips.gpr[MIPS_GPR_A2];
+	MODE_uint_t dst = 0, src = 0, len = 0, ofs, v0 = 0;
+	unsigned char *page, *p;
+	int func = ic->arg[0], fill = -1;
+	size_t done;
+
+	switch (func) {
+	case MIPS_NATIVE_BZERO:
+		dst = a0; len = a1; fill = 0;
+		break;
+	case MIPS_NATIVE_MEMSET:
+		dst = v0 = a0; len = a2; fill = a1 & 0xff;
+		break;
+	case MIPS_NATIVE_BCOPY:
+		src = a0; dst = a1; len = a2;
+		break;
+	case MIPS_NATIVE_MEMCPY:
+		dst = v0 = a0; src = a1; len = a2;
+		break;
+	case MIPS_NATIVE_STRLEN:
+		for (;;) {
+			page = DYNTRANS_HOST_PAGE(cpu, a0 + len, 0);
+			if (page == NULL)
+				goto fallback;
+			ofs = (a0 + len) & 0xfff;
+			p = (unsigned char *) memchr(page + ofs, 0,
+			    0x1000 - ofs);
+			if (p != NULL) {
+				len += p - (page + ofs);
+				break;
+			}
+			len += 0x1000 - ofs;
+		}
+		v0 = len;
+		break;
+	}
+
+	if (func != MIPS_NATIVE_STRLEN) {
+		/*  Only lengths which the guest could possibly have mapped:  */
+		if (len > 0x10000000 || (fill < 0 && dst > src &&
+		    dst < src + len))
+			goto fallback;
+
+		/*  All or nothing:  */
+		for (ofs = 0; ofs < len; ofs += 0x1000 - ((dst + ofs) & 0xfff))
+			if (DYNTRANS_HOST_PAGE(cpu, dst + ofs, 1) == NULL)
+				goto fallback;
+		if (fill < 0)
+			for (ofs = 0; ofs < len;
+			    ofs += 0x1000 - ((src + ofs) & 0xfff))
+				if (DYNTRANS_HOST_PAGE(cpu, src + ofs, 0)
+				    == NULL)
+					goto fallback;
+
+		for (ofs = 0; ofs < len; ofs += done) {
+			if (fill >= 0)
+				done = DYNTRANS_BULK_MEMSET(cpu, dst + ofs,
+				    fill, len - ofs);
+			else
+				done = DYNTRANS_BULK_MEMCPY(cpu, dst + ofs,
+				    src + ofs, len - ofs);
+			if (done == 0)
+				break;
+		}
+	}
+
+	if (func != MIPS_NATIVE_BZERO && func != MIPS_NATIVE_BCOPY)
+		cpu->cd.mips.gpr[MIPS_GPR_V0] = (MODE_int_t) v0;
+
+	/*  Roughly what a word-at-a-time guest loop would have counted:  */
+	cpu->n_translated_instrs += len / 4;
+
+	cpu->pc = (MODE_int_t)cpu->cd.mips.gpr[MIPS_GPR_RA];
+	cpu->delay_slot = NOT_DELAYED;
+
+	if (cpu->machine->show_trace_tree)
+		cpu_functioncall_trace_return(cpu);
+
+	quick_pc_to_pointers(cpu);
+	return;
+
+fallback:
+	/*
+	 *  Translate and run the original first instruction. Unless that
+	 *  caused the translation to be invalidated, the native function is
+	 *  put back in place for the next call.
+	 */
+	cpu->cd.mips.native_fallback = 1;
+	instr(to_be_translated)(cpu, ic);
+	cpu->cd.mips.native_fallback = 0;
+
+	if (ic->f != instr(to_be_translated)) {
+		ic->f = instr(native_function);
+		ic->arg[0] = func;
+	}
+}
+
+
 /*
  *  tlbw: TLB write indexed and random
  *
@@ -2128,6 +2364,7 @@ X(ei_or_di)
 		cpu->cd.mips.coproc[0]->reg[COP0_STATUS] |= STATUS_IE;
 	else
 		cpu->cd.mips.coproc[0]->reg[COP0_STATUS] &= ~STATUS_IE;
+	cpu_interrupt_update(cpu);
 }
 
 
@@ -2143,6 +2380,7 @@ X(rfe)
 	cpu->cd.mips.coproc[0]->reg[COP0_STATUS] =
 	    (cpu->cd.mips.coproc[0]->reg[COP0_STATUS] & ~0x3f) |
 	    ((cpu->cd.mips.coproc[0]->reg[COP0_STATUS] & 0x3c) >> 2);
+	cpu_interrupt_update(cpu);
 
 	/*
 	 *  Note: no pc to pointers conversion is necessary here. Usually the
@@ -2171,7 +2409,8 @@ X(eret)
 
 	quick_pc_to_pointers(cpu);
 
-	cpu->cd.mips.rmw = 0;   /*  the "LL bit"  */
+	cpu_reservation_clear(cpu);	/*  the "LL bit"  */
+	cpu_interrupt_update(cpu);
 }
 
 
@@ -2209,19 +2448,7 @@ X(idle)
 	 *  If there is an interrupt, then just return. Otherwise
 	 *  re-run the wait instruction (after a delay).
 	 */
-	uint32_t status = cpu->cd.mips.coproc[0]->reg[COP0_STATUS];
-	uint32_t cause = cpu->cd.mips.coproc[0]->reg[COP0_CAUSE];
-
-	if (cpu->cd.mips.cpu_type.exc_model != EXC3K) {
-		if (status & (STATUS_EXL | STATUS_ERL))
-			status &= ~STATUS_IE;
-	}
-
-	/*  Ugly R5900 special case:  (TODO: move this?)  */
-	if (cpu->cd.mips.cpu_type.rev == MIPS_R5900 &&
-	    !(status & R5900_STATUS_EIE))
-		status &= ~STATUS_IE;
-	if (status & STATUS_IE && (status & cause & STATUS_IM_MASK))
+	if (mips_cpu_interrupt_check(cpu))
 		return;
 
 	SYNCH_PC
@@ -2266,7 +2493,7 @@ X(rdhwr_cpunum)
  */
 X(rdhwr_cc)
 {
-	reg(ic->arg[0]) = cpu->cd.mips.coproc[0]->reg[COP0_COUNT];
+	reg(ic->arg[0]) = (int32_t) mips_count_read(cpu);
 }
 
 
@@ -2290,6 +2517,7 @@ X(ll)
 {
 	MODE_int_t addr = reg(ic->arg[1]) + (int32_t)ic->arg[2];
 	uint8_t word[sizeof(uint32_t)];
+	unsigned char *page;
 
 	/*  Synch. PC and load using slow memory_rw():  */
 	SYNCH_PC
@@ -2308,9 +2536,10 @@ X(ll)
 
 	BREAK_DYNTRANS_CHECK(cpu);
 
-	cpu->cd.mips.rmw = 1;
-	cpu->cd.mips.rmw_addr = addr;
-	cpu->cd.mips.rmw_len = sizeof(word);
+	page = DYNTRANS_HOST_PAGE(cpu, addr, 0);
+	cpu_reservation_set(cpu, addr, word, sizeof(word),
+	    cpu->cd.mips.cache_linesize[CACHE_DATA],
+	    page == NULL? NULL : page + (addr & 0xfff));
 	if (cpu->cd.mips.cpu_type.exc_model != MMU10K)
 		cpu->cd.mips.coproc[0]->reg[COP0_LLADDR] =
 		    (addr >> 4) & 0xffffffffULL;
@@ -2326,6 +2555,7 @@ X(lld)
 {
 	MODE_int_t addr = reg(ic->arg[1]) + (int32_t)ic->arg[2];
 	uint8_t word[sizeof(uint64_t)];
+	unsigned char *page;
 
 	/*  Synch. PC and load using slow memory_rw():  */
 	SYNCH_PC
@@ -2344,9 +2574,10 @@ X(lld)
 
 	BREAK_DYNTRANS_CHECK(cpu);
 
-	cpu->cd.mips.rmw = 1;
-	cpu->cd.mips.rmw_addr = addr;
-	cpu->cd.mips.rmw_len = sizeof(word);
+	page = DYNTRANS_HOST_PAGE(cpu, addr, 0);
+	cpu_reservation_set(cpu, addr, word, sizeof(word),
+	    cpu->cd.mips.cache_linesize[CACHE_DATA],
+	    page == NULL? NULL : page + (addr & 0xfff));
 	if (cpu->cd.mips.cpu_type.exc_model != MMU10K)
 		cpu->cd.mips.coproc[0]->reg[COP0_LLADDR] =
 		    (addr >> 4) & 0xffffffffULL;
@@ -2367,6 +2598,8 @@ X(sc)
 	MODE_int_t addr = reg(ic->arg[1]) + (int32_t)ic->arg[2];
 	uint64_t r = reg(ic->arg[0]);
 	uint8_t word[sizeof(uint32_t)];
+	unsigned char *page;
+	int res;
 
 	/*  Synch. PC and store using slow memory_rw():  */
 	SYNCH_PC
@@ -2382,47 +2615,27 @@ X(sc)
 		word[3]=r; word[2]=r>>8; word[1]=r>>16; word[0]=r>>24;
 	}
 
-	/*  If rmw is 0, then the store failed.  (This cache-line was written
-	    to by someone else.)  */
-	if (cpu->cd.mips.rmw == 0 || (MODE_int_t)cpu->cd.mips.rmw_addr != addr
-	    || cpu->cd.mips.rmw_len != sizeof(word)) {
-		reg(ic->arg[0]) = 0;
-		cpu->cd.mips.rmw = 0;
-		return;
-	}
-
-	if (!cpu->memory_rw(cpu, cpu->mem, addr, word,
-	    sizeof(word), MEM_WRITE, CACHE_DATA)) {
-		/*  An exception occurred.  */
-		BREAK_DYNTRANS_CHECK(cpu);
-		return;
-	}
+	/*
+	 *  The store fails if there is no reservation for this address, or
+	 *  if the word has been changed since it was loaded:
+	 */
+	page = DYNTRANS_HOST_PAGE(cpu, addr, 1);
+	res = cpu_reservation_store(cpu, addr, word, sizeof(word),
+	    page == NULL? NULL : page + (addr & 0xfff));
 
 	BREAK_DYNTRANS_CHECK(cpu);
 
-	/*  We succeeded. Let's invalidate everybody else's store to this
-	    cache line:  */
-	for (int i=0; i<cpu->machine->ncpus; i++) {
-		if (cpu->machine->cpus[i]->cd.mips.rmw) {
-			uint64_t yaddr = addr, xaddr = cpu->machine->cpus[i]->
-			    cd.mips.rmw_addr;
-			uint64_t mask = ~(cpu->machine->cpus[i]->
-			    cd.mips.cache_linesize[CACHE_DATA] - 1);
-			xaddr &= mask;
-			yaddr &= mask;
-			if (xaddr == yaddr)
-				cpu->machine->cpus[i]->cd.mips.rmw = 0;
-		}
-	}
-
-	reg(ic->arg[0]) = 1;
-	cpu->cd.mips.rmw = 0;
+	/*  (res < 0 means that an exception occurred.)  */
+	if (res >= 0)
+		reg(ic->arg[0]) = res;
 }
 X(scd)
 {
 	MODE_int_t addr = reg(ic->arg[1]) + (int32_t)ic->arg[2];
 	uint64_t r = reg(ic->arg[0]);
 	uint8_t word[sizeof(uint64_t)];
+	unsigned char *page;
+	int res;
 
 	/*  Synch. PC and store using slow memory_rw():  */
 	SYNCH_PC
@@ -2440,41 +2653,19 @@ X(scd)
 		word[3]=r>>32; word[2]=r>>40; word[1]=r>>48; word[0]=r>>56;
 	}
 
-	/*  If rmw is 0, then the store failed.  (This cache-line was written
-	    to by someone else.)  */
-	if (cpu->cd.mips.rmw == 0 || (MODE_int_t)cpu->cd.mips.rmw_addr != addr
-	    || cpu->cd.mips.rmw_len != sizeof(word)) {
-		reg(ic->arg[0]) = 0;
-		cpu->cd.mips.rmw = 0;
-		return;
-	}
-
-	if (!cpu->memory_rw(cpu, cpu->mem, addr, word,
-	    sizeof(word), MEM_WRITE, CACHE_DATA)) {
-		/*  An exception occurred.  */
-		BREAK_DYNTRANS_CHECK(cpu);
-		return;
-	}
+	/*
+	 *  The store fails if there is no reservation for this address, or
+	 *  if the word has been changed since it was loaded:
+	 */
+	page = DYNTRANS_HOST_PAGE(cpu, addr, 1);
+	res = cpu_reservation_store(cpu, addr, word, sizeof(word),
+	    page == NULL? NULL : page + (addr & 0xfff));
 
 	BREAK_DYNTRANS_CHECK(cpu);
 
-	/*  We succeeded. Let's invalidate everybody else's store to this
-	    cache line:  */
-	for (int i=0; i<cpu->machine->ncpus; i++) {
-		if (cpu->machine->cpus[i]->cd.mips.rmw) {
-			uint64_t yaddr = addr, xaddr = cpu->machine->cpus[i]->
-			    cd.mips.rmw_addr;
-			uint64_t mask = ~(cpu->machine->cpus[i]->
-			    cd.mips.cache_linesize[CACHE_DATA] - 1);
-			xaddr &= mask;
-			yaddr &= mask;
-			if (xaddr == yaddr)
-				cpu->machine->cpus[i]->cd.mips.rmw = 0;
-		}
-	}
-
-	reg(ic->arg[0]) = 1;
-	cpu->cd.mips.rmw = 0;
+	/*  (res < 0 means that an exception occurred.)  */
+	if (res >= 0)
+		reg(ic->arg[0]) = res;
 }
 
 
@@ -2606,6 +2797,7 @@ X(ei_r5900)
 		return;
 
 	cpu->cd.mips.coproc[0]->reg[COP0_STATUS] |= R5900_STATUS_EIE;
+	cpu_interrupt_update(cpu);
 }
 
 
@@ -2613,66 +2805,110 @@ X(ei_r5900)
 
 
 /*
- *  memset_addiu_bne_sw:
+ *  memset_addiu_bne_store:
  *
  *  s:	addiu	rX,rX,4			rX = arg[0] and arg[1]
  *	bne	rY,rX,s  (or rX,rY,s)	rt=arg[1], rs=arg[0]
  *	sw	rZ,-4(rX)		rt=arg[0], rs=arg[1]
+ *
+ *  This is the core of NetBSD/pmax' bzero. The same loop using addiu 1
+ *  and sb (as used for the last few bytes) is also handled.
  */
-X(memset_addiu_bne_sw)
+X(memset_addiu_bne_store)
 {
-	MODE_uint_t rX = reg(ic->arg[0]), rZ = reg(ic[2].arg[0]);
+	MODE_uint_t rX = reg(ic->arg[0]), rZ = reg(ic[2].arg[0]), rY;
 	uint64_t *rYp = (uint64_t *) ic[1].arg[0];
-	MODE_uint_t rY, bytes_to_write;
-	unsigned char *page;
-	int partial = 0;
+	int size = (int32_t) ic->arg[2];
+	size_t len, done = 0;
 
-#ifdef MODE32
-	page = cpu->cd.mips.host_store[rX >> 12];
-#else
-	{
-		const uint32_t mask1 = (1 << DYNTRANS_L1N) - 1;
-		const uint32_t mask2 = (1 << DYNTRANS_L2N) - 1;
-		const uint32_t mask3 = (1 << DYNTRANS_L3N) - 1;
-		uint32_t x1 = (rX >> (64-DYNTRANS_L1N)) & mask1;
-		uint32_t x2 = (rX >> (64-DYNTRANS_L1N-DYNTRANS_L2N)) & mask2;
-		uint32_t x3 = (rX >> (64-DYNTRANS_L1N-DYNTRANS_L2N-DYNTRANS_L3N)) & mask3;
-		struct DYNTRANS_L2_64_TABLE *l2 = cpu->cd.mips.l1_64[x1];
-		struct DYNTRANS_L3_64_TABLE *l3 = l2->l3[x2];
-		page = l3->host_store[x3];
-	}
-#endif
+	if (rYp == (uint64_t *) ic->arg[0])
+		rYp = (uint64_t *) ic[1].arg[1];
 
-	/*  Fallback:  */
-	if (cpu->delay_slot || page == NULL || (rX & 3) != 0 || rZ != 0) {
+	rY = reg(rYp);
+	len = rY - rX;
+
+	/*  Fallback (sw is only ok if all four bytes of rZ are the same):  */
+	if (!cpu->delay_slot && (rX & (size - 1)) == 0 &&
+	    (len & (size - 1)) == 0 && len != 0 &&
+	    (size == 1 || (uint32_t)rZ == (rZ & 0xff) * 0x01010101U))
+		done = DYNTRANS_BULK_MEMSET(cpu, rX, rZ & 0xff, len);
+
+	if (done == 0) {
 		instr(addiu)(cpu, ic);
 		return;
 	}
 
-	if (rYp == (uint64_t *) ic->arg[0])
-		rYp = (uint64_t *) ic[1].arg[1];
+	reg(ic->arg[0]) = rX + done;
 
-	rY = reg(rYp);
+	cpu->n_translated_instrs += done / size * 3 - 1;
+	cpu->cd.mips.next_ic = done < len?
+	    (struct mips_instr_call *) &ic[0] :
+	    (struct mips_instr_call *) &ic[3];
+}
 
-	bytes_to_write = rY - rX;
-	if ((rX & 0xfff) + bytes_to_write > 0x1000) {
-		bytes_to_write = 0x1000 - (rX & 0xfff);
-		partial = 1;
-	}
 
-	/*  printf("rX = %08x\n", (int)rX);
-	    printf("rY = %08x\n", (int)rY);
-	    printf("rZ = %08x\n", (int)rZ);
-	    printf("%i bytes\n", (int)bytes_to_write);  */
+/*
+ *  memcpy_load_addiu_addiu_bne_store:
+ *
+ *  s:	lw	rV,0(rS)
+ *	addiu	rS,rS,4
+ *	addiu	rD,rD,4
+ *	bne	rS,rE,s  (or rE,rS,s)
+ *	sw	rV,-4(rD)
+ *
+ *  This is the core of NetBSD/pmax' bcopy, for word aligned copies. The
+ *  same loop using lbu, addiu 1, and sb (for unaligned copies and the last
+ *  few bytes) is also handled.
+ */
+X(memcpy_load_addiu_addiu_bne_store)
+{
+	MODE_uint_t rS = reg(ic[1].arg[0]), rD = reg(ic[2].arg[0]), rE, last;
+	uint64_t *rEp = (uint64_t *) ic[3].arg[0];
+	int size = (int32_t) ic[1].arg[2];
+	size_t len, done = 0;
+	unsigned char *p;
+
+	if (rEp == (uint64_t *) ic[1].arg[0])
+		rEp = (uint64_t *) ic[3].arg[1];
 
-	memset(page + (rX & 0xfff), 0, bytes_to_write);
+	rE = reg(rEp);
+	len = rE - rS;
 
-	reg(ic->arg[0]) = rX + bytes_to_write;
+	if (!cpu->delay_slot && ((rS | rD) & (size - 1)) == 0 &&
+	    (len & (size - 1)) == 0 && len != 0)
+		done = DYNTRANS_BULK_MEMCPY(cpu, rD, rS, len);
 
-	cpu->n_translated_instrs += bytes_to_write / 4 * 3 - 1;
-	cpu->cd.mips.next_ic = partial?
+	/*  Fallback: Run the load instruction (lw or lbu) as usual.  */
+	if (done == 0) {
+#ifdef MODE32
+		mips32_loadstore
+#else
+		mips_loadstore
+#endif
+		    [(cpu->byte_order == EMUL_LITTLE_ENDIAN? 0 : 16) +
+		    (size == 4? 5 : 0)](cpu, ic);
+		return;
+	}
+
+	/*  rV should contain the last value that was loaded:  */
+	last = rS + done - size;
+	p = DYNTRANS_HOST_PAGE(cpu, last, 0) + (last & 0xfff);
+	if (size == 1)
+		reg(ic[0].arg[0]) = p[0];
+	else if (cpu->byte_order == EMUL_LITTLE_ENDIAN)
+		reg(ic[0].arg[0]) = (int32_t) (p[0] + (p[1] << 8) +
+		    (p[2] << 16) + ((uint32_t)p[3] << 24));
+	else
+		reg(ic[0].arg[0]) = (int32_t) (p[3] + (p[2] << 8) +
+		    (p[1] << 16) + ((uint32_t)p[0] << 24));
+
+	reg(ic[1].arg[0]) = rS + done;
+	reg(ic[2].arg[0]) = rD + done;
+
+	cpu->n_translated_instrs += done / size * 5 - 1;
+	cpu->cd.mips.next_ic = done < len?
 	    (struct mips_instr_call *) &ic[0] :
-	    (struct mips_instr_call *) &ic[3];
+	    (struct mips_instr_call *) &ic[5];
 }
 
 
@@ -2800,6 +3036,72 @@ X(linux_pmax_idle)
 #endif
 
 
+/*
+ *  spin_lw_b_nop():
+ *
+ *  A spin-wait loop, e.g. waiting for a lock held by another CPU to be
+ *  released, or for a flag to be set:
+ *
+ *  s:	lw	rX,ofs(rY)
+ *	[nop]
+ *	beq/bne	rX,rZ,s
+ *	nop
+ *
+ *  The word is loaded directly from the host page. If the loop is about to
+ *  go around once more, the rest of the dyntrans slice is given up (on
+ *  multi-processor machines), so that the other CPUs get to run.
+ */
+X(spin_lw_b_nop)
+{
+	MODE_uint_t addr = reg(ic[0].arg[1]) + (int32_t)ic[0].arg[2];
+	int has_nop = ic[1].f == instr(nop);
+	struct mips_instr_call *b = has_nop? &ic[2] : &ic[1];
+	unsigned char *page;
+	uint32_t w;
+	int x;
+
+	page = DYNTRANS_HOST_PAGE(cpu, addr, 0);
+
+	/*  Fallback:  */
+	if (cpu->delay_slot || page == NULL || (addr & 3)) {
+#ifdef MODE32
+		mips32_loadstore
+#else
+		mips_loadstore
+#endif
+		    [(cpu->byte_order == EMUL_LITTLE_ENDIAN? 0 : 16) + 5](cpu, ic);
+		return;
+	}
+
+	page += (addr & 0xfff);
+	if (cpu->byte_order == EMUL_LITTLE_ENDIAN)
+		w = page[0] + (page[1] << 8) + (page[2] << 16) +
+		    ((uint32_t)page[3] << 24);
+	else
+		w = page[3] + (page[2] << 8) + (page[1] << 16) +
+		    ((uint32_t)page[0] << 24);
+	reg(ic[0].arg[0]) = (int32_t) w;
+
+	x = reg(b->arg[0]) == reg(b->arg[1]);
+	if (b->f == instr(bne_samepage))
+		x = !x;
+
+	/*  lw, [nop,] the branch, and its delay slot:  */
+	cpu->n_translated_instrs += has_nop? 3 : 2;
+
+	if (!x) {
+		cpu->cd.mips.next_ic = b + 2;
+		return;
+	}
+
+	if (cpu_spin_wait(cpu)) {
+		SYNCH_PC
+		cpu->cd.mips.next_ic = &nothing_call;
+	} else
+		cpu->cd.mips.next_ic = ic;
+}
+
+
 /*
  *  strlen_lb_addiu_bne_nop():
  *
@@ -3097,6 +3399,67 @@ X(end_of_page2)
 /*****************************************************************************/
 
 
+/*
+ *  Combine:  memset and memcpy loops, ending with a sw (size = 4) or sb
+ *  (size = 1) in the delay slot of a bne.  The caller has already checked
+ *  that there are at least 4 instructions before ic[0] in this page.
+ *
+ *	memset:				memcpy:
+ *
+ *	s:  addiu  rX,rX,size		s:  lw/lbu  rV,0(rS)
+ *	    bne    rY,rX,s		    addiu   rS,rS,size
+ *	    sw/sb  rZ,-size(rX)		    addiu   rD,rD,size
+ *					    bne     rS,rE,s
+ *					    sw/sb   rV,-size(rD)
+ */
+void COMBINE(bulk_memory)(struct cpu *cpu, struct mips_instr_call *ic,
+	int size)
+{
+	void (*load)(struct cpu *, struct mips_instr_call *) =
+#ifdef MODE32
+	    mips32_loadstore
+#else
+	    mips_loadstore
+#endif
+	    [(cpu->byte_order == EMUL_LITTLE_ENDIAN? 0 : 16) +
+	    (size == 4? 5 : 0)];
+	size_t rE;
+
+	if (ic[-2].f == instr(addiu) && ic[-2].arg[0] == ic[-2].arg[1] &&
+	    (int32_t)ic[-2].arg[2] == size &&
+	    ic[-1].f == instr(bne_samepage) &&
+	    (ic[-1].arg[0] == ic[-2].arg[0] ||
+		ic[-1].arg[1] == ic[-2].arg[0]) &&
+	    ic[-1].arg[0] != ic[-1].arg[1] &&
+	    ic[-1].arg[2] == (size_t) &ic[-2] &&
+	    ic[0].arg[0] != ic[0].arg[1] &&
+	    ic[0].arg[1] == ic[-2].arg[0] && (int32_t)ic[0].arg[2] == -size) {
+		ic[-2].f = instr(memset_addiu_bne_store);
+		return;
+	}
+
+	rE = ic[-1].arg[0] == ic[-3].arg[0]? ic[-1].arg[1] : ic[-1].arg[0];
+
+	if (ic[-4].f == load && (int32_t)ic[-4].arg[2] == 0 &&
+	    ic[-3].f == instr(addiu) && ic[-3].arg[0] == ic[-3].arg[1] &&
+	    (int32_t)ic[-3].arg[2] == size &&
+	    ic[-2].f == instr(addiu) && ic[-2].arg[0] == ic[-2].arg[1] &&
+	    (int32_t)ic[-2].arg[2] == size &&
+	    ic[-1].f == instr(bne_samepage) &&
+	    (ic[-1].arg[0] == ic[-3].arg[0] ||
+		ic[-1].arg[1] == ic[-3].arg[0]) &&
+	    ic[-1].arg[2] == (size_t) &ic[-4] &&
+	    ic[0].arg[1] == ic[-2].arg[0] && (int32_t)ic[0].arg[2] == -size &&
+	    ic[-4].arg[1] == ic[-3].arg[0] && ic[0].arg[0] == ic[-4].arg[0] &&
+	    ic[-3].arg[0] != ic[-2].arg[0] &&
+	    rE != ic[-3].arg[0] && rE != ic[-2].arg[0] &&
+	    ic[-4].arg[0] != ic[-3].arg[0] && ic[-4].arg[0] != ic[-2].arg[0] &&
+	    ic[-4].arg[0] != rE) {
+		ic[-4].f = instr(memcpy_load_addiu_addiu_bne_store);
+	}
+}
+
+
 /*
  *  Combine:  Multiple SW in a row using the same base register
  *
@@ -3152,17 +3515,22 @@ void COMBINE(sw)(struct cpu *cpu, struct mips_instr_call *ic, int low_addr)
 			ic[-1].f = instr(multi_sw_2_be);
 	}
 
-	if (ic[-2].f == instr(addiu) && ic[-2].arg[0] == ic[-2].arg[1] &&
-	    (int32_t)ic[-2].arg[2] == 4 &&
-	    ic[-1].f == instr(bne_samepage) &&
-	    (ic[-1].arg[0] == ic[-2].arg[0] ||
-		ic[-1].arg[1] == ic[-2].arg[0]) &&
-	    ic[-1].arg[0] != ic[-1].arg[1] &&
-	    ic[-1].arg[2] == (size_t) &ic[-2] &&
-	    ic[0].arg[0] != ic[0].arg[1] &&
-	    ic[0].arg[1] == ic[-2].arg[0] && (int32_t)ic[0].arg[2] == -4) {
-		ic[-2].f = instr(memset_addiu_bne_sw);
-	}
+	COMBINE(bulk_memory)(cpu, ic, 4);
+}
+
+
+/*
+ *  Combine:  Byte store, possibly ending a memset or memcpy loop.
+ */
+void COMBINE(sb)(struct cpu *cpu, struct mips_instr_call *ic, int low_addr)
+{
+	int n_back = (low_addr >> MIPS_INSTR_ALIGNMENT_SHIFT)
+	    & (MIPS_IC_ENTRIES_PER_PAGE - 1);
+
+	if (n_back < 4)
+		return;
+
+	COMBINE(bulk_memory)(cpu, ic, 1);
 }
 
 
@@ -3336,6 +3704,29 @@ void COMBINE(nop)(struct cpu *cpu, struct mips_instr_call *ic, int low_addr)
 	}
 #endif
 
+	/*  Spin-wait loops:  */
+	{
+		void (*lw)(struct cpu *, struct mips_instr_call *) =
+#ifdef MODE32
+		    mips32_loadstore
+#else
+		    mips_loadstore
+#endif
+		    [(cpu->byte_order == EMUL_LITTLE_ENDIAN? 0 : 16) + 5];
+		struct mips_instr_call *s =
+		    ic[-2].f == instr(nop)? &ic[-3] : &ic[-2];
+
+		if (s->f == lw && s->arg[0] != s->arg[1] &&
+		    s->arg[0] != (size_t) &cpu->cd.mips.scratch &&
+		    (ic[-1].f == instr(beq_samepage) ||
+		    ic[-1].f == instr(bne_samepage)) &&
+		    ic[-1].arg[2] == (size_t) s &&
+		    (ic[-1].arg[0] == s->arg[0] || ic[-1].arg[1] == s->arg[0])) {
+			s->f = instr(spin_lw_b_nop);
+			return;
+		}
+	}
+
 	if (ic[-1].f == instr(bne_samepage)) {
 		ic[-1].f = instr(bne_samepage_nop);
 		return;
@@ -4290,6 +4681,21 @@ X(to_be_translated)
 			/*  TODO: Fix/optimize/rewrite.  */
 			ic->f = instr(cop1_slow);
 			ic->arg[0] = (uint32_t)iword & ((1 << 26) - 1);
+
+			/*  Host-native add/sub/mul/div .s and .d:  */
+			if (rs == COP1_FMT_S || rs == COP1_FMT_D) {
+				int dbl = rs == COP1_FMT_D;
+				switch (iword & 0x3f) {
+				case 0:	ic->f = dbl? instr(add_d) : instr(add_s);
+					break;
+				case 1:	ic->f = dbl? instr(sub_d) : instr(sub_s);
+					break;
+				case 2:	ic->f = dbl? instr(mul_d) : instr(mul_s);
+					break;
+				case 3:	ic->f = dbl? instr(div_d) : instr(div_s);
+					break;
+				}
+			}
 			break;
 
 		default:if (!cpu->translation_readahead)
@@ -4613,6 +5019,8 @@ X(to_be_translated)
 			cpu->cd.mips.combination_check = COMBINE(lw);
 		if (main_opcode == HI6_SW)
 			cpu->cd.mips.combination_check = COMBINE(sw);
+		if (main_opcode == HI6_SB)
+			cpu->cd.mips.combination_check = COMBINE(sb);
 		break;
 
 	case HI6_LL:
@@ -4882,6 +5290,22 @@ X(to_be_translated)
 #endif
 
 
+	/*
+	 *  Well-known guest functions (bzero, memcpy, etc.) are replaced by
+	 *  host-native code, unless combinations are disabled (-J) or while
+	 *  single-stepping/tracing, as for instruction combinations.
+	 */
+	if (cpu->machine->symbol_context.n_symbols != 0 &&
+	    !cpu->cd.mips.native_fallback && !in_crosspage_delayslot &&
+	    cpu->machine->allow_instruction_combinations && !single_step &&
+	    !cpu->machine->instruction_trace) {
+		int func = mips_cpu_native_function(cpu, addr);
+		if (func >= 0) {
+			ic->f = instr(native_function);
+			ic->arg[0] = func;
+		}
+	}
+
 #define	DYNTRANS_TO_BE_TRANSLATED_TAIL
 #include "cpu_dyntrans.c" 
 #undef	DYNTRANS_TO_BE_TRANSLATED_TAIL
@@ -59,6 +59,7 @@ void ppc32_pc_to_pointers(struct cpu *);
 
 void ppc_irq_interrupt_assert(struct interrupt *interrupt);
 void ppc_irq_interrupt_deassert(struct interrupt *interrupt);
+static void ppc_timer_sync(struct cpu *cpu, int64_t now);
 
 
 /*
@@ -136,6 +137,7 @@ int ppc_cpu_new(struct cpu *cpu, struct memory *mem, struct machine *machine,
 	}
 
 	cpu->translate_v2p = ppc_translate_v2p;
+	cpu->interrupt_check = ppc_cpu_interrupt_check;
 
 	cpu->cd.ppc.spr[SPR_PIR] = cpu_id;
 
@@ -211,6 +213,8 @@ int ppc_cpu_new(struct cpu *cpu, struct memory *mem, struct machine *machine,
 	if (cpu->is_32bit)
 		cpu->vaddr_mask = 0x00000000ffffffffULL;
 
+	ppc_timer_write(cpu, SPR_DEC, 0);
+
 	return 1;
 }
 
@@ -308,7 +312,8 @@ void reg_access_msr(struct cpu *cpu, uint64_t *valuep, int writeflag,
 			cpu->cd.ppc.dec_intr_pending = 0;
 		} else if (cpu->cd.ppc.irq_asserted)
 			ppc_exception(cpu, PPC_EXCEPTION_EI);
-	}
+	} else if (writeflag)
+		cpu_interrupt_update(cpu);
 }
 
 
@@ -439,6 +444,7 @@ void ppc_cpu_register_dump(struct cpu *cpu, int gprs, int coprocs)
 		else
 			debug("0x%016" PRIx64, (uint64_t) tmp);
 
+		ppc_timer_sync(cpu, cpu->ninstrs);
 		debug("  tb  = 0x%08" PRIx32"%08" PRIx32"\n",
 		    (uint32_t) cpu->cd.ppc.spr[SPR_TBU],
 		    (uint32_t) cpu->cd.ppc.spr[SPR_TBL]);
@@ -563,6 +569,86 @@ void ppc_cpu_tlbdump(struct cpu* cpu, int rawflag)
 }
 
 
+/*
+ *  ppc_timer_sync():
+ *
+ *  The time base (TBU:TBL) and the decrementer are not updated as
+ *  instructions execute. The values in spr[] are those at the instruction
+ *  count timer_base_ninstrs; this brings them up to date with instruction
+ *  count now.
+ */
+static void ppc_timer_sync(struct cpu *cpu, int64_t now)
+{
+	int64_t elapsed = now - cpu->cd.ppc.timer_base_ninstrs;
+	uint64_t tb;
+
+	if (elapsed <= 0)
+		return;
+
+	tb = ((uint64_t) (uint32_t) cpu->cd.ppc.spr[SPR_TBU] << 32)
+	    + (uint32_t) cpu->cd.ppc.spr[SPR_TBL] + elapsed;
+	cpu->cd.ppc.spr[SPR_TBL] = (uint32_t) tb;
+	cpu->cd.ppc.spr[SPR_TBU] = (uint32_t) (tb >> 32);
+	cpu->cd.ppc.spr[SPR_DEC] = (uint32_t)
+	    (cpu->cd.ppc.spr[SPR_DEC] - elapsed);
+	cpu->cd.ppc.timer_base_ninstrs = now;
+}
+
+
+/*
+ *  ppc_timer_read(), ppc_timer_write():
+ *
+ *  Read or write the time base (SPR_TBL, SPR_TBU) or decrementer (SPR_DEC)
+ *  registers. Writing the decrementer schedules the next decrementer
+ *  interrupt, at the instruction count where it goes from 0 to -1.
+ */
+uint64_t ppc_timer_read(struct cpu *cpu, int spr)
+{
+	ppc_timer_sync(cpu, cpu_ninstrs_now(cpu));
+	return cpu->cd.ppc.spr[spr];
+}
+void ppc_timer_write(struct cpu *cpu, int spr, uint64_t value)
+{
+	ppc_timer_sync(cpu, cpu_ninstrs_now(cpu));
+	cpu->cd.ppc.spr[spr] = (uint32_t) value;
+
+	if (spr != SPR_DEC)
+		return;
+
+	if (cpu->cd.ppc.cpu_type.flags & PPC_NO_DEC)
+		cpu_timer_schedule(cpu, INT64_MAX);
+	else
+		cpu_timer_schedule(cpu, cpu->cd.ppc.timer_base_ninstrs +
+		    (uint32_t) cpu->cd.ppc.spr[SPR_DEC] + 1);
+}
+
+
+/*
+ *  ppc_timer_event():
+ *
+ *  Called at the end of a dyntrans slice, when the decrementer has passed
+ *  zero.
+ */
+void ppc_timer_event(struct cpu *cpu)
+{
+	cpu->timer_event_ninstrs += (int64_t)1 << 32;
+	cpu->cd.ppc.dec_intr_pending = 1;
+}
+
+
+/*
+ *  ppc_cpu_interrupt_check():
+ *
+ *  Returns true if an external or decrementer interrupt is pending, and
+ *  external interrupts are enabled in the MSR.
+ */
+bool ppc_cpu_interrupt_check(struct cpu *cpu)
+{
+	return (cpu->cd.ppc.irq_asserted || cpu->cd.ppc.dec_intr_pending) &&
+	    cpu->cd.ppc.msr & PPC_MSR_EE;
+}
+
+
 /*
  *  ppc_irq_interrupt_assert():
  */
@@ -570,6 +656,7 @@ void ppc_irq_interrupt_assert(struct interrupt *interrupt)
 {
 	struct cpu *cpu = (struct cpu *) interrupt->extra;
 	cpu->cd.ppc.irq_asserted = 1;
+	cpu_interrupt_update(cpu);
 }
 
 
@@ -580,6 +667,7 @@ void ppc_irq_interrupt_deassert(struct interrupt *interrupt)
 {
 	struct cpu *cpu = (struct cpu *) interrupt->extra;
 	cpu->cd.ppc.irq_asserted = 0;
+	cpu_interrupt_update(cpu);
 }
 
 
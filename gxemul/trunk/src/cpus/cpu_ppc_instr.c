@@ -82,20 +82,12 @@ X(invalid)
 
 
 /*
- *  addi:  Add immediate.
+ *  li_0:  Load immediate zero.
  *
- *  arg[0] = pointer to source uint64_t
- *  arg[1] = immediate value (int32_t or larger)
  *  arg[2] = pointer to destination uint64_t
+ *
+ *  (Other addi and li forms are in tmp_ppc_alu.c.)
  */
-X(addi)
-{
-	reg(ic->arg[2]) = reg(ic->arg[0]) + (int32_t)ic->arg[1];
-}
-X(li)
-{
-	reg(ic->arg[2]) = (int32_t)ic->arg[1];
-}
 X(li_0)
 {
 	reg(ic->arg[2]) = 0;
@@ -437,18 +429,6 @@ X(bc_samepage)
 	if (ctr_ok && cond_ok)
 		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
 }
-X(bc_samepage_simple0)
-{
-	int bi31m = ic->arg[2];
-	if (!((cpu->cd.ppc.cr >> bi31m) & 1))
-		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
-}
-X(bc_samepage_simple1)
-{
-	int bi31m = ic->arg[2];
-	if ((cpu->cd.ppc.cr >> bi31m) & 1)
-		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
-}
 X(bcl_samepage)
 {
 	MODE_uint_t tmp;
@@ -774,19 +754,6 @@ X(cmpwi)
 	cpu->cd.ppc.cr &= ~(0xf << bf_shift);
 	cpu->cd.ppc.cr |= (c << bf_shift);
 }
-X(cmpwi_cr0)
-{
-	/*  arg[2] is assumed to be 28  */
-	int32_t tmp = reg(ic->arg[0]), imm = ic->arg[1];
-	cpu->cd.ppc.cr &= ~(0xf0000000);
-	if (tmp < imm)
-		cpu->cd.ppc.cr |= 0x80000000;
-	else if (tmp > imm)
-		cpu->cd.ppc.cr |= 0x40000000;
-	else
-		cpu->cd.ppc.cr |= 0x20000000;
-	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
-}
 
 
 /*
@@ -1703,14 +1670,13 @@ X(mfspr_pmc1) {
 	reg(ic->arg[0]) = cpu->machine->emulated_hz / 10;
 }
 X(mftb) {
-	/*  NOTE/TODO: This increments the time base (slowly) if it
-	    is being polled.  */
-	if (++cpu->cd.ppc.spr[SPR_TBL] == 0)
-		cpu->cd.ppc.spr[SPR_TBU] ++;
-	reg(ic->arg[0]) = cpu->cd.ppc.spr[SPR_TBL];
+	reg(ic->arg[0]) = ppc_timer_read(cpu, SPR_TBL);
 }
 X(mftbu) {
-	reg(ic->arg[0]) = cpu->cd.ppc.spr[SPR_TBU];
+	reg(ic->arg[0]) = ppc_timer_read(cpu, SPR_TBU);
+}
+X(mfspr_dec) {
+	reg(ic->arg[0]) = ppc_timer_read(cpu, SPR_DEC);
 }
 
 
@@ -1724,6 +1690,10 @@ X(mtspr) {
 	/*  TODO: Check permission  */
 	reg(ic->arg[1]) = reg(ic->arg[0]);
 }
+X(mtspr_timer) {
+	/*  arg[2] = SPR_DEC, SPR_TBL, or SPR_TBU  */
+	ppc_timer_write(cpu, ic->arg[2], reg(ic->arg[0]));
+}
 X(mtspr_sprg2) {
 	if (cpu->cd.ppc.bits == 32) {
 		// Ignore for now. FreeBSD/powerpc seems to write 0xffffffe0
@@ -1733,6 +1703,13 @@ X(mtspr_sprg2) {
 		reg(ic->arg[1]) = reg(ic->arg[0]);
 	}
 }
+X(mtspr_mmu) {
+	/*  SDR1 or BAT register: Changes affect all translations.  */
+	uint64_t old = reg(ic->arg[1]);
+	reg(ic->arg[1]) = reg(ic->arg[0]);
+	if (reg(ic->arg[1]) != old)
+		cpu->invalidate_translation_caches(cpu, 0, INVALIDATE_ALL);
+}
 X(mtlr) {
 	cpu->cd.ppc.spr[SPR_LR] = reg(ic->arg[0]);
 }
@@ -2084,7 +2061,6 @@ X(andc) {	reg(ic->arg[2]) = reg(ic->arg[0]) & (~reg(ic->arg[1])); }
 DOT2(andc)
 X(nor) {	reg(ic->arg[2]) = ~(reg(ic->arg[0]) | reg(ic->arg[1])); }
 DOT2(nor)
-X(mr) {		reg(ic->arg[2]) = reg(ic->arg[1]); }
 X(or) {		reg(ic->arg[2]) = reg(ic->arg[0]) | reg(ic->arg[1]); }
 DOT2(or)
 X(orc) {	reg(ic->arg[2]) = reg(ic->arg[0]) | (~reg(ic->arg[1])); }
@@ -2322,6 +2298,13 @@ X(xori) { reg(ic->arg[2]) = reg(ic->arg[0]) ^ (uint32_t)ic->arg[1]; }
 #include "tmp_ppc_loadstore.c"
 
 
+/*
+ *  Register-specialized versions of addi, mr, li, cmpwi_cr0, and
+ *  bc_samepage_simple0/1.
+ */
+#include "tmp_ppc_alu.c"
+
+
 /*
  *  lfs, stfs: Load/Store Floating-point Single precision
  */
@@ -2656,6 +2639,130 @@ X(tlbld)
 }
 
 
+/*
+ *  memset_stu_bdnz:
+ *
+ *  s:	stwu	rV,4(rD)	(or stbu rV,1(rD))
+ *	bdnz	s
+ *
+ *  memcpy_lzu_stu_bdnz:
+ *
+ *  s:	lwzu	rV,4(rS)	(or lbzu rV,1(rS))
+ *	stwu	rV,4(rD)	(or stbu rV,1(rD))
+ *	bdnz	s
+ *
+ *  These are the usual PowerPC memset/memcpy loops, running CTR times. They
+ *  are executed as host memset/memcpy, up to the end of the current page(s).
+ */
+X(memset_stu_bdnz)
+{
+	MODE_uint_t rD = reg(ic[0].arg[1]), rV = reg(ic[0].arg[0]);
+	MODE_uint_t ctr = cpu->cd.ppc.spr[SPR_CTR];
+	int size = ic[0].arg[2];
+	size_t len = (ctr > 0x1000? 0x1000 : ctr) * size, done = 0;
+
+	if (ctr != 0 && (rD & (size - 1)) == 0 &&
+	    (size == 1 || (uint32_t)rV == (rV & 0xff) * 0x01010101U))
+		done = DYNTRANS_BULK_MEMSET(cpu, rD + size, rV & 0xff, len);
+
+	if (done == 0) {
+		if (size == 1)
+			instr(stbu)(cpu, ic);
+		else
+			instr(stwu)(cpu, ic);
+		return;
+	}
+
+	reg(ic[0].arg[1]) = rD + done;
+	cpu->cd.ppc.spr[SPR_CTR] -= done / size;
+
+	cpu->n_translated_instrs += done / size * 2 - 1;
+	cpu->cd.ppc.next_ic = (MODE_uint_t)cpu->cd.ppc.spr[SPR_CTR] == 0?
+	    &ic[2] : &ic[0];
+}
+X(memcpy_lzu_stu_bdnz)
+{
+	MODE_uint_t rS = reg(ic[0].arg[1]), rD = reg(ic[1].arg[1]), last;
+	MODE_uint_t ctr = cpu->cd.ppc.spr[SPR_CTR];
+	int size = ic[0].arg[2];
+	size_t len = (ctr > 0x1000? 0x1000 : ctr) * size, done = 0;
+	unsigned char *p;
+
+	if (ctr != 0 && ((rS | rD) & (size - 1)) == 0)
+		done = DYNTRANS_BULK_MEMCPY(cpu, rD + size, rS + size, len);
+
+	if (done == 0) {
+		if (size == 1)
+			instr(lbzu)(cpu, ic);
+		else
+			instr(lwzu)(cpu, ic);
+		return;
+	}
+
+	/*  rV should contain the last value that was loaded:  */
+	last = rS + done;
+	p = DYNTRANS_HOST_PAGE(cpu, last, 0) + (last & 0xfff);
+	if (size == 1)
+		reg(ic[0].arg[0]) = p[0];
+	else if (cpu->byte_order == EMUL_LITTLE_ENDIAN)
+		reg(ic[0].arg[0]) = p[0] + (p[1] << 8) + (p[2] << 16) +
+		    ((uint32_t)p[3] << 24);
+	else
+		reg(ic[0].arg[0]) = p[3] + (p[2] << 8) + (p[1] << 16) +
+		    ((uint32_t)p[0] << 24);
+
+	reg(ic[0].arg[1]) = last;
+	reg(ic[1].arg[1]) = rD + done;
+	cpu->cd.ppc.spr[SPR_CTR] -= done / size;
+
+	cpu->n_translated_instrs += done / size * 3 - 1;
+	cpu->cd.ppc.next_ic = (MODE_uint_t)cpu->cd.ppc.spr[SPR_CTR] == 0?
+	    &ic[3] : &ic[0];
+}
+
+
+/*****************************************************************************/
+
+
+/*
+ *  Combine: bdnz, possibly ending a memset or memcpy loop.
+ *
+ *  See memset_stu_bdnz and memcpy_lzu_stu_bdnz above for details.
+ */
+void COMBINE(bdnz)(struct cpu *cpu, struct ppc_instr_call *ic, int low_addr)
+{
+	int n_back = (low_addr >> PPC_INSTR_ALIGNMENT_SHIFT)
+	    & (PPC_IC_ENTRIES_PER_PAGE - 1);
+	int size;
+
+	if (n_back < 2 || ic[0].f != instr(bc_samepage) || ic[0].arg[1] != 16)
+		return;
+
+	if (ic[-1].f == instr(stwu))
+		size = 4;
+	else if (ic[-1].f == instr(stbu))
+		size = 1;
+	else
+		return;
+
+	if ((int32_t)ic[-1].arg[2] != size || ic[-1].arg[0] == ic[-1].arg[1])
+		return;
+
+	if (ic[0].arg[0] == (size_t) &ic[-1]) {
+		ic[-1].f = instr(memset_stu_bdnz);
+		return;
+	}
+
+	if (ic[0].arg[0] == (size_t) &ic[-2] &&
+	    ic[-2].f == (size == 4? instr(lwzu) : instr(lbzu)) &&
+	    (int32_t)ic[-2].arg[2] == size &&
+	    ic[-2].arg[0] == ic[-1].arg[0] &&
+	    ic[-2].arg[1] != ic[-1].arg[1] &&
+	    ic[-2].arg[0] != ic[-2].arg[1])
+		ic[-2].f = instr(memcpy_lzu_stu_bdnz);
+}
+
+
 /*****************************************************************************/
 
 
@@ -2808,7 +2915,7 @@ X(to_be_translated)
 				ic->f = instr(cmpdi);
 			else {
 				if (bf == 0)
-					ic->f = instr(cmpwi_cr0);
+					ic->f = instr(alu_cmpwi_cr0)[ra];
 				else
 					ic->f = instr(cmpwi);
 			}
@@ -2840,9 +2947,9 @@ X(to_be_translated)
 	case PPC_HI6_ADDI:
 	case PPC_HI6_ADDIS:
 		rt = (iword >> 21) & 31; ra = (iword >> 16) & 31;
-		ic->f = instr(addi);
+		ic->f = instr(alu_addi)[32 * rt + ra];
 		if (ra == 0)
-			ic->f = instr(li);
+			ic->f = instr(alu_li)[rt];
 		else
 			ic->arg[0] = (size_t)(&cpu->cd.ppc.gpr[ra]);
 		ic->arg[1] = (int16_t)(iword & 0xffff);
@@ -2973,8 +3080,8 @@ X(to_be_translated)
 			ic->f = instr(bc);
 			if ((bo & 0x14) == 0x04) {
 				samepage_function = bo & 8?
-				    instr(bc_samepage_simple1) :
-				    instr(bc_samepage_simple0);
+				    instr(alu_bc_samepage_simple1)[bi] :
+				    instr(alu_bc_samepage_simple0)[bi];
 			} else
 				samepage_function = instr(bc_samepage);
 		}
@@ -2994,6 +3101,7 @@ X(to_be_translated)
 				ic->arg[0] = (size_t) (
 				    cpu->cd.ppc.cur_ic_page +
 				    ((new_pc & mask_within_page) >> 2));
+				cpu->cd.ppc.combination_check = COMBINE(bdnz);
 			}
 		}
 		break;
@@ -3268,6 +3376,9 @@ X(to_be_translated)
 			// Reuse SPR_TB* for TBR_TB*:
 			case TBR_TBL: ic->f = instr(mftb); break;
 			case TBR_TBU: ic->f = instr(mftbu); break;
+			case SPR_TBL: ic->f = instr(mftb); break;
+			case SPR_TBU: ic->f = instr(mftbu); break;
+			case SPR_DEC: ic->f = instr(mfspr_dec); break;
 			case SPR_PMC1:	ic->f = instr(mfspr_pmc1); break;
 			default:	ic->f = instr(mfspr);
 			}
@@ -3289,7 +3400,19 @@ X(to_be_translated)
 			case SPR_SPRG2:
 				ic->f = instr(mtspr_sprg2);
 				break;
-			default:ic->f = instr(mtspr);
+			case SPR_SDR1:
+				ic->f = instr(mtspr_mmu);
+				break;
+			case SPR_DEC:
+			case SPR_TBL:
+			case SPR_TBU:
+				ic->arg[2] = spr;
+				ic->f = instr(mtspr_timer);
+				break;
+			default:if (spr >= SPR_IBAT0U && spr <= SPR_DBAT3L)
+					ic->f = instr(mtspr_mmu);
+				else
+					ic->f = instr(mtspr);
 			}
 			break;
 
@@ -3634,8 +3757,9 @@ X(to_be_translated)
 					  rc_f  = instr(andc_dot); break;
 			case PPC_31_NOR:  ic->f = instr(nor);
 					  rc_f  = instr(nor_dot); break;
-			case PPC_31_OR:   ic->f = rs == rb? instr(mr)
-						: instr(or);
+			case PPC_31_OR:   ic->f = rs == rb?
+					      instr(alu_mr)[32 * ra + rs] :
+					      instr(or);
 					  rc_f  = instr(or_dot); break;
 			case PPC_31_ORC:  ic->f = instr(orc);
 					  rc_f  = instr(orc_dot); break;
@@ -102,6 +102,7 @@ int sh_cpu_new(struct cpu *cpu, struct memory *mem, struct machine *machine,
 	}
 
 	cpu->instruction_has_delayslot = sh_cpu_instruction_has_delayslot;
+	cpu->interrupt_check = sh_cpu_interrupt_check;
 
 	cpu->translate_v2p = sh_translate_v2p;
 
@@ -293,6 +294,20 @@ void sh3_cpu_interrupt_deassert(struct interrupt *interrupt)
 }       
 
 
+/*
+ *  sh_cpu_interrupt_check():
+ *
+ *  Returns true if an interrupt is asserted, exceptions are not blocked, and
+ *  the interrupt's priority level is above the current interrupt mask.
+ */
+bool sh_cpu_interrupt_check(struct cpu *cpu)
+{
+	return cpu->cd.sh.int_to_assert > 0 && !(cpu->cd.sh.sr & SH_SR_BL) &&
+	    ((cpu->cd.sh.sr & SH_SR_IMASK) >> SH_SR_IMASK_SHIFT)
+	    < cpu->cd.sh.int_level;
+}
+
+
 /*
  *  sh_cpu_interrupt_assert():
  */
@@ -317,6 +332,8 @@ void sh_cpu_interrupt_assert(struct interrupt *interrupt)
 		cpu->cd.sh.int_to_assert = irq_nr;
 		cpu->cd.sh.int_level = prio;
 	}
+
+	cpu_interrupt_update(cpu);
 }
 
 
@@ -348,6 +365,8 @@ void sh_cpu_interrupt_deassert(struct interrupt *interrupt)
 			}
 		}
 	}
+
+	cpu_interrupt_update(cpu);
 }
 
 
@@ -591,6 +610,7 @@ void sh_update_sr(struct cpu *cpu, uint32_t new_sr)
 	}
 
 	cpu->cd.sh.sr = new_sr;
+	cpu_interrupt_update(cpu);
 }
 
 
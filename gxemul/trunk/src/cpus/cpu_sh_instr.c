@@ -85,9 +85,7 @@ X(sleep)
 	 *  If there is an interrupt, then just return. Otherwise
 	 *  re-run the sleep instruction (after a delay).
 	 */
-	if (cpu->cd.sh.int_to_assert > 0 && !(cpu->cd.sh.sr & SH_SR_BL)
-	    && ((cpu->cd.sh.sr & SH_SR_IMASK) >> SH_SR_IMASK_SHIFT)
-	    < cpu->cd.sh.int_level)
+	if (sh_cpu_interrupt_check(cpu))
 		return;
 
 	SYNCH_PC;
@@ -276,14 +274,12 @@ X(and_b_imm_r0_gbr)
 
 /*
  *  mov_imm_rn:  Set rn to a signed 8-bit value
- *  add_imm_rn:  Add a signed 8-bit value to Rn
  *
  *  arg[0] = int8_t imm, extended to at least int32_t
  *  arg[1] = ptr to rn
  */
 X(mov_imm_rn) { reg(ic->arg[1]) = ic->arg[0]; }
 X(mov_0_rn)   { reg(ic->arg[1]) = 0; }
-X(add_imm_rn) { reg(ic->arg[1]) += ic->arg[0]; }
 X(inc_rn)     { reg(ic->arg[1]) ++; }
 X(add_4_rn)   { reg(ic->arg[1]) += 4; }
 X(sub_4_rn)   { reg(ic->arg[1]) -= 4; }
@@ -1513,21 +1509,17 @@ X(mov_w_r0_disp_rn)
 
 
 /*
- *  add_rm_rn:  rn = rn + rm
  *  addc_rm_rn: rn = rn + rm + t
  *  and_rm_rn:  rn = rn & rm
  *  xor_rm_rn:  rn = rn ^ rm
  *  or_rm_rn:   rn = rn | rm
  *  sub_rm_rn:  rn = rn - rm
  *  subc_rm_rn: rn = rn - rm - t; t = borrow
- *  tst_rm_rn:  t = ((rm & rn) == 0)
- *  tst_rm:     t = (rm == 0)
  *  xtrct_rm_rn:  rn = (rn >> 16) | (rm << 16)
  *
  *  arg[0] = ptr to rm
  *  arg[1] = ptr to rn
  */
-X(add_rm_rn) { reg(ic->arg[1]) += reg(ic->arg[0]); }
 X(addc_rm_rn)
 {
 	uint64_t res = reg(ic->arg[1]);
@@ -1556,20 +1548,6 @@ X(subc_rm_rn)
 		cpu->cd.sh.sr &= ~SH_SR_T;
 	reg(ic->arg[1]) = (uint32_t) res;
 }
-X(tst_rm_rn)
-{
-	if (reg(ic->arg[1]) & reg(ic->arg[0]))
-		cpu->cd.sh.sr &= ~SH_SR_T;
-	else
-		cpu->cd.sh.sr |= SH_SR_T;
-}
-X(tst_rm)
-{
-	if (reg(ic->arg[0]))
-		cpu->cd.sh.sr &= ~SH_SR_T;
-	else
-		cpu->cd.sh.sr |= SH_SR_T;
-}
 X(xtrct_rm_rn)
 {
 	uint32_t rn = reg(ic->arg[1]), rm = reg(ic->arg[0]);
@@ -1669,7 +1647,6 @@ X(dmulu_l_rm_rn)
 
 /*
  *  cmpeq_imm_r0:  rn == int8_t immediate
- *  cmpeq_rm_rn:   rn == rm
  *  cmphs_rm_rn:   rn >= rm, unsigned
  *  cmpge_rm_rn:   rn >= rm, signed
  *  cmphi_rm_rn:   rn > rm, unsigned
@@ -1688,13 +1665,6 @@ X(cmpeq_imm_r0)
 	else
 		cpu->cd.sh.sr &= ~SH_SR_T;
 }
-X(cmpeq_rm_rn)
-{
-	if (reg(ic->arg[1]) == reg(ic->arg[0]))
-		cpu->cd.sh.sr |= SH_SR_T;
-	else
-		cpu->cd.sh.sr &= ~SH_SR_T;
-}
 X(cmphs_rm_rn)
 {
 	if (reg(ic->arg[1]) >= reg(ic->arg[0]))
@@ -1756,6 +1726,14 @@ X(cmp_str_rm_rn)
 }
 
 
+/*
+ *  Register-specialized versions of mov_rm_rn, add_rm_rn, tst_rm_rn,
+ *  cmpeq_rm_rn, add_imm_rn, and mov_imm_rn, for general purpose registers
+ *  only. The arg[] fields are still filled in as for the generic versions.
+ */
+#include "tmp_sh_alu.c"
+
+
 /*
  *  shll_rn:  Shift rn left by 1  (t = bit that was shifted out)
  *  shlr_rn:  Shift rn right by 1 (t = bit that was shifted out)
@@ -3142,6 +3120,104 @@ X(bt_samepage_wait_for_variable)
 }
 
 
+/*
+ *  memset_dt_bf_s_predec:
+ *
+ *	s:  dt     rC			dt_rn
+ *	    bf/s   s			bf_s_samepage with arg[1] = s
+ *	    mov.l  rV,@-rD		mov_l_rm_predec_rn  (or mov.b)
+ *
+ *  A memset loop, filling rC words (or bytes) downwards from rD. The part
+ *  which is within the current page is done as a host memset.
+ */
+X(memset_dt_bf_s_predec)
+{
+	uint32_t rC = reg(ic[0].arg[1]), rV = reg(ic[2].arg[0]);
+	uint32_t rD = reg(ic[2].arg[1]), n, len;
+	int size = ic[2].f == instr(mov_b_rm_predec_rn)? 1 : 4;
+
+	/*  Number of elements left within the page, below rD:  */
+	n = (((rD - size) & 0xfff) + size) / size;
+	if (n > rC)
+		n = rC;
+	len = n * size;
+
+	if (cpu->delay_slot || rC == 0 || (rD & (size - 1)) != 0 ||
+	    (size == 4 && rV != (rV & 0xff) * 0x01010101U) ||
+	    DYNTRANS_BULK_MEMSET(cpu, rD - len, rV & 0xff, len) != len) {
+		instr(dt_rn)(cpu, ic);
+		return;
+	}
+
+	reg(ic[2].arg[1]) = rD - len;
+	reg(ic[0].arg[1]) = rC -= n;
+	if (rC == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+
+	cpu->n_translated_instrs += n * 3 - 1;
+	cpu->cd.sh.next_ic = rC == 0? ic + 3 : ic;
+}
+
+
+/*
+ *  memcpy_postinc_dt_store_bf_s_add:
+ *
+ *	s:  mov.l  @rS+,rV		mov_l_arg1_postinc_to_arg0  (or mov.b)
+ *	    dt     rC			dt_rn
+ *	    mov.l  rV,@rD		mov_l_store_rm_rn  (or mov.b)
+ *	    bf/s   s			bf_s_samepage with arg[1] = s
+ *	    add    #4,rD		add_4_rn  (or add #1, i.e. inc_rn)
+ *
+ *  A forward memcpy loop, copying rC words (or bytes) from rS to rD.
+ */
+X(memcpy_postinc_dt_store_bf_s_add)
+{
+	uint32_t rS = reg(ic[0].arg[1]), rC = reg(ic[1].arg[1]);
+	uint32_t rD = reg(ic[2].arg[1]), n, done = 0, last;
+	int size = ic[4].f == instr(inc_rn)? 1 : 4;
+	unsigned char *p;
+
+	if (!cpu->delay_slot && rC != 0 && ((rS | rD) & (size - 1)) == 0)
+		done = DYNTRANS_BULK_MEMCPY(cpu, rD, rS,
+		    (rC > 0x1000? 0x1000 : rC) * size);
+
+	if (done == 0) {
+		if (size == 1)
+			instr(mov_b_arg1_postinc_to_arg0)(cpu, ic);
+		else
+			instr(mov_l_arg1_postinc_to_arg0)(cpu, ic);
+		return;
+	}
+
+	n = done / size;
+
+	/*  rV should contain the last value that was loaded:  */
+	last = rS + done - size;
+	p = DYNTRANS_HOST_PAGE(cpu, last, 0) + (last & 0xfff);
+	if (size == 1)
+		reg(ic[0].arg[0]) = (int8_t) p[0];
+	else if (cpu->byte_order == EMUL_LITTLE_ENDIAN)
+		reg(ic[0].arg[0]) = p[0] + (p[1] << 8) + (p[2] << 16) +
+		    ((uint32_t)p[3] << 24);
+	else
+		reg(ic[0].arg[0]) = p[3] + (p[2] << 8) + (p[1] << 16) +
+		    ((uint32_t)p[0] << 24);
+
+	reg(ic[0].arg[1]) = rS + done;
+	reg(ic[2].arg[1]) = rD + done;
+	reg(ic[1].arg[1]) = rC -= n;
+	if (rC == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+
+	cpu->n_translated_instrs += n * 5 - 1;
+	cpu->cd.sh.next_ic = rC == 0? ic + 5 : ic;
+}
+
+
 /*****************************************************************************/
 
 
@@ -3154,20 +3230,92 @@ void COMBINE(bt_samepage)(struct cpu *cpu, struct sh_instr_call *ic, int low_add
 {
 	int n_back = (low_addr >> SH_INSTR_ALIGNMENT_SHIFT)
 	    & (SH_IC_ENTRIES_PER_PAGE - 1);
+	size_t m, n;
 
 	if (n_back < 2)
 		return;
 
+	/*  CMP/EQ Rm,Rn is translated into sh_alu_cmpeq_rm_rn[16 * m + n]:  */
+	m = (ic[-1].arg[0] - (size_t) &cpu->cd.sh.r[0]) / sizeof(uint32_t);
+	n = (ic[-1].arg[1] - (size_t) &cpu->cd.sh.r[0]) / sizeof(uint32_t);
+	if (m >= SH_N_GPRS || n >= SH_N_GPRS)
+		return;
+
 	if (ic[-2].f == instr(mov_l_disp_gbr_r0) &&
-	    ic[-1].f == instr(cmpeq_rm_rn) &&
-	    (ic[-1].arg[0] == (size_t) &cpu->cd.sh.r[0] ||
-	     ic[-1].arg[1] == (size_t) &cpu->cd.sh.r[0]) &&
+	    ic[-1].f == sh_alu_cmpeq_rm_rn[16 * m + n] &&
+	    (m == 0 || n == 0) &&
 	    ic[0].arg[1] == (size_t) &ic[-2]) {
 		ic[-2].f = instr(bt_samepage_wait_for_variable);
 	}
 }
 
 
+/*
+ *  Combine: memset loop, ending with a predecrement store in the delay slot
+ *  of a bf/s.
+ *
+ *  See memset_dt_bf_s_predec above for details.
+ */
+void COMBINE(predec_store)(struct cpu *cpu, struct sh_instr_call *ic,
+	int low_addr)
+{
+	int n_back = (low_addr >> SH_INSTR_ALIGNMENT_SHIFT)
+	    & (SH_IC_ENTRIES_PER_PAGE - 1);
+
+	if (n_back < 2)
+		return;
+
+	if (ic[-2].f == instr(dt_rn) &&
+	    ic[-1].f == instr(bf_s_samepage) &&
+	    ic[-1].arg[1] == (size_t) &ic[-2] &&
+	    (ic[0].f == instr(mov_l_rm_predec_rn) ||
+	     ic[0].f == instr(mov_b_rm_predec_rn)) &&
+	    ic[0].arg[0] != ic[0].arg[1] &&
+	    ic[0].arg[0] != ic[-2].arg[1] &&
+	    ic[0].arg[1] != ic[-2].arg[1] &&
+	    ic[0].arg[0] >= (size_t) &cpu->cd.sh.r[0] &&
+	    ic[0].arg[0] <= (size_t) &cpu->cd.sh.r[SH_N_GPRS - 1]) {
+		ic[-2].f = instr(memset_dt_bf_s_predec);
+	}
+}
+
+
+/*
+ *  Combine: memcpy loop, ending with an address increment in the delay slot
+ *  of a bf/s.
+ *
+ *  See memcpy_postinc_dt_store_bf_s_add above for details.
+ */
+void COMBINE(add_rn)(struct cpu *cpu, struct sh_instr_call *ic, int low_addr)
+{
+	int n_back = (low_addr >> SH_INSTR_ALIGNMENT_SHIFT)
+	    & (SH_IC_ENTRIES_PER_PAGE - 1);
+	int size = ic[0].f == instr(inc_rn)? 1 : 4;
+	size_t rV, rS, rC, rD;
+
+	if (n_back < 4)
+		return;
+
+	rV = ic[-4].arg[0]; rS = ic[-4].arg[1];
+	rC = ic[-3].arg[1]; rD = ic[0].arg[1];
+
+	if (ic[-4].f == (size == 1? instr(mov_b_arg1_postinc_to_arg0) :
+	    instr(mov_l_arg1_postinc_to_arg0)) &&
+	    ic[-3].f == instr(dt_rn) &&
+	    ic[-2].f == (size == 1? instr(mov_b_store_rm_rn) :
+	    instr(mov_l_store_rm_rn)) &&
+	    ic[-2].arg[0] == rV && ic[-2].arg[1] == rD &&
+	    ic[-1].f == instr(bf_s_samepage) &&
+	    ic[-1].arg[1] == (size_t) &ic[-4] &&
+	    rV != rS && rV != rC && rV != rD &&
+	    rS != rC && rS != rD && rC != rD &&
+	    rV >= (size_t) &cpu->cd.sh.r[0] &&
+	    rV <= (size_t) &cpu->cd.sh.r[SH_N_GPRS - 1]) {
+		ic[-4].f = instr(memcpy_postinc_dt_store_bf_s_add);
+	}
+}
+
+
 /*****************************************************************************/
 
 
@@ -3516,20 +3664,20 @@ X(to_be_translated)
 			break;
 		case 0x4:	/*  MOV.B Rm,@-Rn  */
 			ic->f = instr(mov_b_rm_predec_rn);
+			cpu->cd.sh.combination_check = COMBINE(predec_store);
 			break;
 		case 0x5:	/*  MOV.W Rm,@-Rn  */
 			ic->f = instr(mov_w_rm_predec_rn);
 			break;
 		case 0x6:	/*  MOV.L Rm,@-Rn  */
 			ic->f = instr(mov_l_rm_predec_rn);
+			cpu->cd.sh.combination_check = COMBINE(predec_store);
 			break;
 		case 0x7:	/*  DIV0S Rm,Rn  */
 			ic->f = instr(div0s_rm_rn);
 			break;
 		case 0x8:	/*  TST Rm,Rn  */
-			ic->f = instr(tst_rm_rn);
-			if (r8 == r4)
-				ic->f = instr(tst_rm);
+			ic->f = sh_alu_tst_rm_rn[16 * r4 + r8];
 			break;
 		case 0x9:	/*  AND Rm,Rn  */
 			ic->f = instr(and_rm_rn);
@@ -3562,7 +3710,7 @@ X(to_be_translated)
 	case 0x3:
 		switch (lo4) {
 		case 0x0:	/*  CMP/EQ Rm,Rn  */
-			ic->f = instr(cmpeq_rm_rn);
+			ic->f = sh_alu_cmpeq_rm_rn[16 * r4 + r8];
 			break;
 		case 0x2:	/*  CMP/HS Rm,Rn  */
 			ic->f = instr(cmphs_rm_rn);
@@ -3589,7 +3737,7 @@ X(to_be_translated)
 			ic->f = instr(subc_rm_rn);
 			break;
 		case 0xc:	/*  ADD Rm,Rn  */
-			ic->f = instr(add_rm_rn);
+			ic->f = sh_alu_add_rm_rn[16 * r4 + r8];
 			break;
 		case 0xd:	/*  DMULS.L Rm,Rn  */
 			ic->f = instr(dmuls_l_rm_rn);
@@ -3857,7 +4005,7 @@ X(to_be_translated)
 			ic->f = instr(load_l_rm_rn);
 			break;
 		case 0x3:	/*  MOV Rm,Rn  */
-			ic->f = instr(mov_rm_rn);
+			ic->f = sh_alu_mov_rm_rn[16 * r4 + r8];
 			break;
 		case 0x4:	/*  MOV.B @Rm+,Rn  */
 			ic->f = instr(mov_b_arg1_postinc_to_arg0);
@@ -3916,13 +4064,15 @@ X(to_be_translated)
 		break;
 
 	case 0x7:	/*  ADD #imm,Rn  */
-		ic->f = instr(add_imm_rn);
+		ic->f = sh_alu_add_imm_rn[r8];
 		ic->arg[0] = (int8_t)lo8;
 		ic->arg[1] = (size_t)&cpu->cd.sh.r[r8];		/* n */
 		if (lo8 == 1)
 			ic->f = instr(inc_rn);
 		if (lo8 == 4)
 			ic->f = instr(add_4_rn);
+		if (lo8 == 1 || lo8 == 4)
+			cpu->cd.sh.combination_check = COMBINE(add_rn);
 		if (lo8 == 0xfc)
 			ic->f = instr(sub_4_rn);
 		if (lo8 == 0xff)
@@ -4139,7 +4289,7 @@ X(to_be_translated)
 		break;
 
 	case 0xe:	/*  MOV #imm,Rn  */
-		ic->f = instr(mov_imm_rn);
+		ic->f = sh_alu_mov_imm_rn[r8];
 		ic->arg[0] = (int8_t)lo8;
 		ic->arg[1] = (size_t)&cpu->cd.sh.r[r8];	/* n */
 		if (lo8 == 0)
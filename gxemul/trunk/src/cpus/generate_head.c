@@ -140,14 +140,9 @@ int main(int argc, char *argv[])
 	printf("\tcpu->ninstrs --;\n");
 	printf("}\n\n");
 
-	/*  Ugly special hacks for SH[34]:  */
-	if (strcasecmp(argv[1], "sh") == 0) {
-	        printf("static struct %s_instr_call nothing_call = { "
-		    "instr(nothing), {0,0} };\n", a);
-	} else {
-	        printf("static struct %s_instr_call nothing_call = { "
-		    "instr(nothing), {0,0,0} };\n", a);
-	}
+	/*  The number of args differs between architectures:  */
+	printf("static struct %s_instr_call nothing_call = { "
+	    "instr(nothing), {0} };\n", a);
 
 	printf("\n");
 
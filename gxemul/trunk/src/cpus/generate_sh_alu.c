@@ -0,0 +1,131 @@
+/*
+ *  Copyright (C) 2021  Anders Gavare.  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ *  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ *  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ *  OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ *  OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ *  SUCH DAMAGE.
+ */
+
+/*
+ *  Generate register-specialized versions of simple SuperH ALU
+ *  instructions. With the register numbers built into the function, no
+ *  pointers need to be loaded from ic->arg[].
+ *
+ *  NOTE: Unlike the PowerPC ALU table, this selection has not been checked
+ *  against instruction counts of real SuperH code (-s i:filename); it is
+ *  simply the register-to-register and immediate forms that show up in
+ *  typical compiled loops.
+ *
+ *  The tables are indexed by 16 * m + n, or just n for the immediate forms.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+
+#define	N_OPS		6
+
+static const char *op_names[N_OPS] = { "mov_rm_rn", "add_rm_rn", "tst_rm_rn",
+	"cmpeq_rm_rn", "add_imm_rn", "mov_imm_rn" };
+
+
+/*  Only the first four ops have an Rm register operand:  */
+#define	has_rm(op)	((op) < 4)
+
+
+static void print_function_name(int op, int m, int n)
+{
+	if (has_rm(op))
+		printf("%s_%i_%i", op_names[op], m, n);
+	else
+		printf("%s_%i", op_names[op], n);
+}
+
+
+static void print_set_t(const char *cond)
+{
+	printf("\tif (%s)\n\t\tcpu->cd.sh.sr |= SH_SR_T;\n", cond);
+	printf("\telse\n\t\tcpu->cd.sh.sr &= ~SH_SR_T;\n");
+}
+
+
+static void alu(int op, int m, int n)
+{
+	char cond[100];
+
+	printf("X(");
+	print_function_name(op, m, n);
+	printf(")\n{\n");
+
+	switch (op) {
+	case 0:	printf("\tcpu->cd.sh.r[%i] = cpu->cd.sh.r[%i];\n", n, m);
+		break;
+	case 1:	printf("\tcpu->cd.sh.r[%i] += cpu->cd.sh.r[%i];\n", n, m);
+		break;
+	case 2:	snprintf(cond, sizeof(cond), "(cpu->cd.sh.r[%i] & "
+		    "cpu->cd.sh.r[%i]) == 0", n, m);
+		print_set_t(cond);
+		break;
+	case 3:	snprintf(cond, sizeof(cond), "cpu->cd.sh.r[%i] == "
+		    "cpu->cd.sh.r[%i]", n, m);
+		print_set_t(cond);
+		break;
+	case 4:	printf("\tcpu->cd.sh.r[%i] += ic->arg[0];\n", n);
+		break;
+	case 5:	printf("\tcpu->cd.sh.r[%i] = ic->arg[0];\n", n);
+		break;
+	}
+
+	printf("}\n\n");
+}
+
+
+int main(int argc, char *argv[])
+{
+	int op, m, n;
+
+	printf("\n/*  AUTOMATICALLY GENERATED! Do not edit.  */\n\n");
+
+	for (op = 0; op < N_OPS; op++)
+		for (m = 0; m < (has_rm(op)? 16 : 1); m++)
+			for (n = 0; n < 16; n++)
+				alu(op, m, n);
+
+	/*  Arrays of pointers to all the functions:  */
+	for (op = 0; op < N_OPS; op++) {
+		printf("\nvoid (*sh_alu_%s[%i])(struct cpu *, struct "
+		    "sh_instr_call *) = {\n", op_names[op],
+		    has_rm(op)? 256 : 16);
+
+		for (m = 0; m < (has_rm(op)? 16 : 1); m++)
+			for (n = 0; n < 16; n++) {
+				if (m || n)
+					printf(",\n");
+				printf("sh_instr_");
+				print_function_name(op, m, n);
+			}
+
+		printf(" };\n");
+	}
+
+	return 0;
+}
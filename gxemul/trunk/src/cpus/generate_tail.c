@@ -128,6 +128,12 @@ int main(int argc, char *argv[])
 	printf("#define MODE_int_t int32_t\n");
 	printf("#endif\n");
 	printf("#define COMBINE(n) %s_combine_ ## n\n", a);
+	printf("#define DYNTRANS_HOST_PAGE %s_host_page\n", a);
+	printf("#define DYNTRANS_BULK_MEMSET %s_bulk_memset\n", a);
+	printf("#define DYNTRANS_BULK_MEMCPY %s_bulk_memcpy\n", a);
+	printf("#define DYNTRANS_BULK_MEMORY\n");
+	printf("#include \"cpu_dyntrans.c\"\n");
+	printf("#undef DYNTRANS_BULK_MEMORY\n");
 	printf("#include \"quick_pc_to_pointers.h\"\n");
 	printf("#include \"cpu_%s_instr.c\"\n\n", a);
 
@@ -181,6 +187,15 @@ int main(int argc, char *argv[])
 	printf("#undef DYNTRANS_PC_TO_POINTERS_GENERIC\n\n");
 	printf("#undef COMBINE\n");
 	printf("#define COMBINE(n) %s32_combine_ ## n\n", a);
+	printf("#undef DYNTRANS_HOST_PAGE\n"
+	    "#define DYNTRANS_HOST_PAGE %s32_host_page\n", a);
+	printf("#undef DYNTRANS_BULK_MEMSET\n"
+	    "#define DYNTRANS_BULK_MEMSET %s32_bulk_memset\n", a);
+	printf("#undef DYNTRANS_BULK_MEMCPY\n"
+	    "#define DYNTRANS_BULK_MEMCPY %s32_bulk_memcpy\n", a);
+	printf("#define DYNTRANS_BULK_MEMORY\n");
+	printf("#include \"cpu_dyntrans.c\"\n");
+	printf("#undef DYNTRANS_BULK_MEMORY\n");
 	printf("#include \"quick_pc_to_pointers.h\"\n");
 	printf("#include \"cpu_%s_instr.c\"\n", a);
 
@@ -94,6 +94,69 @@ void m8820x_mark_page_as_modified(struct cpu *cpu,
 }
 
 
+/*
+ *  m8820x_patc_lookup():
+ *
+ *  Returns the index of the valid PATC entry matching a virtual address and
+ *  supervisor/user mode, or -1 if there is no such entry.
+ */
+int m8820x_patc_lookup(struct m8820x_cmmu *cmmu, uint32_t vaddr,
+	int supervisor)
+{
+	uint32_t s = supervisor? M8820X_PATC_SUPERVISOR_BIT : 0;
+	int i = cmmu->patc_hash[M8820X_PATC_HASH(vaddr, s)];
+
+	vaddr &= 0xfffff000;
+
+	while (i != 0) {
+		uint32_t vaddr_and_control = cmmu->patc_v_and_control[i - 1];
+
+		if ((vaddr_and_control & PG_V) &&
+		    (vaddr_and_control & 0xfffff000) == vaddr &&
+		    (cmmu->patc_p_and_supervisorbit[i - 1] &
+		    M8820X_PATC_SUPERVISOR_BIT) == s)
+			return i - 1;
+
+		i = cmmu->patc_hash_next[i - 1];
+	}
+
+	return -1;
+}
+
+
+/*
+ *  m8820x_patc_set_entry():
+ *
+ *  Overwrite a PATC entry, and move it to the hash chain for its new
+ *  virtual page number and supervisor bit.
+ */
+static void m8820x_patc_set_entry(struct m8820x_cmmu *cmmu, int i,
+	uint32_t vaddr_and_control, uint32_t paddr_and_sbit)
+{
+	uint8_t *linkp = &cmmu->patc_hash[M8820X_PATC_HASH(
+	    cmmu->patc_v_and_control[i], cmmu->patc_p_and_supervisorbit[i]
+	    & M8820X_PATC_SUPERVISOR_BIT)];
+
+	/*  Unlink the entry from its old chain (if it was linked):  */
+	while (*linkp != 0) {
+		if (*linkp == i + 1) {
+			*linkp = cmmu->patc_hash_next[i];
+			break;
+		}
+		linkp = &cmmu->patc_hash_next[*linkp - 1];
+	}
+
+	cmmu->patc_v_and_control[i] = vaddr_and_control;
+	cmmu->patc_p_and_supervisorbit[i] = paddr_and_sbit;
+
+	/*  ... and insert it first in the new chain:  */
+	linkp = &cmmu->patc_hash[M8820X_PATC_HASH(vaddr_and_control,
+	    paddr_and_sbit & M8820X_PATC_SUPERVISOR_BIT)];
+	cmmu->patc_hash_next[i] = *linkp;
+	*linkp = i + 1;
+}
+
+
 /*
  *  m88k_translate_v2p():
  *
@@ -186,25 +249,15 @@ int m88k_translate_v2p(struct cpu *cpu, uint64_t vaddr64,
 	 *  4 KB pages. If writeflag is set, and a PATC entry is found without
 	 *  the Modified bit set, a page table search must be performed to
 	 *  set the Modified bit in emulated memory.
+	 *
+	 *  The entries are found via a hash index (see cpu_m88k.h), instead
+	 *  of scanning all of them.
 	 */
-	for (i=0; i<N_M88200_PATC_ENTRIES; i++) {
+	i = m8820x_patc_lookup(cmmu, vaddr, supervisor);
+	if (i >= 0) {
 		uint32_t vaddr_and_control = cmmu->patc_v_and_control[i];
 		uint32_t paddr_and_sbit = cmmu->patc_p_and_supervisorbit[i];
 
-		/*  Skip this entry if the valid bit isn't set:  */
-		if (!(vaddr_and_control & PG_V))
-			continue;
-
-		/*  ... or the virtual addresses don't match:  */
-		if ((vaddr & 0xfffff000) != (vaddr_and_control & 0xfffff000))
-			continue;
-
-		/*  ... or if the supervisor bit doesn't match:  */
-		if (((paddr_and_sbit & M8820X_PATC_SUPERVISOR_BIT)
-		    && !supervisor) || (supervisor &&
-		    !(paddr_and_sbit & M8820X_PATC_SUPERVISOR_BIT)))
-			continue;
-
 		/*  A matching PATC entry was found!  */
 
 		/*  Is it write protected?  */
@@ -328,11 +381,10 @@ int m88k_translate_v2p(struct cpu *cpu, uint64_t vaddr64,
 		/*  ... and write the new one:  */
 		cmmu->patc_update_index ++;
 		cmmu->patc_update_index %= N_M88200_PATC_ENTRIES;
-		cmmu->patc_v_and_control[i] =
-		    (vaddr & 0xfffff000) | accumulated_flags | PG_V;
-		cmmu->patc_p_and_supervisorbit[i] =
+		m8820x_patc_set_entry(cmmu, i,
+		    (vaddr & 0xfffff000) | accumulated_flags | PG_V,
 		    (page_descriptor & 0xfffff000) |
-		    (supervisor? M8820X_PATC_SUPERVISOR_BIT : 0);
+		    (supervisor? M8820X_PATC_SUPERVISOR_BIT : 0));
 	}
 
 	/*  Check for writes to read-only pages:  */
@@ -29,6 +29,35 @@
  */
 
 
+/*
+ *  ppc_decode_bats():
+ *
+ *  Pre-decode the 4 instruction and 4 data BAT pairs into simple range
+ *  checks. This is done lazily, after any BAT register has been changed.
+ */
+static void ppc_decode_bats(struct cpu *cpu)
+{
+	int i;
+
+	for (i=0; i<8; i++) {
+		struct ppc_decoded_bat *bat = &cpu->cd.ppc.decoded_bat[i];
+		int regnr = SPR_IBAT0U + i * 2;
+		uint32_t upper = cpu->cd.ppc.spr[regnr];
+		uint32_t lower = cpu->cd.ppc.spr[regnr + 1];
+		uint32_t mask = ((upper & BAT_BL) << 15) | 0x1ffff;
+
+		bat->vmask = ~mask;
+		bat->vbase = upper & BAT_EPI & ~mask;
+		bat->pbase = lower & BAT_RPN & ~mask;
+		bat->valid[0] = upper & BAT_Vs? 1 : 0;
+		bat->valid[1] = upper & BAT_Vu? 1 : 0;
+		bat->pp = lower & BAT_PP;
+	}
+
+	cpu->cd.ppc.decoded_bat_ok = true;
+}
+
+
 /*
  *  ppc_bat():
  *
@@ -38,7 +67,7 @@
 int ppc_bat(struct cpu *cpu, uint64_t vaddr, uint64_t *return_paddr, int flags,
 	int user)
 {
-	int i, istart = 0, iend = 8, pp;
+	int i, istart = 0, iend = 8;
 
 	if (flags & FLAG_INSTR)
 		iend = 4;
@@ -54,28 +83,20 @@ int ppc_bat(struct cpu *cpu, uint64_t vaddr, uint64_t *return_paddr, int flags,
 		exit(1);
 	}
 
+	if (!cpu->cd.ppc.decoded_bat_ok)
+		ppc_decode_bats(cpu);
+
 	/*  Scan either the 4 instruction BATs or the 4 data BATs:  */
 	for (i=istart; i<iend; i++) {
-		int regnr = SPR_IBAT0U + i * 2;
-		uint32_t upper = cpu->cd.ppc.spr[regnr];
-		uint32_t lower = cpu->cd.ppc.spr[regnr + 1];
-		uint32_t phys = lower & BAT_RPN, ebs = upper & BAT_EPI;
-		uint32_t mask = ((upper & BAT_BL) << 15) | 0x1ffff;
-
-		/*  Not valid in either supervisor or user mode?  */
-		if (user && !(upper & BAT_Vu))
-			continue;
-		if (!user && !(upper & BAT_Vs))
-			continue;
+		struct ppc_decoded_bat *bat = &cpu->cd.ppc.decoded_bat[i];
 
-		/*  Virtual address mismatch? Then skip.  */
-		if ((vaddr & ~mask) != (ebs & ~mask))
+		/*  Not valid in this mode, or virtual address mismatch?  */
+		if (!bat->valid[user] || (vaddr & bat->vmask) != bat->vbase)
 			continue;
 
-		*return_paddr = (vaddr & mask) | (phys & ~mask);
+		*return_paddr = (vaddr & ~bat->vmask) | bat->pbase;
 
-		pp = lower & BAT_PP;
-		switch (pp) {
+		switch (bat->pp) {
 		case BAT_PP_NONE:
 			return 0;
 		case BAT_PP_RO_S:
@@ -90,6 +111,31 @@ int ppc_bat(struct cpu *cpu, uint64_t vaddr, uint64_t *return_paddr, int flags,
 }
 
 
+/*
+ *  ppc_pte_cache_invalidate():
+ *
+ *  Called from the generic dyntrans translation cache invalidation code.
+ *  tlbie invalidates one page index (in all segments), and INVALIDATE_ALL
+ *  (tlbia, SDR1 and BAT writes, etc.) invalidates everything. Segment
+ *  register writes (INVALIDATE_VADDR_UPPER4) leave the cache alone, as it
+ *  is tagged by VSID.
+ */
+void ppc_pte_cache_invalidate(struct cpu *cpu, uint64_t vaddr, int flags)
+{
+	if (flags & INVALIDATE_VADDR_UPPER4)
+		return;
+
+	if (flags & INVALIDATE_ALL) {
+		memset(cpu->cd.ppc.pte_cache, 0, sizeof(cpu->cd.ppc.pte_cache));
+		cpu->cd.ppc.decoded_bat_ok = false;
+		return;
+	}
+
+	if (flags & INVALIDATE_VADDR)
+		cpu->cd.ppc.pte_cache[PPC_PTE_CACHE_INDEX(vaddr)].tag = 0;
+}
+
+
 /*
  *  get_pte_low():
  *
@@ -141,6 +187,17 @@ static int ppc_vtp32(struct cpu *cpu, uint32_t vaddr, uint64_t *return_paddr,
 	uint64_t sdr1 = cpu->cd.ppc.spr[SPR_SDR1], htaborg;
 	uint32_t hash1, hash2, pteg_select, tmp;
 	uint32_t lower_pte = 0, cmp;
+	struct ppc_pte_cache_entry *cached =
+	    &cpu->cd.ppc.pte_cache[PPC_PTE_CACHE_INDEX(vaddr)];
+	uint64_t tag = PPC_PTE_CACHE_TAG(vsid, vaddr);
+
+	*resp = 0;
+
+	/*  Found in the software TLB? Then skip the page table walk.  */
+	if (cached->tag == tag) {
+		lower_pte = cached->lower_pte;
+		goto found;
+	}
 
 	htaborg = sdr1 & 0xffff0000UL;
 
@@ -167,11 +224,13 @@ static int ppc_vtp32(struct cpu *cpu, uint32_t vaddr, uint64_t *return_paddr,
 		match = get_pte_low(cpu, pteg_select, &lower_pte, cmp);
 	}
 
-	*resp = 0;
-
 	if (!match)
 		return 0;
 
+	cached->tag = tag;
+	cached->lower_pte = lower_pte;
+
+found:
 	/*  Non-executable, or Guarded page?  */
 	if (instr && cpu->cd.ppc.sr[srn] & SR_NOEXEC)
 		return 1;
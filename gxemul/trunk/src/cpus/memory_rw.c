@@ -393,6 +393,11 @@ not just the device in question.
 		exit(1);
 	}
 
+	/*  Writes clear all LL/SC reservations on the same granule:  */
+	if (writeflag == MEM_WRITE && cpu->machine->n_reservations > 0)
+		cpu_reservation_invalidate(cpu->machine, memblock + offset,
+		    vaddr, len);
+
 	/*  And finally, read or write the data:  */
 	if (writeflag == MEM_WRITE)
 		memcpy(memblock + offset, data, len);
@@ -38,12 +38,50 @@
 #include "thirdparty/sh4_mmu.h"
 
 
+/*
+ *  tlb_entry_matches():
+ *
+ *  Returns true if a TLB entry (hi, lo) is valid and matches vaddr. If so,
+ *  *maskp is set to the page mask of the entry.
+ */
+static inline bool tlb_entry_matches(uint32_t hi, uint32_t lo, uint32_t vaddr,
+	int require_asid_match, int cur_asid, uint32_t *maskp)
+{
+	uint32_t mask = 0xfff00000;
+
+	if (!(lo & SH4_PTEL_V))
+		return false;
+
+	switch (lo & SH4_PTEL_SZ_MASK) {
+	case SH4_PTEL_SZ_1K:  mask = 0xfffffc00; break;
+	case SH4_PTEL_SZ_4K:  mask = 0xfffff000; break;
+	case SH4_PTEL_SZ_64K: mask = 0xffff0000; break;
+	/*  case SH4_PTEL_SZ_1M:  mask = 0xfff00000; break;  */
+	}
+
+	if ((hi & mask) != (vaddr & mask))
+		return false;
+
+	if (!(lo & SH4_PTEL_SH) && require_asid_match &&
+	    (int)(hi & SH4_PTEH_ASID_MASK) != cur_asid)
+		return false;
+
+	/*  Note/TODO: Check for multiple matches is not implemented. */
+
+	*maskp = mask;
+	return true;
+}
+
+
 /*
  *  translate_via_mmu():
  *
- *  Scan the UTLB for a matching virtual address. If a match was found, then
- *  check permission bits etc. If everything was ok, then return the physical
- *  page address, otherwise cause an exception.
+ *  Look up a matching virtual address; for instruction fetches, the ITLB is
+ *  scanned first. Then the UTLB entry pointed to by the lookup hint for the
+ *  virtual page is tried, and only if that doesn't match is the entire UTLB
+ *  scanned. If a match was found, then check permission bits etc. If
+ *  everything was ok, then return the physical page address, otherwise cause
+ *  an exception.
  *
  *  The implementation should (hopefully) be quite complete, except for lack
  *  of "Multiple matching entries" detection. (On a real CPU, these would
@@ -56,12 +94,10 @@ static int translate_via_mmu(struct cpu *cpu, uint32_t vaddr,
 {
 	int wf = flags & FLAG_WRITEFLAG;
 	int i, urb, urc, require_asid_match, cur_asid, expevt = 0;
-	uint32_t hi, lo = 0, mask = 0;
-	int sh;		/*  Shared  */
+	uint32_t lo = 0, mask = 0;
+	uint8_t *hint;
 	int d;		/*  Dirty bit  */
-	int v;		/*  Valid bit  */
 	int pr;		/*  Protection  */
-	int i_start;
 
 	cur_asid = cpu->cd.sh.pteh & SH4_PTEH_ASID_MASK;
 	require_asid_match = !(cpu->cd.sh.mmucr & SH4_MMUCR_SV)
@@ -92,54 +128,42 @@ static int translate_via_mmu(struct cpu *cpu, uint32_t vaddr,
 
 	/*
 	 *  When doing Instruction lookups, the ITLB should be scanned first.
-	 *  This is done by using negative i. (Ugly hack, but works.)
+	 *  A match in the ITLB is indicated by negative i.
 	 */
-	if (flags & FLAG_INSTR)
-		i_start = -SH_N_ITLB_ENTRIES;
-	else
-		i_start = 0;
-
-	for (i=i_start; i<SH_N_UTLB_ENTRIES; i++) {
-		if (i<0) {
-			hi = cpu->cd.sh.itlb_hi[i + SH_N_ITLB_ENTRIES];
-			lo = cpu->cd.sh.itlb_lo[i + SH_N_ITLB_ENTRIES];
-		} else {
-			hi = cpu->cd.sh.utlb_hi[i];
-			lo = cpu->cd.sh.utlb_lo[i];
-		}
-		mask = 0xfff00000;
-
-		v = lo & SH4_PTEL_V;
-		if (!v)
-			continue;
-
-		switch (lo & SH4_PTEL_SZ_MASK) {
-		case SH4_PTEL_SZ_1K:  mask = 0xfffffc00; break;
-		case SH4_PTEL_SZ_4K:  mask = 0xfffff000; break;
-		case SH4_PTEL_SZ_64K: mask = 0xffff0000; break;
-		/*  case SH4_PTEL_SZ_1M:  mask = 0xfff00000; break;  */
+	if (flags & FLAG_INSTR) {
+		for (i=0; i<SH_N_ITLB_ENTRIES; i++) {
+			lo = cpu->cd.sh.itlb_lo[i];
+			if (tlb_entry_matches(cpu->cd.sh.itlb_hi[i], lo, vaddr,
+			    require_asid_match, cur_asid, &mask)) {
+				i -= SH_N_ITLB_ENTRIES;
+				goto found;
+			}
 		}
+	}
 
-		if ((hi & mask) != (vaddr & mask))
-			continue;
-
-		sh = lo & SH4_PTEL_SH;
+	/*  Try the UTLB entry which matched this page last time:  */
+	hint = &cpu->cd.sh.utlb_hint[SH_UTLB_HINT_INDEX(vaddr, cur_asid)];
+	if (*hint != 0) {
+		i = *hint - 1;
+		lo = cpu->cd.sh.utlb_lo[i];
+		if (tlb_entry_matches(cpu->cd.sh.utlb_hi[i], lo, vaddr,
+		    require_asid_match, cur_asid, &mask))
+			goto found;
+	}
 
-		if (!sh && require_asid_match) {
-			int asid = hi & SH4_PTEH_ASID_MASK;
-			if (asid != cur_asid)
-				continue;
+	for (i=0; i<SH_N_UTLB_ENTRIES; i++) {
+		lo = cpu->cd.sh.utlb_lo[i];
+		if (tlb_entry_matches(cpu->cd.sh.utlb_hi[i], lo, vaddr,
+		    require_asid_match, cur_asid, &mask)) {
+			*hint = i + 1;
+			goto found;
 		}
-
-		/*  Note/TODO: Check for multiple matches is not implemented. */
-
-		break;
 	}
 
 	/*  Virtual address not found? Then it's a TLB miss.  */
-	if (i == SH_N_UTLB_ENTRIES)
-		goto tlb_miss;
+	goto tlb_miss;
 
+found:
 	/*  Matching address found! Let's see whether it is
 	    readable/writable, etc.:  */
 	d = lo & SH4_PTEL_D? 1 : 0;
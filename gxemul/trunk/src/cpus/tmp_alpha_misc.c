@@ -0,0 +1,4119 @@
+
+/*  AUTOMATICALLY GENERATED! Do not edit.  */
+
+#define ALU_N alpha_instr_addl
+#define ALU_LONG
+#define ALU_ADD
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_LONG
+#undef ALU_ADD
+#undef ALU_N
+#define ALU_N alpha_instr_subl
+#define ALU_LONG
+#define ALU_SUB
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_LONG
+#undef ALU_SUB
+#undef ALU_N
+#define ALU_N alpha_instr_s4addl
+#define ALU_LONG
+#define ALU_ADD
+#define ALU_S4
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_LONG
+#undef ALU_ADD
+#undef ALU_S4
+#undef ALU_N
+#define ALU_N alpha_instr_s4subl
+#define ALU_LONG
+#define ALU_SUB
+#define ALU_S4
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_LONG
+#undef ALU_SUB
+#undef ALU_S4
+#undef ALU_N
+#define ALU_N alpha_instr_s8addl
+#define ALU_LONG
+#define ALU_ADD
+#define ALU_S8
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_LONG
+#undef ALU_ADD
+#undef ALU_S8
+#undef ALU_N
+#define ALU_N alpha_instr_s8subl
+#define ALU_LONG
+#define ALU_SUB
+#define ALU_S8
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_LONG
+#undef ALU_SUB
+#undef ALU_S8
+#undef ALU_N
+#define ALU_N alpha_instr_addq
+#define ALU_ADD
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_ADD
+#undef ALU_N
+#define ALU_N alpha_instr_subq
+#define ALU_SUB
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_SUB
+#undef ALU_N
+#define ALU_N alpha_instr_s4addq
+#define ALU_ADD
+#define ALU_S4
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_ADD
+#undef ALU_S4
+#undef ALU_N
+#define ALU_N alpha_instr_s4subq
+#define ALU_SUB
+#define ALU_S4
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_SUB
+#undef ALU_S4
+#undef ALU_N
+#define ALU_N alpha_instr_s8addq
+#define ALU_ADD
+#define ALU_S8
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_ADD
+#undef ALU_S8
+#undef ALU_N
+#define ALU_N alpha_instr_s8subq
+#define ALU_SUB
+#define ALU_S8
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_SUB
+#undef ALU_S8
+#undef ALU_N
+#define ALU_N alpha_instr_addl_imm
+#define ALU_IMM
+#define ALU_LONG
+#define ALU_ADD
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_IMM
+#undef ALU_LONG
+#undef ALU_ADD
+#undef ALU_N
+#define ALU_N alpha_instr_subl_imm
+#define ALU_IMM
+#define ALU_LONG
+#define ALU_SUB
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_IMM
+#undef ALU_LONG
+#undef ALU_SUB
+#undef ALU_N
+#define ALU_N alpha_instr_s4addl_imm
+#define ALU_IMM
+#define ALU_LONG
+#define ALU_ADD
+#define ALU_S4
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_IMM
+#undef ALU_LONG
+#undef ALU_ADD
+#undef ALU_S4
+#undef ALU_N
+#define ALU_N alpha_instr_s4subl_imm
+#define ALU_IMM
+#define ALU_LONG
+#define ALU_SUB
+#define ALU_S4
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_IMM
+#undef ALU_LONG
+#undef ALU_SUB
+#undef ALU_S4
+#undef ALU_N
+#define ALU_N alpha_instr_s8addl_imm
+#define ALU_IMM
+#define ALU_LONG
+#define ALU_ADD
+#define ALU_S8
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_IMM
+#undef ALU_LONG
+#undef ALU_ADD
+#undef ALU_S8
+#undef ALU_N
+#define ALU_N alpha_instr_s8subl_imm
+#define ALU_IMM
+#define ALU_LONG
+#define ALU_SUB
+#define ALU_S8
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_IMM
+#undef ALU_LONG
+#undef ALU_SUB
+#undef ALU_S8
+#undef ALU_N
+#define ALU_N alpha_instr_addq_imm
+#define ALU_IMM
+#define ALU_ADD
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_IMM
+#undef ALU_ADD
+#undef ALU_N
+#define ALU_N alpha_instr_subq_imm
+#define ALU_IMM
+#define ALU_SUB
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_IMM
+#undef ALU_SUB
+#undef ALU_N
+#define ALU_N alpha_instr_s4addq_imm
+#define ALU_IMM
+#define ALU_ADD
+#define ALU_S4
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_IMM
+#undef ALU_ADD
+#undef ALU_S4
+#undef ALU_N
+#define ALU_N alpha_instr_s4subq_imm
+#define ALU_IMM
+#define ALU_SUB
+#define ALU_S4
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_IMM
+#undef ALU_SUB
+#undef ALU_S4
+#undef ALU_N
+#define ALU_N alpha_instr_s8addq_imm
+#define ALU_IMM
+#define ALU_ADD
+#define ALU_S8
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_IMM
+#undef ALU_ADD
+#undef ALU_S8
+#undef ALU_N
+#define ALU_N alpha_instr_s8subq_imm
+#define ALU_IMM
+#define ALU_SUB
+#define ALU_S8
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_IMM
+#undef ALU_SUB
+#undef ALU_S8
+#undef ALU_N
+#define ALU_N alpha_instr_and
+#define ALU_AND
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_AND
+#undef ALU_N
+#define ALU_N alpha_instr_or
+#define ALU_OR
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_OR
+#undef ALU_N
+#define ALU_N alpha_instr_xor
+#define ALU_XOR
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_XOR
+#undef ALU_N
+#define ALU_N alpha_instr_zap
+#define ALU_ZAP
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_ZAP
+#undef ALU_N
+#define ALU_N alpha_instr_sll
+#define ALU_SLL
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_SLL
+#undef ALU_N
+#define ALU_N alpha_instr_srl
+#define ALU_SRL
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_SRL
+#undef ALU_N
+#define ALU_N alpha_instr_sra
+#define ALU_SRA
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_SRA
+#undef ALU_N
+#define ALU_N alpha_instr_andnot
+#define ALU_AND
+#define ALU_NOT
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_NOT
+#undef ALU_AND
+#undef ALU_N
+#define ALU_N alpha_instr_ornot
+#define ALU_OR
+#define ALU_NOT
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_NOT
+#undef ALU_OR
+#undef ALU_N
+#define ALU_N alpha_instr_xornot
+#define ALU_XOR
+#define ALU_NOT
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_NOT
+#undef ALU_XOR
+#undef ALU_N
+#define ALU_N alpha_instr_zapnot
+#define ALU_ZAP
+#define ALU_NOT
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_NOT
+#undef ALU_ZAP
+#undef ALU_N
+#define ALU_N alpha_instr_and_imm
+#define ALU_IMM
+#define ALU_AND
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_IMM
+#undef ALU_AND
+#undef ALU_N
+#define ALU_N alpha_instr_or_imm
+#define ALU_IMM
+#define ALU_OR
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_IMM
+#undef ALU_OR
+#undef ALU_N
+#define ALU_N alpha_instr_xor_imm
+#define ALU_IMM
+#define ALU_XOR
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_IMM
+#undef ALU_XOR
+#undef ALU_N
+#define ALU_N alpha_instr_zap_imm
+#define ALU_IMM
+#define ALU_ZAP
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_IMM
+#undef ALU_ZAP
+#undef ALU_N
+#define ALU_N alpha_instr_sll_imm
+#define ALU_IMM
+#define ALU_SLL
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_IMM
+#undef ALU_SLL
+#undef ALU_N
+#define ALU_N alpha_instr_srl_imm
+#define ALU_IMM
+#define ALU_SRL
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_IMM
+#undef ALU_SRL
+#undef ALU_N
+#define ALU_N alpha_instr_sra_imm
+#define ALU_IMM
+#define ALU_SRA
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_IMM
+#undef ALU_SRA
+#undef ALU_N
+#define ALU_N alpha_instr_andnot_imm
+#define ALU_IMM
+#define ALU_AND
+#define ALU_NOT
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_IMM
+#undef ALU_NOT
+#undef ALU_AND
+#undef ALU_N
+#define ALU_N alpha_instr_ornot_imm
+#define ALU_IMM
+#define ALU_OR
+#define ALU_NOT
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_IMM
+#undef ALU_NOT
+#undef ALU_OR
+#undef ALU_N
+#define ALU_N alpha_instr_xornot_imm
+#define ALU_IMM
+#define ALU_XOR
+#define ALU_NOT
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_IMM
+#undef ALU_NOT
+#undef ALU_XOR
+#undef ALU_N
+#define ALU_N alpha_instr_zapnot_imm
+#define ALU_IMM
+#define ALU_ZAP
+#define ALU_NOT
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_IMM
+#undef ALU_NOT
+#undef ALU_ZAP
+#undef ALU_N
+#define ALU_CMP
+#define ALU_N alpha_instr_cmpult
+#define ALU_UNSIGNED
+#define ALU_CMP_LT
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_UNSIGNED
+#undef ALU_CMP_LT
+#undef ALU_N
+#define ALU_N alpha_instr_cmpeq
+#define ALU_CMP_EQ
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_CMP_EQ
+#undef ALU_N
+#define ALU_N alpha_instr_cmpule
+#define ALU_UNSIGNED
+#define ALU_CMP_LE
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_UNSIGNED
+#undef ALU_CMP_LE
+#undef ALU_N
+#define ALU_N alpha_instr_cmplt
+#define ALU_CMP_LT
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_CMP_LT
+#undef ALU_N
+#define ALU_N alpha_instr_cmple
+#define ALU_CMP_LE
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_CMP_LE
+#undef ALU_N
+#define ALU_N alpha_instr_cmpult_imm
+#define ALU_IMM
+#define ALU_UNSIGNED
+#define ALU_CMP_LT
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_UNSIGNED
+#undef ALU_CMP_LT
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_N alpha_instr_cmpeq_imm
+#define ALU_IMM
+#define ALU_CMP_EQ
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_CMP_EQ
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_N alpha_instr_cmpule_imm
+#define ALU_IMM
+#define ALU_UNSIGNED
+#define ALU_CMP_LE
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_UNSIGNED
+#undef ALU_CMP_LE
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_N alpha_instr_cmplt_imm
+#define ALU_IMM
+#define ALU_CMP_LT
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_CMP_LT
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_N alpha_instr_cmple_imm
+#define ALU_IMM
+#define ALU_CMP_LE
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_CMP_LE
+#undef ALU_IMM
+#undef ALU_N
+#undef ALU_CMP
+#define ALU_CMOV
+#define ALU_N alpha_instr_cmovlbs
+#define ALU_CMOV_lbs
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_CMOV_lbs
+#undef ALU_N
+#define ALU_N alpha_instr_cmovlbc
+#define ALU_CMOV_lbc
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_CMOV_lbc
+#undef ALU_N
+#define ALU_N alpha_instr_cmoveq
+#define ALU_CMOV_eq
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_CMOV_eq
+#undef ALU_N
+#define ALU_N alpha_instr_cmovne
+#define ALU_CMOV_ne
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_CMOV_ne
+#undef ALU_N
+#define ALU_N alpha_instr_cmovlt
+#define ALU_CMOV_lt
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_CMOV_lt
+#undef ALU_N
+#define ALU_N alpha_instr_cmovge
+#define ALU_CMOV_ge
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_CMOV_ge
+#undef ALU_N
+#define ALU_N alpha_instr_cmovle
+#define ALU_CMOV_le
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_CMOV_le
+#undef ALU_N
+#define ALU_N alpha_instr_cmovgt
+#define ALU_CMOV_gt
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_CMOV_gt
+#undef ALU_N
+#define ALU_N alpha_instr_cmovlbs_imm
+#define ALU_IMM
+#define ALU_CMOV_lbs
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_CMOV_lbs
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_N alpha_instr_cmovlbc_imm
+#define ALU_IMM
+#define ALU_CMOV_lbc
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_CMOV_lbc
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_N alpha_instr_cmoveq_imm
+#define ALU_IMM
+#define ALU_CMOV_eq
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_CMOV_eq
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_N alpha_instr_cmovne_imm
+#define ALU_IMM
+#define ALU_CMOV_ne
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_CMOV_ne
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_N alpha_instr_cmovlt_imm
+#define ALU_IMM
+#define ALU_CMOV_lt
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_CMOV_lt
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_N alpha_instr_cmovge_imm
+#define ALU_IMM
+#define ALU_CMOV_ge
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_CMOV_ge
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_N alpha_instr_cmovle_imm
+#define ALU_IMM
+#define ALU_CMOV_le
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_CMOV_le
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_N alpha_instr_cmovgt_imm
+#define ALU_IMM
+#define ALU_CMOV_gt
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_CMOV_gt
+#undef ALU_IMM
+#undef ALU_N
+#undef ALU_CMOV
+#define ALU_CMPBGE
+#define ALU_N alpha_instr_cmpbge
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_N
+#define ALU_N alpha_instr_cmpbge_imm
+#define ALU_IMM
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_IMM
+#undef ALU_N
+#undef ALU_CMPBGE
+#define ALU_MSK
+#define ALU_N alpha_instr_mskwh
+#define ALU_W
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_W
+#undef ALU_MSK
+#undef ALU_N
+#define ALU_MSK
+#define ALU_N alpha_instr_msklh
+#define ALU_L
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_L
+#undef ALU_MSK
+#undef ALU_N
+#define ALU_MSK
+#define ALU_N alpha_instr_mskqh
+#define ALU_Q
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_Q
+#undef ALU_MSK
+#undef ALU_N
+#define ALU_EXT
+#define ALU_N alpha_instr_extwh
+#define ALU_W
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_W
+#undef ALU_EXT
+#undef ALU_N
+#define ALU_EXT
+#define ALU_N alpha_instr_extlh
+#define ALU_L
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_L
+#undef ALU_EXT
+#undef ALU_N
+#define ALU_EXT
+#define ALU_N alpha_instr_extqh
+#define ALU_Q
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_Q
+#undef ALU_EXT
+#undef ALU_N
+#define ALU_INS
+#define ALU_N alpha_instr_inswh
+#define ALU_W
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_W
+#undef ALU_INS
+#undef ALU_N
+#define ALU_INS
+#define ALU_N alpha_instr_inslh
+#define ALU_L
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_L
+#undef ALU_INS
+#undef ALU_N
+#define ALU_INS
+#define ALU_N alpha_instr_insqh
+#define ALU_Q
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_Q
+#undef ALU_INS
+#undef ALU_N
+#define ALU_MSK
+#define ALU_N alpha_instr_mskbl
+#define ALU_B
+#define ALU_LO
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_B
+#undef ALU_MSK
+#undef ALU_LO
+#undef ALU_N
+#define ALU_MSK
+#define ALU_N alpha_instr_mskwl
+#define ALU_W
+#define ALU_LO
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_W
+#undef ALU_MSK
+#undef ALU_LO
+#undef ALU_N
+#define ALU_MSK
+#define ALU_N alpha_instr_mskll
+#define ALU_L
+#define ALU_LO
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_L
+#undef ALU_MSK
+#undef ALU_LO
+#undef ALU_N
+#define ALU_MSK
+#define ALU_N alpha_instr_mskql
+#define ALU_Q
+#define ALU_LO
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_Q
+#undef ALU_MSK
+#undef ALU_LO
+#undef ALU_N
+#define ALU_EXT
+#define ALU_N alpha_instr_extbl
+#define ALU_B
+#define ALU_LO
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_B
+#undef ALU_EXT
+#undef ALU_LO
+#undef ALU_N
+#define ALU_EXT
+#define ALU_N alpha_instr_extwl
+#define ALU_W
+#define ALU_LO
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_W
+#undef ALU_EXT
+#undef ALU_LO
+#undef ALU_N
+#define ALU_EXT
+#define ALU_N alpha_instr_extll
+#define ALU_L
+#define ALU_LO
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_L
+#undef ALU_EXT
+#undef ALU_LO
+#undef ALU_N
+#define ALU_EXT
+#define ALU_N alpha_instr_extql
+#define ALU_Q
+#define ALU_LO
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_Q
+#undef ALU_EXT
+#undef ALU_LO
+#undef ALU_N
+#define ALU_INS
+#define ALU_N alpha_instr_insbl
+#define ALU_B
+#define ALU_LO
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_B
+#undef ALU_INS
+#undef ALU_LO
+#undef ALU_N
+#define ALU_INS
+#define ALU_N alpha_instr_inswl
+#define ALU_W
+#define ALU_LO
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_W
+#undef ALU_INS
+#undef ALU_LO
+#undef ALU_N
+#define ALU_INS
+#define ALU_N alpha_instr_insll
+#define ALU_L
+#define ALU_LO
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_L
+#undef ALU_INS
+#undef ALU_LO
+#undef ALU_N
+#define ALU_INS
+#define ALU_N alpha_instr_insql
+#define ALU_Q
+#define ALU_LO
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_Q
+#undef ALU_INS
+#undef ALU_LO
+#undef ALU_N
+#define ALU_MSK
+#define ALU_N alpha_instr_mskwh_imm
+#define ALU_IMM
+#define ALU_W
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_W
+#undef ALU_MSK
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_MSK
+#define ALU_N alpha_instr_msklh_imm
+#define ALU_IMM
+#define ALU_L
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_L
+#undef ALU_MSK
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_MSK
+#define ALU_N alpha_instr_mskqh_imm
+#define ALU_IMM
+#define ALU_Q
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_Q
+#undef ALU_MSK
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_EXT
+#define ALU_N alpha_instr_extwh_imm
+#define ALU_IMM
+#define ALU_W
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_W
+#undef ALU_EXT
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_EXT
+#define ALU_N alpha_instr_extlh_imm
+#define ALU_IMM
+#define ALU_L
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_L
+#undef ALU_EXT
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_EXT
+#define ALU_N alpha_instr_extqh_imm
+#define ALU_IMM
+#define ALU_Q
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_Q
+#undef ALU_EXT
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_INS
+#define ALU_N alpha_instr_inswh_imm
+#define ALU_IMM
+#define ALU_W
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_W
+#undef ALU_INS
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_INS
+#define ALU_N alpha_instr_inslh_imm
+#define ALU_IMM
+#define ALU_L
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_L
+#undef ALU_INS
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_INS
+#define ALU_N alpha_instr_insqh_imm
+#define ALU_IMM
+#define ALU_Q
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_Q
+#undef ALU_INS
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_MSK
+#define ALU_N alpha_instr_mskbl_imm
+#define ALU_IMM
+#define ALU_B
+#define ALU_LO
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_B
+#undef ALU_MSK
+#undef ALU_LO
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_MSK
+#define ALU_N alpha_instr_mskwl_imm
+#define ALU_IMM
+#define ALU_W
+#define ALU_LO
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_W
+#undef ALU_MSK
+#undef ALU_LO
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_MSK
+#define ALU_N alpha_instr_mskll_imm
+#define ALU_IMM
+#define ALU_L
+#define ALU_LO
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_L
+#undef ALU_MSK
+#undef ALU_LO
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_MSK
+#define ALU_N alpha_instr_mskql_imm
+#define ALU_IMM
+#define ALU_Q
+#define ALU_LO
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_Q
+#undef ALU_MSK
+#undef ALU_LO
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_EXT
+#define ALU_N alpha_instr_extbl_imm
+#define ALU_IMM
+#define ALU_B
+#define ALU_LO
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_B
+#undef ALU_EXT
+#undef ALU_LO
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_EXT
+#define ALU_N alpha_instr_extwl_imm
+#define ALU_IMM
+#define ALU_W
+#define ALU_LO
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_W
+#undef ALU_EXT
+#undef ALU_LO
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_EXT
+#define ALU_N alpha_instr_extll_imm
+#define ALU_IMM
+#define ALU_L
+#define ALU_LO
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_L
+#undef ALU_EXT
+#undef ALU_LO
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_EXT
+#define ALU_N alpha_instr_extql_imm
+#define ALU_IMM
+#define ALU_Q
+#define ALU_LO
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_Q
+#undef ALU_EXT
+#undef ALU_LO
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_INS
+#define ALU_N alpha_instr_insbl_imm
+#define ALU_IMM
+#define ALU_B
+#define ALU_LO
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_B
+#undef ALU_INS
+#undef ALU_LO
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_INS
+#define ALU_N alpha_instr_inswl_imm
+#define ALU_IMM
+#define ALU_W
+#define ALU_LO
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_W
+#undef ALU_INS
+#undef ALU_LO
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_INS
+#define ALU_N alpha_instr_insll_imm
+#define ALU_IMM
+#define ALU_L
+#define ALU_LO
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_L
+#undef ALU_INS
+#undef ALU_LO
+#undef ALU_IMM
+#undef ALU_N
+#define ALU_INS
+#define ALU_N alpha_instr_insql_imm
+#define ALU_IMM
+#define ALU_Q
+#define ALU_LO
+#include "cpu_alpha_instr_alu.c"
+#undef ALU_Q
+#undef ALU_INS
+#undef ALU_LO
+#undef ALU_IMM
+#undef ALU_N
+#define LS_B
+#define LS_GENERIC_N alpha_generic_stb
+#define LS_N alpha_instr_stb
+#include "cpu_alpha_instr_loadstore.c"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#define LS_W
+#define LS_GENERIC_N alpha_generic_stw
+#define LS_N alpha_instr_stw
+#include "cpu_alpha_instr_loadstore.c"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#define LS_L
+#define LS_GENERIC_N alpha_generic_stl
+#define LS_N alpha_instr_stl
+#include "cpu_alpha_instr_loadstore.c"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_L
+#define LS_Q
+#define LS_GENERIC_N alpha_generic_stq
+#define LS_N alpha_instr_stq
+#include "cpu_alpha_instr_loadstore.c"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_Q
+#define LS_IGNORE_OFFSET
+#define LS_B
+#define LS_GENERIC_N alpha_generic_stb
+#define LS_N alpha_instr_stb_0
+#include "cpu_alpha_instr_loadstore.c"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_IGNORE_OFFSET
+#define LS_IGNORE_OFFSET
+#define LS_W
+#define LS_GENERIC_N alpha_generic_stw
+#define LS_N alpha_instr_stw_0
+#include "cpu_alpha_instr_loadstore.c"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_IGNORE_OFFSET
+#define LS_IGNORE_OFFSET
+#define LS_L
+#define LS_GENERIC_N alpha_generic_stl
+#define LS_N alpha_instr_stl_0
+#include "cpu_alpha_instr_loadstore.c"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_L
+#undef LS_IGNORE_OFFSET
+#define LS_IGNORE_OFFSET
+#define LS_Q
+#define LS_GENERIC_N alpha_generic_stq
+#define LS_N alpha_instr_stq_0
+#include "cpu_alpha_instr_loadstore.c"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_Q
+#undef LS_IGNORE_OFFSET
+#define LS_LOAD
+#define LS_B
+#define LS_GENERIC_N alpha_generic_ldb
+#define LS_N alpha_instr_ldb
+#include "cpu_alpha_instr_loadstore.c"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_W
+#define LS_GENERIC_N alpha_generic_ldw
+#define LS_N alpha_instr_ldw
+#include "cpu_alpha_instr_loadstore.c"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_L
+#define LS_GENERIC_N alpha_generic_ldl
+#define LS_N alpha_instr_ldl
+#include "cpu_alpha_instr_loadstore.c"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_L
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_Q
+#define LS_GENERIC_N alpha_generic_ldq
+#define LS_N alpha_instr_ldq
+#include "cpu_alpha_instr_loadstore.c"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_Q
+#undef LS_LOAD
+#define LS_IGNORE_OFFSET
+#define LS_LOAD
+#define LS_B
+#define LS_GENERIC_N alpha_generic_ldb
+#define LS_N alpha_instr_ldb_0
+#include "cpu_alpha_instr_loadstore.c"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_LOAD
+#undef LS_IGNORE_OFFSET
+#define LS_IGNORE_OFFSET
+#define LS_LOAD
+#define LS_W
+#define LS_GENERIC_N alpha_generic_ldw
+#define LS_N alpha_instr_ldw_0
+#include "cpu_alpha_instr_loadstore.c"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_LOAD
+#undef LS_IGNORE_OFFSET
+#define LS_IGNORE_OFFSET
+#define LS_LOAD
+#define LS_L
+#define LS_GENERIC_N alpha_generic_ldl
+#define LS_N alpha_instr_ldl_0
+#include "cpu_alpha_instr_loadstore.c"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_L
+#undef LS_LOAD
+#undef LS_IGNORE_OFFSET
+#define LS_IGNORE_OFFSET
+#define LS_LOAD
+#define LS_Q
+#define LS_GENERIC_N alpha_generic_ldq
+#define LS_N alpha_instr_ldq_0
+#include "cpu_alpha_instr_loadstore.c"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_Q
+#undef LS_LOAD
+#undef LS_IGNORE_OFFSET
+#define LS_LLSC
+#define LS_L
+#define LS_GENERIC_N alpha_generic_stl_llsc
+#define LS_N alpha_instr_stl_llsc
+#include "cpu_alpha_instr_loadstore.c"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_L
+#undef LS_LLSC
+#define LS_LLSC
+#define LS_Q
+#define LS_GENERIC_N alpha_generic_stq_llsc
+#define LS_N alpha_instr_stq_llsc
+#include "cpu_alpha_instr_loadstore.c"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_Q
+#undef LS_LLSC
+#define LS_IGNORE_OFFSET
+#define LS_LLSC
+#define LS_L
+#define LS_GENERIC_N alpha_generic_stl_llsc
+#define LS_N alpha_instr_stl_0_llsc
+#include "cpu_alpha_instr_loadstore.c"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_L
+#undef LS_LLSC
+#undef LS_IGNORE_OFFSET
+#define LS_IGNORE_OFFSET
+#define LS_LLSC
+#define LS_Q
+#define LS_GENERIC_N alpha_generic_stq_llsc
+#define LS_N alpha_instr_stq_0_llsc
+#include "cpu_alpha_instr_loadstore.c"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_Q
+#undef LS_LLSC
+#undef LS_IGNORE_OFFSET
+#define LS_LOAD
+#define LS_LLSC
+#define LS_L
+#define LS_GENERIC_N alpha_generic_ldl_llsc
+#define LS_N alpha_instr_ldl_llsc
+#include "cpu_alpha_instr_loadstore.c"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_L
+#undef LS_LOAD
+#undef LS_LLSC
+#define LS_LOAD
+#define LS_LLSC
+#define LS_Q
+#define LS_GENERIC_N alpha_generic_ldq_llsc
+#define LS_N alpha_instr_ldq_llsc
+#include "cpu_alpha_instr_loadstore.c"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_Q
+#undef LS_LOAD
+#undef LS_LLSC
+#define LS_IGNORE_OFFSET
+#define LS_LOAD
+#define LS_LLSC
+#define LS_L
+#define LS_GENERIC_N alpha_generic_ldl_llsc
+#define LS_N alpha_instr_ldl_0_llsc
+#include "cpu_alpha_instr_loadstore.c"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_L
+#undef LS_LOAD
+#undef LS_LLSC
+#undef LS_IGNORE_OFFSET
+#define LS_IGNORE_OFFSET
+#define LS_LOAD
+#define LS_LLSC
+#define LS_Q
+#define LS_GENERIC_N alpha_generic_ldq_llsc
+#define LS_N alpha_instr_ldq_0_llsc
+#include "cpu_alpha_instr_loadstore.c"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_Q
+#undef LS_LOAD
+#undef LS_LLSC
+#undef LS_IGNORE_OFFSET
+#define LS_UNALIGNED
+#define LS_Q
+#define LS_GENERIC_N alpha_generic_stq_u
+#define LS_N alpha_instr_stq_u
+#include "cpu_alpha_instr_loadstore.c"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_Q
+#define LS_LOAD
+#define LS_Q
+#define LS_GENERIC_N alpha_generic_ldq_u
+#define LS_N alpha_instr_ldq_u
+#include "cpu_alpha_instr_loadstore.c"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_Q
+#undef LS_LOAD
+#undef LS_UNALIGNED
+
+
+void (*alpha_loadstore[32])(struct cpu *, struct alpha_instr_call *) = {
+	alpha_instr_stb,
+	alpha_instr_stw,
+	alpha_instr_stl,
+	alpha_instr_stq,
+	alpha_instr_stb_0,
+	alpha_instr_stw_0,
+	alpha_instr_stl_0,
+	alpha_instr_stq_0,
+	alpha_instr_ldb,
+	alpha_instr_ldw,
+	alpha_instr_ldl,
+	alpha_instr_ldq,
+	alpha_instr_ldb_0,
+	alpha_instr_ldw_0,
+	alpha_instr_ldl_0,
+	alpha_instr_ldq_0,
+	alpha_instr_nop,
+	alpha_instr_nop,
+	alpha_instr_stl_llsc,
+	alpha_instr_stq_llsc,
+	alpha_instr_nop,
+	alpha_instr_nop,
+	alpha_instr_stl_0_llsc,
+	alpha_instr_stq_0_llsc,
+	alpha_instr_nop,
+	alpha_instr_nop,
+	alpha_instr_ldl_llsc,
+	alpha_instr_ldq_llsc,
+	alpha_instr_nop,
+	alpha_instr_nop,
+	alpha_instr_ldl_0_llsc,
+	alpha_instr_ldq_0_llsc,
+};
+
+static void alpha_instr_mov_0_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_0_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[0]; }
+static void alpha_instr_mov_1_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_1_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[1]; }
+static void alpha_instr_mov_2_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_2_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[2]; }
+static void alpha_instr_mov_3_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_3_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[3]; }
+static void alpha_instr_mov_4_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_4_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[4]; }
+static void alpha_instr_mov_5_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_5_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[5]; }
+static void alpha_instr_mov_6_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_6_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[6]; }
+static void alpha_instr_mov_7_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_7_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[7]; }
+static void alpha_instr_mov_8_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_8_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[8]; }
+static void alpha_instr_mov_9_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_9_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[9]; }
+static void alpha_instr_mov_10_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_10_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[10]; }
+static void alpha_instr_mov_11_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_11_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[11]; }
+static void alpha_instr_mov_12_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_12_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[12]; }
+static void alpha_instr_mov_13_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_13_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[13]; }
+static void alpha_instr_mov_14_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_14_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[14]; }
+static void alpha_instr_mov_15_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_15_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[15]; }
+static void alpha_instr_mov_16_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_16_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[16]; }
+static void alpha_instr_mov_17_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_17_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[17]; }
+static void alpha_instr_mov_18_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_18_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[18]; }
+static void alpha_instr_mov_19_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_19_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[19]; }
+static void alpha_instr_mov_20_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_20_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[20]; }
+static void alpha_instr_mov_21_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_21_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[21]; }
+static void alpha_instr_mov_22_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_22_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[22]; }
+static void alpha_instr_mov_23_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_23_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[23]; }
+static void alpha_instr_mov_24_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_24_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[24]; }
+static void alpha_instr_mov_25_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_25_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[25]; }
+static void alpha_instr_mov_26_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_26_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[26]; }
+static void alpha_instr_mov_27_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_27_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[27]; }
+static void alpha_instr_mov_28_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_28_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[28]; }
+static void alpha_instr_mov_29_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_29_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = cpu->cd.alpha.r[29]; }
+static void alpha_instr_mov_30_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_30_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = cpu->cd.alpha.r[30]; }
+static void alpha_instr_mov_31_0(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[0] = 0; }
+static void alpha_instr_mov_31_1(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[1] = 0; }
+static void alpha_instr_mov_31_2(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[2] = 0; }
+static void alpha_instr_mov_31_3(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[3] = 0; }
+static void alpha_instr_mov_31_4(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[4] = 0; }
+static void alpha_instr_mov_31_5(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[5] = 0; }
+static void alpha_instr_mov_31_6(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[6] = 0; }
+static void alpha_instr_mov_31_7(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[7] = 0; }
+static void alpha_instr_mov_31_8(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[8] = 0; }
+static void alpha_instr_mov_31_9(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[9] = 0; }
+static void alpha_instr_mov_31_10(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[10] = 0; }
+static void alpha_instr_mov_31_11(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[11] = 0; }
+static void alpha_instr_mov_31_12(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[12] = 0; }
+static void alpha_instr_mov_31_13(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[13] = 0; }
+static void alpha_instr_mov_31_14(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[14] = 0; }
+static void alpha_instr_mov_31_15(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[15] = 0; }
+static void alpha_instr_mov_31_16(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[16] = 0; }
+static void alpha_instr_mov_31_17(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[17] = 0; }
+static void alpha_instr_mov_31_18(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[18] = 0; }
+static void alpha_instr_mov_31_19(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[19] = 0; }
+static void alpha_instr_mov_31_20(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[20] = 0; }
+static void alpha_instr_mov_31_21(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[21] = 0; }
+static void alpha_instr_mov_31_22(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[22] = 0; }
+static void alpha_instr_mov_31_23(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[23] = 0; }
+static void alpha_instr_mov_31_24(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[24] = 0; }
+static void alpha_instr_mov_31_25(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[25] = 0; }
+static void alpha_instr_mov_31_26(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[26] = 0; }
+static void alpha_instr_mov_31_27(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[27] = 0; }
+static void alpha_instr_mov_31_28(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[28] = 0; }
+static void alpha_instr_mov_31_29(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[29] = 0; }
+static void alpha_instr_mov_31_30(struct cpu *cpu, struct alpha_instr_call *ic)
+{ cpu->cd.alpha.r[30] = 0; }
+
+
+void (*alpha_mov_r_r[32*31])(struct cpu *, struct alpha_instr_call *) = {
+	alpha_instr_nop,
+	alpha_instr_mov_1_0,
+	alpha_instr_mov_2_0,
+	alpha_instr_mov_3_0,
+	alpha_instr_mov_4_0,
+	alpha_instr_mov_5_0,
+	alpha_instr_mov_6_0,
+	alpha_instr_mov_7_0,
+	alpha_instr_mov_8_0,
+	alpha_instr_mov_9_0,
+	alpha_instr_mov_10_0,
+	alpha_instr_mov_11_0,
+	alpha_instr_mov_12_0,
+	alpha_instr_mov_13_0,
+	alpha_instr_mov_14_0,
+	alpha_instr_mov_15_0,
+	alpha_instr_mov_16_0,
+	alpha_instr_mov_17_0,
+	alpha_instr_mov_18_0,
+	alpha_instr_mov_19_0,
+	alpha_instr_mov_20_0,
+	alpha_instr_mov_21_0,
+	alpha_instr_mov_22_0,
+	alpha_instr_mov_23_0,
+	alpha_instr_mov_24_0,
+	alpha_instr_mov_25_0,
+	alpha_instr_mov_26_0,
+	alpha_instr_mov_27_0,
+	alpha_instr_mov_28_0,
+	alpha_instr_mov_29_0,
+	alpha_instr_mov_30_0,
+	alpha_instr_mov_31_0,
+	alpha_instr_mov_0_1,
+	alpha_instr_nop,
+	alpha_instr_mov_2_1,
+	alpha_instr_mov_3_1,
+	alpha_instr_mov_4_1,
+	alpha_instr_mov_5_1,
+	alpha_instr_mov_6_1,
+	alpha_instr_mov_7_1,
+	alpha_instr_mov_8_1,
+	alpha_instr_mov_9_1,
+	alpha_instr_mov_10_1,
+	alpha_instr_mov_11_1,
+	alpha_instr_mov_12_1,
+	alpha_instr_mov_13_1,
+	alpha_instr_mov_14_1,
+	alpha_instr_mov_15_1,
+	alpha_instr_mov_16_1,
+	alpha_instr_mov_17_1,
+	alpha_instr_mov_18_1,
+	alpha_instr_mov_19_1,
+	alpha_instr_mov_20_1,
+	alpha_instr_mov_21_1,
+	alpha_instr_mov_22_1,
+	alpha_instr_mov_23_1,
+	alpha_instr_mov_24_1,
+	alpha_instr_mov_25_1,
+	alpha_instr_mov_26_1,
+	alpha_instr_mov_27_1,
+	alpha_instr_mov_28_1,
+	alpha_instr_mov_29_1,
+	alpha_instr_mov_30_1,
+	alpha_instr_mov_31_1,
+	alpha_instr_mov_0_2,
+	alpha_instr_mov_1_2,
+	alpha_instr_nop,
+	alpha_instr_mov_3_2,
+	alpha_instr_mov_4_2,
+	alpha_instr_mov_5_2,
+	alpha_instr_mov_6_2,
+	alpha_instr_mov_7_2,
+	alpha_instr_mov_8_2,
+	alpha_instr_mov_9_2,
+	alpha_instr_mov_10_2,
+	alpha_instr_mov_11_2,
+	alpha_instr_mov_12_2,
+	alpha_instr_mov_13_2,
+	alpha_instr_mov_14_2,
+	alpha_instr_mov_15_2,
+	alpha_instr_mov_16_2,
+	alpha_instr_mov_17_2,
+	alpha_instr_mov_18_2,
+	alpha_instr_mov_19_2,
+	alpha_instr_mov_20_2,
+	alpha_instr_mov_21_2,
+	alpha_instr_mov_22_2,
+	alpha_instr_mov_23_2,
+	alpha_instr_mov_24_2,
+	alpha_instr_mov_25_2,
+	alpha_instr_mov_26_2,
+	alpha_instr_mov_27_2,
+	alpha_instr_mov_28_2,
+	alpha_instr_mov_29_2,
+	alpha_instr_mov_30_2,
+	alpha_instr_mov_31_2,
+	alpha_instr_mov_0_3,
+	alpha_instr_mov_1_3,
+	alpha_instr_mov_2_3,
+	alpha_instr_nop,
+	alpha_instr_mov_4_3,
+	alpha_instr_mov_5_3,
+	alpha_instr_mov_6_3,
+	alpha_instr_mov_7_3,
+	alpha_instr_mov_8_3,
+	alpha_instr_mov_9_3,
+	alpha_instr_mov_10_3,
+	alpha_instr_mov_11_3,
+	alpha_instr_mov_12_3,
+	alpha_instr_mov_13_3,
+	alpha_instr_mov_14_3,
+	alpha_instr_mov_15_3,
+	alpha_instr_mov_16_3,
+	alpha_instr_mov_17_3,
+	alpha_instr_mov_18_3,
+	alpha_instr_mov_19_3,
+	alpha_instr_mov_20_3,
+	alpha_instr_mov_21_3,
+	alpha_instr_mov_22_3,
+	alpha_instr_mov_23_3,
+	alpha_instr_mov_24_3,
+	alpha_instr_mov_25_3,
+	alpha_instr_mov_26_3,
+	alpha_instr_mov_27_3,
+	alpha_instr_mov_28_3,
+	alpha_instr_mov_29_3,
+	alpha_instr_mov_30_3,
+	alpha_instr_mov_31_3,
+	alpha_instr_mov_0_4,
+	alpha_instr_mov_1_4,
+	alpha_instr_mov_2_4,
+	alpha_instr_mov_3_4,
+	alpha_instr_nop,
+	alpha_instr_mov_5_4,
+	alpha_instr_mov_6_4,
+	alpha_instr_mov_7_4,
+	alpha_instr_mov_8_4,
+	alpha_instr_mov_9_4,
+	alpha_instr_mov_10_4,
+	alpha_instr_mov_11_4,
+	alpha_instr_mov_12_4,
+	alpha_instr_mov_13_4,
+	alpha_instr_mov_14_4,
+	alpha_instr_mov_15_4,
+	alpha_instr_mov_16_4,
+	alpha_instr_mov_17_4,
+	alpha_instr_mov_18_4,
+	alpha_instr_mov_19_4,
+	alpha_instr_mov_20_4,
+	alpha_instr_mov_21_4,
+	alpha_instr_mov_22_4,
+	alpha_instr_mov_23_4,
+	alpha_instr_mov_24_4,
+	alpha_instr_mov_25_4,
+	alpha_instr_mov_26_4,
+	alpha_instr_mov_27_4,
+	alpha_instr_mov_28_4,
+	alpha_instr_mov_29_4,
+	alpha_instr_mov_30_4,
+	alpha_instr_mov_31_4,
+	alpha_instr_mov_0_5,
+	alpha_instr_mov_1_5,
+	alpha_instr_mov_2_5,
+	alpha_instr_mov_3_5,
+	alpha_instr_mov_4_5,
+	alpha_instr_nop,
+	alpha_instr_mov_6_5,
+	alpha_instr_mov_7_5,
+	alpha_instr_mov_8_5,
+	alpha_instr_mov_9_5,
+	alpha_instr_mov_10_5,
+	alpha_instr_mov_11_5,
+	alpha_instr_mov_12_5,
+	alpha_instr_mov_13_5,
+	alpha_instr_mov_14_5,
+	alpha_instr_mov_15_5,
+	alpha_instr_mov_16_5,
+	alpha_instr_mov_17_5,
+	alpha_instr_mov_18_5,
+	alpha_instr_mov_19_5,
+	alpha_instr_mov_20_5,
+	alpha_instr_mov_21_5,
+	alpha_instr_mov_22_5,
+	alpha_instr_mov_23_5,
+	alpha_instr_mov_24_5,
+	alpha_instr_mov_25_5,
+	alpha_instr_mov_26_5,
+	alpha_instr_mov_27_5,
+	alpha_instr_mov_28_5,
+	alpha_instr_mov_29_5,
+	alpha_instr_mov_30_5,
+	alpha_instr_mov_31_5,
+	alpha_instr_mov_0_6,
+	alpha_instr_mov_1_6,
+	alpha_instr_mov_2_6,
+	alpha_instr_mov_3_6,
+	alpha_instr_mov_4_6,
+	alpha_instr_mov_5_6,
+	alpha_instr_nop,
+	alpha_instr_mov_7_6,
+	alpha_instr_mov_8_6,
+	alpha_instr_mov_9_6,
+	alpha_instr_mov_10_6,
+	alpha_instr_mov_11_6,
+	alpha_instr_mov_12_6,
+	alpha_instr_mov_13_6,
+	alpha_instr_mov_14_6,
+	alpha_instr_mov_15_6,
+	alpha_instr_mov_16_6,
+	alpha_instr_mov_17_6,
+	alpha_instr_mov_18_6,
+	alpha_instr_mov_19_6,
+	alpha_instr_mov_20_6,
+	alpha_instr_mov_21_6,
+	alpha_instr_mov_22_6,
+	alpha_instr_mov_23_6,
+	alpha_instr_mov_24_6,
+	alpha_instr_mov_25_6,
+	alpha_instr_mov_26_6,
+	alpha_instr_mov_27_6,
+	alpha_instr_mov_28_6,
+	alpha_instr_mov_29_6,
+	alpha_instr_mov_30_6,
+	alpha_instr_mov_31_6,
+	alpha_instr_mov_0_7,
+	alpha_instr_mov_1_7,
+	alpha_instr_mov_2_7,
+	alpha_instr_mov_3_7,
+	alpha_instr_mov_4_7,
+	alpha_instr_mov_5_7,
+	alpha_instr_mov_6_7,
+	alpha_instr_nop,
+	alpha_instr_mov_8_7,
+	alpha_instr_mov_9_7,
+	alpha_instr_mov_10_7,
+	alpha_instr_mov_11_7,
+	alpha_instr_mov_12_7,
+	alpha_instr_mov_13_7,
+	alpha_instr_mov_14_7,
+	alpha_instr_mov_15_7,
+	alpha_instr_mov_16_7,
+	alpha_instr_mov_17_7,
+	alpha_instr_mov_18_7,
+	alpha_instr_mov_19_7,
+	alpha_instr_mov_20_7,
+	alpha_instr_mov_21_7,
+	alpha_instr_mov_22_7,
+	alpha_instr_mov_23_7,
+	alpha_instr_mov_24_7,
+	alpha_instr_mov_25_7,
+	alpha_instr_mov_26_7,
+	alpha_instr_mov_27_7,
+	alpha_instr_mov_28_7,
+	alpha_instr_mov_29_7,
+	alpha_instr_mov_30_7,
+	alpha_instr_mov_31_7,
+	alpha_instr_mov_0_8,
+	alpha_instr_mov_1_8,
+	alpha_instr_mov_2_8,
+	alpha_instr_mov_3_8,
+	alpha_instr_mov_4_8,
+	alpha_instr_mov_5_8,
+	alpha_instr_mov_6_8,
+	alpha_instr_mov_7_8,
+	alpha_instr_nop,
+	alpha_instr_mov_9_8,
+	alpha_instr_mov_10_8,
+	alpha_instr_mov_11_8,
+	alpha_instr_mov_12_8,
+	alpha_instr_mov_13_8,
+	alpha_instr_mov_14_8,
+	alpha_instr_mov_15_8,
+	alpha_instr_mov_16_8,
+	alpha_instr_mov_17_8,
+	alpha_instr_mov_18_8,
+	alpha_instr_mov_19_8,
+	alpha_instr_mov_20_8,
+	alpha_instr_mov_21_8,
+	alpha_instr_mov_22_8,
+	alpha_instr_mov_23_8,
+	alpha_instr_mov_24_8,
+	alpha_instr_mov_25_8,
+	alpha_instr_mov_26_8,
+	alpha_instr_mov_27_8,
+	alpha_instr_mov_28_8,
+	alpha_instr_mov_29_8,
+	alpha_instr_mov_30_8,
+	alpha_instr_mov_31_8,
+	alpha_instr_mov_0_9,
+	alpha_instr_mov_1_9,
+	alpha_instr_mov_2_9,
+	alpha_instr_mov_3_9,
+	alpha_instr_mov_4_9,
+	alpha_instr_mov_5_9,
+	alpha_instr_mov_6_9,
+	alpha_instr_mov_7_9,
+	alpha_instr_mov_8_9,
+	alpha_instr_nop,
+	alpha_instr_mov_10_9,
+	alpha_instr_mov_11_9,
+	alpha_instr_mov_12_9,
+	alpha_instr_mov_13_9,
+	alpha_instr_mov_14_9,
+	alpha_instr_mov_15_9,
+	alpha_instr_mov_16_9,
+	alpha_instr_mov_17_9,
+	alpha_instr_mov_18_9,
+	alpha_instr_mov_19_9,
+	alpha_instr_mov_20_9,
+	alpha_instr_mov_21_9,
+	alpha_instr_mov_22_9,
+	alpha_instr_mov_23_9,
+	alpha_instr_mov_24_9,
+	alpha_instr_mov_25_9,
+	alpha_instr_mov_26_9,
+	alpha_instr_mov_27_9,
+	alpha_instr_mov_28_9,
+	alpha_instr_mov_29_9,
+	alpha_instr_mov_30_9,
+	alpha_instr_mov_31_9,
+	alpha_instr_mov_0_10,
+	alpha_instr_mov_1_10,
+	alpha_instr_mov_2_10,
+	alpha_instr_mov_3_10,
+	alpha_instr_mov_4_10,
+	alpha_instr_mov_5_10,
+	alpha_instr_mov_6_10,
+	alpha_instr_mov_7_10,
+	alpha_instr_mov_8_10,
+	alpha_instr_mov_9_10,
+	alpha_instr_nop,
+	alpha_instr_mov_11_10,
+	alpha_instr_mov_12_10,
+	alpha_instr_mov_13_10,
+	alpha_instr_mov_14_10,
+	alpha_instr_mov_15_10,
+	alpha_instr_mov_16_10,
+	alpha_instr_mov_17_10,
+	alpha_instr_mov_18_10,
+	alpha_instr_mov_19_10,
+	alpha_instr_mov_20_10,
+	alpha_instr_mov_21_10,
+	alpha_instr_mov_22_10,
+	alpha_instr_mov_23_10,
+	alpha_instr_mov_24_10,
+	alpha_instr_mov_25_10,
+	alpha_instr_mov_26_10,
+	alpha_instr_mov_27_10,
+	alpha_instr_mov_28_10,
+	alpha_instr_mov_29_10,
+	alpha_instr_mov_30_10,
+	alpha_instr_mov_31_10,
+	alpha_instr_mov_0_11,
+	alpha_instr_mov_1_11,
+	alpha_instr_mov_2_11,
+	alpha_instr_mov_3_11,
+	alpha_instr_mov_4_11,
+	alpha_instr_mov_5_11,
+	alpha_instr_mov_6_11,
+	alpha_instr_mov_7_11,
+	alpha_instr_mov_8_11,
+	alpha_instr_mov_9_11,
+	alpha_instr_mov_10_11,
+	alpha_instr_nop,
+	alpha_instr_mov_12_11,
+	alpha_instr_mov_13_11,
+	alpha_instr_mov_14_11,
+	alpha_instr_mov_15_11,
+	alpha_instr_mov_16_11,
+	alpha_instr_mov_17_11,
+	alpha_instr_mov_18_11,
+	alpha_instr_mov_19_11,
+	alpha_instr_mov_20_11,
+	alpha_instr_mov_21_11,
+	alpha_instr_mov_22_11,
+	alpha_instr_mov_23_11,
+	alpha_instr_mov_24_11,
+	alpha_instr_mov_25_11,
+	alpha_instr_mov_26_11,
+	alpha_instr_mov_27_11,
+	alpha_instr_mov_28_11,
+	alpha_instr_mov_29_11,
+	alpha_instr_mov_30_11,
+	alpha_instr_mov_31_11,
+	alpha_instr_mov_0_12,
+	alpha_instr_mov_1_12,
+	alpha_instr_mov_2_12,
+	alpha_instr_mov_3_12,
+	alpha_instr_mov_4_12,
+	alpha_instr_mov_5_12,
+	alpha_instr_mov_6_12,
+	alpha_instr_mov_7_12,
+	alpha_instr_mov_8_12,
+	alpha_instr_mov_9_12,
+	alpha_instr_mov_10_12,
+	alpha_instr_mov_11_12,
+	alpha_instr_nop,
+	alpha_instr_mov_13_12,
+	alpha_instr_mov_14_12,
+	alpha_instr_mov_15_12,
+	alpha_instr_mov_16_12,
+	alpha_instr_mov_17_12,
+	alpha_instr_mov_18_12,
+	alpha_instr_mov_19_12,
+	alpha_instr_mov_20_12,
+	alpha_instr_mov_21_12,
+	alpha_instr_mov_22_12,
+	alpha_instr_mov_23_12,
+	alpha_instr_mov_24_12,
+	alpha_instr_mov_25_12,
+	alpha_instr_mov_26_12,
+	alpha_instr_mov_27_12,
+	alpha_instr_mov_28_12,
+	alpha_instr_mov_29_12,
+	alpha_instr_mov_30_12,
+	alpha_instr_mov_31_12,
+	alpha_instr_mov_0_13,
+	alpha_instr_mov_1_13,
+	alpha_instr_mov_2_13,
+	alpha_instr_mov_3_13,
+	alpha_instr_mov_4_13,
+	alpha_instr_mov_5_13,
+	alpha_instr_mov_6_13,
+	alpha_instr_mov_7_13,
+	alpha_instr_mov_8_13,
+	alpha_instr_mov_9_13,
+	alpha_instr_mov_10_13,
+	alpha_instr_mov_11_13,
+	alpha_instr_mov_12_13,
+	alpha_instr_nop,
+	alpha_instr_mov_14_13,
+	alpha_instr_mov_15_13,
+	alpha_instr_mov_16_13,
+	alpha_instr_mov_17_13,
+	alpha_instr_mov_18_13,
+	alpha_instr_mov_19_13,
+	alpha_instr_mov_20_13,
+	alpha_instr_mov_21_13,
+	alpha_instr_mov_22_13,
+	alpha_instr_mov_23_13,
+	alpha_instr_mov_24_13,
+	alpha_instr_mov_25_13,
+	alpha_instr_mov_26_13,
+	alpha_instr_mov_27_13,
+	alpha_instr_mov_28_13,
+	alpha_instr_mov_29_13,
+	alpha_instr_mov_30_13,
+	alpha_instr_mov_31_13,
+	alpha_instr_mov_0_14,
+	alpha_instr_mov_1_14,
+	alpha_instr_mov_2_14,
+	alpha_instr_mov_3_14,
+	alpha_instr_mov_4_14,
+	alpha_instr_mov_5_14,
+	alpha_instr_mov_6_14,
+	alpha_instr_mov_7_14,
+	alpha_instr_mov_8_14,
+	alpha_instr_mov_9_14,
+	alpha_instr_mov_10_14,
+	alpha_instr_mov_11_14,
+	alpha_instr_mov_12_14,
+	alpha_instr_mov_13_14,
+	alpha_instr_nop,
+	alpha_instr_mov_15_14,
+	alpha_instr_mov_16_14,
+	alpha_instr_mov_17_14,
+	alpha_instr_mov_18_14,
+	alpha_instr_mov_19_14,
+	alpha_instr_mov_20_14,
+	alpha_instr_mov_21_14,
+	alpha_instr_mov_22_14,
+	alpha_instr_mov_23_14,
+	alpha_instr_mov_24_14,
+	alpha_instr_mov_25_14,
+	alpha_instr_mov_26_14,
+	alpha_instr_mov_27_14,
+	alpha_instr_mov_28_14,
+	alpha_instr_mov_29_14,
+	alpha_instr_mov_30_14,
+	alpha_instr_mov_31_14,
+	alpha_instr_mov_0_15,
+	alpha_instr_mov_1_15,
+	alpha_instr_mov_2_15,
+	alpha_instr_mov_3_15,
+	alpha_instr_mov_4_15,
+	alpha_instr_mov_5_15,
+	alpha_instr_mov_6_15,
+	alpha_instr_mov_7_15,
+	alpha_instr_mov_8_15,
+	alpha_instr_mov_9_15,
+	alpha_instr_mov_10_15,
+	alpha_instr_mov_11_15,
+	alpha_instr_mov_12_15,
+	alpha_instr_mov_13_15,
+	alpha_instr_mov_14_15,
+	alpha_instr_nop,
+	alpha_instr_mov_16_15,
+	alpha_instr_mov_17_15,
+	alpha_instr_mov_18_15,
+	alpha_instr_mov_19_15,
+	alpha_instr_mov_20_15,
+	alpha_instr_mov_21_15,
+	alpha_instr_mov_22_15,
+	alpha_instr_mov_23_15,
+	alpha_instr_mov_24_15,
+	alpha_instr_mov_25_15,
+	alpha_instr_mov_26_15,
+	alpha_instr_mov_27_15,
+	alpha_instr_mov_28_15,
+	alpha_instr_mov_29_15,
+	alpha_instr_mov_30_15,
+	alpha_instr_mov_31_15,
+	alpha_instr_mov_0_16,
+	alpha_instr_mov_1_16,
+	alpha_instr_mov_2_16,
+	alpha_instr_mov_3_16,
+	alpha_instr_mov_4_16,
+	alpha_instr_mov_5_16,
+	alpha_instr_mov_6_16,
+	alpha_instr_mov_7_16,
+	alpha_instr_mov_8_16,
+	alpha_instr_mov_9_16,
+	alpha_instr_mov_10_16,
+	alpha_instr_mov_11_16,
+	alpha_instr_mov_12_16,
+	alpha_instr_mov_13_16,
+	alpha_instr_mov_14_16,
+	alpha_instr_mov_15_16,
+	alpha_instr_nop,
+	alpha_instr_mov_17_16,
+	alpha_instr_mov_18_16,
+	alpha_instr_mov_19_16,
+	alpha_instr_mov_20_16,
+	alpha_instr_mov_21_16,
+	alpha_instr_mov_22_16,
+	alpha_instr_mov_23_16,
+	alpha_instr_mov_24_16,
+	alpha_instr_mov_25_16,
+	alpha_instr_mov_26_16,
+	alpha_instr_mov_27_16,
+	alpha_instr_mov_28_16,
+	alpha_instr_mov_29_16,
+	alpha_instr_mov_30_16,
+	alpha_instr_mov_31_16,
+	alpha_instr_mov_0_17,
+	alpha_instr_mov_1_17,
+	alpha_instr_mov_2_17,
+	alpha_instr_mov_3_17,
+	alpha_instr_mov_4_17,
+	alpha_instr_mov_5_17,
+	alpha_instr_mov_6_17,
+	alpha_instr_mov_7_17,
+	alpha_instr_mov_8_17,
+	alpha_instr_mov_9_17,
+	alpha_instr_mov_10_17,
+	alpha_instr_mov_11_17,
+	alpha_instr_mov_12_17,
+	alpha_instr_mov_13_17,
+	alpha_instr_mov_14_17,
+	alpha_instr_mov_15_17,
+	alpha_instr_mov_16_17,
+	alpha_instr_nop,
+	alpha_instr_mov_18_17,
+	alpha_instr_mov_19_17,
+	alpha_instr_mov_20_17,
+	alpha_instr_mov_21_17,
+	alpha_instr_mov_22_17,
+	alpha_instr_mov_23_17,
+	alpha_instr_mov_24_17,
+	alpha_instr_mov_25_17,
+	alpha_instr_mov_26_17,
+	alpha_instr_mov_27_17,
+	alpha_instr_mov_28_17,
+	alpha_instr_mov_29_17,
+	alpha_instr_mov_30_17,
+	alpha_instr_mov_31_17,
+	alpha_instr_mov_0_18,
+	alpha_instr_mov_1_18,
+	alpha_instr_mov_2_18,
+	alpha_instr_mov_3_18,
+	alpha_instr_mov_4_18,
+	alpha_instr_mov_5_18,
+	alpha_instr_mov_6_18,
+	alpha_instr_mov_7_18,
+	alpha_instr_mov_8_18,
+	alpha_instr_mov_9_18,
+	alpha_instr_mov_10_18,
+	alpha_instr_mov_11_18,
+	alpha_instr_mov_12_18,
+	alpha_instr_mov_13_18,
+	alpha_instr_mov_14_18,
+	alpha_instr_mov_15_18,
+	alpha_instr_mov_16_18,
+	alpha_instr_mov_17_18,
+	alpha_instr_nop,
+	alpha_instr_mov_19_18,
+	alpha_instr_mov_20_18,
+	alpha_instr_mov_21_18,
+	alpha_instr_mov_22_18,
+	alpha_instr_mov_23_18,
+	alpha_instr_mov_24_18,
+	alpha_instr_mov_25_18,
+	alpha_instr_mov_26_18,
+	alpha_instr_mov_27_18,
+	alpha_instr_mov_28_18,
+	alpha_instr_mov_29_18,
+	alpha_instr_mov_30_18,
+	alpha_instr_mov_31_18,
+	alpha_instr_mov_0_19,
+	alpha_instr_mov_1_19,
+	alpha_instr_mov_2_19,
+	alpha_instr_mov_3_19,
+	alpha_instr_mov_4_19,
+	alpha_instr_mov_5_19,
+	alpha_instr_mov_6_19,
+	alpha_instr_mov_7_19,
+	alpha_instr_mov_8_19,
+	alpha_instr_mov_9_19,
+	alpha_instr_mov_10_19,
+	alpha_instr_mov_11_19,
+	alpha_instr_mov_12_19,
+	alpha_instr_mov_13_19,
+	alpha_instr_mov_14_19,
+	alpha_instr_mov_15_19,
+	alpha_instr_mov_16_19,
+	alpha_instr_mov_17_19,
+	alpha_instr_mov_18_19,
+	alpha_instr_nop,
+	alpha_instr_mov_20_19,
+	alpha_instr_mov_21_19,
+	alpha_instr_mov_22_19,
+	alpha_instr_mov_23_19,
+	alpha_instr_mov_24_19,
+	alpha_instr_mov_25_19,
+	alpha_instr_mov_26_19,
+	alpha_instr_mov_27_19,
+	alpha_instr_mov_28_19,
+	alpha_instr_mov_29_19,
+	alpha_instr_mov_30_19,
+	alpha_instr_mov_31_19,
+	alpha_instr_mov_0_20,
+	alpha_instr_mov_1_20,
+	alpha_instr_mov_2_20,
+	alpha_instr_mov_3_20,
+	alpha_instr_mov_4_20,
+	alpha_instr_mov_5_20,
+	alpha_instr_mov_6_20,
+	alpha_instr_mov_7_20,
+	alpha_instr_mov_8_20,
+	alpha_instr_mov_9_20,
+	alpha_instr_mov_10_20,
+	alpha_instr_mov_11_20,
+	alpha_instr_mov_12_20,
+	alpha_instr_mov_13_20,
+	alpha_instr_mov_14_20,
+	alpha_instr_mov_15_20,
+	alpha_instr_mov_16_20,
+	alpha_instr_mov_17_20,
+	alpha_instr_mov_18_20,
+	alpha_instr_mov_19_20,
+	alpha_instr_nop,
+	alpha_instr_mov_21_20,
+	alpha_instr_mov_22_20,
+	alpha_instr_mov_23_20,
+	alpha_instr_mov_24_20,
+	alpha_instr_mov_25_20,
+	alpha_instr_mov_26_20,
+	alpha_instr_mov_27_20,
+	alpha_instr_mov_28_20,
+	alpha_instr_mov_29_20,
+	alpha_instr_mov_30_20,
+	alpha_instr_mov_31_20,
+	alpha_instr_mov_0_21,
+	alpha_instr_mov_1_21,
+	alpha_instr_mov_2_21,
+	alpha_instr_mov_3_21,
+	alpha_instr_mov_4_21,
+	alpha_instr_mov_5_21,
+	alpha_instr_mov_6_21,
+	alpha_instr_mov_7_21,
+	alpha_instr_mov_8_21,
+	alpha_instr_mov_9_21,
+	alpha_instr_mov_10_21,
+	alpha_instr_mov_11_21,
+	alpha_instr_mov_12_21,
+	alpha_instr_mov_13_21,
+	alpha_instr_mov_14_21,
+	alpha_instr_mov_15_21,
+	alpha_instr_mov_16_21,
+	alpha_instr_mov_17_21,
+	alpha_instr_mov_18_21,
+	alpha_instr_mov_19_21,
+	alpha_instr_mov_20_21,
+	alpha_instr_nop,
+	alpha_instr_mov_22_21,
+	alpha_instr_mov_23_21,
+	alpha_instr_mov_24_21,
+	alpha_instr_mov_25_21,
+	alpha_instr_mov_26_21,
+	alpha_instr_mov_27_21,
+	alpha_instr_mov_28_21,
+	alpha_instr_mov_29_21,
+	alpha_instr_mov_30_21,
+	alpha_instr_mov_31_21,
+	alpha_instr_mov_0_22,
+	alpha_instr_mov_1_22,
+	alpha_instr_mov_2_22,
+	alpha_instr_mov_3_22,
+	alpha_instr_mov_4_22,
+	alpha_instr_mov_5_22,
+	alpha_instr_mov_6_22,
+	alpha_instr_mov_7_22,
+	alpha_instr_mov_8_22,
+	alpha_instr_mov_9_22,
+	alpha_instr_mov_10_22,
+	alpha_instr_mov_11_22,
+	alpha_instr_mov_12_22,
+	alpha_instr_mov_13_22,
+	alpha_instr_mov_14_22,
+	alpha_instr_mov_15_22,
+	alpha_instr_mov_16_22,
+	alpha_instr_mov_17_22,
+	alpha_instr_mov_18_22,
+	alpha_instr_mov_19_22,
+	alpha_instr_mov_20_22,
+	alpha_instr_mov_21_22,
+	alpha_instr_nop,
+	alpha_instr_mov_23_22,
+	alpha_instr_mov_24_22,
+	alpha_instr_mov_25_22,
+	alpha_instr_mov_26_22,
+	alpha_instr_mov_27_22,
+	alpha_instr_mov_28_22,
+	alpha_instr_mov_29_22,
+	alpha_instr_mov_30_22,
+	alpha_instr_mov_31_22,
+	alpha_instr_mov_0_23,
+	alpha_instr_mov_1_23,
+	alpha_instr_mov_2_23,
+	alpha_instr_mov_3_23,
+	alpha_instr_mov_4_23,
+	alpha_instr_mov_5_23,
+	alpha_instr_mov_6_23,
+	alpha_instr_mov_7_23,
+	alpha_instr_mov_8_23,
+	alpha_instr_mov_9_23,
+	alpha_instr_mov_10_23,
+	alpha_instr_mov_11_23,
+	alpha_instr_mov_12_23,
+	alpha_instr_mov_13_23,
+	alpha_instr_mov_14_23,
+	alpha_instr_mov_15_23,
+	alpha_instr_mov_16_23,
+	alpha_instr_mov_17_23,
+	alpha_instr_mov_18_23,
+	alpha_instr_mov_19_23,
+	alpha_instr_mov_20_23,
+	alpha_instr_mov_21_23,
+	alpha_instr_mov_22_23,
+	alpha_instr_nop,
+	alpha_instr_mov_24_23,
+	alpha_instr_mov_25_23,
+	alpha_instr_mov_26_23,
+	alpha_instr_mov_27_23,
+	alpha_instr_mov_28_23,
+	alpha_instr_mov_29_23,
+	alpha_instr_mov_30_23,
+	alpha_instr_mov_31_23,
+	alpha_instr_mov_0_24,
+	alpha_instr_mov_1_24,
+	alpha_instr_mov_2_24,
+	alpha_instr_mov_3_24,
+	alpha_instr_mov_4_24,
+	alpha_instr_mov_5_24,
+	alpha_instr_mov_6_24,
+	alpha_instr_mov_7_24,
+	alpha_instr_mov_8_24,
+	alpha_instr_mov_9_24,
+	alpha_instr_mov_10_24,
+	alpha_instr_mov_11_24,
+	alpha_instr_mov_12_24,
+	alpha_instr_mov_13_24,
+	alpha_instr_mov_14_24,
+	alpha_instr_mov_15_24,
+	alpha_instr_mov_16_24,
+	alpha_instr_mov_17_24,
+	alpha_instr_mov_18_24,
+	alpha_instr_mov_19_24,
+	alpha_instr_mov_20_24,
+	alpha_instr_mov_21_24,
+	alpha_instr_mov_22_24,
+	alpha_instr_mov_23_24,
+	alpha_instr_nop,
+	alpha_instr_mov_25_24,
+	alpha_instr_mov_26_24,
+	alpha_instr_mov_27_24,
+	alpha_instr_mov_28_24,
+	alpha_instr_mov_29_24,
+	alpha_instr_mov_30_24,
+	alpha_instr_mov_31_24,
+	alpha_instr_mov_0_25,
+	alpha_instr_mov_1_25,
+	alpha_instr_mov_2_25,
+	alpha_instr_mov_3_25,
+	alpha_instr_mov_4_25,
+	alpha_instr_mov_5_25,
+	alpha_instr_mov_6_25,
+	alpha_instr_mov_7_25,
+	alpha_instr_mov_8_25,
+	alpha_instr_mov_9_25,
+	alpha_instr_mov_10_25,
+	alpha_instr_mov_11_25,
+	alpha_instr_mov_12_25,
+	alpha_instr_mov_13_25,
+	alpha_instr_mov_14_25,
+	alpha_instr_mov_15_25,
+	alpha_instr_mov_16_25,
+	alpha_instr_mov_17_25,
+	alpha_instr_mov_18_25,
+	alpha_instr_mov_19_25,
+	alpha_instr_mov_20_25,
+	alpha_instr_mov_21_25,
+	alpha_instr_mov_22_25,
+	alpha_instr_mov_23_25,
+	alpha_instr_mov_24_25,
+	alpha_instr_nop,
+	alpha_instr_mov_26_25,
+	alpha_instr_mov_27_25,
+	alpha_instr_mov_28_25,
+	alpha_instr_mov_29_25,
+	alpha_instr_mov_30_25,
+	alpha_instr_mov_31_25,
+	alpha_instr_mov_0_26,
+	alpha_instr_mov_1_26,
+	alpha_instr_mov_2_26,
+	alpha_instr_mov_3_26,
+	alpha_instr_mov_4_26,
+	alpha_instr_mov_5_26,
+	alpha_instr_mov_6_26,
+	alpha_instr_mov_7_26,
+	alpha_instr_mov_8_26,
+	alpha_instr_mov_9_26,
+	alpha_instr_mov_10_26,
+	alpha_instr_mov_11_26,
+	alpha_instr_mov_12_26,
+	alpha_instr_mov_13_26,
+	alpha_instr_mov_14_26,
+	alpha_instr_mov_15_26,
+	alpha_instr_mov_16_26,
+	alpha_instr_mov_17_26,
+	alpha_instr_mov_18_26,
+	alpha_instr_mov_19_26,
+	alpha_instr_mov_20_26,
+	alpha_instr_mov_21_26,
+	alpha_instr_mov_22_26,
+	alpha_instr_mov_23_26,
+	alpha_instr_mov_24_26,
+	alpha_instr_mov_25_26,
+	alpha_instr_nop,
+	alpha_instr_mov_27_26,
+	alpha_instr_mov_28_26,
+	alpha_instr_mov_29_26,
+	alpha_instr_mov_30_26,
+	alpha_instr_mov_31_26,
+	alpha_instr_mov_0_27,
+	alpha_instr_mov_1_27,
+	alpha_instr_mov_2_27,
+	alpha_instr_mov_3_27,
+	alpha_instr_mov_4_27,
+	alpha_instr_mov_5_27,
+	alpha_instr_mov_6_27,
+	alpha_instr_mov_7_27,
+	alpha_instr_mov_8_27,
+	alpha_instr_mov_9_27,
+	alpha_instr_mov_10_27,
+	alpha_instr_mov_11_27,
+	alpha_instr_mov_12_27,
+	alpha_instr_mov_13_27,
+	alpha_instr_mov_14_27,
+	alpha_instr_mov_15_27,
+	alpha_instr_mov_16_27,
+	alpha_instr_mov_17_27,
+	alpha_instr_mov_18_27,
+	alpha_instr_mov_19_27,
+	alpha_instr_mov_20_27,
+	alpha_instr_mov_21_27,
+	alpha_instr_mov_22_27,
+	alpha_instr_mov_23_27,
+	alpha_instr_mov_24_27,
+	alpha_instr_mov_25_27,
+	alpha_instr_mov_26_27,
+	alpha_instr_nop,
+	alpha_instr_mov_28_27,
+	alpha_instr_mov_29_27,
+	alpha_instr_mov_30_27,
+	alpha_instr_mov_31_27,
+	alpha_instr_mov_0_28,
+	alpha_instr_mov_1_28,
+	alpha_instr_mov_2_28,
+	alpha_instr_mov_3_28,
+	alpha_instr_mov_4_28,
+	alpha_instr_mov_5_28,
+	alpha_instr_mov_6_28,
+	alpha_instr_mov_7_28,
+	alpha_instr_mov_8_28,
+	alpha_instr_mov_9_28,
+	alpha_instr_mov_10_28,
+	alpha_instr_mov_11_28,
+	alpha_instr_mov_12_28,
+	alpha_instr_mov_13_28,
+	alpha_instr_mov_14_28,
+	alpha_instr_mov_15_28,
+	alpha_instr_mov_16_28,
+	alpha_instr_mov_17_28,
+	alpha_instr_mov_18_28,
+	alpha_instr_mov_19_28,
+	alpha_instr_mov_20_28,
+	alpha_instr_mov_21_28,
+	alpha_instr_mov_22_28,
+	alpha_instr_mov_23_28,
+	alpha_instr_mov_24_28,
+	alpha_instr_mov_25_28,
+	alpha_instr_mov_26_28,
+	alpha_instr_mov_27_28,
+	alpha_instr_nop,
+	alpha_instr_mov_29_28,
+	alpha_instr_mov_30_28,
+	alpha_instr_mov_31_28,
+	alpha_instr_mov_0_29,
+	alpha_instr_mov_1_29,
+	alpha_instr_mov_2_29,
+	alpha_instr_mov_3_29,
+	alpha_instr_mov_4_29,
+	alpha_instr_mov_5_29,
+	alpha_instr_mov_6_29,
+	alpha_instr_mov_7_29,
+	alpha_instr_mov_8_29,
+	alpha_instr_mov_9_29,
+	alpha_instr_mov_10_29,
+	alpha_instr_mov_11_29,
+	alpha_instr_mov_12_29,
+	alpha_instr_mov_13_29,
+	alpha_instr_mov_14_29,
+	alpha_instr_mov_15_29,
+	alpha_instr_mov_16_29,
+	alpha_instr_mov_17_29,
+	alpha_instr_mov_18_29,
+	alpha_instr_mov_19_29,
+	alpha_instr_mov_20_29,
+	alpha_instr_mov_21_29,
+	alpha_instr_mov_22_29,
+	alpha_instr_mov_23_29,
+	alpha_instr_mov_24_29,
+	alpha_instr_mov_25_29,
+	alpha_instr_mov_26_29,
+	alpha_instr_mov_27_29,
+	alpha_instr_mov_28_29,
+	alpha_instr_nop,
+	alpha_instr_mov_30_29,
+	alpha_instr_mov_31_29,
+	alpha_instr_mov_0_30,
+	alpha_instr_mov_1_30,
+	alpha_instr_mov_2_30,
+	alpha_instr_mov_3_30,
+	alpha_instr_mov_4_30,
+	alpha_instr_mov_5_30,
+	alpha_instr_mov_6_30,
+	alpha_instr_mov_7_30,
+	alpha_instr_mov_8_30,
+	alpha_instr_mov_9_30,
+	alpha_instr_mov_10_30,
+	alpha_instr_mov_11_30,
+	alpha_instr_mov_12_30,
+	alpha_instr_mov_13_30,
+	alpha_instr_mov_14_30,
+	alpha_instr_mov_15_30,
+	alpha_instr_mov_16_30,
+	alpha_instr_mov_17_30,
+	alpha_instr_mov_18_30,
+	alpha_instr_mov_19_30,
+	alpha_instr_mov_20_30,
+	alpha_instr_mov_21_30,
+	alpha_instr_mov_22_30,
+	alpha_instr_mov_23_30,
+	alpha_instr_mov_24_30,
+	alpha_instr_mov_25_30,
+	alpha_instr_mov_26_30,
+	alpha_instr_mov_27_30,
+	alpha_instr_mov_28_30,
+	alpha_instr_mov_29_30,
+	alpha_instr_nop,
+	alpha_instr_mov_31_30
+};
+
@@ -0,0 +1,16398 @@
+/*
+ *  DO NOT EDIT! AUTOMATICALLY GENERATED!
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "cpu.h"
+#include "misc.h"
+
+
+extern uint32_t arm_r_r0_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r0_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r1_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r2_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r3_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r4_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r5_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r6_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r7_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r8_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r9_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r10_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r11_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r12_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r13_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r14_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_r_r15_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c0(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c1(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c2(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c3(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c4(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c5(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c6(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c7(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c8(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c9(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c10(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c11(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c12(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c13(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c14(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c15(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c16(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c17(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c18(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c19(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c20(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c21(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c22(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c23(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c24(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c25(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c26(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c27(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c28(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c29(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c30(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t0_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t1_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t2_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t3_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t4_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t5_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t6_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r0_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r1_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r2_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r3_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r4_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r5_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r6_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r7_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r8_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r9_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r10_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r11_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r12_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r13_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r14_t7_c31(struct cpu *, struct arm_instr_call *);
+extern uint32_t arm_rs_r15_t7_c31(struct cpu *, struct arm_instr_call *);
+
+uint32_t (*arm_r[8192])(struct cpu *, struct arm_instr_call *) = {
+	arm_r_r0_t0_c0,
+	arm_r_r1_t0_c0,
+	arm_r_r2_t0_c0,
+	arm_r_r3_t0_c0,
+	arm_r_r4_t0_c0,
+	arm_r_r5_t0_c0,
+	arm_r_r6_t0_c0,
+	arm_r_r7_t0_c0,
+	arm_r_r8_t0_c0,
+	arm_r_r9_t0_c0,
+	arm_r_r10_t0_c0,
+	arm_r_r11_t0_c0,
+	arm_r_r12_t0_c0,
+	arm_r_r13_t0_c0,
+	arm_r_r14_t0_c0,
+	arm_r_r15_t0_c0,
+	arm_r_r0_t1_c0,
+	arm_r_r1_t1_c0,
+	arm_r_r2_t1_c0,
+	arm_r_r3_t1_c0,
+	arm_r_r4_t1_c0,
+	arm_r_r5_t1_c0,
+	arm_r_r6_t1_c0,
+	arm_r_r7_t1_c0,
+	arm_r_r8_t1_c0,
+	arm_r_r9_t1_c0,
+	arm_r_r10_t1_c0,
+	arm_r_r11_t1_c0,
+	arm_r_r12_t1_c0,
+	arm_r_r13_t1_c0,
+	arm_r_r14_t1_c0,
+	arm_r_r15_t1_c0,
+	arm_r_r0_t2_c0,
+	arm_r_r1_t2_c0,
+	arm_r_r2_t2_c0,
+	arm_r_r3_t2_c0,
+	arm_r_r4_t2_c0,
+	arm_r_r5_t2_c0,
+	arm_r_r6_t2_c0,
+	arm_r_r7_t2_c0,
+	arm_r_r8_t2_c0,
+	arm_r_r9_t2_c0,
+	arm_r_r10_t2_c0,
+	arm_r_r11_t2_c0,
+	arm_r_r12_t2_c0,
+	arm_r_r13_t2_c0,
+	arm_r_r14_t2_c0,
+	arm_r_r15_t2_c0,
+	arm_r_r0_t3_c0,
+	arm_r_r1_t3_c0,
+	arm_r_r2_t3_c0,
+	arm_r_r3_t3_c0,
+	arm_r_r4_t3_c0,
+	arm_r_r5_t3_c0,
+	arm_r_r6_t3_c0,
+	arm_r_r7_t3_c0,
+	arm_r_r8_t3_c0,
+	arm_r_r9_t3_c0,
+	arm_r_r10_t3_c0,
+	arm_r_r11_t3_c0,
+	arm_r_r12_t3_c0,
+	arm_r_r13_t3_c0,
+	arm_r_r14_t3_c0,
+	arm_r_r15_t3_c0,
+	arm_r_r0_t4_c0,
+	arm_r_r1_t4_c0,
+	arm_r_r2_t4_c0,
+	arm_r_r3_t4_c0,
+	arm_r_r4_t4_c0,
+	arm_r_r5_t4_c0,
+	arm_r_r6_t4_c0,
+	arm_r_r7_t4_c0,
+	arm_r_r8_t4_c0,
+	arm_r_r9_t4_c0,
+	arm_r_r10_t4_c0,
+	arm_r_r11_t4_c0,
+	arm_r_r12_t4_c0,
+	arm_r_r13_t4_c0,
+	arm_r_r14_t4_c0,
+	arm_r_r15_t4_c0,
+	arm_r_r0_t5_c0,
+	arm_r_r1_t5_c0,
+	arm_r_r2_t5_c0,
+	arm_r_r3_t5_c0,
+	arm_r_r4_t5_c0,
+	arm_r_r5_t5_c0,
+	arm_r_r6_t5_c0,
+	arm_r_r7_t5_c0,
+	arm_r_r8_t5_c0,
+	arm_r_r9_t5_c0,
+	arm_r_r10_t5_c0,
+	arm_r_r11_t5_c0,
+	arm_r_r12_t5_c0,
+	arm_r_r13_t5_c0,
+	arm_r_r14_t5_c0,
+	arm_r_r15_t5_c0,
+	arm_r_r0_t6_c0,
+	arm_r_r1_t6_c0,
+	arm_r_r2_t6_c0,
+	arm_r_r3_t6_c0,
+	arm_r_r4_t6_c0,
+	arm_r_r5_t6_c0,
+	arm_r_r6_t6_c0,
+	arm_r_r7_t6_c0,
+	arm_r_r8_t6_c0,
+	arm_r_r9_t6_c0,
+	arm_r_r10_t6_c0,
+	arm_r_r11_t6_c0,
+	arm_r_r12_t6_c0,
+	arm_r_r13_t6_c0,
+	arm_r_r14_t6_c0,
+	arm_r_r15_t6_c0,
+	arm_r_r0_t7_c0,
+	arm_r_r1_t7_c0,
+	arm_r_r2_t7_c0,
+	arm_r_r3_t7_c0,
+	arm_r_r4_t7_c0,
+	arm_r_r5_t7_c0,
+	arm_r_r6_t7_c0,
+	arm_r_r7_t7_c0,
+	arm_r_r8_t7_c0,
+	arm_r_r9_t7_c0,
+	arm_r_r10_t7_c0,
+	arm_r_r11_t7_c0,
+	arm_r_r12_t7_c0,
+	arm_r_r13_t7_c0,
+	arm_r_r14_t7_c0,
+	arm_r_r15_t7_c0,
+	arm_r_r0_t0_c1,
+	arm_r_r1_t0_c1,
+	arm_r_r2_t0_c1,
+	arm_r_r3_t0_c1,
+	arm_r_r4_t0_c1,
+	arm_r_r5_t0_c1,
+	arm_r_r6_t0_c1,
+	arm_r_r7_t0_c1,
+	arm_r_r8_t0_c1,
+	arm_r_r9_t0_c1,
+	arm_r_r10_t0_c1,
+	arm_r_r11_t0_c1,
+	arm_r_r12_t0_c1,
+	arm_r_r13_t0_c1,
+	arm_r_r14_t0_c1,
+	arm_r_r15_t0_c1,
+	arm_r_r0_t1_c1,
+	arm_r_r1_t1_c1,
+	arm_r_r2_t1_c1,
+	arm_r_r3_t1_c1,
+	arm_r_r4_t1_c1,
+	arm_r_r5_t1_c1,
+	arm_r_r6_t1_c1,
+	arm_r_r7_t1_c1,
+	arm_r_r8_t1_c1,
+	arm_r_r9_t1_c1,
+	arm_r_r10_t1_c1,
+	arm_r_r11_t1_c1,
+	arm_r_r12_t1_c1,
+	arm_r_r13_t1_c1,
+	arm_r_r14_t1_c1,
+	arm_r_r15_t1_c1,
+	arm_r_r0_t2_c1,
+	arm_r_r1_t2_c1,
+	arm_r_r2_t2_c1,
+	arm_r_r3_t2_c1,
+	arm_r_r4_t2_c1,
+	arm_r_r5_t2_c1,
+	arm_r_r6_t2_c1,
+	arm_r_r7_t2_c1,
+	arm_r_r8_t2_c1,
+	arm_r_r9_t2_c1,
+	arm_r_r10_t2_c1,
+	arm_r_r11_t2_c1,
+	arm_r_r12_t2_c1,
+	arm_r_r13_t2_c1,
+	arm_r_r14_t2_c1,
+	arm_r_r15_t2_c1,
+	arm_r_r0_t3_c1,
+	arm_r_r1_t3_c1,
+	arm_r_r2_t3_c1,
+	arm_r_r3_t3_c1,
+	arm_r_r4_t3_c1,
+	arm_r_r5_t3_c1,
+	arm_r_r6_t3_c1,
+	arm_r_r7_t3_c1,
+	arm_r_r8_t3_c1,
+	arm_r_r9_t3_c1,
+	arm_r_r10_t3_c1,
+	arm_r_r11_t3_c1,
+	arm_r_r12_t3_c1,
+	arm_r_r13_t3_c1,
+	arm_r_r14_t3_c1,
+	arm_r_r15_t3_c1,
+	arm_r_r0_t4_c1,
+	arm_r_r1_t4_c1,
+	arm_r_r2_t4_c1,
+	arm_r_r3_t4_c1,
+	arm_r_r4_t4_c1,
+	arm_r_r5_t4_c1,
+	arm_r_r6_t4_c1,
+	arm_r_r7_t4_c1,
+	arm_r_r8_t4_c1,
+	arm_r_r9_t4_c1,
+	arm_r_r10_t4_c1,
+	arm_r_r11_t4_c1,
+	arm_r_r12_t4_c1,
+	arm_r_r13_t4_c1,
+	arm_r_r14_t4_c1,
+	arm_r_r15_t4_c1,
+	arm_r_r0_t5_c1,
+	arm_r_r1_t5_c1,
+	arm_r_r2_t5_c1,
+	arm_r_r3_t5_c1,
+	arm_r_r4_t5_c1,
+	arm_r_r5_t5_c1,
+	arm_r_r6_t5_c1,
+	arm_r_r7_t5_c1,
+	arm_r_r8_t5_c1,
+	arm_r_r9_t5_c1,
+	arm_r_r10_t5_c1,
+	arm_r_r11_t5_c1,
+	arm_r_r12_t5_c1,
+	arm_r_r13_t5_c1,
+	arm_r_r14_t5_c1,
+	arm_r_r15_t5_c1,
+	arm_r_r0_t6_c1,
+	arm_r_r1_t6_c1,
+	arm_r_r2_t6_c1,
+	arm_r_r3_t6_c1,
+	arm_r_r4_t6_c1,
+	arm_r_r5_t6_c1,
+	arm_r_r6_t6_c1,
+	arm_r_r7_t6_c1,
+	arm_r_r8_t6_c1,
+	arm_r_r9_t6_c1,
+	arm_r_r10_t6_c1,
+	arm_r_r11_t6_c1,
+	arm_r_r12_t6_c1,
+	arm_r_r13_t6_c1,
+	arm_r_r14_t6_c1,
+	arm_r_r15_t6_c1,
+	arm_r_r0_t7_c1,
+	arm_r_r1_t7_c1,
+	arm_r_r2_t7_c1,
+	arm_r_r3_t7_c1,
+	arm_r_r4_t7_c1,
+	arm_r_r5_t7_c1,
+	arm_r_r6_t7_c1,
+	arm_r_r7_t7_c1,
+	arm_r_r8_t7_c1,
+	arm_r_r9_t7_c1,
+	arm_r_r10_t7_c1,
+	arm_r_r11_t7_c1,
+	arm_r_r12_t7_c1,
+	arm_r_r13_t7_c1,
+	arm_r_r14_t7_c1,
+	arm_r_r15_t7_c1,
+	arm_r_r0_t0_c2,
+	arm_r_r1_t0_c2,
+	arm_r_r2_t0_c2,
+	arm_r_r3_t0_c2,
+	arm_r_r4_t0_c2,
+	arm_r_r5_t0_c2,
+	arm_r_r6_t0_c2,
+	arm_r_r7_t0_c2,
+	arm_r_r8_t0_c2,
+	arm_r_r9_t0_c2,
+	arm_r_r10_t0_c2,
+	arm_r_r11_t0_c2,
+	arm_r_r12_t0_c2,
+	arm_r_r13_t0_c2,
+	arm_r_r14_t0_c2,
+	arm_r_r15_t0_c2,
+	arm_r_r0_t1_c2,
+	arm_r_r1_t1_c2,
+	arm_r_r2_t1_c2,
+	arm_r_r3_t1_c2,
+	arm_r_r4_t1_c2,
+	arm_r_r5_t1_c2,
+	arm_r_r6_t1_c2,
+	arm_r_r7_t1_c2,
+	arm_r_r8_t1_c2,
+	arm_r_r9_t1_c2,
+	arm_r_r10_t1_c2,
+	arm_r_r11_t1_c2,
+	arm_r_r12_t1_c2,
+	arm_r_r13_t1_c2,
+	arm_r_r14_t1_c2,
+	arm_r_r15_t1_c2,
+	arm_r_r0_t2_c2,
+	arm_r_r1_t2_c2,
+	arm_r_r2_t2_c2,
+	arm_r_r3_t2_c2,
+	arm_r_r4_t2_c2,
+	arm_r_r5_t2_c2,
+	arm_r_r6_t2_c2,
+	arm_r_r7_t2_c2,
+	arm_r_r8_t2_c2,
+	arm_r_r9_t2_c2,
+	arm_r_r10_t2_c2,
+	arm_r_r11_t2_c2,
+	arm_r_r12_t2_c2,
+	arm_r_r13_t2_c2,
+	arm_r_r14_t2_c2,
+	arm_r_r15_t2_c2,
+	arm_r_r0_t3_c2,
+	arm_r_r1_t3_c2,
+	arm_r_r2_t3_c2,
+	arm_r_r3_t3_c2,
+	arm_r_r4_t3_c2,
+	arm_r_r5_t3_c2,
+	arm_r_r6_t3_c2,
+	arm_r_r7_t3_c2,
+	arm_r_r8_t3_c2,
+	arm_r_r9_t3_c2,
+	arm_r_r10_t3_c2,
+	arm_r_r11_t3_c2,
+	arm_r_r12_t3_c2,
+	arm_r_r13_t3_c2,
+	arm_r_r14_t3_c2,
+	arm_r_r15_t3_c2,
+	arm_r_r0_t4_c2,
+	arm_r_r1_t4_c2,
+	arm_r_r2_t4_c2,
+	arm_r_r3_t4_c2,
+	arm_r_r4_t4_c2,
+	arm_r_r5_t4_c2,
+	arm_r_r6_t4_c2,
+	arm_r_r7_t4_c2,
+	arm_r_r8_t4_c2,
+	arm_r_r9_t4_c2,
+	arm_r_r10_t4_c2,
+	arm_r_r11_t4_c2,
+	arm_r_r12_t4_c2,
+	arm_r_r13_t4_c2,
+	arm_r_r14_t4_c2,
+	arm_r_r15_t4_c2,
+	arm_r_r0_t5_c2,
+	arm_r_r1_t5_c2,
+	arm_r_r2_t5_c2,
+	arm_r_r3_t5_c2,
+	arm_r_r4_t5_c2,
+	arm_r_r5_t5_c2,
+	arm_r_r6_t5_c2,
+	arm_r_r7_t5_c2,
+	arm_r_r8_t5_c2,
+	arm_r_r9_t5_c2,
+	arm_r_r10_t5_c2,
+	arm_r_r11_t5_c2,
+	arm_r_r12_t5_c2,
+	arm_r_r13_t5_c2,
+	arm_r_r14_t5_c2,
+	arm_r_r15_t5_c2,
+	arm_r_r0_t6_c2,
+	arm_r_r1_t6_c2,
+	arm_r_r2_t6_c2,
+	arm_r_r3_t6_c2,
+	arm_r_r4_t6_c2,
+	arm_r_r5_t6_c2,
+	arm_r_r6_t6_c2,
+	arm_r_r7_t6_c2,
+	arm_r_r8_t6_c2,
+	arm_r_r9_t6_c2,
+	arm_r_r10_t6_c2,
+	arm_r_r11_t6_c2,
+	arm_r_r12_t6_c2,
+	arm_r_r13_t6_c2,
+	arm_r_r14_t6_c2,
+	arm_r_r15_t6_c2,
+	arm_r_r0_t7_c2,
+	arm_r_r1_t7_c2,
+	arm_r_r2_t7_c2,
+	arm_r_r3_t7_c2,
+	arm_r_r4_t7_c2,
+	arm_r_r5_t7_c2,
+	arm_r_r6_t7_c2,
+	arm_r_r7_t7_c2,
+	arm_r_r8_t7_c2,
+	arm_r_r9_t7_c2,
+	arm_r_r10_t7_c2,
+	arm_r_r11_t7_c2,
+	arm_r_r12_t7_c2,
+	arm_r_r13_t7_c2,
+	arm_r_r14_t7_c2,
+	arm_r_r15_t7_c2,
+	arm_r_r0_t0_c3,
+	arm_r_r1_t0_c3,
+	arm_r_r2_t0_c3,
+	arm_r_r3_t0_c3,
+	arm_r_r4_t0_c3,
+	arm_r_r5_t0_c3,
+	arm_r_r6_t0_c3,
+	arm_r_r7_t0_c3,
+	arm_r_r8_t0_c3,
+	arm_r_r9_t0_c3,
+	arm_r_r10_t0_c3,
+	arm_r_r11_t0_c3,
+	arm_r_r12_t0_c3,
+	arm_r_r13_t0_c3,
+	arm_r_r14_t0_c3,
+	arm_r_r15_t0_c3,
+	arm_r_r0_t1_c3,
+	arm_r_r1_t1_c3,
+	arm_r_r2_t1_c3,
+	arm_r_r3_t1_c3,
+	arm_r_r4_t1_c3,
+	arm_r_r5_t1_c3,
+	arm_r_r6_t1_c3,
+	arm_r_r7_t1_c3,
+	arm_r_r8_t1_c3,
+	arm_r_r9_t1_c3,
+	arm_r_r10_t1_c3,
+	arm_r_r11_t1_c3,
+	arm_r_r12_t1_c3,
+	arm_r_r13_t1_c3,
+	arm_r_r14_t1_c3,
+	arm_r_r15_t1_c3,
+	arm_r_r0_t2_c3,
+	arm_r_r1_t2_c3,
+	arm_r_r2_t2_c3,
+	arm_r_r3_t2_c3,
+	arm_r_r4_t2_c3,
+	arm_r_r5_t2_c3,
+	arm_r_r6_t2_c3,
+	arm_r_r7_t2_c3,
+	arm_r_r8_t2_c3,
+	arm_r_r9_t2_c3,
+	arm_r_r10_t2_c3,
+	arm_r_r11_t2_c3,
+	arm_r_r12_t2_c3,
+	arm_r_r13_t2_c3,
+	arm_r_r14_t2_c3,
+	arm_r_r15_t2_c3,
+	arm_r_r0_t3_c3,
+	arm_r_r1_t3_c3,
+	arm_r_r2_t3_c3,
+	arm_r_r3_t3_c3,
+	arm_r_r4_t3_c3,
+	arm_r_r5_t3_c3,
+	arm_r_r6_t3_c3,
+	arm_r_r7_t3_c3,
+	arm_r_r8_t3_c3,
+	arm_r_r9_t3_c3,
+	arm_r_r10_t3_c3,
+	arm_r_r11_t3_c3,
+	arm_r_r12_t3_c3,
+	arm_r_r13_t3_c3,
+	arm_r_r14_t3_c3,
+	arm_r_r15_t3_c3,
+	arm_r_r0_t4_c3,
+	arm_r_r1_t4_c3,
+	arm_r_r2_t4_c3,
+	arm_r_r3_t4_c3,
+	arm_r_r4_t4_c3,
+	arm_r_r5_t4_c3,
+	arm_r_r6_t4_c3,
+	arm_r_r7_t4_c3,
+	arm_r_r8_t4_c3,
+	arm_r_r9_t4_c3,
+	arm_r_r10_t4_c3,
+	arm_r_r11_t4_c3,
+	arm_r_r12_t4_c3,
+	arm_r_r13_t4_c3,
+	arm_r_r14_t4_c3,
+	arm_r_r15_t4_c3,
+	arm_r_r0_t5_c3,
+	arm_r_r1_t5_c3,
+	arm_r_r2_t5_c3,
+	arm_r_r3_t5_c3,
+	arm_r_r4_t5_c3,
+	arm_r_r5_t5_c3,
+	arm_r_r6_t5_c3,
+	arm_r_r7_t5_c3,
+	arm_r_r8_t5_c3,
+	arm_r_r9_t5_c3,
+	arm_r_r10_t5_c3,
+	arm_r_r11_t5_c3,
+	arm_r_r12_t5_c3,
+	arm_r_r13_t5_c3,
+	arm_r_r14_t5_c3,
+	arm_r_r15_t5_c3,
+	arm_r_r0_t6_c3,
+	arm_r_r1_t6_c3,
+	arm_r_r2_t6_c3,
+	arm_r_r3_t6_c3,
+	arm_r_r4_t6_c3,
+	arm_r_r5_t6_c3,
+	arm_r_r6_t6_c3,
+	arm_r_r7_t6_c3,
+	arm_r_r8_t6_c3,
+	arm_r_r9_t6_c3,
+	arm_r_r10_t6_c3,
+	arm_r_r11_t6_c3,
+	arm_r_r12_t6_c3,
+	arm_r_r13_t6_c3,
+	arm_r_r14_t6_c3,
+	arm_r_r15_t6_c3,
+	arm_r_r0_t7_c3,
+	arm_r_r1_t7_c3,
+	arm_r_r2_t7_c3,
+	arm_r_r3_t7_c3,
+	arm_r_r4_t7_c3,
+	arm_r_r5_t7_c3,
+	arm_r_r6_t7_c3,
+	arm_r_r7_t7_c3,
+	arm_r_r8_t7_c3,
+	arm_r_r9_t7_c3,
+	arm_r_r10_t7_c3,
+	arm_r_r11_t7_c3,
+	arm_r_r12_t7_c3,
+	arm_r_r13_t7_c3,
+	arm_r_r14_t7_c3,
+	arm_r_r15_t7_c3,
+	arm_r_r0_t0_c4,
+	arm_r_r1_t0_c4,
+	arm_r_r2_t0_c4,
+	arm_r_r3_t0_c4,
+	arm_r_r4_t0_c4,
+	arm_r_r5_t0_c4,
+	arm_r_r6_t0_c4,
+	arm_r_r7_t0_c4,
+	arm_r_r8_t0_c4,
+	arm_r_r9_t0_c4,
+	arm_r_r10_t0_c4,
+	arm_r_r11_t0_c4,
+	arm_r_r12_t0_c4,
+	arm_r_r13_t0_c4,
+	arm_r_r14_t0_c4,
+	arm_r_r15_t0_c4,
+	arm_r_r0_t1_c4,
+	arm_r_r1_t1_c4,
+	arm_r_r2_t1_c4,
+	arm_r_r3_t1_c4,
+	arm_r_r4_t1_c4,
+	arm_r_r5_t1_c4,
+	arm_r_r6_t1_c4,
+	arm_r_r7_t1_c4,
+	arm_r_r8_t1_c4,
+	arm_r_r9_t1_c4,
+	arm_r_r10_t1_c4,
+	arm_r_r11_t1_c4,
+	arm_r_r12_t1_c4,
+	arm_r_r13_t1_c4,
+	arm_r_r14_t1_c4,
+	arm_r_r15_t1_c4,
+	arm_r_r0_t2_c4,
+	arm_r_r1_t2_c4,
+	arm_r_r2_t2_c4,
+	arm_r_r3_t2_c4,
+	arm_r_r4_t2_c4,
+	arm_r_r5_t2_c4,
+	arm_r_r6_t2_c4,
+	arm_r_r7_t2_c4,
+	arm_r_r8_t2_c4,
+	arm_r_r9_t2_c4,
+	arm_r_r10_t2_c4,
+	arm_r_r11_t2_c4,
+	arm_r_r12_t2_c4,
+	arm_r_r13_t2_c4,
+	arm_r_r14_t2_c4,
+	arm_r_r15_t2_c4,
+	arm_r_r0_t3_c4,
+	arm_r_r1_t3_c4,
+	arm_r_r2_t3_c4,
+	arm_r_r3_t3_c4,
+	arm_r_r4_t3_c4,
+	arm_r_r5_t3_c4,
+	arm_r_r6_t3_c4,
+	arm_r_r7_t3_c4,
+	arm_r_r8_t3_c4,
+	arm_r_r9_t3_c4,
+	arm_r_r10_t3_c4,
+	arm_r_r11_t3_c4,
+	arm_r_r12_t3_c4,
+	arm_r_r13_t3_c4,
+	arm_r_r14_t3_c4,
+	arm_r_r15_t3_c4,
+	arm_r_r0_t4_c4,
+	arm_r_r1_t4_c4,
+	arm_r_r2_t4_c4,
+	arm_r_r3_t4_c4,
+	arm_r_r4_t4_c4,
+	arm_r_r5_t4_c4,
+	arm_r_r6_t4_c4,
+	arm_r_r7_t4_c4,
+	arm_r_r8_t4_c4,
+	arm_r_r9_t4_c4,
+	arm_r_r10_t4_c4,
+	arm_r_r11_t4_c4,
+	arm_r_r12_t4_c4,
+	arm_r_r13_t4_c4,
+	arm_r_r14_t4_c4,
+	arm_r_r15_t4_c4,
+	arm_r_r0_t5_c4,
+	arm_r_r1_t5_c4,
+	arm_r_r2_t5_c4,
+	arm_r_r3_t5_c4,
+	arm_r_r4_t5_c4,
+	arm_r_r5_t5_c4,
+	arm_r_r6_t5_c4,
+	arm_r_r7_t5_c4,
+	arm_r_r8_t5_c4,
+	arm_r_r9_t5_c4,
+	arm_r_r10_t5_c4,
+	arm_r_r11_t5_c4,
+	arm_r_r12_t5_c4,
+	arm_r_r13_t5_c4,
+	arm_r_r14_t5_c4,
+	arm_r_r15_t5_c4,
+	arm_r_r0_t6_c4,
+	arm_r_r1_t6_c4,
+	arm_r_r2_t6_c4,
+	arm_r_r3_t6_c4,
+	arm_r_r4_t6_c4,
+	arm_r_r5_t6_c4,
+	arm_r_r6_t6_c4,
+	arm_r_r7_t6_c4,
+	arm_r_r8_t6_c4,
+	arm_r_r9_t6_c4,
+	arm_r_r10_t6_c4,
+	arm_r_r11_t6_c4,
+	arm_r_r12_t6_c4,
+	arm_r_r13_t6_c4,
+	arm_r_r14_t6_c4,
+	arm_r_r15_t6_c4,
+	arm_r_r0_t7_c4,
+	arm_r_r1_t7_c4,
+	arm_r_r2_t7_c4,
+	arm_r_r3_t7_c4,
+	arm_r_r4_t7_c4,
+	arm_r_r5_t7_c4,
+	arm_r_r6_t7_c4,
+	arm_r_r7_t7_c4,
+	arm_r_r8_t7_c4,
+	arm_r_r9_t7_c4,
+	arm_r_r10_t7_c4,
+	arm_r_r11_t7_c4,
+	arm_r_r12_t7_c4,
+	arm_r_r13_t7_c4,
+	arm_r_r14_t7_c4,
+	arm_r_r15_t7_c4,
+	arm_r_r0_t0_c5,
+	arm_r_r1_t0_c5,
+	arm_r_r2_t0_c5,
+	arm_r_r3_t0_c5,
+	arm_r_r4_t0_c5,
+	arm_r_r5_t0_c5,
+	arm_r_r6_t0_c5,
+	arm_r_r7_t0_c5,
+	arm_r_r8_t0_c5,
+	arm_r_r9_t0_c5,
+	arm_r_r10_t0_c5,
+	arm_r_r11_t0_c5,
+	arm_r_r12_t0_c5,
+	arm_r_r13_t0_c5,
+	arm_r_r14_t0_c5,
+	arm_r_r15_t0_c5,
+	arm_r_r0_t1_c5,
+	arm_r_r1_t1_c5,
+	arm_r_r2_t1_c5,
+	arm_r_r3_t1_c5,
+	arm_r_r4_t1_c5,
+	arm_r_r5_t1_c5,
+	arm_r_r6_t1_c5,
+	arm_r_r7_t1_c5,
+	arm_r_r8_t1_c5,
+	arm_r_r9_t1_c5,
+	arm_r_r10_t1_c5,
+	arm_r_r11_t1_c5,
+	arm_r_r12_t1_c5,
+	arm_r_r13_t1_c5,
+	arm_r_r14_t1_c5,
+	arm_r_r15_t1_c5,
+	arm_r_r0_t2_c5,
+	arm_r_r1_t2_c5,
+	arm_r_r2_t2_c5,
+	arm_r_r3_t2_c5,
+	arm_r_r4_t2_c5,
+	arm_r_r5_t2_c5,
+	arm_r_r6_t2_c5,
+	arm_r_r7_t2_c5,
+	arm_r_r8_t2_c5,
+	arm_r_r9_t2_c5,
+	arm_r_r10_t2_c5,
+	arm_r_r11_t2_c5,
+	arm_r_r12_t2_c5,
+	arm_r_r13_t2_c5,
+	arm_r_r14_t2_c5,
+	arm_r_r15_t2_c5,
+	arm_r_r0_t3_c5,
+	arm_r_r1_t3_c5,
+	arm_r_r2_t3_c5,
+	arm_r_r3_t3_c5,
+	arm_r_r4_t3_c5,
+	arm_r_r5_t3_c5,
+	arm_r_r6_t3_c5,
+	arm_r_r7_t3_c5,
+	arm_r_r8_t3_c5,
+	arm_r_r9_t3_c5,
+	arm_r_r10_t3_c5,
+	arm_r_r11_t3_c5,
+	arm_r_r12_t3_c5,
+	arm_r_r13_t3_c5,
+	arm_r_r14_t3_c5,
+	arm_r_r15_t3_c5,
+	arm_r_r0_t4_c5,
+	arm_r_r1_t4_c5,
+	arm_r_r2_t4_c5,
+	arm_r_r3_t4_c5,
+	arm_r_r4_t4_c5,
+	arm_r_r5_t4_c5,
+	arm_r_r6_t4_c5,
+	arm_r_r7_t4_c5,
+	arm_r_r8_t4_c5,
+	arm_r_r9_t4_c5,
+	arm_r_r10_t4_c5,
+	arm_r_r11_t4_c5,
+	arm_r_r12_t4_c5,
+	arm_r_r13_t4_c5,
+	arm_r_r14_t4_c5,
+	arm_r_r15_t4_c5,
+	arm_r_r0_t5_c5,
+	arm_r_r1_t5_c5,
+	arm_r_r2_t5_c5,
+	arm_r_r3_t5_c5,
+	arm_r_r4_t5_c5,
+	arm_r_r5_t5_c5,
+	arm_r_r6_t5_c5,
+	arm_r_r7_t5_c5,
+	arm_r_r8_t5_c5,
+	arm_r_r9_t5_c5,
+	arm_r_r10_t5_c5,
+	arm_r_r11_t5_c5,
+	arm_r_r12_t5_c5,
+	arm_r_r13_t5_c5,
+	arm_r_r14_t5_c5,
+	arm_r_r15_t5_c5,
+	arm_r_r0_t6_c5,
+	arm_r_r1_t6_c5,
+	arm_r_r2_t6_c5,
+	arm_r_r3_t6_c5,
+	arm_r_r4_t6_c5,
+	arm_r_r5_t6_c5,
+	arm_r_r6_t6_c5,
+	arm_r_r7_t6_c5,
+	arm_r_r8_t6_c5,
+	arm_r_r9_t6_c5,
+	arm_r_r10_t6_c5,
+	arm_r_r11_t6_c5,
+	arm_r_r12_t6_c5,
+	arm_r_r13_t6_c5,
+	arm_r_r14_t6_c5,
+	arm_r_r15_t6_c5,
+	arm_r_r0_t7_c5,
+	arm_r_r1_t7_c5,
+	arm_r_r2_t7_c5,
+	arm_r_r3_t7_c5,
+	arm_r_r4_t7_c5,
+	arm_r_r5_t7_c5,
+	arm_r_r6_t7_c5,
+	arm_r_r7_t7_c5,
+	arm_r_r8_t7_c5,
+	arm_r_r9_t7_c5,
+	arm_r_r10_t7_c5,
+	arm_r_r11_t7_c5,
+	arm_r_r12_t7_c5,
+	arm_r_r13_t7_c5,
+	arm_r_r14_t7_c5,
+	arm_r_r15_t7_c5,
+	arm_r_r0_t0_c6,
+	arm_r_r1_t0_c6,
+	arm_r_r2_t0_c6,
+	arm_r_r3_t0_c6,
+	arm_r_r4_t0_c6,
+	arm_r_r5_t0_c6,
+	arm_r_r6_t0_c6,
+	arm_r_r7_t0_c6,
+	arm_r_r8_t0_c6,
+	arm_r_r9_t0_c6,
+	arm_r_r10_t0_c6,
+	arm_r_r11_t0_c6,
+	arm_r_r12_t0_c6,
+	arm_r_r13_t0_c6,
+	arm_r_r14_t0_c6,
+	arm_r_r15_t0_c6,
+	arm_r_r0_t1_c6,
+	arm_r_r1_t1_c6,
+	arm_r_r2_t1_c6,
+	arm_r_r3_t1_c6,
+	arm_r_r4_t1_c6,
+	arm_r_r5_t1_c6,
+	arm_r_r6_t1_c6,
+	arm_r_r7_t1_c6,
+	arm_r_r8_t1_c6,
+	arm_r_r9_t1_c6,
+	arm_r_r10_t1_c6,
+	arm_r_r11_t1_c6,
+	arm_r_r12_t1_c6,
+	arm_r_r13_t1_c6,
+	arm_r_r14_t1_c6,
+	arm_r_r15_t1_c6,
+	arm_r_r0_t2_c6,
+	arm_r_r1_t2_c6,
+	arm_r_r2_t2_c6,
+	arm_r_r3_t2_c6,
+	arm_r_r4_t2_c6,
+	arm_r_r5_t2_c6,
+	arm_r_r6_t2_c6,
+	arm_r_r7_t2_c6,
+	arm_r_r8_t2_c6,
+	arm_r_r9_t2_c6,
+	arm_r_r10_t2_c6,
+	arm_r_r11_t2_c6,
+	arm_r_r12_t2_c6,
+	arm_r_r13_t2_c6,
+	arm_r_r14_t2_c6,
+	arm_r_r15_t2_c6,
+	arm_r_r0_t3_c6,
+	arm_r_r1_t3_c6,
+	arm_r_r2_t3_c6,
+	arm_r_r3_t3_c6,
+	arm_r_r4_t3_c6,
+	arm_r_r5_t3_c6,
+	arm_r_r6_t3_c6,
+	arm_r_r7_t3_c6,
+	arm_r_r8_t3_c6,
+	arm_r_r9_t3_c6,
+	arm_r_r10_t3_c6,
+	arm_r_r11_t3_c6,
+	arm_r_r12_t3_c6,
+	arm_r_r13_t3_c6,
+	arm_r_r14_t3_c6,
+	arm_r_r15_t3_c6,
+	arm_r_r0_t4_c6,
+	arm_r_r1_t4_c6,
+	arm_r_r2_t4_c6,
+	arm_r_r3_t4_c6,
+	arm_r_r4_t4_c6,
+	arm_r_r5_t4_c6,
+	arm_r_r6_t4_c6,
+	arm_r_r7_t4_c6,
+	arm_r_r8_t4_c6,
+	arm_r_r9_t4_c6,
+	arm_r_r10_t4_c6,
+	arm_r_r11_t4_c6,
+	arm_r_r12_t4_c6,
+	arm_r_r13_t4_c6,
+	arm_r_r14_t4_c6,
+	arm_r_r15_t4_c6,
+	arm_r_r0_t5_c6,
+	arm_r_r1_t5_c6,
+	arm_r_r2_t5_c6,
+	arm_r_r3_t5_c6,
+	arm_r_r4_t5_c6,
+	arm_r_r5_t5_c6,
+	arm_r_r6_t5_c6,
+	arm_r_r7_t5_c6,
+	arm_r_r8_t5_c6,
+	arm_r_r9_t5_c6,
+	arm_r_r10_t5_c6,
+	arm_r_r11_t5_c6,
+	arm_r_r12_t5_c6,
+	arm_r_r13_t5_c6,
+	arm_r_r14_t5_c6,
+	arm_r_r15_t5_c6,
+	arm_r_r0_t6_c6,
+	arm_r_r1_t6_c6,
+	arm_r_r2_t6_c6,
+	arm_r_r3_t6_c6,
+	arm_r_r4_t6_c6,
+	arm_r_r5_t6_c6,
+	arm_r_r6_t6_c6,
+	arm_r_r7_t6_c6,
+	arm_r_r8_t6_c6,
+	arm_r_r9_t6_c6,
+	arm_r_r10_t6_c6,
+	arm_r_r11_t6_c6,
+	arm_r_r12_t6_c6,
+	arm_r_r13_t6_c6,
+	arm_r_r14_t6_c6,
+	arm_r_r15_t6_c6,
+	arm_r_r0_t7_c6,
+	arm_r_r1_t7_c6,
+	arm_r_r2_t7_c6,
+	arm_r_r3_t7_c6,
+	arm_r_r4_t7_c6,
+	arm_r_r5_t7_c6,
+	arm_r_r6_t7_c6,
+	arm_r_r7_t7_c6,
+	arm_r_r8_t7_c6,
+	arm_r_r9_t7_c6,
+	arm_r_r10_t7_c6,
+	arm_r_r11_t7_c6,
+	arm_r_r12_t7_c6,
+	arm_r_r13_t7_c6,
+	arm_r_r14_t7_c6,
+	arm_r_r15_t7_c6,
+	arm_r_r0_t0_c7,
+	arm_r_r1_t0_c7,
+	arm_r_r2_t0_c7,
+	arm_r_r3_t0_c7,
+	arm_r_r4_t0_c7,
+	arm_r_r5_t0_c7,
+	arm_r_r6_t0_c7,
+	arm_r_r7_t0_c7,
+	arm_r_r8_t0_c7,
+	arm_r_r9_t0_c7,
+	arm_r_r10_t0_c7,
+	arm_r_r11_t0_c7,
+	arm_r_r12_t0_c7,
+	arm_r_r13_t0_c7,
+	arm_r_r14_t0_c7,
+	arm_r_r15_t0_c7,
+	arm_r_r0_t1_c7,
+	arm_r_r1_t1_c7,
+	arm_r_r2_t1_c7,
+	arm_r_r3_t1_c7,
+	arm_r_r4_t1_c7,
+	arm_r_r5_t1_c7,
+	arm_r_r6_t1_c7,
+	arm_r_r7_t1_c7,
+	arm_r_r8_t1_c7,
+	arm_r_r9_t1_c7,
+	arm_r_r10_t1_c7,
+	arm_r_r11_t1_c7,
+	arm_r_r12_t1_c7,
+	arm_r_r13_t1_c7,
+	arm_r_r14_t1_c7,
+	arm_r_r15_t1_c7,
+	arm_r_r0_t2_c7,
+	arm_r_r1_t2_c7,
+	arm_r_r2_t2_c7,
+	arm_r_r3_t2_c7,
+	arm_r_r4_t2_c7,
+	arm_r_r5_t2_c7,
+	arm_r_r6_t2_c7,
+	arm_r_r7_t2_c7,
+	arm_r_r8_t2_c7,
+	arm_r_r9_t2_c7,
+	arm_r_r10_t2_c7,
+	arm_r_r11_t2_c7,
+	arm_r_r12_t2_c7,
+	arm_r_r13_t2_c7,
+	arm_r_r14_t2_c7,
+	arm_r_r15_t2_c7,
+	arm_r_r0_t3_c7,
+	arm_r_r1_t3_c7,
+	arm_r_r2_t3_c7,
+	arm_r_r3_t3_c7,
+	arm_r_r4_t3_c7,
+	arm_r_r5_t3_c7,
+	arm_r_r6_t3_c7,
+	arm_r_r7_t3_c7,
+	arm_r_r8_t3_c7,
+	arm_r_r9_t3_c7,
+	arm_r_r10_t3_c7,
+	arm_r_r11_t3_c7,
+	arm_r_r12_t3_c7,
+	arm_r_r13_t3_c7,
+	arm_r_r14_t3_c7,
+	arm_r_r15_t3_c7,
+	arm_r_r0_t4_c7,
+	arm_r_r1_t4_c7,
+	arm_r_r2_t4_c7,
+	arm_r_r3_t4_c7,
+	arm_r_r4_t4_c7,
+	arm_r_r5_t4_c7,
+	arm_r_r6_t4_c7,
+	arm_r_r7_t4_c7,
+	arm_r_r8_t4_c7,
+	arm_r_r9_t4_c7,
+	arm_r_r10_t4_c7,
+	arm_r_r11_t4_c7,
+	arm_r_r12_t4_c7,
+	arm_r_r13_t4_c7,
+	arm_r_r14_t4_c7,
+	arm_r_r15_t4_c7,
+	arm_r_r0_t5_c7,
+	arm_r_r1_t5_c7,
+	arm_r_r2_t5_c7,
+	arm_r_r3_t5_c7,
+	arm_r_r4_t5_c7,
+	arm_r_r5_t5_c7,
+	arm_r_r6_t5_c7,
+	arm_r_r7_t5_c7,
+	arm_r_r8_t5_c7,
+	arm_r_r9_t5_c7,
+	arm_r_r10_t5_c7,
+	arm_r_r11_t5_c7,
+	arm_r_r12_t5_c7,
+	arm_r_r13_t5_c7,
+	arm_r_r14_t5_c7,
+	arm_r_r15_t5_c7,
+	arm_r_r0_t6_c7,
+	arm_r_r1_t6_c7,
+	arm_r_r2_t6_c7,
+	arm_r_r3_t6_c7,
+	arm_r_r4_t6_c7,
+	arm_r_r5_t6_c7,
+	arm_r_r6_t6_c7,
+	arm_r_r7_t6_c7,
+	arm_r_r8_t6_c7,
+	arm_r_r9_t6_c7,
+	arm_r_r10_t6_c7,
+	arm_r_r11_t6_c7,
+	arm_r_r12_t6_c7,
+	arm_r_r13_t6_c7,
+	arm_r_r14_t6_c7,
+	arm_r_r15_t6_c7,
+	arm_r_r0_t7_c7,
+	arm_r_r1_t7_c7,
+	arm_r_r2_t7_c7,
+	arm_r_r3_t7_c7,
+	arm_r_r4_t7_c7,
+	arm_r_r5_t7_c7,
+	arm_r_r6_t7_c7,
+	arm_r_r7_t7_c7,
+	arm_r_r8_t7_c7,
+	arm_r_r9_t7_c7,
+	arm_r_r10_t7_c7,
+	arm_r_r11_t7_c7,
+	arm_r_r12_t7_c7,
+	arm_r_r13_t7_c7,
+	arm_r_r14_t7_c7,
+	arm_r_r15_t7_c7,
+	arm_r_r0_t0_c8,
+	arm_r_r1_t0_c8,
+	arm_r_r2_t0_c8,
+	arm_r_r3_t0_c8,
+	arm_r_r4_t0_c8,
+	arm_r_r5_t0_c8,
+	arm_r_r6_t0_c8,
+	arm_r_r7_t0_c8,
+	arm_r_r8_t0_c8,
+	arm_r_r9_t0_c8,
+	arm_r_r10_t0_c8,
+	arm_r_r11_t0_c8,
+	arm_r_r12_t0_c8,
+	arm_r_r13_t0_c8,
+	arm_r_r14_t0_c8,
+	arm_r_r15_t0_c8,
+	arm_r_r0_t1_c8,
+	arm_r_r1_t1_c8,
+	arm_r_r2_t1_c8,
+	arm_r_r3_t1_c8,
+	arm_r_r4_t1_c8,
+	arm_r_r5_t1_c8,
+	arm_r_r6_t1_c8,
+	arm_r_r7_t1_c8,
+	arm_r_r8_t1_c8,
+	arm_r_r9_t1_c8,
+	arm_r_r10_t1_c8,
+	arm_r_r11_t1_c8,
+	arm_r_r12_t1_c8,
+	arm_r_r13_t1_c8,
+	arm_r_r14_t1_c8,
+	arm_r_r15_t1_c8,
+	arm_r_r0_t2_c8,
+	arm_r_r1_t2_c8,
+	arm_r_r2_t2_c8,
+	arm_r_r3_t2_c8,
+	arm_r_r4_t2_c8,
+	arm_r_r5_t2_c8,
+	arm_r_r6_t2_c8,
+	arm_r_r7_t2_c8,
+	arm_r_r8_t2_c8,
+	arm_r_r9_t2_c8,
+	arm_r_r10_t2_c8,
+	arm_r_r11_t2_c8,
+	arm_r_r12_t2_c8,
+	arm_r_r13_t2_c8,
+	arm_r_r14_t2_c8,
+	arm_r_r15_t2_c8,
+	arm_r_r0_t3_c8,
+	arm_r_r1_t3_c8,
+	arm_r_r2_t3_c8,
+	arm_r_r3_t3_c8,
+	arm_r_r4_t3_c8,
+	arm_r_r5_t3_c8,
+	arm_r_r6_t3_c8,
+	arm_r_r7_t3_c8,
+	arm_r_r8_t3_c8,
+	arm_r_r9_t3_c8,
+	arm_r_r10_t3_c8,
+	arm_r_r11_t3_c8,
+	arm_r_r12_t3_c8,
+	arm_r_r13_t3_c8,
+	arm_r_r14_t3_c8,
+	arm_r_r15_t3_c8,
+	arm_r_r0_t4_c8,
+	arm_r_r1_t4_c8,
+	arm_r_r2_t4_c8,
+	arm_r_r3_t4_c8,
+	arm_r_r4_t4_c8,
+	arm_r_r5_t4_c8,
+	arm_r_r6_t4_c8,
+	arm_r_r7_t4_c8,
+	arm_r_r8_t4_c8,
+	arm_r_r9_t4_c8,
+	arm_r_r10_t4_c8,
+	arm_r_r11_t4_c8,
+	arm_r_r12_t4_c8,
+	arm_r_r13_t4_c8,
+	arm_r_r14_t4_c8,
+	arm_r_r15_t4_c8,
+	arm_r_r0_t5_c8,
+	arm_r_r1_t5_c8,
+	arm_r_r2_t5_c8,
+	arm_r_r3_t5_c8,
+	arm_r_r4_t5_c8,
+	arm_r_r5_t5_c8,
+	arm_r_r6_t5_c8,
+	arm_r_r7_t5_c8,
+	arm_r_r8_t5_c8,
+	arm_r_r9_t5_c8,
+	arm_r_r10_t5_c8,
+	arm_r_r11_t5_c8,
+	arm_r_r12_t5_c8,
+	arm_r_r13_t5_c8,
+	arm_r_r14_t5_c8,
+	arm_r_r15_t5_c8,
+	arm_r_r0_t6_c8,
+	arm_r_r1_t6_c8,
+	arm_r_r2_t6_c8,
+	arm_r_r3_t6_c8,
+	arm_r_r4_t6_c8,
+	arm_r_r5_t6_c8,
+	arm_r_r6_t6_c8,
+	arm_r_r7_t6_c8,
+	arm_r_r8_t6_c8,
+	arm_r_r9_t6_c8,
+	arm_r_r10_t6_c8,
+	arm_r_r11_t6_c8,
+	arm_r_r12_t6_c8,
+	arm_r_r13_t6_c8,
+	arm_r_r14_t6_c8,
+	arm_r_r15_t6_c8,
+	arm_r_r0_t7_c8,
+	arm_r_r1_t7_c8,
+	arm_r_r2_t7_c8,
+	arm_r_r3_t7_c8,
+	arm_r_r4_t7_c8,
+	arm_r_r5_t7_c8,
+	arm_r_r6_t7_c8,
+	arm_r_r7_t7_c8,
+	arm_r_r8_t7_c8,
+	arm_r_r9_t7_c8,
+	arm_r_r10_t7_c8,
+	arm_r_r11_t7_c8,
+	arm_r_r12_t7_c8,
+	arm_r_r13_t7_c8,
+	arm_r_r14_t7_c8,
+	arm_r_r15_t7_c8,
+	arm_r_r0_t0_c9,
+	arm_r_r1_t0_c9,
+	arm_r_r2_t0_c9,
+	arm_r_r3_t0_c9,
+	arm_r_r4_t0_c9,
+	arm_r_r5_t0_c9,
+	arm_r_r6_t0_c9,
+	arm_r_r7_t0_c9,
+	arm_r_r8_t0_c9,
+	arm_r_r9_t0_c9,
+	arm_r_r10_t0_c9,
+	arm_r_r11_t0_c9,
+	arm_r_r12_t0_c9,
+	arm_r_r13_t0_c9,
+	arm_r_r14_t0_c9,
+	arm_r_r15_t0_c9,
+	arm_r_r0_t1_c9,
+	arm_r_r1_t1_c9,
+	arm_r_r2_t1_c9,
+	arm_r_r3_t1_c9,
+	arm_r_r4_t1_c9,
+	arm_r_r5_t1_c9,
+	arm_r_r6_t1_c9,
+	arm_r_r7_t1_c9,
+	arm_r_r8_t1_c9,
+	arm_r_r9_t1_c9,
+	arm_r_r10_t1_c9,
+	arm_r_r11_t1_c9,
+	arm_r_r12_t1_c9,
+	arm_r_r13_t1_c9,
+	arm_r_r14_t1_c9,
+	arm_r_r15_t1_c9,
+	arm_r_r0_t2_c9,
+	arm_r_r1_t2_c9,
+	arm_r_r2_t2_c9,
+	arm_r_r3_t2_c9,
+	arm_r_r4_t2_c9,
+	arm_r_r5_t2_c9,
+	arm_r_r6_t2_c9,
+	arm_r_r7_t2_c9,
+	arm_r_r8_t2_c9,
+	arm_r_r9_t2_c9,
+	arm_r_r10_t2_c9,
+	arm_r_r11_t2_c9,
+	arm_r_r12_t2_c9,
+	arm_r_r13_t2_c9,
+	arm_r_r14_t2_c9,
+	arm_r_r15_t2_c9,
+	arm_r_r0_t3_c9,
+	arm_r_r1_t3_c9,
+	arm_r_r2_t3_c9,
+	arm_r_r3_t3_c9,
+	arm_r_r4_t3_c9,
+	arm_r_r5_t3_c9,
+	arm_r_r6_t3_c9,
+	arm_r_r7_t3_c9,
+	arm_r_r8_t3_c9,
+	arm_r_r9_t3_c9,
+	arm_r_r10_t3_c9,
+	arm_r_r11_t3_c9,
+	arm_r_r12_t3_c9,
+	arm_r_r13_t3_c9,
+	arm_r_r14_t3_c9,
+	arm_r_r15_t3_c9,
+	arm_r_r0_t4_c9,
+	arm_r_r1_t4_c9,
+	arm_r_r2_t4_c9,
+	arm_r_r3_t4_c9,
+	arm_r_r4_t4_c9,
+	arm_r_r5_t4_c9,
+	arm_r_r6_t4_c9,
+	arm_r_r7_t4_c9,
+	arm_r_r8_t4_c9,
+	arm_r_r9_t4_c9,
+	arm_r_r10_t4_c9,
+	arm_r_r11_t4_c9,
+	arm_r_r12_t4_c9,
+	arm_r_r13_t4_c9,
+	arm_r_r14_t4_c9,
+	arm_r_r15_t4_c9,
+	arm_r_r0_t5_c9,
+	arm_r_r1_t5_c9,
+	arm_r_r2_t5_c9,
+	arm_r_r3_t5_c9,
+	arm_r_r4_t5_c9,
+	arm_r_r5_t5_c9,
+	arm_r_r6_t5_c9,
+	arm_r_r7_t5_c9,
+	arm_r_r8_t5_c9,
+	arm_r_r9_t5_c9,
+	arm_r_r10_t5_c9,
+	arm_r_r11_t5_c9,
+	arm_r_r12_t5_c9,
+	arm_r_r13_t5_c9,
+	arm_r_r14_t5_c9,
+	arm_r_r15_t5_c9,
+	arm_r_r0_t6_c9,
+	arm_r_r1_t6_c9,
+	arm_r_r2_t6_c9,
+	arm_r_r3_t6_c9,
+	arm_r_r4_t6_c9,
+	arm_r_r5_t6_c9,
+	arm_r_r6_t6_c9,
+	arm_r_r7_t6_c9,
+	arm_r_r8_t6_c9,
+	arm_r_r9_t6_c9,
+	arm_r_r10_t6_c9,
+	arm_r_r11_t6_c9,
+	arm_r_r12_t6_c9,
+	arm_r_r13_t6_c9,
+	arm_r_r14_t6_c9,
+	arm_r_r15_t6_c9,
+	arm_r_r0_t7_c9,
+	arm_r_r1_t7_c9,
+	arm_r_r2_t7_c9,
+	arm_r_r3_t7_c9,
+	arm_r_r4_t7_c9,
+	arm_r_r5_t7_c9,
+	arm_r_r6_t7_c9,
+	arm_r_r7_t7_c9,
+	arm_r_r8_t7_c9,
+	arm_r_r9_t7_c9,
+	arm_r_r10_t7_c9,
+	arm_r_r11_t7_c9,
+	arm_r_r12_t7_c9,
+	arm_r_r13_t7_c9,
+	arm_r_r14_t7_c9,
+	arm_r_r15_t7_c9,
+	arm_r_r0_t0_c10,
+	arm_r_r1_t0_c10,
+	arm_r_r2_t0_c10,
+	arm_r_r3_t0_c10,
+	arm_r_r4_t0_c10,
+	arm_r_r5_t0_c10,
+	arm_r_r6_t0_c10,
+	arm_r_r7_t0_c10,
+	arm_r_r8_t0_c10,
+	arm_r_r9_t0_c10,
+	arm_r_r10_t0_c10,
+	arm_r_r11_t0_c10,
+	arm_r_r12_t0_c10,
+	arm_r_r13_t0_c10,
+	arm_r_r14_t0_c10,
+	arm_r_r15_t0_c10,
+	arm_r_r0_t1_c10,
+	arm_r_r1_t1_c10,
+	arm_r_r2_t1_c10,
+	arm_r_r3_t1_c10,
+	arm_r_r4_t1_c10,
+	arm_r_r5_t1_c10,
+	arm_r_r6_t1_c10,
+	arm_r_r7_t1_c10,
+	arm_r_r8_t1_c10,
+	arm_r_r9_t1_c10,
+	arm_r_r10_t1_c10,
+	arm_r_r11_t1_c10,
+	arm_r_r12_t1_c10,
+	arm_r_r13_t1_c10,
+	arm_r_r14_t1_c10,
+	arm_r_r15_t1_c10,
+	arm_r_r0_t2_c10,
+	arm_r_r1_t2_c10,
+	arm_r_r2_t2_c10,
+	arm_r_r3_t2_c10,
+	arm_r_r4_t2_c10,
+	arm_r_r5_t2_c10,
+	arm_r_r6_t2_c10,
+	arm_r_r7_t2_c10,
+	arm_r_r8_t2_c10,
+	arm_r_r9_t2_c10,
+	arm_r_r10_t2_c10,
+	arm_r_r11_t2_c10,
+	arm_r_r12_t2_c10,
+	arm_r_r13_t2_c10,
+	arm_r_r14_t2_c10,
+	arm_r_r15_t2_c10,
+	arm_r_r0_t3_c10,
+	arm_r_r1_t3_c10,
+	arm_r_r2_t3_c10,
+	arm_r_r3_t3_c10,
+	arm_r_r4_t3_c10,
+	arm_r_r5_t3_c10,
+	arm_r_r6_t3_c10,
+	arm_r_r7_t3_c10,
+	arm_r_r8_t3_c10,
+	arm_r_r9_t3_c10,
+	arm_r_r10_t3_c10,
+	arm_r_r11_t3_c10,
+	arm_r_r12_t3_c10,
+	arm_r_r13_t3_c10,
+	arm_r_r14_t3_c10,
+	arm_r_r15_t3_c10,
+	arm_r_r0_t4_c10,
+	arm_r_r1_t4_c10,
+	arm_r_r2_t4_c10,
+	arm_r_r3_t4_c10,
+	arm_r_r4_t4_c10,
+	arm_r_r5_t4_c10,
+	arm_r_r6_t4_c10,
+	arm_r_r7_t4_c10,
+	arm_r_r8_t4_c10,
+	arm_r_r9_t4_c10,
+	arm_r_r10_t4_c10,
+	arm_r_r11_t4_c10,
+	arm_r_r12_t4_c10,
+	arm_r_r13_t4_c10,
+	arm_r_r14_t4_c10,
+	arm_r_r15_t4_c10,
+	arm_r_r0_t5_c10,
+	arm_r_r1_t5_c10,
+	arm_r_r2_t5_c10,
+	arm_r_r3_t5_c10,
+	arm_r_r4_t5_c10,
+	arm_r_r5_t5_c10,
+	arm_r_r6_t5_c10,
+	arm_r_r7_t5_c10,
+	arm_r_r8_t5_c10,
+	arm_r_r9_t5_c10,
+	arm_r_r10_t5_c10,
+	arm_r_r11_t5_c10,
+	arm_r_r12_t5_c10,
+	arm_r_r13_t5_c10,
+	arm_r_r14_t5_c10,
+	arm_r_r15_t5_c10,
+	arm_r_r0_t6_c10,
+	arm_r_r1_t6_c10,
+	arm_r_r2_t6_c10,
+	arm_r_r3_t6_c10,
+	arm_r_r4_t6_c10,
+	arm_r_r5_t6_c10,
+	arm_r_r6_t6_c10,
+	arm_r_r7_t6_c10,
+	arm_r_r8_t6_c10,
+	arm_r_r9_t6_c10,
+	arm_r_r10_t6_c10,
+	arm_r_r11_t6_c10,
+	arm_r_r12_t6_c10,
+	arm_r_r13_t6_c10,
+	arm_r_r14_t6_c10,
+	arm_r_r15_t6_c10,
+	arm_r_r0_t7_c10,
+	arm_r_r1_t7_c10,
+	arm_r_r2_t7_c10,
+	arm_r_r3_t7_c10,
+	arm_r_r4_t7_c10,
+	arm_r_r5_t7_c10,
+	arm_r_r6_t7_c10,
+	arm_r_r7_t7_c10,
+	arm_r_r8_t7_c10,
+	arm_r_r9_t7_c10,
+	arm_r_r10_t7_c10,
+	arm_r_r11_t7_c10,
+	arm_r_r12_t7_c10,
+	arm_r_r13_t7_c10,
+	arm_r_r14_t7_c10,
+	arm_r_r15_t7_c10,
+	arm_r_r0_t0_c11,
+	arm_r_r1_t0_c11,
+	arm_r_r2_t0_c11,
+	arm_r_r3_t0_c11,
+	arm_r_r4_t0_c11,
+	arm_r_r5_t0_c11,
+	arm_r_r6_t0_c11,
+	arm_r_r7_t0_c11,
+	arm_r_r8_t0_c11,
+	arm_r_r9_t0_c11,
+	arm_r_r10_t0_c11,
+	arm_r_r11_t0_c11,
+	arm_r_r12_t0_c11,
+	arm_r_r13_t0_c11,
+	arm_r_r14_t0_c11,
+	arm_r_r15_t0_c11,
+	arm_r_r0_t1_c11,
+	arm_r_r1_t1_c11,
+	arm_r_r2_t1_c11,
+	arm_r_r3_t1_c11,
+	arm_r_r4_t1_c11,
+	arm_r_r5_t1_c11,
+	arm_r_r6_t1_c11,
+	arm_r_r7_t1_c11,
+	arm_r_r8_t1_c11,
+	arm_r_r9_t1_c11,
+	arm_r_r10_t1_c11,
+	arm_r_r11_t1_c11,
+	arm_r_r12_t1_c11,
+	arm_r_r13_t1_c11,
+	arm_r_r14_t1_c11,
+	arm_r_r15_t1_c11,
+	arm_r_r0_t2_c11,
+	arm_r_r1_t2_c11,
+	arm_r_r2_t2_c11,
+	arm_r_r3_t2_c11,
+	arm_r_r4_t2_c11,
+	arm_r_r5_t2_c11,
+	arm_r_r6_t2_c11,
+	arm_r_r7_t2_c11,
+	arm_r_r8_t2_c11,
+	arm_r_r9_t2_c11,
+	arm_r_r10_t2_c11,
+	arm_r_r11_t2_c11,
+	arm_r_r12_t2_c11,
+	arm_r_r13_t2_c11,
+	arm_r_r14_t2_c11,
+	arm_r_r15_t2_c11,
+	arm_r_r0_t3_c11,
+	arm_r_r1_t3_c11,
+	arm_r_r2_t3_c11,
+	arm_r_r3_t3_c11,
+	arm_r_r4_t3_c11,
+	arm_r_r5_t3_c11,
+	arm_r_r6_t3_c11,
+	arm_r_r7_t3_c11,
+	arm_r_r8_t3_c11,
+	arm_r_r9_t3_c11,
+	arm_r_r10_t3_c11,
+	arm_r_r11_t3_c11,
+	arm_r_r12_t3_c11,
+	arm_r_r13_t3_c11,
+	arm_r_r14_t3_c11,
+	arm_r_r15_t3_c11,
+	arm_r_r0_t4_c11,
+	arm_r_r1_t4_c11,
+	arm_r_r2_t4_c11,
+	arm_r_r3_t4_c11,
+	arm_r_r4_t4_c11,
+	arm_r_r5_t4_c11,
+	arm_r_r6_t4_c11,
+	arm_r_r7_t4_c11,
+	arm_r_r8_t4_c11,
+	arm_r_r9_t4_c11,
+	arm_r_r10_t4_c11,
+	arm_r_r11_t4_c11,
+	arm_r_r12_t4_c11,
+	arm_r_r13_t4_c11,
+	arm_r_r14_t4_c11,
+	arm_r_r15_t4_c11,
+	arm_r_r0_t5_c11,
+	arm_r_r1_t5_c11,
+	arm_r_r2_t5_c11,
+	arm_r_r3_t5_c11,
+	arm_r_r4_t5_c11,
+	arm_r_r5_t5_c11,
+	arm_r_r6_t5_c11,
+	arm_r_r7_t5_c11,
+	arm_r_r8_t5_c11,
+	arm_r_r9_t5_c11,
+	arm_r_r10_t5_c11,
+	arm_r_r11_t5_c11,
+	arm_r_r12_t5_c11,
+	arm_r_r13_t5_c11,
+	arm_r_r14_t5_c11,
+	arm_r_r15_t5_c11,
+	arm_r_r0_t6_c11,
+	arm_r_r1_t6_c11,
+	arm_r_r2_t6_c11,
+	arm_r_r3_t6_c11,
+	arm_r_r4_t6_c11,
+	arm_r_r5_t6_c11,
+	arm_r_r6_t6_c11,
+	arm_r_r7_t6_c11,
+	arm_r_r8_t6_c11,
+	arm_r_r9_t6_c11,
+	arm_r_r10_t6_c11,
+	arm_r_r11_t6_c11,
+	arm_r_r12_t6_c11,
+	arm_r_r13_t6_c11,
+	arm_r_r14_t6_c11,
+	arm_r_r15_t6_c11,
+	arm_r_r0_t7_c11,
+	arm_r_r1_t7_c11,
+	arm_r_r2_t7_c11,
+	arm_r_r3_t7_c11,
+	arm_r_r4_t7_c11,
+	arm_r_r5_t7_c11,
+	arm_r_r6_t7_c11,
+	arm_r_r7_t7_c11,
+	arm_r_r8_t7_c11,
+	arm_r_r9_t7_c11,
+	arm_r_r10_t7_c11,
+	arm_r_r11_t7_c11,
+	arm_r_r12_t7_c11,
+	arm_r_r13_t7_c11,
+	arm_r_r14_t7_c11,
+	arm_r_r15_t7_c11,
+	arm_r_r0_t0_c12,
+	arm_r_r1_t0_c12,
+	arm_r_r2_t0_c12,
+	arm_r_r3_t0_c12,
+	arm_r_r4_t0_c12,
+	arm_r_r5_t0_c12,
+	arm_r_r6_t0_c12,
+	arm_r_r7_t0_c12,
+	arm_r_r8_t0_c12,
+	arm_r_r9_t0_c12,
+	arm_r_r10_t0_c12,
+	arm_r_r11_t0_c12,
+	arm_r_r12_t0_c12,
+	arm_r_r13_t0_c12,
+	arm_r_r14_t0_c12,
+	arm_r_r15_t0_c12,
+	arm_r_r0_t1_c12,
+	arm_r_r1_t1_c12,
+	arm_r_r2_t1_c12,
+	arm_r_r3_t1_c12,
+	arm_r_r4_t1_c12,
+	arm_r_r5_t1_c12,
+	arm_r_r6_t1_c12,
+	arm_r_r7_t1_c12,
+	arm_r_r8_t1_c12,
+	arm_r_r9_t1_c12,
+	arm_r_r10_t1_c12,
+	arm_r_r11_t1_c12,
+	arm_r_r12_t1_c12,
+	arm_r_r13_t1_c12,
+	arm_r_r14_t1_c12,
+	arm_r_r15_t1_c12,
+	arm_r_r0_t2_c12,
+	arm_r_r1_t2_c12,
+	arm_r_r2_t2_c12,
+	arm_r_r3_t2_c12,
+	arm_r_r4_t2_c12,
+	arm_r_r5_t2_c12,
+	arm_r_r6_t2_c12,
+	arm_r_r7_t2_c12,
+	arm_r_r8_t2_c12,
+	arm_r_r9_t2_c12,
+	arm_r_r10_t2_c12,
+	arm_r_r11_t2_c12,
+	arm_r_r12_t2_c12,
+	arm_r_r13_t2_c12,
+	arm_r_r14_t2_c12,
+	arm_r_r15_t2_c12,
+	arm_r_r0_t3_c12,
+	arm_r_r1_t3_c12,
+	arm_r_r2_t3_c12,
+	arm_r_r3_t3_c12,
+	arm_r_r4_t3_c12,
+	arm_r_r5_t3_c12,
+	arm_r_r6_t3_c12,
+	arm_r_r7_t3_c12,
+	arm_r_r8_t3_c12,
+	arm_r_r9_t3_c12,
+	arm_r_r10_t3_c12,
+	arm_r_r11_t3_c12,
+	arm_r_r12_t3_c12,
+	arm_r_r13_t3_c12,
+	arm_r_r14_t3_c12,
+	arm_r_r15_t3_c12,
+	arm_r_r0_t4_c12,
+	arm_r_r1_t4_c12,
+	arm_r_r2_t4_c12,
+	arm_r_r3_t4_c12,
+	arm_r_r4_t4_c12,
+	arm_r_r5_t4_c12,
+	arm_r_r6_t4_c12,
+	arm_r_r7_t4_c12,
+	arm_r_r8_t4_c12,
+	arm_r_r9_t4_c12,
+	arm_r_r10_t4_c12,
+	arm_r_r11_t4_c12,
+	arm_r_r12_t4_c12,
+	arm_r_r13_t4_c12,
+	arm_r_r14_t4_c12,
+	arm_r_r15_t4_c12,
+	arm_r_r0_t5_c12,
+	arm_r_r1_t5_c12,
+	arm_r_r2_t5_c12,
+	arm_r_r3_t5_c12,
+	arm_r_r4_t5_c12,
+	arm_r_r5_t5_c12,
+	arm_r_r6_t5_c12,
+	arm_r_r7_t5_c12,
+	arm_r_r8_t5_c12,
+	arm_r_r9_t5_c12,
+	arm_r_r10_t5_c12,
+	arm_r_r11_t5_c12,
+	arm_r_r12_t5_c12,
+	arm_r_r13_t5_c12,
+	arm_r_r14_t5_c12,
+	arm_r_r15_t5_c12,
+	arm_r_r0_t6_c12,
+	arm_r_r1_t6_c12,
+	arm_r_r2_t6_c12,
+	arm_r_r3_t6_c12,
+	arm_r_r4_t6_c12,
+	arm_r_r5_t6_c12,
+	arm_r_r6_t6_c12,
+	arm_r_r7_t6_c12,
+	arm_r_r8_t6_c12,
+	arm_r_r9_t6_c12,
+	arm_r_r10_t6_c12,
+	arm_r_r11_t6_c12,
+	arm_r_r12_t6_c12,
+	arm_r_r13_t6_c12,
+	arm_r_r14_t6_c12,
+	arm_r_r15_t6_c12,
+	arm_r_r0_t7_c12,
+	arm_r_r1_t7_c12,
+	arm_r_r2_t7_c12,
+	arm_r_r3_t7_c12,
+	arm_r_r4_t7_c12,
+	arm_r_r5_t7_c12,
+	arm_r_r6_t7_c12,
+	arm_r_r7_t7_c12,
+	arm_r_r8_t7_c12,
+	arm_r_r9_t7_c12,
+	arm_r_r10_t7_c12,
+	arm_r_r11_t7_c12,
+	arm_r_r12_t7_c12,
+	arm_r_r13_t7_c12,
+	arm_r_r14_t7_c12,
+	arm_r_r15_t7_c12,
+	arm_r_r0_t0_c13,
+	arm_r_r1_t0_c13,
+	arm_r_r2_t0_c13,
+	arm_r_r3_t0_c13,
+	arm_r_r4_t0_c13,
+	arm_r_r5_t0_c13,
+	arm_r_r6_t0_c13,
+	arm_r_r7_t0_c13,
+	arm_r_r8_t0_c13,
+	arm_r_r9_t0_c13,
+	arm_r_r10_t0_c13,
+	arm_r_r11_t0_c13,
+	arm_r_r12_t0_c13,
+	arm_r_r13_t0_c13,
+	arm_r_r14_t0_c13,
+	arm_r_r15_t0_c13,
+	arm_r_r0_t1_c13,
+	arm_r_r1_t1_c13,
+	arm_r_r2_t1_c13,
+	arm_r_r3_t1_c13,
+	arm_r_r4_t1_c13,
+	arm_r_r5_t1_c13,
+	arm_r_r6_t1_c13,
+	arm_r_r7_t1_c13,
+	arm_r_r8_t1_c13,
+	arm_r_r9_t1_c13,
+	arm_r_r10_t1_c13,
+	arm_r_r11_t1_c13,
+	arm_r_r12_t1_c13,
+	arm_r_r13_t1_c13,
+	arm_r_r14_t1_c13,
+	arm_r_r15_t1_c13,
+	arm_r_r0_t2_c13,
+	arm_r_r1_t2_c13,
+	arm_r_r2_t2_c13,
+	arm_r_r3_t2_c13,
+	arm_r_r4_t2_c13,
+	arm_r_r5_t2_c13,
+	arm_r_r6_t2_c13,
+	arm_r_r7_t2_c13,
+	arm_r_r8_t2_c13,
+	arm_r_r9_t2_c13,
+	arm_r_r10_t2_c13,
+	arm_r_r11_t2_c13,
+	arm_r_r12_t2_c13,
+	arm_r_r13_t2_c13,
+	arm_r_r14_t2_c13,
+	arm_r_r15_t2_c13,
+	arm_r_r0_t3_c13,
+	arm_r_r1_t3_c13,
+	arm_r_r2_t3_c13,
+	arm_r_r3_t3_c13,
+	arm_r_r4_t3_c13,
+	arm_r_r5_t3_c13,
+	arm_r_r6_t3_c13,
+	arm_r_r7_t3_c13,
+	arm_r_r8_t3_c13,
+	arm_r_r9_t3_c13,
+	arm_r_r10_t3_c13,
+	arm_r_r11_t3_c13,
+	arm_r_r12_t3_c13,
+	arm_r_r13_t3_c13,
+	arm_r_r14_t3_c13,
+	arm_r_r15_t3_c13,
+	arm_r_r0_t4_c13,
+	arm_r_r1_t4_c13,
+	arm_r_r2_t4_c13,
+	arm_r_r3_t4_c13,
+	arm_r_r4_t4_c13,
+	arm_r_r5_t4_c13,
+	arm_r_r6_t4_c13,
+	arm_r_r7_t4_c13,
+	arm_r_r8_t4_c13,
+	arm_r_r9_t4_c13,
+	arm_r_r10_t4_c13,
+	arm_r_r11_t4_c13,
+	arm_r_r12_t4_c13,
+	arm_r_r13_t4_c13,
+	arm_r_r14_t4_c13,
+	arm_r_r15_t4_c13,
+	arm_r_r0_t5_c13,
+	arm_r_r1_t5_c13,
+	arm_r_r2_t5_c13,
+	arm_r_r3_t5_c13,
+	arm_r_r4_t5_c13,
+	arm_r_r5_t5_c13,
+	arm_r_r6_t5_c13,
+	arm_r_r7_t5_c13,
+	arm_r_r8_t5_c13,
+	arm_r_r9_t5_c13,
+	arm_r_r10_t5_c13,
+	arm_r_r11_t5_c13,
+	arm_r_r12_t5_c13,
+	arm_r_r13_t5_c13,
+	arm_r_r14_t5_c13,
+	arm_r_r15_t5_c13,
+	arm_r_r0_t6_c13,
+	arm_r_r1_t6_c13,
+	arm_r_r2_t6_c13,
+	arm_r_r3_t6_c13,
+	arm_r_r4_t6_c13,
+	arm_r_r5_t6_c13,
+	arm_r_r6_t6_c13,
+	arm_r_r7_t6_c13,
+	arm_r_r8_t6_c13,
+	arm_r_r9_t6_c13,
+	arm_r_r10_t6_c13,
+	arm_r_r11_t6_c13,
+	arm_r_r12_t6_c13,
+	arm_r_r13_t6_c13,
+	arm_r_r14_t6_c13,
+	arm_r_r15_t6_c13,
+	arm_r_r0_t7_c13,
+	arm_r_r1_t7_c13,
+	arm_r_r2_t7_c13,
+	arm_r_r3_t7_c13,
+	arm_r_r4_t7_c13,
+	arm_r_r5_t7_c13,
+	arm_r_r6_t7_c13,
+	arm_r_r7_t7_c13,
+	arm_r_r8_t7_c13,
+	arm_r_r9_t7_c13,
+	arm_r_r10_t7_c13,
+	arm_r_r11_t7_c13,
+	arm_r_r12_t7_c13,
+	arm_r_r13_t7_c13,
+	arm_r_r14_t7_c13,
+	arm_r_r15_t7_c13,
+	arm_r_r0_t0_c14,
+	arm_r_r1_t0_c14,
+	arm_r_r2_t0_c14,
+	arm_r_r3_t0_c14,
+	arm_r_r4_t0_c14,
+	arm_r_r5_t0_c14,
+	arm_r_r6_t0_c14,
+	arm_r_r7_t0_c14,
+	arm_r_r8_t0_c14,
+	arm_r_r9_t0_c14,
+	arm_r_r10_t0_c14,
+	arm_r_r11_t0_c14,
+	arm_r_r12_t0_c14,
+	arm_r_r13_t0_c14,
+	arm_r_r14_t0_c14,
+	arm_r_r15_t0_c14,
+	arm_r_r0_t1_c14,
+	arm_r_r1_t1_c14,
+	arm_r_r2_t1_c14,
+	arm_r_r3_t1_c14,
+	arm_r_r4_t1_c14,
+	arm_r_r5_t1_c14,
+	arm_r_r6_t1_c14,
+	arm_r_r7_t1_c14,
+	arm_r_r8_t1_c14,
+	arm_r_r9_t1_c14,
+	arm_r_r10_t1_c14,
+	arm_r_r11_t1_c14,
+	arm_r_r12_t1_c14,
+	arm_r_r13_t1_c14,
+	arm_r_r14_t1_c14,
+	arm_r_r15_t1_c14,
+	arm_r_r0_t2_c14,
+	arm_r_r1_t2_c14,
+	arm_r_r2_t2_c14,
+	arm_r_r3_t2_c14,
+	arm_r_r4_t2_c14,
+	arm_r_r5_t2_c14,
+	arm_r_r6_t2_c14,
+	arm_r_r7_t2_c14,
+	arm_r_r8_t2_c14,
+	arm_r_r9_t2_c14,
+	arm_r_r10_t2_c14,
+	arm_r_r11_t2_c14,
+	arm_r_r12_t2_c14,
+	arm_r_r13_t2_c14,
+	arm_r_r14_t2_c14,
+	arm_r_r15_t2_c14,
+	arm_r_r0_t3_c14,
+	arm_r_r1_t3_c14,
+	arm_r_r2_t3_c14,
+	arm_r_r3_t3_c14,
+	arm_r_r4_t3_c14,
+	arm_r_r5_t3_c14,
+	arm_r_r6_t3_c14,
+	arm_r_r7_t3_c14,
+	arm_r_r8_t3_c14,
+	arm_r_r9_t3_c14,
+	arm_r_r10_t3_c14,
+	arm_r_r11_t3_c14,
+	arm_r_r12_t3_c14,
+	arm_r_r13_t3_c14,
+	arm_r_r14_t3_c14,
+	arm_r_r15_t3_c14,
+	arm_r_r0_t4_c14,
+	arm_r_r1_t4_c14,
+	arm_r_r2_t4_c14,
+	arm_r_r3_t4_c14,
+	arm_r_r4_t4_c14,
+	arm_r_r5_t4_c14,
+	arm_r_r6_t4_c14,
+	arm_r_r7_t4_c14,
+	arm_r_r8_t4_c14,
+	arm_r_r9_t4_c14,
+	arm_r_r10_t4_c14,
+	arm_r_r11_t4_c14,
+	arm_r_r12_t4_c14,
+	arm_r_r13_t4_c14,
+	arm_r_r14_t4_c14,
+	arm_r_r15_t4_c14,
+	arm_r_r0_t5_c14,
+	arm_r_r1_t5_c14,
+	arm_r_r2_t5_c14,
+	arm_r_r3_t5_c14,
+	arm_r_r4_t5_c14,
+	arm_r_r5_t5_c14,
+	arm_r_r6_t5_c14,
+	arm_r_r7_t5_c14,
+	arm_r_r8_t5_c14,
+	arm_r_r9_t5_c14,
+	arm_r_r10_t5_c14,
+	arm_r_r11_t5_c14,
+	arm_r_r12_t5_c14,
+	arm_r_r13_t5_c14,
+	arm_r_r14_t5_c14,
+	arm_r_r15_t5_c14,
+	arm_r_r0_t6_c14,
+	arm_r_r1_t6_c14,
+	arm_r_r2_t6_c14,
+	arm_r_r3_t6_c14,
+	arm_r_r4_t6_c14,
+	arm_r_r5_t6_c14,
+	arm_r_r6_t6_c14,
+	arm_r_r7_t6_c14,
+	arm_r_r8_t6_c14,
+	arm_r_r9_t6_c14,
+	arm_r_r10_t6_c14,
+	arm_r_r11_t6_c14,
+	arm_r_r12_t6_c14,
+	arm_r_r13_t6_c14,
+	arm_r_r14_t6_c14,
+	arm_r_r15_t6_c14,
+	arm_r_r0_t7_c14,
+	arm_r_r1_t7_c14,
+	arm_r_r2_t7_c14,
+	arm_r_r3_t7_c14,
+	arm_r_r4_t7_c14,
+	arm_r_r5_t7_c14,
+	arm_r_r6_t7_c14,
+	arm_r_r7_t7_c14,
+	arm_r_r8_t7_c14,
+	arm_r_r9_t7_c14,
+	arm_r_r10_t7_c14,
+	arm_r_r11_t7_c14,
+	arm_r_r12_t7_c14,
+	arm_r_r13_t7_c14,
+	arm_r_r14_t7_c14,
+	arm_r_r15_t7_c14,
+	arm_r_r0_t0_c15,
+	arm_r_r1_t0_c15,
+	arm_r_r2_t0_c15,
+	arm_r_r3_t0_c15,
+	arm_r_r4_t0_c15,
+	arm_r_r5_t0_c15,
+	arm_r_r6_t0_c15,
+	arm_r_r7_t0_c15,
+	arm_r_r8_t0_c15,
+	arm_r_r9_t0_c15,
+	arm_r_r10_t0_c15,
+	arm_r_r11_t0_c15,
+	arm_r_r12_t0_c15,
+	arm_r_r13_t0_c15,
+	arm_r_r14_t0_c15,
+	arm_r_r15_t0_c15,
+	arm_r_r0_t1_c15,
+	arm_r_r1_t1_c15,
+	arm_r_r2_t1_c15,
+	arm_r_r3_t1_c15,
+	arm_r_r4_t1_c15,
+	arm_r_r5_t1_c15,
+	arm_r_r6_t1_c15,
+	arm_r_r7_t1_c15,
+	arm_r_r8_t1_c15,
+	arm_r_r9_t1_c15,
+	arm_r_r10_t1_c15,
+	arm_r_r11_t1_c15,
+	arm_r_r12_t1_c15,
+	arm_r_r13_t1_c15,
+	arm_r_r14_t1_c15,
+	arm_r_r15_t1_c15,
+	arm_r_r0_t2_c15,
+	arm_r_r1_t2_c15,
+	arm_r_r2_t2_c15,
+	arm_r_r3_t2_c15,
+	arm_r_r4_t2_c15,
+	arm_r_r5_t2_c15,
+	arm_r_r6_t2_c15,
+	arm_r_r7_t2_c15,
+	arm_r_r8_t2_c15,
+	arm_r_r9_t2_c15,
+	arm_r_r10_t2_c15,
+	arm_r_r11_t2_c15,
+	arm_r_r12_t2_c15,
+	arm_r_r13_t2_c15,
+	arm_r_r14_t2_c15,
+	arm_r_r15_t2_c15,
+	arm_r_r0_t3_c15,
+	arm_r_r1_t3_c15,
+	arm_r_r2_t3_c15,
+	arm_r_r3_t3_c15,
+	arm_r_r4_t3_c15,
+	arm_r_r5_t3_c15,
+	arm_r_r6_t3_c15,
+	arm_r_r7_t3_c15,
+	arm_r_r8_t3_c15,
+	arm_r_r9_t3_c15,
+	arm_r_r10_t3_c15,
+	arm_r_r11_t3_c15,
+	arm_r_r12_t3_c15,
+	arm_r_r13_t3_c15,
+	arm_r_r14_t3_c15,
+	arm_r_r15_t3_c15,
+	arm_r_r0_t4_c15,
+	arm_r_r1_t4_c15,
+	arm_r_r2_t4_c15,
+	arm_r_r3_t4_c15,
+	arm_r_r4_t4_c15,
+	arm_r_r5_t4_c15,
+	arm_r_r6_t4_c15,
+	arm_r_r7_t4_c15,
+	arm_r_r8_t4_c15,
+	arm_r_r9_t4_c15,
+	arm_r_r10_t4_c15,
+	arm_r_r11_t4_c15,
+	arm_r_r12_t4_c15,
+	arm_r_r13_t4_c15,
+	arm_r_r14_t4_c15,
+	arm_r_r15_t4_c15,
+	arm_r_r0_t5_c15,
+	arm_r_r1_t5_c15,
+	arm_r_r2_t5_c15,
+	arm_r_r3_t5_c15,
+	arm_r_r4_t5_c15,
+	arm_r_r5_t5_c15,
+	arm_r_r6_t5_c15,
+	arm_r_r7_t5_c15,
+	arm_r_r8_t5_c15,
+	arm_r_r9_t5_c15,
+	arm_r_r10_t5_c15,
+	arm_r_r11_t5_c15,
+	arm_r_r12_t5_c15,
+	arm_r_r13_t5_c15,
+	arm_r_r14_t5_c15,
+	arm_r_r15_t5_c15,
+	arm_r_r0_t6_c15,
+	arm_r_r1_t6_c15,
+	arm_r_r2_t6_c15,
+	arm_r_r3_t6_c15,
+	arm_r_r4_t6_c15,
+	arm_r_r5_t6_c15,
+	arm_r_r6_t6_c15,
+	arm_r_r7_t6_c15,
+	arm_r_r8_t6_c15,
+	arm_r_r9_t6_c15,
+	arm_r_r10_t6_c15,
+	arm_r_r11_t6_c15,
+	arm_r_r12_t6_c15,
+	arm_r_r13_t6_c15,
+	arm_r_r14_t6_c15,
+	arm_r_r15_t6_c15,
+	arm_r_r0_t7_c15,
+	arm_r_r1_t7_c15,
+	arm_r_r2_t7_c15,
+	arm_r_r3_t7_c15,
+	arm_r_r4_t7_c15,
+	arm_r_r5_t7_c15,
+	arm_r_r6_t7_c15,
+	arm_r_r7_t7_c15,
+	arm_r_r8_t7_c15,
+	arm_r_r9_t7_c15,
+	arm_r_r10_t7_c15,
+	arm_r_r11_t7_c15,
+	arm_r_r12_t7_c15,
+	arm_r_r13_t7_c15,
+	arm_r_r14_t7_c15,
+	arm_r_r15_t7_c15,
+	arm_r_r0_t0_c16,
+	arm_r_r1_t0_c16,
+	arm_r_r2_t0_c16,
+	arm_r_r3_t0_c16,
+	arm_r_r4_t0_c16,
+	arm_r_r5_t0_c16,
+	arm_r_r6_t0_c16,
+	arm_r_r7_t0_c16,
+	arm_r_r8_t0_c16,
+	arm_r_r9_t0_c16,
+	arm_r_r10_t0_c16,
+	arm_r_r11_t0_c16,
+	arm_r_r12_t0_c16,
+	arm_r_r13_t0_c16,
+	arm_r_r14_t0_c16,
+	arm_r_r15_t0_c16,
+	arm_r_r0_t1_c16,
+	arm_r_r1_t1_c16,
+	arm_r_r2_t1_c16,
+	arm_r_r3_t1_c16,
+	arm_r_r4_t1_c16,
+	arm_r_r5_t1_c16,
+	arm_r_r6_t1_c16,
+	arm_r_r7_t1_c16,
+	arm_r_r8_t1_c16,
+	arm_r_r9_t1_c16,
+	arm_r_r10_t1_c16,
+	arm_r_r11_t1_c16,
+	arm_r_r12_t1_c16,
+	arm_r_r13_t1_c16,
+	arm_r_r14_t1_c16,
+	arm_r_r15_t1_c16,
+	arm_r_r0_t2_c16,
+	arm_r_r1_t2_c16,
+	arm_r_r2_t2_c16,
+	arm_r_r3_t2_c16,
+	arm_r_r4_t2_c16,
+	arm_r_r5_t2_c16,
+	arm_r_r6_t2_c16,
+	arm_r_r7_t2_c16,
+	arm_r_r8_t2_c16,
+	arm_r_r9_t2_c16,
+	arm_r_r10_t2_c16,
+	arm_r_r11_t2_c16,
+	arm_r_r12_t2_c16,
+	arm_r_r13_t2_c16,
+	arm_r_r14_t2_c16,
+	arm_r_r15_t2_c16,
+	arm_r_r0_t3_c16,
+	arm_r_r1_t3_c16,
+	arm_r_r2_t3_c16,
+	arm_r_r3_t3_c16,
+	arm_r_r4_t3_c16,
+	arm_r_r5_t3_c16,
+	arm_r_r6_t3_c16,
+	arm_r_r7_t3_c16,
+	arm_r_r8_t3_c16,
+	arm_r_r9_t3_c16,
+	arm_r_r10_t3_c16,
+	arm_r_r11_t3_c16,
+	arm_r_r12_t3_c16,
+	arm_r_r13_t3_c16,
+	arm_r_r14_t3_c16,
+	arm_r_r15_t3_c16,
+	arm_r_r0_t4_c16,
+	arm_r_r1_t4_c16,
+	arm_r_r2_t4_c16,
+	arm_r_r3_t4_c16,
+	arm_r_r4_t4_c16,
+	arm_r_r5_t4_c16,
+	arm_r_r6_t4_c16,
+	arm_r_r7_t4_c16,
+	arm_r_r8_t4_c16,
+	arm_r_r9_t4_c16,
+	arm_r_r10_t4_c16,
+	arm_r_r11_t4_c16,
+	arm_r_r12_t4_c16,
+	arm_r_r13_t4_c16,
+	arm_r_r14_t4_c16,
+	arm_r_r15_t4_c16,
+	arm_r_r0_t5_c16,
+	arm_r_r1_t5_c16,
+	arm_r_r2_t5_c16,
+	arm_r_r3_t5_c16,
+	arm_r_r4_t5_c16,
+	arm_r_r5_t5_c16,
+	arm_r_r6_t5_c16,
+	arm_r_r7_t5_c16,
+	arm_r_r8_t5_c16,
+	arm_r_r9_t5_c16,
+	arm_r_r10_t5_c16,
+	arm_r_r11_t5_c16,
+	arm_r_r12_t5_c16,
+	arm_r_r13_t5_c16,
+	arm_r_r14_t5_c16,
+	arm_r_r15_t5_c16,
+	arm_r_r0_t6_c16,
+	arm_r_r1_t6_c16,
+	arm_r_r2_t6_c16,
+	arm_r_r3_t6_c16,
+	arm_r_r4_t6_c16,
+	arm_r_r5_t6_c16,
+	arm_r_r6_t6_c16,
+	arm_r_r7_t6_c16,
+	arm_r_r8_t6_c16,
+	arm_r_r9_t6_c16,
+	arm_r_r10_t6_c16,
+	arm_r_r11_t6_c16,
+	arm_r_r12_t6_c16,
+	arm_r_r13_t6_c16,
+	arm_r_r14_t6_c16,
+	arm_r_r15_t6_c16,
+	arm_r_r0_t7_c16,
+	arm_r_r1_t7_c16,
+	arm_r_r2_t7_c16,
+	arm_r_r3_t7_c16,
+	arm_r_r4_t7_c16,
+	arm_r_r5_t7_c16,
+	arm_r_r6_t7_c16,
+	arm_r_r7_t7_c16,
+	arm_r_r8_t7_c16,
+	arm_r_r9_t7_c16,
+	arm_r_r10_t7_c16,
+	arm_r_r11_t7_c16,
+	arm_r_r12_t7_c16,
+	arm_r_r13_t7_c16,
+	arm_r_r14_t7_c16,
+	arm_r_r15_t7_c16,
+	arm_r_r0_t0_c17,
+	arm_r_r1_t0_c17,
+	arm_r_r2_t0_c17,
+	arm_r_r3_t0_c17,
+	arm_r_r4_t0_c17,
+	arm_r_r5_t0_c17,
+	arm_r_r6_t0_c17,
+	arm_r_r7_t0_c17,
+	arm_r_r8_t0_c17,
+	arm_r_r9_t0_c17,
+	arm_r_r10_t0_c17,
+	arm_r_r11_t0_c17,
+	arm_r_r12_t0_c17,
+	arm_r_r13_t0_c17,
+	arm_r_r14_t0_c17,
+	arm_r_r15_t0_c17,
+	arm_r_r0_t1_c17,
+	arm_r_r1_t1_c17,
+	arm_r_r2_t1_c17,
+	arm_r_r3_t1_c17,
+	arm_r_r4_t1_c17,
+	arm_r_r5_t1_c17,
+	arm_r_r6_t1_c17,
+	arm_r_r7_t1_c17,
+	arm_r_r8_t1_c17,
+	arm_r_r9_t1_c17,
+	arm_r_r10_t1_c17,
+	arm_r_r11_t1_c17,
+	arm_r_r12_t1_c17,
+	arm_r_r13_t1_c17,
+	arm_r_r14_t1_c17,
+	arm_r_r15_t1_c17,
+	arm_r_r0_t2_c17,
+	arm_r_r1_t2_c17,
+	arm_r_r2_t2_c17,
+	arm_r_r3_t2_c17,
+	arm_r_r4_t2_c17,
+	arm_r_r5_t2_c17,
+	arm_r_r6_t2_c17,
+	arm_r_r7_t2_c17,
+	arm_r_r8_t2_c17,
+	arm_r_r9_t2_c17,
+	arm_r_r10_t2_c17,
+	arm_r_r11_t2_c17,
+	arm_r_r12_t2_c17,
+	arm_r_r13_t2_c17,
+	arm_r_r14_t2_c17,
+	arm_r_r15_t2_c17,
+	arm_r_r0_t3_c17,
+	arm_r_r1_t3_c17,
+	arm_r_r2_t3_c17,
+	arm_r_r3_t3_c17,
+	arm_r_r4_t3_c17,
+	arm_r_r5_t3_c17,
+	arm_r_r6_t3_c17,
+	arm_r_r7_t3_c17,
+	arm_r_r8_t3_c17,
+	arm_r_r9_t3_c17,
+	arm_r_r10_t3_c17,
+	arm_r_r11_t3_c17,
+	arm_r_r12_t3_c17,
+	arm_r_r13_t3_c17,
+	arm_r_r14_t3_c17,
+	arm_r_r15_t3_c17,
+	arm_r_r0_t4_c17,
+	arm_r_r1_t4_c17,
+	arm_r_r2_t4_c17,
+	arm_r_r3_t4_c17,
+	arm_r_r4_t4_c17,
+	arm_r_r5_t4_c17,
+	arm_r_r6_t4_c17,
+	arm_r_r7_t4_c17,
+	arm_r_r8_t4_c17,
+	arm_r_r9_t4_c17,
+	arm_r_r10_t4_c17,
+	arm_r_r11_t4_c17,
+	arm_r_r12_t4_c17,
+	arm_r_r13_t4_c17,
+	arm_r_r14_t4_c17,
+	arm_r_r15_t4_c17,
+	arm_r_r0_t5_c17,
+	arm_r_r1_t5_c17,
+	arm_r_r2_t5_c17,
+	arm_r_r3_t5_c17,
+	arm_r_r4_t5_c17,
+	arm_r_r5_t5_c17,
+	arm_r_r6_t5_c17,
+	arm_r_r7_t5_c17,
+	arm_r_r8_t5_c17,
+	arm_r_r9_t5_c17,
+	arm_r_r10_t5_c17,
+	arm_r_r11_t5_c17,
+	arm_r_r12_t5_c17,
+	arm_r_r13_t5_c17,
+	arm_r_r14_t5_c17,
+	arm_r_r15_t5_c17,
+	arm_r_r0_t6_c17,
+	arm_r_r1_t6_c17,
+	arm_r_r2_t6_c17,
+	arm_r_r3_t6_c17,
+	arm_r_r4_t6_c17,
+	arm_r_r5_t6_c17,
+	arm_r_r6_t6_c17,
+	arm_r_r7_t6_c17,
+	arm_r_r8_t6_c17,
+	arm_r_r9_t6_c17,
+	arm_r_r10_t6_c17,
+	arm_r_r11_t6_c17,
+	arm_r_r12_t6_c17,
+	arm_r_r13_t6_c17,
+	arm_r_r14_t6_c17,
+	arm_r_r15_t6_c17,
+	arm_r_r0_t7_c17,
+	arm_r_r1_t7_c17,
+	arm_r_r2_t7_c17,
+	arm_r_r3_t7_c17,
+	arm_r_r4_t7_c17,
+	arm_r_r5_t7_c17,
+	arm_r_r6_t7_c17,
+	arm_r_r7_t7_c17,
+	arm_r_r8_t7_c17,
+	arm_r_r9_t7_c17,
+	arm_r_r10_t7_c17,
+	arm_r_r11_t7_c17,
+	arm_r_r12_t7_c17,
+	arm_r_r13_t7_c17,
+	arm_r_r14_t7_c17,
+	arm_r_r15_t7_c17,
+	arm_r_r0_t0_c18,
+	arm_r_r1_t0_c18,
+	arm_r_r2_t0_c18,
+	arm_r_r3_t0_c18,
+	arm_r_r4_t0_c18,
+	arm_r_r5_t0_c18,
+	arm_r_r6_t0_c18,
+	arm_r_r7_t0_c18,
+	arm_r_r8_t0_c18,
+	arm_r_r9_t0_c18,
+	arm_r_r10_t0_c18,
+	arm_r_r11_t0_c18,
+	arm_r_r12_t0_c18,
+	arm_r_r13_t0_c18,
+	arm_r_r14_t0_c18,
+	arm_r_r15_t0_c18,
+	arm_r_r0_t1_c18,
+	arm_r_r1_t1_c18,
+	arm_r_r2_t1_c18,
+	arm_r_r3_t1_c18,
+	arm_r_r4_t1_c18,
+	arm_r_r5_t1_c18,
+	arm_r_r6_t1_c18,
+	arm_r_r7_t1_c18,
+	arm_r_r8_t1_c18,
+	arm_r_r9_t1_c18,
+	arm_r_r10_t1_c18,
+	arm_r_r11_t1_c18,
+	arm_r_r12_t1_c18,
+	arm_r_r13_t1_c18,
+	arm_r_r14_t1_c18,
+	arm_r_r15_t1_c18,
+	arm_r_r0_t2_c18,
+	arm_r_r1_t2_c18,
+	arm_r_r2_t2_c18,
+	arm_r_r3_t2_c18,
+	arm_r_r4_t2_c18,
+	arm_r_r5_t2_c18,
+	arm_r_r6_t2_c18,
+	arm_r_r7_t2_c18,
+	arm_r_r8_t2_c18,
+	arm_r_r9_t2_c18,
+	arm_r_r10_t2_c18,
+	arm_r_r11_t2_c18,
+	arm_r_r12_t2_c18,
+	arm_r_r13_t2_c18,
+	arm_r_r14_t2_c18,
+	arm_r_r15_t2_c18,
+	arm_r_r0_t3_c18,
+	arm_r_r1_t3_c18,
+	arm_r_r2_t3_c18,
+	arm_r_r3_t3_c18,
+	arm_r_r4_t3_c18,
+	arm_r_r5_t3_c18,
+	arm_r_r6_t3_c18,
+	arm_r_r7_t3_c18,
+	arm_r_r8_t3_c18,
+	arm_r_r9_t3_c18,
+	arm_r_r10_t3_c18,
+	arm_r_r11_t3_c18,
+	arm_r_r12_t3_c18,
+	arm_r_r13_t3_c18,
+	arm_r_r14_t3_c18,
+	arm_r_r15_t3_c18,
+	arm_r_r0_t4_c18,
+	arm_r_r1_t4_c18,
+	arm_r_r2_t4_c18,
+	arm_r_r3_t4_c18,
+	arm_r_r4_t4_c18,
+	arm_r_r5_t4_c18,
+	arm_r_r6_t4_c18,
+	arm_r_r7_t4_c18,
+	arm_r_r8_t4_c18,
+	arm_r_r9_t4_c18,
+	arm_r_r10_t4_c18,
+	arm_r_r11_t4_c18,
+	arm_r_r12_t4_c18,
+	arm_r_r13_t4_c18,
+	arm_r_r14_t4_c18,
+	arm_r_r15_t4_c18,
+	arm_r_r0_t5_c18,
+	arm_r_r1_t5_c18,
+	arm_r_r2_t5_c18,
+	arm_r_r3_t5_c18,
+	arm_r_r4_t5_c18,
+	arm_r_r5_t5_c18,
+	arm_r_r6_t5_c18,
+	arm_r_r7_t5_c18,
+	arm_r_r8_t5_c18,
+	arm_r_r9_t5_c18,
+	arm_r_r10_t5_c18,
+	arm_r_r11_t5_c18,
+	arm_r_r12_t5_c18,
+	arm_r_r13_t5_c18,
+	arm_r_r14_t5_c18,
+	arm_r_r15_t5_c18,
+	arm_r_r0_t6_c18,
+	arm_r_r1_t6_c18,
+	arm_r_r2_t6_c18,
+	arm_r_r3_t6_c18,
+	arm_r_r4_t6_c18,
+	arm_r_r5_t6_c18,
+	arm_r_r6_t6_c18,
+	arm_r_r7_t6_c18,
+	arm_r_r8_t6_c18,
+	arm_r_r9_t6_c18,
+	arm_r_r10_t6_c18,
+	arm_r_r11_t6_c18,
+	arm_r_r12_t6_c18,
+	arm_r_r13_t6_c18,
+	arm_r_r14_t6_c18,
+	arm_r_r15_t6_c18,
+	arm_r_r0_t7_c18,
+	arm_r_r1_t7_c18,
+	arm_r_r2_t7_c18,
+	arm_r_r3_t7_c18,
+	arm_r_r4_t7_c18,
+	arm_r_r5_t7_c18,
+	arm_r_r6_t7_c18,
+	arm_r_r7_t7_c18,
+	arm_r_r8_t7_c18,
+	arm_r_r9_t7_c18,
+	arm_r_r10_t7_c18,
+	arm_r_r11_t7_c18,
+	arm_r_r12_t7_c18,
+	arm_r_r13_t7_c18,
+	arm_r_r14_t7_c18,
+	arm_r_r15_t7_c18,
+	arm_r_r0_t0_c19,
+	arm_r_r1_t0_c19,
+	arm_r_r2_t0_c19,
+	arm_r_r3_t0_c19,
+	arm_r_r4_t0_c19,
+	arm_r_r5_t0_c19,
+	arm_r_r6_t0_c19,
+	arm_r_r7_t0_c19,
+	arm_r_r8_t0_c19,
+	arm_r_r9_t0_c19,
+	arm_r_r10_t0_c19,
+	arm_r_r11_t0_c19,
+	arm_r_r12_t0_c19,
+	arm_r_r13_t0_c19,
+	arm_r_r14_t0_c19,
+	arm_r_r15_t0_c19,
+	arm_r_r0_t1_c19,
+	arm_r_r1_t1_c19,
+	arm_r_r2_t1_c19,
+	arm_r_r3_t1_c19,
+	arm_r_r4_t1_c19,
+	arm_r_r5_t1_c19,
+	arm_r_r6_t1_c19,
+	arm_r_r7_t1_c19,
+	arm_r_r8_t1_c19,
+	arm_r_r9_t1_c19,
+	arm_r_r10_t1_c19,
+	arm_r_r11_t1_c19,
+	arm_r_r12_t1_c19,
+	arm_r_r13_t1_c19,
+	arm_r_r14_t1_c19,
+	arm_r_r15_t1_c19,
+	arm_r_r0_t2_c19,
+	arm_r_r1_t2_c19,
+	arm_r_r2_t2_c19,
+	arm_r_r3_t2_c19,
+	arm_r_r4_t2_c19,
+	arm_r_r5_t2_c19,
+	arm_r_r6_t2_c19,
+	arm_r_r7_t2_c19,
+	arm_r_r8_t2_c19,
+	arm_r_r9_t2_c19,
+	arm_r_r10_t2_c19,
+	arm_r_r11_t2_c19,
+	arm_r_r12_t2_c19,
+	arm_r_r13_t2_c19,
+	arm_r_r14_t2_c19,
+	arm_r_r15_t2_c19,
+	arm_r_r0_t3_c19,
+	arm_r_r1_t3_c19,
+	arm_r_r2_t3_c19,
+	arm_r_r3_t3_c19,
+	arm_r_r4_t3_c19,
+	arm_r_r5_t3_c19,
+	arm_r_r6_t3_c19,
+	arm_r_r7_t3_c19,
+	arm_r_r8_t3_c19,
+	arm_r_r9_t3_c19,
+	arm_r_r10_t3_c19,
+	arm_r_r11_t3_c19,
+	arm_r_r12_t3_c19,
+	arm_r_r13_t3_c19,
+	arm_r_r14_t3_c19,
+	arm_r_r15_t3_c19,
+	arm_r_r0_t4_c19,
+	arm_r_r1_t4_c19,
+	arm_r_r2_t4_c19,
+	arm_r_r3_t4_c19,
+	arm_r_r4_t4_c19,
+	arm_r_r5_t4_c19,
+	arm_r_r6_t4_c19,
+	arm_r_r7_t4_c19,
+	arm_r_r8_t4_c19,
+	arm_r_r9_t4_c19,
+	arm_r_r10_t4_c19,
+	arm_r_r11_t4_c19,
+	arm_r_r12_t4_c19,
+	arm_r_r13_t4_c19,
+	arm_r_r14_t4_c19,
+	arm_r_r15_t4_c19,
+	arm_r_r0_t5_c19,
+	arm_r_r1_t5_c19,
+	arm_r_r2_t5_c19,
+	arm_r_r3_t5_c19,
+	arm_r_r4_t5_c19,
+	arm_r_r5_t5_c19,
+	arm_r_r6_t5_c19,
+	arm_r_r7_t5_c19,
+	arm_r_r8_t5_c19,
+	arm_r_r9_t5_c19,
+	arm_r_r10_t5_c19,
+	arm_r_r11_t5_c19,
+	arm_r_r12_t5_c19,
+	arm_r_r13_t5_c19,
+	arm_r_r14_t5_c19,
+	arm_r_r15_t5_c19,
+	arm_r_r0_t6_c19,
+	arm_r_r1_t6_c19,
+	arm_r_r2_t6_c19,
+	arm_r_r3_t6_c19,
+	arm_r_r4_t6_c19,
+	arm_r_r5_t6_c19,
+	arm_r_r6_t6_c19,
+	arm_r_r7_t6_c19,
+	arm_r_r8_t6_c19,
+	arm_r_r9_t6_c19,
+	arm_r_r10_t6_c19,
+	arm_r_r11_t6_c19,
+	arm_r_r12_t6_c19,
+	arm_r_r13_t6_c19,
+	arm_r_r14_t6_c19,
+	arm_r_r15_t6_c19,
+	arm_r_r0_t7_c19,
+	arm_r_r1_t7_c19,
+	arm_r_r2_t7_c19,
+	arm_r_r3_t7_c19,
+	arm_r_r4_t7_c19,
+	arm_r_r5_t7_c19,
+	arm_r_r6_t7_c19,
+	arm_r_r7_t7_c19,
+	arm_r_r8_t7_c19,
+	arm_r_r9_t7_c19,
+	arm_r_r10_t7_c19,
+	arm_r_r11_t7_c19,
+	arm_r_r12_t7_c19,
+	arm_r_r13_t7_c19,
+	arm_r_r14_t7_c19,
+	arm_r_r15_t7_c19,
+	arm_r_r0_t0_c20,
+	arm_r_r1_t0_c20,
+	arm_r_r2_t0_c20,
+	arm_r_r3_t0_c20,
+	arm_r_r4_t0_c20,
+	arm_r_r5_t0_c20,
+	arm_r_r6_t0_c20,
+	arm_r_r7_t0_c20,
+	arm_r_r8_t0_c20,
+	arm_r_r9_t0_c20,
+	arm_r_r10_t0_c20,
+	arm_r_r11_t0_c20,
+	arm_r_r12_t0_c20,
+	arm_r_r13_t0_c20,
+	arm_r_r14_t0_c20,
+	arm_r_r15_t0_c20,
+	arm_r_r0_t1_c20,
+	arm_r_r1_t1_c20,
+	arm_r_r2_t1_c20,
+	arm_r_r3_t1_c20,
+	arm_r_r4_t1_c20,
+	arm_r_r5_t1_c20,
+	arm_r_r6_t1_c20,
+	arm_r_r7_t1_c20,
+	arm_r_r8_t1_c20,
+	arm_r_r9_t1_c20,
+	arm_r_r10_t1_c20,
+	arm_r_r11_t1_c20,
+	arm_r_r12_t1_c20,
+	arm_r_r13_t1_c20,
+	arm_r_r14_t1_c20,
+	arm_r_r15_t1_c20,
+	arm_r_r0_t2_c20,
+	arm_r_r1_t2_c20,
+	arm_r_r2_t2_c20,
+	arm_r_r3_t2_c20,
+	arm_r_r4_t2_c20,
+	arm_r_r5_t2_c20,
+	arm_r_r6_t2_c20,
+	arm_r_r7_t2_c20,
+	arm_r_r8_t2_c20,
+	arm_r_r9_t2_c20,
+	arm_r_r10_t2_c20,
+	arm_r_r11_t2_c20,
+	arm_r_r12_t2_c20,
+	arm_r_r13_t2_c20,
+	arm_r_r14_t2_c20,
+	arm_r_r15_t2_c20,
+	arm_r_r0_t3_c20,
+	arm_r_r1_t3_c20,
+	arm_r_r2_t3_c20,
+	arm_r_r3_t3_c20,
+	arm_r_r4_t3_c20,
+	arm_r_r5_t3_c20,
+	arm_r_r6_t3_c20,
+	arm_r_r7_t3_c20,
+	arm_r_r8_t3_c20,
+	arm_r_r9_t3_c20,
+	arm_r_r10_t3_c20,
+	arm_r_r11_t3_c20,
+	arm_r_r12_t3_c20,
+	arm_r_r13_t3_c20,
+	arm_r_r14_t3_c20,
+	arm_r_r15_t3_c20,
+	arm_r_r0_t4_c20,
+	arm_r_r1_t4_c20,
+	arm_r_r2_t4_c20,
+	arm_r_r3_t4_c20,
+	arm_r_r4_t4_c20,
+	arm_r_r5_t4_c20,
+	arm_r_r6_t4_c20,
+	arm_r_r7_t4_c20,
+	arm_r_r8_t4_c20,
+	arm_r_r9_t4_c20,
+	arm_r_r10_t4_c20,
+	arm_r_r11_t4_c20,
+	arm_r_r12_t4_c20,
+	arm_r_r13_t4_c20,
+	arm_r_r14_t4_c20,
+	arm_r_r15_t4_c20,
+	arm_r_r0_t5_c20,
+	arm_r_r1_t5_c20,
+	arm_r_r2_t5_c20,
+	arm_r_r3_t5_c20,
+	arm_r_r4_t5_c20,
+	arm_r_r5_t5_c20,
+	arm_r_r6_t5_c20,
+	arm_r_r7_t5_c20,
+	arm_r_r8_t5_c20,
+	arm_r_r9_t5_c20,
+	arm_r_r10_t5_c20,
+	arm_r_r11_t5_c20,
+	arm_r_r12_t5_c20,
+	arm_r_r13_t5_c20,
+	arm_r_r14_t5_c20,
+	arm_r_r15_t5_c20,
+	arm_r_r0_t6_c20,
+	arm_r_r1_t6_c20,
+	arm_r_r2_t6_c20,
+	arm_r_r3_t6_c20,
+	arm_r_r4_t6_c20,
+	arm_r_r5_t6_c20,
+	arm_r_r6_t6_c20,
+	arm_r_r7_t6_c20,
+	arm_r_r8_t6_c20,
+	arm_r_r9_t6_c20,
+	arm_r_r10_t6_c20,
+	arm_r_r11_t6_c20,
+	arm_r_r12_t6_c20,
+	arm_r_r13_t6_c20,
+	arm_r_r14_t6_c20,
+	arm_r_r15_t6_c20,
+	arm_r_r0_t7_c20,
+	arm_r_r1_t7_c20,
+	arm_r_r2_t7_c20,
+	arm_r_r3_t7_c20,
+	arm_r_r4_t7_c20,
+	arm_r_r5_t7_c20,
+	arm_r_r6_t7_c20,
+	arm_r_r7_t7_c20,
+	arm_r_r8_t7_c20,
+	arm_r_r9_t7_c20,
+	arm_r_r10_t7_c20,
+	arm_r_r11_t7_c20,
+	arm_r_r12_t7_c20,
+	arm_r_r13_t7_c20,
+	arm_r_r14_t7_c20,
+	arm_r_r15_t7_c20,
+	arm_r_r0_t0_c21,
+	arm_r_r1_t0_c21,
+	arm_r_r2_t0_c21,
+	arm_r_r3_t0_c21,
+	arm_r_r4_t0_c21,
+	arm_r_r5_t0_c21,
+	arm_r_r6_t0_c21,
+	arm_r_r7_t0_c21,
+	arm_r_r8_t0_c21,
+	arm_r_r9_t0_c21,
+	arm_r_r10_t0_c21,
+	arm_r_r11_t0_c21,
+	arm_r_r12_t0_c21,
+	arm_r_r13_t0_c21,
+	arm_r_r14_t0_c21,
+	arm_r_r15_t0_c21,
+	arm_r_r0_t1_c21,
+	arm_r_r1_t1_c21,
+	arm_r_r2_t1_c21,
+	arm_r_r3_t1_c21,
+	arm_r_r4_t1_c21,
+	arm_r_r5_t1_c21,
+	arm_r_r6_t1_c21,
+	arm_r_r7_t1_c21,
+	arm_r_r8_t1_c21,
+	arm_r_r9_t1_c21,
+	arm_r_r10_t1_c21,
+	arm_r_r11_t1_c21,
+	arm_r_r12_t1_c21,
+	arm_r_r13_t1_c21,
+	arm_r_r14_t1_c21,
+	arm_r_r15_t1_c21,
+	arm_r_r0_t2_c21,
+	arm_r_r1_t2_c21,
+	arm_r_r2_t2_c21,
+	arm_r_r3_t2_c21,
+	arm_r_r4_t2_c21,
+	arm_r_r5_t2_c21,
+	arm_r_r6_t2_c21,
+	arm_r_r7_t2_c21,
+	arm_r_r8_t2_c21,
+	arm_r_r9_t2_c21,
+	arm_r_r10_t2_c21,
+	arm_r_r11_t2_c21,
+	arm_r_r12_t2_c21,
+	arm_r_r13_t2_c21,
+	arm_r_r14_t2_c21,
+	arm_r_r15_t2_c21,
+	arm_r_r0_t3_c21,
+	arm_r_r1_t3_c21,
+	arm_r_r2_t3_c21,
+	arm_r_r3_t3_c21,
+	arm_r_r4_t3_c21,
+	arm_r_r5_t3_c21,
+	arm_r_r6_t3_c21,
+	arm_r_r7_t3_c21,
+	arm_r_r8_t3_c21,
+	arm_r_r9_t3_c21,
+	arm_r_r10_t3_c21,
+	arm_r_r11_t3_c21,
+	arm_r_r12_t3_c21,
+	arm_r_r13_t3_c21,
+	arm_r_r14_t3_c21,
+	arm_r_r15_t3_c21,
+	arm_r_r0_t4_c21,
+	arm_r_r1_t4_c21,
+	arm_r_r2_t4_c21,
+	arm_r_r3_t4_c21,
+	arm_r_r4_t4_c21,
+	arm_r_r5_t4_c21,
+	arm_r_r6_t4_c21,
+	arm_r_r7_t4_c21,
+	arm_r_r8_t4_c21,
+	arm_r_r9_t4_c21,
+	arm_r_r10_t4_c21,
+	arm_r_r11_t4_c21,
+	arm_r_r12_t4_c21,
+	arm_r_r13_t4_c21,
+	arm_r_r14_t4_c21,
+	arm_r_r15_t4_c21,
+	arm_r_r0_t5_c21,
+	arm_r_r1_t5_c21,
+	arm_r_r2_t5_c21,
+	arm_r_r3_t5_c21,
+	arm_r_r4_t5_c21,
+	arm_r_r5_t5_c21,
+	arm_r_r6_t5_c21,
+	arm_r_r7_t5_c21,
+	arm_r_r8_t5_c21,
+	arm_r_r9_t5_c21,
+	arm_r_r10_t5_c21,
+	arm_r_r11_t5_c21,
+	arm_r_r12_t5_c21,
+	arm_r_r13_t5_c21,
+	arm_r_r14_t5_c21,
+	arm_r_r15_t5_c21,
+	arm_r_r0_t6_c21,
+	arm_r_r1_t6_c21,
+	arm_r_r2_t6_c21,
+	arm_r_r3_t6_c21,
+	arm_r_r4_t6_c21,
+	arm_r_r5_t6_c21,
+	arm_r_r6_t6_c21,
+	arm_r_r7_t6_c21,
+	arm_r_r8_t6_c21,
+	arm_r_r9_t6_c21,
+	arm_r_r10_t6_c21,
+	arm_r_r11_t6_c21,
+	arm_r_r12_t6_c21,
+	arm_r_r13_t6_c21,
+	arm_r_r14_t6_c21,
+	arm_r_r15_t6_c21,
+	arm_r_r0_t7_c21,
+	arm_r_r1_t7_c21,
+	arm_r_r2_t7_c21,
+	arm_r_r3_t7_c21,
+	arm_r_r4_t7_c21,
+	arm_r_r5_t7_c21,
+	arm_r_r6_t7_c21,
+	arm_r_r7_t7_c21,
+	arm_r_r8_t7_c21,
+	arm_r_r9_t7_c21,
+	arm_r_r10_t7_c21,
+	arm_r_r11_t7_c21,
+	arm_r_r12_t7_c21,
+	arm_r_r13_t7_c21,
+	arm_r_r14_t7_c21,
+	arm_r_r15_t7_c21,
+	arm_r_r0_t0_c22,
+	arm_r_r1_t0_c22,
+	arm_r_r2_t0_c22,
+	arm_r_r3_t0_c22,
+	arm_r_r4_t0_c22,
+	arm_r_r5_t0_c22,
+	arm_r_r6_t0_c22,
+	arm_r_r7_t0_c22,
+	arm_r_r8_t0_c22,
+	arm_r_r9_t0_c22,
+	arm_r_r10_t0_c22,
+	arm_r_r11_t0_c22,
+	arm_r_r12_t0_c22,
+	arm_r_r13_t0_c22,
+	arm_r_r14_t0_c22,
+	arm_r_r15_t0_c22,
+	arm_r_r0_t1_c22,
+	arm_r_r1_t1_c22,
+	arm_r_r2_t1_c22,
+	arm_r_r3_t1_c22,
+	arm_r_r4_t1_c22,
+	arm_r_r5_t1_c22,
+	arm_r_r6_t1_c22,
+	arm_r_r7_t1_c22,
+	arm_r_r8_t1_c22,
+	arm_r_r9_t1_c22,
+	arm_r_r10_t1_c22,
+	arm_r_r11_t1_c22,
+	arm_r_r12_t1_c22,
+	arm_r_r13_t1_c22,
+	arm_r_r14_t1_c22,
+	arm_r_r15_t1_c22,
+	arm_r_r0_t2_c22,
+	arm_r_r1_t2_c22,
+	arm_r_r2_t2_c22,
+	arm_r_r3_t2_c22,
+	arm_r_r4_t2_c22,
+	arm_r_r5_t2_c22,
+	arm_r_r6_t2_c22,
+	arm_r_r7_t2_c22,
+	arm_r_r8_t2_c22,
+	arm_r_r9_t2_c22,
+	arm_r_r10_t2_c22,
+	arm_r_r11_t2_c22,
+	arm_r_r12_t2_c22,
+	arm_r_r13_t2_c22,
+	arm_r_r14_t2_c22,
+	arm_r_r15_t2_c22,
+	arm_r_r0_t3_c22,
+	arm_r_r1_t3_c22,
+	arm_r_r2_t3_c22,
+	arm_r_r3_t3_c22,
+	arm_r_r4_t3_c22,
+	arm_r_r5_t3_c22,
+	arm_r_r6_t3_c22,
+	arm_r_r7_t3_c22,
+	arm_r_r8_t3_c22,
+	arm_r_r9_t3_c22,
+	arm_r_r10_t3_c22,
+	arm_r_r11_t3_c22,
+	arm_r_r12_t3_c22,
+	arm_r_r13_t3_c22,
+	arm_r_r14_t3_c22,
+	arm_r_r15_t3_c22,
+	arm_r_r0_t4_c22,
+	arm_r_r1_t4_c22,
+	arm_r_r2_t4_c22,
+	arm_r_r3_t4_c22,
+	arm_r_r4_t4_c22,
+	arm_r_r5_t4_c22,
+	arm_r_r6_t4_c22,
+	arm_r_r7_t4_c22,
+	arm_r_r8_t4_c22,
+	arm_r_r9_t4_c22,
+	arm_r_r10_t4_c22,
+	arm_r_r11_t4_c22,
+	arm_r_r12_t4_c22,
+	arm_r_r13_t4_c22,
+	arm_r_r14_t4_c22,
+	arm_r_r15_t4_c22,
+	arm_r_r0_t5_c22,
+	arm_r_r1_t5_c22,
+	arm_r_r2_t5_c22,
+	arm_r_r3_t5_c22,
+	arm_r_r4_t5_c22,
+	arm_r_r5_t5_c22,
+	arm_r_r6_t5_c22,
+	arm_r_r7_t5_c22,
+	arm_r_r8_t5_c22,
+	arm_r_r9_t5_c22,
+	arm_r_r10_t5_c22,
+	arm_r_r11_t5_c22,
+	arm_r_r12_t5_c22,
+	arm_r_r13_t5_c22,
+	arm_r_r14_t5_c22,
+	arm_r_r15_t5_c22,
+	arm_r_r0_t6_c22,
+	arm_r_r1_t6_c22,
+	arm_r_r2_t6_c22,
+	arm_r_r3_t6_c22,
+	arm_r_r4_t6_c22,
+	arm_r_r5_t6_c22,
+	arm_r_r6_t6_c22,
+	arm_r_r7_t6_c22,
+	arm_r_r8_t6_c22,
+	arm_r_r9_t6_c22,
+	arm_r_r10_t6_c22,
+	arm_r_r11_t6_c22,
+	arm_r_r12_t6_c22,
+	arm_r_r13_t6_c22,
+	arm_r_r14_t6_c22,
+	arm_r_r15_t6_c22,
+	arm_r_r0_t7_c22,
+	arm_r_r1_t7_c22,
+	arm_r_r2_t7_c22,
+	arm_r_r3_t7_c22,
+	arm_r_r4_t7_c22,
+	arm_r_r5_t7_c22,
+	arm_r_r6_t7_c22,
+	arm_r_r7_t7_c22,
+	arm_r_r8_t7_c22,
+	arm_r_r9_t7_c22,
+	arm_r_r10_t7_c22,
+	arm_r_r11_t7_c22,
+	arm_r_r12_t7_c22,
+	arm_r_r13_t7_c22,
+	arm_r_r14_t7_c22,
+	arm_r_r15_t7_c22,
+	arm_r_r0_t0_c23,
+	arm_r_r1_t0_c23,
+	arm_r_r2_t0_c23,
+	arm_r_r3_t0_c23,
+	arm_r_r4_t0_c23,
+	arm_r_r5_t0_c23,
+	arm_r_r6_t0_c23,
+	arm_r_r7_t0_c23,
+	arm_r_r8_t0_c23,
+	arm_r_r9_t0_c23,
+	arm_r_r10_t0_c23,
+	arm_r_r11_t0_c23,
+	arm_r_r12_t0_c23,
+	arm_r_r13_t0_c23,
+	arm_r_r14_t0_c23,
+	arm_r_r15_t0_c23,
+	arm_r_r0_t1_c23,
+	arm_r_r1_t1_c23,
+	arm_r_r2_t1_c23,
+	arm_r_r3_t1_c23,
+	arm_r_r4_t1_c23,
+	arm_r_r5_t1_c23,
+	arm_r_r6_t1_c23,
+	arm_r_r7_t1_c23,
+	arm_r_r8_t1_c23,
+	arm_r_r9_t1_c23,
+	arm_r_r10_t1_c23,
+	arm_r_r11_t1_c23,
+	arm_r_r12_t1_c23,
+	arm_r_r13_t1_c23,
+	arm_r_r14_t1_c23,
+	arm_r_r15_t1_c23,
+	arm_r_r0_t2_c23,
+	arm_r_r1_t2_c23,
+	arm_r_r2_t2_c23,
+	arm_r_r3_t2_c23,
+	arm_r_r4_t2_c23,
+	arm_r_r5_t2_c23,
+	arm_r_r6_t2_c23,
+	arm_r_r7_t2_c23,
+	arm_r_r8_t2_c23,
+	arm_r_r9_t2_c23,
+	arm_r_r10_t2_c23,
+	arm_r_r11_t2_c23,
+	arm_r_r12_t2_c23,
+	arm_r_r13_t2_c23,
+	arm_r_r14_t2_c23,
+	arm_r_r15_t2_c23,
+	arm_r_r0_t3_c23,
+	arm_r_r1_t3_c23,
+	arm_r_r2_t3_c23,
+	arm_r_r3_t3_c23,
+	arm_r_r4_t3_c23,
+	arm_r_r5_t3_c23,
+	arm_r_r6_t3_c23,
+	arm_r_r7_t3_c23,
+	arm_r_r8_t3_c23,
+	arm_r_r9_t3_c23,
+	arm_r_r10_t3_c23,
+	arm_r_r11_t3_c23,
+	arm_r_r12_t3_c23,
+	arm_r_r13_t3_c23,
+	arm_r_r14_t3_c23,
+	arm_r_r15_t3_c23,
+	arm_r_r0_t4_c23,
+	arm_r_r1_t4_c23,
+	arm_r_r2_t4_c23,
+	arm_r_r3_t4_c23,
+	arm_r_r4_t4_c23,
+	arm_r_r5_t4_c23,
+	arm_r_r6_t4_c23,
+	arm_r_r7_t4_c23,
+	arm_r_r8_t4_c23,
+	arm_r_r9_t4_c23,
+	arm_r_r10_t4_c23,
+	arm_r_r11_t4_c23,
+	arm_r_r12_t4_c23,
+	arm_r_r13_t4_c23,
+	arm_r_r14_t4_c23,
+	arm_r_r15_t4_c23,
+	arm_r_r0_t5_c23,
+	arm_r_r1_t5_c23,
+	arm_r_r2_t5_c23,
+	arm_r_r3_t5_c23,
+	arm_r_r4_t5_c23,
+	arm_r_r5_t5_c23,
+	arm_r_r6_t5_c23,
+	arm_r_r7_t5_c23,
+	arm_r_r8_t5_c23,
+	arm_r_r9_t5_c23,
+	arm_r_r10_t5_c23,
+	arm_r_r11_t5_c23,
+	arm_r_r12_t5_c23,
+	arm_r_r13_t5_c23,
+	arm_r_r14_t5_c23,
+	arm_r_r15_t5_c23,
+	arm_r_r0_t6_c23,
+	arm_r_r1_t6_c23,
+	arm_r_r2_t6_c23,
+	arm_r_r3_t6_c23,
+	arm_r_r4_t6_c23,
+	arm_r_r5_t6_c23,
+	arm_r_r6_t6_c23,
+	arm_r_r7_t6_c23,
+	arm_r_r8_t6_c23,
+	arm_r_r9_t6_c23,
+	arm_r_r10_t6_c23,
+	arm_r_r11_t6_c23,
+	arm_r_r12_t6_c23,
+	arm_r_r13_t6_c23,
+	arm_r_r14_t6_c23,
+	arm_r_r15_t6_c23,
+	arm_r_r0_t7_c23,
+	arm_r_r1_t7_c23,
+	arm_r_r2_t7_c23,
+	arm_r_r3_t7_c23,
+	arm_r_r4_t7_c23,
+	arm_r_r5_t7_c23,
+	arm_r_r6_t7_c23,
+	arm_r_r7_t7_c23,
+	arm_r_r8_t7_c23,
+	arm_r_r9_t7_c23,
+	arm_r_r10_t7_c23,
+	arm_r_r11_t7_c23,
+	arm_r_r12_t7_c23,
+	arm_r_r13_t7_c23,
+	arm_r_r14_t7_c23,
+	arm_r_r15_t7_c23,
+	arm_r_r0_t0_c24,
+	arm_r_r1_t0_c24,
+	arm_r_r2_t0_c24,
+	arm_r_r3_t0_c24,
+	arm_r_r4_t0_c24,
+	arm_r_r5_t0_c24,
+	arm_r_r6_t0_c24,
+	arm_r_r7_t0_c24,
+	arm_r_r8_t0_c24,
+	arm_r_r9_t0_c24,
+	arm_r_r10_t0_c24,
+	arm_r_r11_t0_c24,
+	arm_r_r12_t0_c24,
+	arm_r_r13_t0_c24,
+	arm_r_r14_t0_c24,
+	arm_r_r15_t0_c24,
+	arm_r_r0_t1_c24,
+	arm_r_r1_t1_c24,
+	arm_r_r2_t1_c24,
+	arm_r_r3_t1_c24,
+	arm_r_r4_t1_c24,
+	arm_r_r5_t1_c24,
+	arm_r_r6_t1_c24,
+	arm_r_r7_t1_c24,
+	arm_r_r8_t1_c24,
+	arm_r_r9_t1_c24,
+	arm_r_r10_t1_c24,
+	arm_r_r11_t1_c24,
+	arm_r_r12_t1_c24,
+	arm_r_r13_t1_c24,
+	arm_r_r14_t1_c24,
+	arm_r_r15_t1_c24,
+	arm_r_r0_t2_c24,
+	arm_r_r1_t2_c24,
+	arm_r_r2_t2_c24,
+	arm_r_r3_t2_c24,
+	arm_r_r4_t2_c24,
+	arm_r_r5_t2_c24,
+	arm_r_r6_t2_c24,
+	arm_r_r7_t2_c24,
+	arm_r_r8_t2_c24,
+	arm_r_r9_t2_c24,
+	arm_r_r10_t2_c24,
+	arm_r_r11_t2_c24,
+	arm_r_r12_t2_c24,
+	arm_r_r13_t2_c24,
+	arm_r_r14_t2_c24,
+	arm_r_r15_t2_c24,
+	arm_r_r0_t3_c24,
+	arm_r_r1_t3_c24,
+	arm_r_r2_t3_c24,
+	arm_r_r3_t3_c24,
+	arm_r_r4_t3_c24,
+	arm_r_r5_t3_c24,
+	arm_r_r6_t3_c24,
+	arm_r_r7_t3_c24,
+	arm_r_r8_t3_c24,
+	arm_r_r9_t3_c24,
+	arm_r_r10_t3_c24,
+	arm_r_r11_t3_c24,
+	arm_r_r12_t3_c24,
+	arm_r_r13_t3_c24,
+	arm_r_r14_t3_c24,
+	arm_r_r15_t3_c24,
+	arm_r_r0_t4_c24,
+	arm_r_r1_t4_c24,
+	arm_r_r2_t4_c24,
+	arm_r_r3_t4_c24,
+	arm_r_r4_t4_c24,
+	arm_r_r5_t4_c24,
+	arm_r_r6_t4_c24,
+	arm_r_r7_t4_c24,
+	arm_r_r8_t4_c24,
+	arm_r_r9_t4_c24,
+	arm_r_r10_t4_c24,
+	arm_r_r11_t4_c24,
+	arm_r_r12_t4_c24,
+	arm_r_r13_t4_c24,
+	arm_r_r14_t4_c24,
+	arm_r_r15_t4_c24,
+	arm_r_r0_t5_c24,
+	arm_r_r1_t5_c24,
+	arm_r_r2_t5_c24,
+	arm_r_r3_t5_c24,
+	arm_r_r4_t5_c24,
+	arm_r_r5_t5_c24,
+	arm_r_r6_t5_c24,
+	arm_r_r7_t5_c24,
+	arm_r_r8_t5_c24,
+	arm_r_r9_t5_c24,
+	arm_r_r10_t5_c24,
+	arm_r_r11_t5_c24,
+	arm_r_r12_t5_c24,
+	arm_r_r13_t5_c24,
+	arm_r_r14_t5_c24,
+	arm_r_r15_t5_c24,
+	arm_r_r0_t6_c24,
+	arm_r_r1_t6_c24,
+	arm_r_r2_t6_c24,
+	arm_r_r3_t6_c24,
+	arm_r_r4_t6_c24,
+	arm_r_r5_t6_c24,
+	arm_r_r6_t6_c24,
+	arm_r_r7_t6_c24,
+	arm_r_r8_t6_c24,
+	arm_r_r9_t6_c24,
+	arm_r_r10_t6_c24,
+	arm_r_r11_t6_c24,
+	arm_r_r12_t6_c24,
+	arm_r_r13_t6_c24,
+	arm_r_r14_t6_c24,
+	arm_r_r15_t6_c24,
+	arm_r_r0_t7_c24,
+	arm_r_r1_t7_c24,
+	arm_r_r2_t7_c24,
+	arm_r_r3_t7_c24,
+	arm_r_r4_t7_c24,
+	arm_r_r5_t7_c24,
+	arm_r_r6_t7_c24,
+	arm_r_r7_t7_c24,
+	arm_r_r8_t7_c24,
+	arm_r_r9_t7_c24,
+	arm_r_r10_t7_c24,
+	arm_r_r11_t7_c24,
+	arm_r_r12_t7_c24,
+	arm_r_r13_t7_c24,
+	arm_r_r14_t7_c24,
+	arm_r_r15_t7_c24,
+	arm_r_r0_t0_c25,
+	arm_r_r1_t0_c25,
+	arm_r_r2_t0_c25,
+	arm_r_r3_t0_c25,
+	arm_r_r4_t0_c25,
+	arm_r_r5_t0_c25,
+	arm_r_r6_t0_c25,
+	arm_r_r7_t0_c25,
+	arm_r_r8_t0_c25,
+	arm_r_r9_t0_c25,
+	arm_r_r10_t0_c25,
+	arm_r_r11_t0_c25,
+	arm_r_r12_t0_c25,
+	arm_r_r13_t0_c25,
+	arm_r_r14_t0_c25,
+	arm_r_r15_t0_c25,
+	arm_r_r0_t1_c25,
+	arm_r_r1_t1_c25,
+	arm_r_r2_t1_c25,
+	arm_r_r3_t1_c25,
+	arm_r_r4_t1_c25,
+	arm_r_r5_t1_c25,
+	arm_r_r6_t1_c25,
+	arm_r_r7_t1_c25,
+	arm_r_r8_t1_c25,
+	arm_r_r9_t1_c25,
+	arm_r_r10_t1_c25,
+	arm_r_r11_t1_c25,
+	arm_r_r12_t1_c25,
+	arm_r_r13_t1_c25,
+	arm_r_r14_t1_c25,
+	arm_r_r15_t1_c25,
+	arm_r_r0_t2_c25,
+	arm_r_r1_t2_c25,
+	arm_r_r2_t2_c25,
+	arm_r_r3_t2_c25,
+	arm_r_r4_t2_c25,
+	arm_r_r5_t2_c25,
+	arm_r_r6_t2_c25,
+	arm_r_r7_t2_c25,
+	arm_r_r8_t2_c25,
+	arm_r_r9_t2_c25,
+	arm_r_r10_t2_c25,
+	arm_r_r11_t2_c25,
+	arm_r_r12_t2_c25,
+	arm_r_r13_t2_c25,
+	arm_r_r14_t2_c25,
+	arm_r_r15_t2_c25,
+	arm_r_r0_t3_c25,
+	arm_r_r1_t3_c25,
+	arm_r_r2_t3_c25,
+	arm_r_r3_t3_c25,
+	arm_r_r4_t3_c25,
+	arm_r_r5_t3_c25,
+	arm_r_r6_t3_c25,
+	arm_r_r7_t3_c25,
+	arm_r_r8_t3_c25,
+	arm_r_r9_t3_c25,
+	arm_r_r10_t3_c25,
+	arm_r_r11_t3_c25,
+	arm_r_r12_t3_c25,
+	arm_r_r13_t3_c25,
+	arm_r_r14_t3_c25,
+	arm_r_r15_t3_c25,
+	arm_r_r0_t4_c25,
+	arm_r_r1_t4_c25,
+	arm_r_r2_t4_c25,
+	arm_r_r3_t4_c25,
+	arm_r_r4_t4_c25,
+	arm_r_r5_t4_c25,
+	arm_r_r6_t4_c25,
+	arm_r_r7_t4_c25,
+	arm_r_r8_t4_c25,
+	arm_r_r9_t4_c25,
+	arm_r_r10_t4_c25,
+	arm_r_r11_t4_c25,
+	arm_r_r12_t4_c25,
+	arm_r_r13_t4_c25,
+	arm_r_r14_t4_c25,
+	arm_r_r15_t4_c25,
+	arm_r_r0_t5_c25,
+	arm_r_r1_t5_c25,
+	arm_r_r2_t5_c25,
+	arm_r_r3_t5_c25,
+	arm_r_r4_t5_c25,
+	arm_r_r5_t5_c25,
+	arm_r_r6_t5_c25,
+	arm_r_r7_t5_c25,
+	arm_r_r8_t5_c25,
+	arm_r_r9_t5_c25,
+	arm_r_r10_t5_c25,
+	arm_r_r11_t5_c25,
+	arm_r_r12_t5_c25,
+	arm_r_r13_t5_c25,
+	arm_r_r14_t5_c25,
+	arm_r_r15_t5_c25,
+	arm_r_r0_t6_c25,
+	arm_r_r1_t6_c25,
+	arm_r_r2_t6_c25,
+	arm_r_r3_t6_c25,
+	arm_r_r4_t6_c25,
+	arm_r_r5_t6_c25,
+	arm_r_r6_t6_c25,
+	arm_r_r7_t6_c25,
+	arm_r_r8_t6_c25,
+	arm_r_r9_t6_c25,
+	arm_r_r10_t6_c25,
+	arm_r_r11_t6_c25,
+	arm_r_r12_t6_c25,
+	arm_r_r13_t6_c25,
+	arm_r_r14_t6_c25,
+	arm_r_r15_t6_c25,
+	arm_r_r0_t7_c25,
+	arm_r_r1_t7_c25,
+	arm_r_r2_t7_c25,
+	arm_r_r3_t7_c25,
+	arm_r_r4_t7_c25,
+	arm_r_r5_t7_c25,
+	arm_r_r6_t7_c25,
+	arm_r_r7_t7_c25,
+	arm_r_r8_t7_c25,
+	arm_r_r9_t7_c25,
+	arm_r_r10_t7_c25,
+	arm_r_r11_t7_c25,
+	arm_r_r12_t7_c25,
+	arm_r_r13_t7_c25,
+	arm_r_r14_t7_c25,
+	arm_r_r15_t7_c25,
+	arm_r_r0_t0_c26,
+	arm_r_r1_t0_c26,
+	arm_r_r2_t0_c26,
+	arm_r_r3_t0_c26,
+	arm_r_r4_t0_c26,
+	arm_r_r5_t0_c26,
+	arm_r_r6_t0_c26,
+	arm_r_r7_t0_c26,
+	arm_r_r8_t0_c26,
+	arm_r_r9_t0_c26,
+	arm_r_r10_t0_c26,
+	arm_r_r11_t0_c26,
+	arm_r_r12_t0_c26,
+	arm_r_r13_t0_c26,
+	arm_r_r14_t0_c26,
+	arm_r_r15_t0_c26,
+	arm_r_r0_t1_c26,
+	arm_r_r1_t1_c26,
+	arm_r_r2_t1_c26,
+	arm_r_r3_t1_c26,
+	arm_r_r4_t1_c26,
+	arm_r_r5_t1_c26,
+	arm_r_r6_t1_c26,
+	arm_r_r7_t1_c26,
+	arm_r_r8_t1_c26,
+	arm_r_r9_t1_c26,
+	arm_r_r10_t1_c26,
+	arm_r_r11_t1_c26,
+	arm_r_r12_t1_c26,
+	arm_r_r13_t1_c26,
+	arm_r_r14_t1_c26,
+	arm_r_r15_t1_c26,
+	arm_r_r0_t2_c26,
+	arm_r_r1_t2_c26,
+	arm_r_r2_t2_c26,
+	arm_r_r3_t2_c26,
+	arm_r_r4_t2_c26,
+	arm_r_r5_t2_c26,
+	arm_r_r6_t2_c26,
+	arm_r_r7_t2_c26,
+	arm_r_r8_t2_c26,
+	arm_r_r9_t2_c26,
+	arm_r_r10_t2_c26,
+	arm_r_r11_t2_c26,
+	arm_r_r12_t2_c26,
+	arm_r_r13_t2_c26,
+	arm_r_r14_t2_c26,
+	arm_r_r15_t2_c26,
+	arm_r_r0_t3_c26,
+	arm_r_r1_t3_c26,
+	arm_r_r2_t3_c26,
+	arm_r_r3_t3_c26,
+	arm_r_r4_t3_c26,
+	arm_r_r5_t3_c26,
+	arm_r_r6_t3_c26,
+	arm_r_r7_t3_c26,
+	arm_r_r8_t3_c26,
+	arm_r_r9_t3_c26,
+	arm_r_r10_t3_c26,
+	arm_r_r11_t3_c26,
+	arm_r_r12_t3_c26,
+	arm_r_r13_t3_c26,
+	arm_r_r14_t3_c26,
+	arm_r_r15_t3_c26,
+	arm_r_r0_t4_c26,
+	arm_r_r1_t4_c26,
+	arm_r_r2_t4_c26,
+	arm_r_r3_t4_c26,
+	arm_r_r4_t4_c26,
+	arm_r_r5_t4_c26,
+	arm_r_r6_t4_c26,
+	arm_r_r7_t4_c26,
+	arm_r_r8_t4_c26,
+	arm_r_r9_t4_c26,
+	arm_r_r10_t4_c26,
+	arm_r_r11_t4_c26,
+	arm_r_r12_t4_c26,
+	arm_r_r13_t4_c26,
+	arm_r_r14_t4_c26,
+	arm_r_r15_t4_c26,
+	arm_r_r0_t5_c26,
+	arm_r_r1_t5_c26,
+	arm_r_r2_t5_c26,
+	arm_r_r3_t5_c26,
+	arm_r_r4_t5_c26,
+	arm_r_r5_t5_c26,
+	arm_r_r6_t5_c26,
+	arm_r_r7_t5_c26,
+	arm_r_r8_t5_c26,
+	arm_r_r9_t5_c26,
+	arm_r_r10_t5_c26,
+	arm_r_r11_t5_c26,
+	arm_r_r12_t5_c26,
+	arm_r_r13_t5_c26,
+	arm_r_r14_t5_c26,
+	arm_r_r15_t5_c26,
+	arm_r_r0_t6_c26,
+	arm_r_r1_t6_c26,
+	arm_r_r2_t6_c26,
+	arm_r_r3_t6_c26,
+	arm_r_r4_t6_c26,
+	arm_r_r5_t6_c26,
+	arm_r_r6_t6_c26,
+	arm_r_r7_t6_c26,
+	arm_r_r8_t6_c26,
+	arm_r_r9_t6_c26,
+	arm_r_r10_t6_c26,
+	arm_r_r11_t6_c26,
+	arm_r_r12_t6_c26,
+	arm_r_r13_t6_c26,
+	arm_r_r14_t6_c26,
+	arm_r_r15_t6_c26,
+	arm_r_r0_t7_c26,
+	arm_r_r1_t7_c26,
+	arm_r_r2_t7_c26,
+	arm_r_r3_t7_c26,
+	arm_r_r4_t7_c26,
+	arm_r_r5_t7_c26,
+	arm_r_r6_t7_c26,
+	arm_r_r7_t7_c26,
+	arm_r_r8_t7_c26,
+	arm_r_r9_t7_c26,
+	arm_r_r10_t7_c26,
+	arm_r_r11_t7_c26,
+	arm_r_r12_t7_c26,
+	arm_r_r13_t7_c26,
+	arm_r_r14_t7_c26,
+	arm_r_r15_t7_c26,
+	arm_r_r0_t0_c27,
+	arm_r_r1_t0_c27,
+	arm_r_r2_t0_c27,
+	arm_r_r3_t0_c27,
+	arm_r_r4_t0_c27,
+	arm_r_r5_t0_c27,
+	arm_r_r6_t0_c27,
+	arm_r_r7_t0_c27,
+	arm_r_r8_t0_c27,
+	arm_r_r9_t0_c27,
+	arm_r_r10_t0_c27,
+	arm_r_r11_t0_c27,
+	arm_r_r12_t0_c27,
+	arm_r_r13_t0_c27,
+	arm_r_r14_t0_c27,
+	arm_r_r15_t0_c27,
+	arm_r_r0_t1_c27,
+	arm_r_r1_t1_c27,
+	arm_r_r2_t1_c27,
+	arm_r_r3_t1_c27,
+	arm_r_r4_t1_c27,
+	arm_r_r5_t1_c27,
+	arm_r_r6_t1_c27,
+	arm_r_r7_t1_c27,
+	arm_r_r8_t1_c27,
+	arm_r_r9_t1_c27,
+	arm_r_r10_t1_c27,
+	arm_r_r11_t1_c27,
+	arm_r_r12_t1_c27,
+	arm_r_r13_t1_c27,
+	arm_r_r14_t1_c27,
+	arm_r_r15_t1_c27,
+	arm_r_r0_t2_c27,
+	arm_r_r1_t2_c27,
+	arm_r_r2_t2_c27,
+	arm_r_r3_t2_c27,
+	arm_r_r4_t2_c27,
+	arm_r_r5_t2_c27,
+	arm_r_r6_t2_c27,
+	arm_r_r7_t2_c27,
+	arm_r_r8_t2_c27,
+	arm_r_r9_t2_c27,
+	arm_r_r10_t2_c27,
+	arm_r_r11_t2_c27,
+	arm_r_r12_t2_c27,
+	arm_r_r13_t2_c27,
+	arm_r_r14_t2_c27,
+	arm_r_r15_t2_c27,
+	arm_r_r0_t3_c27,
+	arm_r_r1_t3_c27,
+	arm_r_r2_t3_c27,
+	arm_r_r3_t3_c27,
+	arm_r_r4_t3_c27,
+	arm_r_r5_t3_c27,
+	arm_r_r6_t3_c27,
+	arm_r_r7_t3_c27,
+	arm_r_r8_t3_c27,
+	arm_r_r9_t3_c27,
+	arm_r_r10_t3_c27,
+	arm_r_r11_t3_c27,
+	arm_r_r12_t3_c27,
+	arm_r_r13_t3_c27,
+	arm_r_r14_t3_c27,
+	arm_r_r15_t3_c27,
+	arm_r_r0_t4_c27,
+	arm_r_r1_t4_c27,
+	arm_r_r2_t4_c27,
+	arm_r_r3_t4_c27,
+	arm_r_r4_t4_c27,
+	arm_r_r5_t4_c27,
+	arm_r_r6_t4_c27,
+	arm_r_r7_t4_c27,
+	arm_r_r8_t4_c27,
+	arm_r_r9_t4_c27,
+	arm_r_r10_t4_c27,
+	arm_r_r11_t4_c27,
+	arm_r_r12_t4_c27,
+	arm_r_r13_t4_c27,
+	arm_r_r14_t4_c27,
+	arm_r_r15_t4_c27,
+	arm_r_r0_t5_c27,
+	arm_r_r1_t5_c27,
+	arm_r_r2_t5_c27,
+	arm_r_r3_t5_c27,
+	arm_r_r4_t5_c27,
+	arm_r_r5_t5_c27,
+	arm_r_r6_t5_c27,
+	arm_r_r7_t5_c27,
+	arm_r_r8_t5_c27,
+	arm_r_r9_t5_c27,
+	arm_r_r10_t5_c27,
+	arm_r_r11_t5_c27,
+	arm_r_r12_t5_c27,
+	arm_r_r13_t5_c27,
+	arm_r_r14_t5_c27,
+	arm_r_r15_t5_c27,
+	arm_r_r0_t6_c27,
+	arm_r_r1_t6_c27,
+	arm_r_r2_t6_c27,
+	arm_r_r3_t6_c27,
+	arm_r_r4_t6_c27,
+	arm_r_r5_t6_c27,
+	arm_r_r6_t6_c27,
+	arm_r_r7_t6_c27,
+	arm_r_r8_t6_c27,
+	arm_r_r9_t6_c27,
+	arm_r_r10_t6_c27,
+	arm_r_r11_t6_c27,
+	arm_r_r12_t6_c27,
+	arm_r_r13_t6_c27,
+	arm_r_r14_t6_c27,
+	arm_r_r15_t6_c27,
+	arm_r_r0_t7_c27,
+	arm_r_r1_t7_c27,
+	arm_r_r2_t7_c27,
+	arm_r_r3_t7_c27,
+	arm_r_r4_t7_c27,
+	arm_r_r5_t7_c27,
+	arm_r_r6_t7_c27,
+	arm_r_r7_t7_c27,
+	arm_r_r8_t7_c27,
+	arm_r_r9_t7_c27,
+	arm_r_r10_t7_c27,
+	arm_r_r11_t7_c27,
+	arm_r_r12_t7_c27,
+	arm_r_r13_t7_c27,
+	arm_r_r14_t7_c27,
+	arm_r_r15_t7_c27,
+	arm_r_r0_t0_c28,
+	arm_r_r1_t0_c28,
+	arm_r_r2_t0_c28,
+	arm_r_r3_t0_c28,
+	arm_r_r4_t0_c28,
+	arm_r_r5_t0_c28,
+	arm_r_r6_t0_c28,
+	arm_r_r7_t0_c28,
+	arm_r_r8_t0_c28,
+	arm_r_r9_t0_c28,
+	arm_r_r10_t0_c28,
+	arm_r_r11_t0_c28,
+	arm_r_r12_t0_c28,
+	arm_r_r13_t0_c28,
+	arm_r_r14_t0_c28,
+	arm_r_r15_t0_c28,
+	arm_r_r0_t1_c28,
+	arm_r_r1_t1_c28,
+	arm_r_r2_t1_c28,
+	arm_r_r3_t1_c28,
+	arm_r_r4_t1_c28,
+	arm_r_r5_t1_c28,
+	arm_r_r6_t1_c28,
+	arm_r_r7_t1_c28,
+	arm_r_r8_t1_c28,
+	arm_r_r9_t1_c28,
+	arm_r_r10_t1_c28,
+	arm_r_r11_t1_c28,
+	arm_r_r12_t1_c28,
+	arm_r_r13_t1_c28,
+	arm_r_r14_t1_c28,
+	arm_r_r15_t1_c28,
+	arm_r_r0_t2_c28,
+	arm_r_r1_t2_c28,
+	arm_r_r2_t2_c28,
+	arm_r_r3_t2_c28,
+	arm_r_r4_t2_c28,
+	arm_r_r5_t2_c28,
+	arm_r_r6_t2_c28,
+	arm_r_r7_t2_c28,
+	arm_r_r8_t2_c28,
+	arm_r_r9_t2_c28,
+	arm_r_r10_t2_c28,
+	arm_r_r11_t2_c28,
+	arm_r_r12_t2_c28,
+	arm_r_r13_t2_c28,
+	arm_r_r14_t2_c28,
+	arm_r_r15_t2_c28,
+	arm_r_r0_t3_c28,
+	arm_r_r1_t3_c28,
+	arm_r_r2_t3_c28,
+	arm_r_r3_t3_c28,
+	arm_r_r4_t3_c28,
+	arm_r_r5_t3_c28,
+	arm_r_r6_t3_c28,
+	arm_r_r7_t3_c28,
+	arm_r_r8_t3_c28,
+	arm_r_r9_t3_c28,
+	arm_r_r10_t3_c28,
+	arm_r_r11_t3_c28,
+	arm_r_r12_t3_c28,
+	arm_r_r13_t3_c28,
+	arm_r_r14_t3_c28,
+	arm_r_r15_t3_c28,
+	arm_r_r0_t4_c28,
+	arm_r_r1_t4_c28,
+	arm_r_r2_t4_c28,
+	arm_r_r3_t4_c28,
+	arm_r_r4_t4_c28,
+	arm_r_r5_t4_c28,
+	arm_r_r6_t4_c28,
+	arm_r_r7_t4_c28,
+	arm_r_r8_t4_c28,
+	arm_r_r9_t4_c28,
+	arm_r_r10_t4_c28,
+	arm_r_r11_t4_c28,
+	arm_r_r12_t4_c28,
+	arm_r_r13_t4_c28,
+	arm_r_r14_t4_c28,
+	arm_r_r15_t4_c28,
+	arm_r_r0_t5_c28,
+	arm_r_r1_t5_c28,
+	arm_r_r2_t5_c28,
+	arm_r_r3_t5_c28,
+	arm_r_r4_t5_c28,
+	arm_r_r5_t5_c28,
+	arm_r_r6_t5_c28,
+	arm_r_r7_t5_c28,
+	arm_r_r8_t5_c28,
+	arm_r_r9_t5_c28,
+	arm_r_r10_t5_c28,
+	arm_r_r11_t5_c28,
+	arm_r_r12_t5_c28,
+	arm_r_r13_t5_c28,
+	arm_r_r14_t5_c28,
+	arm_r_r15_t5_c28,
+	arm_r_r0_t6_c28,
+	arm_r_r1_t6_c28,
+	arm_r_r2_t6_c28,
+	arm_r_r3_t6_c28,
+	arm_r_r4_t6_c28,
+	arm_r_r5_t6_c28,
+	arm_r_r6_t6_c28,
+	arm_r_r7_t6_c28,
+	arm_r_r8_t6_c28,
+	arm_r_r9_t6_c28,
+	arm_r_r10_t6_c28,
+	arm_r_r11_t6_c28,
+	arm_r_r12_t6_c28,
+	arm_r_r13_t6_c28,
+	arm_r_r14_t6_c28,
+	arm_r_r15_t6_c28,
+	arm_r_r0_t7_c28,
+	arm_r_r1_t7_c28,
+	arm_r_r2_t7_c28,
+	arm_r_r3_t7_c28,
+	arm_r_r4_t7_c28,
+	arm_r_r5_t7_c28,
+	arm_r_r6_t7_c28,
+	arm_r_r7_t7_c28,
+	arm_r_r8_t7_c28,
+	arm_r_r9_t7_c28,
+	arm_r_r10_t7_c28,
+	arm_r_r11_t7_c28,
+	arm_r_r12_t7_c28,
+	arm_r_r13_t7_c28,
+	arm_r_r14_t7_c28,
+	arm_r_r15_t7_c28,
+	arm_r_r0_t0_c29,
+	arm_r_r1_t0_c29,
+	arm_r_r2_t0_c29,
+	arm_r_r3_t0_c29,
+	arm_r_r4_t0_c29,
+	arm_r_r5_t0_c29,
+	arm_r_r6_t0_c29,
+	arm_r_r7_t0_c29,
+	arm_r_r8_t0_c29,
+	arm_r_r9_t0_c29,
+	arm_r_r10_t0_c29,
+	arm_r_r11_t0_c29,
+	arm_r_r12_t0_c29,
+	arm_r_r13_t0_c29,
+	arm_r_r14_t0_c29,
+	arm_r_r15_t0_c29,
+	arm_r_r0_t1_c29,
+	arm_r_r1_t1_c29,
+	arm_r_r2_t1_c29,
+	arm_r_r3_t1_c29,
+	arm_r_r4_t1_c29,
+	arm_r_r5_t1_c29,
+	arm_r_r6_t1_c29,
+	arm_r_r7_t1_c29,
+	arm_r_r8_t1_c29,
+	arm_r_r9_t1_c29,
+	arm_r_r10_t1_c29,
+	arm_r_r11_t1_c29,
+	arm_r_r12_t1_c29,
+	arm_r_r13_t1_c29,
+	arm_r_r14_t1_c29,
+	arm_r_r15_t1_c29,
+	arm_r_r0_t2_c29,
+	arm_r_r1_t2_c29,
+	arm_r_r2_t2_c29,
+	arm_r_r3_t2_c29,
+	arm_r_r4_t2_c29,
+	arm_r_r5_t2_c29,
+	arm_r_r6_t2_c29,
+	arm_r_r7_t2_c29,
+	arm_r_r8_t2_c29,
+	arm_r_r9_t2_c29,
+	arm_r_r10_t2_c29,
+	arm_r_r11_t2_c29,
+	arm_r_r12_t2_c29,
+	arm_r_r13_t2_c29,
+	arm_r_r14_t2_c29,
+	arm_r_r15_t2_c29,
+	arm_r_r0_t3_c29,
+	arm_r_r1_t3_c29,
+	arm_r_r2_t3_c29,
+	arm_r_r3_t3_c29,
+	arm_r_r4_t3_c29,
+	arm_r_r5_t3_c29,
+	arm_r_r6_t3_c29,
+	arm_r_r7_t3_c29,
+	arm_r_r8_t3_c29,
+	arm_r_r9_t3_c29,
+	arm_r_r10_t3_c29,
+	arm_r_r11_t3_c29,
+	arm_r_r12_t3_c29,
+	arm_r_r13_t3_c29,
+	arm_r_r14_t3_c29,
+	arm_r_r15_t3_c29,
+	arm_r_r0_t4_c29,
+	arm_r_r1_t4_c29,
+	arm_r_r2_t4_c29,
+	arm_r_r3_t4_c29,
+	arm_r_r4_t4_c29,
+	arm_r_r5_t4_c29,
+	arm_r_r6_t4_c29,
+	arm_r_r7_t4_c29,
+	arm_r_r8_t4_c29,
+	arm_r_r9_t4_c29,
+	arm_r_r10_t4_c29,
+	arm_r_r11_t4_c29,
+	arm_r_r12_t4_c29,
+	arm_r_r13_t4_c29,
+	arm_r_r14_t4_c29,
+	arm_r_r15_t4_c29,
+	arm_r_r0_t5_c29,
+	arm_r_r1_t5_c29,
+	arm_r_r2_t5_c29,
+	arm_r_r3_t5_c29,
+	arm_r_r4_t5_c29,
+	arm_r_r5_t5_c29,
+	arm_r_r6_t5_c29,
+	arm_r_r7_t5_c29,
+	arm_r_r8_t5_c29,
+	arm_r_r9_t5_c29,
+	arm_r_r10_t5_c29,
+	arm_r_r11_t5_c29,
+	arm_r_r12_t5_c29,
+	arm_r_r13_t5_c29,
+	arm_r_r14_t5_c29,
+	arm_r_r15_t5_c29,
+	arm_r_r0_t6_c29,
+	arm_r_r1_t6_c29,
+	arm_r_r2_t6_c29,
+	arm_r_r3_t6_c29,
+	arm_r_r4_t6_c29,
+	arm_r_r5_t6_c29,
+	arm_r_r6_t6_c29,
+	arm_r_r7_t6_c29,
+	arm_r_r8_t6_c29,
+	arm_r_r9_t6_c29,
+	arm_r_r10_t6_c29,
+	arm_r_r11_t6_c29,
+	arm_r_r12_t6_c29,
+	arm_r_r13_t6_c29,
+	arm_r_r14_t6_c29,
+	arm_r_r15_t6_c29,
+	arm_r_r0_t7_c29,
+	arm_r_r1_t7_c29,
+	arm_r_r2_t7_c29,
+	arm_r_r3_t7_c29,
+	arm_r_r4_t7_c29,
+	arm_r_r5_t7_c29,
+	arm_r_r6_t7_c29,
+	arm_r_r7_t7_c29,
+	arm_r_r8_t7_c29,
+	arm_r_r9_t7_c29,
+	arm_r_r10_t7_c29,
+	arm_r_r11_t7_c29,
+	arm_r_r12_t7_c29,
+	arm_r_r13_t7_c29,
+	arm_r_r14_t7_c29,
+	arm_r_r15_t7_c29,
+	arm_r_r0_t0_c30,
+	arm_r_r1_t0_c30,
+	arm_r_r2_t0_c30,
+	arm_r_r3_t0_c30,
+	arm_r_r4_t0_c30,
+	arm_r_r5_t0_c30,
+	arm_r_r6_t0_c30,
+	arm_r_r7_t0_c30,
+	arm_r_r8_t0_c30,
+	arm_r_r9_t0_c30,
+	arm_r_r10_t0_c30,
+	arm_r_r11_t0_c30,
+	arm_r_r12_t0_c30,
+	arm_r_r13_t0_c30,
+	arm_r_r14_t0_c30,
+	arm_r_r15_t0_c30,
+	arm_r_r0_t1_c30,
+	arm_r_r1_t1_c30,
+	arm_r_r2_t1_c30,
+	arm_r_r3_t1_c30,
+	arm_r_r4_t1_c30,
+	arm_r_r5_t1_c30,
+	arm_r_r6_t1_c30,
+	arm_r_r7_t1_c30,
+	arm_r_r8_t1_c30,
+	arm_r_r9_t1_c30,
+	arm_r_r10_t1_c30,
+	arm_r_r11_t1_c30,
+	arm_r_r12_t1_c30,
+	arm_r_r13_t1_c30,
+	arm_r_r14_t1_c30,
+	arm_r_r15_t1_c30,
+	arm_r_r0_t2_c30,
+	arm_r_r1_t2_c30,
+	arm_r_r2_t2_c30,
+	arm_r_r3_t2_c30,
+	arm_r_r4_t2_c30,
+	arm_r_r5_t2_c30,
+	arm_r_r6_t2_c30,
+	arm_r_r7_t2_c30,
+	arm_r_r8_t2_c30,
+	arm_r_r9_t2_c30,
+	arm_r_r10_t2_c30,
+	arm_r_r11_t2_c30,
+	arm_r_r12_t2_c30,
+	arm_r_r13_t2_c30,
+	arm_r_r14_t2_c30,
+	arm_r_r15_t2_c30,
+	arm_r_r0_t3_c30,
+	arm_r_r1_t3_c30,
+	arm_r_r2_t3_c30,
+	arm_r_r3_t3_c30,
+	arm_r_r4_t3_c30,
+	arm_r_r5_t3_c30,
+	arm_r_r6_t3_c30,
+	arm_r_r7_t3_c30,
+	arm_r_r8_t3_c30,
+	arm_r_r9_t3_c30,
+	arm_r_r10_t3_c30,
+	arm_r_r11_t3_c30,
+	arm_r_r12_t3_c30,
+	arm_r_r13_t3_c30,
+	arm_r_r14_t3_c30,
+	arm_r_r15_t3_c30,
+	arm_r_r0_t4_c30,
+	arm_r_r1_t4_c30,
+	arm_r_r2_t4_c30,
+	arm_r_r3_t4_c30,
+	arm_r_r4_t4_c30,
+	arm_r_r5_t4_c30,
+	arm_r_r6_t4_c30,
+	arm_r_r7_t4_c30,
+	arm_r_r8_t4_c30,
+	arm_r_r9_t4_c30,
+	arm_r_r10_t4_c30,
+	arm_r_r11_t4_c30,
+	arm_r_r12_t4_c30,
+	arm_r_r13_t4_c30,
+	arm_r_r14_t4_c30,
+	arm_r_r15_t4_c30,
+	arm_r_r0_t5_c30,
+	arm_r_r1_t5_c30,
+	arm_r_r2_t5_c30,
+	arm_r_r3_t5_c30,
+	arm_r_r4_t5_c30,
+	arm_r_r5_t5_c30,
+	arm_r_r6_t5_c30,
+	arm_r_r7_t5_c30,
+	arm_r_r8_t5_c30,
+	arm_r_r9_t5_c30,
+	arm_r_r10_t5_c30,
+	arm_r_r11_t5_c30,
+	arm_r_r12_t5_c30,
+	arm_r_r13_t5_c30,
+	arm_r_r14_t5_c30,
+	arm_r_r15_t5_c30,
+	arm_r_r0_t6_c30,
+	arm_r_r1_t6_c30,
+	arm_r_r2_t6_c30,
+	arm_r_r3_t6_c30,
+	arm_r_r4_t6_c30,
+	arm_r_r5_t6_c30,
+	arm_r_r6_t6_c30,
+	arm_r_r7_t6_c30,
+	arm_r_r8_t6_c30,
+	arm_r_r9_t6_c30,
+	arm_r_r10_t6_c30,
+	arm_r_r11_t6_c30,
+	arm_r_r12_t6_c30,
+	arm_r_r13_t6_c30,
+	arm_r_r14_t6_c30,
+	arm_r_r15_t6_c30,
+	arm_r_r0_t7_c30,
+	arm_r_r1_t7_c30,
+	arm_r_r2_t7_c30,
+	arm_r_r3_t7_c30,
+	arm_r_r4_t7_c30,
+	arm_r_r5_t7_c30,
+	arm_r_r6_t7_c30,
+	arm_r_r7_t7_c30,
+	arm_r_r8_t7_c30,
+	arm_r_r9_t7_c30,
+	arm_r_r10_t7_c30,
+	arm_r_r11_t7_c30,
+	arm_r_r12_t7_c30,
+	arm_r_r13_t7_c30,
+	arm_r_r14_t7_c30,
+	arm_r_r15_t7_c30,
+	arm_r_r0_t0_c31,
+	arm_r_r1_t0_c31,
+	arm_r_r2_t0_c31,
+	arm_r_r3_t0_c31,
+	arm_r_r4_t0_c31,
+	arm_r_r5_t0_c31,
+	arm_r_r6_t0_c31,
+	arm_r_r7_t0_c31,
+	arm_r_r8_t0_c31,
+	arm_r_r9_t0_c31,
+	arm_r_r10_t0_c31,
+	arm_r_r11_t0_c31,
+	arm_r_r12_t0_c31,
+	arm_r_r13_t0_c31,
+	arm_r_r14_t0_c31,
+	arm_r_r15_t0_c31,
+	arm_r_r0_t1_c31,
+	arm_r_r1_t1_c31,
+	arm_r_r2_t1_c31,
+	arm_r_r3_t1_c31,
+	arm_r_r4_t1_c31,
+	arm_r_r5_t1_c31,
+	arm_r_r6_t1_c31,
+	arm_r_r7_t1_c31,
+	arm_r_r8_t1_c31,
+	arm_r_r9_t1_c31,
+	arm_r_r10_t1_c31,
+	arm_r_r11_t1_c31,
+	arm_r_r12_t1_c31,
+	arm_r_r13_t1_c31,
+	arm_r_r14_t1_c31,
+	arm_r_r15_t1_c31,
+	arm_r_r0_t2_c31,
+	arm_r_r1_t2_c31,
+	arm_r_r2_t2_c31,
+	arm_r_r3_t2_c31,
+	arm_r_r4_t2_c31,
+	arm_r_r5_t2_c31,
+	arm_r_r6_t2_c31,
+	arm_r_r7_t2_c31,
+	arm_r_r8_t2_c31,
+	arm_r_r9_t2_c31,
+	arm_r_r10_t2_c31,
+	arm_r_r11_t2_c31,
+	arm_r_r12_t2_c31,
+	arm_r_r13_t2_c31,
+	arm_r_r14_t2_c31,
+	arm_r_r15_t2_c31,
+	arm_r_r0_t3_c31,
+	arm_r_r1_t3_c31,
+	arm_r_r2_t3_c31,
+	arm_r_r3_t3_c31,
+	arm_r_r4_t3_c31,
+	arm_r_r5_t3_c31,
+	arm_r_r6_t3_c31,
+	arm_r_r7_t3_c31,
+	arm_r_r8_t3_c31,
+	arm_r_r9_t3_c31,
+	arm_r_r10_t3_c31,
+	arm_r_r11_t3_c31,
+	arm_r_r12_t3_c31,
+	arm_r_r13_t3_c31,
+	arm_r_r14_t3_c31,
+	arm_r_r15_t3_c31,
+	arm_r_r0_t4_c31,
+	arm_r_r1_t4_c31,
+	arm_r_r2_t4_c31,
+	arm_r_r3_t4_c31,
+	arm_r_r4_t4_c31,
+	arm_r_r5_t4_c31,
+	arm_r_r6_t4_c31,
+	arm_r_r7_t4_c31,
+	arm_r_r8_t4_c31,
+	arm_r_r9_t4_c31,
+	arm_r_r10_t4_c31,
+	arm_r_r11_t4_c31,
+	arm_r_r12_t4_c31,
+	arm_r_r13_t4_c31,
+	arm_r_r14_t4_c31,
+	arm_r_r15_t4_c31,
+	arm_r_r0_t5_c31,
+	arm_r_r1_t5_c31,
+	arm_r_r2_t5_c31,
+	arm_r_r3_t5_c31,
+	arm_r_r4_t5_c31,
+	arm_r_r5_t5_c31,
+	arm_r_r6_t5_c31,
+	arm_r_r7_t5_c31,
+	arm_r_r8_t5_c31,
+	arm_r_r9_t5_c31,
+	arm_r_r10_t5_c31,
+	arm_r_r11_t5_c31,
+	arm_r_r12_t5_c31,
+	arm_r_r13_t5_c31,
+	arm_r_r14_t5_c31,
+	arm_r_r15_t5_c31,
+	arm_r_r0_t6_c31,
+	arm_r_r1_t6_c31,
+	arm_r_r2_t6_c31,
+	arm_r_r3_t6_c31,
+	arm_r_r4_t6_c31,
+	arm_r_r5_t6_c31,
+	arm_r_r6_t6_c31,
+	arm_r_r7_t6_c31,
+	arm_r_r8_t6_c31,
+	arm_r_r9_t6_c31,
+	arm_r_r10_t6_c31,
+	arm_r_r11_t6_c31,
+	arm_r_r12_t6_c31,
+	arm_r_r13_t6_c31,
+	arm_r_r14_t6_c31,
+	arm_r_r15_t6_c31,
+	arm_r_r0_t7_c31,
+	arm_r_r1_t7_c31,
+	arm_r_r2_t7_c31,
+	arm_r_r3_t7_c31,
+	arm_r_r4_t7_c31,
+	arm_r_r5_t7_c31,
+	arm_r_r6_t7_c31,
+	arm_r_r7_t7_c31,
+	arm_r_r8_t7_c31,
+	arm_r_r9_t7_c31,
+	arm_r_r10_t7_c31,
+	arm_r_r11_t7_c31,
+	arm_r_r12_t7_c31,
+	arm_r_r13_t7_c31,
+	arm_r_r14_t7_c31,
+	arm_r_r15_t7_c31,
+	arm_rs_r0_t0_c0,
+	arm_rs_r1_t0_c0,
+	arm_rs_r2_t0_c0,
+	arm_rs_r3_t0_c0,
+	arm_rs_r4_t0_c0,
+	arm_rs_r5_t0_c0,
+	arm_rs_r6_t0_c0,
+	arm_rs_r7_t0_c0,
+	arm_rs_r8_t0_c0,
+	arm_rs_r9_t0_c0,
+	arm_rs_r10_t0_c0,
+	arm_rs_r11_t0_c0,
+	arm_rs_r12_t0_c0,
+	arm_rs_r13_t0_c0,
+	arm_rs_r14_t0_c0,
+	arm_rs_r15_t0_c0,
+	arm_rs_r0_t1_c0,
+	arm_rs_r1_t1_c0,
+	arm_rs_r2_t1_c0,
+	arm_rs_r3_t1_c0,
+	arm_rs_r4_t1_c0,
+	arm_rs_r5_t1_c0,
+	arm_rs_r6_t1_c0,
+	arm_rs_r7_t1_c0,
+	arm_rs_r8_t1_c0,
+	arm_rs_r9_t1_c0,
+	arm_rs_r10_t1_c0,
+	arm_rs_r11_t1_c0,
+	arm_rs_r12_t1_c0,
+	arm_rs_r13_t1_c0,
+	arm_rs_r14_t1_c0,
+	arm_rs_r15_t1_c0,
+	arm_rs_r0_t2_c0,
+	arm_rs_r1_t2_c0,
+	arm_rs_r2_t2_c0,
+	arm_rs_r3_t2_c0,
+	arm_rs_r4_t2_c0,
+	arm_rs_r5_t2_c0,
+	arm_rs_r6_t2_c0,
+	arm_rs_r7_t2_c0,
+	arm_rs_r8_t2_c0,
+	arm_rs_r9_t2_c0,
+	arm_rs_r10_t2_c0,
+	arm_rs_r11_t2_c0,
+	arm_rs_r12_t2_c0,
+	arm_rs_r13_t2_c0,
+	arm_rs_r14_t2_c0,
+	arm_rs_r15_t2_c0,
+	arm_rs_r0_t3_c0,
+	arm_rs_r1_t3_c0,
+	arm_rs_r2_t3_c0,
+	arm_rs_r3_t3_c0,
+	arm_rs_r4_t3_c0,
+	arm_rs_r5_t3_c0,
+	arm_rs_r6_t3_c0,
+	arm_rs_r7_t3_c0,
+	arm_rs_r8_t3_c0,
+	arm_rs_r9_t3_c0,
+	arm_rs_r10_t3_c0,
+	arm_rs_r11_t3_c0,
+	arm_rs_r12_t3_c0,
+	arm_rs_r13_t3_c0,
+	arm_rs_r14_t3_c0,
+	arm_rs_r15_t3_c0,
+	arm_rs_r0_t4_c0,
+	arm_rs_r1_t4_c0,
+	arm_rs_r2_t4_c0,
+	arm_rs_r3_t4_c0,
+	arm_rs_r4_t4_c0,
+	arm_rs_r5_t4_c0,
+	arm_rs_r6_t4_c0,
+	arm_rs_r7_t4_c0,
+	arm_rs_r8_t4_c0,
+	arm_rs_r9_t4_c0,
+	arm_rs_r10_t4_c0,
+	arm_rs_r11_t4_c0,
+	arm_rs_r12_t4_c0,
+	arm_rs_r13_t4_c0,
+	arm_rs_r14_t4_c0,
+	arm_rs_r15_t4_c0,
+	arm_rs_r0_t5_c0,
+	arm_rs_r1_t5_c0,
+	arm_rs_r2_t5_c0,
+	arm_rs_r3_t5_c0,
+	arm_rs_r4_t5_c0,
+	arm_rs_r5_t5_c0,
+	arm_rs_r6_t5_c0,
+	arm_rs_r7_t5_c0,
+	arm_rs_r8_t5_c0,
+	arm_rs_r9_t5_c0,
+	arm_rs_r10_t5_c0,
+	arm_rs_r11_t5_c0,
+	arm_rs_r12_t5_c0,
+	arm_rs_r13_t5_c0,
+	arm_rs_r14_t5_c0,
+	arm_rs_r15_t5_c0,
+	arm_rs_r0_t6_c0,
+	arm_rs_r1_t6_c0,
+	arm_rs_r2_t6_c0,
+	arm_rs_r3_t6_c0,
+	arm_rs_r4_t6_c0,
+	arm_rs_r5_t6_c0,
+	arm_rs_r6_t6_c0,
+	arm_rs_r7_t6_c0,
+	arm_rs_r8_t6_c0,
+	arm_rs_r9_t6_c0,
+	arm_rs_r10_t6_c0,
+	arm_rs_r11_t6_c0,
+	arm_rs_r12_t6_c0,
+	arm_rs_r13_t6_c0,
+	arm_rs_r14_t6_c0,
+	arm_rs_r15_t6_c0,
+	arm_rs_r0_t7_c0,
+	arm_rs_r1_t7_c0,
+	arm_rs_r2_t7_c0,
+	arm_rs_r3_t7_c0,
+	arm_rs_r4_t7_c0,
+	arm_rs_r5_t7_c0,
+	arm_rs_r6_t7_c0,
+	arm_rs_r7_t7_c0,
+	arm_rs_r8_t7_c0,
+	arm_rs_r9_t7_c0,
+	arm_rs_r10_t7_c0,
+	arm_rs_r11_t7_c0,
+	arm_rs_r12_t7_c0,
+	arm_rs_r13_t7_c0,
+	arm_rs_r14_t7_c0,
+	arm_rs_r15_t7_c0,
+	arm_rs_r0_t0_c1,
+	arm_rs_r1_t0_c1,
+	arm_rs_r2_t0_c1,
+	arm_rs_r3_t0_c1,
+	arm_rs_r4_t0_c1,
+	arm_rs_r5_t0_c1,
+	arm_rs_r6_t0_c1,
+	arm_rs_r7_t0_c1,
+	arm_rs_r8_t0_c1,
+	arm_rs_r9_t0_c1,
+	arm_rs_r10_t0_c1,
+	arm_rs_r11_t0_c1,
+	arm_rs_r12_t0_c1,
+	arm_rs_r13_t0_c1,
+	arm_rs_r14_t0_c1,
+	arm_rs_r15_t0_c1,
+	arm_rs_r0_t1_c1,
+	arm_rs_r1_t1_c1,
+	arm_rs_r2_t1_c1,
+	arm_rs_r3_t1_c1,
+	arm_rs_r4_t1_c1,
+	arm_rs_r5_t1_c1,
+	arm_rs_r6_t1_c1,
+	arm_rs_r7_t1_c1,
+	arm_rs_r8_t1_c1,
+	arm_rs_r9_t1_c1,
+	arm_rs_r10_t1_c1,
+	arm_rs_r11_t1_c1,
+	arm_rs_r12_t1_c1,
+	arm_rs_r13_t1_c1,
+	arm_rs_r14_t1_c1,
+	arm_rs_r15_t1_c1,
+	arm_rs_r0_t2_c1,
+	arm_rs_r1_t2_c1,
+	arm_rs_r2_t2_c1,
+	arm_rs_r3_t2_c1,
+	arm_rs_r4_t2_c1,
+	arm_rs_r5_t2_c1,
+	arm_rs_r6_t2_c1,
+	arm_rs_r7_t2_c1,
+	arm_rs_r8_t2_c1,
+	arm_rs_r9_t2_c1,
+	arm_rs_r10_t2_c1,
+	arm_rs_r11_t2_c1,
+	arm_rs_r12_t2_c1,
+	arm_rs_r13_t2_c1,
+	arm_rs_r14_t2_c1,
+	arm_rs_r15_t2_c1,
+	arm_rs_r0_t3_c1,
+	arm_rs_r1_t3_c1,
+	arm_rs_r2_t3_c1,
+	arm_rs_r3_t3_c1,
+	arm_rs_r4_t3_c1,
+	arm_rs_r5_t3_c1,
+	arm_rs_r6_t3_c1,
+	arm_rs_r7_t3_c1,
+	arm_rs_r8_t3_c1,
+	arm_rs_r9_t3_c1,
+	arm_rs_r10_t3_c1,
+	arm_rs_r11_t3_c1,
+	arm_rs_r12_t3_c1,
+	arm_rs_r13_t3_c1,
+	arm_rs_r14_t3_c1,
+	arm_rs_r15_t3_c1,
+	arm_rs_r0_t4_c1,
+	arm_rs_r1_t4_c1,
+	arm_rs_r2_t4_c1,
+	arm_rs_r3_t4_c1,
+	arm_rs_r4_t4_c1,
+	arm_rs_r5_t4_c1,
+	arm_rs_r6_t4_c1,
+	arm_rs_r7_t4_c1,
+	arm_rs_r8_t4_c1,
+	arm_rs_r9_t4_c1,
+	arm_rs_r10_t4_c1,
+	arm_rs_r11_t4_c1,
+	arm_rs_r12_t4_c1,
+	arm_rs_r13_t4_c1,
+	arm_rs_r14_t4_c1,
+	arm_rs_r15_t4_c1,
+	arm_rs_r0_t5_c1,
+	arm_rs_r1_t5_c1,
+	arm_rs_r2_t5_c1,
+	arm_rs_r3_t5_c1,
+	arm_rs_r4_t5_c1,
+	arm_rs_r5_t5_c1,
+	arm_rs_r6_t5_c1,
+	arm_rs_r7_t5_c1,
+	arm_rs_r8_t5_c1,
+	arm_rs_r9_t5_c1,
+	arm_rs_r10_t5_c1,
+	arm_rs_r11_t5_c1,
+	arm_rs_r12_t5_c1,
+	arm_rs_r13_t5_c1,
+	arm_rs_r14_t5_c1,
+	arm_rs_r15_t5_c1,
+	arm_rs_r0_t6_c1,
+	arm_rs_r1_t6_c1,
+	arm_rs_r2_t6_c1,
+	arm_rs_r3_t6_c1,
+	arm_rs_r4_t6_c1,
+	arm_rs_r5_t6_c1,
+	arm_rs_r6_t6_c1,
+	arm_rs_r7_t6_c1,
+	arm_rs_r8_t6_c1,
+	arm_rs_r9_t6_c1,
+	arm_rs_r10_t6_c1,
+	arm_rs_r11_t6_c1,
+	arm_rs_r12_t6_c1,
+	arm_rs_r13_t6_c1,
+	arm_rs_r14_t6_c1,
+	arm_rs_r15_t6_c1,
+	arm_rs_r0_t7_c1,
+	arm_rs_r1_t7_c1,
+	arm_rs_r2_t7_c1,
+	arm_rs_r3_t7_c1,
+	arm_rs_r4_t7_c1,
+	arm_rs_r5_t7_c1,
+	arm_rs_r6_t7_c1,
+	arm_rs_r7_t7_c1,
+	arm_rs_r8_t7_c1,
+	arm_rs_r9_t7_c1,
+	arm_rs_r10_t7_c1,
+	arm_rs_r11_t7_c1,
+	arm_rs_r12_t7_c1,
+	arm_rs_r13_t7_c1,
+	arm_rs_r14_t7_c1,
+	arm_rs_r15_t7_c1,
+	arm_rs_r0_t0_c2,
+	arm_rs_r1_t0_c2,
+	arm_rs_r2_t0_c2,
+	arm_rs_r3_t0_c2,
+	arm_rs_r4_t0_c2,
+	arm_rs_r5_t0_c2,
+	arm_rs_r6_t0_c2,
+	arm_rs_r7_t0_c2,
+	arm_rs_r8_t0_c2,
+	arm_rs_r9_t0_c2,
+	arm_rs_r10_t0_c2,
+	arm_rs_r11_t0_c2,
+	arm_rs_r12_t0_c2,
+	arm_rs_r13_t0_c2,
+	arm_rs_r14_t0_c2,
+	arm_rs_r15_t0_c2,
+	arm_rs_r0_t1_c2,
+	arm_rs_r1_t1_c2,
+	arm_rs_r2_t1_c2,
+	arm_rs_r3_t1_c2,
+	arm_rs_r4_t1_c2,
+	arm_rs_r5_t1_c2,
+	arm_rs_r6_t1_c2,
+	arm_rs_r7_t1_c2,
+	arm_rs_r8_t1_c2,
+	arm_rs_r9_t1_c2,
+	arm_rs_r10_t1_c2,
+	arm_rs_r11_t1_c2,
+	arm_rs_r12_t1_c2,
+	arm_rs_r13_t1_c2,
+	arm_rs_r14_t1_c2,
+	arm_rs_r15_t1_c2,
+	arm_rs_r0_t2_c2,
+	arm_rs_r1_t2_c2,
+	arm_rs_r2_t2_c2,
+	arm_rs_r3_t2_c2,
+	arm_rs_r4_t2_c2,
+	arm_rs_r5_t2_c2,
+	arm_rs_r6_t2_c2,
+	arm_rs_r7_t2_c2,
+	arm_rs_r8_t2_c2,
+	arm_rs_r9_t2_c2,
+	arm_rs_r10_t2_c2,
+	arm_rs_r11_t2_c2,
+	arm_rs_r12_t2_c2,
+	arm_rs_r13_t2_c2,
+	arm_rs_r14_t2_c2,
+	arm_rs_r15_t2_c2,
+	arm_rs_r0_t3_c2,
+	arm_rs_r1_t3_c2,
+	arm_rs_r2_t3_c2,
+	arm_rs_r3_t3_c2,
+	arm_rs_r4_t3_c2,
+	arm_rs_r5_t3_c2,
+	arm_rs_r6_t3_c2,
+	arm_rs_r7_t3_c2,
+	arm_rs_r8_t3_c2,
+	arm_rs_r9_t3_c2,
+	arm_rs_r10_t3_c2,
+	arm_rs_r11_t3_c2,
+	arm_rs_r12_t3_c2,
+	arm_rs_r13_t3_c2,
+	arm_rs_r14_t3_c2,
+	arm_rs_r15_t3_c2,
+	arm_rs_r0_t4_c2,
+	arm_rs_r1_t4_c2,
+	arm_rs_r2_t4_c2,
+	arm_rs_r3_t4_c2,
+	arm_rs_r4_t4_c2,
+	arm_rs_r5_t4_c2,
+	arm_rs_r6_t4_c2,
+	arm_rs_r7_t4_c2,
+	arm_rs_r8_t4_c2,
+	arm_rs_r9_t4_c2,
+	arm_rs_r10_t4_c2,
+	arm_rs_r11_t4_c2,
+	arm_rs_r12_t4_c2,
+	arm_rs_r13_t4_c2,
+	arm_rs_r14_t4_c2,
+	arm_rs_r15_t4_c2,
+	arm_rs_r0_t5_c2,
+	arm_rs_r1_t5_c2,
+	arm_rs_r2_t5_c2,
+	arm_rs_r3_t5_c2,
+	arm_rs_r4_t5_c2,
+	arm_rs_r5_t5_c2,
+	arm_rs_r6_t5_c2,
+	arm_rs_r7_t5_c2,
+	arm_rs_r8_t5_c2,
+	arm_rs_r9_t5_c2,
+	arm_rs_r10_t5_c2,
+	arm_rs_r11_t5_c2,
+	arm_rs_r12_t5_c2,
+	arm_rs_r13_t5_c2,
+	arm_rs_r14_t5_c2,
+	arm_rs_r15_t5_c2,
+	arm_rs_r0_t6_c2,
+	arm_rs_r1_t6_c2,
+	arm_rs_r2_t6_c2,
+	arm_rs_r3_t6_c2,
+	arm_rs_r4_t6_c2,
+	arm_rs_r5_t6_c2,
+	arm_rs_r6_t6_c2,
+	arm_rs_r7_t6_c2,
+	arm_rs_r8_t6_c2,
+	arm_rs_r9_t6_c2,
+	arm_rs_r10_t6_c2,
+	arm_rs_r11_t6_c2,
+	arm_rs_r12_t6_c2,
+	arm_rs_r13_t6_c2,
+	arm_rs_r14_t6_c2,
+	arm_rs_r15_t6_c2,
+	arm_rs_r0_t7_c2,
+	arm_rs_r1_t7_c2,
+	arm_rs_r2_t7_c2,
+	arm_rs_r3_t7_c2,
+	arm_rs_r4_t7_c2,
+	arm_rs_r5_t7_c2,
+	arm_rs_r6_t7_c2,
+	arm_rs_r7_t7_c2,
+	arm_rs_r8_t7_c2,
+	arm_rs_r9_t7_c2,
+	arm_rs_r10_t7_c2,
+	arm_rs_r11_t7_c2,
+	arm_rs_r12_t7_c2,
+	arm_rs_r13_t7_c2,
+	arm_rs_r14_t7_c2,
+	arm_rs_r15_t7_c2,
+	arm_rs_r0_t0_c3,
+	arm_rs_r1_t0_c3,
+	arm_rs_r2_t0_c3,
+	arm_rs_r3_t0_c3,
+	arm_rs_r4_t0_c3,
+	arm_rs_r5_t0_c3,
+	arm_rs_r6_t0_c3,
+	arm_rs_r7_t0_c3,
+	arm_rs_r8_t0_c3,
+	arm_rs_r9_t0_c3,
+	arm_rs_r10_t0_c3,
+	arm_rs_r11_t0_c3,
+	arm_rs_r12_t0_c3,
+	arm_rs_r13_t0_c3,
+	arm_rs_r14_t0_c3,
+	arm_rs_r15_t0_c3,
+	arm_rs_r0_t1_c3,
+	arm_rs_r1_t1_c3,
+	arm_rs_r2_t1_c3,
+	arm_rs_r3_t1_c3,
+	arm_rs_r4_t1_c3,
+	arm_rs_r5_t1_c3,
+	arm_rs_r6_t1_c3,
+	arm_rs_r7_t1_c3,
+	arm_rs_r8_t1_c3,
+	arm_rs_r9_t1_c3,
+	arm_rs_r10_t1_c3,
+	arm_rs_r11_t1_c3,
+	arm_rs_r12_t1_c3,
+	arm_rs_r13_t1_c3,
+	arm_rs_r14_t1_c3,
+	arm_rs_r15_t1_c3,
+	arm_rs_r0_t2_c3,
+	arm_rs_r1_t2_c3,
+	arm_rs_r2_t2_c3,
+	arm_rs_r3_t2_c3,
+	arm_rs_r4_t2_c3,
+	arm_rs_r5_t2_c3,
+	arm_rs_r6_t2_c3,
+	arm_rs_r7_t2_c3,
+	arm_rs_r8_t2_c3,
+	arm_rs_r9_t2_c3,
+	arm_rs_r10_t2_c3,
+	arm_rs_r11_t2_c3,
+	arm_rs_r12_t2_c3,
+	arm_rs_r13_t2_c3,
+	arm_rs_r14_t2_c3,
+	arm_rs_r15_t2_c3,
+	arm_rs_r0_t3_c3,
+	arm_rs_r1_t3_c3,
+	arm_rs_r2_t3_c3,
+	arm_rs_r3_t3_c3,
+	arm_rs_r4_t3_c3,
+	arm_rs_r5_t3_c3,
+	arm_rs_r6_t3_c3,
+	arm_rs_r7_t3_c3,
+	arm_rs_r8_t3_c3,
+	arm_rs_r9_t3_c3,
+	arm_rs_r10_t3_c3,
+	arm_rs_r11_t3_c3,
+	arm_rs_r12_t3_c3,
+	arm_rs_r13_t3_c3,
+	arm_rs_r14_t3_c3,
+	arm_rs_r15_t3_c3,
+	arm_rs_r0_t4_c3,
+	arm_rs_r1_t4_c3,
+	arm_rs_r2_t4_c3,
+	arm_rs_r3_t4_c3,
+	arm_rs_r4_t4_c3,
+	arm_rs_r5_t4_c3,
+	arm_rs_r6_t4_c3,
+	arm_rs_r7_t4_c3,
+	arm_rs_r8_t4_c3,
+	arm_rs_r9_t4_c3,
+	arm_rs_r10_t4_c3,
+	arm_rs_r11_t4_c3,
+	arm_rs_r12_t4_c3,
+	arm_rs_r13_t4_c3,
+	arm_rs_r14_t4_c3,
+	arm_rs_r15_t4_c3,
+	arm_rs_r0_t5_c3,
+	arm_rs_r1_t5_c3,
+	arm_rs_r2_t5_c3,
+	arm_rs_r3_t5_c3,
+	arm_rs_r4_t5_c3,
+	arm_rs_r5_t5_c3,
+	arm_rs_r6_t5_c3,
+	arm_rs_r7_t5_c3,
+	arm_rs_r8_t5_c3,
+	arm_rs_r9_t5_c3,
+	arm_rs_r10_t5_c3,
+	arm_rs_r11_t5_c3,
+	arm_rs_r12_t5_c3,
+	arm_rs_r13_t5_c3,
+	arm_rs_r14_t5_c3,
+	arm_rs_r15_t5_c3,
+	arm_rs_r0_t6_c3,
+	arm_rs_r1_t6_c3,
+	arm_rs_r2_t6_c3,
+	arm_rs_r3_t6_c3,
+	arm_rs_r4_t6_c3,
+	arm_rs_r5_t6_c3,
+	arm_rs_r6_t6_c3,
+	arm_rs_r7_t6_c3,
+	arm_rs_r8_t6_c3,
+	arm_rs_r9_t6_c3,
+	arm_rs_r10_t6_c3,
+	arm_rs_r11_t6_c3,
+	arm_rs_r12_t6_c3,
+	arm_rs_r13_t6_c3,
+	arm_rs_r14_t6_c3,
+	arm_rs_r15_t6_c3,
+	arm_rs_r0_t7_c3,
+	arm_rs_r1_t7_c3,
+	arm_rs_r2_t7_c3,
+	arm_rs_r3_t7_c3,
+	arm_rs_r4_t7_c3,
+	arm_rs_r5_t7_c3,
+	arm_rs_r6_t7_c3,
+	arm_rs_r7_t7_c3,
+	arm_rs_r8_t7_c3,
+	arm_rs_r9_t7_c3,
+	arm_rs_r10_t7_c3,
+	arm_rs_r11_t7_c3,
+	arm_rs_r12_t7_c3,
+	arm_rs_r13_t7_c3,
+	arm_rs_r14_t7_c3,
+	arm_rs_r15_t7_c3,
+	arm_rs_r0_t0_c4,
+	arm_rs_r1_t0_c4,
+	arm_rs_r2_t0_c4,
+	arm_rs_r3_t0_c4,
+	arm_rs_r4_t0_c4,
+	arm_rs_r5_t0_c4,
+	arm_rs_r6_t0_c4,
+	arm_rs_r7_t0_c4,
+	arm_rs_r8_t0_c4,
+	arm_rs_r9_t0_c4,
+	arm_rs_r10_t0_c4,
+	arm_rs_r11_t0_c4,
+	arm_rs_r12_t0_c4,
+	arm_rs_r13_t0_c4,
+	arm_rs_r14_t0_c4,
+	arm_rs_r15_t0_c4,
+	arm_rs_r0_t1_c4,
+	arm_rs_r1_t1_c4,
+	arm_rs_r2_t1_c4,
+	arm_rs_r3_t1_c4,
+	arm_rs_r4_t1_c4,
+	arm_rs_r5_t1_c4,
+	arm_rs_r6_t1_c4,
+	arm_rs_r7_t1_c4,
+	arm_rs_r8_t1_c4,
+	arm_rs_r9_t1_c4,
+	arm_rs_r10_t1_c4,
+	arm_rs_r11_t1_c4,
+	arm_rs_r12_t1_c4,
+	arm_rs_r13_t1_c4,
+	arm_rs_r14_t1_c4,
+	arm_rs_r15_t1_c4,
+	arm_rs_r0_t2_c4,
+	arm_rs_r1_t2_c4,
+	arm_rs_r2_t2_c4,
+	arm_rs_r3_t2_c4,
+	arm_rs_r4_t2_c4,
+	arm_rs_r5_t2_c4,
+	arm_rs_r6_t2_c4,
+	arm_rs_r7_t2_c4,
+	arm_rs_r8_t2_c4,
+	arm_rs_r9_t2_c4,
+	arm_rs_r10_t2_c4,
+	arm_rs_r11_t2_c4,
+	arm_rs_r12_t2_c4,
+	arm_rs_r13_t2_c4,
+	arm_rs_r14_t2_c4,
+	arm_rs_r15_t2_c4,
+	arm_rs_r0_t3_c4,
+	arm_rs_r1_t3_c4,
+	arm_rs_r2_t3_c4,
+	arm_rs_r3_t3_c4,
+	arm_rs_r4_t3_c4,
+	arm_rs_r5_t3_c4,
+	arm_rs_r6_t3_c4,
+	arm_rs_r7_t3_c4,
+	arm_rs_r8_t3_c4,
+	arm_rs_r9_t3_c4,
+	arm_rs_r10_t3_c4,
+	arm_rs_r11_t3_c4,
+	arm_rs_r12_t3_c4,
+	arm_rs_r13_t3_c4,
+	arm_rs_r14_t3_c4,
+	arm_rs_r15_t3_c4,
+	arm_rs_r0_t4_c4,
+	arm_rs_r1_t4_c4,
+	arm_rs_r2_t4_c4,
+	arm_rs_r3_t4_c4,
+	arm_rs_r4_t4_c4,
+	arm_rs_r5_t4_c4,
+	arm_rs_r6_t4_c4,
+	arm_rs_r7_t4_c4,
+	arm_rs_r8_t4_c4,
+	arm_rs_r9_t4_c4,
+	arm_rs_r10_t4_c4,
+	arm_rs_r11_t4_c4,
+	arm_rs_r12_t4_c4,
+	arm_rs_r13_t4_c4,
+	arm_rs_r14_t4_c4,
+	arm_rs_r15_t4_c4,
+	arm_rs_r0_t5_c4,
+	arm_rs_r1_t5_c4,
+	arm_rs_r2_t5_c4,
+	arm_rs_r3_t5_c4,
+	arm_rs_r4_t5_c4,
+	arm_rs_r5_t5_c4,
+	arm_rs_r6_t5_c4,
+	arm_rs_r7_t5_c4,
+	arm_rs_r8_t5_c4,
+	arm_rs_r9_t5_c4,
+	arm_rs_r10_t5_c4,
+	arm_rs_r11_t5_c4,
+	arm_rs_r12_t5_c4,
+	arm_rs_r13_t5_c4,
+	arm_rs_r14_t5_c4,
+	arm_rs_r15_t5_c4,
+	arm_rs_r0_t6_c4,
+	arm_rs_r1_t6_c4,
+	arm_rs_r2_t6_c4,
+	arm_rs_r3_t6_c4,
+	arm_rs_r4_t6_c4,
+	arm_rs_r5_t6_c4,
+	arm_rs_r6_t6_c4,
+	arm_rs_r7_t6_c4,
+	arm_rs_r8_t6_c4,
+	arm_rs_r9_t6_c4,
+	arm_rs_r10_t6_c4,
+	arm_rs_r11_t6_c4,
+	arm_rs_r12_t6_c4,
+	arm_rs_r13_t6_c4,
+	arm_rs_r14_t6_c4,
+	arm_rs_r15_t6_c4,
+	arm_rs_r0_t7_c4,
+	arm_rs_r1_t7_c4,
+	arm_rs_r2_t7_c4,
+	arm_rs_r3_t7_c4,
+	arm_rs_r4_t7_c4,
+	arm_rs_r5_t7_c4,
+	arm_rs_r6_t7_c4,
+	arm_rs_r7_t7_c4,
+	arm_rs_r8_t7_c4,
+	arm_rs_r9_t7_c4,
+	arm_rs_r10_t7_c4,
+	arm_rs_r11_t7_c4,
+	arm_rs_r12_t7_c4,
+	arm_rs_r13_t7_c4,
+	arm_rs_r14_t7_c4,
+	arm_rs_r15_t7_c4,
+	arm_rs_r0_t0_c5,
+	arm_rs_r1_t0_c5,
+	arm_rs_r2_t0_c5,
+	arm_rs_r3_t0_c5,
+	arm_rs_r4_t0_c5,
+	arm_rs_r5_t0_c5,
+	arm_rs_r6_t0_c5,
+	arm_rs_r7_t0_c5,
+	arm_rs_r8_t0_c5,
+	arm_rs_r9_t0_c5,
+	arm_rs_r10_t0_c5,
+	arm_rs_r11_t0_c5,
+	arm_rs_r12_t0_c5,
+	arm_rs_r13_t0_c5,
+	arm_rs_r14_t0_c5,
+	arm_rs_r15_t0_c5,
+	arm_rs_r0_t1_c5,
+	arm_rs_r1_t1_c5,
+	arm_rs_r2_t1_c5,
+	arm_rs_r3_t1_c5,
+	arm_rs_r4_t1_c5,
+	arm_rs_r5_t1_c5,
+	arm_rs_r6_t1_c5,
+	arm_rs_r7_t1_c5,
+	arm_rs_r8_t1_c5,
+	arm_rs_r9_t1_c5,
+	arm_rs_r10_t1_c5,
+	arm_rs_r11_t1_c5,
+	arm_rs_r12_t1_c5,
+	arm_rs_r13_t1_c5,
+	arm_rs_r14_t1_c5,
+	arm_rs_r15_t1_c5,
+	arm_rs_r0_t2_c5,
+	arm_rs_r1_t2_c5,
+	arm_rs_r2_t2_c5,
+	arm_rs_r3_t2_c5,
+	arm_rs_r4_t2_c5,
+	arm_rs_r5_t2_c5,
+	arm_rs_r6_t2_c5,
+	arm_rs_r7_t2_c5,
+	arm_rs_r8_t2_c5,
+	arm_rs_r9_t2_c5,
+	arm_rs_r10_t2_c5,
+	arm_rs_r11_t2_c5,
+	arm_rs_r12_t2_c5,
+	arm_rs_r13_t2_c5,
+	arm_rs_r14_t2_c5,
+	arm_rs_r15_t2_c5,
+	arm_rs_r0_t3_c5,
+	arm_rs_r1_t3_c5,
+	arm_rs_r2_t3_c5,
+	arm_rs_r3_t3_c5,
+	arm_rs_r4_t3_c5,
+	arm_rs_r5_t3_c5,
+	arm_rs_r6_t3_c5,
+	arm_rs_r7_t3_c5,
+	arm_rs_r8_t3_c5,
+	arm_rs_r9_t3_c5,
+	arm_rs_r10_t3_c5,
+	arm_rs_r11_t3_c5,
+	arm_rs_r12_t3_c5,
+	arm_rs_r13_t3_c5,
+	arm_rs_r14_t3_c5,
+	arm_rs_r15_t3_c5,
+	arm_rs_r0_t4_c5,
+	arm_rs_r1_t4_c5,
+	arm_rs_r2_t4_c5,
+	arm_rs_r3_t4_c5,
+	arm_rs_r4_t4_c5,
+	arm_rs_r5_t4_c5,
+	arm_rs_r6_t4_c5,
+	arm_rs_r7_t4_c5,
+	arm_rs_r8_t4_c5,
+	arm_rs_r9_t4_c5,
+	arm_rs_r10_t4_c5,
+	arm_rs_r11_t4_c5,
+	arm_rs_r12_t4_c5,
+	arm_rs_r13_t4_c5,
+	arm_rs_r14_t4_c5,
+	arm_rs_r15_t4_c5,
+	arm_rs_r0_t5_c5,
+	arm_rs_r1_t5_c5,
+	arm_rs_r2_t5_c5,
+	arm_rs_r3_t5_c5,
+	arm_rs_r4_t5_c5,
+	arm_rs_r5_t5_c5,
+	arm_rs_r6_t5_c5,
+	arm_rs_r7_t5_c5,
+	arm_rs_r8_t5_c5,
+	arm_rs_r9_t5_c5,
+	arm_rs_r10_t5_c5,
+	arm_rs_r11_t5_c5,
+	arm_rs_r12_t5_c5,
+	arm_rs_r13_t5_c5,
+	arm_rs_r14_t5_c5,
+	arm_rs_r15_t5_c5,
+	arm_rs_r0_t6_c5,
+	arm_rs_r1_t6_c5,
+	arm_rs_r2_t6_c5,
+	arm_rs_r3_t6_c5,
+	arm_rs_r4_t6_c5,
+	arm_rs_r5_t6_c5,
+	arm_rs_r6_t6_c5,
+	arm_rs_r7_t6_c5,
+	arm_rs_r8_t6_c5,
+	arm_rs_r9_t6_c5,
+	arm_rs_r10_t6_c5,
+	arm_rs_r11_t6_c5,
+	arm_rs_r12_t6_c5,
+	arm_rs_r13_t6_c5,
+	arm_rs_r14_t6_c5,
+	arm_rs_r15_t6_c5,
+	arm_rs_r0_t7_c5,
+	arm_rs_r1_t7_c5,
+	arm_rs_r2_t7_c5,
+	arm_rs_r3_t7_c5,
+	arm_rs_r4_t7_c5,
+	arm_rs_r5_t7_c5,
+	arm_rs_r6_t7_c5,
+	arm_rs_r7_t7_c5,
+	arm_rs_r8_t7_c5,
+	arm_rs_r9_t7_c5,
+	arm_rs_r10_t7_c5,
+	arm_rs_r11_t7_c5,
+	arm_rs_r12_t7_c5,
+	arm_rs_r13_t7_c5,
+	arm_rs_r14_t7_c5,
+	arm_rs_r15_t7_c5,
+	arm_rs_r0_t0_c6,
+	arm_rs_r1_t0_c6,
+	arm_rs_r2_t0_c6,
+	arm_rs_r3_t0_c6,
+	arm_rs_r4_t0_c6,
+	arm_rs_r5_t0_c6,
+	arm_rs_r6_t0_c6,
+	arm_rs_r7_t0_c6,
+	arm_rs_r8_t0_c6,
+	arm_rs_r9_t0_c6,
+	arm_rs_r10_t0_c6,
+	arm_rs_r11_t0_c6,
+	arm_rs_r12_t0_c6,
+	arm_rs_r13_t0_c6,
+	arm_rs_r14_t0_c6,
+	arm_rs_r15_t0_c6,
+	arm_rs_r0_t1_c6,
+	arm_rs_r1_t1_c6,
+	arm_rs_r2_t1_c6,
+	arm_rs_r3_t1_c6,
+	arm_rs_r4_t1_c6,
+	arm_rs_r5_t1_c6,
+	arm_rs_r6_t1_c6,
+	arm_rs_r7_t1_c6,
+	arm_rs_r8_t1_c6,
+	arm_rs_r9_t1_c6,
+	arm_rs_r10_t1_c6,
+	arm_rs_r11_t1_c6,
+	arm_rs_r12_t1_c6,
+	arm_rs_r13_t1_c6,
+	arm_rs_r14_t1_c6,
+	arm_rs_r15_t1_c6,
+	arm_rs_r0_t2_c6,
+	arm_rs_r1_t2_c6,
+	arm_rs_r2_t2_c6,
+	arm_rs_r3_t2_c6,
+	arm_rs_r4_t2_c6,
+	arm_rs_r5_t2_c6,
+	arm_rs_r6_t2_c6,
+	arm_rs_r7_t2_c6,
+	arm_rs_r8_t2_c6,
+	arm_rs_r9_t2_c6,
+	arm_rs_r10_t2_c6,
+	arm_rs_r11_t2_c6,
+	arm_rs_r12_t2_c6,
+	arm_rs_r13_t2_c6,
+	arm_rs_r14_t2_c6,
+	arm_rs_r15_t2_c6,
+	arm_rs_r0_t3_c6,
+	arm_rs_r1_t3_c6,
+	arm_rs_r2_t3_c6,
+	arm_rs_r3_t3_c6,
+	arm_rs_r4_t3_c6,
+	arm_rs_r5_t3_c6,
+	arm_rs_r6_t3_c6,
+	arm_rs_r7_t3_c6,
+	arm_rs_r8_t3_c6,
+	arm_rs_r9_t3_c6,
+	arm_rs_r10_t3_c6,
+	arm_rs_r11_t3_c6,
+	arm_rs_r12_t3_c6,
+	arm_rs_r13_t3_c6,
+	arm_rs_r14_t3_c6,
+	arm_rs_r15_t3_c6,
+	arm_rs_r0_t4_c6,
+	arm_rs_r1_t4_c6,
+	arm_rs_r2_t4_c6,
+	arm_rs_r3_t4_c6,
+	arm_rs_r4_t4_c6,
+	arm_rs_r5_t4_c6,
+	arm_rs_r6_t4_c6,
+	arm_rs_r7_t4_c6,
+	arm_rs_r8_t4_c6,
+	arm_rs_r9_t4_c6,
+	arm_rs_r10_t4_c6,
+	arm_rs_r11_t4_c6,
+	arm_rs_r12_t4_c6,
+	arm_rs_r13_t4_c6,
+	arm_rs_r14_t4_c6,
+	arm_rs_r15_t4_c6,
+	arm_rs_r0_t5_c6,
+	arm_rs_r1_t5_c6,
+	arm_rs_r2_t5_c6,
+	arm_rs_r3_t5_c6,
+	arm_rs_r4_t5_c6,
+	arm_rs_r5_t5_c6,
+	arm_rs_r6_t5_c6,
+	arm_rs_r7_t5_c6,
+	arm_rs_r8_t5_c6,
+	arm_rs_r9_t5_c6,
+	arm_rs_r10_t5_c6,
+	arm_rs_r11_t5_c6,
+	arm_rs_r12_t5_c6,
+	arm_rs_r13_t5_c6,
+	arm_rs_r14_t5_c6,
+	arm_rs_r15_t5_c6,
+	arm_rs_r0_t6_c6,
+	arm_rs_r1_t6_c6,
+	arm_rs_r2_t6_c6,
+	arm_rs_r3_t6_c6,
+	arm_rs_r4_t6_c6,
+	arm_rs_r5_t6_c6,
+	arm_rs_r6_t6_c6,
+	arm_rs_r7_t6_c6,
+	arm_rs_r8_t6_c6,
+	arm_rs_r9_t6_c6,
+	arm_rs_r10_t6_c6,
+	arm_rs_r11_t6_c6,
+	arm_rs_r12_t6_c6,
+	arm_rs_r13_t6_c6,
+	arm_rs_r14_t6_c6,
+	arm_rs_r15_t6_c6,
+	arm_rs_r0_t7_c6,
+	arm_rs_r1_t7_c6,
+	arm_rs_r2_t7_c6,
+	arm_rs_r3_t7_c6,
+	arm_rs_r4_t7_c6,
+	arm_rs_r5_t7_c6,
+	arm_rs_r6_t7_c6,
+	arm_rs_r7_t7_c6,
+	arm_rs_r8_t7_c6,
+	arm_rs_r9_t7_c6,
+	arm_rs_r10_t7_c6,
+	arm_rs_r11_t7_c6,
+	arm_rs_r12_t7_c6,
+	arm_rs_r13_t7_c6,
+	arm_rs_r14_t7_c6,
+	arm_rs_r15_t7_c6,
+	arm_rs_r0_t0_c7,
+	arm_rs_r1_t0_c7,
+	arm_rs_r2_t0_c7,
+	arm_rs_r3_t0_c7,
+	arm_rs_r4_t0_c7,
+	arm_rs_r5_t0_c7,
+	arm_rs_r6_t0_c7,
+	arm_rs_r7_t0_c7,
+	arm_rs_r8_t0_c7,
+	arm_rs_r9_t0_c7,
+	arm_rs_r10_t0_c7,
+	arm_rs_r11_t0_c7,
+	arm_rs_r12_t0_c7,
+	arm_rs_r13_t0_c7,
+	arm_rs_r14_t0_c7,
+	arm_rs_r15_t0_c7,
+	arm_rs_r0_t1_c7,
+	arm_rs_r1_t1_c7,
+	arm_rs_r2_t1_c7,
+	arm_rs_r3_t1_c7,
+	arm_rs_r4_t1_c7,
+	arm_rs_r5_t1_c7,
+	arm_rs_r6_t1_c7,
+	arm_rs_r7_t1_c7,
+	arm_rs_r8_t1_c7,
+	arm_rs_r9_t1_c7,
+	arm_rs_r10_t1_c7,
+	arm_rs_r11_t1_c7,
+	arm_rs_r12_t1_c7,
+	arm_rs_r13_t1_c7,
+	arm_rs_r14_t1_c7,
+	arm_rs_r15_t1_c7,
+	arm_rs_r0_t2_c7,
+	arm_rs_r1_t2_c7,
+	arm_rs_r2_t2_c7,
+	arm_rs_r3_t2_c7,
+	arm_rs_r4_t2_c7,
+	arm_rs_r5_t2_c7,
+	arm_rs_r6_t2_c7,
+	arm_rs_r7_t2_c7,
+	arm_rs_r8_t2_c7,
+	arm_rs_r9_t2_c7,
+	arm_rs_r10_t2_c7,
+	arm_rs_r11_t2_c7,
+	arm_rs_r12_t2_c7,
+	arm_rs_r13_t2_c7,
+	arm_rs_r14_t2_c7,
+	arm_rs_r15_t2_c7,
+	arm_rs_r0_t3_c7,
+	arm_rs_r1_t3_c7,
+	arm_rs_r2_t3_c7,
+	arm_rs_r3_t3_c7,
+	arm_rs_r4_t3_c7,
+	arm_rs_r5_t3_c7,
+	arm_rs_r6_t3_c7,
+	arm_rs_r7_t3_c7,
+	arm_rs_r8_t3_c7,
+	arm_rs_r9_t3_c7,
+	arm_rs_r10_t3_c7,
+	arm_rs_r11_t3_c7,
+	arm_rs_r12_t3_c7,
+	arm_rs_r13_t3_c7,
+	arm_rs_r14_t3_c7,
+	arm_rs_r15_t3_c7,
+	arm_rs_r0_t4_c7,
+	arm_rs_r1_t4_c7,
+	arm_rs_r2_t4_c7,
+	arm_rs_r3_t4_c7,
+	arm_rs_r4_t4_c7,
+	arm_rs_r5_t4_c7,
+	arm_rs_r6_t4_c7,
+	arm_rs_r7_t4_c7,
+	arm_rs_r8_t4_c7,
+	arm_rs_r9_t4_c7,
+	arm_rs_r10_t4_c7,
+	arm_rs_r11_t4_c7,
+	arm_rs_r12_t4_c7,
+	arm_rs_r13_t4_c7,
+	arm_rs_r14_t4_c7,
+	arm_rs_r15_t4_c7,
+	arm_rs_r0_t5_c7,
+	arm_rs_r1_t5_c7,
+	arm_rs_r2_t5_c7,
+	arm_rs_r3_t5_c7,
+	arm_rs_r4_t5_c7,
+	arm_rs_r5_t5_c7,
+	arm_rs_r6_t5_c7,
+	arm_rs_r7_t5_c7,
+	arm_rs_r8_t5_c7,
+	arm_rs_r9_t5_c7,
+	arm_rs_r10_t5_c7,
+	arm_rs_r11_t5_c7,
+	arm_rs_r12_t5_c7,
+	arm_rs_r13_t5_c7,
+	arm_rs_r14_t5_c7,
+	arm_rs_r15_t5_c7,
+	arm_rs_r0_t6_c7,
+	arm_rs_r1_t6_c7,
+	arm_rs_r2_t6_c7,
+	arm_rs_r3_t6_c7,
+	arm_rs_r4_t6_c7,
+	arm_rs_r5_t6_c7,
+	arm_rs_r6_t6_c7,
+	arm_rs_r7_t6_c7,
+	arm_rs_r8_t6_c7,
+	arm_rs_r9_t6_c7,
+	arm_rs_r10_t6_c7,
+	arm_rs_r11_t6_c7,
+	arm_rs_r12_t6_c7,
+	arm_rs_r13_t6_c7,
+	arm_rs_r14_t6_c7,
+	arm_rs_r15_t6_c7,
+	arm_rs_r0_t7_c7,
+	arm_rs_r1_t7_c7,
+	arm_rs_r2_t7_c7,
+	arm_rs_r3_t7_c7,
+	arm_rs_r4_t7_c7,
+	arm_rs_r5_t7_c7,
+	arm_rs_r6_t7_c7,
+	arm_rs_r7_t7_c7,
+	arm_rs_r8_t7_c7,
+	arm_rs_r9_t7_c7,
+	arm_rs_r10_t7_c7,
+	arm_rs_r11_t7_c7,
+	arm_rs_r12_t7_c7,
+	arm_rs_r13_t7_c7,
+	arm_rs_r14_t7_c7,
+	arm_rs_r15_t7_c7,
+	arm_rs_r0_t0_c8,
+	arm_rs_r1_t0_c8,
+	arm_rs_r2_t0_c8,
+	arm_rs_r3_t0_c8,
+	arm_rs_r4_t0_c8,
+	arm_rs_r5_t0_c8,
+	arm_rs_r6_t0_c8,
+	arm_rs_r7_t0_c8,
+	arm_rs_r8_t0_c8,
+	arm_rs_r9_t0_c8,
+	arm_rs_r10_t0_c8,
+	arm_rs_r11_t0_c8,
+	arm_rs_r12_t0_c8,
+	arm_rs_r13_t0_c8,
+	arm_rs_r14_t0_c8,
+	arm_rs_r15_t0_c8,
+	arm_rs_r0_t1_c8,
+	arm_rs_r1_t1_c8,
+	arm_rs_r2_t1_c8,
+	arm_rs_r3_t1_c8,
+	arm_rs_r4_t1_c8,
+	arm_rs_r5_t1_c8,
+	arm_rs_r6_t1_c8,
+	arm_rs_r7_t1_c8,
+	arm_rs_r8_t1_c8,
+	arm_rs_r9_t1_c8,
+	arm_rs_r10_t1_c8,
+	arm_rs_r11_t1_c8,
+	arm_rs_r12_t1_c8,
+	arm_rs_r13_t1_c8,
+	arm_rs_r14_t1_c8,
+	arm_rs_r15_t1_c8,
+	arm_rs_r0_t2_c8,
+	arm_rs_r1_t2_c8,
+	arm_rs_r2_t2_c8,
+	arm_rs_r3_t2_c8,
+	arm_rs_r4_t2_c8,
+	arm_rs_r5_t2_c8,
+	arm_rs_r6_t2_c8,
+	arm_rs_r7_t2_c8,
+	arm_rs_r8_t2_c8,
+	arm_rs_r9_t2_c8,
+	arm_rs_r10_t2_c8,
+	arm_rs_r11_t2_c8,
+	arm_rs_r12_t2_c8,
+	arm_rs_r13_t2_c8,
+	arm_rs_r14_t2_c8,
+	arm_rs_r15_t2_c8,
+	arm_rs_r0_t3_c8,
+	arm_rs_r1_t3_c8,
+	arm_rs_r2_t3_c8,
+	arm_rs_r3_t3_c8,
+	arm_rs_r4_t3_c8,
+	arm_rs_r5_t3_c8,
+	arm_rs_r6_t3_c8,
+	arm_rs_r7_t3_c8,
+	arm_rs_r8_t3_c8,
+	arm_rs_r9_t3_c8,
+	arm_rs_r10_t3_c8,
+	arm_rs_r11_t3_c8,
+	arm_rs_r12_t3_c8,
+	arm_rs_r13_t3_c8,
+	arm_rs_r14_t3_c8,
+	arm_rs_r15_t3_c8,
+	arm_rs_r0_t4_c8,
+	arm_rs_r1_t4_c8,
+	arm_rs_r2_t4_c8,
+	arm_rs_r3_t4_c8,
+	arm_rs_r4_t4_c8,
+	arm_rs_r5_t4_c8,
+	arm_rs_r6_t4_c8,
+	arm_rs_r7_t4_c8,
+	arm_rs_r8_t4_c8,
+	arm_rs_r9_t4_c8,
+	arm_rs_r10_t4_c8,
+	arm_rs_r11_t4_c8,
+	arm_rs_r12_t4_c8,
+	arm_rs_r13_t4_c8,
+	arm_rs_r14_t4_c8,
+	arm_rs_r15_t4_c8,
+	arm_rs_r0_t5_c8,
+	arm_rs_r1_t5_c8,
+	arm_rs_r2_t5_c8,
+	arm_rs_r3_t5_c8,
+	arm_rs_r4_t5_c8,
+	arm_rs_r5_t5_c8,
+	arm_rs_r6_t5_c8,
+	arm_rs_r7_t5_c8,
+	arm_rs_r8_t5_c8,
+	arm_rs_r9_t5_c8,
+	arm_rs_r10_t5_c8,
+	arm_rs_r11_t5_c8,
+	arm_rs_r12_t5_c8,
+	arm_rs_r13_t5_c8,
+	arm_rs_r14_t5_c8,
+	arm_rs_r15_t5_c8,
+	arm_rs_r0_t6_c8,
+	arm_rs_r1_t6_c8,
+	arm_rs_r2_t6_c8,
+	arm_rs_r3_t6_c8,
+	arm_rs_r4_t6_c8,
+	arm_rs_r5_t6_c8,
+	arm_rs_r6_t6_c8,
+	arm_rs_r7_t6_c8,
+	arm_rs_r8_t6_c8,
+	arm_rs_r9_t6_c8,
+	arm_rs_r10_t6_c8,
+	arm_rs_r11_t6_c8,
+	arm_rs_r12_t6_c8,
+	arm_rs_r13_t6_c8,
+	arm_rs_r14_t6_c8,
+	arm_rs_r15_t6_c8,
+	arm_rs_r0_t7_c8,
+	arm_rs_r1_t7_c8,
+	arm_rs_r2_t7_c8,
+	arm_rs_r3_t7_c8,
+	arm_rs_r4_t7_c8,
+	arm_rs_r5_t7_c8,
+	arm_rs_r6_t7_c8,
+	arm_rs_r7_t7_c8,
+	arm_rs_r8_t7_c8,
+	arm_rs_r9_t7_c8,
+	arm_rs_r10_t7_c8,
+	arm_rs_r11_t7_c8,
+	arm_rs_r12_t7_c8,
+	arm_rs_r13_t7_c8,
+	arm_rs_r14_t7_c8,
+	arm_rs_r15_t7_c8,
+	arm_rs_r0_t0_c9,
+	arm_rs_r1_t0_c9,
+	arm_rs_r2_t0_c9,
+	arm_rs_r3_t0_c9,
+	arm_rs_r4_t0_c9,
+	arm_rs_r5_t0_c9,
+	arm_rs_r6_t0_c9,
+	arm_rs_r7_t0_c9,
+	arm_rs_r8_t0_c9,
+	arm_rs_r9_t0_c9,
+	arm_rs_r10_t0_c9,
+	arm_rs_r11_t0_c9,
+	arm_rs_r12_t0_c9,
+	arm_rs_r13_t0_c9,
+	arm_rs_r14_t0_c9,
+	arm_rs_r15_t0_c9,
+	arm_rs_r0_t1_c9,
+	arm_rs_r1_t1_c9,
+	arm_rs_r2_t1_c9,
+	arm_rs_r3_t1_c9,
+	arm_rs_r4_t1_c9,
+	arm_rs_r5_t1_c9,
+	arm_rs_r6_t1_c9,
+	arm_rs_r7_t1_c9,
+	arm_rs_r8_t1_c9,
+	arm_rs_r9_t1_c9,
+	arm_rs_r10_t1_c9,
+	arm_rs_r11_t1_c9,
+	arm_rs_r12_t1_c9,
+	arm_rs_r13_t1_c9,
+	arm_rs_r14_t1_c9,
+	arm_rs_r15_t1_c9,
+	arm_rs_r0_t2_c9,
+	arm_rs_r1_t2_c9,
+	arm_rs_r2_t2_c9,
+	arm_rs_r3_t2_c9,
+	arm_rs_r4_t2_c9,
+	arm_rs_r5_t2_c9,
+	arm_rs_r6_t2_c9,
+	arm_rs_r7_t2_c9,
+	arm_rs_r8_t2_c9,
+	arm_rs_r9_t2_c9,
+	arm_rs_r10_t2_c9,
+	arm_rs_r11_t2_c9,
+	arm_rs_r12_t2_c9,
+	arm_rs_r13_t2_c9,
+	arm_rs_r14_t2_c9,
+	arm_rs_r15_t2_c9,
+	arm_rs_r0_t3_c9,
+	arm_rs_r1_t3_c9,
+	arm_rs_r2_t3_c9,
+	arm_rs_r3_t3_c9,
+	arm_rs_r4_t3_c9,
+	arm_rs_r5_t3_c9,
+	arm_rs_r6_t3_c9,
+	arm_rs_r7_t3_c9,
+	arm_rs_r8_t3_c9,
+	arm_rs_r9_t3_c9,
+	arm_rs_r10_t3_c9,
+	arm_rs_r11_t3_c9,
+	arm_rs_r12_t3_c9,
+	arm_rs_r13_t3_c9,
+	arm_rs_r14_t3_c9,
+	arm_rs_r15_t3_c9,
+	arm_rs_r0_t4_c9,
+	arm_rs_r1_t4_c9,
+	arm_rs_r2_t4_c9,
+	arm_rs_r3_t4_c9,
+	arm_rs_r4_t4_c9,
+	arm_rs_r5_t4_c9,
+	arm_rs_r6_t4_c9,
+	arm_rs_r7_t4_c9,
+	arm_rs_r8_t4_c9,
+	arm_rs_r9_t4_c9,
+	arm_rs_r10_t4_c9,
+	arm_rs_r11_t4_c9,
+	arm_rs_r12_t4_c9,
+	arm_rs_r13_t4_c9,
+	arm_rs_r14_t4_c9,
+	arm_rs_r15_t4_c9,
+	arm_rs_r0_t5_c9,
+	arm_rs_r1_t5_c9,
+	arm_rs_r2_t5_c9,
+	arm_rs_r3_t5_c9,
+	arm_rs_r4_t5_c9,
+	arm_rs_r5_t5_c9,
+	arm_rs_r6_t5_c9,
+	arm_rs_r7_t5_c9,
+	arm_rs_r8_t5_c9,
+	arm_rs_r9_t5_c9,
+	arm_rs_r10_t5_c9,
+	arm_rs_r11_t5_c9,
+	arm_rs_r12_t5_c9,
+	arm_rs_r13_t5_c9,
+	arm_rs_r14_t5_c9,
+	arm_rs_r15_t5_c9,
+	arm_rs_r0_t6_c9,
+	arm_rs_r1_t6_c9,
+	arm_rs_r2_t6_c9,
+	arm_rs_r3_t6_c9,
+	arm_rs_r4_t6_c9,
+	arm_rs_r5_t6_c9,
+	arm_rs_r6_t6_c9,
+	arm_rs_r7_t6_c9,
+	arm_rs_r8_t6_c9,
+	arm_rs_r9_t6_c9,
+	arm_rs_r10_t6_c9,
+	arm_rs_r11_t6_c9,
+	arm_rs_r12_t6_c9,
+	arm_rs_r13_t6_c9,
+	arm_rs_r14_t6_c9,
+	arm_rs_r15_t6_c9,
+	arm_rs_r0_t7_c9,
+	arm_rs_r1_t7_c9,
+	arm_rs_r2_t7_c9,
+	arm_rs_r3_t7_c9,
+	arm_rs_r4_t7_c9,
+	arm_rs_r5_t7_c9,
+	arm_rs_r6_t7_c9,
+	arm_rs_r7_t7_c9,
+	arm_rs_r8_t7_c9,
+	arm_rs_r9_t7_c9,
+	arm_rs_r10_t7_c9,
+	arm_rs_r11_t7_c9,
+	arm_rs_r12_t7_c9,
+	arm_rs_r13_t7_c9,
+	arm_rs_r14_t7_c9,
+	arm_rs_r15_t7_c9,
+	arm_rs_r0_t0_c10,
+	arm_rs_r1_t0_c10,
+	arm_rs_r2_t0_c10,
+	arm_rs_r3_t0_c10,
+	arm_rs_r4_t0_c10,
+	arm_rs_r5_t0_c10,
+	arm_rs_r6_t0_c10,
+	arm_rs_r7_t0_c10,
+	arm_rs_r8_t0_c10,
+	arm_rs_r9_t0_c10,
+	arm_rs_r10_t0_c10,
+	arm_rs_r11_t0_c10,
+	arm_rs_r12_t0_c10,
+	arm_rs_r13_t0_c10,
+	arm_rs_r14_t0_c10,
+	arm_rs_r15_t0_c10,
+	arm_rs_r0_t1_c10,
+	arm_rs_r1_t1_c10,
+	arm_rs_r2_t1_c10,
+	arm_rs_r3_t1_c10,
+	arm_rs_r4_t1_c10,
+	arm_rs_r5_t1_c10,
+	arm_rs_r6_t1_c10,
+	arm_rs_r7_t1_c10,
+	arm_rs_r8_t1_c10,
+	arm_rs_r9_t1_c10,
+	arm_rs_r10_t1_c10,
+	arm_rs_r11_t1_c10,
+	arm_rs_r12_t1_c10,
+	arm_rs_r13_t1_c10,
+	arm_rs_r14_t1_c10,
+	arm_rs_r15_t1_c10,
+	arm_rs_r0_t2_c10,
+	arm_rs_r1_t2_c10,
+	arm_rs_r2_t2_c10,
+	arm_rs_r3_t2_c10,
+	arm_rs_r4_t2_c10,
+	arm_rs_r5_t2_c10,
+	arm_rs_r6_t2_c10,
+	arm_rs_r7_t2_c10,
+	arm_rs_r8_t2_c10,
+	arm_rs_r9_t2_c10,
+	arm_rs_r10_t2_c10,
+	arm_rs_r11_t2_c10,
+	arm_rs_r12_t2_c10,
+	arm_rs_r13_t2_c10,
+	arm_rs_r14_t2_c10,
+	arm_rs_r15_t2_c10,
+	arm_rs_r0_t3_c10,
+	arm_rs_r1_t3_c10,
+	arm_rs_r2_t3_c10,
+	arm_rs_r3_t3_c10,
+	arm_rs_r4_t3_c10,
+	arm_rs_r5_t3_c10,
+	arm_rs_r6_t3_c10,
+	arm_rs_r7_t3_c10,
+	arm_rs_r8_t3_c10,
+	arm_rs_r9_t3_c10,
+	arm_rs_r10_t3_c10,
+	arm_rs_r11_t3_c10,
+	arm_rs_r12_t3_c10,
+	arm_rs_r13_t3_c10,
+	arm_rs_r14_t3_c10,
+	arm_rs_r15_t3_c10,
+	arm_rs_r0_t4_c10,
+	arm_rs_r1_t4_c10,
+	arm_rs_r2_t4_c10,
+	arm_rs_r3_t4_c10,
+	arm_rs_r4_t4_c10,
+	arm_rs_r5_t4_c10,
+	arm_rs_r6_t4_c10,
+	arm_rs_r7_t4_c10,
+	arm_rs_r8_t4_c10,
+	arm_rs_r9_t4_c10,
+	arm_rs_r10_t4_c10,
+	arm_rs_r11_t4_c10,
+	arm_rs_r12_t4_c10,
+	arm_rs_r13_t4_c10,
+	arm_rs_r14_t4_c10,
+	arm_rs_r15_t4_c10,
+	arm_rs_r0_t5_c10,
+	arm_rs_r1_t5_c10,
+	arm_rs_r2_t5_c10,
+	arm_rs_r3_t5_c10,
+	arm_rs_r4_t5_c10,
+	arm_rs_r5_t5_c10,
+	arm_rs_r6_t5_c10,
+	arm_rs_r7_t5_c10,
+	arm_rs_r8_t5_c10,
+	arm_rs_r9_t5_c10,
+	arm_rs_r10_t5_c10,
+	arm_rs_r11_t5_c10,
+	arm_rs_r12_t5_c10,
+	arm_rs_r13_t5_c10,
+	arm_rs_r14_t5_c10,
+	arm_rs_r15_t5_c10,
+	arm_rs_r0_t6_c10,
+	arm_rs_r1_t6_c10,
+	arm_rs_r2_t6_c10,
+	arm_rs_r3_t6_c10,
+	arm_rs_r4_t6_c10,
+	arm_rs_r5_t6_c10,
+	arm_rs_r6_t6_c10,
+	arm_rs_r7_t6_c10,
+	arm_rs_r8_t6_c10,
+	arm_rs_r9_t6_c10,
+	arm_rs_r10_t6_c10,
+	arm_rs_r11_t6_c10,
+	arm_rs_r12_t6_c10,
+	arm_rs_r13_t6_c10,
+	arm_rs_r14_t6_c10,
+	arm_rs_r15_t6_c10,
+	arm_rs_r0_t7_c10,
+	arm_rs_r1_t7_c10,
+	arm_rs_r2_t7_c10,
+	arm_rs_r3_t7_c10,
+	arm_rs_r4_t7_c10,
+	arm_rs_r5_t7_c10,
+	arm_rs_r6_t7_c10,
+	arm_rs_r7_t7_c10,
+	arm_rs_r8_t7_c10,
+	arm_rs_r9_t7_c10,
+	arm_rs_r10_t7_c10,
+	arm_rs_r11_t7_c10,
+	arm_rs_r12_t7_c10,
+	arm_rs_r13_t7_c10,
+	arm_rs_r14_t7_c10,
+	arm_rs_r15_t7_c10,
+	arm_rs_r0_t0_c11,
+	arm_rs_r1_t0_c11,
+	arm_rs_r2_t0_c11,
+	arm_rs_r3_t0_c11,
+	arm_rs_r4_t0_c11,
+	arm_rs_r5_t0_c11,
+	arm_rs_r6_t0_c11,
+	arm_rs_r7_t0_c11,
+	arm_rs_r8_t0_c11,
+	arm_rs_r9_t0_c11,
+	arm_rs_r10_t0_c11,
+	arm_rs_r11_t0_c11,
+	arm_rs_r12_t0_c11,
+	arm_rs_r13_t0_c11,
+	arm_rs_r14_t0_c11,
+	arm_rs_r15_t0_c11,
+	arm_rs_r0_t1_c11,
+	arm_rs_r1_t1_c11,
+	arm_rs_r2_t1_c11,
+	arm_rs_r3_t1_c11,
+	arm_rs_r4_t1_c11,
+	arm_rs_r5_t1_c11,
+	arm_rs_r6_t1_c11,
+	arm_rs_r7_t1_c11,
+	arm_rs_r8_t1_c11,
+	arm_rs_r9_t1_c11,
+	arm_rs_r10_t1_c11,
+	arm_rs_r11_t1_c11,
+	arm_rs_r12_t1_c11,
+	arm_rs_r13_t1_c11,
+	arm_rs_r14_t1_c11,
+	arm_rs_r15_t1_c11,
+	arm_rs_r0_t2_c11,
+	arm_rs_r1_t2_c11,
+	arm_rs_r2_t2_c11,
+	arm_rs_r3_t2_c11,
+	arm_rs_r4_t2_c11,
+	arm_rs_r5_t2_c11,
+	arm_rs_r6_t2_c11,
+	arm_rs_r7_t2_c11,
+	arm_rs_r8_t2_c11,
+	arm_rs_r9_t2_c11,
+	arm_rs_r10_t2_c11,
+	arm_rs_r11_t2_c11,
+	arm_rs_r12_t2_c11,
+	arm_rs_r13_t2_c11,
+	arm_rs_r14_t2_c11,
+	arm_rs_r15_t2_c11,
+	arm_rs_r0_t3_c11,
+	arm_rs_r1_t3_c11,
+	arm_rs_r2_t3_c11,
+	arm_rs_r3_t3_c11,
+	arm_rs_r4_t3_c11,
+	arm_rs_r5_t3_c11,
+	arm_rs_r6_t3_c11,
+	arm_rs_r7_t3_c11,
+	arm_rs_r8_t3_c11,
+	arm_rs_r9_t3_c11,
+	arm_rs_r10_t3_c11,
+	arm_rs_r11_t3_c11,
+	arm_rs_r12_t3_c11,
+	arm_rs_r13_t3_c11,
+	arm_rs_r14_t3_c11,
+	arm_rs_r15_t3_c11,
+	arm_rs_r0_t4_c11,
+	arm_rs_r1_t4_c11,
+	arm_rs_r2_t4_c11,
+	arm_rs_r3_t4_c11,
+	arm_rs_r4_t4_c11,
+	arm_rs_r5_t4_c11,
+	arm_rs_r6_t4_c11,
+	arm_rs_r7_t4_c11,
+	arm_rs_r8_t4_c11,
+	arm_rs_r9_t4_c11,
+	arm_rs_r10_t4_c11,
+	arm_rs_r11_t4_c11,
+	arm_rs_r12_t4_c11,
+	arm_rs_r13_t4_c11,
+	arm_rs_r14_t4_c11,
+	arm_rs_r15_t4_c11,
+	arm_rs_r0_t5_c11,
+	arm_rs_r1_t5_c11,
+	arm_rs_r2_t5_c11,
+	arm_rs_r3_t5_c11,
+	arm_rs_r4_t5_c11,
+	arm_rs_r5_t5_c11,
+	arm_rs_r6_t5_c11,
+	arm_rs_r7_t5_c11,
+	arm_rs_r8_t5_c11,
+	arm_rs_r9_t5_c11,
+	arm_rs_r10_t5_c11,
+	arm_rs_r11_t5_c11,
+	arm_rs_r12_t5_c11,
+	arm_rs_r13_t5_c11,
+	arm_rs_r14_t5_c11,
+	arm_rs_r15_t5_c11,
+	arm_rs_r0_t6_c11,
+	arm_rs_r1_t6_c11,
+	arm_rs_r2_t6_c11,
+	arm_rs_r3_t6_c11,
+	arm_rs_r4_t6_c11,
+	arm_rs_r5_t6_c11,
+	arm_rs_r6_t6_c11,
+	arm_rs_r7_t6_c11,
+	arm_rs_r8_t6_c11,
+	arm_rs_r9_t6_c11,
+	arm_rs_r10_t6_c11,
+	arm_rs_r11_t6_c11,
+	arm_rs_r12_t6_c11,
+	arm_rs_r13_t6_c11,
+	arm_rs_r14_t6_c11,
+	arm_rs_r15_t6_c11,
+	arm_rs_r0_t7_c11,
+	arm_rs_r1_t7_c11,
+	arm_rs_r2_t7_c11,
+	arm_rs_r3_t7_c11,
+	arm_rs_r4_t7_c11,
+	arm_rs_r5_t7_c11,
+	arm_rs_r6_t7_c11,
+	arm_rs_r7_t7_c11,
+	arm_rs_r8_t7_c11,
+	arm_rs_r9_t7_c11,
+	arm_rs_r10_t7_c11,
+	arm_rs_r11_t7_c11,
+	arm_rs_r12_t7_c11,
+	arm_rs_r13_t7_c11,
+	arm_rs_r14_t7_c11,
+	arm_rs_r15_t7_c11,
+	arm_rs_r0_t0_c12,
+	arm_rs_r1_t0_c12,
+	arm_rs_r2_t0_c12,
+	arm_rs_r3_t0_c12,
+	arm_rs_r4_t0_c12,
+	arm_rs_r5_t0_c12,
+	arm_rs_r6_t0_c12,
+	arm_rs_r7_t0_c12,
+	arm_rs_r8_t0_c12,
+	arm_rs_r9_t0_c12,
+	arm_rs_r10_t0_c12,
+	arm_rs_r11_t0_c12,
+	arm_rs_r12_t0_c12,
+	arm_rs_r13_t0_c12,
+	arm_rs_r14_t0_c12,
+	arm_rs_r15_t0_c12,
+	arm_rs_r0_t1_c12,
+	arm_rs_r1_t1_c12,
+	arm_rs_r2_t1_c12,
+	arm_rs_r3_t1_c12,
+	arm_rs_r4_t1_c12,
+	arm_rs_r5_t1_c12,
+	arm_rs_r6_t1_c12,
+	arm_rs_r7_t1_c12,
+	arm_rs_r8_t1_c12,
+	arm_rs_r9_t1_c12,
+	arm_rs_r10_t1_c12,
+	arm_rs_r11_t1_c12,
+	arm_rs_r12_t1_c12,
+	arm_rs_r13_t1_c12,
+	arm_rs_r14_t1_c12,
+	arm_rs_r15_t1_c12,
+	arm_rs_r0_t2_c12,
+	arm_rs_r1_t2_c12,
+	arm_rs_r2_t2_c12,
+	arm_rs_r3_t2_c12,
+	arm_rs_r4_t2_c12,
+	arm_rs_r5_t2_c12,
+	arm_rs_r6_t2_c12,
+	arm_rs_r7_t2_c12,
+	arm_rs_r8_t2_c12,
+	arm_rs_r9_t2_c12,
+	arm_rs_r10_t2_c12,
+	arm_rs_r11_t2_c12,
+	arm_rs_r12_t2_c12,
+	arm_rs_r13_t2_c12,
+	arm_rs_r14_t2_c12,
+	arm_rs_r15_t2_c12,
+	arm_rs_r0_t3_c12,
+	arm_rs_r1_t3_c12,
+	arm_rs_r2_t3_c12,
+	arm_rs_r3_t3_c12,
+	arm_rs_r4_t3_c12,
+	arm_rs_r5_t3_c12,
+	arm_rs_r6_t3_c12,
+	arm_rs_r7_t3_c12,
+	arm_rs_r8_t3_c12,
+	arm_rs_r9_t3_c12,
+	arm_rs_r10_t3_c12,
+	arm_rs_r11_t3_c12,
+	arm_rs_r12_t3_c12,
+	arm_rs_r13_t3_c12,
+	arm_rs_r14_t3_c12,
+	arm_rs_r15_t3_c12,
+	arm_rs_r0_t4_c12,
+	arm_rs_r1_t4_c12,
+	arm_rs_r2_t4_c12,
+	arm_rs_r3_t4_c12,
+	arm_rs_r4_t4_c12,
+	arm_rs_r5_t4_c12,
+	arm_rs_r6_t4_c12,
+	arm_rs_r7_t4_c12,
+	arm_rs_r8_t4_c12,
+	arm_rs_r9_t4_c12,
+	arm_rs_r10_t4_c12,
+	arm_rs_r11_t4_c12,
+	arm_rs_r12_t4_c12,
+	arm_rs_r13_t4_c12,
+	arm_rs_r14_t4_c12,
+	arm_rs_r15_t4_c12,
+	arm_rs_r0_t5_c12,
+	arm_rs_r1_t5_c12,
+	arm_rs_r2_t5_c12,
+	arm_rs_r3_t5_c12,
+	arm_rs_r4_t5_c12,
+	arm_rs_r5_t5_c12,
+	arm_rs_r6_t5_c12,
+	arm_rs_r7_t5_c12,
+	arm_rs_r8_t5_c12,
+	arm_rs_r9_t5_c12,
+	arm_rs_r10_t5_c12,
+	arm_rs_r11_t5_c12,
+	arm_rs_r12_t5_c12,
+	arm_rs_r13_t5_c12,
+	arm_rs_r14_t5_c12,
+	arm_rs_r15_t5_c12,
+	arm_rs_r0_t6_c12,
+	arm_rs_r1_t6_c12,
+	arm_rs_r2_t6_c12,
+	arm_rs_r3_t6_c12,
+	arm_rs_r4_t6_c12,
+	arm_rs_r5_t6_c12,
+	arm_rs_r6_t6_c12,
+	arm_rs_r7_t6_c12,
+	arm_rs_r8_t6_c12,
+	arm_rs_r9_t6_c12,
+	arm_rs_r10_t6_c12,
+	arm_rs_r11_t6_c12,
+	arm_rs_r12_t6_c12,
+	arm_rs_r13_t6_c12,
+	arm_rs_r14_t6_c12,
+	arm_rs_r15_t6_c12,
+	arm_rs_r0_t7_c12,
+	arm_rs_r1_t7_c12,
+	arm_rs_r2_t7_c12,
+	arm_rs_r3_t7_c12,
+	arm_rs_r4_t7_c12,
+	arm_rs_r5_t7_c12,
+	arm_rs_r6_t7_c12,
+	arm_rs_r7_t7_c12,
+	arm_rs_r8_t7_c12,
+	arm_rs_r9_t7_c12,
+	arm_rs_r10_t7_c12,
+	arm_rs_r11_t7_c12,
+	arm_rs_r12_t7_c12,
+	arm_rs_r13_t7_c12,
+	arm_rs_r14_t7_c12,
+	arm_rs_r15_t7_c12,
+	arm_rs_r0_t0_c13,
+	arm_rs_r1_t0_c13,
+	arm_rs_r2_t0_c13,
+	arm_rs_r3_t0_c13,
+	arm_rs_r4_t0_c13,
+	arm_rs_r5_t0_c13,
+	arm_rs_r6_t0_c13,
+	arm_rs_r7_t0_c13,
+	arm_rs_r8_t0_c13,
+	arm_rs_r9_t0_c13,
+	arm_rs_r10_t0_c13,
+	arm_rs_r11_t0_c13,
+	arm_rs_r12_t0_c13,
+	arm_rs_r13_t0_c13,
+	arm_rs_r14_t0_c13,
+	arm_rs_r15_t0_c13,
+	arm_rs_r0_t1_c13,
+	arm_rs_r1_t1_c13,
+	arm_rs_r2_t1_c13,
+	arm_rs_r3_t1_c13,
+	arm_rs_r4_t1_c13,
+	arm_rs_r5_t1_c13,
+	arm_rs_r6_t1_c13,
+	arm_rs_r7_t1_c13,
+	arm_rs_r8_t1_c13,
+	arm_rs_r9_t1_c13,
+	arm_rs_r10_t1_c13,
+	arm_rs_r11_t1_c13,
+	arm_rs_r12_t1_c13,
+	arm_rs_r13_t1_c13,
+	arm_rs_r14_t1_c13,
+	arm_rs_r15_t1_c13,
+	arm_rs_r0_t2_c13,
+	arm_rs_r1_t2_c13,
+	arm_rs_r2_t2_c13,
+	arm_rs_r3_t2_c13,
+	arm_rs_r4_t2_c13,
+	arm_rs_r5_t2_c13,
+	arm_rs_r6_t2_c13,
+	arm_rs_r7_t2_c13,
+	arm_rs_r8_t2_c13,
+	arm_rs_r9_t2_c13,
+	arm_rs_r10_t2_c13,
+	arm_rs_r11_t2_c13,
+	arm_rs_r12_t2_c13,
+	arm_rs_r13_t2_c13,
+	arm_rs_r14_t2_c13,
+	arm_rs_r15_t2_c13,
+	arm_rs_r0_t3_c13,
+	arm_rs_r1_t3_c13,
+	arm_rs_r2_t3_c13,
+	arm_rs_r3_t3_c13,
+	arm_rs_r4_t3_c13,
+	arm_rs_r5_t3_c13,
+	arm_rs_r6_t3_c13,
+	arm_rs_r7_t3_c13,
+	arm_rs_r8_t3_c13,
+	arm_rs_r9_t3_c13,
+	arm_rs_r10_t3_c13,
+	arm_rs_r11_t3_c13,
+	arm_rs_r12_t3_c13,
+	arm_rs_r13_t3_c13,
+	arm_rs_r14_t3_c13,
+	arm_rs_r15_t3_c13,
+	arm_rs_r0_t4_c13,
+	arm_rs_r1_t4_c13,
+	arm_rs_r2_t4_c13,
+	arm_rs_r3_t4_c13,
+	arm_rs_r4_t4_c13,
+	arm_rs_r5_t4_c13,
+	arm_rs_r6_t4_c13,
+	arm_rs_r7_t4_c13,
+	arm_rs_r8_t4_c13,
+	arm_rs_r9_t4_c13,
+	arm_rs_r10_t4_c13,
+	arm_rs_r11_t4_c13,
+	arm_rs_r12_t4_c13,
+	arm_rs_r13_t4_c13,
+	arm_rs_r14_t4_c13,
+	arm_rs_r15_t4_c13,
+	arm_rs_r0_t5_c13,
+	arm_rs_r1_t5_c13,
+	arm_rs_r2_t5_c13,
+	arm_rs_r3_t5_c13,
+	arm_rs_r4_t5_c13,
+	arm_rs_r5_t5_c13,
+	arm_rs_r6_t5_c13,
+	arm_rs_r7_t5_c13,
+	arm_rs_r8_t5_c13,
+	arm_rs_r9_t5_c13,
+	arm_rs_r10_t5_c13,
+	arm_rs_r11_t5_c13,
+	arm_rs_r12_t5_c13,
+	arm_rs_r13_t5_c13,
+	arm_rs_r14_t5_c13,
+	arm_rs_r15_t5_c13,
+	arm_rs_r0_t6_c13,
+	arm_rs_r1_t6_c13,
+	arm_rs_r2_t6_c13,
+	arm_rs_r3_t6_c13,
+	arm_rs_r4_t6_c13,
+	arm_rs_r5_t6_c13,
+	arm_rs_r6_t6_c13,
+	arm_rs_r7_t6_c13,
+	arm_rs_r8_t6_c13,
+	arm_rs_r9_t6_c13,
+	arm_rs_r10_t6_c13,
+	arm_rs_r11_t6_c13,
+	arm_rs_r12_t6_c13,
+	arm_rs_r13_t6_c13,
+	arm_rs_r14_t6_c13,
+	arm_rs_r15_t6_c13,
+	arm_rs_r0_t7_c13,
+	arm_rs_r1_t7_c13,
+	arm_rs_r2_t7_c13,
+	arm_rs_r3_t7_c13,
+	arm_rs_r4_t7_c13,
+	arm_rs_r5_t7_c13,
+	arm_rs_r6_t7_c13,
+	arm_rs_r7_t7_c13,
+	arm_rs_r8_t7_c13,
+	arm_rs_r9_t7_c13,
+	arm_rs_r10_t7_c13,
+	arm_rs_r11_t7_c13,
+	arm_rs_r12_t7_c13,
+	arm_rs_r13_t7_c13,
+	arm_rs_r14_t7_c13,
+	arm_rs_r15_t7_c13,
+	arm_rs_r0_t0_c14,
+	arm_rs_r1_t0_c14,
+	arm_rs_r2_t0_c14,
+	arm_rs_r3_t0_c14,
+	arm_rs_r4_t0_c14,
+	arm_rs_r5_t0_c14,
+	arm_rs_r6_t0_c14,
+	arm_rs_r7_t0_c14,
+	arm_rs_r8_t0_c14,
+	arm_rs_r9_t0_c14,
+	arm_rs_r10_t0_c14,
+	arm_rs_r11_t0_c14,
+	arm_rs_r12_t0_c14,
+	arm_rs_r13_t0_c14,
+	arm_rs_r14_t0_c14,
+	arm_rs_r15_t0_c14,
+	arm_rs_r0_t1_c14,
+	arm_rs_r1_t1_c14,
+	arm_rs_r2_t1_c14,
+	arm_rs_r3_t1_c14,
+	arm_rs_r4_t1_c14,
+	arm_rs_r5_t1_c14,
+	arm_rs_r6_t1_c14,
+	arm_rs_r7_t1_c14,
+	arm_rs_r8_t1_c14,
+	arm_rs_r9_t1_c14,
+	arm_rs_r10_t1_c14,
+	arm_rs_r11_t1_c14,
+	arm_rs_r12_t1_c14,
+	arm_rs_r13_t1_c14,
+	arm_rs_r14_t1_c14,
+	arm_rs_r15_t1_c14,
+	arm_rs_r0_t2_c14,
+	arm_rs_r1_t2_c14,
+	arm_rs_r2_t2_c14,
+	arm_rs_r3_t2_c14,
+	arm_rs_r4_t2_c14,
+	arm_rs_r5_t2_c14,
+	arm_rs_r6_t2_c14,
+	arm_rs_r7_t2_c14,
+	arm_rs_r8_t2_c14,
+	arm_rs_r9_t2_c14,
+	arm_rs_r10_t2_c14,
+	arm_rs_r11_t2_c14,
+	arm_rs_r12_t2_c14,
+	arm_rs_r13_t2_c14,
+	arm_rs_r14_t2_c14,
+	arm_rs_r15_t2_c14,
+	arm_rs_r0_t3_c14,
+	arm_rs_r1_t3_c14,
+	arm_rs_r2_t3_c14,
+	arm_rs_r3_t3_c14,
+	arm_rs_r4_t3_c14,
+	arm_rs_r5_t3_c14,
+	arm_rs_r6_t3_c14,
+	arm_rs_r7_t3_c14,
+	arm_rs_r8_t3_c14,
+	arm_rs_r9_t3_c14,
+	arm_rs_r10_t3_c14,
+	arm_rs_r11_t3_c14,
+	arm_rs_r12_t3_c14,
+	arm_rs_r13_t3_c14,
+	arm_rs_r14_t3_c14,
+	arm_rs_r15_t3_c14,
+	arm_rs_r0_t4_c14,
+	arm_rs_r1_t4_c14,
+	arm_rs_r2_t4_c14,
+	arm_rs_r3_t4_c14,
+	arm_rs_r4_t4_c14,
+	arm_rs_r5_t4_c14,
+	arm_rs_r6_t4_c14,
+	arm_rs_r7_t4_c14,
+	arm_rs_r8_t4_c14,
+	arm_rs_r9_t4_c14,
+	arm_rs_r10_t4_c14,
+	arm_rs_r11_t4_c14,
+	arm_rs_r12_t4_c14,
+	arm_rs_r13_t4_c14,
+	arm_rs_r14_t4_c14,
+	arm_rs_r15_t4_c14,
+	arm_rs_r0_t5_c14,
+	arm_rs_r1_t5_c14,
+	arm_rs_r2_t5_c14,
+	arm_rs_r3_t5_c14,
+	arm_rs_r4_t5_c14,
+	arm_rs_r5_t5_c14,
+	arm_rs_r6_t5_c14,
+	arm_rs_r7_t5_c14,
+	arm_rs_r8_t5_c14,
+	arm_rs_r9_t5_c14,
+	arm_rs_r10_t5_c14,
+	arm_rs_r11_t5_c14,
+	arm_rs_r12_t5_c14,
+	arm_rs_r13_t5_c14,
+	arm_rs_r14_t5_c14,
+	arm_rs_r15_t5_c14,
+	arm_rs_r0_t6_c14,
+	arm_rs_r1_t6_c14,
+	arm_rs_r2_t6_c14,
+	arm_rs_r3_t6_c14,
+	arm_rs_r4_t6_c14,
+	arm_rs_r5_t6_c14,
+	arm_rs_r6_t6_c14,
+	arm_rs_r7_t6_c14,
+	arm_rs_r8_t6_c14,
+	arm_rs_r9_t6_c14,
+	arm_rs_r10_t6_c14,
+	arm_rs_r11_t6_c14,
+	arm_rs_r12_t6_c14,
+	arm_rs_r13_t6_c14,
+	arm_rs_r14_t6_c14,
+	arm_rs_r15_t6_c14,
+	arm_rs_r0_t7_c14,
+	arm_rs_r1_t7_c14,
+	arm_rs_r2_t7_c14,
+	arm_rs_r3_t7_c14,
+	arm_rs_r4_t7_c14,
+	arm_rs_r5_t7_c14,
+	arm_rs_r6_t7_c14,
+	arm_rs_r7_t7_c14,
+	arm_rs_r8_t7_c14,
+	arm_rs_r9_t7_c14,
+	arm_rs_r10_t7_c14,
+	arm_rs_r11_t7_c14,
+	arm_rs_r12_t7_c14,
+	arm_rs_r13_t7_c14,
+	arm_rs_r14_t7_c14,
+	arm_rs_r15_t7_c14,
+	arm_rs_r0_t0_c15,
+	arm_rs_r1_t0_c15,
+	arm_rs_r2_t0_c15,
+	arm_rs_r3_t0_c15,
+	arm_rs_r4_t0_c15,
+	arm_rs_r5_t0_c15,
+	arm_rs_r6_t0_c15,
+	arm_rs_r7_t0_c15,
+	arm_rs_r8_t0_c15,
+	arm_rs_r9_t0_c15,
+	arm_rs_r10_t0_c15,
+	arm_rs_r11_t0_c15,
+	arm_rs_r12_t0_c15,
+	arm_rs_r13_t0_c15,
+	arm_rs_r14_t0_c15,
+	arm_rs_r15_t0_c15,
+	arm_rs_r0_t1_c15,
+	arm_rs_r1_t1_c15,
+	arm_rs_r2_t1_c15,
+	arm_rs_r3_t1_c15,
+	arm_rs_r4_t1_c15,
+	arm_rs_r5_t1_c15,
+	arm_rs_r6_t1_c15,
+	arm_rs_r7_t1_c15,
+	arm_rs_r8_t1_c15,
+	arm_rs_r9_t1_c15,
+	arm_rs_r10_t1_c15,
+	arm_rs_r11_t1_c15,
+	arm_rs_r12_t1_c15,
+	arm_rs_r13_t1_c15,
+	arm_rs_r14_t1_c15,
+	arm_rs_r15_t1_c15,
+	arm_rs_r0_t2_c15,
+	arm_rs_r1_t2_c15,
+	arm_rs_r2_t2_c15,
+	arm_rs_r3_t2_c15,
+	arm_rs_r4_t2_c15,
+	arm_rs_r5_t2_c15,
+	arm_rs_r6_t2_c15,
+	arm_rs_r7_t2_c15,
+	arm_rs_r8_t2_c15,
+	arm_rs_r9_t2_c15,
+	arm_rs_r10_t2_c15,
+	arm_rs_r11_t2_c15,
+	arm_rs_r12_t2_c15,
+	arm_rs_r13_t2_c15,
+	arm_rs_r14_t2_c15,
+	arm_rs_r15_t2_c15,
+	arm_rs_r0_t3_c15,
+	arm_rs_r1_t3_c15,
+	arm_rs_r2_t3_c15,
+	arm_rs_r3_t3_c15,
+	arm_rs_r4_t3_c15,
+	arm_rs_r5_t3_c15,
+	arm_rs_r6_t3_c15,
+	arm_rs_r7_t3_c15,
+	arm_rs_r8_t3_c15,
+	arm_rs_r9_t3_c15,
+	arm_rs_r10_t3_c15,
+	arm_rs_r11_t3_c15,
+	arm_rs_r12_t3_c15,
+	arm_rs_r13_t3_c15,
+	arm_rs_r14_t3_c15,
+	arm_rs_r15_t3_c15,
+	arm_rs_r0_t4_c15,
+	arm_rs_r1_t4_c15,
+	arm_rs_r2_t4_c15,
+	arm_rs_r3_t4_c15,
+	arm_rs_r4_t4_c15,
+	arm_rs_r5_t4_c15,
+	arm_rs_r6_t4_c15,
+	arm_rs_r7_t4_c15,
+	arm_rs_r8_t4_c15,
+	arm_rs_r9_t4_c15,
+	arm_rs_r10_t4_c15,
+	arm_rs_r11_t4_c15,
+	arm_rs_r12_t4_c15,
+	arm_rs_r13_t4_c15,
+	arm_rs_r14_t4_c15,
+	arm_rs_r15_t4_c15,
+	arm_rs_r0_t5_c15,
+	arm_rs_r1_t5_c15,
+	arm_rs_r2_t5_c15,
+	arm_rs_r3_t5_c15,
+	arm_rs_r4_t5_c15,
+	arm_rs_r5_t5_c15,
+	arm_rs_r6_t5_c15,
+	arm_rs_r7_t5_c15,
+	arm_rs_r8_t5_c15,
+	arm_rs_r9_t5_c15,
+	arm_rs_r10_t5_c15,
+	arm_rs_r11_t5_c15,
+	arm_rs_r12_t5_c15,
+	arm_rs_r13_t5_c15,
+	arm_rs_r14_t5_c15,
+	arm_rs_r15_t5_c15,
+	arm_rs_r0_t6_c15,
+	arm_rs_r1_t6_c15,
+	arm_rs_r2_t6_c15,
+	arm_rs_r3_t6_c15,
+	arm_rs_r4_t6_c15,
+	arm_rs_r5_t6_c15,
+	arm_rs_r6_t6_c15,
+	arm_rs_r7_t6_c15,
+	arm_rs_r8_t6_c15,
+	arm_rs_r9_t6_c15,
+	arm_rs_r10_t6_c15,
+	arm_rs_r11_t6_c15,
+	arm_rs_r12_t6_c15,
+	arm_rs_r13_t6_c15,
+	arm_rs_r14_t6_c15,
+	arm_rs_r15_t6_c15,
+	arm_rs_r0_t7_c15,
+	arm_rs_r1_t7_c15,
+	arm_rs_r2_t7_c15,
+	arm_rs_r3_t7_c15,
+	arm_rs_r4_t7_c15,
+	arm_rs_r5_t7_c15,
+	arm_rs_r6_t7_c15,
+	arm_rs_r7_t7_c15,
+	arm_rs_r8_t7_c15,
+	arm_rs_r9_t7_c15,
+	arm_rs_r10_t7_c15,
+	arm_rs_r11_t7_c15,
+	arm_rs_r12_t7_c15,
+	arm_rs_r13_t7_c15,
+	arm_rs_r14_t7_c15,
+	arm_rs_r15_t7_c15,
+	arm_rs_r0_t0_c16,
+	arm_rs_r1_t0_c16,
+	arm_rs_r2_t0_c16,
+	arm_rs_r3_t0_c16,
+	arm_rs_r4_t0_c16,
+	arm_rs_r5_t0_c16,
+	arm_rs_r6_t0_c16,
+	arm_rs_r7_t0_c16,
+	arm_rs_r8_t0_c16,
+	arm_rs_r9_t0_c16,
+	arm_rs_r10_t0_c16,
+	arm_rs_r11_t0_c16,
+	arm_rs_r12_t0_c16,
+	arm_rs_r13_t0_c16,
+	arm_rs_r14_t0_c16,
+	arm_rs_r15_t0_c16,
+	arm_rs_r0_t1_c16,
+	arm_rs_r1_t1_c16,
+	arm_rs_r2_t1_c16,
+	arm_rs_r3_t1_c16,
+	arm_rs_r4_t1_c16,
+	arm_rs_r5_t1_c16,
+	arm_rs_r6_t1_c16,
+	arm_rs_r7_t1_c16,
+	arm_rs_r8_t1_c16,
+	arm_rs_r9_t1_c16,
+	arm_rs_r10_t1_c16,
+	arm_rs_r11_t1_c16,
+	arm_rs_r12_t1_c16,
+	arm_rs_r13_t1_c16,
+	arm_rs_r14_t1_c16,
+	arm_rs_r15_t1_c16,
+	arm_rs_r0_t2_c16,
+	arm_rs_r1_t2_c16,
+	arm_rs_r2_t2_c16,
+	arm_rs_r3_t2_c16,
+	arm_rs_r4_t2_c16,
+	arm_rs_r5_t2_c16,
+	arm_rs_r6_t2_c16,
+	arm_rs_r7_t2_c16,
+	arm_rs_r8_t2_c16,
+	arm_rs_r9_t2_c16,
+	arm_rs_r10_t2_c16,
+	arm_rs_r11_t2_c16,
+	arm_rs_r12_t2_c16,
+	arm_rs_r13_t2_c16,
+	arm_rs_r14_t2_c16,
+	arm_rs_r15_t2_c16,
+	arm_rs_r0_t3_c16,
+	arm_rs_r1_t3_c16,
+	arm_rs_r2_t3_c16,
+	arm_rs_r3_t3_c16,
+	arm_rs_r4_t3_c16,
+	arm_rs_r5_t3_c16,
+	arm_rs_r6_t3_c16,
+	arm_rs_r7_t3_c16,
+	arm_rs_r8_t3_c16,
+	arm_rs_r9_t3_c16,
+	arm_rs_r10_t3_c16,
+	arm_rs_r11_t3_c16,
+	arm_rs_r12_t3_c16,
+	arm_rs_r13_t3_c16,
+	arm_rs_r14_t3_c16,
+	arm_rs_r15_t3_c16,
+	arm_rs_r0_t4_c16,
+	arm_rs_r1_t4_c16,
+	arm_rs_r2_t4_c16,
+	arm_rs_r3_t4_c16,
+	arm_rs_r4_t4_c16,
+	arm_rs_r5_t4_c16,
+	arm_rs_r6_t4_c16,
+	arm_rs_r7_t4_c16,
+	arm_rs_r8_t4_c16,
+	arm_rs_r9_t4_c16,
+	arm_rs_r10_t4_c16,
+	arm_rs_r11_t4_c16,
+	arm_rs_r12_t4_c16,
+	arm_rs_r13_t4_c16,
+	arm_rs_r14_t4_c16,
+	arm_rs_r15_t4_c16,
+	arm_rs_r0_t5_c16,
+	arm_rs_r1_t5_c16,
+	arm_rs_r2_t5_c16,
+	arm_rs_r3_t5_c16,
+	arm_rs_r4_t5_c16,
+	arm_rs_r5_t5_c16,
+	arm_rs_r6_t5_c16,
+	arm_rs_r7_t5_c16,
+	arm_rs_r8_t5_c16,
+	arm_rs_r9_t5_c16,
+	arm_rs_r10_t5_c16,
+	arm_rs_r11_t5_c16,
+	arm_rs_r12_t5_c16,
+	arm_rs_r13_t5_c16,
+	arm_rs_r14_t5_c16,
+	arm_rs_r15_t5_c16,
+	arm_rs_r0_t6_c16,
+	arm_rs_r1_t6_c16,
+	arm_rs_r2_t6_c16,
+	arm_rs_r3_t6_c16,
+	arm_rs_r4_t6_c16,
+	arm_rs_r5_t6_c16,
+	arm_rs_r6_t6_c16,
+	arm_rs_r7_t6_c16,
+	arm_rs_r8_t6_c16,
+	arm_rs_r9_t6_c16,
+	arm_rs_r10_t6_c16,
+	arm_rs_r11_t6_c16,
+	arm_rs_r12_t6_c16,
+	arm_rs_r13_t6_c16,
+	arm_rs_r14_t6_c16,
+	arm_rs_r15_t6_c16,
+	arm_rs_r0_t7_c16,
+	arm_rs_r1_t7_c16,
+	arm_rs_r2_t7_c16,
+	arm_rs_r3_t7_c16,
+	arm_rs_r4_t7_c16,
+	arm_rs_r5_t7_c16,
+	arm_rs_r6_t7_c16,
+	arm_rs_r7_t7_c16,
+	arm_rs_r8_t7_c16,
+	arm_rs_r9_t7_c16,
+	arm_rs_r10_t7_c16,
+	arm_rs_r11_t7_c16,
+	arm_rs_r12_t7_c16,
+	arm_rs_r13_t7_c16,
+	arm_rs_r14_t7_c16,
+	arm_rs_r15_t7_c16,
+	arm_rs_r0_t0_c17,
+	arm_rs_r1_t0_c17,
+	arm_rs_r2_t0_c17,
+	arm_rs_r3_t0_c17,
+	arm_rs_r4_t0_c17,
+	arm_rs_r5_t0_c17,
+	arm_rs_r6_t0_c17,
+	arm_rs_r7_t0_c17,
+	arm_rs_r8_t0_c17,
+	arm_rs_r9_t0_c17,
+	arm_rs_r10_t0_c17,
+	arm_rs_r11_t0_c17,
+	arm_rs_r12_t0_c17,
+	arm_rs_r13_t0_c17,
+	arm_rs_r14_t0_c17,
+	arm_rs_r15_t0_c17,
+	arm_rs_r0_t1_c17,
+	arm_rs_r1_t1_c17,
+	arm_rs_r2_t1_c17,
+	arm_rs_r3_t1_c17,
+	arm_rs_r4_t1_c17,
+	arm_rs_r5_t1_c17,
+	arm_rs_r6_t1_c17,
+	arm_rs_r7_t1_c17,
+	arm_rs_r8_t1_c17,
+	arm_rs_r9_t1_c17,
+	arm_rs_r10_t1_c17,
+	arm_rs_r11_t1_c17,
+	arm_rs_r12_t1_c17,
+	arm_rs_r13_t1_c17,
+	arm_rs_r14_t1_c17,
+	arm_rs_r15_t1_c17,
+	arm_rs_r0_t2_c17,
+	arm_rs_r1_t2_c17,
+	arm_rs_r2_t2_c17,
+	arm_rs_r3_t2_c17,
+	arm_rs_r4_t2_c17,
+	arm_rs_r5_t2_c17,
+	arm_rs_r6_t2_c17,
+	arm_rs_r7_t2_c17,
+	arm_rs_r8_t2_c17,
+	arm_rs_r9_t2_c17,
+	arm_rs_r10_t2_c17,
+	arm_rs_r11_t2_c17,
+	arm_rs_r12_t2_c17,
+	arm_rs_r13_t2_c17,
+	arm_rs_r14_t2_c17,
+	arm_rs_r15_t2_c17,
+	arm_rs_r0_t3_c17,
+	arm_rs_r1_t3_c17,
+	arm_rs_r2_t3_c17,
+	arm_rs_r3_t3_c17,
+	arm_rs_r4_t3_c17,
+	arm_rs_r5_t3_c17,
+	arm_rs_r6_t3_c17,
+	arm_rs_r7_t3_c17,
+	arm_rs_r8_t3_c17,
+	arm_rs_r9_t3_c17,
+	arm_rs_r10_t3_c17,
+	arm_rs_r11_t3_c17,
+	arm_rs_r12_t3_c17,
+	arm_rs_r13_t3_c17,
+	arm_rs_r14_t3_c17,
+	arm_rs_r15_t3_c17,
+	arm_rs_r0_t4_c17,
+	arm_rs_r1_t4_c17,
+	arm_rs_r2_t4_c17,
+	arm_rs_r3_t4_c17,
+	arm_rs_r4_t4_c17,
+	arm_rs_r5_t4_c17,
+	arm_rs_r6_t4_c17,
+	arm_rs_r7_t4_c17,
+	arm_rs_r8_t4_c17,
+	arm_rs_r9_t4_c17,
+	arm_rs_r10_t4_c17,
+	arm_rs_r11_t4_c17,
+	arm_rs_r12_t4_c17,
+	arm_rs_r13_t4_c17,
+	arm_rs_r14_t4_c17,
+	arm_rs_r15_t4_c17,
+	arm_rs_r0_t5_c17,
+	arm_rs_r1_t5_c17,
+	arm_rs_r2_t5_c17,
+	arm_rs_r3_t5_c17,
+	arm_rs_r4_t5_c17,
+	arm_rs_r5_t5_c17,
+	arm_rs_r6_t5_c17,
+	arm_rs_r7_t5_c17,
+	arm_rs_r8_t5_c17,
+	arm_rs_r9_t5_c17,
+	arm_rs_r10_t5_c17,
+	arm_rs_r11_t5_c17,
+	arm_rs_r12_t5_c17,
+	arm_rs_r13_t5_c17,
+	arm_rs_r14_t5_c17,
+	arm_rs_r15_t5_c17,
+	arm_rs_r0_t6_c17,
+	arm_rs_r1_t6_c17,
+	arm_rs_r2_t6_c17,
+	arm_rs_r3_t6_c17,
+	arm_rs_r4_t6_c17,
+	arm_rs_r5_t6_c17,
+	arm_rs_r6_t6_c17,
+	arm_rs_r7_t6_c17,
+	arm_rs_r8_t6_c17,
+	arm_rs_r9_t6_c17,
+	arm_rs_r10_t6_c17,
+	arm_rs_r11_t6_c17,
+	arm_rs_r12_t6_c17,
+	arm_rs_r13_t6_c17,
+	arm_rs_r14_t6_c17,
+	arm_rs_r15_t6_c17,
+	arm_rs_r0_t7_c17,
+	arm_rs_r1_t7_c17,
+	arm_rs_r2_t7_c17,
+	arm_rs_r3_t7_c17,
+	arm_rs_r4_t7_c17,
+	arm_rs_r5_t7_c17,
+	arm_rs_r6_t7_c17,
+	arm_rs_r7_t7_c17,
+	arm_rs_r8_t7_c17,
+	arm_rs_r9_t7_c17,
+	arm_rs_r10_t7_c17,
+	arm_rs_r11_t7_c17,
+	arm_rs_r12_t7_c17,
+	arm_rs_r13_t7_c17,
+	arm_rs_r14_t7_c17,
+	arm_rs_r15_t7_c17,
+	arm_rs_r0_t0_c18,
+	arm_rs_r1_t0_c18,
+	arm_rs_r2_t0_c18,
+	arm_rs_r3_t0_c18,
+	arm_rs_r4_t0_c18,
+	arm_rs_r5_t0_c18,
+	arm_rs_r6_t0_c18,
+	arm_rs_r7_t0_c18,
+	arm_rs_r8_t0_c18,
+	arm_rs_r9_t0_c18,
+	arm_rs_r10_t0_c18,
+	arm_rs_r11_t0_c18,
+	arm_rs_r12_t0_c18,
+	arm_rs_r13_t0_c18,
+	arm_rs_r14_t0_c18,
+	arm_rs_r15_t0_c18,
+	arm_rs_r0_t1_c18,
+	arm_rs_r1_t1_c18,
+	arm_rs_r2_t1_c18,
+	arm_rs_r3_t1_c18,
+	arm_rs_r4_t1_c18,
+	arm_rs_r5_t1_c18,
+	arm_rs_r6_t1_c18,
+	arm_rs_r7_t1_c18,
+	arm_rs_r8_t1_c18,
+	arm_rs_r9_t1_c18,
+	arm_rs_r10_t1_c18,
+	arm_rs_r11_t1_c18,
+	arm_rs_r12_t1_c18,
+	arm_rs_r13_t1_c18,
+	arm_rs_r14_t1_c18,
+	arm_rs_r15_t1_c18,
+	arm_rs_r0_t2_c18,
+	arm_rs_r1_t2_c18,
+	arm_rs_r2_t2_c18,
+	arm_rs_r3_t2_c18,
+	arm_rs_r4_t2_c18,
+	arm_rs_r5_t2_c18,
+	arm_rs_r6_t2_c18,
+	arm_rs_r7_t2_c18,
+	arm_rs_r8_t2_c18,
+	arm_rs_r9_t2_c18,
+	arm_rs_r10_t2_c18,
+	arm_rs_r11_t2_c18,
+	arm_rs_r12_t2_c18,
+	arm_rs_r13_t2_c18,
+	arm_rs_r14_t2_c18,
+	arm_rs_r15_t2_c18,
+	arm_rs_r0_t3_c18,
+	arm_rs_r1_t3_c18,
+	arm_rs_r2_t3_c18,
+	arm_rs_r3_t3_c18,
+	arm_rs_r4_t3_c18,
+	arm_rs_r5_t3_c18,
+	arm_rs_r6_t3_c18,
+	arm_rs_r7_t3_c18,
+	arm_rs_r8_t3_c18,
+	arm_rs_r9_t3_c18,
+	arm_rs_r10_t3_c18,
+	arm_rs_r11_t3_c18,
+	arm_rs_r12_t3_c18,
+	arm_rs_r13_t3_c18,
+	arm_rs_r14_t3_c18,
+	arm_rs_r15_t3_c18,
+	arm_rs_r0_t4_c18,
+	arm_rs_r1_t4_c18,
+	arm_rs_r2_t4_c18,
+	arm_rs_r3_t4_c18,
+	arm_rs_r4_t4_c18,
+	arm_rs_r5_t4_c18,
+	arm_rs_r6_t4_c18,
+	arm_rs_r7_t4_c18,
+	arm_rs_r8_t4_c18,
+	arm_rs_r9_t4_c18,
+	arm_rs_r10_t4_c18,
+	arm_rs_r11_t4_c18,
+	arm_rs_r12_t4_c18,
+	arm_rs_r13_t4_c18,
+	arm_rs_r14_t4_c18,
+	arm_rs_r15_t4_c18,
+	arm_rs_r0_t5_c18,
+	arm_rs_r1_t5_c18,
+	arm_rs_r2_t5_c18,
+	arm_rs_r3_t5_c18,
+	arm_rs_r4_t5_c18,
+	arm_rs_r5_t5_c18,
+	arm_rs_r6_t5_c18,
+	arm_rs_r7_t5_c18,
+	arm_rs_r8_t5_c18,
+	arm_rs_r9_t5_c18,
+	arm_rs_r10_t5_c18,
+	arm_rs_r11_t5_c18,
+	arm_rs_r12_t5_c18,
+	arm_rs_r13_t5_c18,
+	arm_rs_r14_t5_c18,
+	arm_rs_r15_t5_c18,
+	arm_rs_r0_t6_c18,
+	arm_rs_r1_t6_c18,
+	arm_rs_r2_t6_c18,
+	arm_rs_r3_t6_c18,
+	arm_rs_r4_t6_c18,
+	arm_rs_r5_t6_c18,
+	arm_rs_r6_t6_c18,
+	arm_rs_r7_t6_c18,
+	arm_rs_r8_t6_c18,
+	arm_rs_r9_t6_c18,
+	arm_rs_r10_t6_c18,
+	arm_rs_r11_t6_c18,
+	arm_rs_r12_t6_c18,
+	arm_rs_r13_t6_c18,
+	arm_rs_r14_t6_c18,
+	arm_rs_r15_t6_c18,
+	arm_rs_r0_t7_c18,
+	arm_rs_r1_t7_c18,
+	arm_rs_r2_t7_c18,
+	arm_rs_r3_t7_c18,
+	arm_rs_r4_t7_c18,
+	arm_rs_r5_t7_c18,
+	arm_rs_r6_t7_c18,
+	arm_rs_r7_t7_c18,
+	arm_rs_r8_t7_c18,
+	arm_rs_r9_t7_c18,
+	arm_rs_r10_t7_c18,
+	arm_rs_r11_t7_c18,
+	arm_rs_r12_t7_c18,
+	arm_rs_r13_t7_c18,
+	arm_rs_r14_t7_c18,
+	arm_rs_r15_t7_c18,
+	arm_rs_r0_t0_c19,
+	arm_rs_r1_t0_c19,
+	arm_rs_r2_t0_c19,
+	arm_rs_r3_t0_c19,
+	arm_rs_r4_t0_c19,
+	arm_rs_r5_t0_c19,
+	arm_rs_r6_t0_c19,
+	arm_rs_r7_t0_c19,
+	arm_rs_r8_t0_c19,
+	arm_rs_r9_t0_c19,
+	arm_rs_r10_t0_c19,
+	arm_rs_r11_t0_c19,
+	arm_rs_r12_t0_c19,
+	arm_rs_r13_t0_c19,
+	arm_rs_r14_t0_c19,
+	arm_rs_r15_t0_c19,
+	arm_rs_r0_t1_c19,
+	arm_rs_r1_t1_c19,
+	arm_rs_r2_t1_c19,
+	arm_rs_r3_t1_c19,
+	arm_rs_r4_t1_c19,
+	arm_rs_r5_t1_c19,
+	arm_rs_r6_t1_c19,
+	arm_rs_r7_t1_c19,
+	arm_rs_r8_t1_c19,
+	arm_rs_r9_t1_c19,
+	arm_rs_r10_t1_c19,
+	arm_rs_r11_t1_c19,
+	arm_rs_r12_t1_c19,
+	arm_rs_r13_t1_c19,
+	arm_rs_r14_t1_c19,
+	arm_rs_r15_t1_c19,
+	arm_rs_r0_t2_c19,
+	arm_rs_r1_t2_c19,
+	arm_rs_r2_t2_c19,
+	arm_rs_r3_t2_c19,
+	arm_rs_r4_t2_c19,
+	arm_rs_r5_t2_c19,
+	arm_rs_r6_t2_c19,
+	arm_rs_r7_t2_c19,
+	arm_rs_r8_t2_c19,
+	arm_rs_r9_t2_c19,
+	arm_rs_r10_t2_c19,
+	arm_rs_r11_t2_c19,
+	arm_rs_r12_t2_c19,
+	arm_rs_r13_t2_c19,
+	arm_rs_r14_t2_c19,
+	arm_rs_r15_t2_c19,
+	arm_rs_r0_t3_c19,
+	arm_rs_r1_t3_c19,
+	arm_rs_r2_t3_c19,
+	arm_rs_r3_t3_c19,
+	arm_rs_r4_t3_c19,
+	arm_rs_r5_t3_c19,
+	arm_rs_r6_t3_c19,
+	arm_rs_r7_t3_c19,
+	arm_rs_r8_t3_c19,
+	arm_rs_r9_t3_c19,
+	arm_rs_r10_t3_c19,
+	arm_rs_r11_t3_c19,
+	arm_rs_r12_t3_c19,
+	arm_rs_r13_t3_c19,
+	arm_rs_r14_t3_c19,
+	arm_rs_r15_t3_c19,
+	arm_rs_r0_t4_c19,
+	arm_rs_r1_t4_c19,
+	arm_rs_r2_t4_c19,
+	arm_rs_r3_t4_c19,
+	arm_rs_r4_t4_c19,
+	arm_rs_r5_t4_c19,
+	arm_rs_r6_t4_c19,
+	arm_rs_r7_t4_c19,
+	arm_rs_r8_t4_c19,
+	arm_rs_r9_t4_c19,
+	arm_rs_r10_t4_c19,
+	arm_rs_r11_t4_c19,
+	arm_rs_r12_t4_c19,
+	arm_rs_r13_t4_c19,
+	arm_rs_r14_t4_c19,
+	arm_rs_r15_t4_c19,
+	arm_rs_r0_t5_c19,
+	arm_rs_r1_t5_c19,
+	arm_rs_r2_t5_c19,
+	arm_rs_r3_t5_c19,
+	arm_rs_r4_t5_c19,
+	arm_rs_r5_t5_c19,
+	arm_rs_r6_t5_c19,
+	arm_rs_r7_t5_c19,
+	arm_rs_r8_t5_c19,
+	arm_rs_r9_t5_c19,
+	arm_rs_r10_t5_c19,
+	arm_rs_r11_t5_c19,
+	arm_rs_r12_t5_c19,
+	arm_rs_r13_t5_c19,
+	arm_rs_r14_t5_c19,
+	arm_rs_r15_t5_c19,
+	arm_rs_r0_t6_c19,
+	arm_rs_r1_t6_c19,
+	arm_rs_r2_t6_c19,
+	arm_rs_r3_t6_c19,
+	arm_rs_r4_t6_c19,
+	arm_rs_r5_t6_c19,
+	arm_rs_r6_t6_c19,
+	arm_rs_r7_t6_c19,
+	arm_rs_r8_t6_c19,
+	arm_rs_r9_t6_c19,
+	arm_rs_r10_t6_c19,
+	arm_rs_r11_t6_c19,
+	arm_rs_r12_t6_c19,
+	arm_rs_r13_t6_c19,
+	arm_rs_r14_t6_c19,
+	arm_rs_r15_t6_c19,
+	arm_rs_r0_t7_c19,
+	arm_rs_r1_t7_c19,
+	arm_rs_r2_t7_c19,
+	arm_rs_r3_t7_c19,
+	arm_rs_r4_t7_c19,
+	arm_rs_r5_t7_c19,
+	arm_rs_r6_t7_c19,
+	arm_rs_r7_t7_c19,
+	arm_rs_r8_t7_c19,
+	arm_rs_r9_t7_c19,
+	arm_rs_r10_t7_c19,
+	arm_rs_r11_t7_c19,
+	arm_rs_r12_t7_c19,
+	arm_rs_r13_t7_c19,
+	arm_rs_r14_t7_c19,
+	arm_rs_r15_t7_c19,
+	arm_rs_r0_t0_c20,
+	arm_rs_r1_t0_c20,
+	arm_rs_r2_t0_c20,
+	arm_rs_r3_t0_c20,
+	arm_rs_r4_t0_c20,
+	arm_rs_r5_t0_c20,
+	arm_rs_r6_t0_c20,
+	arm_rs_r7_t0_c20,
+	arm_rs_r8_t0_c20,
+	arm_rs_r9_t0_c20,
+	arm_rs_r10_t0_c20,
+	arm_rs_r11_t0_c20,
+	arm_rs_r12_t0_c20,
+	arm_rs_r13_t0_c20,
+	arm_rs_r14_t0_c20,
+	arm_rs_r15_t0_c20,
+	arm_rs_r0_t1_c20,
+	arm_rs_r1_t1_c20,
+	arm_rs_r2_t1_c20,
+	arm_rs_r3_t1_c20,
+	arm_rs_r4_t1_c20,
+	arm_rs_r5_t1_c20,
+	arm_rs_r6_t1_c20,
+	arm_rs_r7_t1_c20,
+	arm_rs_r8_t1_c20,
+	arm_rs_r9_t1_c20,
+	arm_rs_r10_t1_c20,
+	arm_rs_r11_t1_c20,
+	arm_rs_r12_t1_c20,
+	arm_rs_r13_t1_c20,
+	arm_rs_r14_t1_c20,
+	arm_rs_r15_t1_c20,
+	arm_rs_r0_t2_c20,
+	arm_rs_r1_t2_c20,
+	arm_rs_r2_t2_c20,
+	arm_rs_r3_t2_c20,
+	arm_rs_r4_t2_c20,
+	arm_rs_r5_t2_c20,
+	arm_rs_r6_t2_c20,
+	arm_rs_r7_t2_c20,
+	arm_rs_r8_t2_c20,
+	arm_rs_r9_t2_c20,
+	arm_rs_r10_t2_c20,
+	arm_rs_r11_t2_c20,
+	arm_rs_r12_t2_c20,
+	arm_rs_r13_t2_c20,
+	arm_rs_r14_t2_c20,
+	arm_rs_r15_t2_c20,
+	arm_rs_r0_t3_c20,
+	arm_rs_r1_t3_c20,
+	arm_rs_r2_t3_c20,
+	arm_rs_r3_t3_c20,
+	arm_rs_r4_t3_c20,
+	arm_rs_r5_t3_c20,
+	arm_rs_r6_t3_c20,
+	arm_rs_r7_t3_c20,
+	arm_rs_r8_t3_c20,
+	arm_rs_r9_t3_c20,
+	arm_rs_r10_t3_c20,
+	arm_rs_r11_t3_c20,
+	arm_rs_r12_t3_c20,
+	arm_rs_r13_t3_c20,
+	arm_rs_r14_t3_c20,
+	arm_rs_r15_t3_c20,
+	arm_rs_r0_t4_c20,
+	arm_rs_r1_t4_c20,
+	arm_rs_r2_t4_c20,
+	arm_rs_r3_t4_c20,
+	arm_rs_r4_t4_c20,
+	arm_rs_r5_t4_c20,
+	arm_rs_r6_t4_c20,
+	arm_rs_r7_t4_c20,
+	arm_rs_r8_t4_c20,
+	arm_rs_r9_t4_c20,
+	arm_rs_r10_t4_c20,
+	arm_rs_r11_t4_c20,
+	arm_rs_r12_t4_c20,
+	arm_rs_r13_t4_c20,
+	arm_rs_r14_t4_c20,
+	arm_rs_r15_t4_c20,
+	arm_rs_r0_t5_c20,
+	arm_rs_r1_t5_c20,
+	arm_rs_r2_t5_c20,
+	arm_rs_r3_t5_c20,
+	arm_rs_r4_t5_c20,
+	arm_rs_r5_t5_c20,
+	arm_rs_r6_t5_c20,
+	arm_rs_r7_t5_c20,
+	arm_rs_r8_t5_c20,
+	arm_rs_r9_t5_c20,
+	arm_rs_r10_t5_c20,
+	arm_rs_r11_t5_c20,
+	arm_rs_r12_t5_c20,
+	arm_rs_r13_t5_c20,
+	arm_rs_r14_t5_c20,
+	arm_rs_r15_t5_c20,
+	arm_rs_r0_t6_c20,
+	arm_rs_r1_t6_c20,
+	arm_rs_r2_t6_c20,
+	arm_rs_r3_t6_c20,
+	arm_rs_r4_t6_c20,
+	arm_rs_r5_t6_c20,
+	arm_rs_r6_t6_c20,
+	arm_rs_r7_t6_c20,
+	arm_rs_r8_t6_c20,
+	arm_rs_r9_t6_c20,
+	arm_rs_r10_t6_c20,
+	arm_rs_r11_t6_c20,
+	arm_rs_r12_t6_c20,
+	arm_rs_r13_t6_c20,
+	arm_rs_r14_t6_c20,
+	arm_rs_r15_t6_c20,
+	arm_rs_r0_t7_c20,
+	arm_rs_r1_t7_c20,
+	arm_rs_r2_t7_c20,
+	arm_rs_r3_t7_c20,
+	arm_rs_r4_t7_c20,
+	arm_rs_r5_t7_c20,
+	arm_rs_r6_t7_c20,
+	arm_rs_r7_t7_c20,
+	arm_rs_r8_t7_c20,
+	arm_rs_r9_t7_c20,
+	arm_rs_r10_t7_c20,
+	arm_rs_r11_t7_c20,
+	arm_rs_r12_t7_c20,
+	arm_rs_r13_t7_c20,
+	arm_rs_r14_t7_c20,
+	arm_rs_r15_t7_c20,
+	arm_rs_r0_t0_c21,
+	arm_rs_r1_t0_c21,
+	arm_rs_r2_t0_c21,
+	arm_rs_r3_t0_c21,
+	arm_rs_r4_t0_c21,
+	arm_rs_r5_t0_c21,
+	arm_rs_r6_t0_c21,
+	arm_rs_r7_t0_c21,
+	arm_rs_r8_t0_c21,
+	arm_rs_r9_t0_c21,
+	arm_rs_r10_t0_c21,
+	arm_rs_r11_t0_c21,
+	arm_rs_r12_t0_c21,
+	arm_rs_r13_t0_c21,
+	arm_rs_r14_t0_c21,
+	arm_rs_r15_t0_c21,
+	arm_rs_r0_t1_c21,
+	arm_rs_r1_t1_c21,
+	arm_rs_r2_t1_c21,
+	arm_rs_r3_t1_c21,
+	arm_rs_r4_t1_c21,
+	arm_rs_r5_t1_c21,
+	arm_rs_r6_t1_c21,
+	arm_rs_r7_t1_c21,
+	arm_rs_r8_t1_c21,
+	arm_rs_r9_t1_c21,
+	arm_rs_r10_t1_c21,
+	arm_rs_r11_t1_c21,
+	arm_rs_r12_t1_c21,
+	arm_rs_r13_t1_c21,
+	arm_rs_r14_t1_c21,
+	arm_rs_r15_t1_c21,
+	arm_rs_r0_t2_c21,
+	arm_rs_r1_t2_c21,
+	arm_rs_r2_t2_c21,
+	arm_rs_r3_t2_c21,
+	arm_rs_r4_t2_c21,
+	arm_rs_r5_t2_c21,
+	arm_rs_r6_t2_c21,
+	arm_rs_r7_t2_c21,
+	arm_rs_r8_t2_c21,
+	arm_rs_r9_t2_c21,
+	arm_rs_r10_t2_c21,
+	arm_rs_r11_t2_c21,
+	arm_rs_r12_t2_c21,
+	arm_rs_r13_t2_c21,
+	arm_rs_r14_t2_c21,
+	arm_rs_r15_t2_c21,
+	arm_rs_r0_t3_c21,
+	arm_rs_r1_t3_c21,
+	arm_rs_r2_t3_c21,
+	arm_rs_r3_t3_c21,
+	arm_rs_r4_t3_c21,
+	arm_rs_r5_t3_c21,
+	arm_rs_r6_t3_c21,
+	arm_rs_r7_t3_c21,
+	arm_rs_r8_t3_c21,
+	arm_rs_r9_t3_c21,
+	arm_rs_r10_t3_c21,
+	arm_rs_r11_t3_c21,
+	arm_rs_r12_t3_c21,
+	arm_rs_r13_t3_c21,
+	arm_rs_r14_t3_c21,
+	arm_rs_r15_t3_c21,
+	arm_rs_r0_t4_c21,
+	arm_rs_r1_t4_c21,
+	arm_rs_r2_t4_c21,
+	arm_rs_r3_t4_c21,
+	arm_rs_r4_t4_c21,
+	arm_rs_r5_t4_c21,
+	arm_rs_r6_t4_c21,
+	arm_rs_r7_t4_c21,
+	arm_rs_r8_t4_c21,
+	arm_rs_r9_t4_c21,
+	arm_rs_r10_t4_c21,
+	arm_rs_r11_t4_c21,
+	arm_rs_r12_t4_c21,
+	arm_rs_r13_t4_c21,
+	arm_rs_r14_t4_c21,
+	arm_rs_r15_t4_c21,
+	arm_rs_r0_t5_c21,
+	arm_rs_r1_t5_c21,
+	arm_rs_r2_t5_c21,
+	arm_rs_r3_t5_c21,
+	arm_rs_r4_t5_c21,
+	arm_rs_r5_t5_c21,
+	arm_rs_r6_t5_c21,
+	arm_rs_r7_t5_c21,
+	arm_rs_r8_t5_c21,
+	arm_rs_r9_t5_c21,
+	arm_rs_r10_t5_c21,
+	arm_rs_r11_t5_c21,
+	arm_rs_r12_t5_c21,
+	arm_rs_r13_t5_c21,
+	arm_rs_r14_t5_c21,
+	arm_rs_r15_t5_c21,
+	arm_rs_r0_t6_c21,
+	arm_rs_r1_t6_c21,
+	arm_rs_r2_t6_c21,
+	arm_rs_r3_t6_c21,
+	arm_rs_r4_t6_c21,
+	arm_rs_r5_t6_c21,
+	arm_rs_r6_t6_c21,
+	arm_rs_r7_t6_c21,
+	arm_rs_r8_t6_c21,
+	arm_rs_r9_t6_c21,
+	arm_rs_r10_t6_c21,
+	arm_rs_r11_t6_c21,
+	arm_rs_r12_t6_c21,
+	arm_rs_r13_t6_c21,
+	arm_rs_r14_t6_c21,
+	arm_rs_r15_t6_c21,
+	arm_rs_r0_t7_c21,
+	arm_rs_r1_t7_c21,
+	arm_rs_r2_t7_c21,
+	arm_rs_r3_t7_c21,
+	arm_rs_r4_t7_c21,
+	arm_rs_r5_t7_c21,
+	arm_rs_r6_t7_c21,
+	arm_rs_r7_t7_c21,
+	arm_rs_r8_t7_c21,
+	arm_rs_r9_t7_c21,
+	arm_rs_r10_t7_c21,
+	arm_rs_r11_t7_c21,
+	arm_rs_r12_t7_c21,
+	arm_rs_r13_t7_c21,
+	arm_rs_r14_t7_c21,
+	arm_rs_r15_t7_c21,
+	arm_rs_r0_t0_c22,
+	arm_rs_r1_t0_c22,
+	arm_rs_r2_t0_c22,
+	arm_rs_r3_t0_c22,
+	arm_rs_r4_t0_c22,
+	arm_rs_r5_t0_c22,
+	arm_rs_r6_t0_c22,
+	arm_rs_r7_t0_c22,
+	arm_rs_r8_t0_c22,
+	arm_rs_r9_t0_c22,
+	arm_rs_r10_t0_c22,
+	arm_rs_r11_t0_c22,
+	arm_rs_r12_t0_c22,
+	arm_rs_r13_t0_c22,
+	arm_rs_r14_t0_c22,
+	arm_rs_r15_t0_c22,
+	arm_rs_r0_t1_c22,
+	arm_rs_r1_t1_c22,
+	arm_rs_r2_t1_c22,
+	arm_rs_r3_t1_c22,
+	arm_rs_r4_t1_c22,
+	arm_rs_r5_t1_c22,
+	arm_rs_r6_t1_c22,
+	arm_rs_r7_t1_c22,
+	arm_rs_r8_t1_c22,
+	arm_rs_r9_t1_c22,
+	arm_rs_r10_t1_c22,
+	arm_rs_r11_t1_c22,
+	arm_rs_r12_t1_c22,
+	arm_rs_r13_t1_c22,
+	arm_rs_r14_t1_c22,
+	arm_rs_r15_t1_c22,
+	arm_rs_r0_t2_c22,
+	arm_rs_r1_t2_c22,
+	arm_rs_r2_t2_c22,
+	arm_rs_r3_t2_c22,
+	arm_rs_r4_t2_c22,
+	arm_rs_r5_t2_c22,
+	arm_rs_r6_t2_c22,
+	arm_rs_r7_t2_c22,
+	arm_rs_r8_t2_c22,
+	arm_rs_r9_t2_c22,
+	arm_rs_r10_t2_c22,
+	arm_rs_r11_t2_c22,
+	arm_rs_r12_t2_c22,
+	arm_rs_r13_t2_c22,
+	arm_rs_r14_t2_c22,
+	arm_rs_r15_t2_c22,
+	arm_rs_r0_t3_c22,
+	arm_rs_r1_t3_c22,
+	arm_rs_r2_t3_c22,
+	arm_rs_r3_t3_c22,
+	arm_rs_r4_t3_c22,
+	arm_rs_r5_t3_c22,
+	arm_rs_r6_t3_c22,
+	arm_rs_r7_t3_c22,
+	arm_rs_r8_t3_c22,
+	arm_rs_r9_t3_c22,
+	arm_rs_r10_t3_c22,
+	arm_rs_r11_t3_c22,
+	arm_rs_r12_t3_c22,
+	arm_rs_r13_t3_c22,
+	arm_rs_r14_t3_c22,
+	arm_rs_r15_t3_c22,
+	arm_rs_r0_t4_c22,
+	arm_rs_r1_t4_c22,
+	arm_rs_r2_t4_c22,
+	arm_rs_r3_t4_c22,
+	arm_rs_r4_t4_c22,
+	arm_rs_r5_t4_c22,
+	arm_rs_r6_t4_c22,
+	arm_rs_r7_t4_c22,
+	arm_rs_r8_t4_c22,
+	arm_rs_r9_t4_c22,
+	arm_rs_r10_t4_c22,
+	arm_rs_r11_t4_c22,
+	arm_rs_r12_t4_c22,
+	arm_rs_r13_t4_c22,
+	arm_rs_r14_t4_c22,
+	arm_rs_r15_t4_c22,
+	arm_rs_r0_t5_c22,
+	arm_rs_r1_t5_c22,
+	arm_rs_r2_t5_c22,
+	arm_rs_r3_t5_c22,
+	arm_rs_r4_t5_c22,
+	arm_rs_r5_t5_c22,
+	arm_rs_r6_t5_c22,
+	arm_rs_r7_t5_c22,
+	arm_rs_r8_t5_c22,
+	arm_rs_r9_t5_c22,
+	arm_rs_r10_t5_c22,
+	arm_rs_r11_t5_c22,
+	arm_rs_r12_t5_c22,
+	arm_rs_r13_t5_c22,
+	arm_rs_r14_t5_c22,
+	arm_rs_r15_t5_c22,
+	arm_rs_r0_t6_c22,
+	arm_rs_r1_t6_c22,
+	arm_rs_r2_t6_c22,
+	arm_rs_r3_t6_c22,
+	arm_rs_r4_t6_c22,
+	arm_rs_r5_t6_c22,
+	arm_rs_r6_t6_c22,
+	arm_rs_r7_t6_c22,
+	arm_rs_r8_t6_c22,
+	arm_rs_r9_t6_c22,
+	arm_rs_r10_t6_c22,
+	arm_rs_r11_t6_c22,
+	arm_rs_r12_t6_c22,
+	arm_rs_r13_t6_c22,
+	arm_rs_r14_t6_c22,
+	arm_rs_r15_t6_c22,
+	arm_rs_r0_t7_c22,
+	arm_rs_r1_t7_c22,
+	arm_rs_r2_t7_c22,
+	arm_rs_r3_t7_c22,
+	arm_rs_r4_t7_c22,
+	arm_rs_r5_t7_c22,
+	arm_rs_r6_t7_c22,
+	arm_rs_r7_t7_c22,
+	arm_rs_r8_t7_c22,
+	arm_rs_r9_t7_c22,
+	arm_rs_r10_t7_c22,
+	arm_rs_r11_t7_c22,
+	arm_rs_r12_t7_c22,
+	arm_rs_r13_t7_c22,
+	arm_rs_r14_t7_c22,
+	arm_rs_r15_t7_c22,
+	arm_rs_r0_t0_c23,
+	arm_rs_r1_t0_c23,
+	arm_rs_r2_t0_c23,
+	arm_rs_r3_t0_c23,
+	arm_rs_r4_t0_c23,
+	arm_rs_r5_t0_c23,
+	arm_rs_r6_t0_c23,
+	arm_rs_r7_t0_c23,
+	arm_rs_r8_t0_c23,
+	arm_rs_r9_t0_c23,
+	arm_rs_r10_t0_c23,
+	arm_rs_r11_t0_c23,
+	arm_rs_r12_t0_c23,
+	arm_rs_r13_t0_c23,
+	arm_rs_r14_t0_c23,
+	arm_rs_r15_t0_c23,
+	arm_rs_r0_t1_c23,
+	arm_rs_r1_t1_c23,
+	arm_rs_r2_t1_c23,
+	arm_rs_r3_t1_c23,
+	arm_rs_r4_t1_c23,
+	arm_rs_r5_t1_c23,
+	arm_rs_r6_t1_c23,
+	arm_rs_r7_t1_c23,
+	arm_rs_r8_t1_c23,
+	arm_rs_r9_t1_c23,
+	arm_rs_r10_t1_c23,
+	arm_rs_r11_t1_c23,
+	arm_rs_r12_t1_c23,
+	arm_rs_r13_t1_c23,
+	arm_rs_r14_t1_c23,
+	arm_rs_r15_t1_c23,
+	arm_rs_r0_t2_c23,
+	arm_rs_r1_t2_c23,
+	arm_rs_r2_t2_c23,
+	arm_rs_r3_t2_c23,
+	arm_rs_r4_t2_c23,
+	arm_rs_r5_t2_c23,
+	arm_rs_r6_t2_c23,
+	arm_rs_r7_t2_c23,
+	arm_rs_r8_t2_c23,
+	arm_rs_r9_t2_c23,
+	arm_rs_r10_t2_c23,
+	arm_rs_r11_t2_c23,
+	arm_rs_r12_t2_c23,
+	arm_rs_r13_t2_c23,
+	arm_rs_r14_t2_c23,
+	arm_rs_r15_t2_c23,
+	arm_rs_r0_t3_c23,
+	arm_rs_r1_t3_c23,
+	arm_rs_r2_t3_c23,
+	arm_rs_r3_t3_c23,
+	arm_rs_r4_t3_c23,
+	arm_rs_r5_t3_c23,
+	arm_rs_r6_t3_c23,
+	arm_rs_r7_t3_c23,
+	arm_rs_r8_t3_c23,
+	arm_rs_r9_t3_c23,
+	arm_rs_r10_t3_c23,
+	arm_rs_r11_t3_c23,
+	arm_rs_r12_t3_c23,
+	arm_rs_r13_t3_c23,
+	arm_rs_r14_t3_c23,
+	arm_rs_r15_t3_c23,
+	arm_rs_r0_t4_c23,
+	arm_rs_r1_t4_c23,
+	arm_rs_r2_t4_c23,
+	arm_rs_r3_t4_c23,
+	arm_rs_r4_t4_c23,
+	arm_rs_r5_t4_c23,
+	arm_rs_r6_t4_c23,
+	arm_rs_r7_t4_c23,
+	arm_rs_r8_t4_c23,
+	arm_rs_r9_t4_c23,
+	arm_rs_r10_t4_c23,
+	arm_rs_r11_t4_c23,
+	arm_rs_r12_t4_c23,
+	arm_rs_r13_t4_c23,
+	arm_rs_r14_t4_c23,
+	arm_rs_r15_t4_c23,
+	arm_rs_r0_t5_c23,
+	arm_rs_r1_t5_c23,
+	arm_rs_r2_t5_c23,
+	arm_rs_r3_t5_c23,
+	arm_rs_r4_t5_c23,
+	arm_rs_r5_t5_c23,
+	arm_rs_r6_t5_c23,
+	arm_rs_r7_t5_c23,
+	arm_rs_r8_t5_c23,
+	arm_rs_r9_t5_c23,
+	arm_rs_r10_t5_c23,
+	arm_rs_r11_t5_c23,
+	arm_rs_r12_t5_c23,
+	arm_rs_r13_t5_c23,
+	arm_rs_r14_t5_c23,
+	arm_rs_r15_t5_c23,
+	arm_rs_r0_t6_c23,
+	arm_rs_r1_t6_c23,
+	arm_rs_r2_t6_c23,
+	arm_rs_r3_t6_c23,
+	arm_rs_r4_t6_c23,
+	arm_rs_r5_t6_c23,
+	arm_rs_r6_t6_c23,
+	arm_rs_r7_t6_c23,
+	arm_rs_r8_t6_c23,
+	arm_rs_r9_t6_c23,
+	arm_rs_r10_t6_c23,
+	arm_rs_r11_t6_c23,
+	arm_rs_r12_t6_c23,
+	arm_rs_r13_t6_c23,
+	arm_rs_r14_t6_c23,
+	arm_rs_r15_t6_c23,
+	arm_rs_r0_t7_c23,
+	arm_rs_r1_t7_c23,
+	arm_rs_r2_t7_c23,
+	arm_rs_r3_t7_c23,
+	arm_rs_r4_t7_c23,
+	arm_rs_r5_t7_c23,
+	arm_rs_r6_t7_c23,
+	arm_rs_r7_t7_c23,
+	arm_rs_r8_t7_c23,
+	arm_rs_r9_t7_c23,
+	arm_rs_r10_t7_c23,
+	arm_rs_r11_t7_c23,
+	arm_rs_r12_t7_c23,
+	arm_rs_r13_t7_c23,
+	arm_rs_r14_t7_c23,
+	arm_rs_r15_t7_c23,
+	arm_rs_r0_t0_c24,
+	arm_rs_r1_t0_c24,
+	arm_rs_r2_t0_c24,
+	arm_rs_r3_t0_c24,
+	arm_rs_r4_t0_c24,
+	arm_rs_r5_t0_c24,
+	arm_rs_r6_t0_c24,
+	arm_rs_r7_t0_c24,
+	arm_rs_r8_t0_c24,
+	arm_rs_r9_t0_c24,
+	arm_rs_r10_t0_c24,
+	arm_rs_r11_t0_c24,
+	arm_rs_r12_t0_c24,
+	arm_rs_r13_t0_c24,
+	arm_rs_r14_t0_c24,
+	arm_rs_r15_t0_c24,
+	arm_rs_r0_t1_c24,
+	arm_rs_r1_t1_c24,
+	arm_rs_r2_t1_c24,
+	arm_rs_r3_t1_c24,
+	arm_rs_r4_t1_c24,
+	arm_rs_r5_t1_c24,
+	arm_rs_r6_t1_c24,
+	arm_rs_r7_t1_c24,
+	arm_rs_r8_t1_c24,
+	arm_rs_r9_t1_c24,
+	arm_rs_r10_t1_c24,
+	arm_rs_r11_t1_c24,
+	arm_rs_r12_t1_c24,
+	arm_rs_r13_t1_c24,
+	arm_rs_r14_t1_c24,
+	arm_rs_r15_t1_c24,
+	arm_rs_r0_t2_c24,
+	arm_rs_r1_t2_c24,
+	arm_rs_r2_t2_c24,
+	arm_rs_r3_t2_c24,
+	arm_rs_r4_t2_c24,
+	arm_rs_r5_t2_c24,
+	arm_rs_r6_t2_c24,
+	arm_rs_r7_t2_c24,
+	arm_rs_r8_t2_c24,
+	arm_rs_r9_t2_c24,
+	arm_rs_r10_t2_c24,
+	arm_rs_r11_t2_c24,
+	arm_rs_r12_t2_c24,
+	arm_rs_r13_t2_c24,
+	arm_rs_r14_t2_c24,
+	arm_rs_r15_t2_c24,
+	arm_rs_r0_t3_c24,
+	arm_rs_r1_t3_c24,
+	arm_rs_r2_t3_c24,
+	arm_rs_r3_t3_c24,
+	arm_rs_r4_t3_c24,
+	arm_rs_r5_t3_c24,
+	arm_rs_r6_t3_c24,
+	arm_rs_r7_t3_c24,
+	arm_rs_r8_t3_c24,
+	arm_rs_r9_t3_c24,
+	arm_rs_r10_t3_c24,
+	arm_rs_r11_t3_c24,
+	arm_rs_r12_t3_c24,
+	arm_rs_r13_t3_c24,
+	arm_rs_r14_t3_c24,
+	arm_rs_r15_t3_c24,
+	arm_rs_r0_t4_c24,
+	arm_rs_r1_t4_c24,
+	arm_rs_r2_t4_c24,
+	arm_rs_r3_t4_c24,
+	arm_rs_r4_t4_c24,
+	arm_rs_r5_t4_c24,
+	arm_rs_r6_t4_c24,
+	arm_rs_r7_t4_c24,
+	arm_rs_r8_t4_c24,
+	arm_rs_r9_t4_c24,
+	arm_rs_r10_t4_c24,
+	arm_rs_r11_t4_c24,
+	arm_rs_r12_t4_c24,
+	arm_rs_r13_t4_c24,
+	arm_rs_r14_t4_c24,
+	arm_rs_r15_t4_c24,
+	arm_rs_r0_t5_c24,
+	arm_rs_r1_t5_c24,
+	arm_rs_r2_t5_c24,
+	arm_rs_r3_t5_c24,
+	arm_rs_r4_t5_c24,
+	arm_rs_r5_t5_c24,
+	arm_rs_r6_t5_c24,
+	arm_rs_r7_t5_c24,
+	arm_rs_r8_t5_c24,
+	arm_rs_r9_t5_c24,
+	arm_rs_r10_t5_c24,
+	arm_rs_r11_t5_c24,
+	arm_rs_r12_t5_c24,
+	arm_rs_r13_t5_c24,
+	arm_rs_r14_t5_c24,
+	arm_rs_r15_t5_c24,
+	arm_rs_r0_t6_c24,
+	arm_rs_r1_t6_c24,
+	arm_rs_r2_t6_c24,
+	arm_rs_r3_t6_c24,
+	arm_rs_r4_t6_c24,
+	arm_rs_r5_t6_c24,
+	arm_rs_r6_t6_c24,
+	arm_rs_r7_t6_c24,
+	arm_rs_r8_t6_c24,
+	arm_rs_r9_t6_c24,
+	arm_rs_r10_t6_c24,
+	arm_rs_r11_t6_c24,
+	arm_rs_r12_t6_c24,
+	arm_rs_r13_t6_c24,
+	arm_rs_r14_t6_c24,
+	arm_rs_r15_t6_c24,
+	arm_rs_r0_t7_c24,
+	arm_rs_r1_t7_c24,
+	arm_rs_r2_t7_c24,
+	arm_rs_r3_t7_c24,
+	arm_rs_r4_t7_c24,
+	arm_rs_r5_t7_c24,
+	arm_rs_r6_t7_c24,
+	arm_rs_r7_t7_c24,
+	arm_rs_r8_t7_c24,
+	arm_rs_r9_t7_c24,
+	arm_rs_r10_t7_c24,
+	arm_rs_r11_t7_c24,
+	arm_rs_r12_t7_c24,
+	arm_rs_r13_t7_c24,
+	arm_rs_r14_t7_c24,
+	arm_rs_r15_t7_c24,
+	arm_rs_r0_t0_c25,
+	arm_rs_r1_t0_c25,
+	arm_rs_r2_t0_c25,
+	arm_rs_r3_t0_c25,
+	arm_rs_r4_t0_c25,
+	arm_rs_r5_t0_c25,
+	arm_rs_r6_t0_c25,
+	arm_rs_r7_t0_c25,
+	arm_rs_r8_t0_c25,
+	arm_rs_r9_t0_c25,
+	arm_rs_r10_t0_c25,
+	arm_rs_r11_t0_c25,
+	arm_rs_r12_t0_c25,
+	arm_rs_r13_t0_c25,
+	arm_rs_r14_t0_c25,
+	arm_rs_r15_t0_c25,
+	arm_rs_r0_t1_c25,
+	arm_rs_r1_t1_c25,
+	arm_rs_r2_t1_c25,
+	arm_rs_r3_t1_c25,
+	arm_rs_r4_t1_c25,
+	arm_rs_r5_t1_c25,
+	arm_rs_r6_t1_c25,
+	arm_rs_r7_t1_c25,
+	arm_rs_r8_t1_c25,
+	arm_rs_r9_t1_c25,
+	arm_rs_r10_t1_c25,
+	arm_rs_r11_t1_c25,
+	arm_rs_r12_t1_c25,
+	arm_rs_r13_t1_c25,
+	arm_rs_r14_t1_c25,
+	arm_rs_r15_t1_c25,
+	arm_rs_r0_t2_c25,
+	arm_rs_r1_t2_c25,
+	arm_rs_r2_t2_c25,
+	arm_rs_r3_t2_c25,
+	arm_rs_r4_t2_c25,
+	arm_rs_r5_t2_c25,
+	arm_rs_r6_t2_c25,
+	arm_rs_r7_t2_c25,
+	arm_rs_r8_t2_c25,
+	arm_rs_r9_t2_c25,
+	arm_rs_r10_t2_c25,
+	arm_rs_r11_t2_c25,
+	arm_rs_r12_t2_c25,
+	arm_rs_r13_t2_c25,
+	arm_rs_r14_t2_c25,
+	arm_rs_r15_t2_c25,
+	arm_rs_r0_t3_c25,
+	arm_rs_r1_t3_c25,
+	arm_rs_r2_t3_c25,
+	arm_rs_r3_t3_c25,
+	arm_rs_r4_t3_c25,
+	arm_rs_r5_t3_c25,
+	arm_rs_r6_t3_c25,
+	arm_rs_r7_t3_c25,
+	arm_rs_r8_t3_c25,
+	arm_rs_r9_t3_c25,
+	arm_rs_r10_t3_c25,
+	arm_rs_r11_t3_c25,
+	arm_rs_r12_t3_c25,
+	arm_rs_r13_t3_c25,
+	arm_rs_r14_t3_c25,
+	arm_rs_r15_t3_c25,
+	arm_rs_r0_t4_c25,
+	arm_rs_r1_t4_c25,
+	arm_rs_r2_t4_c25,
+	arm_rs_r3_t4_c25,
+	arm_rs_r4_t4_c25,
+	arm_rs_r5_t4_c25,
+	arm_rs_r6_t4_c25,
+	arm_rs_r7_t4_c25,
+	arm_rs_r8_t4_c25,
+	arm_rs_r9_t4_c25,
+	arm_rs_r10_t4_c25,
+	arm_rs_r11_t4_c25,
+	arm_rs_r12_t4_c25,
+	arm_rs_r13_t4_c25,
+	arm_rs_r14_t4_c25,
+	arm_rs_r15_t4_c25,
+	arm_rs_r0_t5_c25,
+	arm_rs_r1_t5_c25,
+	arm_rs_r2_t5_c25,
+	arm_rs_r3_t5_c25,
+	arm_rs_r4_t5_c25,
+	arm_rs_r5_t5_c25,
+	arm_rs_r6_t5_c25,
+	arm_rs_r7_t5_c25,
+	arm_rs_r8_t5_c25,
+	arm_rs_r9_t5_c25,
+	arm_rs_r10_t5_c25,
+	arm_rs_r11_t5_c25,
+	arm_rs_r12_t5_c25,
+	arm_rs_r13_t5_c25,
+	arm_rs_r14_t5_c25,
+	arm_rs_r15_t5_c25,
+	arm_rs_r0_t6_c25,
+	arm_rs_r1_t6_c25,
+	arm_rs_r2_t6_c25,
+	arm_rs_r3_t6_c25,
+	arm_rs_r4_t6_c25,
+	arm_rs_r5_t6_c25,
+	arm_rs_r6_t6_c25,
+	arm_rs_r7_t6_c25,
+	arm_rs_r8_t6_c25,
+	arm_rs_r9_t6_c25,
+	arm_rs_r10_t6_c25,
+	arm_rs_r11_t6_c25,
+	arm_rs_r12_t6_c25,
+	arm_rs_r13_t6_c25,
+	arm_rs_r14_t6_c25,
+	arm_rs_r15_t6_c25,
+	arm_rs_r0_t7_c25,
+	arm_rs_r1_t7_c25,
+	arm_rs_r2_t7_c25,
+	arm_rs_r3_t7_c25,
+	arm_rs_r4_t7_c25,
+	arm_rs_r5_t7_c25,
+	arm_rs_r6_t7_c25,
+	arm_rs_r7_t7_c25,
+	arm_rs_r8_t7_c25,
+	arm_rs_r9_t7_c25,
+	arm_rs_r10_t7_c25,
+	arm_rs_r11_t7_c25,
+	arm_rs_r12_t7_c25,
+	arm_rs_r13_t7_c25,
+	arm_rs_r14_t7_c25,
+	arm_rs_r15_t7_c25,
+	arm_rs_r0_t0_c26,
+	arm_rs_r1_t0_c26,
+	arm_rs_r2_t0_c26,
+	arm_rs_r3_t0_c26,
+	arm_rs_r4_t0_c26,
+	arm_rs_r5_t0_c26,
+	arm_rs_r6_t0_c26,
+	arm_rs_r7_t0_c26,
+	arm_rs_r8_t0_c26,
+	arm_rs_r9_t0_c26,
+	arm_rs_r10_t0_c26,
+	arm_rs_r11_t0_c26,
+	arm_rs_r12_t0_c26,
+	arm_rs_r13_t0_c26,
+	arm_rs_r14_t0_c26,
+	arm_rs_r15_t0_c26,
+	arm_rs_r0_t1_c26,
+	arm_rs_r1_t1_c26,
+	arm_rs_r2_t1_c26,
+	arm_rs_r3_t1_c26,
+	arm_rs_r4_t1_c26,
+	arm_rs_r5_t1_c26,
+	arm_rs_r6_t1_c26,
+	arm_rs_r7_t1_c26,
+	arm_rs_r8_t1_c26,
+	arm_rs_r9_t1_c26,
+	arm_rs_r10_t1_c26,
+	arm_rs_r11_t1_c26,
+	arm_rs_r12_t1_c26,
+	arm_rs_r13_t1_c26,
+	arm_rs_r14_t1_c26,
+	arm_rs_r15_t1_c26,
+	arm_rs_r0_t2_c26,
+	arm_rs_r1_t2_c26,
+	arm_rs_r2_t2_c26,
+	arm_rs_r3_t2_c26,
+	arm_rs_r4_t2_c26,
+	arm_rs_r5_t2_c26,
+	arm_rs_r6_t2_c26,
+	arm_rs_r7_t2_c26,
+	arm_rs_r8_t2_c26,
+	arm_rs_r9_t2_c26,
+	arm_rs_r10_t2_c26,
+	arm_rs_r11_t2_c26,
+	arm_rs_r12_t2_c26,
+	arm_rs_r13_t2_c26,
+	arm_rs_r14_t2_c26,
+	arm_rs_r15_t2_c26,
+	arm_rs_r0_t3_c26,
+	arm_rs_r1_t3_c26,
+	arm_rs_r2_t3_c26,
+	arm_rs_r3_t3_c26,
+	arm_rs_r4_t3_c26,
+	arm_rs_r5_t3_c26,
+	arm_rs_r6_t3_c26,
+	arm_rs_r7_t3_c26,
+	arm_rs_r8_t3_c26,
+	arm_rs_r9_t3_c26,
+	arm_rs_r10_t3_c26,
+	arm_rs_r11_t3_c26,
+	arm_rs_r12_t3_c26,
+	arm_rs_r13_t3_c26,
+	arm_rs_r14_t3_c26,
+	arm_rs_r15_t3_c26,
+	arm_rs_r0_t4_c26,
+	arm_rs_r1_t4_c26,
+	arm_rs_r2_t4_c26,
+	arm_rs_r3_t4_c26,
+	arm_rs_r4_t4_c26,
+	arm_rs_r5_t4_c26,
+	arm_rs_r6_t4_c26,
+	arm_rs_r7_t4_c26,
+	arm_rs_r8_t4_c26,
+	arm_rs_r9_t4_c26,
+	arm_rs_r10_t4_c26,
+	arm_rs_r11_t4_c26,
+	arm_rs_r12_t4_c26,
+	arm_rs_r13_t4_c26,
+	arm_rs_r14_t4_c26,
+	arm_rs_r15_t4_c26,
+	arm_rs_r0_t5_c26,
+	arm_rs_r1_t5_c26,
+	arm_rs_r2_t5_c26,
+	arm_rs_r3_t5_c26,
+	arm_rs_r4_t5_c26,
+	arm_rs_r5_t5_c26,
+	arm_rs_r6_t5_c26,
+	arm_rs_r7_t5_c26,
+	arm_rs_r8_t5_c26,
+	arm_rs_r9_t5_c26,
+	arm_rs_r10_t5_c26,
+	arm_rs_r11_t5_c26,
+	arm_rs_r12_t5_c26,
+	arm_rs_r13_t5_c26,
+	arm_rs_r14_t5_c26,
+	arm_rs_r15_t5_c26,
+	arm_rs_r0_t6_c26,
+	arm_rs_r1_t6_c26,
+	arm_rs_r2_t6_c26,
+	arm_rs_r3_t6_c26,
+	arm_rs_r4_t6_c26,
+	arm_rs_r5_t6_c26,
+	arm_rs_r6_t6_c26,
+	arm_rs_r7_t6_c26,
+	arm_rs_r8_t6_c26,
+	arm_rs_r9_t6_c26,
+	arm_rs_r10_t6_c26,
+	arm_rs_r11_t6_c26,
+	arm_rs_r12_t6_c26,
+	arm_rs_r13_t6_c26,
+	arm_rs_r14_t6_c26,
+	arm_rs_r15_t6_c26,
+	arm_rs_r0_t7_c26,
+	arm_rs_r1_t7_c26,
+	arm_rs_r2_t7_c26,
+	arm_rs_r3_t7_c26,
+	arm_rs_r4_t7_c26,
+	arm_rs_r5_t7_c26,
+	arm_rs_r6_t7_c26,
+	arm_rs_r7_t7_c26,
+	arm_rs_r8_t7_c26,
+	arm_rs_r9_t7_c26,
+	arm_rs_r10_t7_c26,
+	arm_rs_r11_t7_c26,
+	arm_rs_r12_t7_c26,
+	arm_rs_r13_t7_c26,
+	arm_rs_r14_t7_c26,
+	arm_rs_r15_t7_c26,
+	arm_rs_r0_t0_c27,
+	arm_rs_r1_t0_c27,
+	arm_rs_r2_t0_c27,
+	arm_rs_r3_t0_c27,
+	arm_rs_r4_t0_c27,
+	arm_rs_r5_t0_c27,
+	arm_rs_r6_t0_c27,
+	arm_rs_r7_t0_c27,
+	arm_rs_r8_t0_c27,
+	arm_rs_r9_t0_c27,
+	arm_rs_r10_t0_c27,
+	arm_rs_r11_t0_c27,
+	arm_rs_r12_t0_c27,
+	arm_rs_r13_t0_c27,
+	arm_rs_r14_t0_c27,
+	arm_rs_r15_t0_c27,
+	arm_rs_r0_t1_c27,
+	arm_rs_r1_t1_c27,
+	arm_rs_r2_t1_c27,
+	arm_rs_r3_t1_c27,
+	arm_rs_r4_t1_c27,
+	arm_rs_r5_t1_c27,
+	arm_rs_r6_t1_c27,
+	arm_rs_r7_t1_c27,
+	arm_rs_r8_t1_c27,
+	arm_rs_r9_t1_c27,
+	arm_rs_r10_t1_c27,
+	arm_rs_r11_t1_c27,
+	arm_rs_r12_t1_c27,
+	arm_rs_r13_t1_c27,
+	arm_rs_r14_t1_c27,
+	arm_rs_r15_t1_c27,
+	arm_rs_r0_t2_c27,
+	arm_rs_r1_t2_c27,
+	arm_rs_r2_t2_c27,
+	arm_rs_r3_t2_c27,
+	arm_rs_r4_t2_c27,
+	arm_rs_r5_t2_c27,
+	arm_rs_r6_t2_c27,
+	arm_rs_r7_t2_c27,
+	arm_rs_r8_t2_c27,
+	arm_rs_r9_t2_c27,
+	arm_rs_r10_t2_c27,
+	arm_rs_r11_t2_c27,
+	arm_rs_r12_t2_c27,
+	arm_rs_r13_t2_c27,
+	arm_rs_r14_t2_c27,
+	arm_rs_r15_t2_c27,
+	arm_rs_r0_t3_c27,
+	arm_rs_r1_t3_c27,
+	arm_rs_r2_t3_c27,
+	arm_rs_r3_t3_c27,
+	arm_rs_r4_t3_c27,
+	arm_rs_r5_t3_c27,
+	arm_rs_r6_t3_c27,
+	arm_rs_r7_t3_c27,
+	arm_rs_r8_t3_c27,
+	arm_rs_r9_t3_c27,
+	arm_rs_r10_t3_c27,
+	arm_rs_r11_t3_c27,
+	arm_rs_r12_t3_c27,
+	arm_rs_r13_t3_c27,
+	arm_rs_r14_t3_c27,
+	arm_rs_r15_t3_c27,
+	arm_rs_r0_t4_c27,
+	arm_rs_r1_t4_c27,
+	arm_rs_r2_t4_c27,
+	arm_rs_r3_t4_c27,
+	arm_rs_r4_t4_c27,
+	arm_rs_r5_t4_c27,
+	arm_rs_r6_t4_c27,
+	arm_rs_r7_t4_c27,
+	arm_rs_r8_t4_c27,
+	arm_rs_r9_t4_c27,
+	arm_rs_r10_t4_c27,
+	arm_rs_r11_t4_c27,
+	arm_rs_r12_t4_c27,
+	arm_rs_r13_t4_c27,
+	arm_rs_r14_t4_c27,
+	arm_rs_r15_t4_c27,
+	arm_rs_r0_t5_c27,
+	arm_rs_r1_t5_c27,
+	arm_rs_r2_t5_c27,
+	arm_rs_r3_t5_c27,
+	arm_rs_r4_t5_c27,
+	arm_rs_r5_t5_c27,
+	arm_rs_r6_t5_c27,
+	arm_rs_r7_t5_c27,
+	arm_rs_r8_t5_c27,
+	arm_rs_r9_t5_c27,
+	arm_rs_r10_t5_c27,
+	arm_rs_r11_t5_c27,
+	arm_rs_r12_t5_c27,
+	arm_rs_r13_t5_c27,
+	arm_rs_r14_t5_c27,
+	arm_rs_r15_t5_c27,
+	arm_rs_r0_t6_c27,
+	arm_rs_r1_t6_c27,
+	arm_rs_r2_t6_c27,
+	arm_rs_r3_t6_c27,
+	arm_rs_r4_t6_c27,
+	arm_rs_r5_t6_c27,
+	arm_rs_r6_t6_c27,
+	arm_rs_r7_t6_c27,
+	arm_rs_r8_t6_c27,
+	arm_rs_r9_t6_c27,
+	arm_rs_r10_t6_c27,
+	arm_rs_r11_t6_c27,
+	arm_rs_r12_t6_c27,
+	arm_rs_r13_t6_c27,
+	arm_rs_r14_t6_c27,
+	arm_rs_r15_t6_c27,
+	arm_rs_r0_t7_c27,
+	arm_rs_r1_t7_c27,
+	arm_rs_r2_t7_c27,
+	arm_rs_r3_t7_c27,
+	arm_rs_r4_t7_c27,
+	arm_rs_r5_t7_c27,
+	arm_rs_r6_t7_c27,
+	arm_rs_r7_t7_c27,
+	arm_rs_r8_t7_c27,
+	arm_rs_r9_t7_c27,
+	arm_rs_r10_t7_c27,
+	arm_rs_r11_t7_c27,
+	arm_rs_r12_t7_c27,
+	arm_rs_r13_t7_c27,
+	arm_rs_r14_t7_c27,
+	arm_rs_r15_t7_c27,
+	arm_rs_r0_t0_c28,
+	arm_rs_r1_t0_c28,
+	arm_rs_r2_t0_c28,
+	arm_rs_r3_t0_c28,
+	arm_rs_r4_t0_c28,
+	arm_rs_r5_t0_c28,
+	arm_rs_r6_t0_c28,
+	arm_rs_r7_t0_c28,
+	arm_rs_r8_t0_c28,
+	arm_rs_r9_t0_c28,
+	arm_rs_r10_t0_c28,
+	arm_rs_r11_t0_c28,
+	arm_rs_r12_t0_c28,
+	arm_rs_r13_t0_c28,
+	arm_rs_r14_t0_c28,
+	arm_rs_r15_t0_c28,
+	arm_rs_r0_t1_c28,
+	arm_rs_r1_t1_c28,
+	arm_rs_r2_t1_c28,
+	arm_rs_r3_t1_c28,
+	arm_rs_r4_t1_c28,
+	arm_rs_r5_t1_c28,
+	arm_rs_r6_t1_c28,
+	arm_rs_r7_t1_c28,
+	arm_rs_r8_t1_c28,
+	arm_rs_r9_t1_c28,
+	arm_rs_r10_t1_c28,
+	arm_rs_r11_t1_c28,
+	arm_rs_r12_t1_c28,
+	arm_rs_r13_t1_c28,
+	arm_rs_r14_t1_c28,
+	arm_rs_r15_t1_c28,
+	arm_rs_r0_t2_c28,
+	arm_rs_r1_t2_c28,
+	arm_rs_r2_t2_c28,
+	arm_rs_r3_t2_c28,
+	arm_rs_r4_t2_c28,
+	arm_rs_r5_t2_c28,
+	arm_rs_r6_t2_c28,
+	arm_rs_r7_t2_c28,
+	arm_rs_r8_t2_c28,
+	arm_rs_r9_t2_c28,
+	arm_rs_r10_t2_c28,
+	arm_rs_r11_t2_c28,
+	arm_rs_r12_t2_c28,
+	arm_rs_r13_t2_c28,
+	arm_rs_r14_t2_c28,
+	arm_rs_r15_t2_c28,
+	arm_rs_r0_t3_c28,
+	arm_rs_r1_t3_c28,
+	arm_rs_r2_t3_c28,
+	arm_rs_r3_t3_c28,
+	arm_rs_r4_t3_c28,
+	arm_rs_r5_t3_c28,
+	arm_rs_r6_t3_c28,
+	arm_rs_r7_t3_c28,
+	arm_rs_r8_t3_c28,
+	arm_rs_r9_t3_c28,
+	arm_rs_r10_t3_c28,
+	arm_rs_r11_t3_c28,
+	arm_rs_r12_t3_c28,
+	arm_rs_r13_t3_c28,
+	arm_rs_r14_t3_c28,
+	arm_rs_r15_t3_c28,
+	arm_rs_r0_t4_c28,
+	arm_rs_r1_t4_c28,
+	arm_rs_r2_t4_c28,
+	arm_rs_r3_t4_c28,
+	arm_rs_r4_t4_c28,
+	arm_rs_r5_t4_c28,
+	arm_rs_r6_t4_c28,
+	arm_rs_r7_t4_c28,
+	arm_rs_r8_t4_c28,
+	arm_rs_r9_t4_c28,
+	arm_rs_r10_t4_c28,
+	arm_rs_r11_t4_c28,
+	arm_rs_r12_t4_c28,
+	arm_rs_r13_t4_c28,
+	arm_rs_r14_t4_c28,
+	arm_rs_r15_t4_c28,
+	arm_rs_r0_t5_c28,
+	arm_rs_r1_t5_c28,
+	arm_rs_r2_t5_c28,
+	arm_rs_r3_t5_c28,
+	arm_rs_r4_t5_c28,
+	arm_rs_r5_t5_c28,
+	arm_rs_r6_t5_c28,
+	arm_rs_r7_t5_c28,
+	arm_rs_r8_t5_c28,
+	arm_rs_r9_t5_c28,
+	arm_rs_r10_t5_c28,
+	arm_rs_r11_t5_c28,
+	arm_rs_r12_t5_c28,
+	arm_rs_r13_t5_c28,
+	arm_rs_r14_t5_c28,
+	arm_rs_r15_t5_c28,
+	arm_rs_r0_t6_c28,
+	arm_rs_r1_t6_c28,
+	arm_rs_r2_t6_c28,
+	arm_rs_r3_t6_c28,
+	arm_rs_r4_t6_c28,
+	arm_rs_r5_t6_c28,
+	arm_rs_r6_t6_c28,
+	arm_rs_r7_t6_c28,
+	arm_rs_r8_t6_c28,
+	arm_rs_r9_t6_c28,
+	arm_rs_r10_t6_c28,
+	arm_rs_r11_t6_c28,
+	arm_rs_r12_t6_c28,
+	arm_rs_r13_t6_c28,
+	arm_rs_r14_t6_c28,
+	arm_rs_r15_t6_c28,
+	arm_rs_r0_t7_c28,
+	arm_rs_r1_t7_c28,
+	arm_rs_r2_t7_c28,
+	arm_rs_r3_t7_c28,
+	arm_rs_r4_t7_c28,
+	arm_rs_r5_t7_c28,
+	arm_rs_r6_t7_c28,
+	arm_rs_r7_t7_c28,
+	arm_rs_r8_t7_c28,
+	arm_rs_r9_t7_c28,
+	arm_rs_r10_t7_c28,
+	arm_rs_r11_t7_c28,
+	arm_rs_r12_t7_c28,
+	arm_rs_r13_t7_c28,
+	arm_rs_r14_t7_c28,
+	arm_rs_r15_t7_c28,
+	arm_rs_r0_t0_c29,
+	arm_rs_r1_t0_c29,
+	arm_rs_r2_t0_c29,
+	arm_rs_r3_t0_c29,
+	arm_rs_r4_t0_c29,
+	arm_rs_r5_t0_c29,
+	arm_rs_r6_t0_c29,
+	arm_rs_r7_t0_c29,
+	arm_rs_r8_t0_c29,
+	arm_rs_r9_t0_c29,
+	arm_rs_r10_t0_c29,
+	arm_rs_r11_t0_c29,
+	arm_rs_r12_t0_c29,
+	arm_rs_r13_t0_c29,
+	arm_rs_r14_t0_c29,
+	arm_rs_r15_t0_c29,
+	arm_rs_r0_t1_c29,
+	arm_rs_r1_t1_c29,
+	arm_rs_r2_t1_c29,
+	arm_rs_r3_t1_c29,
+	arm_rs_r4_t1_c29,
+	arm_rs_r5_t1_c29,
+	arm_rs_r6_t1_c29,
+	arm_rs_r7_t1_c29,
+	arm_rs_r8_t1_c29,
+	arm_rs_r9_t1_c29,
+	arm_rs_r10_t1_c29,
+	arm_rs_r11_t1_c29,
+	arm_rs_r12_t1_c29,
+	arm_rs_r13_t1_c29,
+	arm_rs_r14_t1_c29,
+	arm_rs_r15_t1_c29,
+	arm_rs_r0_t2_c29,
+	arm_rs_r1_t2_c29,
+	arm_rs_r2_t2_c29,
+	arm_rs_r3_t2_c29,
+	arm_rs_r4_t2_c29,
+	arm_rs_r5_t2_c29,
+	arm_rs_r6_t2_c29,
+	arm_rs_r7_t2_c29,
+	arm_rs_r8_t2_c29,
+	arm_rs_r9_t2_c29,
+	arm_rs_r10_t2_c29,
+	arm_rs_r11_t2_c29,
+	arm_rs_r12_t2_c29,
+	arm_rs_r13_t2_c29,
+	arm_rs_r14_t2_c29,
+	arm_rs_r15_t2_c29,
+	arm_rs_r0_t3_c29,
+	arm_rs_r1_t3_c29,
+	arm_rs_r2_t3_c29,
+	arm_rs_r3_t3_c29,
+	arm_rs_r4_t3_c29,
+	arm_rs_r5_t3_c29,
+	arm_rs_r6_t3_c29,
+	arm_rs_r7_t3_c29,
+	arm_rs_r8_t3_c29,
+	arm_rs_r9_t3_c29,
+	arm_rs_r10_t3_c29,
+	arm_rs_r11_t3_c29,
+	arm_rs_r12_t3_c29,
+	arm_rs_r13_t3_c29,
+	arm_rs_r14_t3_c29,
+	arm_rs_r15_t3_c29,
+	arm_rs_r0_t4_c29,
+	arm_rs_r1_t4_c29,
+	arm_rs_r2_t4_c29,
+	arm_rs_r3_t4_c29,
+	arm_rs_r4_t4_c29,
+	arm_rs_r5_t4_c29,
+	arm_rs_r6_t4_c29,
+	arm_rs_r7_t4_c29,
+	arm_rs_r8_t4_c29,
+	arm_rs_r9_t4_c29,
+	arm_rs_r10_t4_c29,
+	arm_rs_r11_t4_c29,
+	arm_rs_r12_t4_c29,
+	arm_rs_r13_t4_c29,
+	arm_rs_r14_t4_c29,
+	arm_rs_r15_t4_c29,
+	arm_rs_r0_t5_c29,
+	arm_rs_r1_t5_c29,
+	arm_rs_r2_t5_c29,
+	arm_rs_r3_t5_c29,
+	arm_rs_r4_t5_c29,
+	arm_rs_r5_t5_c29,
+	arm_rs_r6_t5_c29,
+	arm_rs_r7_t5_c29,
+	arm_rs_r8_t5_c29,
+	arm_rs_r9_t5_c29,
+	arm_rs_r10_t5_c29,
+	arm_rs_r11_t5_c29,
+	arm_rs_r12_t5_c29,
+	arm_rs_r13_t5_c29,
+	arm_rs_r14_t5_c29,
+	arm_rs_r15_t5_c29,
+	arm_rs_r0_t6_c29,
+	arm_rs_r1_t6_c29,
+	arm_rs_r2_t6_c29,
+	arm_rs_r3_t6_c29,
+	arm_rs_r4_t6_c29,
+	arm_rs_r5_t6_c29,
+	arm_rs_r6_t6_c29,
+	arm_rs_r7_t6_c29,
+	arm_rs_r8_t6_c29,
+	arm_rs_r9_t6_c29,
+	arm_rs_r10_t6_c29,
+	arm_rs_r11_t6_c29,
+	arm_rs_r12_t6_c29,
+	arm_rs_r13_t6_c29,
+	arm_rs_r14_t6_c29,
+	arm_rs_r15_t6_c29,
+	arm_rs_r0_t7_c29,
+	arm_rs_r1_t7_c29,
+	arm_rs_r2_t7_c29,
+	arm_rs_r3_t7_c29,
+	arm_rs_r4_t7_c29,
+	arm_rs_r5_t7_c29,
+	arm_rs_r6_t7_c29,
+	arm_rs_r7_t7_c29,
+	arm_rs_r8_t7_c29,
+	arm_rs_r9_t7_c29,
+	arm_rs_r10_t7_c29,
+	arm_rs_r11_t7_c29,
+	arm_rs_r12_t7_c29,
+	arm_rs_r13_t7_c29,
+	arm_rs_r14_t7_c29,
+	arm_rs_r15_t7_c29,
+	arm_rs_r0_t0_c30,
+	arm_rs_r1_t0_c30,
+	arm_rs_r2_t0_c30,
+	arm_rs_r3_t0_c30,
+	arm_rs_r4_t0_c30,
+	arm_rs_r5_t0_c30,
+	arm_rs_r6_t0_c30,
+	arm_rs_r7_t0_c30,
+	arm_rs_r8_t0_c30,
+	arm_rs_r9_t0_c30,
+	arm_rs_r10_t0_c30,
+	arm_rs_r11_t0_c30,
+	arm_rs_r12_t0_c30,
+	arm_rs_r13_t0_c30,
+	arm_rs_r14_t0_c30,
+	arm_rs_r15_t0_c30,
+	arm_rs_r0_t1_c30,
+	arm_rs_r1_t1_c30,
+	arm_rs_r2_t1_c30,
+	arm_rs_r3_t1_c30,
+	arm_rs_r4_t1_c30,
+	arm_rs_r5_t1_c30,
+	arm_rs_r6_t1_c30,
+	arm_rs_r7_t1_c30,
+	arm_rs_r8_t1_c30,
+	arm_rs_r9_t1_c30,
+	arm_rs_r10_t1_c30,
+	arm_rs_r11_t1_c30,
+	arm_rs_r12_t1_c30,
+	arm_rs_r13_t1_c30,
+	arm_rs_r14_t1_c30,
+	arm_rs_r15_t1_c30,
+	arm_rs_r0_t2_c30,
+	arm_rs_r1_t2_c30,
+	arm_rs_r2_t2_c30,
+	arm_rs_r3_t2_c30,
+	arm_rs_r4_t2_c30,
+	arm_rs_r5_t2_c30,
+	arm_rs_r6_t2_c30,
+	arm_rs_r7_t2_c30,
+	arm_rs_r8_t2_c30,
+	arm_rs_r9_t2_c30,
+	arm_rs_r10_t2_c30,
+	arm_rs_r11_t2_c30,
+	arm_rs_r12_t2_c30,
+	arm_rs_r13_t2_c30,
+	arm_rs_r14_t2_c30,
+	arm_rs_r15_t2_c30,
+	arm_rs_r0_t3_c30,
+	arm_rs_r1_t3_c30,
+	arm_rs_r2_t3_c30,
+	arm_rs_r3_t3_c30,
+	arm_rs_r4_t3_c30,
+	arm_rs_r5_t3_c30,
+	arm_rs_r6_t3_c30,
+	arm_rs_r7_t3_c30,
+	arm_rs_r8_t3_c30,
+	arm_rs_r9_t3_c30,
+	arm_rs_r10_t3_c30,
+	arm_rs_r11_t3_c30,
+	arm_rs_r12_t3_c30,
+	arm_rs_r13_t3_c30,
+	arm_rs_r14_t3_c30,
+	arm_rs_r15_t3_c30,
+	arm_rs_r0_t4_c30,
+	arm_rs_r1_t4_c30,
+	arm_rs_r2_t4_c30,
+	arm_rs_r3_t4_c30,
+	arm_rs_r4_t4_c30,
+	arm_rs_r5_t4_c30,
+	arm_rs_r6_t4_c30,
+	arm_rs_r7_t4_c30,
+	arm_rs_r8_t4_c30,
+	arm_rs_r9_t4_c30,
+	arm_rs_r10_t4_c30,
+	arm_rs_r11_t4_c30,
+	arm_rs_r12_t4_c30,
+	arm_rs_r13_t4_c30,
+	arm_rs_r14_t4_c30,
+	arm_rs_r15_t4_c30,
+	arm_rs_r0_t5_c30,
+	arm_rs_r1_t5_c30,
+	arm_rs_r2_t5_c30,
+	arm_rs_r3_t5_c30,
+	arm_rs_r4_t5_c30,
+	arm_rs_r5_t5_c30,
+	arm_rs_r6_t5_c30,
+	arm_rs_r7_t5_c30,
+	arm_rs_r8_t5_c30,
+	arm_rs_r9_t5_c30,
+	arm_rs_r10_t5_c30,
+	arm_rs_r11_t5_c30,
+	arm_rs_r12_t5_c30,
+	arm_rs_r13_t5_c30,
+	arm_rs_r14_t5_c30,
+	arm_rs_r15_t5_c30,
+	arm_rs_r0_t6_c30,
+	arm_rs_r1_t6_c30,
+	arm_rs_r2_t6_c30,
+	arm_rs_r3_t6_c30,
+	arm_rs_r4_t6_c30,
+	arm_rs_r5_t6_c30,
+	arm_rs_r6_t6_c30,
+	arm_rs_r7_t6_c30,
+	arm_rs_r8_t6_c30,
+	arm_rs_r9_t6_c30,
+	arm_rs_r10_t6_c30,
+	arm_rs_r11_t6_c30,
+	arm_rs_r12_t6_c30,
+	arm_rs_r13_t6_c30,
+	arm_rs_r14_t6_c30,
+	arm_rs_r15_t6_c30,
+	arm_rs_r0_t7_c30,
+	arm_rs_r1_t7_c30,
+	arm_rs_r2_t7_c30,
+	arm_rs_r3_t7_c30,
+	arm_rs_r4_t7_c30,
+	arm_rs_r5_t7_c30,
+	arm_rs_r6_t7_c30,
+	arm_rs_r7_t7_c30,
+	arm_rs_r8_t7_c30,
+	arm_rs_r9_t7_c30,
+	arm_rs_r10_t7_c30,
+	arm_rs_r11_t7_c30,
+	arm_rs_r12_t7_c30,
+	arm_rs_r13_t7_c30,
+	arm_rs_r14_t7_c30,
+	arm_rs_r15_t7_c30,
+	arm_rs_r0_t0_c31,
+	arm_rs_r1_t0_c31,
+	arm_rs_r2_t0_c31,
+	arm_rs_r3_t0_c31,
+	arm_rs_r4_t0_c31,
+	arm_rs_r5_t0_c31,
+	arm_rs_r6_t0_c31,
+	arm_rs_r7_t0_c31,
+	arm_rs_r8_t0_c31,
+	arm_rs_r9_t0_c31,
+	arm_rs_r10_t0_c31,
+	arm_rs_r11_t0_c31,
+	arm_rs_r12_t0_c31,
+	arm_rs_r13_t0_c31,
+	arm_rs_r14_t0_c31,
+	arm_rs_r15_t0_c31,
+	arm_rs_r0_t1_c31,
+	arm_rs_r1_t1_c31,
+	arm_rs_r2_t1_c31,
+	arm_rs_r3_t1_c31,
+	arm_rs_r4_t1_c31,
+	arm_rs_r5_t1_c31,
+	arm_rs_r6_t1_c31,
+	arm_rs_r7_t1_c31,
+	arm_rs_r8_t1_c31,
+	arm_rs_r9_t1_c31,
+	arm_rs_r10_t1_c31,
+	arm_rs_r11_t1_c31,
+	arm_rs_r12_t1_c31,
+	arm_rs_r13_t1_c31,
+	arm_rs_r14_t1_c31,
+	arm_rs_r15_t1_c31,
+	arm_rs_r0_t2_c31,
+	arm_rs_r1_t2_c31,
+	arm_rs_r2_t2_c31,
+	arm_rs_r3_t2_c31,
+	arm_rs_r4_t2_c31,
+	arm_rs_r5_t2_c31,
+	arm_rs_r6_t2_c31,
+	arm_rs_r7_t2_c31,
+	arm_rs_r8_t2_c31,
+	arm_rs_r9_t2_c31,
+	arm_rs_r10_t2_c31,
+	arm_rs_r11_t2_c31,
+	arm_rs_r12_t2_c31,
+	arm_rs_r13_t2_c31,
+	arm_rs_r14_t2_c31,
+	arm_rs_r15_t2_c31,
+	arm_rs_r0_t3_c31,
+	arm_rs_r1_t3_c31,
+	arm_rs_r2_t3_c31,
+	arm_rs_r3_t3_c31,
+	arm_rs_r4_t3_c31,
+	arm_rs_r5_t3_c31,
+	arm_rs_r6_t3_c31,
+	arm_rs_r7_t3_c31,
+	arm_rs_r8_t3_c31,
+	arm_rs_r9_t3_c31,
+	arm_rs_r10_t3_c31,
+	arm_rs_r11_t3_c31,
+	arm_rs_r12_t3_c31,
+	arm_rs_r13_t3_c31,
+	arm_rs_r14_t3_c31,
+	arm_rs_r15_t3_c31,
+	arm_rs_r0_t4_c31,
+	arm_rs_r1_t4_c31,
+	arm_rs_r2_t4_c31,
+	arm_rs_r3_t4_c31,
+	arm_rs_r4_t4_c31,
+	arm_rs_r5_t4_c31,
+	arm_rs_r6_t4_c31,
+	arm_rs_r7_t4_c31,
+	arm_rs_r8_t4_c31,
+	arm_rs_r9_t4_c31,
+	arm_rs_r10_t4_c31,
+	arm_rs_r11_t4_c31,
+	arm_rs_r12_t4_c31,
+	arm_rs_r13_t4_c31,
+	arm_rs_r14_t4_c31,
+	arm_rs_r15_t4_c31,
+	arm_rs_r0_t5_c31,
+	arm_rs_r1_t5_c31,
+	arm_rs_r2_t5_c31,
+	arm_rs_r3_t5_c31,
+	arm_rs_r4_t5_c31,
+	arm_rs_r5_t5_c31,
+	arm_rs_r6_t5_c31,
+	arm_rs_r7_t5_c31,
+	arm_rs_r8_t5_c31,
+	arm_rs_r9_t5_c31,
+	arm_rs_r10_t5_c31,
+	arm_rs_r11_t5_c31,
+	arm_rs_r12_t5_c31,
+	arm_rs_r13_t5_c31,
+	arm_rs_r14_t5_c31,
+	arm_rs_r15_t5_c31,
+	arm_rs_r0_t6_c31,
+	arm_rs_r1_t6_c31,
+	arm_rs_r2_t6_c31,
+	arm_rs_r3_t6_c31,
+	arm_rs_r4_t6_c31,
+	arm_rs_r5_t6_c31,
+	arm_rs_r6_t6_c31,
+	arm_rs_r7_t6_c31,
+	arm_rs_r8_t6_c31,
+	arm_rs_r9_t6_c31,
+	arm_rs_r10_t6_c31,
+	arm_rs_r11_t6_c31,
+	arm_rs_r12_t6_c31,
+	arm_rs_r13_t6_c31,
+	arm_rs_r14_t6_c31,
+	arm_rs_r15_t6_c31,
+	arm_rs_r0_t7_c31,
+	arm_rs_r1_t7_c31,
+	arm_rs_r2_t7_c31,
+	arm_rs_r3_t7_c31,
+	arm_rs_r4_t7_c31,
+	arm_rs_r5_t7_c31,
+	arm_rs_r6_t7_c31,
+	arm_rs_r7_t7_c31,
+	arm_rs_r8_t7_c31,
+	arm_rs_r9_t7_c31,
+	arm_rs_r10_t7_c31,
+	arm_rs_r11_t7_c31,
+	arm_rs_r12_t7_c31,
+	arm_rs_r13_t7_c31,
+	arm_rs_r14_t7_c31,
+	arm_rs_r15_t7_c31
+};
+
@@ -0,0 +1,147 @@
+
+/*
+ *  AUTOMATICALLY GENERATED! Do not edit.
+ */
+
+extern size_t dyntrans_cache_size;
+#ifdef DYNTRANS_32
+#define MODE32
+#endif
+#define DYNTRANS_FUNCTION_TRACE_DEF m88k_cpu_functioncall_trace
+#include "cpu_dyntrans.c"
+#undef DYNTRANS_FUNCTION_TRACE_DEF
+
+#define DYNTRANS_INIT_TABLES m88k_cpu_init_tables
+#include "cpu_dyntrans.c"
+#undef DYNTRANS_INIT_TABLES
+
+#define DYNTRANS_TC_ALLOCATE_DEFAULT_PAGE_DEF m88k_tc_allocate_default_page
+#include "cpu_dyntrans.c"
+#undef DYNTRANS_TC_ALLOCATE_DEFAULT_PAGE_DEF
+
+#define DYNTRANS_INVAL_ENTRY
+#include "cpu_dyntrans.c"
+#undef DYNTRANS_INVAL_ENTRY
+
+#define DYNTRANS_INVALIDATE_TC m88k_invalidate_translation_caches
+#include "cpu_dyntrans.c"
+#undef DYNTRANS_INVALIDATE_TC
+
+#define DYNTRANS_INVALIDATE_TC_CODE m88k_invalidate_code_translation
+#include "cpu_dyntrans.c"
+#undef DYNTRANS_INVALIDATE_TC_CODE
+
+#define DYNTRANS_UPDATE_TRANSLATION_TABLE m88k_update_translation_table
+#include "cpu_dyntrans.c"
+#undef DYNTRANS_UPDATE_TRANSLATION_TABLE
+
+#define MEMORY_RW m88k_memory_rw
+#define MEM_M88K
+#include "memory_rw.c"
+#undef MEM_M88K
+#undef MEMORY_RW
+
+#define DYNTRANS_PC_TO_POINTERS_FUNC m88k_pc_to_pointers
+#define DYNTRANS_PC_TO_POINTERS_GENERIC m88k_pc_to_pointers_generic
+#include "cpu_dyntrans.c"
+#undef DYNTRANS_PC_TO_POINTERS_FUNC
+
+#undef DYNTRANS_PC_TO_POINTERS_GENERIC
+
+#define COMBINE_INSTRUCTIONS m88k_combine_instructions
+#ifndef DYNTRANS_32
+#define reg(x) (*((uint64_t *)(x)))
+#define MODE_uint_t uint64_t
+#define MODE_int_t int64_t
+#else
+#define reg(x) (*((uint32_t *)(x)))
+#define MODE_uint_t uint32_t
+#define MODE_int_t int32_t
+#endif
+#define COMBINE(n) m88k_combine_ ## n
+#define DYNTRANS_HOST_PAGE m88k_host_page
+#define DYNTRANS_BULK_MEMSET m88k_bulk_memset
+#define DYNTRANS_BULK_MEMCPY m88k_bulk_memcpy
+#define DYNTRANS_BULK_MEMORY
+#include "cpu_dyntrans.c"
+#undef DYNTRANS_BULK_MEMORY
+#include "quick_pc_to_pointers.h"
+#include "cpu_m88k_instr.c"
+
+#define DYNTRANS_RUN_INSTR_DEF m88k_run_instr
+#include "cpu_dyntrans.c"
+#undef DYNTRANS_RUN_INSTR_DEF
+
+#ifdef DYNTRANS_DUALMODE_32
+#undef COMBINE_INSTRUCTIONS
+#define COMBINE_INSTRUCTIONS m88k32_combine_instructions
+#undef X
+#undef instr
+#undef reg
+#define X(n) void m88k32_instr_ ## n(struct cpu *cpu, \
+	struct m88k_instr_call *ic)
+#define instr(n) m88k32_instr_ ## n
+#ifdef HOST_LITTLE_ENDIAN
+#define reg(x) ( *((uint32_t *)(x)) )
+#else
+#define reg(x) ( *((uint32_t *)(x)+1) )
+#endif
+#define MODE32
+#undef MODE_uint_t
+#undef MODE_int_t
+#define MODE_uint_t uint32_t
+#define MODE_int_t int32_t
+#define DYNTRANS_INVAL_ENTRY
+#undef DYNTRANS_INVALIDATE_TLB_ENTRY
+#define DYNTRANS_INVALIDATE_TLB_ENTRY m88k32_invalidate_tlb_entry
+#include "cpu_dyntrans.c"
+#undef DYNTRANS_INVAL_ENTRY
+
+#define DYNTRANS_INVALIDATE_TC m88k32_invalidate_translation_caches
+#include "cpu_dyntrans.c"
+#undef DYNTRANS_INVALIDATE_TC
+
+#define DYNTRANS_INVALIDATE_TC_CODE m88k32_invalidate_code_translation
+#include "cpu_dyntrans.c"
+#undef DYNTRANS_INVALIDATE_TC_CODE
+
+#define DYNTRANS_UPDATE_TRANSLATION_TABLE m88k32_update_translation_table
+#include "cpu_dyntrans.c"
+#undef DYNTRANS_UPDATE_TRANSLATION_TABLE
+
+#define DYNTRANS_PC_TO_POINTERS_FUNC m88k32_pc_to_pointers
+#define DYNTRANS_PC_TO_POINTERS_GENERIC m88k32_pc_to_pointers_generic
+#undef DYNTRANS_PC_TO_POINTERS
+#define DYNTRANS_PC_TO_POINTERS m88k32_pc_to_pointers
+#include "cpu_dyntrans.c"
+#undef DYNTRANS_PC_TO_POINTERS_FUNC
+
+#undef DYNTRANS_PC_TO_POINTERS_GENERIC
+
+#undef COMBINE
+#define COMBINE(n) m88k32_combine_ ## n
+#undef DYNTRANS_HOST_PAGE
+#define DYNTRANS_HOST_PAGE m88k32_host_page
+#undef DYNTRANS_BULK_MEMSET
+#define DYNTRANS_BULK_MEMSET m88k32_bulk_memset
+#undef DYNTRANS_BULK_MEMCPY
+#define DYNTRANS_BULK_MEMCPY m88k32_bulk_memcpy
+#define DYNTRANS_BULK_MEMORY
+#include "cpu_dyntrans.c"
+#undef DYNTRANS_BULK_MEMORY
+#include "quick_pc_to_pointers.h"
+#include "cpu_m88k_instr.c"
+
+#undef DYNTRANS_PC_TO_POINTERS
+#define DYNTRANS_PC_TO_POINTERS m88k_pc_to_pointers
+#define DYNTRANS_PC_TO_POINTERS32 m88k32_pc_to_pointers
+
+#define DYNTRANS_RUN_INSTR_DEF m88k32_run_instr
+#include "cpu_dyntrans.c"
+#undef DYNTRANS_RUN_INSTR_DEF
+
+#endif /*  DYNTRANS_DUALMODE_32  */
+
+
+CPU_FAMILY_INIT(m88k,"M88K")
+
@@ -0,0 +1,14415 @@
+
+/*  AUTOMATICALLY GENERATED! Do not edit.  */
+
+X(addi_r0_r0)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r1)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r2)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r3)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r4)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r5)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r6)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r7)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r8)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r9)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r10)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r11)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r12)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r13)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r14)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r15)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r16)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r17)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r18)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r19)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r20)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r21)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r22)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r23)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r24)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r25)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r26)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r27)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r28)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r29)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r30)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r0_r31)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r0)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r1)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r2)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r3)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r4)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r5)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r6)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r7)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r8)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r9)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r10)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r11)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r12)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r13)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r14)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r15)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r16)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r17)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r18)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r19)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r20)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r21)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r22)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r23)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r24)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r25)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r26)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r27)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r28)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r29)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r30)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r1_r31)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r0)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r1)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r2)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r3)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r4)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r5)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r6)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r7)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r8)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r9)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r10)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r11)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r12)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r13)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r14)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r15)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r16)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r17)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r18)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r19)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r20)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r21)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r22)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r23)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r24)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r25)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r26)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r27)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r28)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r29)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r30)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r2_r31)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r0)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r1)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r2)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r3)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r4)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r5)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r6)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r7)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r8)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r9)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r10)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r11)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r12)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r13)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r14)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r15)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r16)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r17)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r18)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r19)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r20)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r21)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r22)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r23)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r24)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r25)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r26)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r27)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r28)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r29)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r30)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r3_r31)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r0)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r1)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r2)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r3)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r4)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r5)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r6)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r7)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r8)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r9)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r10)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r11)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r12)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r13)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r14)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r15)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r16)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r17)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r18)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r19)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r20)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r21)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r22)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r23)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r24)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r25)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r26)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r27)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r28)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r29)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r30)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r4_r31)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r0)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r1)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r2)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r3)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r4)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r5)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r6)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r7)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r8)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r9)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r10)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r11)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r12)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r13)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r14)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r15)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r16)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r17)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r18)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r19)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r20)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r21)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r22)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r23)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r24)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r25)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r26)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r27)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r28)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r29)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r30)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r5_r31)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r0)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r1)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r2)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r3)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r4)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r5)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r6)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r7)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r8)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r9)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r10)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r11)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r12)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r13)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r14)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r15)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r16)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r17)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r18)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r19)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r20)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r21)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r22)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r23)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r24)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r25)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r26)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r27)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r28)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r29)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r30)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r6_r31)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r0)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r1)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r2)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r3)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r4)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r5)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r6)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r7)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r8)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r9)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r10)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r11)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r12)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r13)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r14)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r15)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r16)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r17)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r18)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r19)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r20)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r21)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r22)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r23)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r24)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r25)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r26)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r27)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r28)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r29)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r30)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r7_r31)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r0)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r1)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r2)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r3)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r4)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r5)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r6)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r7)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r8)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r9)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r10)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r11)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r12)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r13)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r14)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r15)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r16)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r17)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r18)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r19)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r20)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r21)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r22)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r23)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r24)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r25)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r26)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r27)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r28)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r29)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r30)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r8_r31)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r0)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r1)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r2)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r3)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r4)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r5)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r6)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r7)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r8)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r9)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r10)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r11)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r12)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r13)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r14)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r15)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r16)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r17)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r18)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r19)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r20)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r21)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r22)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r23)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r24)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r25)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r26)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r27)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r28)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r29)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r30)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r9_r31)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r0)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r1)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r2)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r3)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r4)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r5)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r6)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r7)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r8)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r9)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r10)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r11)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r12)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r13)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r14)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r15)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r16)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r17)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r18)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r19)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r20)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r21)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r22)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r23)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r24)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r25)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r26)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r27)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r28)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r29)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r30)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r10_r31)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r0)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r1)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r2)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r3)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r4)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r5)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r6)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r7)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r8)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r9)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r10)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r11)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r12)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r13)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r14)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r15)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r16)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r17)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r18)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r19)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r20)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r21)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r22)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r23)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r24)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r25)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r26)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r27)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r28)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r29)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r30)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r11_r31)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r0)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r1)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r2)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r3)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r4)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r5)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r6)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r7)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r8)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r9)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r10)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r11)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r12)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r13)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r14)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r15)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r16)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r17)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r18)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r19)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r20)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r21)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r22)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r23)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r24)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r25)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r26)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r27)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r28)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r29)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r30)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r12_r31)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r0)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r1)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r2)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r3)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r4)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r5)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r6)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r7)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r8)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r9)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r10)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r11)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r12)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r13)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r14)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r15)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r16)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r17)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r18)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r19)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r20)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r21)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r22)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r23)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r24)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r25)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r26)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r27)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r28)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r29)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r30)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r13_r31)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r0)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r1)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r2)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r3)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r4)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r5)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r6)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r7)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r8)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r9)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r10)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r11)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r12)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r13)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r14)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r15)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r16)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r17)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r18)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r19)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r20)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r21)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r22)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r23)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r24)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r25)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r26)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r27)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r28)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r29)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r30)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r14_r31)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r0)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r1)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r2)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r3)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r4)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r5)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r6)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r7)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r8)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r9)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r10)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r11)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r12)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r13)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r14)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r15)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r16)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r17)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r18)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r19)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r20)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r21)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r22)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r23)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r24)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r25)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r26)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r27)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r28)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r29)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r30)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r15_r31)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r0)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r1)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r2)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r3)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r4)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r5)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r6)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r7)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r8)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r9)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r10)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r11)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r12)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r13)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r14)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r15)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r16)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r17)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r18)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r19)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r20)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r21)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r22)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r23)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r24)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r25)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r26)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r27)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r28)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r29)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r30)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r16_r31)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r0)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r1)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r2)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r3)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r4)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r5)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r6)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r7)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r8)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r9)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r10)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r11)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r12)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r13)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r14)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r15)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r16)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r17)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r18)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r19)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r20)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r21)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r22)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r23)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r24)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r25)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r26)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r27)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r28)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r29)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r30)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r17_r31)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r0)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r1)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r2)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r3)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r4)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r5)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r6)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r7)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r8)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r9)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r10)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r11)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r12)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r13)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r14)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r15)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r16)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r17)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r18)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r19)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r20)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r21)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r22)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r23)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r24)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r25)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r26)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r27)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r28)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r29)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r30)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r18_r31)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r0)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r1)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r2)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r3)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r4)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r5)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r6)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r7)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r8)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r9)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r10)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r11)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r12)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r13)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r14)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r15)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r16)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r17)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r18)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r19)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r20)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r21)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r22)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r23)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r24)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r25)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r26)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r27)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r28)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r29)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r30)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r19_r31)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r0)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r1)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r2)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r3)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r4)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r5)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r6)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r7)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r8)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r9)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r10)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r11)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r12)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r13)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r14)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r15)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r16)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r17)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r18)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r19)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r20)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r21)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r22)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r23)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r24)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r25)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r26)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r27)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r28)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r29)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r30)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r20_r31)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r0)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r1)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r2)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r3)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r4)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r5)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r6)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r7)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r8)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r9)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r10)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r11)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r12)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r13)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r14)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r15)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r16)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r17)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r18)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r19)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r20)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r21)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r22)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r23)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r24)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r25)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r26)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r27)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r28)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r29)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r30)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r21_r31)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r0)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r1)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r2)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r3)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r4)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r5)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r6)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r7)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r8)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r9)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r10)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r11)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r12)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r13)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r14)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r15)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r16)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r17)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r18)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r19)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r20)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r21)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r22)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r23)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r24)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r25)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r26)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r27)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r28)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r29)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r30)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r22_r31)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r0)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r1)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r2)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r3)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r4)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r5)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r6)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r7)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r8)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r9)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r10)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r11)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r12)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r13)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r14)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r15)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r16)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r17)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r18)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r19)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r20)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r21)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r22)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r23)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r24)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r25)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r26)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r27)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r28)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r29)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r30)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r23_r31)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r0)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r1)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r2)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r3)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r4)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r5)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r6)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r7)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r8)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r9)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r10)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r11)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r12)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r13)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r14)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r15)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r16)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r17)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r18)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r19)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r20)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r21)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r22)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r23)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r24)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r25)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r26)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r27)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r28)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r29)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r30)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r24_r31)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r0)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r1)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r2)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r3)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r4)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r5)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r6)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r7)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r8)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r9)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r10)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r11)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r12)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r13)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r14)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r15)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r16)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r17)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r18)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r19)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r20)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r21)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r22)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r23)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r24)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r25)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r26)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r27)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r28)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r29)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r30)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r25_r31)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r0)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r1)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r2)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r3)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r4)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r5)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r6)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r7)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r8)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r9)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r10)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r11)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r12)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r13)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r14)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r15)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r16)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r17)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r18)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r19)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r20)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r21)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r22)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r23)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r24)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r25)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r26)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r27)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r28)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r29)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r30)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r26_r31)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r0)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r1)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r2)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r3)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r4)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r5)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r6)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r7)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r8)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r9)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r10)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r11)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r12)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r13)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r14)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r15)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r16)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r17)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r18)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r19)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r20)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r21)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r22)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r23)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r24)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r25)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r26)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r27)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r28)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r29)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r30)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r27_r31)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r0)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r1)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r2)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r3)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r4)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r5)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r6)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r7)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r8)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r9)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r10)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r11)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r12)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r13)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r14)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r15)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r16)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r17)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r18)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r19)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r20)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r21)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r22)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r23)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r24)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r25)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r26)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r27)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r28)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r29)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r30)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r28_r31)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r0)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r1)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r2)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r3)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r4)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r5)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r6)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r7)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r8)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r9)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r10)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r11)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r12)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r13)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r14)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r15)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r16)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r17)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r18)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r19)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r20)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r21)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r22)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r23)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r24)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r25)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r26)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r27)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r28)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r29)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r30)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r29_r31)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r0)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r1)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r2)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r3)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r4)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r5)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r6)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r7)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r8)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r9)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r10)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r11)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r12)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r13)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r14)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r15)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r16)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r17)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r18)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r19)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r20)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r21)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r22)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r23)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r24)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r25)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r26)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r27)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r28)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r29)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r30)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r30_r31)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r0)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[0] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r1)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[1] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r2)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[2] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r3)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[3] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r4)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[4] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r5)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[5] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r6)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[6] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r7)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[7] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r8)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[8] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r9)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[9] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r10)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[10] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r11)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[11] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r12)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[12] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r13)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[13] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r14)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[14] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r15)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[15] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r16)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[16] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r17)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[17] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r18)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[18] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r19)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[19] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r20)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[20] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r21)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[21] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r22)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[22] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r23)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[23] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r24)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[24] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r25)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[25] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r26)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[26] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r27)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[27] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r28)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[28] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r29)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[29] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r30)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[30] + (int32_t)ic->arg[1]);
+}
+
+X(addi_r31_r31)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)
+	    (cpu->cd.ppc.gpr[31] + (int32_t)ic->arg[1]);
+}
+
+X(mr_r0_r0)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r0_r1)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r0_r2)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r0_r3)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r0_r4)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r0_r5)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r0_r6)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r0_r7)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r0_r8)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r0_r9)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r0_r10)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r0_r11)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r0_r12)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r0_r13)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r0_r14)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r0_r15)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r0_r16)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r0_r17)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r0_r18)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r0_r19)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r0_r20)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r0_r21)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r0_r22)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r0_r23)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r0_r24)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r0_r25)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r0_r26)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r0_r27)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r0_r28)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r0_r29)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r0_r30)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r0_r31)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r1_r0)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r1_r1)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r1_r2)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r1_r3)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r1_r4)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r1_r5)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r1_r6)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r1_r7)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r1_r8)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r1_r9)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r1_r10)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r1_r11)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r1_r12)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r1_r13)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r1_r14)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r1_r15)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r1_r16)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r1_r17)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r1_r18)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r1_r19)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r1_r20)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r1_r21)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r1_r22)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r1_r23)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r1_r24)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r1_r25)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r1_r26)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r1_r27)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r1_r28)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r1_r29)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r1_r30)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r1_r31)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r2_r0)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r2_r1)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r2_r2)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r2_r3)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r2_r4)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r2_r5)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r2_r6)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r2_r7)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r2_r8)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r2_r9)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r2_r10)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r2_r11)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r2_r12)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r2_r13)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r2_r14)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r2_r15)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r2_r16)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r2_r17)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r2_r18)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r2_r19)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r2_r20)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r2_r21)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r2_r22)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r2_r23)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r2_r24)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r2_r25)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r2_r26)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r2_r27)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r2_r28)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r2_r29)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r2_r30)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r2_r31)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r3_r0)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r3_r1)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r3_r2)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r3_r3)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r3_r4)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r3_r5)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r3_r6)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r3_r7)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r3_r8)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r3_r9)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r3_r10)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r3_r11)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r3_r12)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r3_r13)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r3_r14)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r3_r15)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r3_r16)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r3_r17)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r3_r18)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r3_r19)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r3_r20)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r3_r21)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r3_r22)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r3_r23)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r3_r24)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r3_r25)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r3_r26)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r3_r27)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r3_r28)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r3_r29)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r3_r30)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r3_r31)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r4_r0)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r4_r1)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r4_r2)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r4_r3)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r4_r4)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r4_r5)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r4_r6)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r4_r7)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r4_r8)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r4_r9)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r4_r10)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r4_r11)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r4_r12)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r4_r13)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r4_r14)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r4_r15)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r4_r16)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r4_r17)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r4_r18)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r4_r19)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r4_r20)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r4_r21)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r4_r22)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r4_r23)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r4_r24)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r4_r25)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r4_r26)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r4_r27)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r4_r28)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r4_r29)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r4_r30)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r4_r31)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r5_r0)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r5_r1)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r5_r2)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r5_r3)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r5_r4)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r5_r5)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r5_r6)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r5_r7)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r5_r8)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r5_r9)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r5_r10)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r5_r11)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r5_r12)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r5_r13)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r5_r14)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r5_r15)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r5_r16)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r5_r17)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r5_r18)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r5_r19)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r5_r20)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r5_r21)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r5_r22)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r5_r23)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r5_r24)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r5_r25)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r5_r26)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r5_r27)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r5_r28)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r5_r29)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r5_r30)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r5_r31)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r6_r0)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r6_r1)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r6_r2)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r6_r3)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r6_r4)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r6_r5)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r6_r6)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r6_r7)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r6_r8)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r6_r9)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r6_r10)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r6_r11)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r6_r12)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r6_r13)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r6_r14)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r6_r15)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r6_r16)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r6_r17)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r6_r18)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r6_r19)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r6_r20)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r6_r21)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r6_r22)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r6_r23)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r6_r24)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r6_r25)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r6_r26)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r6_r27)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r6_r28)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r6_r29)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r6_r30)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r6_r31)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r7_r0)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r7_r1)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r7_r2)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r7_r3)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r7_r4)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r7_r5)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r7_r6)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r7_r7)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r7_r8)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r7_r9)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r7_r10)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r7_r11)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r7_r12)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r7_r13)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r7_r14)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r7_r15)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r7_r16)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r7_r17)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r7_r18)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r7_r19)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r7_r20)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r7_r21)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r7_r22)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r7_r23)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r7_r24)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r7_r25)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r7_r26)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r7_r27)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r7_r28)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r7_r29)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r7_r30)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r7_r31)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r8_r0)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r8_r1)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r8_r2)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r8_r3)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r8_r4)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r8_r5)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r8_r6)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r8_r7)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r8_r8)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r8_r9)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r8_r10)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r8_r11)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r8_r12)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r8_r13)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r8_r14)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r8_r15)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r8_r16)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r8_r17)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r8_r18)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r8_r19)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r8_r20)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r8_r21)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r8_r22)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r8_r23)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r8_r24)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r8_r25)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r8_r26)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r8_r27)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r8_r28)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r8_r29)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r8_r30)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r8_r31)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r9_r0)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r9_r1)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r9_r2)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r9_r3)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r9_r4)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r9_r5)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r9_r6)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r9_r7)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r9_r8)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r9_r9)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r9_r10)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r9_r11)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r9_r12)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r9_r13)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r9_r14)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r9_r15)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r9_r16)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r9_r17)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r9_r18)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r9_r19)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r9_r20)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r9_r21)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r9_r22)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r9_r23)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r9_r24)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r9_r25)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r9_r26)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r9_r27)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r9_r28)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r9_r29)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r9_r30)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r9_r31)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r10_r0)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r10_r1)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r10_r2)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r10_r3)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r10_r4)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r10_r5)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r10_r6)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r10_r7)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r10_r8)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r10_r9)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r10_r10)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r10_r11)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r10_r12)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r10_r13)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r10_r14)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r10_r15)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r10_r16)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r10_r17)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r10_r18)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r10_r19)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r10_r20)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r10_r21)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r10_r22)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r10_r23)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r10_r24)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r10_r25)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r10_r26)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r10_r27)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r10_r28)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r10_r29)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r10_r30)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r10_r31)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r11_r0)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r11_r1)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r11_r2)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r11_r3)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r11_r4)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r11_r5)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r11_r6)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r11_r7)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r11_r8)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r11_r9)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r11_r10)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r11_r11)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r11_r12)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r11_r13)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r11_r14)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r11_r15)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r11_r16)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r11_r17)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r11_r18)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r11_r19)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r11_r20)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r11_r21)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r11_r22)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r11_r23)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r11_r24)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r11_r25)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r11_r26)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r11_r27)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r11_r28)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r11_r29)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r11_r30)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r11_r31)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r12_r0)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r12_r1)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r12_r2)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r12_r3)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r12_r4)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r12_r5)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r12_r6)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r12_r7)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r12_r8)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r12_r9)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r12_r10)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r12_r11)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r12_r12)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r12_r13)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r12_r14)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r12_r15)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r12_r16)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r12_r17)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r12_r18)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r12_r19)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r12_r20)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r12_r21)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r12_r22)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r12_r23)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r12_r24)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r12_r25)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r12_r26)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r12_r27)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r12_r28)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r12_r29)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r12_r30)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r12_r31)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r13_r0)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r13_r1)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r13_r2)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r13_r3)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r13_r4)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r13_r5)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r13_r6)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r13_r7)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r13_r8)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r13_r9)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r13_r10)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r13_r11)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r13_r12)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r13_r13)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r13_r14)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r13_r15)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r13_r16)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r13_r17)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r13_r18)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r13_r19)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r13_r20)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r13_r21)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r13_r22)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r13_r23)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r13_r24)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r13_r25)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r13_r26)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r13_r27)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r13_r28)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r13_r29)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r13_r30)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r13_r31)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r14_r0)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r14_r1)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r14_r2)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r14_r3)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r14_r4)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r14_r5)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r14_r6)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r14_r7)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r14_r8)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r14_r9)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r14_r10)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r14_r11)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r14_r12)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r14_r13)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r14_r14)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r14_r15)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r14_r16)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r14_r17)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r14_r18)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r14_r19)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r14_r20)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r14_r21)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r14_r22)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r14_r23)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r14_r24)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r14_r25)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r14_r26)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r14_r27)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r14_r28)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r14_r29)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r14_r30)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r14_r31)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r15_r0)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r15_r1)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r15_r2)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r15_r3)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r15_r4)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r15_r5)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r15_r6)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r15_r7)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r15_r8)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r15_r9)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r15_r10)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r15_r11)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r15_r12)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r15_r13)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r15_r14)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r15_r15)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r15_r16)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r15_r17)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r15_r18)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r15_r19)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r15_r20)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r15_r21)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r15_r22)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r15_r23)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r15_r24)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r15_r25)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r15_r26)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r15_r27)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r15_r28)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r15_r29)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r15_r30)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r15_r31)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r16_r0)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r16_r1)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r16_r2)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r16_r3)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r16_r4)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r16_r5)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r16_r6)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r16_r7)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r16_r8)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r16_r9)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r16_r10)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r16_r11)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r16_r12)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r16_r13)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r16_r14)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r16_r15)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r16_r16)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r16_r17)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r16_r18)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r16_r19)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r16_r20)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r16_r21)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r16_r22)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r16_r23)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r16_r24)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r16_r25)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r16_r26)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r16_r27)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r16_r28)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r16_r29)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r16_r30)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r16_r31)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r17_r0)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r17_r1)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r17_r2)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r17_r3)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r17_r4)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r17_r5)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r17_r6)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r17_r7)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r17_r8)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r17_r9)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r17_r10)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r17_r11)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r17_r12)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r17_r13)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r17_r14)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r17_r15)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r17_r16)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r17_r17)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r17_r18)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r17_r19)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r17_r20)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r17_r21)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r17_r22)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r17_r23)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r17_r24)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r17_r25)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r17_r26)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r17_r27)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r17_r28)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r17_r29)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r17_r30)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r17_r31)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r18_r0)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r18_r1)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r18_r2)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r18_r3)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r18_r4)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r18_r5)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r18_r6)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r18_r7)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r18_r8)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r18_r9)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r18_r10)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r18_r11)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r18_r12)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r18_r13)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r18_r14)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r18_r15)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r18_r16)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r18_r17)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r18_r18)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r18_r19)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r18_r20)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r18_r21)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r18_r22)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r18_r23)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r18_r24)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r18_r25)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r18_r26)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r18_r27)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r18_r28)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r18_r29)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r18_r30)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r18_r31)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r19_r0)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r19_r1)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r19_r2)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r19_r3)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r19_r4)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r19_r5)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r19_r6)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r19_r7)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r19_r8)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r19_r9)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r19_r10)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r19_r11)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r19_r12)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r19_r13)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r19_r14)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r19_r15)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r19_r16)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r19_r17)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r19_r18)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r19_r19)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r19_r20)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r19_r21)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r19_r22)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r19_r23)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r19_r24)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r19_r25)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r19_r26)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r19_r27)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r19_r28)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r19_r29)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r19_r30)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r19_r31)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r20_r0)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r20_r1)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r20_r2)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r20_r3)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r20_r4)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r20_r5)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r20_r6)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r20_r7)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r20_r8)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r20_r9)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r20_r10)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r20_r11)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r20_r12)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r20_r13)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r20_r14)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r20_r15)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r20_r16)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r20_r17)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r20_r18)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r20_r19)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r20_r20)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r20_r21)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r20_r22)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r20_r23)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r20_r24)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r20_r25)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r20_r26)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r20_r27)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r20_r28)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r20_r29)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r20_r30)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r20_r31)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r21_r0)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r21_r1)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r21_r2)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r21_r3)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r21_r4)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r21_r5)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r21_r6)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r21_r7)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r21_r8)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r21_r9)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r21_r10)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r21_r11)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r21_r12)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r21_r13)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r21_r14)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r21_r15)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r21_r16)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r21_r17)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r21_r18)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r21_r19)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r21_r20)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r21_r21)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r21_r22)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r21_r23)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r21_r24)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r21_r25)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r21_r26)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r21_r27)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r21_r28)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r21_r29)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r21_r30)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r21_r31)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r22_r0)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r22_r1)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r22_r2)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r22_r3)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r22_r4)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r22_r5)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r22_r6)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r22_r7)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r22_r8)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r22_r9)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r22_r10)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r22_r11)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r22_r12)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r22_r13)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r22_r14)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r22_r15)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r22_r16)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r22_r17)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r22_r18)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r22_r19)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r22_r20)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r22_r21)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r22_r22)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r22_r23)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r22_r24)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r22_r25)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r22_r26)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r22_r27)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r22_r28)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r22_r29)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r22_r30)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r22_r31)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r23_r0)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r23_r1)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r23_r2)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r23_r3)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r23_r4)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r23_r5)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r23_r6)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r23_r7)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r23_r8)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r23_r9)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r23_r10)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r23_r11)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r23_r12)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r23_r13)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r23_r14)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r23_r15)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r23_r16)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r23_r17)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r23_r18)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r23_r19)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r23_r20)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r23_r21)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r23_r22)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r23_r23)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r23_r24)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r23_r25)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r23_r26)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r23_r27)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r23_r28)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r23_r29)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r23_r30)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r23_r31)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r24_r0)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r24_r1)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r24_r2)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r24_r3)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r24_r4)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r24_r5)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r24_r6)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r24_r7)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r24_r8)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r24_r9)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r24_r10)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r24_r11)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r24_r12)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r24_r13)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r24_r14)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r24_r15)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r24_r16)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r24_r17)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r24_r18)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r24_r19)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r24_r20)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r24_r21)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r24_r22)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r24_r23)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r24_r24)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r24_r25)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r24_r26)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r24_r27)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r24_r28)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r24_r29)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r24_r30)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r24_r31)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r25_r0)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r25_r1)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r25_r2)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r25_r3)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r25_r4)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r25_r5)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r25_r6)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r25_r7)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r25_r8)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r25_r9)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r25_r10)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r25_r11)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r25_r12)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r25_r13)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r25_r14)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r25_r15)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r25_r16)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r25_r17)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r25_r18)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r25_r19)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r25_r20)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r25_r21)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r25_r22)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r25_r23)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r25_r24)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r25_r25)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r25_r26)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r25_r27)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r25_r28)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r25_r29)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r25_r30)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r25_r31)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r26_r0)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r26_r1)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r26_r2)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r26_r3)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r26_r4)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r26_r5)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r26_r6)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r26_r7)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r26_r8)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r26_r9)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r26_r10)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r26_r11)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r26_r12)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r26_r13)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r26_r14)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r26_r15)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r26_r16)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r26_r17)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r26_r18)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r26_r19)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r26_r20)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r26_r21)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r26_r22)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r26_r23)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r26_r24)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r26_r25)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r26_r26)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r26_r27)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r26_r28)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r26_r29)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r26_r30)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r26_r31)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r27_r0)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r27_r1)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r27_r2)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r27_r3)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r27_r4)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r27_r5)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r27_r6)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r27_r7)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r27_r8)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r27_r9)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r27_r10)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r27_r11)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r27_r12)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r27_r13)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r27_r14)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r27_r15)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r27_r16)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r27_r17)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r27_r18)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r27_r19)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r27_r20)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r27_r21)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r27_r22)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r27_r23)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r27_r24)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r27_r25)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r27_r26)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r27_r27)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r27_r28)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r27_r29)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r27_r30)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r27_r31)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r28_r0)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r28_r1)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r28_r2)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r28_r3)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r28_r4)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r28_r5)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r28_r6)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r28_r7)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r28_r8)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r28_r9)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r28_r10)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r28_r11)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r28_r12)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r28_r13)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r28_r14)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r28_r15)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r28_r16)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r28_r17)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r28_r18)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r28_r19)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r28_r20)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r28_r21)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r28_r22)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r28_r23)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r28_r24)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r28_r25)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r28_r26)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r28_r27)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r28_r28)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r28_r29)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r28_r30)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r28_r31)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r29_r0)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r29_r1)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r29_r2)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r29_r3)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r29_r4)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r29_r5)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r29_r6)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r29_r7)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r29_r8)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r29_r9)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r29_r10)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r29_r11)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r29_r12)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r29_r13)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r29_r14)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r29_r15)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r29_r16)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r29_r17)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r29_r18)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r29_r19)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r29_r20)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r29_r21)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r29_r22)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r29_r23)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r29_r24)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r29_r25)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r29_r26)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r29_r27)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r29_r28)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r29_r29)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r29_r30)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r29_r31)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r30_r0)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r30_r1)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r30_r2)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r30_r3)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r30_r4)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r30_r5)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r30_r6)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r30_r7)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r30_r8)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r30_r9)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r30_r10)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r30_r11)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r30_r12)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r30_r13)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r30_r14)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r30_r15)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r30_r16)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r30_r17)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r30_r18)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r30_r19)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r30_r20)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r30_r21)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r30_r22)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r30_r23)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r30_r24)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r30_r25)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r30_r26)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r30_r27)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r30_r28)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r30_r29)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r30_r30)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r30_r31)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(mr_r31_r0)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[0];
+}
+
+X(mr_r31_r1)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[1];
+}
+
+X(mr_r31_r2)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[2];
+}
+
+X(mr_r31_r3)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[3];
+}
+
+X(mr_r31_r4)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[4];
+}
+
+X(mr_r31_r5)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[5];
+}
+
+X(mr_r31_r6)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[6];
+}
+
+X(mr_r31_r7)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[7];
+}
+
+X(mr_r31_r8)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[8];
+}
+
+X(mr_r31_r9)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[9];
+}
+
+X(mr_r31_r10)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[10];
+}
+
+X(mr_r31_r11)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[11];
+}
+
+X(mr_r31_r12)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[12];
+}
+
+X(mr_r31_r13)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[13];
+}
+
+X(mr_r31_r14)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[14];
+}
+
+X(mr_r31_r15)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[15];
+}
+
+X(mr_r31_r16)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[16];
+}
+
+X(mr_r31_r17)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[17];
+}
+
+X(mr_r31_r18)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[18];
+}
+
+X(mr_r31_r19)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[19];
+}
+
+X(mr_r31_r20)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[20];
+}
+
+X(mr_r31_r21)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[21];
+}
+
+X(mr_r31_r22)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[22];
+}
+
+X(mr_r31_r23)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[23];
+}
+
+X(mr_r31_r24)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[24];
+}
+
+X(mr_r31_r25)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[25];
+}
+
+X(mr_r31_r26)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[26];
+}
+
+X(mr_r31_r27)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[27];
+}
+
+X(mr_r31_r28)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[28];
+}
+
+X(mr_r31_r29)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[29];
+}
+
+X(mr_r31_r30)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[30];
+}
+
+X(mr_r31_r31)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)cpu->cd.ppc.gpr[31];
+}
+
+X(li_r0)
+{
+	cpu->cd.ppc.gpr[0] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r1)
+{
+	cpu->cd.ppc.gpr[1] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r2)
+{
+	cpu->cd.ppc.gpr[2] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r3)
+{
+	cpu->cd.ppc.gpr[3] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r4)
+{
+	cpu->cd.ppc.gpr[4] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r5)
+{
+	cpu->cd.ppc.gpr[5] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r6)
+{
+	cpu->cd.ppc.gpr[6] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r7)
+{
+	cpu->cd.ppc.gpr[7] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r8)
+{
+	cpu->cd.ppc.gpr[8] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r9)
+{
+	cpu->cd.ppc.gpr[9] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r10)
+{
+	cpu->cd.ppc.gpr[10] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r11)
+{
+	cpu->cd.ppc.gpr[11] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r12)
+{
+	cpu->cd.ppc.gpr[12] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r13)
+{
+	cpu->cd.ppc.gpr[13] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r14)
+{
+	cpu->cd.ppc.gpr[14] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r15)
+{
+	cpu->cd.ppc.gpr[15] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r16)
+{
+	cpu->cd.ppc.gpr[16] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r17)
+{
+	cpu->cd.ppc.gpr[17] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r18)
+{
+	cpu->cd.ppc.gpr[18] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r19)
+{
+	cpu->cd.ppc.gpr[19] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r20)
+{
+	cpu->cd.ppc.gpr[20] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r21)
+{
+	cpu->cd.ppc.gpr[21] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r22)
+{
+	cpu->cd.ppc.gpr[22] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r23)
+{
+	cpu->cd.ppc.gpr[23] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r24)
+{
+	cpu->cd.ppc.gpr[24] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r25)
+{
+	cpu->cd.ppc.gpr[25] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r26)
+{
+	cpu->cd.ppc.gpr[26] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r27)
+{
+	cpu->cd.ppc.gpr[27] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r28)
+{
+	cpu->cd.ppc.gpr[28] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r29)
+{
+	cpu->cd.ppc.gpr[29] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r30)
+{
+	cpu->cd.ppc.gpr[30] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(li_r31)
+{
+	cpu->cd.ppc.gpr[31] = (MODE_uint_t)(int32_t)ic->arg[1];
+}
+
+X(cmpwi_cr0_r0)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[0], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r1)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[1], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r2)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[2], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r3)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[3], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r4)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[4], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r5)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[5], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r6)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[6], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r7)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[7], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r8)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[8], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r9)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[9], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r10)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[10], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r11)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[11], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r12)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[12], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r13)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[13], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r14)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[14], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r15)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[15], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r16)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[16], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r17)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[17], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r18)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[18], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r19)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[19], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r20)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[20], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r21)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[21], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r22)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[22], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r23)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[23], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r24)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[24], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r25)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[25], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r26)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[26], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r27)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[27], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r28)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[28], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r29)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[29], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r30)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[30], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(cmpwi_cr0_r31)
+{
+	int32_t tmp = cpu->cd.ppc.gpr[31], imm = ic->arg[1];
+	cpu->cd.ppc.cr &= ~(0xf0000000);
+	if (tmp < imm)
+		cpu->cd.ppc.cr |= 0x80000000;
+	else if (tmp > imm)
+		cpu->cd.ppc.cr |= 0x40000000;
+	else
+		cpu->cd.ppc.cr |= 0x20000000;
+	cpu->cd.ppc.cr |= ((cpu->cd.ppc.spr[SPR_XER] >> 3) & 0x10000000);
+}
+
+X(bc_samepage_simple0_bi0)
+{
+	if (!(cpu->cd.ppc.cr & 0x80000000U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi1)
+{
+	if (!(cpu->cd.ppc.cr & 0x40000000U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi2)
+{
+	if (!(cpu->cd.ppc.cr & 0x20000000U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi3)
+{
+	if (!(cpu->cd.ppc.cr & 0x10000000U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi4)
+{
+	if (!(cpu->cd.ppc.cr & 0x08000000U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi5)
+{
+	if (!(cpu->cd.ppc.cr & 0x04000000U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi6)
+{
+	if (!(cpu->cd.ppc.cr & 0x02000000U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi7)
+{
+	if (!(cpu->cd.ppc.cr & 0x01000000U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi8)
+{
+	if (!(cpu->cd.ppc.cr & 0x00800000U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi9)
+{
+	if (!(cpu->cd.ppc.cr & 0x00400000U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi10)
+{
+	if (!(cpu->cd.ppc.cr & 0x00200000U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi11)
+{
+	if (!(cpu->cd.ppc.cr & 0x00100000U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi12)
+{
+	if (!(cpu->cd.ppc.cr & 0x00080000U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi13)
+{
+	if (!(cpu->cd.ppc.cr & 0x00040000U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi14)
+{
+	if (!(cpu->cd.ppc.cr & 0x00020000U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi15)
+{
+	if (!(cpu->cd.ppc.cr & 0x00010000U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi16)
+{
+	if (!(cpu->cd.ppc.cr & 0x00008000U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi17)
+{
+	if (!(cpu->cd.ppc.cr & 0x00004000U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi18)
+{
+	if (!(cpu->cd.ppc.cr & 0x00002000U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi19)
+{
+	if (!(cpu->cd.ppc.cr & 0x00001000U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi20)
+{
+	if (!(cpu->cd.ppc.cr & 0x00000800U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi21)
+{
+	if (!(cpu->cd.ppc.cr & 0x00000400U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi22)
+{
+	if (!(cpu->cd.ppc.cr & 0x00000200U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi23)
+{
+	if (!(cpu->cd.ppc.cr & 0x00000100U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi24)
+{
+	if (!(cpu->cd.ppc.cr & 0x00000080U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi25)
+{
+	if (!(cpu->cd.ppc.cr & 0x00000040U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi26)
+{
+	if (!(cpu->cd.ppc.cr & 0x00000020U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi27)
+{
+	if (!(cpu->cd.ppc.cr & 0x00000010U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi28)
+{
+	if (!(cpu->cd.ppc.cr & 0x00000008U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi29)
+{
+	if (!(cpu->cd.ppc.cr & 0x00000004U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi30)
+{
+	if (!(cpu->cd.ppc.cr & 0x00000002U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple0_bi31)
+{
+	if (!(cpu->cd.ppc.cr & 0x00000001U))
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi0)
+{
+	if (cpu->cd.ppc.cr & 0x80000000U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi1)
+{
+	if (cpu->cd.ppc.cr & 0x40000000U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi2)
+{
+	if (cpu->cd.ppc.cr & 0x20000000U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi3)
+{
+	if (cpu->cd.ppc.cr & 0x10000000U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi4)
+{
+	if (cpu->cd.ppc.cr & 0x08000000U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi5)
+{
+	if (cpu->cd.ppc.cr & 0x04000000U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi6)
+{
+	if (cpu->cd.ppc.cr & 0x02000000U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi7)
+{
+	if (cpu->cd.ppc.cr & 0x01000000U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi8)
+{
+	if (cpu->cd.ppc.cr & 0x00800000U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi9)
+{
+	if (cpu->cd.ppc.cr & 0x00400000U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi10)
+{
+	if (cpu->cd.ppc.cr & 0x00200000U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi11)
+{
+	if (cpu->cd.ppc.cr & 0x00100000U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi12)
+{
+	if (cpu->cd.ppc.cr & 0x00080000U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi13)
+{
+	if (cpu->cd.ppc.cr & 0x00040000U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi14)
+{
+	if (cpu->cd.ppc.cr & 0x00020000U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi15)
+{
+	if (cpu->cd.ppc.cr & 0x00010000U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi16)
+{
+	if (cpu->cd.ppc.cr & 0x00008000U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi17)
+{
+	if (cpu->cd.ppc.cr & 0x00004000U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi18)
+{
+	if (cpu->cd.ppc.cr & 0x00002000U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi19)
+{
+	if (cpu->cd.ppc.cr & 0x00001000U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi20)
+{
+	if (cpu->cd.ppc.cr & 0x00000800U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi21)
+{
+	if (cpu->cd.ppc.cr & 0x00000400U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi22)
+{
+	if (cpu->cd.ppc.cr & 0x00000200U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi23)
+{
+	if (cpu->cd.ppc.cr & 0x00000100U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi24)
+{
+	if (cpu->cd.ppc.cr & 0x00000080U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi25)
+{
+	if (cpu->cd.ppc.cr & 0x00000040U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi26)
+{
+	if (cpu->cd.ppc.cr & 0x00000020U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi27)
+{
+	if (cpu->cd.ppc.cr & 0x00000010U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi28)
+{
+	if (cpu->cd.ppc.cr & 0x00000008U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi29)
+{
+	if (cpu->cd.ppc.cr & 0x00000004U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi30)
+{
+	if (cpu->cd.ppc.cr & 0x00000002U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+X(bc_samepage_simple1_bi31)
+{
+	if (cpu->cd.ppc.cr & 0x00000001U)
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic->arg[0];
+}
+
+
+void (*instr(alu_addi)[1024])(struct cpu *, struct ppc_instr_call *) = {
+instr(addi_r0_r0),
+instr(addi_r0_r1),
+instr(addi_r0_r2),
+instr(addi_r0_r3),
+instr(addi_r0_r4),
+instr(addi_r0_r5),
+instr(addi_r0_r6),
+instr(addi_r0_r7),
+instr(addi_r0_r8),
+instr(addi_r0_r9),
+instr(addi_r0_r10),
+instr(addi_r0_r11),
+instr(addi_r0_r12),
+instr(addi_r0_r13),
+instr(addi_r0_r14),
+instr(addi_r0_r15),
+instr(addi_r0_r16),
+instr(addi_r0_r17),
+instr(addi_r0_r18),
+instr(addi_r0_r19),
+instr(addi_r0_r20),
+instr(addi_r0_r21),
+instr(addi_r0_r22),
+instr(addi_r0_r23),
+instr(addi_r0_r24),
+instr(addi_r0_r25),
+instr(addi_r0_r26),
+instr(addi_r0_r27),
+instr(addi_r0_r28),
+instr(addi_r0_r29),
+instr(addi_r0_r30),
+instr(addi_r0_r31),
+instr(addi_r1_r0),
+instr(addi_r1_r1),
+instr(addi_r1_r2),
+instr(addi_r1_r3),
+instr(addi_r1_r4),
+instr(addi_r1_r5),
+instr(addi_r1_r6),
+instr(addi_r1_r7),
+instr(addi_r1_r8),
+instr(addi_r1_r9),
+instr(addi_r1_r10),
+instr(addi_r1_r11),
+instr(addi_r1_r12),
+instr(addi_r1_r13),
+instr(addi_r1_r14),
+instr(addi_r1_r15),
+instr(addi_r1_r16),
+instr(addi_r1_r17),
+instr(addi_r1_r18),
+instr(addi_r1_r19),
+instr(addi_r1_r20),
+instr(addi_r1_r21),
+instr(addi_r1_r22),
+instr(addi_r1_r23),
+instr(addi_r1_r24),
+instr(addi_r1_r25),
+instr(addi_r1_r26),
+instr(addi_r1_r27),
+instr(addi_r1_r28),
+instr(addi_r1_r29),
+instr(addi_r1_r30),
+instr(addi_r1_r31),
+instr(addi_r2_r0),
+instr(addi_r2_r1),
+instr(addi_r2_r2),
+instr(addi_r2_r3),
+instr(addi_r2_r4),
+instr(addi_r2_r5),
+instr(addi_r2_r6),
+instr(addi_r2_r7),
+instr(addi_r2_r8),
+instr(addi_r2_r9),
+instr(addi_r2_r10),
+instr(addi_r2_r11),
+instr(addi_r2_r12),
+instr(addi_r2_r13),
+instr(addi_r2_r14),
+instr(addi_r2_r15),
+instr(addi_r2_r16),
+instr(addi_r2_r17),
+instr(addi_r2_r18),
+instr(addi_r2_r19),
+instr(addi_r2_r20),
+instr(addi_r2_r21),
+instr(addi_r2_r22),
+instr(addi_r2_r23),
+instr(addi_r2_r24),
+instr(addi_r2_r25),
+instr(addi_r2_r26),
+instr(addi_r2_r27),
+instr(addi_r2_r28),
+instr(addi_r2_r29),
+instr(addi_r2_r30),
+instr(addi_r2_r31),
+instr(addi_r3_r0),
+instr(addi_r3_r1),
+instr(addi_r3_r2),
+instr(addi_r3_r3),
+instr(addi_r3_r4),
+instr(addi_r3_r5),
+instr(addi_r3_r6),
+instr(addi_r3_r7),
+instr(addi_r3_r8),
+instr(addi_r3_r9),
+instr(addi_r3_r10),
+instr(addi_r3_r11),
+instr(addi_r3_r12),
+instr(addi_r3_r13),
+instr(addi_r3_r14),
+instr(addi_r3_r15),
+instr(addi_r3_r16),
+instr(addi_r3_r17),
+instr(addi_r3_r18),
+instr(addi_r3_r19),
+instr(addi_r3_r20),
+instr(addi_r3_r21),
+instr(addi_r3_r22),
+instr(addi_r3_r23),
+instr(addi_r3_r24),
+instr(addi_r3_r25),
+instr(addi_r3_r26),
+instr(addi_r3_r27),
+instr(addi_r3_r28),
+instr(addi_r3_r29),
+instr(addi_r3_r30),
+instr(addi_r3_r31),
+instr(addi_r4_r0),
+instr(addi_r4_r1),
+instr(addi_r4_r2),
+instr(addi_r4_r3),
+instr(addi_r4_r4),
+instr(addi_r4_r5),
+instr(addi_r4_r6),
+instr(addi_r4_r7),
+instr(addi_r4_r8),
+instr(addi_r4_r9),
+instr(addi_r4_r10),
+instr(addi_r4_r11),
+instr(addi_r4_r12),
+instr(addi_r4_r13),
+instr(addi_r4_r14),
+instr(addi_r4_r15),
+instr(addi_r4_r16),
+instr(addi_r4_r17),
+instr(addi_r4_r18),
+instr(addi_r4_r19),
+instr(addi_r4_r20),
+instr(addi_r4_r21),
+instr(addi_r4_r22),
+instr(addi_r4_r23),
+instr(addi_r4_r24),
+instr(addi_r4_r25),
+instr(addi_r4_r26),
+instr(addi_r4_r27),
+instr(addi_r4_r28),
+instr(addi_r4_r29),
+instr(addi_r4_r30),
+instr(addi_r4_r31),
+instr(addi_r5_r0),
+instr(addi_r5_r1),
+instr(addi_r5_r2),
+instr(addi_r5_r3),
+instr(addi_r5_r4),
+instr(addi_r5_r5),
+instr(addi_r5_r6),
+instr(addi_r5_r7),
+instr(addi_r5_r8),
+instr(addi_r5_r9),
+instr(addi_r5_r10),
+instr(addi_r5_r11),
+instr(addi_r5_r12),
+instr(addi_r5_r13),
+instr(addi_r5_r14),
+instr(addi_r5_r15),
+instr(addi_r5_r16),
+instr(addi_r5_r17),
+instr(addi_r5_r18),
+instr(addi_r5_r19),
+instr(addi_r5_r20),
+instr(addi_r5_r21),
+instr(addi_r5_r22),
+instr(addi_r5_r23),
+instr(addi_r5_r24),
+instr(addi_r5_r25),
+instr(addi_r5_r26),
+instr(addi_r5_r27),
+instr(addi_r5_r28),
+instr(addi_r5_r29),
+instr(addi_r5_r30),
+instr(addi_r5_r31),
+instr(addi_r6_r0),
+instr(addi_r6_r1),
+instr(addi_r6_r2),
+instr(addi_r6_r3),
+instr(addi_r6_r4),
+instr(addi_r6_r5),
+instr(addi_r6_r6),
+instr(addi_r6_r7),
+instr(addi_r6_r8),
+instr(addi_r6_r9),
+instr(addi_r6_r10),
+instr(addi_r6_r11),
+instr(addi_r6_r12),
+instr(addi_r6_r13),
+instr(addi_r6_r14),
+instr(addi_r6_r15),
+instr(addi_r6_r16),
+instr(addi_r6_r17),
+instr(addi_r6_r18),
+instr(addi_r6_r19),
+instr(addi_r6_r20),
+instr(addi_r6_r21),
+instr(addi_r6_r22),
+instr(addi_r6_r23),
+instr(addi_r6_r24),
+instr(addi_r6_r25),
+instr(addi_r6_r26),
+instr(addi_r6_r27),
+instr(addi_r6_r28),
+instr(addi_r6_r29),
+instr(addi_r6_r30),
+instr(addi_r6_r31),
+instr(addi_r7_r0),
+instr(addi_r7_r1),
+instr(addi_r7_r2),
+instr(addi_r7_r3),
+instr(addi_r7_r4),
+instr(addi_r7_r5),
+instr(addi_r7_r6),
+instr(addi_r7_r7),
+instr(addi_r7_r8),
+instr(addi_r7_r9),
+instr(addi_r7_r10),
+instr(addi_r7_r11),
+instr(addi_r7_r12),
+instr(addi_r7_r13),
+instr(addi_r7_r14),
+instr(addi_r7_r15),
+instr(addi_r7_r16),
+instr(addi_r7_r17),
+instr(addi_r7_r18),
+instr(addi_r7_r19),
+instr(addi_r7_r20),
+instr(addi_r7_r21),
+instr(addi_r7_r22),
+instr(addi_r7_r23),
+instr(addi_r7_r24),
+instr(addi_r7_r25),
+instr(addi_r7_r26),
+instr(addi_r7_r27),
+instr(addi_r7_r28),
+instr(addi_r7_r29),
+instr(addi_r7_r30),
+instr(addi_r7_r31),
+instr(addi_r8_r0),
+instr(addi_r8_r1),
+instr(addi_r8_r2),
+instr(addi_r8_r3),
+instr(addi_r8_r4),
+instr(addi_r8_r5),
+instr(addi_r8_r6),
+instr(addi_r8_r7),
+instr(addi_r8_r8),
+instr(addi_r8_r9),
+instr(addi_r8_r10),
+instr(addi_r8_r11),
+instr(addi_r8_r12),
+instr(addi_r8_r13),
+instr(addi_r8_r14),
+instr(addi_r8_r15),
+instr(addi_r8_r16),
+instr(addi_r8_r17),
+instr(addi_r8_r18),
+instr(addi_r8_r19),
+instr(addi_r8_r20),
+instr(addi_r8_r21),
+instr(addi_r8_r22),
+instr(addi_r8_r23),
+instr(addi_r8_r24),
+instr(addi_r8_r25),
+instr(addi_r8_r26),
+instr(addi_r8_r27),
+instr(addi_r8_r28),
+instr(addi_r8_r29),
+instr(addi_r8_r30),
+instr(addi_r8_r31),
+instr(addi_r9_r0),
+instr(addi_r9_r1),
+instr(addi_r9_r2),
+instr(addi_r9_r3),
+instr(addi_r9_r4),
+instr(addi_r9_r5),
+instr(addi_r9_r6),
+instr(addi_r9_r7),
+instr(addi_r9_r8),
+instr(addi_r9_r9),
+instr(addi_r9_r10),
+instr(addi_r9_r11),
+instr(addi_r9_r12),
+instr(addi_r9_r13),
+instr(addi_r9_r14),
+instr(addi_r9_r15),
+instr(addi_r9_r16),
+instr(addi_r9_r17),
+instr(addi_r9_r18),
+instr(addi_r9_r19),
+instr(addi_r9_r20),
+instr(addi_r9_r21),
+instr(addi_r9_r22),
+instr(addi_r9_r23),
+instr(addi_r9_r24),
+instr(addi_r9_r25),
+instr(addi_r9_r26),
+instr(addi_r9_r27),
+instr(addi_r9_r28),
+instr(addi_r9_r29),
+instr(addi_r9_r30),
+instr(addi_r9_r31),
+instr(addi_r10_r0),
+instr(addi_r10_r1),
+instr(addi_r10_r2),
+instr(addi_r10_r3),
+instr(addi_r10_r4),
+instr(addi_r10_r5),
+instr(addi_r10_r6),
+instr(addi_r10_r7),
+instr(addi_r10_r8),
+instr(addi_r10_r9),
+instr(addi_r10_r10),
+instr(addi_r10_r11),
+instr(addi_r10_r12),
+instr(addi_r10_r13),
+instr(addi_r10_r14),
+instr(addi_r10_r15),
+instr(addi_r10_r16),
+instr(addi_r10_r17),
+instr(addi_r10_r18),
+instr(addi_r10_r19),
+instr(addi_r10_r20),
+instr(addi_r10_r21),
+instr(addi_r10_r22),
+instr(addi_r10_r23),
+instr(addi_r10_r24),
+instr(addi_r10_r25),
+instr(addi_r10_r26),
+instr(addi_r10_r27),
+instr(addi_r10_r28),
+instr(addi_r10_r29),
+instr(addi_r10_r30),
+instr(addi_r10_r31),
+instr(addi_r11_r0),
+instr(addi_r11_r1),
+instr(addi_r11_r2),
+instr(addi_r11_r3),
+instr(addi_r11_r4),
+instr(addi_r11_r5),
+instr(addi_r11_r6),
+instr(addi_r11_r7),
+instr(addi_r11_r8),
+instr(addi_r11_r9),
+instr(addi_r11_r10),
+instr(addi_r11_r11),
+instr(addi_r11_r12),
+instr(addi_r11_r13),
+instr(addi_r11_r14),
+instr(addi_r11_r15),
+instr(addi_r11_r16),
+instr(addi_r11_r17),
+instr(addi_r11_r18),
+instr(addi_r11_r19),
+instr(addi_r11_r20),
+instr(addi_r11_r21),
+instr(addi_r11_r22),
+instr(addi_r11_r23),
+instr(addi_r11_r24),
+instr(addi_r11_r25),
+instr(addi_r11_r26),
+instr(addi_r11_r27),
+instr(addi_r11_r28),
+instr(addi_r11_r29),
+instr(addi_r11_r30),
+instr(addi_r11_r31),
+instr(addi_r12_r0),
+instr(addi_r12_r1),
+instr(addi_r12_r2),
+instr(addi_r12_r3),
+instr(addi_r12_r4),
+instr(addi_r12_r5),
+instr(addi_r12_r6),
+instr(addi_r12_r7),
+instr(addi_r12_r8),
+instr(addi_r12_r9),
+instr(addi_r12_r10),
+instr(addi_r12_r11),
+instr(addi_r12_r12),
+instr(addi_r12_r13),
+instr(addi_r12_r14),
+instr(addi_r12_r15),
+instr(addi_r12_r16),
+instr(addi_r12_r17),
+instr(addi_r12_r18),
+instr(addi_r12_r19),
+instr(addi_r12_r20),
+instr(addi_r12_r21),
+instr(addi_r12_r22),
+instr(addi_r12_r23),
+instr(addi_r12_r24),
+instr(addi_r12_r25),
+instr(addi_r12_r26),
+instr(addi_r12_r27),
+instr(addi_r12_r28),
+instr(addi_r12_r29),
+instr(addi_r12_r30),
+instr(addi_r12_r31),
+instr(addi_r13_r0),
+instr(addi_r13_r1),
+instr(addi_r13_r2),
+instr(addi_r13_r3),
+instr(addi_r13_r4),
+instr(addi_r13_r5),
+instr(addi_r13_r6),
+instr(addi_r13_r7),
+instr(addi_r13_r8),
+instr(addi_r13_r9),
+instr(addi_r13_r10),
+instr(addi_r13_r11),
+instr(addi_r13_r12),
+instr(addi_r13_r13),
+instr(addi_r13_r14),
+instr(addi_r13_r15),
+instr(addi_r13_r16),
+instr(addi_r13_r17),
+instr(addi_r13_r18),
+instr(addi_r13_r19),
+instr(addi_r13_r20),
+instr(addi_r13_r21),
+instr(addi_r13_r22),
+instr(addi_r13_r23),
+instr(addi_r13_r24),
+instr(addi_r13_r25),
+instr(addi_r13_r26),
+instr(addi_r13_r27),
+instr(addi_r13_r28),
+instr(addi_r13_r29),
+instr(addi_r13_r30),
+instr(addi_r13_r31),
+instr(addi_r14_r0),
+instr(addi_r14_r1),
+instr(addi_r14_r2),
+instr(addi_r14_r3),
+instr(addi_r14_r4),
+instr(addi_r14_r5),
+instr(addi_r14_r6),
+instr(addi_r14_r7),
+instr(addi_r14_r8),
+instr(addi_r14_r9),
+instr(addi_r14_r10),
+instr(addi_r14_r11),
+instr(addi_r14_r12),
+instr(addi_r14_r13),
+instr(addi_r14_r14),
+instr(addi_r14_r15),
+instr(addi_r14_r16),
+instr(addi_r14_r17),
+instr(addi_r14_r18),
+instr(addi_r14_r19),
+instr(addi_r14_r20),
+instr(addi_r14_r21),
+instr(addi_r14_r22),
+instr(addi_r14_r23),
+instr(addi_r14_r24),
+instr(addi_r14_r25),
+instr(addi_r14_r26),
+instr(addi_r14_r27),
+instr(addi_r14_r28),
+instr(addi_r14_r29),
+instr(addi_r14_r30),
+instr(addi_r14_r31),
+instr(addi_r15_r0),
+instr(addi_r15_r1),
+instr(addi_r15_r2),
+instr(addi_r15_r3),
+instr(addi_r15_r4),
+instr(addi_r15_r5),
+instr(addi_r15_r6),
+instr(addi_r15_r7),
+instr(addi_r15_r8),
+instr(addi_r15_r9),
+instr(addi_r15_r10),
+instr(addi_r15_r11),
+instr(addi_r15_r12),
+instr(addi_r15_r13),
+instr(addi_r15_r14),
+instr(addi_r15_r15),
+instr(addi_r15_r16),
+instr(addi_r15_r17),
+instr(addi_r15_r18),
+instr(addi_r15_r19),
+instr(addi_r15_r20),
+instr(addi_r15_r21),
+instr(addi_r15_r22),
+instr(addi_r15_r23),
+instr(addi_r15_r24),
+instr(addi_r15_r25),
+instr(addi_r15_r26),
+instr(addi_r15_r27),
+instr(addi_r15_r28),
+instr(addi_r15_r29),
+instr(addi_r15_r30),
+instr(addi_r15_r31),
+instr(addi_r16_r0),
+instr(addi_r16_r1),
+instr(addi_r16_r2),
+instr(addi_r16_r3),
+instr(addi_r16_r4),
+instr(addi_r16_r5),
+instr(addi_r16_r6),
+instr(addi_r16_r7),
+instr(addi_r16_r8),
+instr(addi_r16_r9),
+instr(addi_r16_r10),
+instr(addi_r16_r11),
+instr(addi_r16_r12),
+instr(addi_r16_r13),
+instr(addi_r16_r14),
+instr(addi_r16_r15),
+instr(addi_r16_r16),
+instr(addi_r16_r17),
+instr(addi_r16_r18),
+instr(addi_r16_r19),
+instr(addi_r16_r20),
+instr(addi_r16_r21),
+instr(addi_r16_r22),
+instr(addi_r16_r23),
+instr(addi_r16_r24),
+instr(addi_r16_r25),
+instr(addi_r16_r26),
+instr(addi_r16_r27),
+instr(addi_r16_r28),
+instr(addi_r16_r29),
+instr(addi_r16_r30),
+instr(addi_r16_r31),
+instr(addi_r17_r0),
+instr(addi_r17_r1),
+instr(addi_r17_r2),
+instr(addi_r17_r3),
+instr(addi_r17_r4),
+instr(addi_r17_r5),
+instr(addi_r17_r6),
+instr(addi_r17_r7),
+instr(addi_r17_r8),
+instr(addi_r17_r9),
+instr(addi_r17_r10),
+instr(addi_r17_r11),
+instr(addi_r17_r12),
+instr(addi_r17_r13),
+instr(addi_r17_r14),
+instr(addi_r17_r15),
+instr(addi_r17_r16),
+instr(addi_r17_r17),
+instr(addi_r17_r18),
+instr(addi_r17_r19),
+instr(addi_r17_r20),
+instr(addi_r17_r21),
+instr(addi_r17_r22),
+instr(addi_r17_r23),
+instr(addi_r17_r24),
+instr(addi_r17_r25),
+instr(addi_r17_r26),
+instr(addi_r17_r27),
+instr(addi_r17_r28),
+instr(addi_r17_r29),
+instr(addi_r17_r30),
+instr(addi_r17_r31),
+instr(addi_r18_r0),
+instr(addi_r18_r1),
+instr(addi_r18_r2),
+instr(addi_r18_r3),
+instr(addi_r18_r4),
+instr(addi_r18_r5),
+instr(addi_r18_r6),
+instr(addi_r18_r7),
+instr(addi_r18_r8),
+instr(addi_r18_r9),
+instr(addi_r18_r10),
+instr(addi_r18_r11),
+instr(addi_r18_r12),
+instr(addi_r18_r13),
+instr(addi_r18_r14),
+instr(addi_r18_r15),
+instr(addi_r18_r16),
+instr(addi_r18_r17),
+instr(addi_r18_r18),
+instr(addi_r18_r19),
+instr(addi_r18_r20),
+instr(addi_r18_r21),
+instr(addi_r18_r22),
+instr(addi_r18_r23),
+instr(addi_r18_r24),
+instr(addi_r18_r25),
+instr(addi_r18_r26),
+instr(addi_r18_r27),
+instr(addi_r18_r28),
+instr(addi_r18_r29),
+instr(addi_r18_r30),
+instr(addi_r18_r31),
+instr(addi_r19_r0),
+instr(addi_r19_r1),
+instr(addi_r19_r2),
+instr(addi_r19_r3),
+instr(addi_r19_r4),
+instr(addi_r19_r5),
+instr(addi_r19_r6),
+instr(addi_r19_r7),
+instr(addi_r19_r8),
+instr(addi_r19_r9),
+instr(addi_r19_r10),
+instr(addi_r19_r11),
+instr(addi_r19_r12),
+instr(addi_r19_r13),
+instr(addi_r19_r14),
+instr(addi_r19_r15),
+instr(addi_r19_r16),
+instr(addi_r19_r17),
+instr(addi_r19_r18),
+instr(addi_r19_r19),
+instr(addi_r19_r20),
+instr(addi_r19_r21),
+instr(addi_r19_r22),
+instr(addi_r19_r23),
+instr(addi_r19_r24),
+instr(addi_r19_r25),
+instr(addi_r19_r26),
+instr(addi_r19_r27),
+instr(addi_r19_r28),
+instr(addi_r19_r29),
+instr(addi_r19_r30),
+instr(addi_r19_r31),
+instr(addi_r20_r0),
+instr(addi_r20_r1),
+instr(addi_r20_r2),
+instr(addi_r20_r3),
+instr(addi_r20_r4),
+instr(addi_r20_r5),
+instr(addi_r20_r6),
+instr(addi_r20_r7),
+instr(addi_r20_r8),
+instr(addi_r20_r9),
+instr(addi_r20_r10),
+instr(addi_r20_r11),
+instr(addi_r20_r12),
+instr(addi_r20_r13),
+instr(addi_r20_r14),
+instr(addi_r20_r15),
+instr(addi_r20_r16),
+instr(addi_r20_r17),
+instr(addi_r20_r18),
+instr(addi_r20_r19),
+instr(addi_r20_r20),
+instr(addi_r20_r21),
+instr(addi_r20_r22),
+instr(addi_r20_r23),
+instr(addi_r20_r24),
+instr(addi_r20_r25),
+instr(addi_r20_r26),
+instr(addi_r20_r27),
+instr(addi_r20_r28),
+instr(addi_r20_r29),
+instr(addi_r20_r30),
+instr(addi_r20_r31),
+instr(addi_r21_r0),
+instr(addi_r21_r1),
+instr(addi_r21_r2),
+instr(addi_r21_r3),
+instr(addi_r21_r4),
+instr(addi_r21_r5),
+instr(addi_r21_r6),
+instr(addi_r21_r7),
+instr(addi_r21_r8),
+instr(addi_r21_r9),
+instr(addi_r21_r10),
+instr(addi_r21_r11),
+instr(addi_r21_r12),
+instr(addi_r21_r13),
+instr(addi_r21_r14),
+instr(addi_r21_r15),
+instr(addi_r21_r16),
+instr(addi_r21_r17),
+instr(addi_r21_r18),
+instr(addi_r21_r19),
+instr(addi_r21_r20),
+instr(addi_r21_r21),
+instr(addi_r21_r22),
+instr(addi_r21_r23),
+instr(addi_r21_r24),
+instr(addi_r21_r25),
+instr(addi_r21_r26),
+instr(addi_r21_r27),
+instr(addi_r21_r28),
+instr(addi_r21_r29),
+instr(addi_r21_r30),
+instr(addi_r21_r31),
+instr(addi_r22_r0),
+instr(addi_r22_r1),
+instr(addi_r22_r2),
+instr(addi_r22_r3),
+instr(addi_r22_r4),
+instr(addi_r22_r5),
+instr(addi_r22_r6),
+instr(addi_r22_r7),
+instr(addi_r22_r8),
+instr(addi_r22_r9),
+instr(addi_r22_r10),
+instr(addi_r22_r11),
+instr(addi_r22_r12),
+instr(addi_r22_r13),
+instr(addi_r22_r14),
+instr(addi_r22_r15),
+instr(addi_r22_r16),
+instr(addi_r22_r17),
+instr(addi_r22_r18),
+instr(addi_r22_r19),
+instr(addi_r22_r20),
+instr(addi_r22_r21),
+instr(addi_r22_r22),
+instr(addi_r22_r23),
+instr(addi_r22_r24),
+instr(addi_r22_r25),
+instr(addi_r22_r26),
+instr(addi_r22_r27),
+instr(addi_r22_r28),
+instr(addi_r22_r29),
+instr(addi_r22_r30),
+instr(addi_r22_r31),
+instr(addi_r23_r0),
+instr(addi_r23_r1),
+instr(addi_r23_r2),
+instr(addi_r23_r3),
+instr(addi_r23_r4),
+instr(addi_r23_r5),
+instr(addi_r23_r6),
+instr(addi_r23_r7),
+instr(addi_r23_r8),
+instr(addi_r23_r9),
+instr(addi_r23_r10),
+instr(addi_r23_r11),
+instr(addi_r23_r12),
+instr(addi_r23_r13),
+instr(addi_r23_r14),
+instr(addi_r23_r15),
+instr(addi_r23_r16),
+instr(addi_r23_r17),
+instr(addi_r23_r18),
+instr(addi_r23_r19),
+instr(addi_r23_r20),
+instr(addi_r23_r21),
+instr(addi_r23_r22),
+instr(addi_r23_r23),
+instr(addi_r23_r24),
+instr(addi_r23_r25),
+instr(addi_r23_r26),
+instr(addi_r23_r27),
+instr(addi_r23_r28),
+instr(addi_r23_r29),
+instr(addi_r23_r30),
+instr(addi_r23_r31),
+instr(addi_r24_r0),
+instr(addi_r24_r1),
+instr(addi_r24_r2),
+instr(addi_r24_r3),
+instr(addi_r24_r4),
+instr(addi_r24_r5),
+instr(addi_r24_r6),
+instr(addi_r24_r7),
+instr(addi_r24_r8),
+instr(addi_r24_r9),
+instr(addi_r24_r10),
+instr(addi_r24_r11),
+instr(addi_r24_r12),
+instr(addi_r24_r13),
+instr(addi_r24_r14),
+instr(addi_r24_r15),
+instr(addi_r24_r16),
+instr(addi_r24_r17),
+instr(addi_r24_r18),
+instr(addi_r24_r19),
+instr(addi_r24_r20),
+instr(addi_r24_r21),
+instr(addi_r24_r22),
+instr(addi_r24_r23),
+instr(addi_r24_r24),
+instr(addi_r24_r25),
+instr(addi_r24_r26),
+instr(addi_r24_r27),
+instr(addi_r24_r28),
+instr(addi_r24_r29),
+instr(addi_r24_r30),
+instr(addi_r24_r31),
+instr(addi_r25_r0),
+instr(addi_r25_r1),
+instr(addi_r25_r2),
+instr(addi_r25_r3),
+instr(addi_r25_r4),
+instr(addi_r25_r5),
+instr(addi_r25_r6),
+instr(addi_r25_r7),
+instr(addi_r25_r8),
+instr(addi_r25_r9),
+instr(addi_r25_r10),
+instr(addi_r25_r11),
+instr(addi_r25_r12),
+instr(addi_r25_r13),
+instr(addi_r25_r14),
+instr(addi_r25_r15),
+instr(addi_r25_r16),
+instr(addi_r25_r17),
+instr(addi_r25_r18),
+instr(addi_r25_r19),
+instr(addi_r25_r20),
+instr(addi_r25_r21),
+instr(addi_r25_r22),
+instr(addi_r25_r23),
+instr(addi_r25_r24),
+instr(addi_r25_r25),
+instr(addi_r25_r26),
+instr(addi_r25_r27),
+instr(addi_r25_r28),
+instr(addi_r25_r29),
+instr(addi_r25_r30),
+instr(addi_r25_r31),
+instr(addi_r26_r0),
+instr(addi_r26_r1),
+instr(addi_r26_r2),
+instr(addi_r26_r3),
+instr(addi_r26_r4),
+instr(addi_r26_r5),
+instr(addi_r26_r6),
+instr(addi_r26_r7),
+instr(addi_r26_r8),
+instr(addi_r26_r9),
+instr(addi_r26_r10),
+instr(addi_r26_r11),
+instr(addi_r26_r12),
+instr(addi_r26_r13),
+instr(addi_r26_r14),
+instr(addi_r26_r15),
+instr(addi_r26_r16),
+instr(addi_r26_r17),
+instr(addi_r26_r18),
+instr(addi_r26_r19),
+instr(addi_r26_r20),
+instr(addi_r26_r21),
+instr(addi_r26_r22),
+instr(addi_r26_r23),
+instr(addi_r26_r24),
+instr(addi_r26_r25),
+instr(addi_r26_r26),
+instr(addi_r26_r27),
+instr(addi_r26_r28),
+instr(addi_r26_r29),
+instr(addi_r26_r30),
+instr(addi_r26_r31),
+instr(addi_r27_r0),
+instr(addi_r27_r1),
+instr(addi_r27_r2),
+instr(addi_r27_r3),
+instr(addi_r27_r4),
+instr(addi_r27_r5),
+instr(addi_r27_r6),
+instr(addi_r27_r7),
+instr(addi_r27_r8),
+instr(addi_r27_r9),
+instr(addi_r27_r10),
+instr(addi_r27_r11),
+instr(addi_r27_r12),
+instr(addi_r27_r13),
+instr(addi_r27_r14),
+instr(addi_r27_r15),
+instr(addi_r27_r16),
+instr(addi_r27_r17),
+instr(addi_r27_r18),
+instr(addi_r27_r19),
+instr(addi_r27_r20),
+instr(addi_r27_r21),
+instr(addi_r27_r22),
+instr(addi_r27_r23),
+instr(addi_r27_r24),
+instr(addi_r27_r25),
+instr(addi_r27_r26),
+instr(addi_r27_r27),
+instr(addi_r27_r28),
+instr(addi_r27_r29),
+instr(addi_r27_r30),
+instr(addi_r27_r31),
+instr(addi_r28_r0),
+instr(addi_r28_r1),
+instr(addi_r28_r2),
+instr(addi_r28_r3),
+instr(addi_r28_r4),
+instr(addi_r28_r5),
+instr(addi_r28_r6),
+instr(addi_r28_r7),
+instr(addi_r28_r8),
+instr(addi_r28_r9),
+instr(addi_r28_r10),
+instr(addi_r28_r11),
+instr(addi_r28_r12),
+instr(addi_r28_r13),
+instr(addi_r28_r14),
+instr(addi_r28_r15),
+instr(addi_r28_r16),
+instr(addi_r28_r17),
+instr(addi_r28_r18),
+instr(addi_r28_r19),
+instr(addi_r28_r20),
+instr(addi_r28_r21),
+instr(addi_r28_r22),
+instr(addi_r28_r23),
+instr(addi_r28_r24),
+instr(addi_r28_r25),
+instr(addi_r28_r26),
+instr(addi_r28_r27),
+instr(addi_r28_r28),
+instr(addi_r28_r29),
+instr(addi_r28_r30),
+instr(addi_r28_r31),
+instr(addi_r29_r0),
+instr(addi_r29_r1),
+instr(addi_r29_r2),
+instr(addi_r29_r3),
+instr(addi_r29_r4),
+instr(addi_r29_r5),
+instr(addi_r29_r6),
+instr(addi_r29_r7),
+instr(addi_r29_r8),
+instr(addi_r29_r9),
+instr(addi_r29_r10),
+instr(addi_r29_r11),
+instr(addi_r29_r12),
+instr(addi_r29_r13),
+instr(addi_r29_r14),
+instr(addi_r29_r15),
+instr(addi_r29_r16),
+instr(addi_r29_r17),
+instr(addi_r29_r18),
+instr(addi_r29_r19),
+instr(addi_r29_r20),
+instr(addi_r29_r21),
+instr(addi_r29_r22),
+instr(addi_r29_r23),
+instr(addi_r29_r24),
+instr(addi_r29_r25),
+instr(addi_r29_r26),
+instr(addi_r29_r27),
+instr(addi_r29_r28),
+instr(addi_r29_r29),
+instr(addi_r29_r30),
+instr(addi_r29_r31),
+instr(addi_r30_r0),
+instr(addi_r30_r1),
+instr(addi_r30_r2),
+instr(addi_r30_r3),
+instr(addi_r30_r4),
+instr(addi_r30_r5),
+instr(addi_r30_r6),
+instr(addi_r30_r7),
+instr(addi_r30_r8),
+instr(addi_r30_r9),
+instr(addi_r30_r10),
+instr(addi_r30_r11),
+instr(addi_r30_r12),
+instr(addi_r30_r13),
+instr(addi_r30_r14),
+instr(addi_r30_r15),
+instr(addi_r30_r16),
+instr(addi_r30_r17),
+instr(addi_r30_r18),
+instr(addi_r30_r19),
+instr(addi_r30_r20),
+instr(addi_r30_r21),
+instr(addi_r30_r22),
+instr(addi_r30_r23),
+instr(addi_r30_r24),
+instr(addi_r30_r25),
+instr(addi_r30_r26),
+instr(addi_r30_r27),
+instr(addi_r30_r28),
+instr(addi_r30_r29),
+instr(addi_r30_r30),
+instr(addi_r30_r31),
+instr(addi_r31_r0),
+instr(addi_r31_r1),
+instr(addi_r31_r2),
+instr(addi_r31_r3),
+instr(addi_r31_r4),
+instr(addi_r31_r5),
+instr(addi_r31_r6),
+instr(addi_r31_r7),
+instr(addi_r31_r8),
+instr(addi_r31_r9),
+instr(addi_r31_r10),
+instr(addi_r31_r11),
+instr(addi_r31_r12),
+instr(addi_r31_r13),
+instr(addi_r31_r14),
+instr(addi_r31_r15),
+instr(addi_r31_r16),
+instr(addi_r31_r17),
+instr(addi_r31_r18),
+instr(addi_r31_r19),
+instr(addi_r31_r20),
+instr(addi_r31_r21),
+instr(addi_r31_r22),
+instr(addi_r31_r23),
+instr(addi_r31_r24),
+instr(addi_r31_r25),
+instr(addi_r31_r26),
+instr(addi_r31_r27),
+instr(addi_r31_r28),
+instr(addi_r31_r29),
+instr(addi_r31_r30),
+instr(addi_r31_r31) };
+
+void (*instr(alu_mr)[1024])(struct cpu *, struct ppc_instr_call *) = {
+instr(mr_r0_r0),
+instr(mr_r0_r1),
+instr(mr_r0_r2),
+instr(mr_r0_r3),
+instr(mr_r0_r4),
+instr(mr_r0_r5),
+instr(mr_r0_r6),
+instr(mr_r0_r7),
+instr(mr_r0_r8),
+instr(mr_r0_r9),
+instr(mr_r0_r10),
+instr(mr_r0_r11),
+instr(mr_r0_r12),
+instr(mr_r0_r13),
+instr(mr_r0_r14),
+instr(mr_r0_r15),
+instr(mr_r0_r16),
+instr(mr_r0_r17),
+instr(mr_r0_r18),
+instr(mr_r0_r19),
+instr(mr_r0_r20),
+instr(mr_r0_r21),
+instr(mr_r0_r22),
+instr(mr_r0_r23),
+instr(mr_r0_r24),
+instr(mr_r0_r25),
+instr(mr_r0_r26),
+instr(mr_r0_r27),
+instr(mr_r0_r28),
+instr(mr_r0_r29),
+instr(mr_r0_r30),
+instr(mr_r0_r31),
+instr(mr_r1_r0),
+instr(mr_r1_r1),
+instr(mr_r1_r2),
+instr(mr_r1_r3),
+instr(mr_r1_r4),
+instr(mr_r1_r5),
+instr(mr_r1_r6),
+instr(mr_r1_r7),
+instr(mr_r1_r8),
+instr(mr_r1_r9),
+instr(mr_r1_r10),
+instr(mr_r1_r11),
+instr(mr_r1_r12),
+instr(mr_r1_r13),
+instr(mr_r1_r14),
+instr(mr_r1_r15),
+instr(mr_r1_r16),
+instr(mr_r1_r17),
+instr(mr_r1_r18),
+instr(mr_r1_r19),
+instr(mr_r1_r20),
+instr(mr_r1_r21),
+instr(mr_r1_r22),
+instr(mr_r1_r23),
+instr(mr_r1_r24),
+instr(mr_r1_r25),
+instr(mr_r1_r26),
+instr(mr_r1_r27),
+instr(mr_r1_r28),
+instr(mr_r1_r29),
+instr(mr_r1_r30),
+instr(mr_r1_r31),
+instr(mr_r2_r0),
+instr(mr_r2_r1),
+instr(mr_r2_r2),
+instr(mr_r2_r3),
+instr(mr_r2_r4),
+instr(mr_r2_r5),
+instr(mr_r2_r6),
+instr(mr_r2_r7),
+instr(mr_r2_r8),
+instr(mr_r2_r9),
+instr(mr_r2_r10),
+instr(mr_r2_r11),
+instr(mr_r2_r12),
+instr(mr_r2_r13),
+instr(mr_r2_r14),
+instr(mr_r2_r15),
+instr(mr_r2_r16),
+instr(mr_r2_r17),
+instr(mr_r2_r18),
+instr(mr_r2_r19),
+instr(mr_r2_r20),
+instr(mr_r2_r21),
+instr(mr_r2_r22),
+instr(mr_r2_r23),
+instr(mr_r2_r24),
+instr(mr_r2_r25),
+instr(mr_r2_r26),
+instr(mr_r2_r27),
+instr(mr_r2_r28),
+instr(mr_r2_r29),
+instr(mr_r2_r30),
+instr(mr_r2_r31),
+instr(mr_r3_r0),
+instr(mr_r3_r1),
+instr(mr_r3_r2),
+instr(mr_r3_r3),
+instr(mr_r3_r4),
+instr(mr_r3_r5),
+instr(mr_r3_r6),
+instr(mr_r3_r7),
+instr(mr_r3_r8),
+instr(mr_r3_r9),
+instr(mr_r3_r10),
+instr(mr_r3_r11),
+instr(mr_r3_r12),
+instr(mr_r3_r13),
+instr(mr_r3_r14),
+instr(mr_r3_r15),
+instr(mr_r3_r16),
+instr(mr_r3_r17),
+instr(mr_r3_r18),
+instr(mr_r3_r19),
+instr(mr_r3_r20),
+instr(mr_r3_r21),
+instr(mr_r3_r22),
+instr(mr_r3_r23),
+instr(mr_r3_r24),
+instr(mr_r3_r25),
+instr(mr_r3_r26),
+instr(mr_r3_r27),
+instr(mr_r3_r28),
+instr(mr_r3_r29),
+instr(mr_r3_r30),
+instr(mr_r3_r31),
+instr(mr_r4_r0),
+instr(mr_r4_r1),
+instr(mr_r4_r2),
+instr(mr_r4_r3),
+instr(mr_r4_r4),
+instr(mr_r4_r5),
+instr(mr_r4_r6),
+instr(mr_r4_r7),
+instr(mr_r4_r8),
+instr(mr_r4_r9),
+instr(mr_r4_r10),
+instr(mr_r4_r11),
+instr(mr_r4_r12),
+instr(mr_r4_r13),
+instr(mr_r4_r14),
+instr(mr_r4_r15),
+instr(mr_r4_r16),
+instr(mr_r4_r17),
+instr(mr_r4_r18),
+instr(mr_r4_r19),
+instr(mr_r4_r20),
+instr(mr_r4_r21),
+instr(mr_r4_r22),
+instr(mr_r4_r23),
+instr(mr_r4_r24),
+instr(mr_r4_r25),
+instr(mr_r4_r26),
+instr(mr_r4_r27),
+instr(mr_r4_r28),
+instr(mr_r4_r29),
+instr(mr_r4_r30),
+instr(mr_r4_r31),
+instr(mr_r5_r0),
+instr(mr_r5_r1),
+instr(mr_r5_r2),
+instr(mr_r5_r3),
+instr(mr_r5_r4),
+instr(mr_r5_r5),
+instr(mr_r5_r6),
+instr(mr_r5_r7),
+instr(mr_r5_r8),
+instr(mr_r5_r9),
+instr(mr_r5_r10),
+instr(mr_r5_r11),
+instr(mr_r5_r12),
+instr(mr_r5_r13),
+instr(mr_r5_r14),
+instr(mr_r5_r15),
+instr(mr_r5_r16),
+instr(mr_r5_r17),
+instr(mr_r5_r18),
+instr(mr_r5_r19),
+instr(mr_r5_r20),
+instr(mr_r5_r21),
+instr(mr_r5_r22),
+instr(mr_r5_r23),
+instr(mr_r5_r24),
+instr(mr_r5_r25),
+instr(mr_r5_r26),
+instr(mr_r5_r27),
+instr(mr_r5_r28),
+instr(mr_r5_r29),
+instr(mr_r5_r30),
+instr(mr_r5_r31),
+instr(mr_r6_r0),
+instr(mr_r6_r1),
+instr(mr_r6_r2),
+instr(mr_r6_r3),
+instr(mr_r6_r4),
+instr(mr_r6_r5),
+instr(mr_r6_r6),
+instr(mr_r6_r7),
+instr(mr_r6_r8),
+instr(mr_r6_r9),
+instr(mr_r6_r10),
+instr(mr_r6_r11),
+instr(mr_r6_r12),
+instr(mr_r6_r13),
+instr(mr_r6_r14),
+instr(mr_r6_r15),
+instr(mr_r6_r16),
+instr(mr_r6_r17),
+instr(mr_r6_r18),
+instr(mr_r6_r19),
+instr(mr_r6_r20),
+instr(mr_r6_r21),
+instr(mr_r6_r22),
+instr(mr_r6_r23),
+instr(mr_r6_r24),
+instr(mr_r6_r25),
+instr(mr_r6_r26),
+instr(mr_r6_r27),
+instr(mr_r6_r28),
+instr(mr_r6_r29),
+instr(mr_r6_r30),
+instr(mr_r6_r31),
+instr(mr_r7_r0),
+instr(mr_r7_r1),
+instr(mr_r7_r2),
+instr(mr_r7_r3),
+instr(mr_r7_r4),
+instr(mr_r7_r5),
+instr(mr_r7_r6),
+instr(mr_r7_r7),
+instr(mr_r7_r8),
+instr(mr_r7_r9),
+instr(mr_r7_r10),
+instr(mr_r7_r11),
+instr(mr_r7_r12),
+instr(mr_r7_r13),
+instr(mr_r7_r14),
+instr(mr_r7_r15),
+instr(mr_r7_r16),
+instr(mr_r7_r17),
+instr(mr_r7_r18),
+instr(mr_r7_r19),
+instr(mr_r7_r20),
+instr(mr_r7_r21),
+instr(mr_r7_r22),
+instr(mr_r7_r23),
+instr(mr_r7_r24),
+instr(mr_r7_r25),
+instr(mr_r7_r26),
+instr(mr_r7_r27),
+instr(mr_r7_r28),
+instr(mr_r7_r29),
+instr(mr_r7_r30),
+instr(mr_r7_r31),
+instr(mr_r8_r0),
+instr(mr_r8_r1),
+instr(mr_r8_r2),
+instr(mr_r8_r3),
+instr(mr_r8_r4),
+instr(mr_r8_r5),
+instr(mr_r8_r6),
+instr(mr_r8_r7),
+instr(mr_r8_r8),
+instr(mr_r8_r9),
+instr(mr_r8_r10),
+instr(mr_r8_r11),
+instr(mr_r8_r12),
+instr(mr_r8_r13),
+instr(mr_r8_r14),
+instr(mr_r8_r15),
+instr(mr_r8_r16),
+instr(mr_r8_r17),
+instr(mr_r8_r18),
+instr(mr_r8_r19),
+instr(mr_r8_r20),
+instr(mr_r8_r21),
+instr(mr_r8_r22),
+instr(mr_r8_r23),
+instr(mr_r8_r24),
+instr(mr_r8_r25),
+instr(mr_r8_r26),
+instr(mr_r8_r27),
+instr(mr_r8_r28),
+instr(mr_r8_r29),
+instr(mr_r8_r30),
+instr(mr_r8_r31),
+instr(mr_r9_r0),
+instr(mr_r9_r1),
+instr(mr_r9_r2),
+instr(mr_r9_r3),
+instr(mr_r9_r4),
+instr(mr_r9_r5),
+instr(mr_r9_r6),
+instr(mr_r9_r7),
+instr(mr_r9_r8),
+instr(mr_r9_r9),
+instr(mr_r9_r10),
+instr(mr_r9_r11),
+instr(mr_r9_r12),
+instr(mr_r9_r13),
+instr(mr_r9_r14),
+instr(mr_r9_r15),
+instr(mr_r9_r16),
+instr(mr_r9_r17),
+instr(mr_r9_r18),
+instr(mr_r9_r19),
+instr(mr_r9_r20),
+instr(mr_r9_r21),
+instr(mr_r9_r22),
+instr(mr_r9_r23),
+instr(mr_r9_r24),
+instr(mr_r9_r25),
+instr(mr_r9_r26),
+instr(mr_r9_r27),
+instr(mr_r9_r28),
+instr(mr_r9_r29),
+instr(mr_r9_r30),
+instr(mr_r9_r31),
+instr(mr_r10_r0),
+instr(mr_r10_r1),
+instr(mr_r10_r2),
+instr(mr_r10_r3),
+instr(mr_r10_r4),
+instr(mr_r10_r5),
+instr(mr_r10_r6),
+instr(mr_r10_r7),
+instr(mr_r10_r8),
+instr(mr_r10_r9),
+instr(mr_r10_r10),
+instr(mr_r10_r11),
+instr(mr_r10_r12),
+instr(mr_r10_r13),
+instr(mr_r10_r14),
+instr(mr_r10_r15),
+instr(mr_r10_r16),
+instr(mr_r10_r17),
+instr(mr_r10_r18),
+instr(mr_r10_r19),
+instr(mr_r10_r20),
+instr(mr_r10_r21),
+instr(mr_r10_r22),
+instr(mr_r10_r23),
+instr(mr_r10_r24),
+instr(mr_r10_r25),
+instr(mr_r10_r26),
+instr(mr_r10_r27),
+instr(mr_r10_r28),
+instr(mr_r10_r29),
+instr(mr_r10_r30),
+instr(mr_r10_r31),
+instr(mr_r11_r0),
+instr(mr_r11_r1),
+instr(mr_r11_r2),
+instr(mr_r11_r3),
+instr(mr_r11_r4),
+instr(mr_r11_r5),
+instr(mr_r11_r6),
+instr(mr_r11_r7),
+instr(mr_r11_r8),
+instr(mr_r11_r9),
+instr(mr_r11_r10),
+instr(mr_r11_r11),
+instr(mr_r11_r12),
+instr(mr_r11_r13),
+instr(mr_r11_r14),
+instr(mr_r11_r15),
+instr(mr_r11_r16),
+instr(mr_r11_r17),
+instr(mr_r11_r18),
+instr(mr_r11_r19),
+instr(mr_r11_r20),
+instr(mr_r11_r21),
+instr(mr_r11_r22),
+instr(mr_r11_r23),
+instr(mr_r11_r24),
+instr(mr_r11_r25),
+instr(mr_r11_r26),
+instr(mr_r11_r27),
+instr(mr_r11_r28),
+instr(mr_r11_r29),
+instr(mr_r11_r30),
+instr(mr_r11_r31),
+instr(mr_r12_r0),
+instr(mr_r12_r1),
+instr(mr_r12_r2),
+instr(mr_r12_r3),
+instr(mr_r12_r4),
+instr(mr_r12_r5),
+instr(mr_r12_r6),
+instr(mr_r12_r7),
+instr(mr_r12_r8),
+instr(mr_r12_r9),
+instr(mr_r12_r10),
+instr(mr_r12_r11),
+instr(mr_r12_r12),
+instr(mr_r12_r13),
+instr(mr_r12_r14),
+instr(mr_r12_r15),
+instr(mr_r12_r16),
+instr(mr_r12_r17),
+instr(mr_r12_r18),
+instr(mr_r12_r19),
+instr(mr_r12_r20),
+instr(mr_r12_r21),
+instr(mr_r12_r22),
+instr(mr_r12_r23),
+instr(mr_r12_r24),
+instr(mr_r12_r25),
+instr(mr_r12_r26),
+instr(mr_r12_r27),
+instr(mr_r12_r28),
+instr(mr_r12_r29),
+instr(mr_r12_r30),
+instr(mr_r12_r31),
+instr(mr_r13_r0),
+instr(mr_r13_r1),
+instr(mr_r13_r2),
+instr(mr_r13_r3),
+instr(mr_r13_r4),
+instr(mr_r13_r5),
+instr(mr_r13_r6),
+instr(mr_r13_r7),
+instr(mr_r13_r8),
+instr(mr_r13_r9),
+instr(mr_r13_r10),
+instr(mr_r13_r11),
+instr(mr_r13_r12),
+instr(mr_r13_r13),
+instr(mr_r13_r14),
+instr(mr_r13_r15),
+instr(mr_r13_r16),
+instr(mr_r13_r17),
+instr(mr_r13_r18),
+instr(mr_r13_r19),
+instr(mr_r13_r20),
+instr(mr_r13_r21),
+instr(mr_r13_r22),
+instr(mr_r13_r23),
+instr(mr_r13_r24),
+instr(mr_r13_r25),
+instr(mr_r13_r26),
+instr(mr_r13_r27),
+instr(mr_r13_r28),
+instr(mr_r13_r29),
+instr(mr_r13_r30),
+instr(mr_r13_r31),
+instr(mr_r14_r0),
+instr(mr_r14_r1),
+instr(mr_r14_r2),
+instr(mr_r14_r3),
+instr(mr_r14_r4),
+instr(mr_r14_r5),
+instr(mr_r14_r6),
+instr(mr_r14_r7),
+instr(mr_r14_r8),
+instr(mr_r14_r9),
+instr(mr_r14_r10),
+instr(mr_r14_r11),
+instr(mr_r14_r12),
+instr(mr_r14_r13),
+instr(mr_r14_r14),
+instr(mr_r14_r15),
+instr(mr_r14_r16),
+instr(mr_r14_r17),
+instr(mr_r14_r18),
+instr(mr_r14_r19),
+instr(mr_r14_r20),
+instr(mr_r14_r21),
+instr(mr_r14_r22),
+instr(mr_r14_r23),
+instr(mr_r14_r24),
+instr(mr_r14_r25),
+instr(mr_r14_r26),
+instr(mr_r14_r27),
+instr(mr_r14_r28),
+instr(mr_r14_r29),
+instr(mr_r14_r30),
+instr(mr_r14_r31),
+instr(mr_r15_r0),
+instr(mr_r15_r1),
+instr(mr_r15_r2),
+instr(mr_r15_r3),
+instr(mr_r15_r4),
+instr(mr_r15_r5),
+instr(mr_r15_r6),
+instr(mr_r15_r7),
+instr(mr_r15_r8),
+instr(mr_r15_r9),
+instr(mr_r15_r10),
+instr(mr_r15_r11),
+instr(mr_r15_r12),
+instr(mr_r15_r13),
+instr(mr_r15_r14),
+instr(mr_r15_r15),
+instr(mr_r15_r16),
+instr(mr_r15_r17),
+instr(mr_r15_r18),
+instr(mr_r15_r19),
+instr(mr_r15_r20),
+instr(mr_r15_r21),
+instr(mr_r15_r22),
+instr(mr_r15_r23),
+instr(mr_r15_r24),
+instr(mr_r15_r25),
+instr(mr_r15_r26),
+instr(mr_r15_r27),
+instr(mr_r15_r28),
+instr(mr_r15_r29),
+instr(mr_r15_r30),
+instr(mr_r15_r31),
+instr(mr_r16_r0),
+instr(mr_r16_r1),
+instr(mr_r16_r2),
+instr(mr_r16_r3),
+instr(mr_r16_r4),
+instr(mr_r16_r5),
+instr(mr_r16_r6),
+instr(mr_r16_r7),
+instr(mr_r16_r8),
+instr(mr_r16_r9),
+instr(mr_r16_r10),
+instr(mr_r16_r11),
+instr(mr_r16_r12),
+instr(mr_r16_r13),
+instr(mr_r16_r14),
+instr(mr_r16_r15),
+instr(mr_r16_r16),
+instr(mr_r16_r17),
+instr(mr_r16_r18),
+instr(mr_r16_r19),
+instr(mr_r16_r20),
+instr(mr_r16_r21),
+instr(mr_r16_r22),
+instr(mr_r16_r23),
+instr(mr_r16_r24),
+instr(mr_r16_r25),
+instr(mr_r16_r26),
+instr(mr_r16_r27),
+instr(mr_r16_r28),
+instr(mr_r16_r29),
+instr(mr_r16_r30),
+instr(mr_r16_r31),
+instr(mr_r17_r0),
+instr(mr_r17_r1),
+instr(mr_r17_r2),
+instr(mr_r17_r3),
+instr(mr_r17_r4),
+instr(mr_r17_r5),
+instr(mr_r17_r6),
+instr(mr_r17_r7),
+instr(mr_r17_r8),
+instr(mr_r17_r9),
+instr(mr_r17_r10),
+instr(mr_r17_r11),
+instr(mr_r17_r12),
+instr(mr_r17_r13),
+instr(mr_r17_r14),
+instr(mr_r17_r15),
+instr(mr_r17_r16),
+instr(mr_r17_r17),
+instr(mr_r17_r18),
+instr(mr_r17_r19),
+instr(mr_r17_r20),
+instr(mr_r17_r21),
+instr(mr_r17_r22),
+instr(mr_r17_r23),
+instr(mr_r17_r24),
+instr(mr_r17_r25),
+instr(mr_r17_r26),
+instr(mr_r17_r27),
+instr(mr_r17_r28),
+instr(mr_r17_r29),
+instr(mr_r17_r30),
+instr(mr_r17_r31),
+instr(mr_r18_r0),
+instr(mr_r18_r1),
+instr(mr_r18_r2),
+instr(mr_r18_r3),
+instr(mr_r18_r4),
+instr(mr_r18_r5),
+instr(mr_r18_r6),
+instr(mr_r18_r7),
+instr(mr_r18_r8),
+instr(mr_r18_r9),
+instr(mr_r18_r10),
+instr(mr_r18_r11),
+instr(mr_r18_r12),
+instr(mr_r18_r13),
+instr(mr_r18_r14),
+instr(mr_r18_r15),
+instr(mr_r18_r16),
+instr(mr_r18_r17),
+instr(mr_r18_r18),
+instr(mr_r18_r19),
+instr(mr_r18_r20),
+instr(mr_r18_r21),
+instr(mr_r18_r22),
+instr(mr_r18_r23),
+instr(mr_r18_r24),
+instr(mr_r18_r25),
+instr(mr_r18_r26),
+instr(mr_r18_r27),
+instr(mr_r18_r28),
+instr(mr_r18_r29),
+instr(mr_r18_r30),
+instr(mr_r18_r31),
+instr(mr_r19_r0),
+instr(mr_r19_r1),
+instr(mr_r19_r2),
+instr(mr_r19_r3),
+instr(mr_r19_r4),
+instr(mr_r19_r5),
+instr(mr_r19_r6),
+instr(mr_r19_r7),
+instr(mr_r19_r8),
+instr(mr_r19_r9),
+instr(mr_r19_r10),
+instr(mr_r19_r11),
+instr(mr_r19_r12),
+instr(mr_r19_r13),
+instr(mr_r19_r14),
+instr(mr_r19_r15),
+instr(mr_r19_r16),
+instr(mr_r19_r17),
+instr(mr_r19_r18),
+instr(mr_r19_r19),
+instr(mr_r19_r20),
+instr(mr_r19_r21),
+instr(mr_r19_r22),
+instr(mr_r19_r23),
+instr(mr_r19_r24),
+instr(mr_r19_r25),
+instr(mr_r19_r26),
+instr(mr_r19_r27),
+instr(mr_r19_r28),
+instr(mr_r19_r29),
+instr(mr_r19_r30),
+instr(mr_r19_r31),
+instr(mr_r20_r0),
+instr(mr_r20_r1),
+instr(mr_r20_r2),
+instr(mr_r20_r3),
+instr(mr_r20_r4),
+instr(mr_r20_r5),
+instr(mr_r20_r6),
+instr(mr_r20_r7),
+instr(mr_r20_r8),
+instr(mr_r20_r9),
+instr(mr_r20_r10),
+instr(mr_r20_r11),
+instr(mr_r20_r12),
+instr(mr_r20_r13),
+instr(mr_r20_r14),
+instr(mr_r20_r15),
+instr(mr_r20_r16),
+instr(mr_r20_r17),
+instr(mr_r20_r18),
+instr(mr_r20_r19),
+instr(mr_r20_r20),
+instr(mr_r20_r21),
+instr(mr_r20_r22),
+instr(mr_r20_r23),
+instr(mr_r20_r24),
+instr(mr_r20_r25),
+instr(mr_r20_r26),
+instr(mr_r20_r27),
+instr(mr_r20_r28),
+instr(mr_r20_r29),
+instr(mr_r20_r30),
+instr(mr_r20_r31),
+instr(mr_r21_r0),
+instr(mr_r21_r1),
+instr(mr_r21_r2),
+instr(mr_r21_r3),
+instr(mr_r21_r4),
+instr(mr_r21_r5),
+instr(mr_r21_r6),
+instr(mr_r21_r7),
+instr(mr_r21_r8),
+instr(mr_r21_r9),
+instr(mr_r21_r10),
+instr(mr_r21_r11),
+instr(mr_r21_r12),
+instr(mr_r21_r13),
+instr(mr_r21_r14),
+instr(mr_r21_r15),
+instr(mr_r21_r16),
+instr(mr_r21_r17),
+instr(mr_r21_r18),
+instr(mr_r21_r19),
+instr(mr_r21_r20),
+instr(mr_r21_r21),
+instr(mr_r21_r22),
+instr(mr_r21_r23),
+instr(mr_r21_r24),
+instr(mr_r21_r25),
+instr(mr_r21_r26),
+instr(mr_r21_r27),
+instr(mr_r21_r28),
+instr(mr_r21_r29),
+instr(mr_r21_r30),
+instr(mr_r21_r31),
+instr(mr_r22_r0),
+instr(mr_r22_r1),
+instr(mr_r22_r2),
+instr(mr_r22_r3),
+instr(mr_r22_r4),
+instr(mr_r22_r5),
+instr(mr_r22_r6),
+instr(mr_r22_r7),
+instr(mr_r22_r8),
+instr(mr_r22_r9),
+instr(mr_r22_r10),
+instr(mr_r22_r11),
+instr(mr_r22_r12),
+instr(mr_r22_r13),
+instr(mr_r22_r14),
+instr(mr_r22_r15),
+instr(mr_r22_r16),
+instr(mr_r22_r17),
+instr(mr_r22_r18),
+instr(mr_r22_r19),
+instr(mr_r22_r20),
+instr(mr_r22_r21),
+instr(mr_r22_r22),
+instr(mr_r22_r23),
+instr(mr_r22_r24),
+instr(mr_r22_r25),
+instr(mr_r22_r26),
+instr(mr_r22_r27),
+instr(mr_r22_r28),
+instr(mr_r22_r29),
+instr(mr_r22_r30),
+instr(mr_r22_r31),
+instr(mr_r23_r0),
+instr(mr_r23_r1),
+instr(mr_r23_r2),
+instr(mr_r23_r3),
+instr(mr_r23_r4),
+instr(mr_r23_r5),
+instr(mr_r23_r6),
+instr(mr_r23_r7),
+instr(mr_r23_r8),
+instr(mr_r23_r9),
+instr(mr_r23_r10),
+instr(mr_r23_r11),
+instr(mr_r23_r12),
+instr(mr_r23_r13),
+instr(mr_r23_r14),
+instr(mr_r23_r15),
+instr(mr_r23_r16),
+instr(mr_r23_r17),
+instr(mr_r23_r18),
+instr(mr_r23_r19),
+instr(mr_r23_r20),
+instr(mr_r23_r21),
+instr(mr_r23_r22),
+instr(mr_r23_r23),
+instr(mr_r23_r24),
+instr(mr_r23_r25),
+instr(mr_r23_r26),
+instr(mr_r23_r27),
+instr(mr_r23_r28),
+instr(mr_r23_r29),
+instr(mr_r23_r30),
+instr(mr_r23_r31),
+instr(mr_r24_r0),
+instr(mr_r24_r1),
+instr(mr_r24_r2),
+instr(mr_r24_r3),
+instr(mr_r24_r4),
+instr(mr_r24_r5),
+instr(mr_r24_r6),
+instr(mr_r24_r7),
+instr(mr_r24_r8),
+instr(mr_r24_r9),
+instr(mr_r24_r10),
+instr(mr_r24_r11),
+instr(mr_r24_r12),
+instr(mr_r24_r13),
+instr(mr_r24_r14),
+instr(mr_r24_r15),
+instr(mr_r24_r16),
+instr(mr_r24_r17),
+instr(mr_r24_r18),
+instr(mr_r24_r19),
+instr(mr_r24_r20),
+instr(mr_r24_r21),
+instr(mr_r24_r22),
+instr(mr_r24_r23),
+instr(mr_r24_r24),
+instr(mr_r24_r25),
+instr(mr_r24_r26),
+instr(mr_r24_r27),
+instr(mr_r24_r28),
+instr(mr_r24_r29),
+instr(mr_r24_r30),
+instr(mr_r24_r31),
+instr(mr_r25_r0),
+instr(mr_r25_r1),
+instr(mr_r25_r2),
+instr(mr_r25_r3),
+instr(mr_r25_r4),
+instr(mr_r25_r5),
+instr(mr_r25_r6),
+instr(mr_r25_r7),
+instr(mr_r25_r8),
+instr(mr_r25_r9),
+instr(mr_r25_r10),
+instr(mr_r25_r11),
+instr(mr_r25_r12),
+instr(mr_r25_r13),
+instr(mr_r25_r14),
+instr(mr_r25_r15),
+instr(mr_r25_r16),
+instr(mr_r25_r17),
+instr(mr_r25_r18),
+instr(mr_r25_r19),
+instr(mr_r25_r20),
+instr(mr_r25_r21),
+instr(mr_r25_r22),
+instr(mr_r25_r23),
+instr(mr_r25_r24),
+instr(mr_r25_r25),
+instr(mr_r25_r26),
+instr(mr_r25_r27),
+instr(mr_r25_r28),
+instr(mr_r25_r29),
+instr(mr_r25_r30),
+instr(mr_r25_r31),
+instr(mr_r26_r0),
+instr(mr_r26_r1),
+instr(mr_r26_r2),
+instr(mr_r26_r3),
+instr(mr_r26_r4),
+instr(mr_r26_r5),
+instr(mr_r26_r6),
+instr(mr_r26_r7),
+instr(mr_r26_r8),
+instr(mr_r26_r9),
+instr(mr_r26_r10),
+instr(mr_r26_r11),
+instr(mr_r26_r12),
+instr(mr_r26_r13),
+instr(mr_r26_r14),
+instr(mr_r26_r15),
+instr(mr_r26_r16),
+instr(mr_r26_r17),
+instr(mr_r26_r18),
+instr(mr_r26_r19),
+instr(mr_r26_r20),
+instr(mr_r26_r21),
+instr(mr_r26_r22),
+instr(mr_r26_r23),
+instr(mr_r26_r24),
+instr(mr_r26_r25),
+instr(mr_r26_r26),
+instr(mr_r26_r27),
+instr(mr_r26_r28),
+instr(mr_r26_r29),
+instr(mr_r26_r30),
+instr(mr_r26_r31),
+instr(mr_r27_r0),
+instr(mr_r27_r1),
+instr(mr_r27_r2),
+instr(mr_r27_r3),
+instr(mr_r27_r4),
+instr(mr_r27_r5),
+instr(mr_r27_r6),
+instr(mr_r27_r7),
+instr(mr_r27_r8),
+instr(mr_r27_r9),
+instr(mr_r27_r10),
+instr(mr_r27_r11),
+instr(mr_r27_r12),
+instr(mr_r27_r13),
+instr(mr_r27_r14),
+instr(mr_r27_r15),
+instr(mr_r27_r16),
+instr(mr_r27_r17),
+instr(mr_r27_r18),
+instr(mr_r27_r19),
+instr(mr_r27_r20),
+instr(mr_r27_r21),
+instr(mr_r27_r22),
+instr(mr_r27_r23),
+instr(mr_r27_r24),
+instr(mr_r27_r25),
+instr(mr_r27_r26),
+instr(mr_r27_r27),
+instr(mr_r27_r28),
+instr(mr_r27_r29),
+instr(mr_r27_r30),
+instr(mr_r27_r31),
+instr(mr_r28_r0),
+instr(mr_r28_r1),
+instr(mr_r28_r2),
+instr(mr_r28_r3),
+instr(mr_r28_r4),
+instr(mr_r28_r5),
+instr(mr_r28_r6),
+instr(mr_r28_r7),
+instr(mr_r28_r8),
+instr(mr_r28_r9),
+instr(mr_r28_r10),
+instr(mr_r28_r11),
+instr(mr_r28_r12),
+instr(mr_r28_r13),
+instr(mr_r28_r14),
+instr(mr_r28_r15),
+instr(mr_r28_r16),
+instr(mr_r28_r17),
+instr(mr_r28_r18),
+instr(mr_r28_r19),
+instr(mr_r28_r20),
+instr(mr_r28_r21),
+instr(mr_r28_r22),
+instr(mr_r28_r23),
+instr(mr_r28_r24),
+instr(mr_r28_r25),
+instr(mr_r28_r26),
+instr(mr_r28_r27),
+instr(mr_r28_r28),
+instr(mr_r28_r29),
+instr(mr_r28_r30),
+instr(mr_r28_r31),
+instr(mr_r29_r0),
+instr(mr_r29_r1),
+instr(mr_r29_r2),
+instr(mr_r29_r3),
+instr(mr_r29_r4),
+instr(mr_r29_r5),
+instr(mr_r29_r6),
+instr(mr_r29_r7),
+instr(mr_r29_r8),
+instr(mr_r29_r9),
+instr(mr_r29_r10),
+instr(mr_r29_r11),
+instr(mr_r29_r12),
+instr(mr_r29_r13),
+instr(mr_r29_r14),
+instr(mr_r29_r15),
+instr(mr_r29_r16),
+instr(mr_r29_r17),
+instr(mr_r29_r18),
+instr(mr_r29_r19),
+instr(mr_r29_r20),
+instr(mr_r29_r21),
+instr(mr_r29_r22),
+instr(mr_r29_r23),
+instr(mr_r29_r24),
+instr(mr_r29_r25),
+instr(mr_r29_r26),
+instr(mr_r29_r27),
+instr(mr_r29_r28),
+instr(mr_r29_r29),
+instr(mr_r29_r30),
+instr(mr_r29_r31),
+instr(mr_r30_r0),
+instr(mr_r30_r1),
+instr(mr_r30_r2),
+instr(mr_r30_r3),
+instr(mr_r30_r4),
+instr(mr_r30_r5),
+instr(mr_r30_r6),
+instr(mr_r30_r7),
+instr(mr_r30_r8),
+instr(mr_r30_r9),
+instr(mr_r30_r10),
+instr(mr_r30_r11),
+instr(mr_r30_r12),
+instr(mr_r30_r13),
+instr(mr_r30_r14),
+instr(mr_r30_r15),
+instr(mr_r30_r16),
+instr(mr_r30_r17),
+instr(mr_r30_r18),
+instr(mr_r30_r19),
+instr(mr_r30_r20),
+instr(mr_r30_r21),
+instr(mr_r30_r22),
+instr(mr_r30_r23),
+instr(mr_r30_r24),
+instr(mr_r30_r25),
+instr(mr_r30_r26),
+instr(mr_r30_r27),
+instr(mr_r30_r28),
+instr(mr_r30_r29),
+instr(mr_r30_r30),
+instr(mr_r30_r31),
+instr(mr_r31_r0),
+instr(mr_r31_r1),
+instr(mr_r31_r2),
+instr(mr_r31_r3),
+instr(mr_r31_r4),
+instr(mr_r31_r5),
+instr(mr_r31_r6),
+instr(mr_r31_r7),
+instr(mr_r31_r8),
+instr(mr_r31_r9),
+instr(mr_r31_r10),
+instr(mr_r31_r11),
+instr(mr_r31_r12),
+instr(mr_r31_r13),
+instr(mr_r31_r14),
+instr(mr_r31_r15),
+instr(mr_r31_r16),
+instr(mr_r31_r17),
+instr(mr_r31_r18),
+instr(mr_r31_r19),
+instr(mr_r31_r20),
+instr(mr_r31_r21),
+instr(mr_r31_r22),
+instr(mr_r31_r23),
+instr(mr_r31_r24),
+instr(mr_r31_r25),
+instr(mr_r31_r26),
+instr(mr_r31_r27),
+instr(mr_r31_r28),
+instr(mr_r31_r29),
+instr(mr_r31_r30),
+instr(mr_r31_r31) };
+
+void (*instr(alu_li)[32])(struct cpu *, struct ppc_instr_call *) = {
+instr(li_r0),
+instr(li_r1),
+instr(li_r2),
+instr(li_r3),
+instr(li_r4),
+instr(li_r5),
+instr(li_r6),
+instr(li_r7),
+instr(li_r8),
+instr(li_r9),
+instr(li_r10),
+instr(li_r11),
+instr(li_r12),
+instr(li_r13),
+instr(li_r14),
+instr(li_r15),
+instr(li_r16),
+instr(li_r17),
+instr(li_r18),
+instr(li_r19),
+instr(li_r20),
+instr(li_r21),
+instr(li_r22),
+instr(li_r23),
+instr(li_r24),
+instr(li_r25),
+instr(li_r26),
+instr(li_r27),
+instr(li_r28),
+instr(li_r29),
+instr(li_r30),
+instr(li_r31) };
+
+void (*instr(alu_cmpwi_cr0)[32])(struct cpu *, struct ppc_instr_call *) = {
+instr(cmpwi_cr0_r0),
+instr(cmpwi_cr0_r1),
+instr(cmpwi_cr0_r2),
+instr(cmpwi_cr0_r3),
+instr(cmpwi_cr0_r4),
+instr(cmpwi_cr0_r5),
+instr(cmpwi_cr0_r6),
+instr(cmpwi_cr0_r7),
+instr(cmpwi_cr0_r8),
+instr(cmpwi_cr0_r9),
+instr(cmpwi_cr0_r10),
+instr(cmpwi_cr0_r11),
+instr(cmpwi_cr0_r12),
+instr(cmpwi_cr0_r13),
+instr(cmpwi_cr0_r14),
+instr(cmpwi_cr0_r15),
+instr(cmpwi_cr0_r16),
+instr(cmpwi_cr0_r17),
+instr(cmpwi_cr0_r18),
+instr(cmpwi_cr0_r19),
+instr(cmpwi_cr0_r20),
+instr(cmpwi_cr0_r21),
+instr(cmpwi_cr0_r22),
+instr(cmpwi_cr0_r23),
+instr(cmpwi_cr0_r24),
+instr(cmpwi_cr0_r25),
+instr(cmpwi_cr0_r26),
+instr(cmpwi_cr0_r27),
+instr(cmpwi_cr0_r28),
+instr(cmpwi_cr0_r29),
+instr(cmpwi_cr0_r30),
+instr(cmpwi_cr0_r31) };
+
+void (*instr(alu_bc_samepage_simple0)[32])(struct cpu *, struct ppc_instr_call *) = {
+instr(bc_samepage_simple0_bi0),
+instr(bc_samepage_simple0_bi1),
+instr(bc_samepage_simple0_bi2),
+instr(bc_samepage_simple0_bi3),
+instr(bc_samepage_simple0_bi4),
+instr(bc_samepage_simple0_bi5),
+instr(bc_samepage_simple0_bi6),
+instr(bc_samepage_simple0_bi7),
+instr(bc_samepage_simple0_bi8),
+instr(bc_samepage_simple0_bi9),
+instr(bc_samepage_simple0_bi10),
+instr(bc_samepage_simple0_bi11),
+instr(bc_samepage_simple0_bi12),
+instr(bc_samepage_simple0_bi13),
+instr(bc_samepage_simple0_bi14),
+instr(bc_samepage_simple0_bi15),
+instr(bc_samepage_simple0_bi16),
+instr(bc_samepage_simple0_bi17),
+instr(bc_samepage_simple0_bi18),
+instr(bc_samepage_simple0_bi19),
+instr(bc_samepage_simple0_bi20),
+instr(bc_samepage_simple0_bi21),
+instr(bc_samepage_simple0_bi22),
+instr(bc_samepage_simple0_bi23),
+instr(bc_samepage_simple0_bi24),
+instr(bc_samepage_simple0_bi25),
+instr(bc_samepage_simple0_bi26),
+instr(bc_samepage_simple0_bi27),
+instr(bc_samepage_simple0_bi28),
+instr(bc_samepage_simple0_bi29),
+instr(bc_samepage_simple0_bi30),
+instr(bc_samepage_simple0_bi31) };
+
+void (*instr(alu_bc_samepage_simple1)[32])(struct cpu *, struct ppc_instr_call *) = {
+instr(bc_samepage_simple1_bi0),
+instr(bc_samepage_simple1_bi1),
+instr(bc_samepage_simple1_bi2),
+instr(bc_samepage_simple1_bi3),
+instr(bc_samepage_simple1_bi4),
+instr(bc_samepage_simple1_bi5),
+instr(bc_samepage_simple1_bi6),
+instr(bc_samepage_simple1_bi7),
+instr(bc_samepage_simple1_bi8),
+instr(bc_samepage_simple1_bi9),
+instr(bc_samepage_simple1_bi10),
+instr(bc_samepage_simple1_bi11),
+instr(bc_samepage_simple1_bi12),
+instr(bc_samepage_simple1_bi13),
+instr(bc_samepage_simple1_bi14),
+instr(bc_samepage_simple1_bi15),
+instr(bc_samepage_simple1_bi16),
+instr(bc_samepage_simple1_bi17),
+instr(bc_samepage_simple1_bi18),
+instr(bc_samepage_simple1_bi19),
+instr(bc_samepage_simple1_bi20),
+instr(bc_samepage_simple1_bi21),
+instr(bc_samepage_simple1_bi22),
+instr(bc_samepage_simple1_bi23),
+instr(bc_samepage_simple1_bi24),
+instr(bc_samepage_simple1_bi25),
+instr(bc_samepage_simple1_bi26),
+instr(bc_samepage_simple1_bi27),
+instr(bc_samepage_simple1_bi28),
+instr(bc_samepage_simple1_bi29),
+instr(bc_samepage_simple1_bi30),
+instr(bc_samepage_simple1_bi31) };
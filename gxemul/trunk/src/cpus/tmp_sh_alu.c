@@ -0,0 +1,7887 @@
+
+/*  AUTOMATICALLY GENERATED! Do not edit.  */
+
+X(mov_rm_rn_0_0)
+{
+	cpu->cd.sh.r[0] = cpu->cd.sh.r[0];
+}
+
+X(mov_rm_rn_0_1)
+{
+	cpu->cd.sh.r[1] = cpu->cd.sh.r[0];
+}
+
+X(mov_rm_rn_0_2)
+{
+	cpu->cd.sh.r[2] = cpu->cd.sh.r[0];
+}
+
+X(mov_rm_rn_0_3)
+{
+	cpu->cd.sh.r[3] = cpu->cd.sh.r[0];
+}
+
+X(mov_rm_rn_0_4)
+{
+	cpu->cd.sh.r[4] = cpu->cd.sh.r[0];
+}
+
+X(mov_rm_rn_0_5)
+{
+	cpu->cd.sh.r[5] = cpu->cd.sh.r[0];
+}
+
+X(mov_rm_rn_0_6)
+{
+	cpu->cd.sh.r[6] = cpu->cd.sh.r[0];
+}
+
+X(mov_rm_rn_0_7)
+{
+	cpu->cd.sh.r[7] = cpu->cd.sh.r[0];
+}
+
+X(mov_rm_rn_0_8)
+{
+	cpu->cd.sh.r[8] = cpu->cd.sh.r[0];
+}
+
+X(mov_rm_rn_0_9)
+{
+	cpu->cd.sh.r[9] = cpu->cd.sh.r[0];
+}
+
+X(mov_rm_rn_0_10)
+{
+	cpu->cd.sh.r[10] = cpu->cd.sh.r[0];
+}
+
+X(mov_rm_rn_0_11)
+{
+	cpu->cd.sh.r[11] = cpu->cd.sh.r[0];
+}
+
+X(mov_rm_rn_0_12)
+{
+	cpu->cd.sh.r[12] = cpu->cd.sh.r[0];
+}
+
+X(mov_rm_rn_0_13)
+{
+	cpu->cd.sh.r[13] = cpu->cd.sh.r[0];
+}
+
+X(mov_rm_rn_0_14)
+{
+	cpu->cd.sh.r[14] = cpu->cd.sh.r[0];
+}
+
+X(mov_rm_rn_0_15)
+{
+	cpu->cd.sh.r[15] = cpu->cd.sh.r[0];
+}
+
+X(mov_rm_rn_1_0)
+{
+	cpu->cd.sh.r[0] = cpu->cd.sh.r[1];
+}
+
+X(mov_rm_rn_1_1)
+{
+	cpu->cd.sh.r[1] = cpu->cd.sh.r[1];
+}
+
+X(mov_rm_rn_1_2)
+{
+	cpu->cd.sh.r[2] = cpu->cd.sh.r[1];
+}
+
+X(mov_rm_rn_1_3)
+{
+	cpu->cd.sh.r[3] = cpu->cd.sh.r[1];
+}
+
+X(mov_rm_rn_1_4)
+{
+	cpu->cd.sh.r[4] = cpu->cd.sh.r[1];
+}
+
+X(mov_rm_rn_1_5)
+{
+	cpu->cd.sh.r[5] = cpu->cd.sh.r[1];
+}
+
+X(mov_rm_rn_1_6)
+{
+	cpu->cd.sh.r[6] = cpu->cd.sh.r[1];
+}
+
+X(mov_rm_rn_1_7)
+{
+	cpu->cd.sh.r[7] = cpu->cd.sh.r[1];
+}
+
+X(mov_rm_rn_1_8)
+{
+	cpu->cd.sh.r[8] = cpu->cd.sh.r[1];
+}
+
+X(mov_rm_rn_1_9)
+{
+	cpu->cd.sh.r[9] = cpu->cd.sh.r[1];
+}
+
+X(mov_rm_rn_1_10)
+{
+	cpu->cd.sh.r[10] = cpu->cd.sh.r[1];
+}
+
+X(mov_rm_rn_1_11)
+{
+	cpu->cd.sh.r[11] = cpu->cd.sh.r[1];
+}
+
+X(mov_rm_rn_1_12)
+{
+	cpu->cd.sh.r[12] = cpu->cd.sh.r[1];
+}
+
+X(mov_rm_rn_1_13)
+{
+	cpu->cd.sh.r[13] = cpu->cd.sh.r[1];
+}
+
+X(mov_rm_rn_1_14)
+{
+	cpu->cd.sh.r[14] = cpu->cd.sh.r[1];
+}
+
+X(mov_rm_rn_1_15)
+{
+	cpu->cd.sh.r[15] = cpu->cd.sh.r[1];
+}
+
+X(mov_rm_rn_2_0)
+{
+	cpu->cd.sh.r[0] = cpu->cd.sh.r[2];
+}
+
+X(mov_rm_rn_2_1)
+{
+	cpu->cd.sh.r[1] = cpu->cd.sh.r[2];
+}
+
+X(mov_rm_rn_2_2)
+{
+	cpu->cd.sh.r[2] = cpu->cd.sh.r[2];
+}
+
+X(mov_rm_rn_2_3)
+{
+	cpu->cd.sh.r[3] = cpu->cd.sh.r[2];
+}
+
+X(mov_rm_rn_2_4)
+{
+	cpu->cd.sh.r[4] = cpu->cd.sh.r[2];
+}
+
+X(mov_rm_rn_2_5)
+{
+	cpu->cd.sh.r[5] = cpu->cd.sh.r[2];
+}
+
+X(mov_rm_rn_2_6)
+{
+	cpu->cd.sh.r[6] = cpu->cd.sh.r[2];
+}
+
+X(mov_rm_rn_2_7)
+{
+	cpu->cd.sh.r[7] = cpu->cd.sh.r[2];
+}
+
+X(mov_rm_rn_2_8)
+{
+	cpu->cd.sh.r[8] = cpu->cd.sh.r[2];
+}
+
+X(mov_rm_rn_2_9)
+{
+	cpu->cd.sh.r[9] = cpu->cd.sh.r[2];
+}
+
+X(mov_rm_rn_2_10)
+{
+	cpu->cd.sh.r[10] = cpu->cd.sh.r[2];
+}
+
+X(mov_rm_rn_2_11)
+{
+	cpu->cd.sh.r[11] = cpu->cd.sh.r[2];
+}
+
+X(mov_rm_rn_2_12)
+{
+	cpu->cd.sh.r[12] = cpu->cd.sh.r[2];
+}
+
+X(mov_rm_rn_2_13)
+{
+	cpu->cd.sh.r[13] = cpu->cd.sh.r[2];
+}
+
+X(mov_rm_rn_2_14)
+{
+	cpu->cd.sh.r[14] = cpu->cd.sh.r[2];
+}
+
+X(mov_rm_rn_2_15)
+{
+	cpu->cd.sh.r[15] = cpu->cd.sh.r[2];
+}
+
+X(mov_rm_rn_3_0)
+{
+	cpu->cd.sh.r[0] = cpu->cd.sh.r[3];
+}
+
+X(mov_rm_rn_3_1)
+{
+	cpu->cd.sh.r[1] = cpu->cd.sh.r[3];
+}
+
+X(mov_rm_rn_3_2)
+{
+	cpu->cd.sh.r[2] = cpu->cd.sh.r[3];
+}
+
+X(mov_rm_rn_3_3)
+{
+	cpu->cd.sh.r[3] = cpu->cd.sh.r[3];
+}
+
+X(mov_rm_rn_3_4)
+{
+	cpu->cd.sh.r[4] = cpu->cd.sh.r[3];
+}
+
+X(mov_rm_rn_3_5)
+{
+	cpu->cd.sh.r[5] = cpu->cd.sh.r[3];
+}
+
+X(mov_rm_rn_3_6)
+{
+	cpu->cd.sh.r[6] = cpu->cd.sh.r[3];
+}
+
+X(mov_rm_rn_3_7)
+{
+	cpu->cd.sh.r[7] = cpu->cd.sh.r[3];
+}
+
+X(mov_rm_rn_3_8)
+{
+	cpu->cd.sh.r[8] = cpu->cd.sh.r[3];
+}
+
+X(mov_rm_rn_3_9)
+{
+	cpu->cd.sh.r[9] = cpu->cd.sh.r[3];
+}
+
+X(mov_rm_rn_3_10)
+{
+	cpu->cd.sh.r[10] = cpu->cd.sh.r[3];
+}
+
+X(mov_rm_rn_3_11)
+{
+	cpu->cd.sh.r[11] = cpu->cd.sh.r[3];
+}
+
+X(mov_rm_rn_3_12)
+{
+	cpu->cd.sh.r[12] = cpu->cd.sh.r[3];
+}
+
+X(mov_rm_rn_3_13)
+{
+	cpu->cd.sh.r[13] = cpu->cd.sh.r[3];
+}
+
+X(mov_rm_rn_3_14)
+{
+	cpu->cd.sh.r[14] = cpu->cd.sh.r[3];
+}
+
+X(mov_rm_rn_3_15)
+{
+	cpu->cd.sh.r[15] = cpu->cd.sh.r[3];
+}
+
+X(mov_rm_rn_4_0)
+{
+	cpu->cd.sh.r[0] = cpu->cd.sh.r[4];
+}
+
+X(mov_rm_rn_4_1)
+{
+	cpu->cd.sh.r[1] = cpu->cd.sh.r[4];
+}
+
+X(mov_rm_rn_4_2)
+{
+	cpu->cd.sh.r[2] = cpu->cd.sh.r[4];
+}
+
+X(mov_rm_rn_4_3)
+{
+	cpu->cd.sh.r[3] = cpu->cd.sh.r[4];
+}
+
+X(mov_rm_rn_4_4)
+{
+	cpu->cd.sh.r[4] = cpu->cd.sh.r[4];
+}
+
+X(mov_rm_rn_4_5)
+{
+	cpu->cd.sh.r[5] = cpu->cd.sh.r[4];
+}
+
+X(mov_rm_rn_4_6)
+{
+	cpu->cd.sh.r[6] = cpu->cd.sh.r[4];
+}
+
+X(mov_rm_rn_4_7)
+{
+	cpu->cd.sh.r[7] = cpu->cd.sh.r[4];
+}
+
+X(mov_rm_rn_4_8)
+{
+	cpu->cd.sh.r[8] = cpu->cd.sh.r[4];
+}
+
+X(mov_rm_rn_4_9)
+{
+	cpu->cd.sh.r[9] = cpu->cd.sh.r[4];
+}
+
+X(mov_rm_rn_4_10)
+{
+	cpu->cd.sh.r[10] = cpu->cd.sh.r[4];
+}
+
+X(mov_rm_rn_4_11)
+{
+	cpu->cd.sh.r[11] = cpu->cd.sh.r[4];
+}
+
+X(mov_rm_rn_4_12)
+{
+	cpu->cd.sh.r[12] = cpu->cd.sh.r[4];
+}
+
+X(mov_rm_rn_4_13)
+{
+	cpu->cd.sh.r[13] = cpu->cd.sh.r[4];
+}
+
+X(mov_rm_rn_4_14)
+{
+	cpu->cd.sh.r[14] = cpu->cd.sh.r[4];
+}
+
+X(mov_rm_rn_4_15)
+{
+	cpu->cd.sh.r[15] = cpu->cd.sh.r[4];
+}
+
+X(mov_rm_rn_5_0)
+{
+	cpu->cd.sh.r[0] = cpu->cd.sh.r[5];
+}
+
+X(mov_rm_rn_5_1)
+{
+	cpu->cd.sh.r[1] = cpu->cd.sh.r[5];
+}
+
+X(mov_rm_rn_5_2)
+{
+	cpu->cd.sh.r[2] = cpu->cd.sh.r[5];
+}
+
+X(mov_rm_rn_5_3)
+{
+	cpu->cd.sh.r[3] = cpu->cd.sh.r[5];
+}
+
+X(mov_rm_rn_5_4)
+{
+	cpu->cd.sh.r[4] = cpu->cd.sh.r[5];
+}
+
+X(mov_rm_rn_5_5)
+{
+	cpu->cd.sh.r[5] = cpu->cd.sh.r[5];
+}
+
+X(mov_rm_rn_5_6)
+{
+	cpu->cd.sh.r[6] = cpu->cd.sh.r[5];
+}
+
+X(mov_rm_rn_5_7)
+{
+	cpu->cd.sh.r[7] = cpu->cd.sh.r[5];
+}
+
+X(mov_rm_rn_5_8)
+{
+	cpu->cd.sh.r[8] = cpu->cd.sh.r[5];
+}
+
+X(mov_rm_rn_5_9)
+{
+	cpu->cd.sh.r[9] = cpu->cd.sh.r[5];
+}
+
+X(mov_rm_rn_5_10)
+{
+	cpu->cd.sh.r[10] = cpu->cd.sh.r[5];
+}
+
+X(mov_rm_rn_5_11)
+{
+	cpu->cd.sh.r[11] = cpu->cd.sh.r[5];
+}
+
+X(mov_rm_rn_5_12)
+{
+	cpu->cd.sh.r[12] = cpu->cd.sh.r[5];
+}
+
+X(mov_rm_rn_5_13)
+{
+	cpu->cd.sh.r[13] = cpu->cd.sh.r[5];
+}
+
+X(mov_rm_rn_5_14)
+{
+	cpu->cd.sh.r[14] = cpu->cd.sh.r[5];
+}
+
+X(mov_rm_rn_5_15)
+{
+	cpu->cd.sh.r[15] = cpu->cd.sh.r[5];
+}
+
+X(mov_rm_rn_6_0)
+{
+	cpu->cd.sh.r[0] = cpu->cd.sh.r[6];
+}
+
+X(mov_rm_rn_6_1)
+{
+	cpu->cd.sh.r[1] = cpu->cd.sh.r[6];
+}
+
+X(mov_rm_rn_6_2)
+{
+	cpu->cd.sh.r[2] = cpu->cd.sh.r[6];
+}
+
+X(mov_rm_rn_6_3)
+{
+	cpu->cd.sh.r[3] = cpu->cd.sh.r[6];
+}
+
+X(mov_rm_rn_6_4)
+{
+	cpu->cd.sh.r[4] = cpu->cd.sh.r[6];
+}
+
+X(mov_rm_rn_6_5)
+{
+	cpu->cd.sh.r[5] = cpu->cd.sh.r[6];
+}
+
+X(mov_rm_rn_6_6)
+{
+	cpu->cd.sh.r[6] = cpu->cd.sh.r[6];
+}
+
+X(mov_rm_rn_6_7)
+{
+	cpu->cd.sh.r[7] = cpu->cd.sh.r[6];
+}
+
+X(mov_rm_rn_6_8)
+{
+	cpu->cd.sh.r[8] = cpu->cd.sh.r[6];
+}
+
+X(mov_rm_rn_6_9)
+{
+	cpu->cd.sh.r[9] = cpu->cd.sh.r[6];
+}
+
+X(mov_rm_rn_6_10)
+{
+	cpu->cd.sh.r[10] = cpu->cd.sh.r[6];
+}
+
+X(mov_rm_rn_6_11)
+{
+	cpu->cd.sh.r[11] = cpu->cd.sh.r[6];
+}
+
+X(mov_rm_rn_6_12)
+{
+	cpu->cd.sh.r[12] = cpu->cd.sh.r[6];
+}
+
+X(mov_rm_rn_6_13)
+{
+	cpu->cd.sh.r[13] = cpu->cd.sh.r[6];
+}
+
+X(mov_rm_rn_6_14)
+{
+	cpu->cd.sh.r[14] = cpu->cd.sh.r[6];
+}
+
+X(mov_rm_rn_6_15)
+{
+	cpu->cd.sh.r[15] = cpu->cd.sh.r[6];
+}
+
+X(mov_rm_rn_7_0)
+{
+	cpu->cd.sh.r[0] = cpu->cd.sh.r[7];
+}
+
+X(mov_rm_rn_7_1)
+{
+	cpu->cd.sh.r[1] = cpu->cd.sh.r[7];
+}
+
+X(mov_rm_rn_7_2)
+{
+	cpu->cd.sh.r[2] = cpu->cd.sh.r[7];
+}
+
+X(mov_rm_rn_7_3)
+{
+	cpu->cd.sh.r[3] = cpu->cd.sh.r[7];
+}
+
+X(mov_rm_rn_7_4)
+{
+	cpu->cd.sh.r[4] = cpu->cd.sh.r[7];
+}
+
+X(mov_rm_rn_7_5)
+{
+	cpu->cd.sh.r[5] = cpu->cd.sh.r[7];
+}
+
+X(mov_rm_rn_7_6)
+{
+	cpu->cd.sh.r[6] = cpu->cd.sh.r[7];
+}
+
+X(mov_rm_rn_7_7)
+{
+	cpu->cd.sh.r[7] = cpu->cd.sh.r[7];
+}
+
+X(mov_rm_rn_7_8)
+{
+	cpu->cd.sh.r[8] = cpu->cd.sh.r[7];
+}
+
+X(mov_rm_rn_7_9)
+{
+	cpu->cd.sh.r[9] = cpu->cd.sh.r[7];
+}
+
+X(mov_rm_rn_7_10)
+{
+	cpu->cd.sh.r[10] = cpu->cd.sh.r[7];
+}
+
+X(mov_rm_rn_7_11)
+{
+	cpu->cd.sh.r[11] = cpu->cd.sh.r[7];
+}
+
+X(mov_rm_rn_7_12)
+{
+	cpu->cd.sh.r[12] = cpu->cd.sh.r[7];
+}
+
+X(mov_rm_rn_7_13)
+{
+	cpu->cd.sh.r[13] = cpu->cd.sh.r[7];
+}
+
+X(mov_rm_rn_7_14)
+{
+	cpu->cd.sh.r[14] = cpu->cd.sh.r[7];
+}
+
+X(mov_rm_rn_7_15)
+{
+	cpu->cd.sh.r[15] = cpu->cd.sh.r[7];
+}
+
+X(mov_rm_rn_8_0)
+{
+	cpu->cd.sh.r[0] = cpu->cd.sh.r[8];
+}
+
+X(mov_rm_rn_8_1)
+{
+	cpu->cd.sh.r[1] = cpu->cd.sh.r[8];
+}
+
+X(mov_rm_rn_8_2)
+{
+	cpu->cd.sh.r[2] = cpu->cd.sh.r[8];
+}
+
+X(mov_rm_rn_8_3)
+{
+	cpu->cd.sh.r[3] = cpu->cd.sh.r[8];
+}
+
+X(mov_rm_rn_8_4)
+{
+	cpu->cd.sh.r[4] = cpu->cd.sh.r[8];
+}
+
+X(mov_rm_rn_8_5)
+{
+	cpu->cd.sh.r[5] = cpu->cd.sh.r[8];
+}
+
+X(mov_rm_rn_8_6)
+{
+	cpu->cd.sh.r[6] = cpu->cd.sh.r[8];
+}
+
+X(mov_rm_rn_8_7)
+{
+	cpu->cd.sh.r[7] = cpu->cd.sh.r[8];
+}
+
+X(mov_rm_rn_8_8)
+{
+	cpu->cd.sh.r[8] = cpu->cd.sh.r[8];
+}
+
+X(mov_rm_rn_8_9)
+{
+	cpu->cd.sh.r[9] = cpu->cd.sh.r[8];
+}
+
+X(mov_rm_rn_8_10)
+{
+	cpu->cd.sh.r[10] = cpu->cd.sh.r[8];
+}
+
+X(mov_rm_rn_8_11)
+{
+	cpu->cd.sh.r[11] = cpu->cd.sh.r[8];
+}
+
+X(mov_rm_rn_8_12)
+{
+	cpu->cd.sh.r[12] = cpu->cd.sh.r[8];
+}
+
+X(mov_rm_rn_8_13)
+{
+	cpu->cd.sh.r[13] = cpu->cd.sh.r[8];
+}
+
+X(mov_rm_rn_8_14)
+{
+	cpu->cd.sh.r[14] = cpu->cd.sh.r[8];
+}
+
+X(mov_rm_rn_8_15)
+{
+	cpu->cd.sh.r[15] = cpu->cd.sh.r[8];
+}
+
+X(mov_rm_rn_9_0)
+{
+	cpu->cd.sh.r[0] = cpu->cd.sh.r[9];
+}
+
+X(mov_rm_rn_9_1)
+{
+	cpu->cd.sh.r[1] = cpu->cd.sh.r[9];
+}
+
+X(mov_rm_rn_9_2)
+{
+	cpu->cd.sh.r[2] = cpu->cd.sh.r[9];
+}
+
+X(mov_rm_rn_9_3)
+{
+	cpu->cd.sh.r[3] = cpu->cd.sh.r[9];
+}
+
+X(mov_rm_rn_9_4)
+{
+	cpu->cd.sh.r[4] = cpu->cd.sh.r[9];
+}
+
+X(mov_rm_rn_9_5)
+{
+	cpu->cd.sh.r[5] = cpu->cd.sh.r[9];
+}
+
+X(mov_rm_rn_9_6)
+{
+	cpu->cd.sh.r[6] = cpu->cd.sh.r[9];
+}
+
+X(mov_rm_rn_9_7)
+{
+	cpu->cd.sh.r[7] = cpu->cd.sh.r[9];
+}
+
+X(mov_rm_rn_9_8)
+{
+	cpu->cd.sh.r[8] = cpu->cd.sh.r[9];
+}
+
+X(mov_rm_rn_9_9)
+{
+	cpu->cd.sh.r[9] = cpu->cd.sh.r[9];
+}
+
+X(mov_rm_rn_9_10)
+{
+	cpu->cd.sh.r[10] = cpu->cd.sh.r[9];
+}
+
+X(mov_rm_rn_9_11)
+{
+	cpu->cd.sh.r[11] = cpu->cd.sh.r[9];
+}
+
+X(mov_rm_rn_9_12)
+{
+	cpu->cd.sh.r[12] = cpu->cd.sh.r[9];
+}
+
+X(mov_rm_rn_9_13)
+{
+	cpu->cd.sh.r[13] = cpu->cd.sh.r[9];
+}
+
+X(mov_rm_rn_9_14)
+{
+	cpu->cd.sh.r[14] = cpu->cd.sh.r[9];
+}
+
+X(mov_rm_rn_9_15)
+{
+	cpu->cd.sh.r[15] = cpu->cd.sh.r[9];
+}
+
+X(mov_rm_rn_10_0)
+{
+	cpu->cd.sh.r[0] = cpu->cd.sh.r[10];
+}
+
+X(mov_rm_rn_10_1)
+{
+	cpu->cd.sh.r[1] = cpu->cd.sh.r[10];
+}
+
+X(mov_rm_rn_10_2)
+{
+	cpu->cd.sh.r[2] = cpu->cd.sh.r[10];
+}
+
+X(mov_rm_rn_10_3)
+{
+	cpu->cd.sh.r[3] = cpu->cd.sh.r[10];
+}
+
+X(mov_rm_rn_10_4)
+{
+	cpu->cd.sh.r[4] = cpu->cd.sh.r[10];
+}
+
+X(mov_rm_rn_10_5)
+{
+	cpu->cd.sh.r[5] = cpu->cd.sh.r[10];
+}
+
+X(mov_rm_rn_10_6)
+{
+	cpu->cd.sh.r[6] = cpu->cd.sh.r[10];
+}
+
+X(mov_rm_rn_10_7)
+{
+	cpu->cd.sh.r[7] = cpu->cd.sh.r[10];
+}
+
+X(mov_rm_rn_10_8)
+{
+	cpu->cd.sh.r[8] = cpu->cd.sh.r[10];
+}
+
+X(mov_rm_rn_10_9)
+{
+	cpu->cd.sh.r[9] = cpu->cd.sh.r[10];
+}
+
+X(mov_rm_rn_10_10)
+{
+	cpu->cd.sh.r[10] = cpu->cd.sh.r[10];
+}
+
+X(mov_rm_rn_10_11)
+{
+	cpu->cd.sh.r[11] = cpu->cd.sh.r[10];
+}
+
+X(mov_rm_rn_10_12)
+{
+	cpu->cd.sh.r[12] = cpu->cd.sh.r[10];
+}
+
+X(mov_rm_rn_10_13)
+{
+	cpu->cd.sh.r[13] = cpu->cd.sh.r[10];
+}
+
+X(mov_rm_rn_10_14)
+{
+	cpu->cd.sh.r[14] = cpu->cd.sh.r[10];
+}
+
+X(mov_rm_rn_10_15)
+{
+	cpu->cd.sh.r[15] = cpu->cd.sh.r[10];
+}
+
+X(mov_rm_rn_11_0)
+{
+	cpu->cd.sh.r[0] = cpu->cd.sh.r[11];
+}
+
+X(mov_rm_rn_11_1)
+{
+	cpu->cd.sh.r[1] = cpu->cd.sh.r[11];
+}
+
+X(mov_rm_rn_11_2)
+{
+	cpu->cd.sh.r[2] = cpu->cd.sh.r[11];
+}
+
+X(mov_rm_rn_11_3)
+{
+	cpu->cd.sh.r[3] = cpu->cd.sh.r[11];
+}
+
+X(mov_rm_rn_11_4)
+{
+	cpu->cd.sh.r[4] = cpu->cd.sh.r[11];
+}
+
+X(mov_rm_rn_11_5)
+{
+	cpu->cd.sh.r[5] = cpu->cd.sh.r[11];
+}
+
+X(mov_rm_rn_11_6)
+{
+	cpu->cd.sh.r[6] = cpu->cd.sh.r[11];
+}
+
+X(mov_rm_rn_11_7)
+{
+	cpu->cd.sh.r[7] = cpu->cd.sh.r[11];
+}
+
+X(mov_rm_rn_11_8)
+{
+	cpu->cd.sh.r[8] = cpu->cd.sh.r[11];
+}
+
+X(mov_rm_rn_11_9)
+{
+	cpu->cd.sh.r[9] = cpu->cd.sh.r[11];
+}
+
+X(mov_rm_rn_11_10)
+{
+	cpu->cd.sh.r[10] = cpu->cd.sh.r[11];
+}
+
+X(mov_rm_rn_11_11)
+{
+	cpu->cd.sh.r[11] = cpu->cd.sh.r[11];
+}
+
+X(mov_rm_rn_11_12)
+{
+	cpu->cd.sh.r[12] = cpu->cd.sh.r[11];
+}
+
+X(mov_rm_rn_11_13)
+{
+	cpu->cd.sh.r[13] = cpu->cd.sh.r[11];
+}
+
+X(mov_rm_rn_11_14)
+{
+	cpu->cd.sh.r[14] = cpu->cd.sh.r[11];
+}
+
+X(mov_rm_rn_11_15)
+{
+	cpu->cd.sh.r[15] = cpu->cd.sh.r[11];
+}
+
+X(mov_rm_rn_12_0)
+{
+	cpu->cd.sh.r[0] = cpu->cd.sh.r[12];
+}
+
+X(mov_rm_rn_12_1)
+{
+	cpu->cd.sh.r[1] = cpu->cd.sh.r[12];
+}
+
+X(mov_rm_rn_12_2)
+{
+	cpu->cd.sh.r[2] = cpu->cd.sh.r[12];
+}
+
+X(mov_rm_rn_12_3)
+{
+	cpu->cd.sh.r[3] = cpu->cd.sh.r[12];
+}
+
+X(mov_rm_rn_12_4)
+{
+	cpu->cd.sh.r[4] = cpu->cd.sh.r[12];
+}
+
+X(mov_rm_rn_12_5)
+{
+	cpu->cd.sh.r[5] = cpu->cd.sh.r[12];
+}
+
+X(mov_rm_rn_12_6)
+{
+	cpu->cd.sh.r[6] = cpu->cd.sh.r[12];
+}
+
+X(mov_rm_rn_12_7)
+{
+	cpu->cd.sh.r[7] = cpu->cd.sh.r[12];
+}
+
+X(mov_rm_rn_12_8)
+{
+	cpu->cd.sh.r[8] = cpu->cd.sh.r[12];
+}
+
+X(mov_rm_rn_12_9)
+{
+	cpu->cd.sh.r[9] = cpu->cd.sh.r[12];
+}
+
+X(mov_rm_rn_12_10)
+{
+	cpu->cd.sh.r[10] = cpu->cd.sh.r[12];
+}
+
+X(mov_rm_rn_12_11)
+{
+	cpu->cd.sh.r[11] = cpu->cd.sh.r[12];
+}
+
+X(mov_rm_rn_12_12)
+{
+	cpu->cd.sh.r[12] = cpu->cd.sh.r[12];
+}
+
+X(mov_rm_rn_12_13)
+{
+	cpu->cd.sh.r[13] = cpu->cd.sh.r[12];
+}
+
+X(mov_rm_rn_12_14)
+{
+	cpu->cd.sh.r[14] = cpu->cd.sh.r[12];
+}
+
+X(mov_rm_rn_12_15)
+{
+	cpu->cd.sh.r[15] = cpu->cd.sh.r[12];
+}
+
+X(mov_rm_rn_13_0)
+{
+	cpu->cd.sh.r[0] = cpu->cd.sh.r[13];
+}
+
+X(mov_rm_rn_13_1)
+{
+	cpu->cd.sh.r[1] = cpu->cd.sh.r[13];
+}
+
+X(mov_rm_rn_13_2)
+{
+	cpu->cd.sh.r[2] = cpu->cd.sh.r[13];
+}
+
+X(mov_rm_rn_13_3)
+{
+	cpu->cd.sh.r[3] = cpu->cd.sh.r[13];
+}
+
+X(mov_rm_rn_13_4)
+{
+	cpu->cd.sh.r[4] = cpu->cd.sh.r[13];
+}
+
+X(mov_rm_rn_13_5)
+{
+	cpu->cd.sh.r[5] = cpu->cd.sh.r[13];
+}
+
+X(mov_rm_rn_13_6)
+{
+	cpu->cd.sh.r[6] = cpu->cd.sh.r[13];
+}
+
+X(mov_rm_rn_13_7)
+{
+	cpu->cd.sh.r[7] = cpu->cd.sh.r[13];
+}
+
+X(mov_rm_rn_13_8)
+{
+	cpu->cd.sh.r[8] = cpu->cd.sh.r[13];
+}
+
+X(mov_rm_rn_13_9)
+{
+	cpu->cd.sh.r[9] = cpu->cd.sh.r[13];
+}
+
+X(mov_rm_rn_13_10)
+{
+	cpu->cd.sh.r[10] = cpu->cd.sh.r[13];
+}
+
+X(mov_rm_rn_13_11)
+{
+	cpu->cd.sh.r[11] = cpu->cd.sh.r[13];
+}
+
+X(mov_rm_rn_13_12)
+{
+	cpu->cd.sh.r[12] = cpu->cd.sh.r[13];
+}
+
+X(mov_rm_rn_13_13)
+{
+	cpu->cd.sh.r[13] = cpu->cd.sh.r[13];
+}
+
+X(mov_rm_rn_13_14)
+{
+	cpu->cd.sh.r[14] = cpu->cd.sh.r[13];
+}
+
+X(mov_rm_rn_13_15)
+{
+	cpu->cd.sh.r[15] = cpu->cd.sh.r[13];
+}
+
+X(mov_rm_rn_14_0)
+{
+	cpu->cd.sh.r[0] = cpu->cd.sh.r[14];
+}
+
+X(mov_rm_rn_14_1)
+{
+	cpu->cd.sh.r[1] = cpu->cd.sh.r[14];
+}
+
+X(mov_rm_rn_14_2)
+{
+	cpu->cd.sh.r[2] = cpu->cd.sh.r[14];
+}
+
+X(mov_rm_rn_14_3)
+{
+	cpu->cd.sh.r[3] = cpu->cd.sh.r[14];
+}
+
+X(mov_rm_rn_14_4)
+{
+	cpu->cd.sh.r[4] = cpu->cd.sh.r[14];
+}
+
+X(mov_rm_rn_14_5)
+{
+	cpu->cd.sh.r[5] = cpu->cd.sh.r[14];
+}
+
+X(mov_rm_rn_14_6)
+{
+	cpu->cd.sh.r[6] = cpu->cd.sh.r[14];
+}
+
+X(mov_rm_rn_14_7)
+{
+	cpu->cd.sh.r[7] = cpu->cd.sh.r[14];
+}
+
+X(mov_rm_rn_14_8)
+{
+	cpu->cd.sh.r[8] = cpu->cd.sh.r[14];
+}
+
+X(mov_rm_rn_14_9)
+{
+	cpu->cd.sh.r[9] = cpu->cd.sh.r[14];
+}
+
+X(mov_rm_rn_14_10)
+{
+	cpu->cd.sh.r[10] = cpu->cd.sh.r[14];
+}
+
+X(mov_rm_rn_14_11)
+{
+	cpu->cd.sh.r[11] = cpu->cd.sh.r[14];
+}
+
+X(mov_rm_rn_14_12)
+{
+	cpu->cd.sh.r[12] = cpu->cd.sh.r[14];
+}
+
+X(mov_rm_rn_14_13)
+{
+	cpu->cd.sh.r[13] = cpu->cd.sh.r[14];
+}
+
+X(mov_rm_rn_14_14)
+{
+	cpu->cd.sh.r[14] = cpu->cd.sh.r[14];
+}
+
+X(mov_rm_rn_14_15)
+{
+	cpu->cd.sh.r[15] = cpu->cd.sh.r[14];
+}
+
+X(mov_rm_rn_15_0)
+{
+	cpu->cd.sh.r[0] = cpu->cd.sh.r[15];
+}
+
+X(mov_rm_rn_15_1)
+{
+	cpu->cd.sh.r[1] = cpu->cd.sh.r[15];
+}
+
+X(mov_rm_rn_15_2)
+{
+	cpu->cd.sh.r[2] = cpu->cd.sh.r[15];
+}
+
+X(mov_rm_rn_15_3)
+{
+	cpu->cd.sh.r[3] = cpu->cd.sh.r[15];
+}
+
+X(mov_rm_rn_15_4)
+{
+	cpu->cd.sh.r[4] = cpu->cd.sh.r[15];
+}
+
+X(mov_rm_rn_15_5)
+{
+	cpu->cd.sh.r[5] = cpu->cd.sh.r[15];
+}
+
+X(mov_rm_rn_15_6)
+{
+	cpu->cd.sh.r[6] = cpu->cd.sh.r[15];
+}
+
+X(mov_rm_rn_15_7)
+{
+	cpu->cd.sh.r[7] = cpu->cd.sh.r[15];
+}
+
+X(mov_rm_rn_15_8)
+{
+	cpu->cd.sh.r[8] = cpu->cd.sh.r[15];
+}
+
+X(mov_rm_rn_15_9)
+{
+	cpu->cd.sh.r[9] = cpu->cd.sh.r[15];
+}
+
+X(mov_rm_rn_15_10)
+{
+	cpu->cd.sh.r[10] = cpu->cd.sh.r[15];
+}
+
+X(mov_rm_rn_15_11)
+{
+	cpu->cd.sh.r[11] = cpu->cd.sh.r[15];
+}
+
+X(mov_rm_rn_15_12)
+{
+	cpu->cd.sh.r[12] = cpu->cd.sh.r[15];
+}
+
+X(mov_rm_rn_15_13)
+{
+	cpu->cd.sh.r[13] = cpu->cd.sh.r[15];
+}
+
+X(mov_rm_rn_15_14)
+{
+	cpu->cd.sh.r[14] = cpu->cd.sh.r[15];
+}
+
+X(mov_rm_rn_15_15)
+{
+	cpu->cd.sh.r[15] = cpu->cd.sh.r[15];
+}
+
+X(add_rm_rn_0_0)
+{
+	cpu->cd.sh.r[0] += cpu->cd.sh.r[0];
+}
+
+X(add_rm_rn_0_1)
+{
+	cpu->cd.sh.r[1] += cpu->cd.sh.r[0];
+}
+
+X(add_rm_rn_0_2)
+{
+	cpu->cd.sh.r[2] += cpu->cd.sh.r[0];
+}
+
+X(add_rm_rn_0_3)
+{
+	cpu->cd.sh.r[3] += cpu->cd.sh.r[0];
+}
+
+X(add_rm_rn_0_4)
+{
+	cpu->cd.sh.r[4] += cpu->cd.sh.r[0];
+}
+
+X(add_rm_rn_0_5)
+{
+	cpu->cd.sh.r[5] += cpu->cd.sh.r[0];
+}
+
+X(add_rm_rn_0_6)
+{
+	cpu->cd.sh.r[6] += cpu->cd.sh.r[0];
+}
+
+X(add_rm_rn_0_7)
+{
+	cpu->cd.sh.r[7] += cpu->cd.sh.r[0];
+}
+
+X(add_rm_rn_0_8)
+{
+	cpu->cd.sh.r[8] += cpu->cd.sh.r[0];
+}
+
+X(add_rm_rn_0_9)
+{
+	cpu->cd.sh.r[9] += cpu->cd.sh.r[0];
+}
+
+X(add_rm_rn_0_10)
+{
+	cpu->cd.sh.r[10] += cpu->cd.sh.r[0];
+}
+
+X(add_rm_rn_0_11)
+{
+	cpu->cd.sh.r[11] += cpu->cd.sh.r[0];
+}
+
+X(add_rm_rn_0_12)
+{
+	cpu->cd.sh.r[12] += cpu->cd.sh.r[0];
+}
+
+X(add_rm_rn_0_13)
+{
+	cpu->cd.sh.r[13] += cpu->cd.sh.r[0];
+}
+
+X(add_rm_rn_0_14)
+{
+	cpu->cd.sh.r[14] += cpu->cd.sh.r[0];
+}
+
+X(add_rm_rn_0_15)
+{
+	cpu->cd.sh.r[15] += cpu->cd.sh.r[0];
+}
+
+X(add_rm_rn_1_0)
+{
+	cpu->cd.sh.r[0] += cpu->cd.sh.r[1];
+}
+
+X(add_rm_rn_1_1)
+{
+	cpu->cd.sh.r[1] += cpu->cd.sh.r[1];
+}
+
+X(add_rm_rn_1_2)
+{
+	cpu->cd.sh.r[2] += cpu->cd.sh.r[1];
+}
+
+X(add_rm_rn_1_3)
+{
+	cpu->cd.sh.r[3] += cpu->cd.sh.r[1];
+}
+
+X(add_rm_rn_1_4)
+{
+	cpu->cd.sh.r[4] += cpu->cd.sh.r[1];
+}
+
+X(add_rm_rn_1_5)
+{
+	cpu->cd.sh.r[5] += cpu->cd.sh.r[1];
+}
+
+X(add_rm_rn_1_6)
+{
+	cpu->cd.sh.r[6] += cpu->cd.sh.r[1];
+}
+
+X(add_rm_rn_1_7)
+{
+	cpu->cd.sh.r[7] += cpu->cd.sh.r[1];
+}
+
+X(add_rm_rn_1_8)
+{
+	cpu->cd.sh.r[8] += cpu->cd.sh.r[1];
+}
+
+X(add_rm_rn_1_9)
+{
+	cpu->cd.sh.r[9] += cpu->cd.sh.r[1];
+}
+
+X(add_rm_rn_1_10)
+{
+	cpu->cd.sh.r[10] += cpu->cd.sh.r[1];
+}
+
+X(add_rm_rn_1_11)
+{
+	cpu->cd.sh.r[11] += cpu->cd.sh.r[1];
+}
+
+X(add_rm_rn_1_12)
+{
+	cpu->cd.sh.r[12] += cpu->cd.sh.r[1];
+}
+
+X(add_rm_rn_1_13)
+{
+	cpu->cd.sh.r[13] += cpu->cd.sh.r[1];
+}
+
+X(add_rm_rn_1_14)
+{
+	cpu->cd.sh.r[14] += cpu->cd.sh.r[1];
+}
+
+X(add_rm_rn_1_15)
+{
+	cpu->cd.sh.r[15] += cpu->cd.sh.r[1];
+}
+
+X(add_rm_rn_2_0)
+{
+	cpu->cd.sh.r[0] += cpu->cd.sh.r[2];
+}
+
+X(add_rm_rn_2_1)
+{
+	cpu->cd.sh.r[1] += cpu->cd.sh.r[2];
+}
+
+X(add_rm_rn_2_2)
+{
+	cpu->cd.sh.r[2] += cpu->cd.sh.r[2];
+}
+
+X(add_rm_rn_2_3)
+{
+	cpu->cd.sh.r[3] += cpu->cd.sh.r[2];
+}
+
+X(add_rm_rn_2_4)
+{
+	cpu->cd.sh.r[4] += cpu->cd.sh.r[2];
+}
+
+X(add_rm_rn_2_5)
+{
+	cpu->cd.sh.r[5] += cpu->cd.sh.r[2];
+}
+
+X(add_rm_rn_2_6)
+{
+	cpu->cd.sh.r[6] += cpu->cd.sh.r[2];
+}
+
+X(add_rm_rn_2_7)
+{
+	cpu->cd.sh.r[7] += cpu->cd.sh.r[2];
+}
+
+X(add_rm_rn_2_8)
+{
+	cpu->cd.sh.r[8] += cpu->cd.sh.r[2];
+}
+
+X(add_rm_rn_2_9)
+{
+	cpu->cd.sh.r[9] += cpu->cd.sh.r[2];
+}
+
+X(add_rm_rn_2_10)
+{
+	cpu->cd.sh.r[10] += cpu->cd.sh.r[2];
+}
+
+X(add_rm_rn_2_11)
+{
+	cpu->cd.sh.r[11] += cpu->cd.sh.r[2];
+}
+
+X(add_rm_rn_2_12)
+{
+	cpu->cd.sh.r[12] += cpu->cd.sh.r[2];
+}
+
+X(add_rm_rn_2_13)
+{
+	cpu->cd.sh.r[13] += cpu->cd.sh.r[2];
+}
+
+X(add_rm_rn_2_14)
+{
+	cpu->cd.sh.r[14] += cpu->cd.sh.r[2];
+}
+
+X(add_rm_rn_2_15)
+{
+	cpu->cd.sh.r[15] += cpu->cd.sh.r[2];
+}
+
+X(add_rm_rn_3_0)
+{
+	cpu->cd.sh.r[0] += cpu->cd.sh.r[3];
+}
+
+X(add_rm_rn_3_1)
+{
+	cpu->cd.sh.r[1] += cpu->cd.sh.r[3];
+}
+
+X(add_rm_rn_3_2)
+{
+	cpu->cd.sh.r[2] += cpu->cd.sh.r[3];
+}
+
+X(add_rm_rn_3_3)
+{
+	cpu->cd.sh.r[3] += cpu->cd.sh.r[3];
+}
+
+X(add_rm_rn_3_4)
+{
+	cpu->cd.sh.r[4] += cpu->cd.sh.r[3];
+}
+
+X(add_rm_rn_3_5)
+{
+	cpu->cd.sh.r[5] += cpu->cd.sh.r[3];
+}
+
+X(add_rm_rn_3_6)
+{
+	cpu->cd.sh.r[6] += cpu->cd.sh.r[3];
+}
+
+X(add_rm_rn_3_7)
+{
+	cpu->cd.sh.r[7] += cpu->cd.sh.r[3];
+}
+
+X(add_rm_rn_3_8)
+{
+	cpu->cd.sh.r[8] += cpu->cd.sh.r[3];
+}
+
+X(add_rm_rn_3_9)
+{
+	cpu->cd.sh.r[9] += cpu->cd.sh.r[3];
+}
+
+X(add_rm_rn_3_10)
+{
+	cpu->cd.sh.r[10] += cpu->cd.sh.r[3];
+}
+
+X(add_rm_rn_3_11)
+{
+	cpu->cd.sh.r[11] += cpu->cd.sh.r[3];
+}
+
+X(add_rm_rn_3_12)
+{
+	cpu->cd.sh.r[12] += cpu->cd.sh.r[3];
+}
+
+X(add_rm_rn_3_13)
+{
+	cpu->cd.sh.r[13] += cpu->cd.sh.r[3];
+}
+
+X(add_rm_rn_3_14)
+{
+	cpu->cd.sh.r[14] += cpu->cd.sh.r[3];
+}
+
+X(add_rm_rn_3_15)
+{
+	cpu->cd.sh.r[15] += cpu->cd.sh.r[3];
+}
+
+X(add_rm_rn_4_0)
+{
+	cpu->cd.sh.r[0] += cpu->cd.sh.r[4];
+}
+
+X(add_rm_rn_4_1)
+{
+	cpu->cd.sh.r[1] += cpu->cd.sh.r[4];
+}
+
+X(add_rm_rn_4_2)
+{
+	cpu->cd.sh.r[2] += cpu->cd.sh.r[4];
+}
+
+X(add_rm_rn_4_3)
+{
+	cpu->cd.sh.r[3] += cpu->cd.sh.r[4];
+}
+
+X(add_rm_rn_4_4)
+{
+	cpu->cd.sh.r[4] += cpu->cd.sh.r[4];
+}
+
+X(add_rm_rn_4_5)
+{
+	cpu->cd.sh.r[5] += cpu->cd.sh.r[4];
+}
+
+X(add_rm_rn_4_6)
+{
+	cpu->cd.sh.r[6] += cpu->cd.sh.r[4];
+}
+
+X(add_rm_rn_4_7)
+{
+	cpu->cd.sh.r[7] += cpu->cd.sh.r[4];
+}
+
+X(add_rm_rn_4_8)
+{
+	cpu->cd.sh.r[8] += cpu->cd.sh.r[4];
+}
+
+X(add_rm_rn_4_9)
+{
+	cpu->cd.sh.r[9] += cpu->cd.sh.r[4];
+}
+
+X(add_rm_rn_4_10)
+{
+	cpu->cd.sh.r[10] += cpu->cd.sh.r[4];
+}
+
+X(add_rm_rn_4_11)
+{
+	cpu->cd.sh.r[11] += cpu->cd.sh.r[4];
+}
+
+X(add_rm_rn_4_12)
+{
+	cpu->cd.sh.r[12] += cpu->cd.sh.r[4];
+}
+
+X(add_rm_rn_4_13)
+{
+	cpu->cd.sh.r[13] += cpu->cd.sh.r[4];
+}
+
+X(add_rm_rn_4_14)
+{
+	cpu->cd.sh.r[14] += cpu->cd.sh.r[4];
+}
+
+X(add_rm_rn_4_15)
+{
+	cpu->cd.sh.r[15] += cpu->cd.sh.r[4];
+}
+
+X(add_rm_rn_5_0)
+{
+	cpu->cd.sh.r[0] += cpu->cd.sh.r[5];
+}
+
+X(add_rm_rn_5_1)
+{
+	cpu->cd.sh.r[1] += cpu->cd.sh.r[5];
+}
+
+X(add_rm_rn_5_2)
+{
+	cpu->cd.sh.r[2] += cpu->cd.sh.r[5];
+}
+
+X(add_rm_rn_5_3)
+{
+	cpu->cd.sh.r[3] += cpu->cd.sh.r[5];
+}
+
+X(add_rm_rn_5_4)
+{
+	cpu->cd.sh.r[4] += cpu->cd.sh.r[5];
+}
+
+X(add_rm_rn_5_5)
+{
+	cpu->cd.sh.r[5] += cpu->cd.sh.r[5];
+}
+
+X(add_rm_rn_5_6)
+{
+	cpu->cd.sh.r[6] += cpu->cd.sh.r[5];
+}
+
+X(add_rm_rn_5_7)
+{
+	cpu->cd.sh.r[7] += cpu->cd.sh.r[5];
+}
+
+X(add_rm_rn_5_8)
+{
+	cpu->cd.sh.r[8] += cpu->cd.sh.r[5];
+}
+
+X(add_rm_rn_5_9)
+{
+	cpu->cd.sh.r[9] += cpu->cd.sh.r[5];
+}
+
+X(add_rm_rn_5_10)
+{
+	cpu->cd.sh.r[10] += cpu->cd.sh.r[5];
+}
+
+X(add_rm_rn_5_11)
+{
+	cpu->cd.sh.r[11] += cpu->cd.sh.r[5];
+}
+
+X(add_rm_rn_5_12)
+{
+	cpu->cd.sh.r[12] += cpu->cd.sh.r[5];
+}
+
+X(add_rm_rn_5_13)
+{
+	cpu->cd.sh.r[13] += cpu->cd.sh.r[5];
+}
+
+X(add_rm_rn_5_14)
+{
+	cpu->cd.sh.r[14] += cpu->cd.sh.r[5];
+}
+
+X(add_rm_rn_5_15)
+{
+	cpu->cd.sh.r[15] += cpu->cd.sh.r[5];
+}
+
+X(add_rm_rn_6_0)
+{
+	cpu->cd.sh.r[0] += cpu->cd.sh.r[6];
+}
+
+X(add_rm_rn_6_1)
+{
+	cpu->cd.sh.r[1] += cpu->cd.sh.r[6];
+}
+
+X(add_rm_rn_6_2)
+{
+	cpu->cd.sh.r[2] += cpu->cd.sh.r[6];
+}
+
+X(add_rm_rn_6_3)
+{
+	cpu->cd.sh.r[3] += cpu->cd.sh.r[6];
+}
+
+X(add_rm_rn_6_4)
+{
+	cpu->cd.sh.r[4] += cpu->cd.sh.r[6];
+}
+
+X(add_rm_rn_6_5)
+{
+	cpu->cd.sh.r[5] += cpu->cd.sh.r[6];
+}
+
+X(add_rm_rn_6_6)
+{
+	cpu->cd.sh.r[6] += cpu->cd.sh.r[6];
+}
+
+X(add_rm_rn_6_7)
+{
+	cpu->cd.sh.r[7] += cpu->cd.sh.r[6];
+}
+
+X(add_rm_rn_6_8)
+{
+	cpu->cd.sh.r[8] += cpu->cd.sh.r[6];
+}
+
+X(add_rm_rn_6_9)
+{
+	cpu->cd.sh.r[9] += cpu->cd.sh.r[6];
+}
+
+X(add_rm_rn_6_10)
+{
+	cpu->cd.sh.r[10] += cpu->cd.sh.r[6];
+}
+
+X(add_rm_rn_6_11)
+{
+	cpu->cd.sh.r[11] += cpu->cd.sh.r[6];
+}
+
+X(add_rm_rn_6_12)
+{
+	cpu->cd.sh.r[12] += cpu->cd.sh.r[6];
+}
+
+X(add_rm_rn_6_13)
+{
+	cpu->cd.sh.r[13] += cpu->cd.sh.r[6];
+}
+
+X(add_rm_rn_6_14)
+{
+	cpu->cd.sh.r[14] += cpu->cd.sh.r[6];
+}
+
+X(add_rm_rn_6_15)
+{
+	cpu->cd.sh.r[15] += cpu->cd.sh.r[6];
+}
+
+X(add_rm_rn_7_0)
+{
+	cpu->cd.sh.r[0] += cpu->cd.sh.r[7];
+}
+
+X(add_rm_rn_7_1)
+{
+	cpu->cd.sh.r[1] += cpu->cd.sh.r[7];
+}
+
+X(add_rm_rn_7_2)
+{
+	cpu->cd.sh.r[2] += cpu->cd.sh.r[7];
+}
+
+X(add_rm_rn_7_3)
+{
+	cpu->cd.sh.r[3] += cpu->cd.sh.r[7];
+}
+
+X(add_rm_rn_7_4)
+{
+	cpu->cd.sh.r[4] += cpu->cd.sh.r[7];
+}
+
+X(add_rm_rn_7_5)
+{
+	cpu->cd.sh.r[5] += cpu->cd.sh.r[7];
+}
+
+X(add_rm_rn_7_6)
+{
+	cpu->cd.sh.r[6] += cpu->cd.sh.r[7];
+}
+
+X(add_rm_rn_7_7)
+{
+	cpu->cd.sh.r[7] += cpu->cd.sh.r[7];
+}
+
+X(add_rm_rn_7_8)
+{
+	cpu->cd.sh.r[8] += cpu->cd.sh.r[7];
+}
+
+X(add_rm_rn_7_9)
+{
+	cpu->cd.sh.r[9] += cpu->cd.sh.r[7];
+}
+
+X(add_rm_rn_7_10)
+{
+	cpu->cd.sh.r[10] += cpu->cd.sh.r[7];
+}
+
+X(add_rm_rn_7_11)
+{
+	cpu->cd.sh.r[11] += cpu->cd.sh.r[7];
+}
+
+X(add_rm_rn_7_12)
+{
+	cpu->cd.sh.r[12] += cpu->cd.sh.r[7];
+}
+
+X(add_rm_rn_7_13)
+{
+	cpu->cd.sh.r[13] += cpu->cd.sh.r[7];
+}
+
+X(add_rm_rn_7_14)
+{
+	cpu->cd.sh.r[14] += cpu->cd.sh.r[7];
+}
+
+X(add_rm_rn_7_15)
+{
+	cpu->cd.sh.r[15] += cpu->cd.sh.r[7];
+}
+
+X(add_rm_rn_8_0)
+{
+	cpu->cd.sh.r[0] += cpu->cd.sh.r[8];
+}
+
+X(add_rm_rn_8_1)
+{
+	cpu->cd.sh.r[1] += cpu->cd.sh.r[8];
+}
+
+X(add_rm_rn_8_2)
+{
+	cpu->cd.sh.r[2] += cpu->cd.sh.r[8];
+}
+
+X(add_rm_rn_8_3)
+{
+	cpu->cd.sh.r[3] += cpu->cd.sh.r[8];
+}
+
+X(add_rm_rn_8_4)
+{
+	cpu->cd.sh.r[4] += cpu->cd.sh.r[8];
+}
+
+X(add_rm_rn_8_5)
+{
+	cpu->cd.sh.r[5] += cpu->cd.sh.r[8];
+}
+
+X(add_rm_rn_8_6)
+{
+	cpu->cd.sh.r[6] += cpu->cd.sh.r[8];
+}
+
+X(add_rm_rn_8_7)
+{
+	cpu->cd.sh.r[7] += cpu->cd.sh.r[8];
+}
+
+X(add_rm_rn_8_8)
+{
+	cpu->cd.sh.r[8] += cpu->cd.sh.r[8];
+}
+
+X(add_rm_rn_8_9)
+{
+	cpu->cd.sh.r[9] += cpu->cd.sh.r[8];
+}
+
+X(add_rm_rn_8_10)
+{
+	cpu->cd.sh.r[10] += cpu->cd.sh.r[8];
+}
+
+X(add_rm_rn_8_11)
+{
+	cpu->cd.sh.r[11] += cpu->cd.sh.r[8];
+}
+
+X(add_rm_rn_8_12)
+{
+	cpu->cd.sh.r[12] += cpu->cd.sh.r[8];
+}
+
+X(add_rm_rn_8_13)
+{
+	cpu->cd.sh.r[13] += cpu->cd.sh.r[8];
+}
+
+X(add_rm_rn_8_14)
+{
+	cpu->cd.sh.r[14] += cpu->cd.sh.r[8];
+}
+
+X(add_rm_rn_8_15)
+{
+	cpu->cd.sh.r[15] += cpu->cd.sh.r[8];
+}
+
+X(add_rm_rn_9_0)
+{
+	cpu->cd.sh.r[0] += cpu->cd.sh.r[9];
+}
+
+X(add_rm_rn_9_1)
+{
+	cpu->cd.sh.r[1] += cpu->cd.sh.r[9];
+}
+
+X(add_rm_rn_9_2)
+{
+	cpu->cd.sh.r[2] += cpu->cd.sh.r[9];
+}
+
+X(add_rm_rn_9_3)
+{
+	cpu->cd.sh.r[3] += cpu->cd.sh.r[9];
+}
+
+X(add_rm_rn_9_4)
+{
+	cpu->cd.sh.r[4] += cpu->cd.sh.r[9];
+}
+
+X(add_rm_rn_9_5)
+{
+	cpu->cd.sh.r[5] += cpu->cd.sh.r[9];
+}
+
+X(add_rm_rn_9_6)
+{
+	cpu->cd.sh.r[6] += cpu->cd.sh.r[9];
+}
+
+X(add_rm_rn_9_7)
+{
+	cpu->cd.sh.r[7] += cpu->cd.sh.r[9];
+}
+
+X(add_rm_rn_9_8)
+{
+	cpu->cd.sh.r[8] += cpu->cd.sh.r[9];
+}
+
+X(add_rm_rn_9_9)
+{
+	cpu->cd.sh.r[9] += cpu->cd.sh.r[9];
+}
+
+X(add_rm_rn_9_10)
+{
+	cpu->cd.sh.r[10] += cpu->cd.sh.r[9];
+}
+
+X(add_rm_rn_9_11)
+{
+	cpu->cd.sh.r[11] += cpu->cd.sh.r[9];
+}
+
+X(add_rm_rn_9_12)
+{
+	cpu->cd.sh.r[12] += cpu->cd.sh.r[9];
+}
+
+X(add_rm_rn_9_13)
+{
+	cpu->cd.sh.r[13] += cpu->cd.sh.r[9];
+}
+
+X(add_rm_rn_9_14)
+{
+	cpu->cd.sh.r[14] += cpu->cd.sh.r[9];
+}
+
+X(add_rm_rn_9_15)
+{
+	cpu->cd.sh.r[15] += cpu->cd.sh.r[9];
+}
+
+X(add_rm_rn_10_0)
+{
+	cpu->cd.sh.r[0] += cpu->cd.sh.r[10];
+}
+
+X(add_rm_rn_10_1)
+{
+	cpu->cd.sh.r[1] += cpu->cd.sh.r[10];
+}
+
+X(add_rm_rn_10_2)
+{
+	cpu->cd.sh.r[2] += cpu->cd.sh.r[10];
+}
+
+X(add_rm_rn_10_3)
+{
+	cpu->cd.sh.r[3] += cpu->cd.sh.r[10];
+}
+
+X(add_rm_rn_10_4)
+{
+	cpu->cd.sh.r[4] += cpu->cd.sh.r[10];
+}
+
+X(add_rm_rn_10_5)
+{
+	cpu->cd.sh.r[5] += cpu->cd.sh.r[10];
+}
+
+X(add_rm_rn_10_6)
+{
+	cpu->cd.sh.r[6] += cpu->cd.sh.r[10];
+}
+
+X(add_rm_rn_10_7)
+{
+	cpu->cd.sh.r[7] += cpu->cd.sh.r[10];
+}
+
+X(add_rm_rn_10_8)
+{
+	cpu->cd.sh.r[8] += cpu->cd.sh.r[10];
+}
+
+X(add_rm_rn_10_9)
+{
+	cpu->cd.sh.r[9] += cpu->cd.sh.r[10];
+}
+
+X(add_rm_rn_10_10)
+{
+	cpu->cd.sh.r[10] += cpu->cd.sh.r[10];
+}
+
+X(add_rm_rn_10_11)
+{
+	cpu->cd.sh.r[11] += cpu->cd.sh.r[10];
+}
+
+X(add_rm_rn_10_12)
+{
+	cpu->cd.sh.r[12] += cpu->cd.sh.r[10];
+}
+
+X(add_rm_rn_10_13)
+{
+	cpu->cd.sh.r[13] += cpu->cd.sh.r[10];
+}
+
+X(add_rm_rn_10_14)
+{
+	cpu->cd.sh.r[14] += cpu->cd.sh.r[10];
+}
+
+X(add_rm_rn_10_15)
+{
+	cpu->cd.sh.r[15] += cpu->cd.sh.r[10];
+}
+
+X(add_rm_rn_11_0)
+{
+	cpu->cd.sh.r[0] += cpu->cd.sh.r[11];
+}
+
+X(add_rm_rn_11_1)
+{
+	cpu->cd.sh.r[1] += cpu->cd.sh.r[11];
+}
+
+X(add_rm_rn_11_2)
+{
+	cpu->cd.sh.r[2] += cpu->cd.sh.r[11];
+}
+
+X(add_rm_rn_11_3)
+{
+	cpu->cd.sh.r[3] += cpu->cd.sh.r[11];
+}
+
+X(add_rm_rn_11_4)
+{
+	cpu->cd.sh.r[4] += cpu->cd.sh.r[11];
+}
+
+X(add_rm_rn_11_5)
+{
+	cpu->cd.sh.r[5] += cpu->cd.sh.r[11];
+}
+
+X(add_rm_rn_11_6)
+{
+	cpu->cd.sh.r[6] += cpu->cd.sh.r[11];
+}
+
+X(add_rm_rn_11_7)
+{
+	cpu->cd.sh.r[7] += cpu->cd.sh.r[11];
+}
+
+X(add_rm_rn_11_8)
+{
+	cpu->cd.sh.r[8] += cpu->cd.sh.r[11];
+}
+
+X(add_rm_rn_11_9)
+{
+	cpu->cd.sh.r[9] += cpu->cd.sh.r[11];
+}
+
+X(add_rm_rn_11_10)
+{
+	cpu->cd.sh.r[10] += cpu->cd.sh.r[11];
+}
+
+X(add_rm_rn_11_11)
+{
+	cpu->cd.sh.r[11] += cpu->cd.sh.r[11];
+}
+
+X(add_rm_rn_11_12)
+{
+	cpu->cd.sh.r[12] += cpu->cd.sh.r[11];
+}
+
+X(add_rm_rn_11_13)
+{
+	cpu->cd.sh.r[13] += cpu->cd.sh.r[11];
+}
+
+X(add_rm_rn_11_14)
+{
+	cpu->cd.sh.r[14] += cpu->cd.sh.r[11];
+}
+
+X(add_rm_rn_11_15)
+{
+	cpu->cd.sh.r[15] += cpu->cd.sh.r[11];
+}
+
+X(add_rm_rn_12_0)
+{
+	cpu->cd.sh.r[0] += cpu->cd.sh.r[12];
+}
+
+X(add_rm_rn_12_1)
+{
+	cpu->cd.sh.r[1] += cpu->cd.sh.r[12];
+}
+
+X(add_rm_rn_12_2)
+{
+	cpu->cd.sh.r[2] += cpu->cd.sh.r[12];
+}
+
+X(add_rm_rn_12_3)
+{
+	cpu->cd.sh.r[3] += cpu->cd.sh.r[12];
+}
+
+X(add_rm_rn_12_4)
+{
+	cpu->cd.sh.r[4] += cpu->cd.sh.r[12];
+}
+
+X(add_rm_rn_12_5)
+{
+	cpu->cd.sh.r[5] += cpu->cd.sh.r[12];
+}
+
+X(add_rm_rn_12_6)
+{
+	cpu->cd.sh.r[6] += cpu->cd.sh.r[12];
+}
+
+X(add_rm_rn_12_7)
+{
+	cpu->cd.sh.r[7] += cpu->cd.sh.r[12];
+}
+
+X(add_rm_rn_12_8)
+{
+	cpu->cd.sh.r[8] += cpu->cd.sh.r[12];
+}
+
+X(add_rm_rn_12_9)
+{
+	cpu->cd.sh.r[9] += cpu->cd.sh.r[12];
+}
+
+X(add_rm_rn_12_10)
+{
+	cpu->cd.sh.r[10] += cpu->cd.sh.r[12];
+}
+
+X(add_rm_rn_12_11)
+{
+	cpu->cd.sh.r[11] += cpu->cd.sh.r[12];
+}
+
+X(add_rm_rn_12_12)
+{
+	cpu->cd.sh.r[12] += cpu->cd.sh.r[12];
+}
+
+X(add_rm_rn_12_13)
+{
+	cpu->cd.sh.r[13] += cpu->cd.sh.r[12];
+}
+
+X(add_rm_rn_12_14)
+{
+	cpu->cd.sh.r[14] += cpu->cd.sh.r[12];
+}
+
+X(add_rm_rn_12_15)
+{
+	cpu->cd.sh.r[15] += cpu->cd.sh.r[12];
+}
+
+X(add_rm_rn_13_0)
+{
+	cpu->cd.sh.r[0] += cpu->cd.sh.r[13];
+}
+
+X(add_rm_rn_13_1)
+{
+	cpu->cd.sh.r[1] += cpu->cd.sh.r[13];
+}
+
+X(add_rm_rn_13_2)
+{
+	cpu->cd.sh.r[2] += cpu->cd.sh.r[13];
+}
+
+X(add_rm_rn_13_3)
+{
+	cpu->cd.sh.r[3] += cpu->cd.sh.r[13];
+}
+
+X(add_rm_rn_13_4)
+{
+	cpu->cd.sh.r[4] += cpu->cd.sh.r[13];
+}
+
+X(add_rm_rn_13_5)
+{
+	cpu->cd.sh.r[5] += cpu->cd.sh.r[13];
+}
+
+X(add_rm_rn_13_6)
+{
+	cpu->cd.sh.r[6] += cpu->cd.sh.r[13];
+}
+
+X(add_rm_rn_13_7)
+{
+	cpu->cd.sh.r[7] += cpu->cd.sh.r[13];
+}
+
+X(add_rm_rn_13_8)
+{
+	cpu->cd.sh.r[8] += cpu->cd.sh.r[13];
+}
+
+X(add_rm_rn_13_9)
+{
+	cpu->cd.sh.r[9] += cpu->cd.sh.r[13];
+}
+
+X(add_rm_rn_13_10)
+{
+	cpu->cd.sh.r[10] += cpu->cd.sh.r[13];
+}
+
+X(add_rm_rn_13_11)
+{
+	cpu->cd.sh.r[11] += cpu->cd.sh.r[13];
+}
+
+X(add_rm_rn_13_12)
+{
+	cpu->cd.sh.r[12] += cpu->cd.sh.r[13];
+}
+
+X(add_rm_rn_13_13)
+{
+	cpu->cd.sh.r[13] += cpu->cd.sh.r[13];
+}
+
+X(add_rm_rn_13_14)
+{
+	cpu->cd.sh.r[14] += cpu->cd.sh.r[13];
+}
+
+X(add_rm_rn_13_15)
+{
+	cpu->cd.sh.r[15] += cpu->cd.sh.r[13];
+}
+
+X(add_rm_rn_14_0)
+{
+	cpu->cd.sh.r[0] += cpu->cd.sh.r[14];
+}
+
+X(add_rm_rn_14_1)
+{
+	cpu->cd.sh.r[1] += cpu->cd.sh.r[14];
+}
+
+X(add_rm_rn_14_2)
+{
+	cpu->cd.sh.r[2] += cpu->cd.sh.r[14];
+}
+
+X(add_rm_rn_14_3)
+{
+	cpu->cd.sh.r[3] += cpu->cd.sh.r[14];
+}
+
+X(add_rm_rn_14_4)
+{
+	cpu->cd.sh.r[4] += cpu->cd.sh.r[14];
+}
+
+X(add_rm_rn_14_5)
+{
+	cpu->cd.sh.r[5] += cpu->cd.sh.r[14];
+}
+
+X(add_rm_rn_14_6)
+{
+	cpu->cd.sh.r[6] += cpu->cd.sh.r[14];
+}
+
+X(add_rm_rn_14_7)
+{
+	cpu->cd.sh.r[7] += cpu->cd.sh.r[14];
+}
+
+X(add_rm_rn_14_8)
+{
+	cpu->cd.sh.r[8] += cpu->cd.sh.r[14];
+}
+
+X(add_rm_rn_14_9)
+{
+	cpu->cd.sh.r[9] += cpu->cd.sh.r[14];
+}
+
+X(add_rm_rn_14_10)
+{
+	cpu->cd.sh.r[10] += cpu->cd.sh.r[14];
+}
+
+X(add_rm_rn_14_11)
+{
+	cpu->cd.sh.r[11] += cpu->cd.sh.r[14];
+}
+
+X(add_rm_rn_14_12)
+{
+	cpu->cd.sh.r[12] += cpu->cd.sh.r[14];
+}
+
+X(add_rm_rn_14_13)
+{
+	cpu->cd.sh.r[13] += cpu->cd.sh.r[14];
+}
+
+X(add_rm_rn_14_14)
+{
+	cpu->cd.sh.r[14] += cpu->cd.sh.r[14];
+}
+
+X(add_rm_rn_14_15)
+{
+	cpu->cd.sh.r[15] += cpu->cd.sh.r[14];
+}
+
+X(add_rm_rn_15_0)
+{
+	cpu->cd.sh.r[0] += cpu->cd.sh.r[15];
+}
+
+X(add_rm_rn_15_1)
+{
+	cpu->cd.sh.r[1] += cpu->cd.sh.r[15];
+}
+
+X(add_rm_rn_15_2)
+{
+	cpu->cd.sh.r[2] += cpu->cd.sh.r[15];
+}
+
+X(add_rm_rn_15_3)
+{
+	cpu->cd.sh.r[3] += cpu->cd.sh.r[15];
+}
+
+X(add_rm_rn_15_4)
+{
+	cpu->cd.sh.r[4] += cpu->cd.sh.r[15];
+}
+
+X(add_rm_rn_15_5)
+{
+	cpu->cd.sh.r[5] += cpu->cd.sh.r[15];
+}
+
+X(add_rm_rn_15_6)
+{
+	cpu->cd.sh.r[6] += cpu->cd.sh.r[15];
+}
+
+X(add_rm_rn_15_7)
+{
+	cpu->cd.sh.r[7] += cpu->cd.sh.r[15];
+}
+
+X(add_rm_rn_15_8)
+{
+	cpu->cd.sh.r[8] += cpu->cd.sh.r[15];
+}
+
+X(add_rm_rn_15_9)
+{
+	cpu->cd.sh.r[9] += cpu->cd.sh.r[15];
+}
+
+X(add_rm_rn_15_10)
+{
+	cpu->cd.sh.r[10] += cpu->cd.sh.r[15];
+}
+
+X(add_rm_rn_15_11)
+{
+	cpu->cd.sh.r[11] += cpu->cd.sh.r[15];
+}
+
+X(add_rm_rn_15_12)
+{
+	cpu->cd.sh.r[12] += cpu->cd.sh.r[15];
+}
+
+X(add_rm_rn_15_13)
+{
+	cpu->cd.sh.r[13] += cpu->cd.sh.r[15];
+}
+
+X(add_rm_rn_15_14)
+{
+	cpu->cd.sh.r[14] += cpu->cd.sh.r[15];
+}
+
+X(add_rm_rn_15_15)
+{
+	cpu->cd.sh.r[15] += cpu->cd.sh.r[15];
+}
+
+X(tst_rm_rn_0_0)
+{
+	if ((cpu->cd.sh.r[0] & cpu->cd.sh.r[0]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_0_1)
+{
+	if ((cpu->cd.sh.r[1] & cpu->cd.sh.r[0]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_0_2)
+{
+	if ((cpu->cd.sh.r[2] & cpu->cd.sh.r[0]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_0_3)
+{
+	if ((cpu->cd.sh.r[3] & cpu->cd.sh.r[0]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_0_4)
+{
+	if ((cpu->cd.sh.r[4] & cpu->cd.sh.r[0]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_0_5)
+{
+	if ((cpu->cd.sh.r[5] & cpu->cd.sh.r[0]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_0_6)
+{
+	if ((cpu->cd.sh.r[6] & cpu->cd.sh.r[0]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_0_7)
+{
+	if ((cpu->cd.sh.r[7] & cpu->cd.sh.r[0]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_0_8)
+{
+	if ((cpu->cd.sh.r[8] & cpu->cd.sh.r[0]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_0_9)
+{
+	if ((cpu->cd.sh.r[9] & cpu->cd.sh.r[0]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_0_10)
+{
+	if ((cpu->cd.sh.r[10] & cpu->cd.sh.r[0]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_0_11)
+{
+	if ((cpu->cd.sh.r[11] & cpu->cd.sh.r[0]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_0_12)
+{
+	if ((cpu->cd.sh.r[12] & cpu->cd.sh.r[0]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_0_13)
+{
+	if ((cpu->cd.sh.r[13] & cpu->cd.sh.r[0]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_0_14)
+{
+	if ((cpu->cd.sh.r[14] & cpu->cd.sh.r[0]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_0_15)
+{
+	if ((cpu->cd.sh.r[15] & cpu->cd.sh.r[0]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_1_0)
+{
+	if ((cpu->cd.sh.r[0] & cpu->cd.sh.r[1]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_1_1)
+{
+	if ((cpu->cd.sh.r[1] & cpu->cd.sh.r[1]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_1_2)
+{
+	if ((cpu->cd.sh.r[2] & cpu->cd.sh.r[1]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_1_3)
+{
+	if ((cpu->cd.sh.r[3] & cpu->cd.sh.r[1]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_1_4)
+{
+	if ((cpu->cd.sh.r[4] & cpu->cd.sh.r[1]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_1_5)
+{
+	if ((cpu->cd.sh.r[5] & cpu->cd.sh.r[1]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_1_6)
+{
+	if ((cpu->cd.sh.r[6] & cpu->cd.sh.r[1]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_1_7)
+{
+	if ((cpu->cd.sh.r[7] & cpu->cd.sh.r[1]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_1_8)
+{
+	if ((cpu->cd.sh.r[8] & cpu->cd.sh.r[1]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_1_9)
+{
+	if ((cpu->cd.sh.r[9] & cpu->cd.sh.r[1]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_1_10)
+{
+	if ((cpu->cd.sh.r[10] & cpu->cd.sh.r[1]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_1_11)
+{
+	if ((cpu->cd.sh.r[11] & cpu->cd.sh.r[1]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_1_12)
+{
+	if ((cpu->cd.sh.r[12] & cpu->cd.sh.r[1]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_1_13)
+{
+	if ((cpu->cd.sh.r[13] & cpu->cd.sh.r[1]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_1_14)
+{
+	if ((cpu->cd.sh.r[14] & cpu->cd.sh.r[1]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_1_15)
+{
+	if ((cpu->cd.sh.r[15] & cpu->cd.sh.r[1]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_2_0)
+{
+	if ((cpu->cd.sh.r[0] & cpu->cd.sh.r[2]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_2_1)
+{
+	if ((cpu->cd.sh.r[1] & cpu->cd.sh.r[2]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_2_2)
+{
+	if ((cpu->cd.sh.r[2] & cpu->cd.sh.r[2]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_2_3)
+{
+	if ((cpu->cd.sh.r[3] & cpu->cd.sh.r[2]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_2_4)
+{
+	if ((cpu->cd.sh.r[4] & cpu->cd.sh.r[2]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_2_5)
+{
+	if ((cpu->cd.sh.r[5] & cpu->cd.sh.r[2]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_2_6)
+{
+	if ((cpu->cd.sh.r[6] & cpu->cd.sh.r[2]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_2_7)
+{
+	if ((cpu->cd.sh.r[7] & cpu->cd.sh.r[2]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_2_8)
+{
+	if ((cpu->cd.sh.r[8] & cpu->cd.sh.r[2]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_2_9)
+{
+	if ((cpu->cd.sh.r[9] & cpu->cd.sh.r[2]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_2_10)
+{
+	if ((cpu->cd.sh.r[10] & cpu->cd.sh.r[2]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_2_11)
+{
+	if ((cpu->cd.sh.r[11] & cpu->cd.sh.r[2]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_2_12)
+{
+	if ((cpu->cd.sh.r[12] & cpu->cd.sh.r[2]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_2_13)
+{
+	if ((cpu->cd.sh.r[13] & cpu->cd.sh.r[2]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_2_14)
+{
+	if ((cpu->cd.sh.r[14] & cpu->cd.sh.r[2]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_2_15)
+{
+	if ((cpu->cd.sh.r[15] & cpu->cd.sh.r[2]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_3_0)
+{
+	if ((cpu->cd.sh.r[0] & cpu->cd.sh.r[3]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_3_1)
+{
+	if ((cpu->cd.sh.r[1] & cpu->cd.sh.r[3]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_3_2)
+{
+	if ((cpu->cd.sh.r[2] & cpu->cd.sh.r[3]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_3_3)
+{
+	if ((cpu->cd.sh.r[3] & cpu->cd.sh.r[3]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_3_4)
+{
+	if ((cpu->cd.sh.r[4] & cpu->cd.sh.r[3]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_3_5)
+{
+	if ((cpu->cd.sh.r[5] & cpu->cd.sh.r[3]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_3_6)
+{
+	if ((cpu->cd.sh.r[6] & cpu->cd.sh.r[3]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_3_7)
+{
+	if ((cpu->cd.sh.r[7] & cpu->cd.sh.r[3]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_3_8)
+{
+	if ((cpu->cd.sh.r[8] & cpu->cd.sh.r[3]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_3_9)
+{
+	if ((cpu->cd.sh.r[9] & cpu->cd.sh.r[3]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_3_10)
+{
+	if ((cpu->cd.sh.r[10] & cpu->cd.sh.r[3]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_3_11)
+{
+	if ((cpu->cd.sh.r[11] & cpu->cd.sh.r[3]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_3_12)
+{
+	if ((cpu->cd.sh.r[12] & cpu->cd.sh.r[3]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_3_13)
+{
+	if ((cpu->cd.sh.r[13] & cpu->cd.sh.r[3]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_3_14)
+{
+	if ((cpu->cd.sh.r[14] & cpu->cd.sh.r[3]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_3_15)
+{
+	if ((cpu->cd.sh.r[15] & cpu->cd.sh.r[3]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_4_0)
+{
+	if ((cpu->cd.sh.r[0] & cpu->cd.sh.r[4]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_4_1)
+{
+	if ((cpu->cd.sh.r[1] & cpu->cd.sh.r[4]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_4_2)
+{
+	if ((cpu->cd.sh.r[2] & cpu->cd.sh.r[4]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_4_3)
+{
+	if ((cpu->cd.sh.r[3] & cpu->cd.sh.r[4]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_4_4)
+{
+	if ((cpu->cd.sh.r[4] & cpu->cd.sh.r[4]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_4_5)
+{
+	if ((cpu->cd.sh.r[5] & cpu->cd.sh.r[4]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_4_6)
+{
+	if ((cpu->cd.sh.r[6] & cpu->cd.sh.r[4]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_4_7)
+{
+	if ((cpu->cd.sh.r[7] & cpu->cd.sh.r[4]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_4_8)
+{
+	if ((cpu->cd.sh.r[8] & cpu->cd.sh.r[4]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_4_9)
+{
+	if ((cpu->cd.sh.r[9] & cpu->cd.sh.r[4]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_4_10)
+{
+	if ((cpu->cd.sh.r[10] & cpu->cd.sh.r[4]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_4_11)
+{
+	if ((cpu->cd.sh.r[11] & cpu->cd.sh.r[4]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_4_12)
+{
+	if ((cpu->cd.sh.r[12] & cpu->cd.sh.r[4]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_4_13)
+{
+	if ((cpu->cd.sh.r[13] & cpu->cd.sh.r[4]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_4_14)
+{
+	if ((cpu->cd.sh.r[14] & cpu->cd.sh.r[4]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_4_15)
+{
+	if ((cpu->cd.sh.r[15] & cpu->cd.sh.r[4]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_5_0)
+{
+	if ((cpu->cd.sh.r[0] & cpu->cd.sh.r[5]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_5_1)
+{
+	if ((cpu->cd.sh.r[1] & cpu->cd.sh.r[5]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_5_2)
+{
+	if ((cpu->cd.sh.r[2] & cpu->cd.sh.r[5]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_5_3)
+{
+	if ((cpu->cd.sh.r[3] & cpu->cd.sh.r[5]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_5_4)
+{
+	if ((cpu->cd.sh.r[4] & cpu->cd.sh.r[5]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_5_5)
+{
+	if ((cpu->cd.sh.r[5] & cpu->cd.sh.r[5]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_5_6)
+{
+	if ((cpu->cd.sh.r[6] & cpu->cd.sh.r[5]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_5_7)
+{
+	if ((cpu->cd.sh.r[7] & cpu->cd.sh.r[5]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_5_8)
+{
+	if ((cpu->cd.sh.r[8] & cpu->cd.sh.r[5]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_5_9)
+{
+	if ((cpu->cd.sh.r[9] & cpu->cd.sh.r[5]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_5_10)
+{
+	if ((cpu->cd.sh.r[10] & cpu->cd.sh.r[5]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_5_11)
+{
+	if ((cpu->cd.sh.r[11] & cpu->cd.sh.r[5]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_5_12)
+{
+	if ((cpu->cd.sh.r[12] & cpu->cd.sh.r[5]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_5_13)
+{
+	if ((cpu->cd.sh.r[13] & cpu->cd.sh.r[5]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_5_14)
+{
+	if ((cpu->cd.sh.r[14] & cpu->cd.sh.r[5]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_5_15)
+{
+	if ((cpu->cd.sh.r[15] & cpu->cd.sh.r[5]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_6_0)
+{
+	if ((cpu->cd.sh.r[0] & cpu->cd.sh.r[6]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_6_1)
+{
+	if ((cpu->cd.sh.r[1] & cpu->cd.sh.r[6]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_6_2)
+{
+	if ((cpu->cd.sh.r[2] & cpu->cd.sh.r[6]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_6_3)
+{
+	if ((cpu->cd.sh.r[3] & cpu->cd.sh.r[6]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_6_4)
+{
+	if ((cpu->cd.sh.r[4] & cpu->cd.sh.r[6]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_6_5)
+{
+	if ((cpu->cd.sh.r[5] & cpu->cd.sh.r[6]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_6_6)
+{
+	if ((cpu->cd.sh.r[6] & cpu->cd.sh.r[6]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_6_7)
+{
+	if ((cpu->cd.sh.r[7] & cpu->cd.sh.r[6]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_6_8)
+{
+	if ((cpu->cd.sh.r[8] & cpu->cd.sh.r[6]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_6_9)
+{
+	if ((cpu->cd.sh.r[9] & cpu->cd.sh.r[6]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_6_10)
+{
+	if ((cpu->cd.sh.r[10] & cpu->cd.sh.r[6]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_6_11)
+{
+	if ((cpu->cd.sh.r[11] & cpu->cd.sh.r[6]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_6_12)
+{
+	if ((cpu->cd.sh.r[12] & cpu->cd.sh.r[6]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_6_13)
+{
+	if ((cpu->cd.sh.r[13] & cpu->cd.sh.r[6]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_6_14)
+{
+	if ((cpu->cd.sh.r[14] & cpu->cd.sh.r[6]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_6_15)
+{
+	if ((cpu->cd.sh.r[15] & cpu->cd.sh.r[6]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_7_0)
+{
+	if ((cpu->cd.sh.r[0] & cpu->cd.sh.r[7]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_7_1)
+{
+	if ((cpu->cd.sh.r[1] & cpu->cd.sh.r[7]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_7_2)
+{
+	if ((cpu->cd.sh.r[2] & cpu->cd.sh.r[7]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_7_3)
+{
+	if ((cpu->cd.sh.r[3] & cpu->cd.sh.r[7]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_7_4)
+{
+	if ((cpu->cd.sh.r[4] & cpu->cd.sh.r[7]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_7_5)
+{
+	if ((cpu->cd.sh.r[5] & cpu->cd.sh.r[7]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_7_6)
+{
+	if ((cpu->cd.sh.r[6] & cpu->cd.sh.r[7]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_7_7)
+{
+	if ((cpu->cd.sh.r[7] & cpu->cd.sh.r[7]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_7_8)
+{
+	if ((cpu->cd.sh.r[8] & cpu->cd.sh.r[7]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_7_9)
+{
+	if ((cpu->cd.sh.r[9] & cpu->cd.sh.r[7]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_7_10)
+{
+	if ((cpu->cd.sh.r[10] & cpu->cd.sh.r[7]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_7_11)
+{
+	if ((cpu->cd.sh.r[11] & cpu->cd.sh.r[7]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_7_12)
+{
+	if ((cpu->cd.sh.r[12] & cpu->cd.sh.r[7]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_7_13)
+{
+	if ((cpu->cd.sh.r[13] & cpu->cd.sh.r[7]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_7_14)
+{
+	if ((cpu->cd.sh.r[14] & cpu->cd.sh.r[7]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_7_15)
+{
+	if ((cpu->cd.sh.r[15] & cpu->cd.sh.r[7]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_8_0)
+{
+	if ((cpu->cd.sh.r[0] & cpu->cd.sh.r[8]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_8_1)
+{
+	if ((cpu->cd.sh.r[1] & cpu->cd.sh.r[8]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_8_2)
+{
+	if ((cpu->cd.sh.r[2] & cpu->cd.sh.r[8]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_8_3)
+{
+	if ((cpu->cd.sh.r[3] & cpu->cd.sh.r[8]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_8_4)
+{
+	if ((cpu->cd.sh.r[4] & cpu->cd.sh.r[8]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_8_5)
+{
+	if ((cpu->cd.sh.r[5] & cpu->cd.sh.r[8]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_8_6)
+{
+	if ((cpu->cd.sh.r[6] & cpu->cd.sh.r[8]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_8_7)
+{
+	if ((cpu->cd.sh.r[7] & cpu->cd.sh.r[8]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_8_8)
+{
+	if ((cpu->cd.sh.r[8] & cpu->cd.sh.r[8]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_8_9)
+{
+	if ((cpu->cd.sh.r[9] & cpu->cd.sh.r[8]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_8_10)
+{
+	if ((cpu->cd.sh.r[10] & cpu->cd.sh.r[8]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_8_11)
+{
+	if ((cpu->cd.sh.r[11] & cpu->cd.sh.r[8]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_8_12)
+{
+	if ((cpu->cd.sh.r[12] & cpu->cd.sh.r[8]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_8_13)
+{
+	if ((cpu->cd.sh.r[13] & cpu->cd.sh.r[8]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_8_14)
+{
+	if ((cpu->cd.sh.r[14] & cpu->cd.sh.r[8]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_8_15)
+{
+	if ((cpu->cd.sh.r[15] & cpu->cd.sh.r[8]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_9_0)
+{
+	if ((cpu->cd.sh.r[0] & cpu->cd.sh.r[9]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_9_1)
+{
+	if ((cpu->cd.sh.r[1] & cpu->cd.sh.r[9]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_9_2)
+{
+	if ((cpu->cd.sh.r[2] & cpu->cd.sh.r[9]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_9_3)
+{
+	if ((cpu->cd.sh.r[3] & cpu->cd.sh.r[9]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_9_4)
+{
+	if ((cpu->cd.sh.r[4] & cpu->cd.sh.r[9]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_9_5)
+{
+	if ((cpu->cd.sh.r[5] & cpu->cd.sh.r[9]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_9_6)
+{
+	if ((cpu->cd.sh.r[6] & cpu->cd.sh.r[9]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_9_7)
+{
+	if ((cpu->cd.sh.r[7] & cpu->cd.sh.r[9]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_9_8)
+{
+	if ((cpu->cd.sh.r[8] & cpu->cd.sh.r[9]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_9_9)
+{
+	if ((cpu->cd.sh.r[9] & cpu->cd.sh.r[9]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_9_10)
+{
+	if ((cpu->cd.sh.r[10] & cpu->cd.sh.r[9]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_9_11)
+{
+	if ((cpu->cd.sh.r[11] & cpu->cd.sh.r[9]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_9_12)
+{
+	if ((cpu->cd.sh.r[12] & cpu->cd.sh.r[9]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_9_13)
+{
+	if ((cpu->cd.sh.r[13] & cpu->cd.sh.r[9]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_9_14)
+{
+	if ((cpu->cd.sh.r[14] & cpu->cd.sh.r[9]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_9_15)
+{
+	if ((cpu->cd.sh.r[15] & cpu->cd.sh.r[9]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_10_0)
+{
+	if ((cpu->cd.sh.r[0] & cpu->cd.sh.r[10]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_10_1)
+{
+	if ((cpu->cd.sh.r[1] & cpu->cd.sh.r[10]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_10_2)
+{
+	if ((cpu->cd.sh.r[2] & cpu->cd.sh.r[10]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_10_3)
+{
+	if ((cpu->cd.sh.r[3] & cpu->cd.sh.r[10]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_10_4)
+{
+	if ((cpu->cd.sh.r[4] & cpu->cd.sh.r[10]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_10_5)
+{
+	if ((cpu->cd.sh.r[5] & cpu->cd.sh.r[10]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_10_6)
+{
+	if ((cpu->cd.sh.r[6] & cpu->cd.sh.r[10]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_10_7)
+{
+	if ((cpu->cd.sh.r[7] & cpu->cd.sh.r[10]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_10_8)
+{
+	if ((cpu->cd.sh.r[8] & cpu->cd.sh.r[10]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_10_9)
+{
+	if ((cpu->cd.sh.r[9] & cpu->cd.sh.r[10]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_10_10)
+{
+	if ((cpu->cd.sh.r[10] & cpu->cd.sh.r[10]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_10_11)
+{
+	if ((cpu->cd.sh.r[11] & cpu->cd.sh.r[10]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_10_12)
+{
+	if ((cpu->cd.sh.r[12] & cpu->cd.sh.r[10]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_10_13)
+{
+	if ((cpu->cd.sh.r[13] & cpu->cd.sh.r[10]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_10_14)
+{
+	if ((cpu->cd.sh.r[14] & cpu->cd.sh.r[10]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_10_15)
+{
+	if ((cpu->cd.sh.r[15] & cpu->cd.sh.r[10]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_11_0)
+{
+	if ((cpu->cd.sh.r[0] & cpu->cd.sh.r[11]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_11_1)
+{
+	if ((cpu->cd.sh.r[1] & cpu->cd.sh.r[11]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_11_2)
+{
+	if ((cpu->cd.sh.r[2] & cpu->cd.sh.r[11]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_11_3)
+{
+	if ((cpu->cd.sh.r[3] & cpu->cd.sh.r[11]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_11_4)
+{
+	if ((cpu->cd.sh.r[4] & cpu->cd.sh.r[11]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_11_5)
+{
+	if ((cpu->cd.sh.r[5] & cpu->cd.sh.r[11]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_11_6)
+{
+	if ((cpu->cd.sh.r[6] & cpu->cd.sh.r[11]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_11_7)
+{
+	if ((cpu->cd.sh.r[7] & cpu->cd.sh.r[11]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_11_8)
+{
+	if ((cpu->cd.sh.r[8] & cpu->cd.sh.r[11]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_11_9)
+{
+	if ((cpu->cd.sh.r[9] & cpu->cd.sh.r[11]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_11_10)
+{
+	if ((cpu->cd.sh.r[10] & cpu->cd.sh.r[11]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_11_11)
+{
+	if ((cpu->cd.sh.r[11] & cpu->cd.sh.r[11]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_11_12)
+{
+	if ((cpu->cd.sh.r[12] & cpu->cd.sh.r[11]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_11_13)
+{
+	if ((cpu->cd.sh.r[13] & cpu->cd.sh.r[11]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_11_14)
+{
+	if ((cpu->cd.sh.r[14] & cpu->cd.sh.r[11]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_11_15)
+{
+	if ((cpu->cd.sh.r[15] & cpu->cd.sh.r[11]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_12_0)
+{
+	if ((cpu->cd.sh.r[0] & cpu->cd.sh.r[12]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_12_1)
+{
+	if ((cpu->cd.sh.r[1] & cpu->cd.sh.r[12]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_12_2)
+{
+	if ((cpu->cd.sh.r[2] & cpu->cd.sh.r[12]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_12_3)
+{
+	if ((cpu->cd.sh.r[3] & cpu->cd.sh.r[12]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_12_4)
+{
+	if ((cpu->cd.sh.r[4] & cpu->cd.sh.r[12]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_12_5)
+{
+	if ((cpu->cd.sh.r[5] & cpu->cd.sh.r[12]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_12_6)
+{
+	if ((cpu->cd.sh.r[6] & cpu->cd.sh.r[12]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_12_7)
+{
+	if ((cpu->cd.sh.r[7] & cpu->cd.sh.r[12]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_12_8)
+{
+	if ((cpu->cd.sh.r[8] & cpu->cd.sh.r[12]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_12_9)
+{
+	if ((cpu->cd.sh.r[9] & cpu->cd.sh.r[12]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_12_10)
+{
+	if ((cpu->cd.sh.r[10] & cpu->cd.sh.r[12]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_12_11)
+{
+	if ((cpu->cd.sh.r[11] & cpu->cd.sh.r[12]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_12_12)
+{
+	if ((cpu->cd.sh.r[12] & cpu->cd.sh.r[12]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_12_13)
+{
+	if ((cpu->cd.sh.r[13] & cpu->cd.sh.r[12]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_12_14)
+{
+	if ((cpu->cd.sh.r[14] & cpu->cd.sh.r[12]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_12_15)
+{
+	if ((cpu->cd.sh.r[15] & cpu->cd.sh.r[12]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_13_0)
+{
+	if ((cpu->cd.sh.r[0] & cpu->cd.sh.r[13]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_13_1)
+{
+	if ((cpu->cd.sh.r[1] & cpu->cd.sh.r[13]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_13_2)
+{
+	if ((cpu->cd.sh.r[2] & cpu->cd.sh.r[13]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_13_3)
+{
+	if ((cpu->cd.sh.r[3] & cpu->cd.sh.r[13]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_13_4)
+{
+	if ((cpu->cd.sh.r[4] & cpu->cd.sh.r[13]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_13_5)
+{
+	if ((cpu->cd.sh.r[5] & cpu->cd.sh.r[13]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_13_6)
+{
+	if ((cpu->cd.sh.r[6] & cpu->cd.sh.r[13]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_13_7)
+{
+	if ((cpu->cd.sh.r[7] & cpu->cd.sh.r[13]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_13_8)
+{
+	if ((cpu->cd.sh.r[8] & cpu->cd.sh.r[13]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_13_9)
+{
+	if ((cpu->cd.sh.r[9] & cpu->cd.sh.r[13]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_13_10)
+{
+	if ((cpu->cd.sh.r[10] & cpu->cd.sh.r[13]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_13_11)
+{
+	if ((cpu->cd.sh.r[11] & cpu->cd.sh.r[13]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_13_12)
+{
+	if ((cpu->cd.sh.r[12] & cpu->cd.sh.r[13]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_13_13)
+{
+	if ((cpu->cd.sh.r[13] & cpu->cd.sh.r[13]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_13_14)
+{
+	if ((cpu->cd.sh.r[14] & cpu->cd.sh.r[13]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_13_15)
+{
+	if ((cpu->cd.sh.r[15] & cpu->cd.sh.r[13]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_14_0)
+{
+	if ((cpu->cd.sh.r[0] & cpu->cd.sh.r[14]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_14_1)
+{
+	if ((cpu->cd.sh.r[1] & cpu->cd.sh.r[14]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_14_2)
+{
+	if ((cpu->cd.sh.r[2] & cpu->cd.sh.r[14]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_14_3)
+{
+	if ((cpu->cd.sh.r[3] & cpu->cd.sh.r[14]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_14_4)
+{
+	if ((cpu->cd.sh.r[4] & cpu->cd.sh.r[14]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_14_5)
+{
+	if ((cpu->cd.sh.r[5] & cpu->cd.sh.r[14]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_14_6)
+{
+	if ((cpu->cd.sh.r[6] & cpu->cd.sh.r[14]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_14_7)
+{
+	if ((cpu->cd.sh.r[7] & cpu->cd.sh.r[14]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_14_8)
+{
+	if ((cpu->cd.sh.r[8] & cpu->cd.sh.r[14]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_14_9)
+{
+	if ((cpu->cd.sh.r[9] & cpu->cd.sh.r[14]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_14_10)
+{
+	if ((cpu->cd.sh.r[10] & cpu->cd.sh.r[14]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_14_11)
+{
+	if ((cpu->cd.sh.r[11] & cpu->cd.sh.r[14]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_14_12)
+{
+	if ((cpu->cd.sh.r[12] & cpu->cd.sh.r[14]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_14_13)
+{
+	if ((cpu->cd.sh.r[13] & cpu->cd.sh.r[14]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_14_14)
+{
+	if ((cpu->cd.sh.r[14] & cpu->cd.sh.r[14]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_14_15)
+{
+	if ((cpu->cd.sh.r[15] & cpu->cd.sh.r[14]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_15_0)
+{
+	if ((cpu->cd.sh.r[0] & cpu->cd.sh.r[15]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_15_1)
+{
+	if ((cpu->cd.sh.r[1] & cpu->cd.sh.r[15]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_15_2)
+{
+	if ((cpu->cd.sh.r[2] & cpu->cd.sh.r[15]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_15_3)
+{
+	if ((cpu->cd.sh.r[3] & cpu->cd.sh.r[15]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_15_4)
+{
+	if ((cpu->cd.sh.r[4] & cpu->cd.sh.r[15]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_15_5)
+{
+	if ((cpu->cd.sh.r[5] & cpu->cd.sh.r[15]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_15_6)
+{
+	if ((cpu->cd.sh.r[6] & cpu->cd.sh.r[15]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_15_7)
+{
+	if ((cpu->cd.sh.r[7] & cpu->cd.sh.r[15]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_15_8)
+{
+	if ((cpu->cd.sh.r[8] & cpu->cd.sh.r[15]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_15_9)
+{
+	if ((cpu->cd.sh.r[9] & cpu->cd.sh.r[15]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_15_10)
+{
+	if ((cpu->cd.sh.r[10] & cpu->cd.sh.r[15]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_15_11)
+{
+	if ((cpu->cd.sh.r[11] & cpu->cd.sh.r[15]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_15_12)
+{
+	if ((cpu->cd.sh.r[12] & cpu->cd.sh.r[15]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_15_13)
+{
+	if ((cpu->cd.sh.r[13] & cpu->cd.sh.r[15]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_15_14)
+{
+	if ((cpu->cd.sh.r[14] & cpu->cd.sh.r[15]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(tst_rm_rn_15_15)
+{
+	if ((cpu->cd.sh.r[15] & cpu->cd.sh.r[15]) == 0)
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_0_0)
+{
+	if (cpu->cd.sh.r[0] == cpu->cd.sh.r[0])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_0_1)
+{
+	if (cpu->cd.sh.r[1] == cpu->cd.sh.r[0])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_0_2)
+{
+	if (cpu->cd.sh.r[2] == cpu->cd.sh.r[0])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_0_3)
+{
+	if (cpu->cd.sh.r[3] == cpu->cd.sh.r[0])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_0_4)
+{
+	if (cpu->cd.sh.r[4] == cpu->cd.sh.r[0])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_0_5)
+{
+	if (cpu->cd.sh.r[5] == cpu->cd.sh.r[0])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_0_6)
+{
+	if (cpu->cd.sh.r[6] == cpu->cd.sh.r[0])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_0_7)
+{
+	if (cpu->cd.sh.r[7] == cpu->cd.sh.r[0])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_0_8)
+{
+	if (cpu->cd.sh.r[8] == cpu->cd.sh.r[0])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_0_9)
+{
+	if (cpu->cd.sh.r[9] == cpu->cd.sh.r[0])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_0_10)
+{
+	if (cpu->cd.sh.r[10] == cpu->cd.sh.r[0])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_0_11)
+{
+	if (cpu->cd.sh.r[11] == cpu->cd.sh.r[0])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_0_12)
+{
+	if (cpu->cd.sh.r[12] == cpu->cd.sh.r[0])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_0_13)
+{
+	if (cpu->cd.sh.r[13] == cpu->cd.sh.r[0])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_0_14)
+{
+	if (cpu->cd.sh.r[14] == cpu->cd.sh.r[0])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_0_15)
+{
+	if (cpu->cd.sh.r[15] == cpu->cd.sh.r[0])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_1_0)
+{
+	if (cpu->cd.sh.r[0] == cpu->cd.sh.r[1])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_1_1)
+{
+	if (cpu->cd.sh.r[1] == cpu->cd.sh.r[1])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_1_2)
+{
+	if (cpu->cd.sh.r[2] == cpu->cd.sh.r[1])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_1_3)
+{
+	if (cpu->cd.sh.r[3] == cpu->cd.sh.r[1])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_1_4)
+{
+	if (cpu->cd.sh.r[4] == cpu->cd.sh.r[1])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_1_5)
+{
+	if (cpu->cd.sh.r[5] == cpu->cd.sh.r[1])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_1_6)
+{
+	if (cpu->cd.sh.r[6] == cpu->cd.sh.r[1])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_1_7)
+{
+	if (cpu->cd.sh.r[7] == cpu->cd.sh.r[1])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_1_8)
+{
+	if (cpu->cd.sh.r[8] == cpu->cd.sh.r[1])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_1_9)
+{
+	if (cpu->cd.sh.r[9] == cpu->cd.sh.r[1])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_1_10)
+{
+	if (cpu->cd.sh.r[10] == cpu->cd.sh.r[1])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_1_11)
+{
+	if (cpu->cd.sh.r[11] == cpu->cd.sh.r[1])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_1_12)
+{
+	if (cpu->cd.sh.r[12] == cpu->cd.sh.r[1])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_1_13)
+{
+	if (cpu->cd.sh.r[13] == cpu->cd.sh.r[1])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_1_14)
+{
+	if (cpu->cd.sh.r[14] == cpu->cd.sh.r[1])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_1_15)
+{
+	if (cpu->cd.sh.r[15] == cpu->cd.sh.r[1])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_2_0)
+{
+	if (cpu->cd.sh.r[0] == cpu->cd.sh.r[2])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_2_1)
+{
+	if (cpu->cd.sh.r[1] == cpu->cd.sh.r[2])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_2_2)
+{
+	if (cpu->cd.sh.r[2] == cpu->cd.sh.r[2])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_2_3)
+{
+	if (cpu->cd.sh.r[3] == cpu->cd.sh.r[2])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_2_4)
+{
+	if (cpu->cd.sh.r[4] == cpu->cd.sh.r[2])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_2_5)
+{
+	if (cpu->cd.sh.r[5] == cpu->cd.sh.r[2])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_2_6)
+{
+	if (cpu->cd.sh.r[6] == cpu->cd.sh.r[2])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_2_7)
+{
+	if (cpu->cd.sh.r[7] == cpu->cd.sh.r[2])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_2_8)
+{
+	if (cpu->cd.sh.r[8] == cpu->cd.sh.r[2])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_2_9)
+{
+	if (cpu->cd.sh.r[9] == cpu->cd.sh.r[2])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_2_10)
+{
+	if (cpu->cd.sh.r[10] == cpu->cd.sh.r[2])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_2_11)
+{
+	if (cpu->cd.sh.r[11] == cpu->cd.sh.r[2])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_2_12)
+{
+	if (cpu->cd.sh.r[12] == cpu->cd.sh.r[2])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_2_13)
+{
+	if (cpu->cd.sh.r[13] == cpu->cd.sh.r[2])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_2_14)
+{
+	if (cpu->cd.sh.r[14] == cpu->cd.sh.r[2])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_2_15)
+{
+	if (cpu->cd.sh.r[15] == cpu->cd.sh.r[2])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_3_0)
+{
+	if (cpu->cd.sh.r[0] == cpu->cd.sh.r[3])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_3_1)
+{
+	if (cpu->cd.sh.r[1] == cpu->cd.sh.r[3])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_3_2)
+{
+	if (cpu->cd.sh.r[2] == cpu->cd.sh.r[3])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_3_3)
+{
+	if (cpu->cd.sh.r[3] == cpu->cd.sh.r[3])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_3_4)
+{
+	if (cpu->cd.sh.r[4] == cpu->cd.sh.r[3])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_3_5)
+{
+	if (cpu->cd.sh.r[5] == cpu->cd.sh.r[3])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_3_6)
+{
+	if (cpu->cd.sh.r[6] == cpu->cd.sh.r[3])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_3_7)
+{
+	if (cpu->cd.sh.r[7] == cpu->cd.sh.r[3])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_3_8)
+{
+	if (cpu->cd.sh.r[8] == cpu->cd.sh.r[3])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_3_9)
+{
+	if (cpu->cd.sh.r[9] == cpu->cd.sh.r[3])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_3_10)
+{
+	if (cpu->cd.sh.r[10] == cpu->cd.sh.r[3])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_3_11)
+{
+	if (cpu->cd.sh.r[11] == cpu->cd.sh.r[3])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_3_12)
+{
+	if (cpu->cd.sh.r[12] == cpu->cd.sh.r[3])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_3_13)
+{
+	if (cpu->cd.sh.r[13] == cpu->cd.sh.r[3])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_3_14)
+{
+	if (cpu->cd.sh.r[14] == cpu->cd.sh.r[3])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_3_15)
+{
+	if (cpu->cd.sh.r[15] == cpu->cd.sh.r[3])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_4_0)
+{
+	if (cpu->cd.sh.r[0] == cpu->cd.sh.r[4])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_4_1)
+{
+	if (cpu->cd.sh.r[1] == cpu->cd.sh.r[4])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_4_2)
+{
+	if (cpu->cd.sh.r[2] == cpu->cd.sh.r[4])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_4_3)
+{
+	if (cpu->cd.sh.r[3] == cpu->cd.sh.r[4])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_4_4)
+{
+	if (cpu->cd.sh.r[4] == cpu->cd.sh.r[4])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_4_5)
+{
+	if (cpu->cd.sh.r[5] == cpu->cd.sh.r[4])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_4_6)
+{
+	if (cpu->cd.sh.r[6] == cpu->cd.sh.r[4])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_4_7)
+{
+	if (cpu->cd.sh.r[7] == cpu->cd.sh.r[4])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_4_8)
+{
+	if (cpu->cd.sh.r[8] == cpu->cd.sh.r[4])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_4_9)
+{
+	if (cpu->cd.sh.r[9] == cpu->cd.sh.r[4])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_4_10)
+{
+	if (cpu->cd.sh.r[10] == cpu->cd.sh.r[4])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_4_11)
+{
+	if (cpu->cd.sh.r[11] == cpu->cd.sh.r[4])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_4_12)
+{
+	if (cpu->cd.sh.r[12] == cpu->cd.sh.r[4])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_4_13)
+{
+	if (cpu->cd.sh.r[13] == cpu->cd.sh.r[4])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_4_14)
+{
+	if (cpu->cd.sh.r[14] == cpu->cd.sh.r[4])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_4_15)
+{
+	if (cpu->cd.sh.r[15] == cpu->cd.sh.r[4])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_5_0)
+{
+	if (cpu->cd.sh.r[0] == cpu->cd.sh.r[5])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_5_1)
+{
+	if (cpu->cd.sh.r[1] == cpu->cd.sh.r[5])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_5_2)
+{
+	if (cpu->cd.sh.r[2] == cpu->cd.sh.r[5])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_5_3)
+{
+	if (cpu->cd.sh.r[3] == cpu->cd.sh.r[5])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_5_4)
+{
+	if (cpu->cd.sh.r[4] == cpu->cd.sh.r[5])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_5_5)
+{
+	if (cpu->cd.sh.r[5] == cpu->cd.sh.r[5])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_5_6)
+{
+	if (cpu->cd.sh.r[6] == cpu->cd.sh.r[5])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_5_7)
+{
+	if (cpu->cd.sh.r[7] == cpu->cd.sh.r[5])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_5_8)
+{
+	if (cpu->cd.sh.r[8] == cpu->cd.sh.r[5])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_5_9)
+{
+	if (cpu->cd.sh.r[9] == cpu->cd.sh.r[5])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_5_10)
+{
+	if (cpu->cd.sh.r[10] == cpu->cd.sh.r[5])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_5_11)
+{
+	if (cpu->cd.sh.r[11] == cpu->cd.sh.r[5])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_5_12)
+{
+	if (cpu->cd.sh.r[12] == cpu->cd.sh.r[5])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_5_13)
+{
+	if (cpu->cd.sh.r[13] == cpu->cd.sh.r[5])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_5_14)
+{
+	if (cpu->cd.sh.r[14] == cpu->cd.sh.r[5])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_5_15)
+{
+	if (cpu->cd.sh.r[15] == cpu->cd.sh.r[5])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_6_0)
+{
+	if (cpu->cd.sh.r[0] == cpu->cd.sh.r[6])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_6_1)
+{
+	if (cpu->cd.sh.r[1] == cpu->cd.sh.r[6])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_6_2)
+{
+	if (cpu->cd.sh.r[2] == cpu->cd.sh.r[6])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_6_3)
+{
+	if (cpu->cd.sh.r[3] == cpu->cd.sh.r[6])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_6_4)
+{
+	if (cpu->cd.sh.r[4] == cpu->cd.sh.r[6])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_6_5)
+{
+	if (cpu->cd.sh.r[5] == cpu->cd.sh.r[6])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_6_6)
+{
+	if (cpu->cd.sh.r[6] == cpu->cd.sh.r[6])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_6_7)
+{
+	if (cpu->cd.sh.r[7] == cpu->cd.sh.r[6])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_6_8)
+{
+	if (cpu->cd.sh.r[8] == cpu->cd.sh.r[6])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_6_9)
+{
+	if (cpu->cd.sh.r[9] == cpu->cd.sh.r[6])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_6_10)
+{
+	if (cpu->cd.sh.r[10] == cpu->cd.sh.r[6])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_6_11)
+{
+	if (cpu->cd.sh.r[11] == cpu->cd.sh.r[6])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_6_12)
+{
+	if (cpu->cd.sh.r[12] == cpu->cd.sh.r[6])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_6_13)
+{
+	if (cpu->cd.sh.r[13] == cpu->cd.sh.r[6])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_6_14)
+{
+	if (cpu->cd.sh.r[14] == cpu->cd.sh.r[6])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_6_15)
+{
+	if (cpu->cd.sh.r[15] == cpu->cd.sh.r[6])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_7_0)
+{
+	if (cpu->cd.sh.r[0] == cpu->cd.sh.r[7])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_7_1)
+{
+	if (cpu->cd.sh.r[1] == cpu->cd.sh.r[7])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_7_2)
+{
+	if (cpu->cd.sh.r[2] == cpu->cd.sh.r[7])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_7_3)
+{
+	if (cpu->cd.sh.r[3] == cpu->cd.sh.r[7])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_7_4)
+{
+	if (cpu->cd.sh.r[4] == cpu->cd.sh.r[7])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_7_5)
+{
+	if (cpu->cd.sh.r[5] == cpu->cd.sh.r[7])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_7_6)
+{
+	if (cpu->cd.sh.r[6] == cpu->cd.sh.r[7])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_7_7)
+{
+	if (cpu->cd.sh.r[7] == cpu->cd.sh.r[7])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_7_8)
+{
+	if (cpu->cd.sh.r[8] == cpu->cd.sh.r[7])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_7_9)
+{
+	if (cpu->cd.sh.r[9] == cpu->cd.sh.r[7])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_7_10)
+{
+	if (cpu->cd.sh.r[10] == cpu->cd.sh.r[7])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_7_11)
+{
+	if (cpu->cd.sh.r[11] == cpu->cd.sh.r[7])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_7_12)
+{
+	if (cpu->cd.sh.r[12] == cpu->cd.sh.r[7])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_7_13)
+{
+	if (cpu->cd.sh.r[13] == cpu->cd.sh.r[7])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_7_14)
+{
+	if (cpu->cd.sh.r[14] == cpu->cd.sh.r[7])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_7_15)
+{
+	if (cpu->cd.sh.r[15] == cpu->cd.sh.r[7])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_8_0)
+{
+	if (cpu->cd.sh.r[0] == cpu->cd.sh.r[8])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_8_1)
+{
+	if (cpu->cd.sh.r[1] == cpu->cd.sh.r[8])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_8_2)
+{
+	if (cpu->cd.sh.r[2] == cpu->cd.sh.r[8])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_8_3)
+{
+	if (cpu->cd.sh.r[3] == cpu->cd.sh.r[8])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_8_4)
+{
+	if (cpu->cd.sh.r[4] == cpu->cd.sh.r[8])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_8_5)
+{
+	if (cpu->cd.sh.r[5] == cpu->cd.sh.r[8])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_8_6)
+{
+	if (cpu->cd.sh.r[6] == cpu->cd.sh.r[8])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_8_7)
+{
+	if (cpu->cd.sh.r[7] == cpu->cd.sh.r[8])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_8_8)
+{
+	if (cpu->cd.sh.r[8] == cpu->cd.sh.r[8])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_8_9)
+{
+	if (cpu->cd.sh.r[9] == cpu->cd.sh.r[8])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_8_10)
+{
+	if (cpu->cd.sh.r[10] == cpu->cd.sh.r[8])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_8_11)
+{
+	if (cpu->cd.sh.r[11] == cpu->cd.sh.r[8])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_8_12)
+{
+	if (cpu->cd.sh.r[12] == cpu->cd.sh.r[8])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_8_13)
+{
+	if (cpu->cd.sh.r[13] == cpu->cd.sh.r[8])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_8_14)
+{
+	if (cpu->cd.sh.r[14] == cpu->cd.sh.r[8])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_8_15)
+{
+	if (cpu->cd.sh.r[15] == cpu->cd.sh.r[8])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_9_0)
+{
+	if (cpu->cd.sh.r[0] == cpu->cd.sh.r[9])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_9_1)
+{
+	if (cpu->cd.sh.r[1] == cpu->cd.sh.r[9])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_9_2)
+{
+	if (cpu->cd.sh.r[2] == cpu->cd.sh.r[9])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_9_3)
+{
+	if (cpu->cd.sh.r[3] == cpu->cd.sh.r[9])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_9_4)
+{
+	if (cpu->cd.sh.r[4] == cpu->cd.sh.r[9])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_9_5)
+{
+	if (cpu->cd.sh.r[5] == cpu->cd.sh.r[9])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_9_6)
+{
+	if (cpu->cd.sh.r[6] == cpu->cd.sh.r[9])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_9_7)
+{
+	if (cpu->cd.sh.r[7] == cpu->cd.sh.r[9])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_9_8)
+{
+	if (cpu->cd.sh.r[8] == cpu->cd.sh.r[9])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_9_9)
+{
+	if (cpu->cd.sh.r[9] == cpu->cd.sh.r[9])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_9_10)
+{
+	if (cpu->cd.sh.r[10] == cpu->cd.sh.r[9])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_9_11)
+{
+	if (cpu->cd.sh.r[11] == cpu->cd.sh.r[9])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_9_12)
+{
+	if (cpu->cd.sh.r[12] == cpu->cd.sh.r[9])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_9_13)
+{
+	if (cpu->cd.sh.r[13] == cpu->cd.sh.r[9])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_9_14)
+{
+	if (cpu->cd.sh.r[14] == cpu->cd.sh.r[9])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_9_15)
+{
+	if (cpu->cd.sh.r[15] == cpu->cd.sh.r[9])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_10_0)
+{
+	if (cpu->cd.sh.r[0] == cpu->cd.sh.r[10])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_10_1)
+{
+	if (cpu->cd.sh.r[1] == cpu->cd.sh.r[10])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_10_2)
+{
+	if (cpu->cd.sh.r[2] == cpu->cd.sh.r[10])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_10_3)
+{
+	if (cpu->cd.sh.r[3] == cpu->cd.sh.r[10])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_10_4)
+{
+	if (cpu->cd.sh.r[4] == cpu->cd.sh.r[10])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_10_5)
+{
+	if (cpu->cd.sh.r[5] == cpu->cd.sh.r[10])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_10_6)
+{
+	if (cpu->cd.sh.r[6] == cpu->cd.sh.r[10])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_10_7)
+{
+	if (cpu->cd.sh.r[7] == cpu->cd.sh.r[10])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_10_8)
+{
+	if (cpu->cd.sh.r[8] == cpu->cd.sh.r[10])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_10_9)
+{
+	if (cpu->cd.sh.r[9] == cpu->cd.sh.r[10])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_10_10)
+{
+	if (cpu->cd.sh.r[10] == cpu->cd.sh.r[10])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_10_11)
+{
+	if (cpu->cd.sh.r[11] == cpu->cd.sh.r[10])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_10_12)
+{
+	if (cpu->cd.sh.r[12] == cpu->cd.sh.r[10])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_10_13)
+{
+	if (cpu->cd.sh.r[13] == cpu->cd.sh.r[10])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_10_14)
+{
+	if (cpu->cd.sh.r[14] == cpu->cd.sh.r[10])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_10_15)
+{
+	if (cpu->cd.sh.r[15] == cpu->cd.sh.r[10])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_11_0)
+{
+	if (cpu->cd.sh.r[0] == cpu->cd.sh.r[11])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_11_1)
+{
+	if (cpu->cd.sh.r[1] == cpu->cd.sh.r[11])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_11_2)
+{
+	if (cpu->cd.sh.r[2] == cpu->cd.sh.r[11])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_11_3)
+{
+	if (cpu->cd.sh.r[3] == cpu->cd.sh.r[11])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_11_4)
+{
+	if (cpu->cd.sh.r[4] == cpu->cd.sh.r[11])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_11_5)
+{
+	if (cpu->cd.sh.r[5] == cpu->cd.sh.r[11])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_11_6)
+{
+	if (cpu->cd.sh.r[6] == cpu->cd.sh.r[11])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_11_7)
+{
+	if (cpu->cd.sh.r[7] == cpu->cd.sh.r[11])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_11_8)
+{
+	if (cpu->cd.sh.r[8] == cpu->cd.sh.r[11])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_11_9)
+{
+	if (cpu->cd.sh.r[9] == cpu->cd.sh.r[11])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_11_10)
+{
+	if (cpu->cd.sh.r[10] == cpu->cd.sh.r[11])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_11_11)
+{
+	if (cpu->cd.sh.r[11] == cpu->cd.sh.r[11])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_11_12)
+{
+	if (cpu->cd.sh.r[12] == cpu->cd.sh.r[11])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_11_13)
+{
+	if (cpu->cd.sh.r[13] == cpu->cd.sh.r[11])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_11_14)
+{
+	if (cpu->cd.sh.r[14] == cpu->cd.sh.r[11])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_11_15)
+{
+	if (cpu->cd.sh.r[15] == cpu->cd.sh.r[11])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_12_0)
+{
+	if (cpu->cd.sh.r[0] == cpu->cd.sh.r[12])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_12_1)
+{
+	if (cpu->cd.sh.r[1] == cpu->cd.sh.r[12])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_12_2)
+{
+	if (cpu->cd.sh.r[2] == cpu->cd.sh.r[12])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_12_3)
+{
+	if (cpu->cd.sh.r[3] == cpu->cd.sh.r[12])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_12_4)
+{
+	if (cpu->cd.sh.r[4] == cpu->cd.sh.r[12])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_12_5)
+{
+	if (cpu->cd.sh.r[5] == cpu->cd.sh.r[12])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_12_6)
+{
+	if (cpu->cd.sh.r[6] == cpu->cd.sh.r[12])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_12_7)
+{
+	if (cpu->cd.sh.r[7] == cpu->cd.sh.r[12])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_12_8)
+{
+	if (cpu->cd.sh.r[8] == cpu->cd.sh.r[12])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_12_9)
+{
+	if (cpu->cd.sh.r[9] == cpu->cd.sh.r[12])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_12_10)
+{
+	if (cpu->cd.sh.r[10] == cpu->cd.sh.r[12])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_12_11)
+{
+	if (cpu->cd.sh.r[11] == cpu->cd.sh.r[12])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_12_12)
+{
+	if (cpu->cd.sh.r[12] == cpu->cd.sh.r[12])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_12_13)
+{
+	if (cpu->cd.sh.r[13] == cpu->cd.sh.r[12])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_12_14)
+{
+	if (cpu->cd.sh.r[14] == cpu->cd.sh.r[12])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_12_15)
+{
+	if (cpu->cd.sh.r[15] == cpu->cd.sh.r[12])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_13_0)
+{
+	if (cpu->cd.sh.r[0] == cpu->cd.sh.r[13])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_13_1)
+{
+	if (cpu->cd.sh.r[1] == cpu->cd.sh.r[13])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_13_2)
+{
+	if (cpu->cd.sh.r[2] == cpu->cd.sh.r[13])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_13_3)
+{
+	if (cpu->cd.sh.r[3] == cpu->cd.sh.r[13])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_13_4)
+{
+	if (cpu->cd.sh.r[4] == cpu->cd.sh.r[13])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_13_5)
+{
+	if (cpu->cd.sh.r[5] == cpu->cd.sh.r[13])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_13_6)
+{
+	if (cpu->cd.sh.r[6] == cpu->cd.sh.r[13])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_13_7)
+{
+	if (cpu->cd.sh.r[7] == cpu->cd.sh.r[13])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_13_8)
+{
+	if (cpu->cd.sh.r[8] == cpu->cd.sh.r[13])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_13_9)
+{
+	if (cpu->cd.sh.r[9] == cpu->cd.sh.r[13])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_13_10)
+{
+	if (cpu->cd.sh.r[10] == cpu->cd.sh.r[13])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_13_11)
+{
+	if (cpu->cd.sh.r[11] == cpu->cd.sh.r[13])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_13_12)
+{
+	if (cpu->cd.sh.r[12] == cpu->cd.sh.r[13])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_13_13)
+{
+	if (cpu->cd.sh.r[13] == cpu->cd.sh.r[13])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_13_14)
+{
+	if (cpu->cd.sh.r[14] == cpu->cd.sh.r[13])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_13_15)
+{
+	if (cpu->cd.sh.r[15] == cpu->cd.sh.r[13])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_14_0)
+{
+	if (cpu->cd.sh.r[0] == cpu->cd.sh.r[14])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_14_1)
+{
+	if (cpu->cd.sh.r[1] == cpu->cd.sh.r[14])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_14_2)
+{
+	if (cpu->cd.sh.r[2] == cpu->cd.sh.r[14])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_14_3)
+{
+	if (cpu->cd.sh.r[3] == cpu->cd.sh.r[14])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_14_4)
+{
+	if (cpu->cd.sh.r[4] == cpu->cd.sh.r[14])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_14_5)
+{
+	if (cpu->cd.sh.r[5] == cpu->cd.sh.r[14])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_14_6)
+{
+	if (cpu->cd.sh.r[6] == cpu->cd.sh.r[14])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_14_7)
+{
+	if (cpu->cd.sh.r[7] == cpu->cd.sh.r[14])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_14_8)
+{
+	if (cpu->cd.sh.r[8] == cpu->cd.sh.r[14])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_14_9)
+{
+	if (cpu->cd.sh.r[9] == cpu->cd.sh.r[14])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_14_10)
+{
+	if (cpu->cd.sh.r[10] == cpu->cd.sh.r[14])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_14_11)
+{
+	if (cpu->cd.sh.r[11] == cpu->cd.sh.r[14])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_14_12)
+{
+	if (cpu->cd.sh.r[12] == cpu->cd.sh.r[14])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_14_13)
+{
+	if (cpu->cd.sh.r[13] == cpu->cd.sh.r[14])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_14_14)
+{
+	if (cpu->cd.sh.r[14] == cpu->cd.sh.r[14])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_14_15)
+{
+	if (cpu->cd.sh.r[15] == cpu->cd.sh.r[14])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_15_0)
+{
+	if (cpu->cd.sh.r[0] == cpu->cd.sh.r[15])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_15_1)
+{
+	if (cpu->cd.sh.r[1] == cpu->cd.sh.r[15])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_15_2)
+{
+	if (cpu->cd.sh.r[2] == cpu->cd.sh.r[15])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_15_3)
+{
+	if (cpu->cd.sh.r[3] == cpu->cd.sh.r[15])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_15_4)
+{
+	if (cpu->cd.sh.r[4] == cpu->cd.sh.r[15])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_15_5)
+{
+	if (cpu->cd.sh.r[5] == cpu->cd.sh.r[15])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_15_6)
+{
+	if (cpu->cd.sh.r[6] == cpu->cd.sh.r[15])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_15_7)
+{
+	if (cpu->cd.sh.r[7] == cpu->cd.sh.r[15])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_15_8)
+{
+	if (cpu->cd.sh.r[8] == cpu->cd.sh.r[15])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_15_9)
+{
+	if (cpu->cd.sh.r[9] == cpu->cd.sh.r[15])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_15_10)
+{
+	if (cpu->cd.sh.r[10] == cpu->cd.sh.r[15])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_15_11)
+{
+	if (cpu->cd.sh.r[11] == cpu->cd.sh.r[15])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_15_12)
+{
+	if (cpu->cd.sh.r[12] == cpu->cd.sh.r[15])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_15_13)
+{
+	if (cpu->cd.sh.r[13] == cpu->cd.sh.r[15])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_15_14)
+{
+	if (cpu->cd.sh.r[14] == cpu->cd.sh.r[15])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(cmpeq_rm_rn_15_15)
+{
+	if (cpu->cd.sh.r[15] == cpu->cd.sh.r[15])
+		cpu->cd.sh.sr |= SH_SR_T;
+	else
+		cpu->cd.sh.sr &= ~SH_SR_T;
+}
+
+X(add_imm_rn_0)
+{
+	cpu->cd.sh.r[0] += ic->arg[0];
+}
+
+X(add_imm_rn_1)
+{
+	cpu->cd.sh.r[1] += ic->arg[0];
+}
+
+X(add_imm_rn_2)
+{
+	cpu->cd.sh.r[2] += ic->arg[0];
+}
+
+X(add_imm_rn_3)
+{
+	cpu->cd.sh.r[3] += ic->arg[0];
+}
+
+X(add_imm_rn_4)
+{
+	cpu->cd.sh.r[4] += ic->arg[0];
+}
+
+X(add_imm_rn_5)
+{
+	cpu->cd.sh.r[5] += ic->arg[0];
+}
+
+X(add_imm_rn_6)
+{
+	cpu->cd.sh.r[6] += ic->arg[0];
+}
+
+X(add_imm_rn_7)
+{
+	cpu->cd.sh.r[7] += ic->arg[0];
+}
+
+X(add_imm_rn_8)
+{
+	cpu->cd.sh.r[8] += ic->arg[0];
+}
+
+X(add_imm_rn_9)
+{
+	cpu->cd.sh.r[9] += ic->arg[0];
+}
+
+X(add_imm_rn_10)
+{
+	cpu->cd.sh.r[10] += ic->arg[0];
+}
+
+X(add_imm_rn_11)
+{
+	cpu->cd.sh.r[11] += ic->arg[0];
+}
+
+X(add_imm_rn_12)
+{
+	cpu->cd.sh.r[12] += ic->arg[0];
+}
+
+X(add_imm_rn_13)
+{
+	cpu->cd.sh.r[13] += ic->arg[0];
+}
+
+X(add_imm_rn_14)
+{
+	cpu->cd.sh.r[14] += ic->arg[0];
+}
+
+X(add_imm_rn_15)
+{
+	cpu->cd.sh.r[15] += ic->arg[0];
+}
+
+X(mov_imm_rn_0)
+{
+	cpu->cd.sh.r[0] = ic->arg[0];
+}
+
+X(mov_imm_rn_1)
+{
+	cpu->cd.sh.r[1] = ic->arg[0];
+}
+
+X(mov_imm_rn_2)
+{
+	cpu->cd.sh.r[2] = ic->arg[0];
+}
+
+X(mov_imm_rn_3)
+{
+	cpu->cd.sh.r[3] = ic->arg[0];
+}
+
+X(mov_imm_rn_4)
+{
+	cpu->cd.sh.r[4] = ic->arg[0];
+}
+
+X(mov_imm_rn_5)
+{
+	cpu->cd.sh.r[5] = ic->arg[0];
+}
+
+X(mov_imm_rn_6)
+{
+	cpu->cd.sh.r[6] = ic->arg[0];
+}
+
+X(mov_imm_rn_7)
+{
+	cpu->cd.sh.r[7] = ic->arg[0];
+}
+
+X(mov_imm_rn_8)
+{
+	cpu->cd.sh.r[8] = ic->arg[0];
+}
+
+X(mov_imm_rn_9)
+{
+	cpu->cd.sh.r[9] = ic->arg[0];
+}
+
+X(mov_imm_rn_10)
+{
+	cpu->cd.sh.r[10] = ic->arg[0];
+}
+
+X(mov_imm_rn_11)
+{
+	cpu->cd.sh.r[11] = ic->arg[0];
+}
+
+X(mov_imm_rn_12)
+{
+	cpu->cd.sh.r[12] = ic->arg[0];
+}
+
+X(mov_imm_rn_13)
+{
+	cpu->cd.sh.r[13] = ic->arg[0];
+}
+
+X(mov_imm_rn_14)
+{
+	cpu->cd.sh.r[14] = ic->arg[0];
+}
+
+X(mov_imm_rn_15)
+{
+	cpu->cd.sh.r[15] = ic->arg[0];
+}
+
+
+void (*sh_alu_mov_rm_rn[256])(struct cpu *, struct sh_instr_call *) = {
+sh_instr_mov_rm_rn_0_0,
+sh_instr_mov_rm_rn_0_1,
+sh_instr_mov_rm_rn_0_2,
+sh_instr_mov_rm_rn_0_3,
+sh_instr_mov_rm_rn_0_4,
+sh_instr_mov_rm_rn_0_5,
+sh_instr_mov_rm_rn_0_6,
+sh_instr_mov_rm_rn_0_7,
+sh_instr_mov_rm_rn_0_8,
+sh_instr_mov_rm_rn_0_9,
+sh_instr_mov_rm_rn_0_10,
+sh_instr_mov_rm_rn_0_11,
+sh_instr_mov_rm_rn_0_12,
+sh_instr_mov_rm_rn_0_13,
+sh_instr_mov_rm_rn_0_14,
+sh_instr_mov_rm_rn_0_15,
+sh_instr_mov_rm_rn_1_0,
+sh_instr_mov_rm_rn_1_1,
+sh_instr_mov_rm_rn_1_2,
+sh_instr_mov_rm_rn_1_3,
+sh_instr_mov_rm_rn_1_4,
+sh_instr_mov_rm_rn_1_5,
+sh_instr_mov_rm_rn_1_6,
+sh_instr_mov_rm_rn_1_7,
+sh_instr_mov_rm_rn_1_8,
+sh_instr_mov_rm_rn_1_9,
+sh_instr_mov_rm_rn_1_10,
+sh_instr_mov_rm_rn_1_11,
+sh_instr_mov_rm_rn_1_12,
+sh_instr_mov_rm_rn_1_13,
+sh_instr_mov_rm_rn_1_14,
+sh_instr_mov_rm_rn_1_15,
+sh_instr_mov_rm_rn_2_0,
+sh_instr_mov_rm_rn_2_1,
+sh_instr_mov_rm_rn_2_2,
+sh_instr_mov_rm_rn_2_3,
+sh_instr_mov_rm_rn_2_4,
+sh_instr_mov_rm_rn_2_5,
+sh_instr_mov_rm_rn_2_6,
+sh_instr_mov_rm_rn_2_7,
+sh_instr_mov_rm_rn_2_8,
+sh_instr_mov_rm_rn_2_9,
+sh_instr_mov_rm_rn_2_10,
+sh_instr_mov_rm_rn_2_11,
+sh_instr_mov_rm_rn_2_12,
+sh_instr_mov_rm_rn_2_13,
+sh_instr_mov_rm_rn_2_14,
+sh_instr_mov_rm_rn_2_15,
+sh_instr_mov_rm_rn_3_0,
+sh_instr_mov_rm_rn_3_1,
+sh_instr_mov_rm_rn_3_2,
+sh_instr_mov_rm_rn_3_3,
+sh_instr_mov_rm_rn_3_4,
+sh_instr_mov_rm_rn_3_5,
+sh_instr_mov_rm_rn_3_6,
+sh_instr_mov_rm_rn_3_7,
+sh_instr_mov_rm_rn_3_8,
+sh_instr_mov_rm_rn_3_9,
+sh_instr_mov_rm_rn_3_10,
+sh_instr_mov_rm_rn_3_11,
+sh_instr_mov_rm_rn_3_12,
+sh_instr_mov_rm_rn_3_13,
+sh_instr_mov_rm_rn_3_14,
+sh_instr_mov_rm_rn_3_15,
+sh_instr_mov_rm_rn_4_0,
+sh_instr_mov_rm_rn_4_1,
+sh_instr_mov_rm_rn_4_2,
+sh_instr_mov_rm_rn_4_3,
+sh_instr_mov_rm_rn_4_4,
+sh_instr_mov_rm_rn_4_5,
+sh_instr_mov_rm_rn_4_6,
+sh_instr_mov_rm_rn_4_7,
+sh_instr_mov_rm_rn_4_8,
+sh_instr_mov_rm_rn_4_9,
+sh_instr_mov_rm_rn_4_10,
+sh_instr_mov_rm_rn_4_11,
+sh_instr_mov_rm_rn_4_12,
+sh_instr_mov_rm_rn_4_13,
+sh_instr_mov_rm_rn_4_14,
+sh_instr_mov_rm_rn_4_15,
+sh_instr_mov_rm_rn_5_0,
+sh_instr_mov_rm_rn_5_1,
+sh_instr_mov_rm_rn_5_2,
+sh_instr_mov_rm_rn_5_3,
+sh_instr_mov_rm_rn_5_4,
+sh_instr_mov_rm_rn_5_5,
+sh_instr_mov_rm_rn_5_6,
+sh_instr_mov_rm_rn_5_7,
+sh_instr_mov_rm_rn_5_8,
+sh_instr_mov_rm_rn_5_9,
+sh_instr_mov_rm_rn_5_10,
+sh_instr_mov_rm_rn_5_11,
+sh_instr_mov_rm_rn_5_12,
+sh_instr_mov_rm_rn_5_13,
+sh_instr_mov_rm_rn_5_14,
+sh_instr_mov_rm_rn_5_15,
+sh_instr_mov_rm_rn_6_0,
+sh_instr_mov_rm_rn_6_1,
+sh_instr_mov_rm_rn_6_2,
+sh_instr_mov_rm_rn_6_3,
+sh_instr_mov_rm_rn_6_4,
+sh_instr_mov_rm_rn_6_5,
+sh_instr_mov_rm_rn_6_6,
+sh_instr_mov_rm_rn_6_7,
+sh_instr_mov_rm_rn_6_8,
+sh_instr_mov_rm_rn_6_9,
+sh_instr_mov_rm_rn_6_10,
+sh_instr_mov_rm_rn_6_11,
+sh_instr_mov_rm_rn_6_12,
+sh_instr_mov_rm_rn_6_13,
+sh_instr_mov_rm_rn_6_14,
+sh_instr_mov_rm_rn_6_15,
+sh_instr_mov_rm_rn_7_0,
+sh_instr_mov_rm_rn_7_1,
+sh_instr_mov_rm_rn_7_2,
+sh_instr_mov_rm_rn_7_3,
+sh_instr_mov_rm_rn_7_4,
+sh_instr_mov_rm_rn_7_5,
+sh_instr_mov_rm_rn_7_6,
+sh_instr_mov_rm_rn_7_7,
+sh_instr_mov_rm_rn_7_8,
+sh_instr_mov_rm_rn_7_9,
+sh_instr_mov_rm_rn_7_10,
+sh_instr_mov_rm_rn_7_11,
+sh_instr_mov_rm_rn_7_12,
+sh_instr_mov_rm_rn_7_13,
+sh_instr_mov_rm_rn_7_14,
+sh_instr_mov_rm_rn_7_15,
+sh_instr_mov_rm_rn_8_0,
+sh_instr_mov_rm_rn_8_1,
+sh_instr_mov_rm_rn_8_2,
+sh_instr_mov_rm_rn_8_3,
+sh_instr_mov_rm_rn_8_4,
+sh_instr_mov_rm_rn_8_5,
+sh_instr_mov_rm_rn_8_6,
+sh_instr_mov_rm_rn_8_7,
+sh_instr_mov_rm_rn_8_8,
+sh_instr_mov_rm_rn_8_9,
+sh_instr_mov_rm_rn_8_10,
+sh_instr_mov_rm_rn_8_11,
+sh_instr_mov_rm_rn_8_12,
+sh_instr_mov_rm_rn_8_13,
+sh_instr_mov_rm_rn_8_14,
+sh_instr_mov_rm_rn_8_15,
+sh_instr_mov_rm_rn_9_0,
+sh_instr_mov_rm_rn_9_1,
+sh_instr_mov_rm_rn_9_2,
+sh_instr_mov_rm_rn_9_3,
+sh_instr_mov_rm_rn_9_4,
+sh_instr_mov_rm_rn_9_5,
+sh_instr_mov_rm_rn_9_6,
+sh_instr_mov_rm_rn_9_7,
+sh_instr_mov_rm_rn_9_8,
+sh_instr_mov_rm_rn_9_9,
+sh_instr_mov_rm_rn_9_10,
+sh_instr_mov_rm_rn_9_11,
+sh_instr_mov_rm_rn_9_12,
+sh_instr_mov_rm_rn_9_13,
+sh_instr_mov_rm_rn_9_14,
+sh_instr_mov_rm_rn_9_15,
+sh_instr_mov_rm_rn_10_0,
+sh_instr_mov_rm_rn_10_1,
+sh_instr_mov_rm_rn_10_2,
+sh_instr_mov_rm_rn_10_3,
+sh_instr_mov_rm_rn_10_4,
+sh_instr_mov_rm_rn_10_5,
+sh_instr_mov_rm_rn_10_6,
+sh_instr_mov_rm_rn_10_7,
+sh_instr_mov_rm_rn_10_8,
+sh_instr_mov_rm_rn_10_9,
+sh_instr_mov_rm_rn_10_10,
+sh_instr_mov_rm_rn_10_11,
+sh_instr_mov_rm_rn_10_12,
+sh_instr_mov_rm_rn_10_13,
+sh_instr_mov_rm_rn_10_14,
+sh_instr_mov_rm_rn_10_15,
+sh_instr_mov_rm_rn_11_0,
+sh_instr_mov_rm_rn_11_1,
+sh_instr_mov_rm_rn_11_2,
+sh_instr_mov_rm_rn_11_3,
+sh_instr_mov_rm_rn_11_4,
+sh_instr_mov_rm_rn_11_5,
+sh_instr_mov_rm_rn_11_6,
+sh_instr_mov_rm_rn_11_7,
+sh_instr_mov_rm_rn_11_8,
+sh_instr_mov_rm_rn_11_9,
+sh_instr_mov_rm_rn_11_10,
+sh_instr_mov_rm_rn_11_11,
+sh_instr_mov_rm_rn_11_12,
+sh_instr_mov_rm_rn_11_13,
+sh_instr_mov_rm_rn_11_14,
+sh_instr_mov_rm_rn_11_15,
+sh_instr_mov_rm_rn_12_0,
+sh_instr_mov_rm_rn_12_1,
+sh_instr_mov_rm_rn_12_2,
+sh_instr_mov_rm_rn_12_3,
+sh_instr_mov_rm_rn_12_4,
+sh_instr_mov_rm_rn_12_5,
+sh_instr_mov_rm_rn_12_6,
+sh_instr_mov_rm_rn_12_7,
+sh_instr_mov_rm_rn_12_8,
+sh_instr_mov_rm_rn_12_9,
+sh_instr_mov_rm_rn_12_10,
+sh_instr_mov_rm_rn_12_11,
+sh_instr_mov_rm_rn_12_12,
+sh_instr_mov_rm_rn_12_13,
+sh_instr_mov_rm_rn_12_14,
+sh_instr_mov_rm_rn_12_15,
+sh_instr_mov_rm_rn_13_0,
+sh_instr_mov_rm_rn_13_1,
+sh_instr_mov_rm_rn_13_2,
+sh_instr_mov_rm_rn_13_3,
+sh_instr_mov_rm_rn_13_4,
+sh_instr_mov_rm_rn_13_5,
+sh_instr_mov_rm_rn_13_6,
+sh_instr_mov_rm_rn_13_7,
+sh_instr_mov_rm_rn_13_8,
+sh_instr_mov_rm_rn_13_9,
+sh_instr_mov_rm_rn_13_10,
+sh_instr_mov_rm_rn_13_11,
+sh_instr_mov_rm_rn_13_12,
+sh_instr_mov_rm_rn_13_13,
+sh_instr_mov_rm_rn_13_14,
+sh_instr_mov_rm_rn_13_15,
+sh_instr_mov_rm_rn_14_0,
+sh_instr_mov_rm_rn_14_1,
+sh_instr_mov_rm_rn_14_2,
+sh_instr_mov_rm_rn_14_3,
+sh_instr_mov_rm_rn_14_4,
+sh_instr_mov_rm_rn_14_5,
+sh_instr_mov_rm_rn_14_6,
+sh_instr_mov_rm_rn_14_7,
+sh_instr_mov_rm_rn_14_8,
+sh_instr_mov_rm_rn_14_9,
+sh_instr_mov_rm_rn_14_10,
+sh_instr_mov_rm_rn_14_11,
+sh_instr_mov_rm_rn_14_12,
+sh_instr_mov_rm_rn_14_13,
+sh_instr_mov_rm_rn_14_14,
+sh_instr_mov_rm_rn_14_15,
+sh_instr_mov_rm_rn_15_0,
+sh_instr_mov_rm_rn_15_1,
+sh_instr_mov_rm_rn_15_2,
+sh_instr_mov_rm_rn_15_3,
+sh_instr_mov_rm_rn_15_4,
+sh_instr_mov_rm_rn_15_5,
+sh_instr_mov_rm_rn_15_6,
+sh_instr_mov_rm_rn_15_7,
+sh_instr_mov_rm_rn_15_8,
+sh_instr_mov_rm_rn_15_9,
+sh_instr_mov_rm_rn_15_10,
+sh_instr_mov_rm_rn_15_11,
+sh_instr_mov_rm_rn_15_12,
+sh_instr_mov_rm_rn_15_13,
+sh_instr_mov_rm_rn_15_14,
+sh_instr_mov_rm_rn_15_15 };
+
+void (*sh_alu_add_rm_rn[256])(struct cpu *, struct sh_instr_call *) = {
+sh_instr_add_rm_rn_0_0,
+sh_instr_add_rm_rn_0_1,
+sh_instr_add_rm_rn_0_2,
+sh_instr_add_rm_rn_0_3,
+sh_instr_add_rm_rn_0_4,
+sh_instr_add_rm_rn_0_5,
+sh_instr_add_rm_rn_0_6,
+sh_instr_add_rm_rn_0_7,
+sh_instr_add_rm_rn_0_8,
+sh_instr_add_rm_rn_0_9,
+sh_instr_add_rm_rn_0_10,
+sh_instr_add_rm_rn_0_11,
+sh_instr_add_rm_rn_0_12,
+sh_instr_add_rm_rn_0_13,
+sh_instr_add_rm_rn_0_14,
+sh_instr_add_rm_rn_0_15,
+sh_instr_add_rm_rn_1_0,
+sh_instr_add_rm_rn_1_1,
+sh_instr_add_rm_rn_1_2,
+sh_instr_add_rm_rn_1_3,
+sh_instr_add_rm_rn_1_4,
+sh_instr_add_rm_rn_1_5,
+sh_instr_add_rm_rn_1_6,
+sh_instr_add_rm_rn_1_7,
+sh_instr_add_rm_rn_1_8,
+sh_instr_add_rm_rn_1_9,
+sh_instr_add_rm_rn_1_10,
+sh_instr_add_rm_rn_1_11,
+sh_instr_add_rm_rn_1_12,
+sh_instr_add_rm_rn_1_13,
+sh_instr_add_rm_rn_1_14,
+sh_instr_add_rm_rn_1_15,
+sh_instr_add_rm_rn_2_0,
+sh_instr_add_rm_rn_2_1,
+sh_instr_add_rm_rn_2_2,
+sh_instr_add_rm_rn_2_3,
+sh_instr_add_rm_rn_2_4,
+sh_instr_add_rm_rn_2_5,
+sh_instr_add_rm_rn_2_6,
+sh_instr_add_rm_rn_2_7,
+sh_instr_add_rm_rn_2_8,
+sh_instr_add_rm_rn_2_9,
+sh_instr_add_rm_rn_2_10,
+sh_instr_add_rm_rn_2_11,
+sh_instr_add_rm_rn_2_12,
+sh_instr_add_rm_rn_2_13,
+sh_instr_add_rm_rn_2_14,
+sh_instr_add_rm_rn_2_15,
+sh_instr_add_rm_rn_3_0,
+sh_instr_add_rm_rn_3_1,
+sh_instr_add_rm_rn_3_2,
+sh_instr_add_rm_rn_3_3,
+sh_instr_add_rm_rn_3_4,
+sh_instr_add_rm_rn_3_5,
+sh_instr_add_rm_rn_3_6,
+sh_instr_add_rm_rn_3_7,
+sh_instr_add_rm_rn_3_8,
+sh_instr_add_rm_rn_3_9,
+sh_instr_add_rm_rn_3_10,
+sh_instr_add_rm_rn_3_11,
+sh_instr_add_rm_rn_3_12,
+sh_instr_add_rm_rn_3_13,
+sh_instr_add_rm_rn_3_14,
+sh_instr_add_rm_rn_3_15,
+sh_instr_add_rm_rn_4_0,
+sh_instr_add_rm_rn_4_1,
+sh_instr_add_rm_rn_4_2,
+sh_instr_add_rm_rn_4_3,
+sh_instr_add_rm_rn_4_4,
+sh_instr_add_rm_rn_4_5,
+sh_instr_add_rm_rn_4_6,
+sh_instr_add_rm_rn_4_7,
+sh_instr_add_rm_rn_4_8,
+sh_instr_add_rm_rn_4_9,
+sh_instr_add_rm_rn_4_10,
+sh_instr_add_rm_rn_4_11,
+sh_instr_add_rm_rn_4_12,
+sh_instr_add_rm_rn_4_13,
+sh_instr_add_rm_rn_4_14,
+sh_instr_add_rm_rn_4_15,
+sh_instr_add_rm_rn_5_0,
+sh_instr_add_rm_rn_5_1,
+sh_instr_add_rm_rn_5_2,
+sh_instr_add_rm_rn_5_3,
+sh_instr_add_rm_rn_5_4,
+sh_instr_add_rm_rn_5_5,
+sh_instr_add_rm_rn_5_6,
+sh_instr_add_rm_rn_5_7,
+sh_instr_add_rm_rn_5_8,
+sh_instr_add_rm_rn_5_9,
+sh_instr_add_rm_rn_5_10,
+sh_instr_add_rm_rn_5_11,
+sh_instr_add_rm_rn_5_12,
+sh_instr_add_rm_rn_5_13,
+sh_instr_add_rm_rn_5_14,
+sh_instr_add_rm_rn_5_15,
+sh_instr_add_rm_rn_6_0,
+sh_instr_add_rm_rn_6_1,
+sh_instr_add_rm_rn_6_2,
+sh_instr_add_rm_rn_6_3,
+sh_instr_add_rm_rn_6_4,
+sh_instr_add_rm_rn_6_5,
+sh_instr_add_rm_rn_6_6,
+sh_instr_add_rm_rn_6_7,
+sh_instr_add_rm_rn_6_8,
+sh_instr_add_rm_rn_6_9,
+sh_instr_add_rm_rn_6_10,
+sh_instr_add_rm_rn_6_11,
+sh_instr_add_rm_rn_6_12,
+sh_instr_add_rm_rn_6_13,
+sh_instr_add_rm_rn_6_14,
+sh_instr_add_rm_rn_6_15,
+sh_instr_add_rm_rn_7_0,
+sh_instr_add_rm_rn_7_1,
+sh_instr_add_rm_rn_7_2,
+sh_instr_add_rm_rn_7_3,
+sh_instr_add_rm_rn_7_4,
+sh_instr_add_rm_rn_7_5,
+sh_instr_add_rm_rn_7_6,
+sh_instr_add_rm_rn_7_7,
+sh_instr_add_rm_rn_7_8,
+sh_instr_add_rm_rn_7_9,
+sh_instr_add_rm_rn_7_10,
+sh_instr_add_rm_rn_7_11,
+sh_instr_add_rm_rn_7_12,
+sh_instr_add_rm_rn_7_13,
+sh_instr_add_rm_rn_7_14,
+sh_instr_add_rm_rn_7_15,
+sh_instr_add_rm_rn_8_0,
+sh_instr_add_rm_rn_8_1,
+sh_instr_add_rm_rn_8_2,
+sh_instr_add_rm_rn_8_3,
+sh_instr_add_rm_rn_8_4,
+sh_instr_add_rm_rn_8_5,
+sh_instr_add_rm_rn_8_6,
+sh_instr_add_rm_rn_8_7,
+sh_instr_add_rm_rn_8_8,
+sh_instr_add_rm_rn_8_9,
+sh_instr_add_rm_rn_8_10,
+sh_instr_add_rm_rn_8_11,
+sh_instr_add_rm_rn_8_12,
+sh_instr_add_rm_rn_8_13,
+sh_instr_add_rm_rn_8_14,
+sh_instr_add_rm_rn_8_15,
+sh_instr_add_rm_rn_9_0,
+sh_instr_add_rm_rn_9_1,
+sh_instr_add_rm_rn_9_2,
+sh_instr_add_rm_rn_9_3,
+sh_instr_add_rm_rn_9_4,
+sh_instr_add_rm_rn_9_5,
+sh_instr_add_rm_rn_9_6,
+sh_instr_add_rm_rn_9_7,
+sh_instr_add_rm_rn_9_8,
+sh_instr_add_rm_rn_9_9,
+sh_instr_add_rm_rn_9_10,
+sh_instr_add_rm_rn_9_11,
+sh_instr_add_rm_rn_9_12,
+sh_instr_add_rm_rn_9_13,
+sh_instr_add_rm_rn_9_14,
+sh_instr_add_rm_rn_9_15,
+sh_instr_add_rm_rn_10_0,
+sh_instr_add_rm_rn_10_1,
+sh_instr_add_rm_rn_10_2,
+sh_instr_add_rm_rn_10_3,
+sh_instr_add_rm_rn_10_4,
+sh_instr_add_rm_rn_10_5,
+sh_instr_add_rm_rn_10_6,
+sh_instr_add_rm_rn_10_7,
+sh_instr_add_rm_rn_10_8,
+sh_instr_add_rm_rn_10_9,
+sh_instr_add_rm_rn_10_10,
+sh_instr_add_rm_rn_10_11,
+sh_instr_add_rm_rn_10_12,
+sh_instr_add_rm_rn_10_13,
+sh_instr_add_rm_rn_10_14,
+sh_instr_add_rm_rn_10_15,
+sh_instr_add_rm_rn_11_0,
+sh_instr_add_rm_rn_11_1,
+sh_instr_add_rm_rn_11_2,
+sh_instr_add_rm_rn_11_3,
+sh_instr_add_rm_rn_11_4,
+sh_instr_add_rm_rn_11_5,
+sh_instr_add_rm_rn_11_6,
+sh_instr_add_rm_rn_11_7,
+sh_instr_add_rm_rn_11_8,
+sh_instr_add_rm_rn_11_9,
+sh_instr_add_rm_rn_11_10,
+sh_instr_add_rm_rn_11_11,
+sh_instr_add_rm_rn_11_12,
+sh_instr_add_rm_rn_11_13,
+sh_instr_add_rm_rn_11_14,
+sh_instr_add_rm_rn_11_15,
+sh_instr_add_rm_rn_12_0,
+sh_instr_add_rm_rn_12_1,
+sh_instr_add_rm_rn_12_2,
+sh_instr_add_rm_rn_12_3,
+sh_instr_add_rm_rn_12_4,
+sh_instr_add_rm_rn_12_5,
+sh_instr_add_rm_rn_12_6,
+sh_instr_add_rm_rn_12_7,
+sh_instr_add_rm_rn_12_8,
+sh_instr_add_rm_rn_12_9,
+sh_instr_add_rm_rn_12_10,
+sh_instr_add_rm_rn_12_11,
+sh_instr_add_rm_rn_12_12,
+sh_instr_add_rm_rn_12_13,
+sh_instr_add_rm_rn_12_14,
+sh_instr_add_rm_rn_12_15,
+sh_instr_add_rm_rn_13_0,
+sh_instr_add_rm_rn_13_1,
+sh_instr_add_rm_rn_13_2,
+sh_instr_add_rm_rn_13_3,
+sh_instr_add_rm_rn_13_4,
+sh_instr_add_rm_rn_13_5,
+sh_instr_add_rm_rn_13_6,
+sh_instr_add_rm_rn_13_7,
+sh_instr_add_rm_rn_13_8,
+sh_instr_add_rm_rn_13_9,
+sh_instr_add_rm_rn_13_10,
+sh_instr_add_rm_rn_13_11,
+sh_instr_add_rm_rn_13_12,
+sh_instr_add_rm_rn_13_13,
+sh_instr_add_rm_rn_13_14,
+sh_instr_add_rm_rn_13_15,
+sh_instr_add_rm_rn_14_0,
+sh_instr_add_rm_rn_14_1,
+sh_instr_add_rm_rn_14_2,
+sh_instr_add_rm_rn_14_3,
+sh_instr_add_rm_rn_14_4,
+sh_instr_add_rm_rn_14_5,
+sh_instr_add_rm_rn_14_6,
+sh_instr_add_rm_rn_14_7,
+sh_instr_add_rm_rn_14_8,
+sh_instr_add_rm_rn_14_9,
+sh_instr_add_rm_rn_14_10,
+sh_instr_add_rm_rn_14_11,
+sh_instr_add_rm_rn_14_12,
+sh_instr_add_rm_rn_14_13,
+sh_instr_add_rm_rn_14_14,
+sh_instr_add_rm_rn_14_15,
+sh_instr_add_rm_rn_15_0,
+sh_instr_add_rm_rn_15_1,
+sh_instr_add_rm_rn_15_2,
+sh_instr_add_rm_rn_15_3,
+sh_instr_add_rm_rn_15_4,
+sh_instr_add_rm_rn_15_5,
+sh_instr_add_rm_rn_15_6,
+sh_instr_add_rm_rn_15_7,
+sh_instr_add_rm_rn_15_8,
+sh_instr_add_rm_rn_15_9,
+sh_instr_add_rm_rn_15_10,
+sh_instr_add_rm_rn_15_11,
+sh_instr_add_rm_rn_15_12,
+sh_instr_add_rm_rn_15_13,
+sh_instr_add_rm_rn_15_14,
+sh_instr_add_rm_rn_15_15 };
+
+void (*sh_alu_tst_rm_rn[256])(struct cpu *, struct sh_instr_call *) = {
+sh_instr_tst_rm_rn_0_0,
+sh_instr_tst_rm_rn_0_1,
+sh_instr_tst_rm_rn_0_2,
+sh_instr_tst_rm_rn_0_3,
+sh_instr_tst_rm_rn_0_4,
+sh_instr_tst_rm_rn_0_5,
+sh_instr_tst_rm_rn_0_6,
+sh_instr_tst_rm_rn_0_7,
+sh_instr_tst_rm_rn_0_8,
+sh_instr_tst_rm_rn_0_9,
+sh_instr_tst_rm_rn_0_10,
+sh_instr_tst_rm_rn_0_11,
+sh_instr_tst_rm_rn_0_12,
+sh_instr_tst_rm_rn_0_13,
+sh_instr_tst_rm_rn_0_14,
+sh_instr_tst_rm_rn_0_15,
+sh_instr_tst_rm_rn_1_0,
+sh_instr_tst_rm_rn_1_1,
+sh_instr_tst_rm_rn_1_2,
+sh_instr_tst_rm_rn_1_3,
+sh_instr_tst_rm_rn_1_4,
+sh_instr_tst_rm_rn_1_5,
+sh_instr_tst_rm_rn_1_6,
+sh_instr_tst_rm_rn_1_7,
+sh_instr_tst_rm_rn_1_8,
+sh_instr_tst_rm_rn_1_9,
+sh_instr_tst_rm_rn_1_10,
+sh_instr_tst_rm_rn_1_11,
+sh_instr_tst_rm_rn_1_12,
+sh_instr_tst_rm_rn_1_13,
+sh_instr_tst_rm_rn_1_14,
+sh_instr_tst_rm_rn_1_15,
+sh_instr_tst_rm_rn_2_0,
+sh_instr_tst_rm_rn_2_1,
+sh_instr_tst_rm_rn_2_2,
+sh_instr_tst_rm_rn_2_3,
+sh_instr_tst_rm_rn_2_4,
+sh_instr_tst_rm_rn_2_5,
+sh_instr_tst_rm_rn_2_6,
+sh_instr_tst_rm_rn_2_7,
+sh_instr_tst_rm_rn_2_8,
+sh_instr_tst_rm_rn_2_9,
+sh_instr_tst_rm_rn_2_10,
+sh_instr_tst_rm_rn_2_11,
+sh_instr_tst_rm_rn_2_12,
+sh_instr_tst_rm_rn_2_13,
+sh_instr_tst_rm_rn_2_14,
+sh_instr_tst_rm_rn_2_15,
+sh_instr_tst_rm_rn_3_0,
+sh_instr_tst_rm_rn_3_1,
+sh_instr_tst_rm_rn_3_2,
+sh_instr_tst_rm_rn_3_3,
+sh_instr_tst_rm_rn_3_4,
+sh_instr_tst_rm_rn_3_5,
+sh_instr_tst_rm_rn_3_6,
+sh_instr_tst_rm_rn_3_7,
+sh_instr_tst_rm_rn_3_8,
+sh_instr_tst_rm_rn_3_9,
+sh_instr_tst_rm_rn_3_10,
+sh_instr_tst_rm_rn_3_11,
+sh_instr_tst_rm_rn_3_12,
+sh_instr_tst_rm_rn_3_13,
+sh_instr_tst_rm_rn_3_14,
+sh_instr_tst_rm_rn_3_15,
+sh_instr_tst_rm_rn_4_0,
+sh_instr_tst_rm_rn_4_1,
+sh_instr_tst_rm_rn_4_2,
+sh_instr_tst_rm_rn_4_3,
+sh_instr_tst_rm_rn_4_4,
+sh_instr_tst_rm_rn_4_5,
+sh_instr_tst_rm_rn_4_6,
+sh_instr_tst_rm_rn_4_7,
+sh_instr_tst_rm_rn_4_8,
+sh_instr_tst_rm_rn_4_9,
+sh_instr_tst_rm_rn_4_10,
+sh_instr_tst_rm_rn_4_11,
+sh_instr_tst_rm_rn_4_12,
+sh_instr_tst_rm_rn_4_13,
+sh_instr_tst_rm_rn_4_14,
+sh_instr_tst_rm_rn_4_15,
+sh_instr_tst_rm_rn_5_0,
+sh_instr_tst_rm_rn_5_1,
+sh_instr_tst_rm_rn_5_2,
+sh_instr_tst_rm_rn_5_3,
+sh_instr_tst_rm_rn_5_4,
+sh_instr_tst_rm_rn_5_5,
+sh_instr_tst_rm_rn_5_6,
+sh_instr_tst_rm_rn_5_7,
+sh_instr_tst_rm_rn_5_8,
+sh_instr_tst_rm_rn_5_9,
+sh_instr_tst_rm_rn_5_10,
+sh_instr_tst_rm_rn_5_11,
+sh_instr_tst_rm_rn_5_12,
+sh_instr_tst_rm_rn_5_13,
+sh_instr_tst_rm_rn_5_14,
+sh_instr_tst_rm_rn_5_15,
+sh_instr_tst_rm_rn_6_0,
+sh_instr_tst_rm_rn_6_1,
+sh_instr_tst_rm_rn_6_2,
+sh_instr_tst_rm_rn_6_3,
+sh_instr_tst_rm_rn_6_4,
+sh_instr_tst_rm_rn_6_5,
+sh_instr_tst_rm_rn_6_6,
+sh_instr_tst_rm_rn_6_7,
+sh_instr_tst_rm_rn_6_8,
+sh_instr_tst_rm_rn_6_9,
+sh_instr_tst_rm_rn_6_10,
+sh_instr_tst_rm_rn_6_11,
+sh_instr_tst_rm_rn_6_12,
+sh_instr_tst_rm_rn_6_13,
+sh_instr_tst_rm_rn_6_14,
+sh_instr_tst_rm_rn_6_15,
+sh_instr_tst_rm_rn_7_0,
+sh_instr_tst_rm_rn_7_1,
+sh_instr_tst_rm_rn_7_2,
+sh_instr_tst_rm_rn_7_3,
+sh_instr_tst_rm_rn_7_4,
+sh_instr_tst_rm_rn_7_5,
+sh_instr_tst_rm_rn_7_6,
+sh_instr_tst_rm_rn_7_7,
+sh_instr_tst_rm_rn_7_8,
+sh_instr_tst_rm_rn_7_9,
+sh_instr_tst_rm_rn_7_10,
+sh_instr_tst_rm_rn_7_11,
+sh_instr_tst_rm_rn_7_12,
+sh_instr_tst_rm_rn_7_13,
+sh_instr_tst_rm_rn_7_14,
+sh_instr_tst_rm_rn_7_15,
+sh_instr_tst_rm_rn_8_0,
+sh_instr_tst_rm_rn_8_1,
+sh_instr_tst_rm_rn_8_2,
+sh_instr_tst_rm_rn_8_3,
+sh_instr_tst_rm_rn_8_4,
+sh_instr_tst_rm_rn_8_5,
+sh_instr_tst_rm_rn_8_6,
+sh_instr_tst_rm_rn_8_7,
+sh_instr_tst_rm_rn_8_8,
+sh_instr_tst_rm_rn_8_9,
+sh_instr_tst_rm_rn_8_10,
+sh_instr_tst_rm_rn_8_11,
+sh_instr_tst_rm_rn_8_12,
+sh_instr_tst_rm_rn_8_13,
+sh_instr_tst_rm_rn_8_14,
+sh_instr_tst_rm_rn_8_15,
+sh_instr_tst_rm_rn_9_0,
+sh_instr_tst_rm_rn_9_1,
+sh_instr_tst_rm_rn_9_2,
+sh_instr_tst_rm_rn_9_3,
+sh_instr_tst_rm_rn_9_4,
+sh_instr_tst_rm_rn_9_5,
+sh_instr_tst_rm_rn_9_6,
+sh_instr_tst_rm_rn_9_7,
+sh_instr_tst_rm_rn_9_8,
+sh_instr_tst_rm_rn_9_9,
+sh_instr_tst_rm_rn_9_10,
+sh_instr_tst_rm_rn_9_11,
+sh_instr_tst_rm_rn_9_12,
+sh_instr_tst_rm_rn_9_13,
+sh_instr_tst_rm_rn_9_14,
+sh_instr_tst_rm_rn_9_15,
+sh_instr_tst_rm_rn_10_0,
+sh_instr_tst_rm_rn_10_1,
+sh_instr_tst_rm_rn_10_2,
+sh_instr_tst_rm_rn_10_3,
+sh_instr_tst_rm_rn_10_4,
+sh_instr_tst_rm_rn_10_5,
+sh_instr_tst_rm_rn_10_6,
+sh_instr_tst_rm_rn_10_7,
+sh_instr_tst_rm_rn_10_8,
+sh_instr_tst_rm_rn_10_9,
+sh_instr_tst_rm_rn_10_10,
+sh_instr_tst_rm_rn_10_11,
+sh_instr_tst_rm_rn_10_12,
+sh_instr_tst_rm_rn_10_13,
+sh_instr_tst_rm_rn_10_14,
+sh_instr_tst_rm_rn_10_15,
+sh_instr_tst_rm_rn_11_0,
+sh_instr_tst_rm_rn_11_1,
+sh_instr_tst_rm_rn_11_2,
+sh_instr_tst_rm_rn_11_3,
+sh_instr_tst_rm_rn_11_4,
+sh_instr_tst_rm_rn_11_5,
+sh_instr_tst_rm_rn_11_6,
+sh_instr_tst_rm_rn_11_7,
+sh_instr_tst_rm_rn_11_8,
+sh_instr_tst_rm_rn_11_9,
+sh_instr_tst_rm_rn_11_10,
+sh_instr_tst_rm_rn_11_11,
+sh_instr_tst_rm_rn_11_12,
+sh_instr_tst_rm_rn_11_13,
+sh_instr_tst_rm_rn_11_14,
+sh_instr_tst_rm_rn_11_15,
+sh_instr_tst_rm_rn_12_0,
+sh_instr_tst_rm_rn_12_1,
+sh_instr_tst_rm_rn_12_2,
+sh_instr_tst_rm_rn_12_3,
+sh_instr_tst_rm_rn_12_4,
+sh_instr_tst_rm_rn_12_5,
+sh_instr_tst_rm_rn_12_6,
+sh_instr_tst_rm_rn_12_7,
+sh_instr_tst_rm_rn_12_8,
+sh_instr_tst_rm_rn_12_9,
+sh_instr_tst_rm_rn_12_10,
+sh_instr_tst_rm_rn_12_11,
+sh_instr_tst_rm_rn_12_12,
+sh_instr_tst_rm_rn_12_13,
+sh_instr_tst_rm_rn_12_14,
+sh_instr_tst_rm_rn_12_15,
+sh_instr_tst_rm_rn_13_0,
+sh_instr_tst_rm_rn_13_1,
+sh_instr_tst_rm_rn_13_2,
+sh_instr_tst_rm_rn_13_3,
+sh_instr_tst_rm_rn_13_4,
+sh_instr_tst_rm_rn_13_5,
+sh_instr_tst_rm_rn_13_6,
+sh_instr_tst_rm_rn_13_7,
+sh_instr_tst_rm_rn_13_8,
+sh_instr_tst_rm_rn_13_9,
+sh_instr_tst_rm_rn_13_10,
+sh_instr_tst_rm_rn_13_11,
+sh_instr_tst_rm_rn_13_12,
+sh_instr_tst_rm_rn_13_13,
+sh_instr_tst_rm_rn_13_14,
+sh_instr_tst_rm_rn_13_15,
+sh_instr_tst_rm_rn_14_0,
+sh_instr_tst_rm_rn_14_1,
+sh_instr_tst_rm_rn_14_2,
+sh_instr_tst_rm_rn_14_3,
+sh_instr_tst_rm_rn_14_4,
+sh_instr_tst_rm_rn_14_5,
+sh_instr_tst_rm_rn_14_6,
+sh_instr_tst_rm_rn_14_7,
+sh_instr_tst_rm_rn_14_8,
+sh_instr_tst_rm_rn_14_9,
+sh_instr_tst_rm_rn_14_10,
+sh_instr_tst_rm_rn_14_11,
+sh_instr_tst_rm_rn_14_12,
+sh_instr_tst_rm_rn_14_13,
+sh_instr_tst_rm_rn_14_14,
+sh_instr_tst_rm_rn_14_15,
+sh_instr_tst_rm_rn_15_0,
+sh_instr_tst_rm_rn_15_1,
+sh_instr_tst_rm_rn_15_2,
+sh_instr_tst_rm_rn_15_3,
+sh_instr_tst_rm_rn_15_4,
+sh_instr_tst_rm_rn_15_5,
+sh_instr_tst_rm_rn_15_6,
+sh_instr_tst_rm_rn_15_7,
+sh_instr_tst_rm_rn_15_8,
+sh_instr_tst_rm_rn_15_9,
+sh_instr_tst_rm_rn_15_10,
+sh_instr_tst_rm_rn_15_11,
+sh_instr_tst_rm_rn_15_12,
+sh_instr_tst_rm_rn_15_13,
+sh_instr_tst_rm_rn_15_14,
+sh_instr_tst_rm_rn_15_15 };
+
+void (*sh_alu_cmpeq_rm_rn[256])(struct cpu *, struct sh_instr_call *) = {
+sh_instr_cmpeq_rm_rn_0_0,
+sh_instr_cmpeq_rm_rn_0_1,
+sh_instr_cmpeq_rm_rn_0_2,
+sh_instr_cmpeq_rm_rn_0_3,
+sh_instr_cmpeq_rm_rn_0_4,
+sh_instr_cmpeq_rm_rn_0_5,
+sh_instr_cmpeq_rm_rn_0_6,
+sh_instr_cmpeq_rm_rn_0_7,
+sh_instr_cmpeq_rm_rn_0_8,
+sh_instr_cmpeq_rm_rn_0_9,
+sh_instr_cmpeq_rm_rn_0_10,
+sh_instr_cmpeq_rm_rn_0_11,
+sh_instr_cmpeq_rm_rn_0_12,
+sh_instr_cmpeq_rm_rn_0_13,
+sh_instr_cmpeq_rm_rn_0_14,
+sh_instr_cmpeq_rm_rn_0_15,
+sh_instr_cmpeq_rm_rn_1_0,
+sh_instr_cmpeq_rm_rn_1_1,
+sh_instr_cmpeq_rm_rn_1_2,
+sh_instr_cmpeq_rm_rn_1_3,
+sh_instr_cmpeq_rm_rn_1_4,
+sh_instr_cmpeq_rm_rn_1_5,
+sh_instr_cmpeq_rm_rn_1_6,
+sh_instr_cmpeq_rm_rn_1_7,
+sh_instr_cmpeq_rm_rn_1_8,
+sh_instr_cmpeq_rm_rn_1_9,
+sh_instr_cmpeq_rm_rn_1_10,
+sh_instr_cmpeq_rm_rn_1_11,
+sh_instr_cmpeq_rm_rn_1_12,
+sh_instr_cmpeq_rm_rn_1_13,
+sh_instr_cmpeq_rm_rn_1_14,
+sh_instr_cmpeq_rm_rn_1_15,
+sh_instr_cmpeq_rm_rn_2_0,
+sh_instr_cmpeq_rm_rn_2_1,
+sh_instr_cmpeq_rm_rn_2_2,
+sh_instr_cmpeq_rm_rn_2_3,
+sh_instr_cmpeq_rm_rn_2_4,
+sh_instr_cmpeq_rm_rn_2_5,
+sh_instr_cmpeq_rm_rn_2_6,
+sh_instr_cmpeq_rm_rn_2_7,
+sh_instr_cmpeq_rm_rn_2_8,
+sh_instr_cmpeq_rm_rn_2_9,
+sh_instr_cmpeq_rm_rn_2_10,
+sh_instr_cmpeq_rm_rn_2_11,
+sh_instr_cmpeq_rm_rn_2_12,
+sh_instr_cmpeq_rm_rn_2_13,
+sh_instr_cmpeq_rm_rn_2_14,
+sh_instr_cmpeq_rm_rn_2_15,
+sh_instr_cmpeq_rm_rn_3_0,
+sh_instr_cmpeq_rm_rn_3_1,
+sh_instr_cmpeq_rm_rn_3_2,
+sh_instr_cmpeq_rm_rn_3_3,
+sh_instr_cmpeq_rm_rn_3_4,
+sh_instr_cmpeq_rm_rn_3_5,
+sh_instr_cmpeq_rm_rn_3_6,
+sh_instr_cmpeq_rm_rn_3_7,
+sh_instr_cmpeq_rm_rn_3_8,
+sh_instr_cmpeq_rm_rn_3_9,
+sh_instr_cmpeq_rm_rn_3_10,
+sh_instr_cmpeq_rm_rn_3_11,
+sh_instr_cmpeq_rm_rn_3_12,
+sh_instr_cmpeq_rm_rn_3_13,
+sh_instr_cmpeq_rm_rn_3_14,
+sh_instr_cmpeq_rm_rn_3_15,
+sh_instr_cmpeq_rm_rn_4_0,
+sh_instr_cmpeq_rm_rn_4_1,
+sh_instr_cmpeq_rm_rn_4_2,
+sh_instr_cmpeq_rm_rn_4_3,
+sh_instr_cmpeq_rm_rn_4_4,
+sh_instr_cmpeq_rm_rn_4_5,
+sh_instr_cmpeq_rm_rn_4_6,
+sh_instr_cmpeq_rm_rn_4_7,
+sh_instr_cmpeq_rm_rn_4_8,
+sh_instr_cmpeq_rm_rn_4_9,
+sh_instr_cmpeq_rm_rn_4_10,
+sh_instr_cmpeq_rm_rn_4_11,
+sh_instr_cmpeq_rm_rn_4_12,
+sh_instr_cmpeq_rm_rn_4_13,
+sh_instr_cmpeq_rm_rn_4_14,
+sh_instr_cmpeq_rm_rn_4_15,
+sh_instr_cmpeq_rm_rn_5_0,
+sh_instr_cmpeq_rm_rn_5_1,
+sh_instr_cmpeq_rm_rn_5_2,
+sh_instr_cmpeq_rm_rn_5_3,
+sh_instr_cmpeq_rm_rn_5_4,
+sh_instr_cmpeq_rm_rn_5_5,
+sh_instr_cmpeq_rm_rn_5_6,
+sh_instr_cmpeq_rm_rn_5_7,
+sh_instr_cmpeq_rm_rn_5_8,
+sh_instr_cmpeq_rm_rn_5_9,
+sh_instr_cmpeq_rm_rn_5_10,
+sh_instr_cmpeq_rm_rn_5_11,
+sh_instr_cmpeq_rm_rn_5_12,
+sh_instr_cmpeq_rm_rn_5_13,
+sh_instr_cmpeq_rm_rn_5_14,
+sh_instr_cmpeq_rm_rn_5_15,
+sh_instr_cmpeq_rm_rn_6_0,
+sh_instr_cmpeq_rm_rn_6_1,
+sh_instr_cmpeq_rm_rn_6_2,
+sh_instr_cmpeq_rm_rn_6_3,
+sh_instr_cmpeq_rm_rn_6_4,
+sh_instr_cmpeq_rm_rn_6_5,
+sh_instr_cmpeq_rm_rn_6_6,
+sh_instr_cmpeq_rm_rn_6_7,
+sh_instr_cmpeq_rm_rn_6_8,
+sh_instr_cmpeq_rm_rn_6_9,
+sh_instr_cmpeq_rm_rn_6_10,
+sh_instr_cmpeq_rm_rn_6_11,
+sh_instr_cmpeq_rm_rn_6_12,
+sh_instr_cmpeq_rm_rn_6_13,
+sh_instr_cmpeq_rm_rn_6_14,
+sh_instr_cmpeq_rm_rn_6_15,
+sh_instr_cmpeq_rm_rn_7_0,
+sh_instr_cmpeq_rm_rn_7_1,
+sh_instr_cmpeq_rm_rn_7_2,
+sh_instr_cmpeq_rm_rn_7_3,
+sh_instr_cmpeq_rm_rn_7_4,
+sh_instr_cmpeq_rm_rn_7_5,
+sh_instr_cmpeq_rm_rn_7_6,
+sh_instr_cmpeq_rm_rn_7_7,
+sh_instr_cmpeq_rm_rn_7_8,
+sh_instr_cmpeq_rm_rn_7_9,
+sh_instr_cmpeq_rm_rn_7_10,
+sh_instr_cmpeq_rm_rn_7_11,
+sh_instr_cmpeq_rm_rn_7_12,
+sh_instr_cmpeq_rm_rn_7_13,
+sh_instr_cmpeq_rm_rn_7_14,
+sh_instr_cmpeq_rm_rn_7_15,
+sh_instr_cmpeq_rm_rn_8_0,
+sh_instr_cmpeq_rm_rn_8_1,
+sh_instr_cmpeq_rm_rn_8_2,
+sh_instr_cmpeq_rm_rn_8_3,
+sh_instr_cmpeq_rm_rn_8_4,
+sh_instr_cmpeq_rm_rn_8_5,
+sh_instr_cmpeq_rm_rn_8_6,
+sh_instr_cmpeq_rm_rn_8_7,
+sh_instr_cmpeq_rm_rn_8_8,
+sh_instr_cmpeq_rm_rn_8_9,
+sh_instr_cmpeq_rm_rn_8_10,
+sh_instr_cmpeq_rm_rn_8_11,
+sh_instr_cmpeq_rm_rn_8_12,
+sh_instr_cmpeq_rm_rn_8_13,
+sh_instr_cmpeq_rm_rn_8_14,
+sh_instr_cmpeq_rm_rn_8_15,
+sh_instr_cmpeq_rm_rn_9_0,
+sh_instr_cmpeq_rm_rn_9_1,
+sh_instr_cmpeq_rm_rn_9_2,
+sh_instr_cmpeq_rm_rn_9_3,
+sh_instr_cmpeq_rm_rn_9_4,
+sh_instr_cmpeq_rm_rn_9_5,
+sh_instr_cmpeq_rm_rn_9_6,
+sh_instr_cmpeq_rm_rn_9_7,
+sh_instr_cmpeq_rm_rn_9_8,
+sh_instr_cmpeq_rm_rn_9_9,
+sh_instr_cmpeq_rm_rn_9_10,
+sh_instr_cmpeq_rm_rn_9_11,
+sh_instr_cmpeq_rm_rn_9_12,
+sh_instr_cmpeq_rm_rn_9_13,
+sh_instr_cmpeq_rm_rn_9_14,
+sh_instr_cmpeq_rm_rn_9_15,
+sh_instr_cmpeq_rm_rn_10_0,
+sh_instr_cmpeq_rm_rn_10_1,
+sh_instr_cmpeq_rm_rn_10_2,
+sh_instr_cmpeq_rm_rn_10_3,
+sh_instr_cmpeq_rm_rn_10_4,
+sh_instr_cmpeq_rm_rn_10_5,
+sh_instr_cmpeq_rm_rn_10_6,
+sh_instr_cmpeq_rm_rn_10_7,
+sh_instr_cmpeq_rm_rn_10_8,
+sh_instr_cmpeq_rm_rn_10_9,
+sh_instr_cmpeq_rm_rn_10_10,
+sh_instr_cmpeq_rm_rn_10_11,
+sh_instr_cmpeq_rm_rn_10_12,
+sh_instr_cmpeq_rm_rn_10_13,
+sh_instr_cmpeq_rm_rn_10_14,
+sh_instr_cmpeq_rm_rn_10_15,
+sh_instr_cmpeq_rm_rn_11_0,
+sh_instr_cmpeq_rm_rn_11_1,
+sh_instr_cmpeq_rm_rn_11_2,
+sh_instr_cmpeq_rm_rn_11_3,
+sh_instr_cmpeq_rm_rn_11_4,
+sh_instr_cmpeq_rm_rn_11_5,
+sh_instr_cmpeq_rm_rn_11_6,
+sh_instr_cmpeq_rm_rn_11_7,
+sh_instr_cmpeq_rm_rn_11_8,
+sh_instr_cmpeq_rm_rn_11_9,
+sh_instr_cmpeq_rm_rn_11_10,
+sh_instr_cmpeq_rm_rn_11_11,
+sh_instr_cmpeq_rm_rn_11_12,
+sh_instr_cmpeq_rm_rn_11_13,
+sh_instr_cmpeq_rm_rn_11_14,
+sh_instr_cmpeq_rm_rn_11_15,
+sh_instr_cmpeq_rm_rn_12_0,
+sh_instr_cmpeq_rm_rn_12_1,
+sh_instr_cmpeq_rm_rn_12_2,
+sh_instr_cmpeq_rm_rn_12_3,
+sh_instr_cmpeq_rm_rn_12_4,
+sh_instr_cmpeq_rm_rn_12_5,
+sh_instr_cmpeq_rm_rn_12_6,
+sh_instr_cmpeq_rm_rn_12_7,
+sh_instr_cmpeq_rm_rn_12_8,
+sh_instr_cmpeq_rm_rn_12_9,
+sh_instr_cmpeq_rm_rn_12_10,
+sh_instr_cmpeq_rm_rn_12_11,
+sh_instr_cmpeq_rm_rn_12_12,
+sh_instr_cmpeq_rm_rn_12_13,
+sh_instr_cmpeq_rm_rn_12_14,
+sh_instr_cmpeq_rm_rn_12_15,
+sh_instr_cmpeq_rm_rn_13_0,
+sh_instr_cmpeq_rm_rn_13_1,
+sh_instr_cmpeq_rm_rn_13_2,
+sh_instr_cmpeq_rm_rn_13_3,
+sh_instr_cmpeq_rm_rn_13_4,
+sh_instr_cmpeq_rm_rn_13_5,
+sh_instr_cmpeq_rm_rn_13_6,
+sh_instr_cmpeq_rm_rn_13_7,
+sh_instr_cmpeq_rm_rn_13_8,
+sh_instr_cmpeq_rm_rn_13_9,
+sh_instr_cmpeq_rm_rn_13_10,
+sh_instr_cmpeq_rm_rn_13_11,
+sh_instr_cmpeq_rm_rn_13_12,
+sh_instr_cmpeq_rm_rn_13_13,
+sh_instr_cmpeq_rm_rn_13_14,
+sh_instr_cmpeq_rm_rn_13_15,
+sh_instr_cmpeq_rm_rn_14_0,
+sh_instr_cmpeq_rm_rn_14_1,
+sh_instr_cmpeq_rm_rn_14_2,
+sh_instr_cmpeq_rm_rn_14_3,
+sh_instr_cmpeq_rm_rn_14_4,
+sh_instr_cmpeq_rm_rn_14_5,
+sh_instr_cmpeq_rm_rn_14_6,
+sh_instr_cmpeq_rm_rn_14_7,
+sh_instr_cmpeq_rm_rn_14_8,
+sh_instr_cmpeq_rm_rn_14_9,
+sh_instr_cmpeq_rm_rn_14_10,
+sh_instr_cmpeq_rm_rn_14_11,
+sh_instr_cmpeq_rm_rn_14_12,
+sh_instr_cmpeq_rm_rn_14_13,
+sh_instr_cmpeq_rm_rn_14_14,
+sh_instr_cmpeq_rm_rn_14_15,
+sh_instr_cmpeq_rm_rn_15_0,
+sh_instr_cmpeq_rm_rn_15_1,
+sh_instr_cmpeq_rm_rn_15_2,
+sh_instr_cmpeq_rm_rn_15_3,
+sh_instr_cmpeq_rm_rn_15_4,
+sh_instr_cmpeq_rm_rn_15_5,
+sh_instr_cmpeq_rm_rn_15_6,
+sh_instr_cmpeq_rm_rn_15_7,
+sh_instr_cmpeq_rm_rn_15_8,
+sh_instr_cmpeq_rm_rn_15_9,
+sh_instr_cmpeq_rm_rn_15_10,
+sh_instr_cmpeq_rm_rn_15_11,
+sh_instr_cmpeq_rm_rn_15_12,
+sh_instr_cmpeq_rm_rn_15_13,
+sh_instr_cmpeq_rm_rn_15_14,
+sh_instr_cmpeq_rm_rn_15_15 };
+
+void (*sh_alu_add_imm_rn[16])(struct cpu *, struct sh_instr_call *) = {
+sh_instr_add_imm_rn_0,
+sh_instr_add_imm_rn_1,
+sh_instr_add_imm_rn_2,
+sh_instr_add_imm_rn_3,
+sh_instr_add_imm_rn_4,
+sh_instr_add_imm_rn_5,
+sh_instr_add_imm_rn_6,
+sh_instr_add_imm_rn_7,
+sh_instr_add_imm_rn_8,
+sh_instr_add_imm_rn_9,
+sh_instr_add_imm_rn_10,
+sh_instr_add_imm_rn_11,
+sh_instr_add_imm_rn_12,
+sh_instr_add_imm_rn_13,
+sh_instr_add_imm_rn_14,
+sh_instr_add_imm_rn_15 };
+
+void (*sh_alu_mov_imm_rn[16])(struct cpu *, struct sh_instr_call *) = {
+sh_instr_mov_imm_rn_0,
+sh_instr_mov_imm_rn_1,
+sh_instr_mov_imm_rn_2,
+sh_instr_mov_imm_rn_3,
+sh_instr_mov_imm_rn_4,
+sh_instr_mov_imm_rn_5,
+sh_instr_mov_imm_rn_6,
+sh_instr_mov_imm_rn_7,
+sh_instr_mov_imm_rn_8,
+sh_instr_mov_imm_rn_9,
+sh_instr_mov_imm_rn_10,
+sh_instr_mov_imm_rn_11,
+sh_instr_mov_imm_rn_12,
+sh_instr_mov_imm_rn_13,
+sh_instr_mov_imm_rn_14,
+sh_instr_mov_imm_rn_15 };
@@ -589,6 +589,55 @@ fatal("TODO.......asdgasin\n");
 }
 
 
+/*
+ *  dev_asc_select_done():
+ *
+ *  Cause the interrupt at the end of a selection, and go to the phase
+ *  which comes after the command.
+ */
+static void dev_asc_select_done(struct asc_data *d, int ok)
+{
+	d->reg_ro[NCR_STAT] |= NCRSTAT_INT;
+	d->reg_ro[NCR_INTR] |= NCRINTR_FC;
+	d->reg_ro[NCR_INTR] |= NCRINTR_BS;
+
+	if (ok == 2)
+		d->cur_phase = PHASE_DATA_OUT;
+	else if (d->xferp->data_in != NULL)
+		d->cur_phase = PHASE_DATA_IN;
+	else
+		d->cur_phase = PHASE_STATUS;
+
+	d->reg_ro[NCR_STAT] = (d->reg_ro[NCR_STAT] & ~7) | d->cur_phase;
+	d->reg_ro[NCR_STEP] = (d->reg_ro[NCR_STEP] & ~7) | 4;	/*  DONE (?)  */
+}
+
+
+/*
+ *  dev_asc_read_done():
+ *
+ *  Finish the selection of a READ command whose data is read asynchronously,
+ *  waiting for the data if necessary. This is a CPU event, scheduled by
+ *  dev_asc_select(); it is called earlier if the guest writes to a register
+ *  before then. Until then, the guest sees the controller as still busy
+ *  with the command.
+ */
+static void dev_asc_read_done(struct cpu *cpu, void *extra)
+{
+	struct asc_data *d = (struct asc_data *) extra;
+
+	if (d->xferp == NULL || d->xferp->read_req == NULL)
+		return;
+
+	cpu_event_cancel(cpu->machine, dev_asc_read_done, d);
+
+	diskimage_scsi_wait(d->xferp);
+	dev_asc_select_done(d, 1);
+
+	dev_asc_tick(cpu, d);
+}
+
+
 /*
  *  dev_asc_select():
  *
@@ -715,25 +764,18 @@ static int dev_asc_select(struct cpu *cpu, struct asc_data *d, int from_id,
 	}
 
 	/*
-	 *  Call the SCSI device to perform the command:
+	 *  Call the SCSI device to perform the command. Reads complete
+	 *  later; the interrupt is then caused by dev_asc_read_done().
 	 */
+	d->xferp->async_read = 1;
 	ok = diskimage_scsicommand(cpu, to_id, DISKIMAGE_SCSI, d->xferp);
 
-
-	/*  Cause an interrupt:  */
-	d->reg_ro[NCR_STAT] |= NCRSTAT_INT;
-	d->reg_ro[NCR_INTR] |= NCRINTR_FC;
-	d->reg_ro[NCR_INTR] |= NCRINTR_BS;
-
-	if (ok == 2)
-		d->cur_phase = PHASE_DATA_OUT;
-	else if (d->xferp->data_in != NULL)
-		d->cur_phase = PHASE_DATA_IN;
+	if (d->xferp->read_req != NULL)
+		cpu_event_schedule(cpu, cpu_ninstrs_now(cpu) +
+		    DISKIMAGE_ASYNC_READ_NINSTRS(d->xferp->data_in_len),
+		    dev_asc_read_done, d);
 	else
-		d->cur_phase = PHASE_STATUS;
-
-	d->reg_ro[NCR_STAT] = (d->reg_ro[NCR_STAT] & ~7) | d->cur_phase;
-	d->reg_ro[NCR_STEP] = (d->reg_ro[NCR_STEP] & ~7) | 4;	/*  DONE (?)  */
+		dev_asc_select_done(d, ok);
 
 	if (!quiet_mode)
 		debug("}");
@@ -808,6 +850,10 @@ DEVICE_ACCESS(asc)
 	if (writeflag == MEM_WRITE)
 		idata = memory_readmax64(cpu, data, len);
 
+	/*  A read in progress completes before any new command:  */
+	if (writeflag == MEM_WRITE)
+		dev_asc_read_done(cpu, d);
+
 #if 0
 	/*  Debug stuff useful when trying to make dev_asc compatible
 	    with the 'arc' emulation mode, which is different from
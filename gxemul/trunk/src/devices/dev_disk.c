@@ -29,6 +29,11 @@
  *
  *  Basic "disk" device. This is a simple test device which can be used to
  *  read and write data from disk devices.
+ *
+ *  Besides the original one-sector-at-a-time interface (via the data buffer),
+ *  it can transfer any number of sectors directly to or from emulated
+ *  physical memory, either to/from one contiguous range or via a list of
+ *  scatter-gather descriptors, and optionally interrupt when done.
  */
 
 #include <stdio.h>
@@ -39,6 +44,7 @@
 #include "device.h"
 #include "diskimage.h"
 #include "emul.h"
+#include "interrupt.h"
 #include "machine.h"
 #include "memory.h"
 #include "misc.h"
@@ -49,6 +55,9 @@ extern int verbose;
 
 #define	SECTOR_SIZE	512
 
+/*  Max nr of bytes moved to/from the disk image per diskimage_access call:  */
+#define	DISK_DMA_CHUNK	65536
+
 
 struct disk_data {
 	uint64_t	offset;
@@ -56,9 +65,130 @@ struct disk_data {
 	int		command;
 	int		status;
 	unsigned char	*buf;
+
+	uint64_t	dma_address;
+	uint64_t	dma_count;
+	unsigned char	*dma_buf;
+
+	struct interrupt irq;
+	int		interrupt_enable;
+	int		interrupt_asserted;
 };
 
 
+/*
+ *  disk_copy_guest():
+ *
+ *  Copies len bytes between buf and emulated physical memory at paddr, one
+ *  page at a time (so that code translations of written pages are
+ *  invalidated). Returns 1 on success, 0 on failure.
+ */
+static int disk_copy_guest(struct cpu *cpu, uint64_t paddr,
+	unsigned char *buf, size_t len, int writeflag)
+{
+	uint64_t pagesize = cpu->machine->arch_pagesize;
+
+	while (len > 0) {
+		size_t n = pagesize - (paddr & (pagesize - 1));
+		if (n > len)
+			n = len;
+
+		if (cpu->memory_rw(cpu, cpu->mem, paddr, buf, n, writeflag,
+		    PHYSICAL | NO_EXCEPTIONS) != MEMORY_ACCESS_OK)
+			return 0;
+
+		paddr += n;
+		buf += n;
+		len -= n;
+	}
+
+	return 1;
+}
+
+
+/*
+ *  disk_dma():
+ *
+ *  Transfers len bytes between the disk (at d->offset, which is advanced)
+ *  and emulated physical memory at paddr. Memory-mapped disk images are
+ *  copied directly from the mapping into emulated memory. Returns 1 on
+ *  success, 0 on failure.
+ */
+static int disk_dma(struct cpu *cpu, struct disk_data *d, uint64_t paddr,
+	uint64_t len, int to_disk)
+{
+	if ((len & (SECTOR_SIZE-1)) != 0) {
+		fatal("[ disk: DMA length (%lli) must be a multiple of %i ]\n",
+		    (long long)len, SECTOR_SIZE);
+		return 0;
+	}
+
+	if (d->dma_buf == NULL)
+		CHECK_ALLOCATION(d->dma_buf = (unsigned char *)
+		    malloc(DISK_DMA_CHUNK));
+
+	while (len > 0) {
+		size_t n = len < DISK_DMA_CHUNK? len : DISK_DMA_CHUNK;
+
+		if (to_disk) {
+			if (!disk_copy_guest(cpu, paddr, d->dma_buf, n,
+			    MEM_READ) || !diskimage_access(cpu->machine,
+			    d->disk_id, DISKIMAGE_IDE, 1, d->offset,
+			    d->dma_buf, n))
+				return 0;
+		} else {
+			unsigned char *src = (unsigned char *) diskimage_map(
+			    cpu->machine, d->disk_id, DISKIMAGE_IDE,
+			    d->offset, n);
+
+			if (src == NULL) {
+				if (!diskimage_access(cpu->machine, d->disk_id,
+				    DISKIMAGE_IDE, 0, d->offset, d->dma_buf, n))
+					return 0;
+				src = d->dma_buf;
+			}
+
+			if (!disk_copy_guest(cpu, paddr, src, n, MEM_WRITE))
+				return 0;
+		}
+
+		d->offset += n;
+		paddr += n;
+		len -= n;
+	}
+
+	return 1;
+}
+
+
+/*
+ *  disk_sg():
+ *
+ *  Scatter-gather transfer, using d->dma_count descriptors starting at
+ *  physical address d->dma_address. Returns 1 on success, 0 on failure.
+ */
+static int disk_sg(struct cpu *cpu, struct disk_data *d, int to_disk)
+{
+	unsigned char desc[DEV_DISK_SG_DESCRIPTOR_LEN];
+	uint64_t i, addr, len;
+
+	for (i = 0; i < d->dma_count; i++) {
+		if (cpu->memory_rw(cpu, cpu->mem, d->dma_address +
+		    i * DEV_DISK_SG_DESCRIPTOR_LEN, desc, sizeof(desc),
+		    MEM_READ, PHYSICAL | NO_EXCEPTIONS) != MEMORY_ACCESS_OK)
+			return 0;
+
+		addr = memory_readmax64(cpu, desc + DEV_DISK_SG_ADDRESS, 8);
+		len = memory_readmax64(cpu, desc + DEV_DISK_SG_LENGTH, 8);
+
+		if (!disk_dma(cpu, d, addr, len, to_disk))
+			return 0;
+	}
+
+	return 1;
+}
+
+
 DEVICE_ACCESS(disk_buf)
 {
 	struct disk_data *d = (struct disk_data *) extra;
@@ -116,35 +246,100 @@ DEVICE_ACCESS(disk)
 			odata = d->command;
 		} else {
 			d->command = idata;
+
+			if (verbose >= 2) {
+				debug("[ disk: operation %i disk %i offset "
+				    "%lli ]\n", d->command, d->disk_id,
+				    (long long)d->offset);
+			}
+
 			switch (d->command) {
-			case 0:	d->status = diskimage_access(cpu->machine,
+			case DEV_DISK_OPERATION_READ:
+				d->status = diskimage_access(cpu->machine,
 				     d->disk_id, DISKIMAGE_IDE, 0,
 				     d->offset, d->buf, SECTOR_SIZE);
+				d->offset += SECTOR_SIZE;
 				break;
-			case 1:	d->status = diskimage_access(cpu->machine,
+			case DEV_DISK_OPERATION_WRITE:
+				d->status = diskimage_access(cpu->machine,
 				     d->disk_id, DISKIMAGE_IDE, 1,
 				     d->offset, d->buf, SECTOR_SIZE);
+				d->offset += SECTOR_SIZE;
+				break;
+			case DEV_DISK_OPERATION_DMA_READ:
+			case DEV_DISK_OPERATION_DMA_WRITE:
+				d->status = disk_dma(cpu, d, d->dma_address,
+				    d->dma_count * SECTOR_SIZE, d->command ==
+				    DEV_DISK_OPERATION_DMA_WRITE);
 				break;
+			case DEV_DISK_OPERATION_SG_READ:
+			case DEV_DISK_OPERATION_SG_WRITE:
+				d->status = disk_sg(cpu, d, d->command ==
+				    DEV_DISK_OPERATION_SG_WRITE);
+				break;
+			default:fatal("[ disk: unimplemented operation %i"
+				    " ]\n", d->command);
+				d->status = 0;
 			}
-			
-			if (verbose >= 2) {
-				debug("[ disk: %s disk %i offset %lli ]\n",
-					d->command ? "WRITE" : "READ",
-					d->disk_id, (long long)d->offset);
+
+			if (d->interrupt_enable) {
+				d->interrupt_asserted = 1;
+				INTERRUPT_ASSERT(d->irq);
 			}
-			
-			d->offset += SECTOR_SIZE;
 		}
 		break;
 
 	case DEV_DISK_STATUS:
 		if (writeflag == MEM_READ) {
 			odata = d->status;
+
+			/*  Reading the status acknowledges the interrupt:  */
+			if (d->interrupt_asserted) {
+				d->interrupt_asserted = 0;
+				INTERRUPT_DEASSERT(d->irq);
+			}
 		} else {
 			d->status = idata;
 		}
 		break;
 
+	case DEV_DISK_DMA_ADDRESS:
+		if (writeflag == MEM_READ) {
+			odata = d->dma_address;
+		} else {
+			d->dma_address = idata;
+		}
+		break;
+
+	case DEV_DISK_DMA_ADDRESS_HIGH32:
+		if (writeflag == MEM_READ) {
+			odata = d->dma_address >> 32;
+		} else {
+			d->dma_address = (uint32_t)d->dma_address |
+			    (idata << 32);
+		}
+		break;
+
+	case DEV_DISK_DMA_COUNT:
+		if (writeflag == MEM_READ) {
+			odata = d->dma_count;
+		} else {
+			d->dma_count = idata;
+		}
+		break;
+
+	case DEV_DISK_INTERRUPT:
+		if (writeflag == MEM_READ) {
+			odata = d->interrupt_asserted;
+		} else {
+			d->interrupt_enable = idata != 0;
+			if (!d->interrupt_enable && d->interrupt_asserted) {
+				d->interrupt_asserted = 0;
+				INTERRUPT_DEASSERT(d->irq);
+			}
+		}
+		break;
+
 	default:if (writeflag == MEM_WRITE) {
 			fatal("[ disk: unimplemented write to "
 			    "offset 0x%x: data=0x%x ]\n", (int)
@@ -171,6 +366,8 @@ DEVINIT(disk)
 	CHECK_ALLOCATION(d = (struct disk_data *) malloc(sizeof(struct disk_data)));
 	memset(d, 0, sizeof(struct disk_data));
 
+	INTERRUPT_CONNECT(devinit->interrupt_path, d->irq);
+
 	nlen = strlen(devinit->name) + 30;
 	CHECK_ALLOCATION(n1 = (char *) malloc(nlen));
 	CHECK_ALLOCATION(n2 = (char *) malloc(nlen));
@@ -88,6 +88,19 @@ static void m8820x_command(struct cpu *cpu, struct m8820x_data *d)
 		if (cmd == CMMU_FLUSH_SUPER_ALL || cmd == CMMU_FLUSH_SUPER_PAGE)
 			super = M8820X_PATC_SUPERVISOR_BIT;
 
+		if (!all) {
+			/*  Invalidate the matching page, found via the
+			    PATC hash index:  */
+			int i;
+			while ((i = m8820x_patc_lookup(cmmu, sar, super)) >= 0) {
+				uint32_t v = cmmu->patc_v_and_control[i];
+				cmmu->patc_v_and_control[i] = v & ~PG_V;
+				cpu->invalidate_translation_caches(cpu,
+				    v & ~0xfff, INVALIDATE_VADDR);
+			}
+			break;
+		}
+
 		for (size_t i = 0; i < N_M88200_PATC_ENTRIES; i++) {
 			uint32_t v = cmmu->patc_v_and_control[i];
 			uint32_t p = cmmu->patc_p_and_supervisorbit[i];
@@ -100,20 +113,11 @@ static void m8820x_command(struct cpu *cpu, struct m8820x_data *d)
 			if ((p & M8820X_PATC_SUPERVISOR_BIT) != super)
 				continue;
 
-			/*  If not all pages are to be invalidated, there
-			    must be a virtual address match:  */
-			if (!all && (sar & 0xfffff000) != (v & 0xfffff000))
-				continue;
-
 			/*  Finally, invalidate the entry:  */
 			cmmu->patc_v_and_control[i] = v & ~PG_V;
-
-			if (!all)
-				cpu->invalidate_translation_caches(cpu, v & ~0xfff, INVALIDATE_VADDR);
 		}
 
-		if (all)
-			cpu->invalidate_translation_caches(cpu, 0, INVALIDATE_ALL);
+		cpu->invalidate_translation_caches(cpu, 0, INVALIDATE_ALL);
 
 		break;
 
@@ -137,6 +137,31 @@ DEVICE_TICK(mb89352)
 }
 
 
+/*
+ *  mb89352_read_done():
+ *
+ *  CPU event, scheduled when a READ command was started: waits for the data
+ *  (if the host has not read it yet), and then goes on to the data in phase
+ *  the same way as for other commands.
+ */
+static void mb89352_read_done(struct cpu *cpu, void *extra)
+{
+	struct mb89352_data *d = (struct mb89352_data *) extra;
+
+	if (d->xferp == NULL || d->xferp->read_req == NULL)
+		return;
+
+	diskimage_scsi_wait(d->xferp);
+
+	d->phase = PH_DATAIN;
+	d->reg[PSNS] |= PSNS_REQ;
+	d->reg[SSTS] &= ~SSTS_XFR;
+	d->reg[INTS] |= INTS_CMD_DONE;
+
+	reassert_interrupts(d);
+}
+
+
 int mb89352_dreg_read(struct cpu* cpu, struct mb89352_data *d, int writeflag)
 {
 	int odata;
@@ -261,9 +286,19 @@ void mb89352_dreg_write(struct cpu* cpu, struct mb89352_data *d, int writeflag,
 		break;
 
 	case PH_CMD:
+		d->xferp->async_read = 1;
 		res = diskimage_scsicommand(cpu,
 	    	    d->target, DISKIMAGE_SCSI, d->xferp);
 
+		// A READ stays in the command phase until the data has
+		// been read; see mb89352_read_done().
+		if (d->xferp->read_req != NULL) {
+			cpu_event_schedule(cpu, cpu_ninstrs_now(cpu) +
+			    DISKIMAGE_ASYNC_READ_NINSTRS(d->xferp->data_in_len),
+			    mb89352_read_done, d);
+			return;
+		}
+
 		if (res == 2)
 			d->phase = PH_DATAOUT;
 		else if (d->xferp->data_in != NULL)
@@ -383,6 +418,8 @@ DEVICE_ACCESS(mb89352)
 					d->phase = PH_CMD;
 					d->reg[PSNS] |= PSNS_REQ;
 
+					cpu_event_cancel(cpu->machine,
+					    mb89352_read_done, d);
 					if (d->xferp != NULL)
 						scsi_transfer_free(d->xferp);
 
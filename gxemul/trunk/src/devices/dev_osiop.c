@@ -98,6 +98,10 @@ struct osiop_data {
 };
 
 
+/*  This is referenced below.  */
+static void osiop_read_done(struct cpu *cpu, void *extra);
+
+
 static void osiop_free_xfer(struct osiop_data *d)
 {
 	if (d->xferp != NULL)
@@ -416,6 +420,9 @@ int osiop_execute_scripts_instr(struct cpu *cpu, struct osiop_data *d)
 					xfer_byte_count --;
 				}
 
+				/*  Reads complete later, in osiop_read_done():  */
+				d->xferp->async_read = 1;
+
 				res = diskimage_scsicommand(cpu,
 				    d->selected_id, DISKIMAGE_SCSI, d->xferp);
 				if (res == 0) {
@@ -425,7 +432,13 @@ int osiop_execute_scripts_instr(struct cpu *cpu, struct osiop_data *d)
 
 				d->data_offset = 0;
 				
-				if (res == 2)
+				if (d->xferp->read_req != NULL)
+					cpu_event_schedule(cpu,
+					    cpu_ninstrs_now(cpu) +
+					    DISKIMAGE_ASYNC_READ_NINSTRS(
+					    d->xferp->data_in_len),
+					    osiop_read_done, d);
+				else if (res == 2)
 					osiop_set_scsi_phase(d, DATA_OUT_PHASE);
 				else if (d->xferp->data_in_len > 0)
 					osiop_set_scsi_phase(d, DATA_IN_PHASE);
@@ -783,7 +796,8 @@ int osiop_execute_scripts_instr(struct cpu *cpu, struct osiop_data *d)
  *  osiop_execute_scripts():
  *
  *  Interprets SCRIPTS machine code by reading one instruction word at a time,
- *  and executing it.
+ *  and executing it. While the target is still reading data for a READ
+ *  command, it stays in the COMMAND phase, and the SCRIPTS processor waits.
  */
 void osiop_execute_scripts(struct cpu *cpu, struct osiop_data *d)
 {
@@ -793,6 +807,7 @@ void osiop_execute_scripts(struct cpu *cpu, struct osiop_data *d)
 		debug("{ SCRIPTS start }\n");
 
 	while (d->scripts_running && n < MAX_SCRIPTS_PER_CHUNK &&
+	    (d->xferp == NULL || d->xferp->read_req == NULL) &&
 	    osiop_execute_scripts_instr(cpu, d))
 		n++;
 
@@ -801,6 +816,34 @@ void osiop_execute_scripts(struct cpu *cpu, struct osiop_data *d)
 }
 
 
+/*
+ *  osiop_read_done():
+ *
+ *  CPU event, scheduled when a READ command was started: waits for the data
+ *  (if the host has not read it yet), moves on to the next phase, and lets
+ *  the SCRIPTS processor continue.
+ */
+static void osiop_read_done(struct cpu *cpu, void *extra)
+{
+	struct osiop_data *d = (struct osiop_data *) extra;
+
+	if (d->xferp == NULL || d->xferp->read_req == NULL)
+		return;
+
+	diskimage_scsi_wait(d->xferp);
+
+	if (d->xferp->data_in_len > 0)
+		osiop_set_scsi_phase(d, DATA_IN_PHASE);
+	else
+		osiop_set_scsi_phase(d, STATUS_PHASE);
+
+	if (d->scripts_running)
+		osiop_execute_scripts(cpu, d);
+
+	osiop_reassert_interrupts(d);
+}
+
+
 DEVICE_TICK(osiop)
 {
 	struct osiop_data *d = (struct osiop_data *) extra;
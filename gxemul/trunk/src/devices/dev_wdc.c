@@ -69,6 +69,11 @@ struct wdc_data {
 
 	int		int_assert;
 
+	/*  Asynchronous READ in progress, into read_buf:  */
+	struct diskimage_request *read_req;
+	unsigned char	*read_buf;
+	int		read_len;
+
 	int		write_in_progress;
 	int		write_count;
 	int64_t		write_offset;
@@ -140,6 +145,34 @@ static void wdc_addtoinbuf(struct wdc_data *d, int c)
 }
 
 
+/*
+ *  wdc_addbuftoinbuf():
+ *
+ *  Like wdc_addtoinbuf(), but for len bytes at a time.
+ */
+static void wdc_addbuftoinbuf(struct wdc_data *d, const unsigned char *p,
+	int len)
+{
+	int room = (d->inbuf_tail - d->inbuf_head - 1 + WDC_INBUF_SIZE)
+	    % WDC_INBUF_SIZE;
+
+	if (len > room)
+		fatal("[ wdc_addbuftoinbuf(): WARNING! wdc inbuf overrun!"
+		    " Increase WDC_MAX_SECTORS. ]\n");
+
+	while (len > 0) {
+		int chunk = WDC_INBUF_SIZE - d->inbuf_head;
+		if (chunk > len)
+			chunk = len;
+
+		memcpy(d->inbuf + d->inbuf_head, p, chunk);
+		d->inbuf_head = (d->inbuf_head + chunk) % WDC_INBUF_SIZE;
+		p += chunk;
+		len -= chunk;
+	}
+}
+
+
 /*
  *  wdc_get_inbuf():
  *
@@ -257,19 +290,69 @@ static void wdc_initialize_identify_struct(struct cpu *cpu, struct wdc_data *d)
 	d->identify_struct[2 * 67 + 1] = 120;
 	d->identify_struct[2 * 68 + 0] = 0;
 	d->identify_struct[2 * 68 + 1] = 120;
+
+	/*  83, 86: Command sets supported/enabled. 0x1000 = FLUSH CACHE
+	    (bit 14 of word 83 must be set, for the word to be valid)  */
+	d->identify_struct[2 * 83 + 0] = 0x50;
+	d->identify_struct[2 * 83 + 1] = 0x00;
+	d->identify_struct[2 * 86 + 0] = 0x10;
+	d->identify_struct[2 * 86 + 1] = 0x00;
+
+	/*  82, 85: Command sets supported/enabled. 0x0020 = write cache  */
+	if (diskimage_has_write_cache(cpu->machine, d->drive + d->base_drive,
+	    DISKIMAGE_IDE)) {
+		d->identify_struct[2 * 82 + 1] = 0x20;
+		d->identify_struct[2 * 85 + 1] = 0x20;
+	}
+}
+
+
+/*
+ *  wdc__read_complete():
+ *
+ *  Waits for the READ in progress (if any) to finish, moves the data into the
+ *  inbuf, and asserts the interrupt. This is a CPU event, scheduled by
+ *  wdc__read(); it is called earlier if the guest starts a new command or
+ *  reads data before then.
+ */
+static void wdc__read_complete(struct cpu *cpu, void *extra)
+{
+	struct wdc_data *d = (struct wdc_data *) extra;
+
+	if (d->read_req == NULL)
+		return;
+
+	cpu_event_cancel(cpu->machine, wdc__read_complete, d);
+
+	if (diskimage_request_wait(d->read_req) < 0)
+		d->error |= WDCE_UNC;
+	else
+		wdc_addbuftoinbuf(d, d->read_buf, d->read_len);
+
+	d->read_req = NULL;
+
+	free(d->read_buf);
+	d->read_buf = NULL;
+
+	d->int_assert = 1;
+	INTERRUPT_ASSERT(d->irq);
 }
 
 
 /*
  *  wdc__read():
+ *
+ *  Starts reading the sectors into read_buf, asynchronously if possible. The
+ *  controller reports BSY until wdc__read_complete() has moved the data into
+ *  the inbuf and raised the interrupt, DISKIMAGE_ASYNC_READ_NINSTRS later.
+ *
+ *  Memory-mapped disk images are copied into the inbuf right away instead.
  */
 void wdc__read(struct cpu *cpu, struct wdc_data *d)
 {
-#define MAX_SECTORS_PER_CHUNK	64
-	const int max_sectors_per_chunk = MAX_SECTORS_PER_CHUNK;
-	unsigned char buf[512 * MAX_SECTORS_PER_CHUNK];
-	int i, cyl = d->cyl_hi * 256+ d->cyl_lo;
+	int cyl = d->cyl_hi * 256+ d->cyl_lo;
 	int count = d->seccnt? d->seccnt : 256;
+	const unsigned char *mapped;
 	uint64_t offset = 512 * (d->sector - 1
 	    + (int64_t)d->head * d->sectors_per_track[d->drive] +
 	    (int64_t)d->heads[d->drive] * d->sectors_per_track[d->drive] * cyl);
@@ -282,31 +365,24 @@ void wdc__read(struct cpu *cpu, struct wdc_data *d)
 	printf("WDC read from offset %lli\n", (long long)offset);
 #endif
 
-	while (count > 0) {
-		int to_read = count > max_sectors_per_chunk?
-		    max_sectors_per_chunk : count;
+	d->read_len = 512 * count;
 
-		/*  TODO: result code from the read?  */
+	mapped = diskimage_map(cpu->machine, d->drive + d->base_drive,
+	    DISKIMAGE_IDE, offset, d->read_len);
+	if (mapped != NULL) {
+		wdc_addbuftoinbuf(d, mapped, d->read_len);
+		d->int_assert = 1;
+		return;
+	}
 
-		if (d->inbuf_head + 512 * to_read <= WDC_INBUF_SIZE) {
-			diskimage_access(cpu->machine, d->drive + d->base_drive,
-			    DISKIMAGE_IDE, 0, offset,
-			    d->inbuf + d->inbuf_head, 512 * to_read);
-			d->inbuf_head += 512 * to_read;
-			if (d->inbuf_head == WDC_INBUF_SIZE)
-				d->inbuf_head = 0;
-		} else {
-			diskimage_access(cpu->machine, d->drive + d->base_drive,
-			    DISKIMAGE_IDE, 0, offset, buf, 512 * to_read);
-			for (i=0; i<512 * to_read; i++)
-				wdc_addtoinbuf(d, buf[i]);
-		}
+	CHECK_ALLOCATION(d->read_buf = (unsigned char *) malloc(d->read_len));
 
-		offset += 512 * to_read;
-		count -= to_read;
-	}
+	d->read_req = diskimage_access_async(cpu->machine,
+	    d->drive + d->base_drive, DISKIMAGE_IDE, 0, offset,
+	    d->read_buf, d->read_len);
 
-	d->int_assert = 1;
+	cpu_event_schedule(cpu, cpu_ninstrs_now(cpu) +
+	    DISKIMAGE_ASYNC_READ_NINSTRS(d->read_len), wdc__read_complete, d);
 }
 
 
@@ -345,6 +421,10 @@ void wdc__write(struct cpu *cpu, struct wdc_data *d)
 static int status_byte(struct wdc_data *d, struct cpu *cpu)
 {
 	int odata = 0;
+
+	if (d->read_req != NULL)
+		return WDCS_BSY;
+
 	if (diskimage_exist(cpu->machine, d->drive + d->base_drive,
 	    DISKIMAGE_IDE))
 		odata |= WDCS_DRDY | WDCS_DSC;
@@ -395,6 +475,9 @@ void wdc_command(struct cpu *cpu, struct wdc_data *d, int idata)
 {
 	size_t i;
 
+	/*  Let any READ which is still in progress finish first:  */
+	wdc__read_complete(cpu, d);
+
 	d->cur_command = idata;
 	d->atapi_cmd_in_progress = 0;
 	d->error = 0;
@@ -483,6 +566,13 @@ void wdc_command(struct cpu *cpu, struct wdc_data *d, int idata)
 		d->int_assert = 1;
 		break;
 
+	case WDCC_FLUSHCACHE:
+		debug("[ wdc: FLUSHCACHE drive %i ]\n", d->drive);
+		diskimage_sync(cpu->machine, d->drive + d->base_drive,
+		    DISKIMAGE_IDE);
+		d->int_assert = 1;
+		break;
+
 	case WDCC_IDLE_IMMED:
 		debug("[ wdc: IDLE_IMMED drive %i ]\n", d->drive);
 		/*  TODO: interrupt here?  */
@@ -561,6 +651,9 @@ DEVICE_ACCESS(wdc)
 
 	case wd_data:	/*  0: data  */
 		if (writeflag == MEM_READ) {
+			/*  The guest should have waited for !BSY, but...  */
+			wdc__read_complete(cpu, d);
+
 			odata = wdc_get_inbuf(d);
 
 			if (cpu->byte_order == EMUL_LITTLE_ENDIAN) {
@@ -715,8 +808,8 @@ DEVICE_ACCESS(wdc)
 					if (d->atapi_st->data_in != NULL) {
 						d->atapi_phase = PHASE_DATAIN;
 						d->atapi_len = d->atapi_st->data_in_len;
-						for (int j=0; j<d->atapi_len; j++)
-							wdc_addtoinbuf(d, d->atapi_st->data_in[j]);
+						wdc_addbuftoinbuf(d, d->atapi_st->data_in,
+						    d->atapi_len);
 
 						if (d->atapi_len > 32768)
 							d->atapi_len = 32768;
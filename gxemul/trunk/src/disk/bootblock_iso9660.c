@@ -54,6 +54,83 @@
 /*  #define ISO_DEBUG  */
 
 
+#define	ISO_SECTOR_SIZE		2048
+
+/*
+ *  Extents (whole sectors) of the image which have been read while looking
+ *  for the file to boot. Directory records are small and read one at a
+ *  time, so without this, the same sectors would be read over and over.
+ */
+struct iso_extent {
+	struct iso_extent	*next;
+	uint64_t		ofs;
+	size_t			len;
+	unsigned char		*data;
+};
+
+
+/*
+ *  iso_read():
+ *
+ *  Returns a pointer to len bytes at offset ofs of a disk image: directly
+ *  into the image if it is mapped into memory, otherwise into a cached
+ *  extent (which is read, sector aligned, if it isn't cached yet). Returns
+ *  NULL if the data could not be read.
+ */
+static const unsigned char *iso_read(struct iso_extent **cachep,
+	struct machine *m, int disk_id, int disk_type, uint64_t ofs, size_t len)
+{
+	const unsigned char *mapped;
+	struct iso_extent *e;
+	uint64_t aligned_ofs;
+
+	mapped = diskimage_map(m, disk_id, disk_type, ofs, len);
+	if (mapped != NULL)
+		return mapped;
+
+	for (e = *cachep; e != NULL; e = e->next)
+		if (ofs >= e->ofs && ofs + len <= e->ofs + e->len)
+			return e->data + (ofs - e->ofs);
+
+	aligned_ofs = ofs & ~(uint64_t)(ISO_SECTOR_SIZE - 1);
+
+	CHECK_ALLOCATION(e = (struct iso_extent *)
+	    malloc(sizeof(struct iso_extent)));
+	e->ofs = aligned_ofs;
+	e->len = ((ofs + len - aligned_ofs - 1) | (ISO_SECTOR_SIZE - 1)) + 1;
+	CHECK_ALLOCATION(e->data = (unsigned char *) malloc(e->len));
+
+	if (!diskimage_access(m, disk_id, disk_type, 0, e->ofs, e->data,
+	    e->len)) {
+		/*  The last sector may be short; retry with just the data:  */
+		e->ofs = ofs;
+		e->len = len;
+		if (!diskimage_access(m, disk_id, disk_type, 0, e->ofs,
+		    e->data, e->len)) {
+			free(e->data);
+			free(e);
+			return NULL;
+		}
+	}
+
+	e->next = *cachep;
+	*cachep = e;
+
+	return e->data + (ofs - e->ofs);
+}
+
+
+static void iso_free_extents(struct iso_extent *e)
+{
+	while (e != NULL) {
+		struct iso_extent *next = e->next;
+		free(e->data);
+		free(e);
+		e = next;
+	}
+}
+
+
 static void debug_print_volume_id_and_filename(int iso_type,
 	unsigned char *buf, char *filename)
 {
@@ -103,7 +180,9 @@ int iso_load_bootblock(struct machine *m, struct cpu *cpu,
 	int filenr, dirlen, res = 0, res2, found_dir;
 	uint64_t dirofs, fileofs;
 	ssize_t filelen;
-	unsigned char *dirbuf = NULL, *dp, *match_entry = NULL, *filebuf = NULL;
+	const unsigned char *dirbuf, *dp, *filedata;
+	unsigned char *match_entry = NULL, *filebuf = NULL;
+	struct iso_extent *extents = NULL;
 	char *p, *filename_orig, *filename, *tmpfname = NULL;
 	char **new_array;
 	const char *tmpdir = getenv("TMPDIR");
@@ -174,10 +253,8 @@ int iso_load_bootblock(struct machine *m, struct cpu *cpu,
 	debug("root = %i bytes at 0x%llx\n", dirlen, (long long)dirofs);
 #endif
 
-	CHECK_ALLOCATION(dirbuf = (unsigned char *) malloc(dirlen));
-	res2 = diskimage_access(m, disk_id, disk_type, 0, dirofs, dirbuf,
-	    dirlen);
-	if (!res2) {
+	dirbuf = iso_read(&extents, m, disk_id, disk_type, dirofs, dirlen);
+	if (dirbuf == NULL) {
 		fatal("Couldn't read the disk image. Aborting.\n");
 		goto ret;
 	}
@@ -257,10 +334,6 @@ int iso_load_bootblock(struct machine *m, struct cpu *cpu,
 
 	/*  debug("dirofs = 0x%llx\n", (long long)dirofs);  */
 
-	/*  Free the old dirbuf, and allocate a new one:  */
-	free(dirbuf);
-	CHECK_ALLOCATION(dirbuf = (unsigned char *) malloc(512));
-
 	for (;;) {
 		size_t len, i;
 
@@ -271,9 +344,9 @@ int iso_load_bootblock(struct machine *m, struct cpu *cpu,
 		}
 
 		// debug("dirofs = %lli\n", (long long)dirofs);
-		res2 = diskimage_access(m, disk_id, disk_type, 0, dirofs,
-		    dirbuf, 256);
-		if (!res2) {
+		dirbuf = iso_read(&extents, m, disk_id, disk_type, dirofs,
+		    256);
+		if (dirbuf == NULL) {
 			fatal("Couldn't read the disk image. Aborting.\n");
 			goto ret;
 		}
@@ -307,7 +380,7 @@ printf("\n");
 
 		for (i=32; i<len; i++) {
 			if (i < len - strlen(filename))
-				if (strncmp(filename, (char *)dp + i,
+				if (strncmp(filename, (const char *)dp + i,
 				    strlen(filename)) == 0) {
 					/*  The filename was found somewhere
 					    in the directory entry.  */
@@ -319,8 +392,8 @@ printf("\n");
 						exit(1);
 					}
 					CHECK_ALLOCATION(match_entry = (unsigned char *)
-					    malloc(512));
-					memcpy(match_entry, dp, 512);
+					    malloc(256));
+					memcpy(match_entry, dp, 256);
 					break;
 				}
 		}
@@ -353,16 +426,22 @@ printf("\n");
 	/*  debug("filelen=%llx fileofs=%llx\n", (long long)filelen,
 	    (long long)fileofs);  */
 
-	CHECK_ALLOCATION(filebuf = (unsigned char *) malloc(filelen));
-
 	CHECK_ALLOCATION(tmpfname = (char *) malloc(300));
 	snprintf(tmpfname, 300, "%s/gxemul.XXXXXXXXXXXX", tmpdir);
 
-	res2 = diskimage_access(m, disk_id, disk_type, 0, fileofs, filebuf,
-	    filelen);
-	if (!res2) {
-		fatal("could not read the file from the disk image!\n");
-		goto ret;
+	/*  Write straight from the image if it is mapped into memory:  */
+	filedata = diskimage_map(m, disk_id, disk_type, fileofs, filelen);
+	if (filedata == NULL) {
+		CHECK_ALLOCATION(filebuf = (unsigned char *) malloc(filelen));
+
+		res2 = diskimage_access(m, disk_id, disk_type, 0, fileofs,
+		    filebuf, filelen);
+		if (!res2) {
+			fatal("could not read the file from the disk image!\n");
+			goto ret;
+		}
+
+		filedata = filebuf;
 	}
 
 	tmpfile_handle = mkstemp(tmpfname);
@@ -371,7 +450,7 @@ printf("\n");
 		goto ret;
 	}
 
-	if (write(tmpfile_handle, filebuf, filelen) != filelen) {
+	if (write(tmpfile_handle, filedata, filelen) != filelen) {
 		fatal("could not write to %s\n", tmpfname);
 		perror("write");
 		goto ret;
@@ -399,8 +478,7 @@ printf("\n");
 	res = 1;
 
 ret:
-	if (dirbuf != NULL)
-		free(dirbuf);
+	iso_free_extents(extents);
 
 	if (filebuf != NULL)
 		free(filebuf);
@@ -29,11 +29,10 @@
  *
  *  TODO:  diskimage_remove()? This would be useful for floppies in PC-style
  *	   machines, where disks may need to be swapped during boot etc.
- *
- *  TODO:  expose do_fsync as a command line option?
  */
 
 #include <errno.h>
+#include <fcntl.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -45,9 +44,27 @@
 #include "diskimage.h"
 #include "machine.h"
 #include "misc.h"
+#include "settings.h"
+
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#endif
+
 
+extern struct settings *global_settings;
+
+/*
+ *  If non-zero, files written to by a disk image are put on stable storage
+ *  (fdatasync) when the guest flushes the disk's write cache.
+ */
+int diskimage_sync_on_flush = 1;
 
-int do_fsync = 0;
+/*  Block cache size in bytes (0 = no cache), and statistics:  */
+int64_t diskimage_cache_size = DEFAULT_DISKIMAGE_CACHE_SIZE;
+static uint64_t diskimage_cache_hits = 0;
+static uint64_t diskimage_cache_misses = 0;
+static uint64_t diskimage_cache_readaheads = 0;
+static uint64_t diskimage_cache_writebacks = 0;
 
 /*  #define debug fatal  */
 
@@ -57,43 +74,116 @@ static const char *diskimage_types[] = DISKIMAGE_TYPES;
 /**************************************************************************/
 
 /*
- *  my_fseek():
+ *  diskimage_pread(), diskimage_pwrite():
  *
- *  A helper function, like fseek() but takes off_t.  If the system has
- *  fseeko, then that is used. Otherwise I try to fake off_t offsets here.
+ *  Positional read/write helpers. Each access is a single pread()/pwrite()
+ *  syscall at an explicit offset; there is no separate seek, no stdio
+ *  buffer to copy through or invalidate, and no shared file position.
+ *  Interrupted and short transfers are retried, except that a read stops
+ *  at end of file.
  *
- *  The correct position is reached by seeking 2 billion bytes at a time
- *  (or less).  Note: This method is only used for SEEK_SET, for SEEK_CUR
- *  and SEEK_END, normal fseek() is used!
- *
- *  TODO: It seemed to work on Linux/i386, but not on Solaris/sparc (?).
- *  Anyway, most modern systems have fseeko(), so it shouldn't be a problem.
+ *  Returns the number of bytes transferred, or -1 if nothing could be
+ *  transferred because of an error.
  */
-static int my_fseek(FILE *f, off_t offset, int whence)
+ssize_t diskimage_pread(int fd, unsigned char *buf, size_t len,
+	off_t offset)
 {
-#ifdef HACK_FSEEKO
-	if (whence == SEEK_SET) {
-		int res = 0;
-		off_t curoff = 0;
-		off_t cur_step;
-
-		fseek(f, 0, SEEK_SET);
-		while (curoff < offset) {
-			/*  How far to seek?  */
-			cur_step = offset - curoff;
-			if (cur_step > 2000000000)
-				cur_step = 2000000000;
-			res = fseek(f, cur_step, SEEK_CUR);
-			if (res)
-				return res;
-			curoff += cur_step;
+	size_t done = 0;
+
+	while (done < len) {
+		ssize_t res = pread(fd, buf + done, len - done, offset + done);
+		if (res < 0) {
+			if (errno == EINTR)
+				continue;
+			return done > 0? (ssize_t) done : -1;
 		}
-		return 0;
-	} else
-		return fseek(f, offset, whence);
+		if (res == 0)
+			break;
+		done += res;
+	}
+
+	return done;
+}
+
+ssize_t diskimage_pwrite(int fd, const unsigned char *buf, size_t len,
+	off_t offset)
+{
+	size_t done = 0;
+
+	while (done < len) {
+		ssize_t res = pwrite(fd, buf + done, len - done, offset + done);
+		if (res < 0) {
+			if (errno == EINTR)
+				continue;
+			return done > 0? (ssize_t) done : -1;
+		}
+		done += res;
+	}
+
+	return done;
+}
+
+
+/*
+ *  diskimage_fdatasync():
+ *
+ *  Puts the data of a file on stable storage. (The file's metadata, such as
+ *  timestamps, is not needed to read the data back, so fdatasync() is used
+ *  where it exists.)
+ */
+static void diskimage_fdatasync(int fd)
+{
+	int res;
+
+	if (fd < 0)
+		return;
+
+	do {
+#ifdef HAVE_FDATASYNC
+		res = fdatasync(fd);
 #else
-	return fseeko(f, offset, whence);
+		res = fsync(fd);
 #endif
+	} while (res < 0 && errno == EINTR);
+
+	if (res < 0)
+		fatal("[ diskimage: could not sync to stable storage: %s ]\n",
+		    strerror(errno));
+}
+
+
+/*
+ *  base_pread(), base_pwrite():
+ *
+ *  Read from or write to the disk image itself (not its overlays), which is
+ *  either a raw file or a sparse image.
+ */
+static ssize_t base_pread(struct diskimage *d, unsigned char *buf, size_t len,
+	off_t offset)
+{
+	if (d->sparse != NULL)
+		return diskimage_sparse_pread(d->sparse, buf, len, offset);
+
+	/*  Memory-mapped images are read without any system call:  */
+	if (d->mmap_base != NULL && offset >= 0) {
+		if ((size_t) offset >= d->mmap_len)
+			return 0;
+		if (len > d->mmap_len - offset)
+			len = d->mmap_len - offset;
+		memcpy(buf, d->mmap_base + offset, len);
+		return len;
+	}
+
+	return diskimage_pread(d->fd, buf, len, offset);
+}
+
+static ssize_t base_pwrite(struct diskimage *d, const unsigned char *buf,
+	size_t len, off_t offset)
+{
+	if (d->sparse != NULL)
+		return diskimage_sparse_pwrite(d->sparse, buf, len, offset);
+
+	return diskimage_pwrite(d->fd, buf, len, offset);
 }
 
 
@@ -119,6 +209,46 @@ int diskimage_exist(struct machine *machine, int id, int type)
 }
 
 
+/*
+ *  overlay_load_bitmap():
+ *
+ *  Reads an overlay's whole bitmap file into memory. Byte i, bit j of the
+ *  file describes block 8*i + j.
+ */
+static bool overlay_load_bitmap(struct diskimage_overlay *ov)
+{
+	struct stat st;
+	unsigned char *bytes;
+	size_t i, nbytes;
+
+	if (fstat(ov->fd_bitmap, &st) != 0)
+		return false;
+
+	nbytes = st.st_size;
+	ov->bitmap_words = (nbytes + 7) / 8;
+	ov->dirty_lo = ov->dirty_hi = 0;
+	CHECK_ALLOCATION(ov->bitmap = (uint64_t *) calloc(
+	    ov->bitmap_words + 1, sizeof(uint64_t)));
+
+	if (nbytes == 0)
+		return true;
+
+	CHECK_ALLOCATION(bytes = (unsigned char *) malloc(nbytes));
+	if (diskimage_pread(ov->fd_bitmap, bytes, nbytes, 0) != (ssize_t) nbytes) {
+		free(bytes);
+		free(ov->bitmap);
+		ov->bitmap = NULL;
+		return false;
+	}
+
+	for (i = 0; i < nbytes; i++)
+		ov->bitmap[i / 8] |= (uint64_t) bytes[i] << (8 * (i % 8));
+
+	free(bytes);
+	return true;
+}
+
+
 /*
  *  diskimage_add_overlay():
  *
@@ -135,8 +265,8 @@ bool diskimage_add_overlay(struct diskimage *d, char *overlay_basename, bool rem
 	snprintf(bitmap_name, bitmap_name_len, "%s.map", overlay_basename);
 
 	CHECK_ALLOCATION(overlay.overlay_basename = strdup(overlay_basename));
-	overlay.f_data = fopen(overlay_basename, d->writable? "r+" : "r");
-	if (overlay.f_data == NULL) {
+	overlay.fd_data = open(overlay_basename, d->writable? O_RDWR : O_RDONLY);
+	if (overlay.fd_data < 0) {
 		perror(overlay_basename);
 
 		if (remove_after_open) {
@@ -148,11 +278,26 @@ bool diskimage_add_overlay(struct diskimage *d, char *overlay_basename, bool rem
 		return false;
 	}
 
-	overlay.f_bitmap = fopen(bitmap_name, d->writable? "r+" : "r");
-	if (overlay.f_bitmap == NULL) {
+	overlay.fd_bitmap = open(bitmap_name, d->writable? O_RDWR : O_RDONLY);
+	if (overlay.fd_bitmap < 0) {
 		perror(bitmap_name);
 		fprintf(stderr, "Please create the map file first.\n");
-		fclose(overlay.f_data);
+		close(overlay.fd_data);
+
+		if (remove_after_open) {
+			unlink(overlay_basename);
+			unlink(bitmap_name);
+		}
+
+		free(bitmap_name);
+		return false;
+	}
+
+	if (!overlay_load_bitmap(&overlay)) {
+		perror(bitmap_name);
+		fprintf(stderr, "Could not read the map file.\n");
+		close(overlay.fd_data);
+		close(overlay.fd_bitmap);
 
 		if (remove_after_open) {
 			unlink(overlay_basename);
@@ -196,11 +341,15 @@ bool diskimage_recalc_size(struct diskimage *d)
 	int res;
 	int64_t size = 0;
 
-	res = stat(d->fname, &st);
-	if (res)
-		return false;
+	if (d->sparse != NULL)
+		size = diskimage_sparse_size(d->sparse);
+	else {
+		res = stat(d->fname, &st);
+		if (res)
+			return false;
 
-	size = st.st_size;
+		size = st.st_size;
+	}
 
 	/*
 	 *  TODO:  CD-ROM devices, such as /dev/cd0c, how can one
@@ -367,7 +516,7 @@ static size_t diskimage_access__cdrom(struct diskimage *d, off_t offset,
 	unsigned char *buf, size_t len)
 {
 	off_t aligned_offset;
-	size_t bytes_read, total_copied = 0;
+	size_t total_copied = 0;
 	unsigned char cdrom_buf[CDROM_SECTOR_SIZE];
 	off_t buf_ofs, i = 0;
 
@@ -375,11 +524,10 @@ static size_t diskimage_access__cdrom(struct diskimage *d, off_t offset,
 	    (long long)offset, (long long)len);  */
 
 	aligned_offset = (offset / CDROM_SECTOR_SIZE) * CDROM_SECTOR_SIZE;
-	my_fseek(d->f, aligned_offset, SEEK_SET);
 
 	while (len != 0) {
-		bytes_read = fread(cdrom_buf, 1, CDROM_SECTOR_SIZE, d->f);
-		if (bytes_read != CDROM_SECTOR_SIZE)
+		if (base_pread(d, cdrom_buf, CDROM_SECTOR_SIZE,
+		    aligned_offset) != CDROM_SECTOR_SIZE)
 			return 0;
 
 		/*  Copy (part of) cdrom_buf into buf:  */
@@ -398,73 +546,129 @@ static size_t diskimage_access__cdrom(struct diskimage *d, off_t offset,
 }
 
 
-/*  Helper function.  */
-static void overlay_set_block_in_use(struct diskimage *d,
-	int overlay_nr, off_t ofs)
+/*  Helper function. Returns bitmap word w of an overlay.  */
+static inline uint64_t overlay_bitmap_word(struct diskimage_overlay *ov,
+	size_t w)
 {
-	off_t bit_nr = ofs / OVERLAY_BLOCK_SIZE;
-	off_t bitmap_file_offset = bit_nr / 8;
-	int res;
-	unsigned char data;
-
-	res = my_fseek(d->overlays[overlay_nr].f_bitmap,
-	    bitmap_file_offset, SEEK_SET);
-	if (res) {
-		perror("my_fseek");
-		fprintf(stderr, "Could not seek in bitmap file?"
-		    " offset = %lli, read\n", (long long)bitmap_file_offset);
-		exit(1);
-	}
+	return w < ov->bitmap_words? ov->bitmap[w] : 0;
+}
 
-	/*  Read the original bitmap data, and OR in the new bit:  */
-	res = fread(&data, 1, 1, d->overlays[overlay_nr].f_bitmap);
-	if (res != 1)
-		data = 0x00;
 
-	data |= (1 << (bit_nr & 7));
+/*
+ *  overlay_set_blocks_in_use():
+ *
+ *  Marks the blocks in [ofs, ofs+len) as in use in an overlay's in-memory
+ *  bitmap. The map file is updated later, by overlay_flush_bitmap().
+ */
+static void overlay_set_blocks_in_use(struct diskimage_overlay *ov,
+	off_t ofs, size_t len)
+{
+	uint64_t block = ofs / OVERLAY_BLOCK_SIZE;
+	uint64_t end = (ofs + len + OVERLAY_BLOCK_SIZE - 1) / OVERLAY_BLOCK_SIZE;
+	size_t last_word = (end - 1) / 64;
 
-	/*  Write it back:  */
-	res = my_fseek(d->overlays[overlay_nr].f_bitmap,
-	    bitmap_file_offset, SEEK_SET);
-	if (res) {
-		perror("my_fseek");
-		fprintf(stderr, "Could not seek in bitmap file?"
-		    " offset = %lli, write\n", (long long)bitmap_file_offset);
-		exit(1);
+	if (len == 0)
+		return;
+
+	if (last_word >= ov->bitmap_words) {
+		size_t new_words = last_word + 1 + ov->bitmap_words / 2;
+		CHECK_ALLOCATION(ov->bitmap = (uint64_t *) realloc(ov->bitmap,
+		    new_words * sizeof(uint64_t)));
+		memset(ov->bitmap + ov->bitmap_words, 0,
+		    (new_words - ov->bitmap_words) * sizeof(uint64_t));
+		ov->bitmap_words = new_words;
+	}
+
+	if (ov->dirty_lo == ov->dirty_hi) {
+		ov->dirty_lo = block / 64;
+		ov->dirty_hi = last_word + 1;
+	} else {
+		if (block / 64 < ov->dirty_lo)
+			ov->dirty_lo = block / 64;
+		if (last_word + 1 > ov->dirty_hi)
+			ov->dirty_hi = last_word + 1;
 	}
-	res = fwrite(&data, 1, 1, d->overlays[overlay_nr].f_bitmap);
-	if (res != 1) {
-		fprintf(stderr, "Could not write to bitmap file. Aborting.\n");
+
+	for (; block < end; block++)
+		ov->bitmap[block / 64] |= (uint64_t) 1 << (block % 64);
+}
+
+
+/*
+ *  overlay_flush_bitmap():
+ *
+ *  Writes the dirty part of an overlay's in-memory bitmap back to its map
+ *  file, with a single pwrite().
+ */
+static void overlay_flush_bitmap(struct diskimage_overlay *ov)
+{
+	size_t i, nbytes = (ov->dirty_hi - ov->dirty_lo) * 8;
+	unsigned char *bytes;
+
+	if (nbytes == 0)
+		return;
+
+	CHECK_ALLOCATION(bytes = (unsigned char *) malloc(nbytes));
+	for (i = 0; i < nbytes; i++)
+		bytes[i] = ov->bitmap[ov->dirty_lo + i / 8] >> (8 * (i % 8));
+
+	if (diskimage_pwrite(ov->fd_bitmap, bytes, nbytes,
+	    (off_t) ov->dirty_lo * 8) != (ssize_t) nbytes) {
+		perror("pwrite");
+		fprintf(stderr, "Could not write to bitmap file, offset = %lli."
+		    " Aborting.\n", (long long)ov->dirty_lo * 8);
 		exit(1);
 	}
-	
-	if (do_fsync)
-		fsync(fileno(d->overlays[overlay_nr].f_bitmap));
+
+	free(bytes);
+	ov->dirty_lo = ov->dirty_hi = 0;
 }
 
 
-/*  Helper function.  */
-static int overlay_has_block(struct diskimage *d, int overlay_nr, off_t ofs)
+/*
+ *  overlay_find_run():
+ *
+ *  Returns the number of the topmost overlay that holds the block at ofs,
+ *  or -1 if the block comes from the base image. *nblocksp is set to the
+ *  number of consecutive blocks (at most maxblocks) that come from that
+ *  same place. The bitmaps are scanned 64 blocks at a time.
+ */
+static int overlay_find_run(struct diskimage *d, off_t ofs,
+	uint64_t maxblocks, uint64_t *nblocksp)
 {
-	off_t bit_nr = ofs / OVERLAY_BLOCK_SIZE;
-	off_t bitmap_file_offset = bit_nr / 8;
-	int res;
-	unsigned char data;
+	uint64_t block = ofs / OVERLAY_BLOCK_SIZE, n = 0;
+	int layer, i;
 
-	res = my_fseek(d->overlays[overlay_nr].f_bitmap,
-	    bitmap_file_offset, SEEK_SET);
-	if (res != 0)
-		return 0;
+	for (layer = d->nr_of_overlays-1; layer >= 0; layer --)
+		if ((overlay_bitmap_word(&d->overlays[layer], block / 64)
+		    >> (block % 64)) & 1)
+			break;
 
-	/*  The seek succeeded, now read the bit:  */
-	res = fread(&data, 1, 1, d->overlays[overlay_nr].f_bitmap);
-	if (res != 1)
-		return 0;
+	while (n < maxblocks) {
+		uint64_t b = block + n;
+		int bit = b % 64;
+		uint64_t same = layer >= 0? overlay_bitmap_word(
+		    &d->overlays[layer], b / 64) : ~(uint64_t) 0;
 
-	if (data & (1 << (bit_nr & 7)))
-		return 1;
+		/*  Blocks that are also in a higher overlay come from there:  */
+		for (i = layer + 1; i < d->nr_of_overlays; i++)
+			same &= ~overlay_bitmap_word(&d->overlays[i], b / 64);
 
-	return 0;
+		same >>= bit;
+		if (same == (~(uint64_t) 0 >> bit)) {
+			n += 64 - bit;
+			continue;
+		}
+
+		while (same & 1) {
+			n ++;
+			same >>= 1;
+		}
+		break;
+	}
+
+	*nblocksp = n < maxblocks? n : maxblocks;
+	return layer;
 }
 
 
@@ -477,21 +681,19 @@ static int overlay_has_block(struct diskimage *d, int overlay_nr, off_t ofs)
 static size_t fwrite_helper(off_t offset, unsigned char *buf,
 	size_t len, struct diskimage *d)
 {
-	off_t curofs;
+	int overlay_nr;
+	ssize_t written;
 
 	/*  Fast return-path for the case when no overlays are used:  */
 	if (d->nr_of_overlays == 0) {
-		int res = my_fseek(d->f, offset, SEEK_SET);
-		if (res != 0) {
-			fatal("[ diskimage__internal_access(): fseek() failed"
-			    " on disk id %i \n", d->id);
+		written = base_pwrite(d, buf, len, offset);
+		if (written < 0) {
+			fatal("[ diskimage__internal_access(): pwrite() failed"
+			    " on disk id %i: %s ]\n", d->id, strerror(errno));
 			return 0;
 		}
 
-		size_t written = fwrite(buf, 1, len, d->f);
-
-		if (do_fsync)
-			fsync(fileno(d->f));
+		d->unsynced = 1;
 
 		return written;
 	}
@@ -508,36 +710,24 @@ static size_t fwrite_helper(off_t offset, unsigned char *buf,
 		abort();
 	}
 
-	/*  Split the write into OVERLAY_BLOCK_SIZE writes:  */
-	for (curofs = offset; curofs < (off_t) (offset+len);
-	     curofs += OVERLAY_BLOCK_SIZE) {
-		/*  Always write to the last overlay:  */
-		int overlay_nr = d->nr_of_overlays-1;
-		off_t lenwritten;
-		int res = my_fseek(d->overlays[overlay_nr].f_data,
-		    curofs, SEEK_SET);
-		if (res != 0) {
-			fatal("[ diskimage: fwrite_helper(): fseek()"
-			    " failed on disk id %i ]\n", d->id);
-			return 0;
-		}
-
-		lenwritten = fwrite(buf, 1, OVERLAY_BLOCK_SIZE,
-		    d->overlays[overlay_nr].f_data);
-		if (lenwritten != OVERLAY_BLOCK_SIZE) {
-			fatal("[ diskimage: fwrite_helper(): fwrite to"
-			    " overlay failed on disk id %i ]\n", d->id);
-			exit(1);
-		}
-
-		buf += OVERLAY_BLOCK_SIZE;
+	/*
+	 *  Always write to the last overlay. The data goes out in a single
+	 *  pwrite(), and then the blocks that were written are marked as in
+	 *  use in the overlay's bitmap, which is written back in one go.
+	 */
+	overlay_nr = d->nr_of_overlays-1;
+	written = diskimage_pwrite(d->overlays[overlay_nr].fd_data,
+	    buf, len, offset);
+	if (written != (ssize_t) len) {
+		fatal("[ diskimage: fwrite_helper(): write to"
+		    " overlay failed on disk id %i ]\n", d->id);
+		exit(1);
+	}
 
-		if (do_fsync)
-			fsync(fileno(d->overlays[overlay_nr].f_data));
+	d->overlays[overlay_nr].unsynced = 1;
 
-		/*  Mark this block in the last overlay as in use:  */
-		overlay_set_block_in_use(d, overlay_nr, curofs);
-	}
+	overlay_set_blocks_in_use(&d->overlays[overlay_nr], offset, len);
+	overlay_flush_bitmap(&d->overlays[overlay_nr]);
 
 	return len;
 }
@@ -549,72 +739,719 @@ static size_t fwrite_helper(off_t offset, unsigned char *buf,
  *  Internal helper function. Reads from a disk image file, or if the
  *  disk image has overlays, from the last overlay that has the specific
  *  data (or the disk image file itself).
+ *
+ *  With overlays, consecutive OVERLAY_BLOCK_SIZE blocks that come from the
+ *  same file are read with one pread(). (Since the destination is always
+ *  one contiguous buffer, there is no need for preadv() here.) Anything
+ *  which could not be read is zero-filled, and the full length is returned.
  */
-static size_t fread_helper(off_t offset, unsigned char *buf,
+static ssize_t fread_helper(off_t offset, unsigned char *buf,
 	size_t len, struct diskimage *d)
 {
-	off_t curofs;
-	size_t totallenread = 0;
+	off_t curofs = offset;
 
 	/*  Fast return-path for the case when no overlays are used:  */
-	if (d->nr_of_overlays == 0) {
-		int res = my_fseek(d->f, offset, SEEK_SET);
-		if (res != 0) {
-			fatal("[ diskimage__internal_access(): fseek() failed"
-			    " on disk id %i \n", d->id);
-			return 0;
+	if (d->nr_of_overlays == 0)
+		return base_pread(d, buf, len, offset);
+
+	while (len != 0) {
+		uint64_t nblocks, maxblocks = ((curofs & (OVERLAY_BLOCK_SIZE-1))
+		    + len + OVERLAY_BLOCK_SIZE - 1) / OVERLAY_BLOCK_SIZE;
+		int overlay_nr = overlay_find_run(d, curofs, maxblocks, &nblocks);
+		size_t runlen = nblocks * OVERLAY_BLOCK_SIZE -
+		    (curofs & (OVERLAY_BLOCK_SIZE-1));
+		ssize_t lenread;
+
+		if (runlen > len)
+			runlen = len;
+
+		if (overlay_nr >= 0)
+			lenread = diskimage_pread(d->overlays[overlay_nr].
+			    fd_data, buf, runlen, curofs);
+		else
+			lenread = base_pread(d, buf, runlen, curofs);
+
+		if (lenread != (ssize_t) runlen) {
+			fatal("[ INCOMPLETE READ from disk id %i, offset"
+			    " %lli ]\n", d->id, (long long)curofs);
+
+			if (lenread < 0)
+				lenread = 0;
+			memset(buf + lenread, 0, runlen - lenread);
 		}
 
-		return fread(buf, 1, len, d->f);
+		buf += runlen;
+		curofs += runlen;
+		len -= runlen;
 	}
 
-	/*  Split the read into OVERLAY_BLOCK_SIZE reads:  */
-	for (curofs=offset; len != 0;
-	    curofs = (curofs | (OVERLAY_BLOCK_SIZE-1)) + 1) {
-		/*  Find the overlay, if any, that has this block:  */
-		off_t lenread, lentoread;
-		int overlay_nr;
-		for (overlay_nr = d->nr_of_overlays-1;
-		    overlay_nr >= 0; overlay_nr --) {
-			if (overlay_has_block(d, overlay_nr, curofs))
-				break;
+	return curofs - offset;
+}
+
+
+/**************************************************************************/
+
+/*
+ *  Block cache:
+ *
+ *  Guest accesses to disk images (except tapes) go through a cache of
+ *  DISKIMAGE_CACHE_BLOCK_SIZE byte blocks, shared by all disk images and
+ *  limited to diskimage_cache_size bytes in total. Blocks are kept in a
+ *  hash table and an LRU list.
+ *
+ *  Misses are filled with a single host read covering all consecutive
+ *  missing blocks of the request, plus a readahead window which doubles
+ *  (up to DISKIMAGE_CACHE_MAX_READAHEAD blocks) for each read that starts
+ *  where the previous one ended, and is reset by any other read.
+ *
+ *  By default the cache is write-through: writes go to the disk image
+ *  file at once, and only blocks which are already cached are updated.
+ *  For disk images with the 'w' prefix (write_back), writes only update
+ *  the cached blocks and mark the written byte range dirty. Dirty blocks
+ *  are written back when they are evicted, when the guest asks for it
+ *  (diskimage_cache_flush), and at exit; adjacent dirty blocks are then
+ *  written with one host write. Such disks report a write cache to the
+ *  guest (WCE in the SCSI caching mode page, or the ATA identify data),
+ *  so that the guest knows it has to flush it.
+ */
+
+struct diskimage_cache_block {
+	struct diskimage_cache_block *hash_next;
+	struct diskimage_cache_block *lru_prev;		/*  more recent  */
+	struct diskimage_cache_block *lru_next;		/*  less recent  */
+
+	struct diskimage *d;
+	int64_t		block_nr;
+
+	/*  Dirty byte range [dirty_lo, dirty_hi); empty if clean:  */
+	int		dirty_lo;
+	int		dirty_hi;
+
+	unsigned char	*data;
+};
+
+static struct diskimage_cache_block **cache_hash = NULL;
+static size_t cache_hash_mask;
+static struct diskimage_cache_block *cache_lru_first, *cache_lru_last;
+static size_t cache_nr_of_blocks, cache_max_blocks;
+
+static struct settings *diskimage_settings;
+
+
+/*
+ *  cache_enabled():
+ *
+ *  Returns true if accesses to d should go through the cache. The hash
+ *  table is set up the first time, sized after diskimage_cache_size.
+ */
+static bool cache_enabled(struct diskimage *d)
+{
+	/*  (Memory-mapped images without overlays gain nothing from it.)  */
+	if (d->is_a_tape || (d->mmap_base != NULL && d->nr_of_overlays == 0))
+		return false;
+
+	if (cache_hash == NULL) {
+		size_t n = 64;
+
+		cache_max_blocks = diskimage_cache_size > 0 ?
+		    diskimage_cache_size / DISKIMAGE_CACHE_BLOCK_SIZE : 0;
+		while (n < cache_max_blocks)
+			n <<= 1;
+
+		CHECK_ALLOCATION(cache_hash = (struct diskimage_cache_block **)
+		    calloc(n, sizeof(struct diskimage_cache_block *)));
+		cache_hash_mask = n - 1;
+	}
+
+	return cache_max_blocks > 0;
+}
+
+
+static inline size_t cache_hash_index(struct diskimage *d, int64_t block_nr)
+{
+	return (((size_t) d >> 4) ^ (size_t) (block_nr * 0x9e3779b1))
+	    & cache_hash_mask;
+}
+
+
+static struct diskimage_cache_block *cache_lookup(struct diskimage *d,
+	int64_t block_nr)
+{
+	struct diskimage_cache_block *cb =
+	    cache_hash[cache_hash_index(d, block_nr)];
+
+	while (cb != NULL && (cb->d != d || cb->block_nr != block_nr))
+		cb = cb->hash_next;
+
+	return cb;
+}
+
+
+/*  Moves a block first in the LRU list (i.e. marks it as most recent).  */
+static void cache_touch(struct diskimage_cache_block *cb)
+{
+	if (cache_lru_first == cb)
+		return;
+
+	/*  Unlink:  */
+	if (cb->lru_prev != NULL)
+		cb->lru_prev->lru_next = cb->lru_next;
+	if (cb->lru_next != NULL)
+		cb->lru_next->lru_prev = cb->lru_prev;
+	if (cache_lru_last == cb)
+		cache_lru_last = cb->lru_prev;
+
+	/*  Insert first:  */
+	cb->lru_prev = NULL;
+	cb->lru_next = cache_lru_first;
+	if (cache_lru_first != NULL)
+		cache_lru_first->lru_prev = cb;
+	cache_lru_first = cb;
+	if (cache_lru_last == NULL)
+		cache_lru_last = cb;
+}
+
+
+/*
+ *  cache_writeback():
+ *
+ *  Writes back a dirty block, together with any dirty neighbours that it
+ *  can be combined with into one contiguous host write.
+ */
+static void cache_writeback(struct diskimage_cache_block *cb)
+{
+	struct diskimage *d = cb->d;
+	struct diskimage_cache_block *first = cb, *x;
+	unsigned char *buf;
+	int64_t block_nr;
+	size_t len = 0;
+	off_t offset;
+	bool single;
+
+	if (cb->dirty_lo == cb->dirty_hi)
+		return;
+
+	/*  Find the start of the run:  */
+	while (first->dirty_lo == 0 && (x = cache_lookup(d,
+	    first->block_nr - 1)) != NULL && x->dirty_hi ==
+	    DISKIMAGE_CACHE_BLOCK_SIZE)
+		first = x;
+
+	/*  ... and its length:  */
+	offset = first->block_nr * DISKIMAGE_CACHE_BLOCK_SIZE + first->dirty_lo;
+	x = first;
+	block_nr = first->block_nr;
+	for (;;) {
+		len += x->dirty_hi - x->dirty_lo;
+		if (x->dirty_hi != DISKIMAGE_CACHE_BLOCK_SIZE)
+			break;
+		x = cache_lookup(d, ++ block_nr);
+		if (x == NULL || x->dirty_lo != 0 || x->dirty_hi == 0)
+			break;
+	}
+
+	/*  Gather the data, and mark the blocks as clean:  */
+	single = first->dirty_hi - first->dirty_lo == (int) len;
+	if (single)
+		buf = first->data + first->dirty_lo;
+	else
+		CHECK_ALLOCATION(buf = (unsigned char *) malloc(len));
+
+	x = first;
+	block_nr = first->block_nr;
+	for (size_t done = 0; done < len; ) {
+		size_t n = x->dirty_hi - x->dirty_lo;
+		if (!single)
+			memcpy(buf + done, x->data + x->dirty_lo, n);
+		x->dirty_lo = x->dirty_hi = 0;
+		done += n;
+		if (done < len)
+			x = cache_lookup(d, ++ block_nr);
+	}
+
+	if (fwrite_helper(offset, buf, len, d) != len)
+		fatal("[ diskimage: write-back failed on disk id %i, offset"
+		    " %lli ]\n", d->id, (long long)offset);
+
+	diskimage_cache_writebacks ++;
+
+	if (!single)
+		free(buf);
+}
+
+
+/*
+ *  cache_alloc():
+ *
+ *  Returns a new (uninitialized, clean) block for block_nr of d, which
+ *  must not already be cached. The least recently used block is reused
+ *  (after being written back, if dirty) if the cache is full.
+ */
+static struct diskimage_cache_block *cache_alloc(struct diskimage *d,
+	int64_t block_nr)
+{
+	struct diskimage_cache_block *cb, **pp;
+
+	if (cache_nr_of_blocks < cache_max_blocks) {
+		CHECK_ALLOCATION(cb = (struct diskimage_cache_block *)
+		    malloc(sizeof(struct diskimage_cache_block)));
+		CHECK_ALLOCATION(cb->data = (unsigned char *)
+		    malloc(DISKIMAGE_CACHE_BLOCK_SIZE));
+		cache_nr_of_blocks ++;
+
+		cb->lru_prev = cb->lru_next = NULL;
+		if (cache_lru_last == NULL)
+			cache_lru_first = cache_lru_last = cb;
+	} else {
+		cb = cache_lru_last;
+		cache_writeback(cb);
+
+		/*  Remove it from the hash table:  */
+		pp = &cache_hash[cache_hash_index(cb->d, cb->block_nr)];
+		while (*pp != cb)
+			pp = &(*pp)->hash_next;
+		*pp = cb->hash_next;
+	}
+
+	cb->d = d;
+	cb->block_nr = block_nr;
+	cb->dirty_lo = cb->dirty_hi = 0;
+
+	pp = &cache_hash[cache_hash_index(d, block_nr)];
+	cb->hash_next = *pp;
+	*pp = cb;
+
+	cache_touch(cb);
+	return cb;
+}
+
+
+/*  Reads directly from the disk image (or its overlays).  */
+static ssize_t uncached_read(struct diskimage *d, off_t offset,
+	unsigned char *buf, size_t len)
+{
+	/*
+	 *  Special case for CD-ROMs. Actually, this is not needed
+	 *  for .iso images, only for physical CDROMS on some OSes,
+	 *  such as FreeBSD. (Mapped images are plain memory.)
+	 */
+	if (d->is_a_cdrom && d->mmap_base == NULL)
+		return diskimage_access__cdrom(d, offset, buf, len);
+
+	return fread_helper(offset, buf, len, d);
+}
+
+
+/*
+ *  cache_fill():
+ *
+ *  Reads block_nr, and up to nblocks-1 following blocks (stopping at the
+ *  first block which is already cached), into the cache with one host
+ *  read. Blocks beyond the end of the disk (other than block_nr itself)
+ *  are not read. Returns the cache block for block_nr.
+ */
+static struct diskimage_cache_block *cache_fill(struct diskimage *d,
+	int64_t block_nr, int nblocks)
+{
+	struct diskimage_cache_block *cb = NULL;
+	int64_t disk_blocks = (d->nr_of_logical_blocks * d->logical_block_size
+	    + DISKIMAGE_CACHE_BLOCK_SIZE - 1) / DISKIMAGE_CACHE_BLOCK_SIZE;
+	unsigned char *buf;
+	ssize_t res;
+	int i, n = 1;
+
+	if (nblocks > (int) cache_max_blocks / 2)
+		nblocks = cache_max_blocks / 2;
+
+	while (n < nblocks && block_nr + n < disk_blocks &&
+	    cache_lookup(d, block_nr + n) == NULL)
+		n ++;
+
+	CHECK_ALLOCATION(buf = (unsigned char *)
+	    malloc(n * DISKIMAGE_CACHE_BLOCK_SIZE));
+
+	res = uncached_read(d, block_nr * DISKIMAGE_CACHE_BLOCK_SIZE, buf,
+	    n * DISKIMAGE_CACHE_BLOCK_SIZE);
+	if (res < 0)
+		res = 0;
+	if (res < n * DISKIMAGE_CACHE_BLOCK_SIZE)
+		memset(buf + res, 0, n * DISKIMAGE_CACHE_BLOCK_SIZE - res);
+
+	/*  Last block first, so that block_nr ends up most recently used:  */
+	for (i = n - 1; i >= 0; i--) {
+		cb = cache_alloc(d, block_nr + i);
+		memcpy(cb->data, buf + i * DISKIMAGE_CACHE_BLOCK_SIZE,
+		    DISKIMAGE_CACHE_BLOCK_SIZE);
+	}
+
+	if (n > 1)
+		diskimage_cache_readaheads ++;
+
+	free(buf);
+	return cb;
+}
+
+
+/*
+ *  cache_read():
+ *
+ *  Reads from a disk image through the cache. Returns len.
+ */
+static ssize_t cache_read(struct diskimage *d, off_t offset,
+	unsigned char *buf, size_t len)
+{
+	int64_t last_block = (offset + len - 1) / DISKIMAGE_CACHE_BLOCK_SIZE;
+	size_t done = 0;
+
+	/*  Sequential access pattern? Then grow the readahead window.  */
+	if (offset == d->cache_next_offset) {
+		if (d->cache_readahead == 0)
+			d->cache_readahead = 1;
+		else if (d->cache_readahead < DISKIMAGE_CACHE_MAX_READAHEAD)
+			d->cache_readahead *= 2;
+	} else
+		d->cache_readahead = 0;
+	d->cache_next_offset = offset + len;
+
+	while (done < len) {
+		int64_t block_nr = (offset + done) / DISKIMAGE_CACHE_BLOCK_SIZE;
+		size_t inofs = (offset + done) % DISKIMAGE_CACHE_BLOCK_SIZE;
+		size_t chunk = DISKIMAGE_CACHE_BLOCK_SIZE - inofs;
+		struct diskimage_cache_block *cb = cache_lookup(d, block_nr);
+
+		if (chunk > len - done)
+			chunk = len - done;
+
+		if (cb != NULL) {
+			diskimage_cache_hits ++;
+			cache_touch(cb);
+		} else {
+			diskimage_cache_misses ++;
+			cb = cache_fill(d, block_nr, last_block - block_nr + 1
+			    + d->cache_readahead);
 		}
 
-		lentoread = len > OVERLAY_BLOCK_SIZE? OVERLAY_BLOCK_SIZE : len;
+		memcpy(buf + done, cb->data + inofs, chunk);
+		done += chunk;
+	}
+
+	return len;
+}
+
 
-		if (overlay_nr >= 0) {
-			/*  Read from overlay:  */
-			int res = my_fseek(d->overlays[overlay_nr].f_data,
-			    curofs, SEEK_SET);
-			if (res != 0) {
-				fatal("[ diskimage__internal_access(): fseek()"
-				    " failed on disk id %i \n", d->id);
-				return 0;
+/*
+ *  cache_write():
+ *
+ *  Writes to a disk image through the cache. Unless d->write_back is set,
+ *  the data is also written to the disk image file directly, and blocks
+ *  which are not cached are left alone. Returns the number of bytes
+ *  written.
+ */
+static ssize_t cache_write(struct diskimage *d, off_t offset,
+	unsigned char *buf, size_t len)
+{
+	size_t done = 0;
+
+	while (done < len) {
+		int64_t block_nr = (offset + done) / DISKIMAGE_CACHE_BLOCK_SIZE;
+		int inofs = (offset + done) % DISKIMAGE_CACHE_BLOCK_SIZE;
+		int chunk = DISKIMAGE_CACHE_BLOCK_SIZE - inofs;
+		struct diskimage_cache_block *cb = cache_lookup(d, block_nr);
+
+		if (chunk > (int) (len - done))
+			chunk = len - done;
+
+		if (!d->write_back) {
+			if (cb != NULL) {
+				cache_touch(cb);
+				memcpy(cb->data + inofs, buf + done, chunk);
 			}
-			lenread = fread(buf, 1, lentoread,
-			    d->overlays[overlay_nr].f_data);
+			done += chunk;
+			continue;
+		}
+
+		if (cb != NULL)
+			cache_touch(cb);
+		else if (chunk == DISKIMAGE_CACHE_BLOCK_SIZE)
+			cb = cache_alloc(d, block_nr);
+		else
+			cb = cache_fill(d, block_nr, 1);
+
+		memcpy(cb->data + inofs, buf + done, chunk);
+
+		/*  Extend the dirty range, keeping it sector aligned:  */
+		if (cb->dirty_lo == cb->dirty_hi) {
+			cb->dirty_lo = inofs & ~511;
+			cb->dirty_hi = ((inofs + chunk + 511) & ~511);
 		} else {
-			/*  Read from the base disk image:  */
-			int res = my_fseek(d->f, curofs, SEEK_SET);
-			if (res != 0) {
-				fatal("[ diskimage__internal_access(): fseek()"
-				    " failed on disk id %i \n", d->id);
-				return 0;
-			}
-			lenread = fread(buf, 1, lentoread, d->f);
+			if ((inofs & ~511) < cb->dirty_lo)
+				cb->dirty_lo = inofs & ~511;
+			if (((inofs + chunk + 511) & ~511) > cb->dirty_hi)
+				cb->dirty_hi = (inofs + chunk + 511) & ~511;
 		}
 
-		if (lenread != lentoread) {
-			fatal("[ INCOMPLETE READ from disk id %i, offset"
-			    " %lli ]\n", d->id, (long long)curofs);
+		done += chunk;
+	}
+
+	if (!d->write_back)
+		return fwrite_helper(offset, buf, len, d);
+
+	return len;
+}
+
+
+/*
+ *  diskimage__cache_try_read():
+ *
+ *  Used before reading from a disk image without going through the cache
+ *  (from another thread). If the whole range is cached, it is copied to buf
+ *  and true is returned. Otherwise, any dirty blocks in the range are
+ *  written back, so that the disk image file is up to date, and false is
+ *  returned.
+ */
+bool diskimage__cache_try_read(struct diskimage *d, off_t offset,
+	unsigned char *buf, size_t len)
+{
+	int64_t block_nr, first = offset / DISKIMAGE_CACHE_BLOCK_SIZE;
+	int64_t last = (offset + len - 1) / DISKIMAGE_CACHE_BLOCK_SIZE;
+	bool all_cached = true;
+
+	if (len == 0 || !cache_enabled(d))
+		return false;
+
+	for (block_nr = first; block_nr <= last && all_cached; block_nr++)
+		if (cache_lookup(d, block_nr) == NULL)
+			all_cached = false;
+
+	if (all_cached) {
+		cache_read(d, offset, buf, len);
+		return true;
+	}
+
+	for (block_nr = first; block_nr <= last; block_nr++) {
+		struct diskimage_cache_block *cb = cache_lookup(d, block_nr);
+		if (cb != NULL)
+			cache_writeback(cb);
+	}
+
+	return false;
+}
+
+
+/*
+ *  diskimage__uncached_read():
+ *
+ *  Reads from a disk image without going through the block cache; used by
+ *  the asynchronous I/O worker threads (see diskimage__cache_try_read). Like
+ *  diskimage__internal_access(), short reads are zero-filled. Returns 1 on
+ *  success, 0 if the host's read failed (so that the error reaches the
+ *  guest, instead of a buffer full of zeroes).
+ */
+int diskimage__uncached_read(struct diskimage *d, off_t offset,
+	unsigned char *buf, size_t len)
+{
+	ssize_t lendone;
+
+	if (d->fd < 0)
+		return 0;
+
+	lendone = uncached_read(d, offset, buf, len);
+	if (lendone < 0)
+		return 0;
+	if (lendone < (ssize_t)len)
+		memset(buf + lendone, 0, len - lendone);
+
+	return 1;
+}
+
+
+/*
+ *  diskimage_cache_flush():
+ *
+ *  Writes back all dirty cached blocks of a disk image (or of all disk
+ *  images, if d is NULL).
+ */
+void diskimage_cache_flush(struct diskimage *d)
+{
+	struct diskimage_cache_block *cb;
+
+	for (cb = cache_lru_first; cb != NULL; cb = cb->lru_next)
+		if (d == NULL || cb->d == d)
+			cache_writeback(cb);
+}
+
+
+/*
+ *  diskimage__sync():
+ *
+ *  Called when the guest flushes the write cache of a disk (SCSI SYNCHRONIZE
+ *  CACHE, IDE FLUSH CACHE, or a write with the FUA bit set). Dirty cached
+ *  blocks are written back, and then (if diskimage_sync_on_flush is set)
+ *  each file which has been written to since the last flush, i.e. the image
+ *  itself and/or overlay data and bitmap files, is put on stable storage.
+ *  Writes in between flushes never wait for the host's disk to finish.
+ */
+void diskimage__sync(struct diskimage *d)
+{
+	int i;
+
+	diskimage_cache_flush(d);
+
+	if (!diskimage_sync_on_flush)
+		return;
+
+	if (d->unsynced && d->fd >= 0) {
+		diskimage_fdatasync(d->fd);
+		d->unsynced = 0;
+	}
+
+	for (i = 0; i < d->nr_of_overlays; i++) {
+		struct diskimage_overlay *ov = &d->overlays[i];
+
+		if (!ov->unsynced)
+			continue;
+
+		diskimage_fdatasync(ov->fd_data);
+		diskimage_fdatasync(ov->fd_bitmap);
+		ov->unsynced = 0;
+	}
+}
+
+
+/*  atexit() handler.  */
+static void diskimage_cache_flush_all(void)
+{
+	diskimage_cache_flush(NULL);
+}
+
+
+/*
+ *  diskimage_init():
+ *
+ *  Registers the disk image settings (cache size and statistics, and whether
+ *  guest cache flushes reach stable storage on the host), and makes
+ *  sure that the cache is written back when the emulator exits.
+ */
+void diskimage_init(void)
+{
+	diskimage_settings = settings_new();
+
+	settings_add(global_settings, "diskimage", 1,
+	    SETTINGS_TYPE_SUBSETTINGS, 0, diskimage_settings);
+
+	settings_add(diskimage_settings, "cache_size", 0,
+	    SETTINGS_TYPE_INT64, SETTINGS_FORMAT_DECIMAL,
+	    (void *) &diskimage_cache_size);
+	settings_add(diskimage_settings, "cache_hits", 0,
+	    SETTINGS_TYPE_UINT64, SETTINGS_FORMAT_DECIMAL,
+	    (void *) &diskimage_cache_hits);
+	settings_add(diskimage_settings, "cache_misses", 0,
+	    SETTINGS_TYPE_UINT64, SETTINGS_FORMAT_DECIMAL,
+	    (void *) &diskimage_cache_misses);
+	settings_add(diskimage_settings, "cache_readaheads", 0,
+	    SETTINGS_TYPE_UINT64, SETTINGS_FORMAT_DECIMAL,
+	    (void *) &diskimage_cache_readaheads);
+	settings_add(diskimage_settings, "cache_writebacks", 0,
+	    SETTINGS_TYPE_UINT64, SETTINGS_FORMAT_DECIMAL,
+	    (void *) &diskimage_cache_writebacks);
+	settings_add(diskimage_settings, "sync_on_flush", 1,
+	    SETTINGS_TYPE_INT, SETTINGS_FORMAT_YESNO,
+	    (void *) &diskimage_sync_on_flush);
+
+	atexit(diskimage_cache_flush_all);
+}
+
+
+/*
+ *  diskimage_deinit():
+ *
+ *  Writes back the cache, and unregisters the settings registered by
+ *  diskimage_init().
+ */
+void diskimage_deinit(void)
+{
+	diskimage_cache_flush(NULL);
+
+	settings_remove_all(diskimage_settings);
+	settings_remove(global_settings, "diskimage");
+	settings_destroy(diskimage_settings);
+}
+
+
+/*
+ *  diskimage__open():
+ *
+ *  (Re)opens the host file backing a disk image. Any previously open file
+ *  is closed first. Files in GXemul's sparse image format are recognized
+ *  (except for tapes) and opened as such. Raw images which are opened
+ *  read-only are mapped into memory, if d->use_mmap is set. Returns true on
+ *  success; on failure, d->fd is -1.
+ */
+bool diskimage__open(struct diskimage *d, const char *fname, int writable)
+{
+	if (d->sparse != NULL) {
+		diskimage_sparse_close(d->sparse);
+		d->sparse = NULL;
+	}
+#ifdef HAVE_MMAP
+	if (d->mmap_base != NULL) {
+		munmap(d->mmap_base, d->mmap_len);
+		d->mmap_base = NULL;
+		d->mmap_len = 0;
+	}
+#endif
+	if (d->fd >= 0)
+		close(d->fd);
+
+	d->fd = open(fname, writable? O_RDWR : O_RDONLY);
+	d->tape_eof = 0;
+	if (d->fd < 0)
+		return false;
+
+	if (!d->is_a_tape && diskimage_sparse_probe(d->fd)) {
+		d->sparse = diskimage_sparse_open(d->fd, fname, writable);
+		if (d->sparse == NULL) {
+			close(d->fd);
+			d->fd = -1;
+			errno = EINVAL;
+			return false;
+		}
+	}
+
+#ifdef HAVE_MMAP
+	if (d->use_mmap && !writable && !d->is_a_tape && d->sparse == NULL) {
+		struct stat st;
+		void *p;
+
+		if (fstat(d->fd, &st) == 0 && S_ISREG(st.st_mode) &&
+		    st.st_size > 0 && (uint64_t) st.st_size <= SIZE_MAX) {
+			p = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED,
+			    d->fd, 0);
+			if (p != MAP_FAILED) {
+				d->mmap_base = (unsigned char *) p;
+				d->mmap_len = st.st_size;
+			}
 		}
 
-		len -= lentoread;
-		totallenread += lenread;
-		buf += OVERLAY_BLOCK_SIZE;
+		/*  (CD-ROMs are mapped when possible, so don't nag.)  */
+		if (d->mmap_base == NULL && !d->is_a_cdrom)
+			debugmsg(SUBSYS_DISK, "", VERBOSITY_WARNING,
+			    "could not map '%s' into memory; using"
+			    " normal reads instead", fname);
 	}
+#endif
 
-	return totallenread;
+#ifdef HAVE_POSIX_FADVISE
+	/*
+	 *  CD-ROM images and tapes are mostly read front to back, so let the
+	 *  host read ahead more aggressively. Hard disk images are accessed
+	 *  all over the place by guests, so they keep the default policy.
+	 */
+	if (d->is_a_cdrom || d->is_a_tape)
+		posix_fadvise(d->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+	return true;
 }
 
 
@@ -636,26 +1473,33 @@ int diskimage__internal_access(struct diskimage *d, int writeflag,
 	}
 	if (len == 0)
 		return 1;
-	if (d->f == NULL)
+	if (d->fd < 0)
 		return 0;
 
 	if (writeflag) {
 		if (!d->writable)
 			return 0;
 
-		lendone = fwrite_helper(offset, buf, len, d);
+		if (cache_enabled(d))
+			lendone = cache_write(d, offset, buf, len);
+		else
+			lendone = fwrite_helper(offset, buf, len, d);
 	} else {
-		/*
-		 *  Special case for CD-ROMs. Actually, this is not needed
-		 *  for .iso images, only for physical CDROMS on some OSes,
-		 *  such as FreeBSD.
-		 */
-		if (d->is_a_cdrom)
-			lendone = diskimage_access__cdrom(d, offset, buf, len);
+		if (cache_enabled(d))
+			lendone = cache_read(d, offset, buf, len);
 		else
-			lendone = fread_helper(offset, buf, len, d);
+			lendone = uncached_read(d, offset, buf, len);
 
-		if (lendone >= 0 && lendone < (ssize_t)len)
+		if (d->is_a_tape) {
+			/*  Tapes are read sequentially; mimic feof()/ftello():  */
+			if (lendone < (ssize_t)len)
+				d->tape_eof = 1;
+			d->tape_offset = offset + (lendone > 0? lendone : 0);
+		}
+
+		if (lendone < 0)
+			lendone = 0;
+		if (lendone < (ssize_t)len)
 			memset(buf + lendone, 0, len - lendone);
 	}
 
@@ -716,6 +1560,64 @@ int diskimage_access(struct machine *machine, int id, int type, int writeflag,
 }
 
 
+/*
+ *  diskimage_sync():
+ *
+ *  Flushes the write cache of a disk image on a machine; see
+ *  diskimage__sync(). Returns 1 on success, 0 if there is no such disk.
+ */
+int diskimage_sync(struct machine *machine, int id, int type)
+{
+	struct diskimage *d = machine->first_diskimage;
+
+	while (d != NULL) {
+		if (d->type == type && d->id == id)
+			break;
+		d = d->next;
+	}
+
+	if (d == NULL)
+		return 0;
+
+	diskimage__sync(d);
+	return 1;
+}
+
+
+/*
+ *  diskimage_map():
+ *
+ *  Returns a host pointer to len bytes of disk data at offset (as used by
+ *  diskimage_access), if the disk image is memory-mapped and these bytes can
+ *  be read directly from the mapping. Otherwise NULL is returned, and the
+ *  caller should use diskimage_access() instead.
+ *
+ *  The pointer is valid until the disk image is reopened; the data must not
+ *  be modified.
+ */
+const unsigned char *diskimage_map(struct machine *machine, int id, int type,
+	off_t offset, size_t len)
+{
+	struct diskimage *d = machine->first_diskimage;
+
+	while (d != NULL) {
+		if (d->type == type && d->id == id)
+			break;
+		d = d->next;
+	}
+
+	if (d == NULL || d->mmap_base == NULL || d->nr_of_overlays > 0)
+		return NULL;
+
+	offset -= d->override_base_offset;
+	if (offset < 0 || (size_t) offset > d->mmap_len ||
+	    len > d->mmap_len - offset)
+		return NULL;
+
+	return d->mmap_base + offset;
+}
+
+
 int get_default_disk_type_for_machine(struct machine *machine)
 {
 	if (machine->machine_type == MACHINE_PMAX ||
@@ -763,7 +1665,7 @@ int diskimage_add(struct machine *machine, char *fname)
 	char *cp;
 	int prefix_b=0, prefix_c=0, prefix_d=0, prefix_f=0, prefix_g=0;
 	int prefix_i=0, prefix_r=0, prefix_s=0, prefix_t=0, prefix_id=-1;
-	int prefix_o=0, prefix_V=0;
+	int prefix_m=0, prefix_o=0, prefix_V=0, prefix_w=0;
 	bool prefix_R = false;
 
 	if (fname == NULL) {
@@ -824,6 +1726,9 @@ int diskimage_add(struct machine *machine, char *fname)
 			case 'i':
 				prefix_i = 1;
 				break;
+			case 'm':
+				prefix_m = 1;
+				break;
 			case 'o':
 				prefix_o = 1;
 				override_base_offset = atoi(fname);
@@ -853,6 +1758,9 @@ int diskimage_add(struct machine *machine, char *fname)
 			case 'V':
 				prefix_V = 1;
 				break;
+			case 'w':
+				prefix_w = 1;
+				break;
 			case ':':
 				break;
 			default:
@@ -866,6 +1774,7 @@ int diskimage_add(struct machine *machine, char *fname)
 	/*  Allocate a new diskimage struct:  */
 	CHECK_ALLOCATION(d = (struct diskimage *) malloc(sizeof(struct diskimage)));
 	memset(d, 0, sizeof(struct diskimage));
+	d->fd = -1;
 
 	if (prefix_i + prefix_f + prefix_s > 1) {
 		fprintf(stderr, "Invalid disk image prefix(es). You can"
@@ -1009,7 +1918,7 @@ int diskimage_add(struct machine *machine, char *fname)
 		return -1;
 	}
 
-	if (d->is_a_cdrom || prefix_r) {
+	if (d->is_a_cdrom || prefix_r || prefix_m) {
 		d->writable = 0;
 	} else if (!d->writable) {
 		if (prefix_R) {
@@ -1026,8 +1935,16 @@ int diskimage_add(struct machine *machine, char *fname)
 		}
 	}
 
-	d->f = fopen(fname, d->writable && !prefix_R ? "r+" : "r");
-	if (d->f == NULL) {
+	/*
+	 *  CD-ROM images are never written to, and are read in large chunks
+	 *  (both by the ISO9660 boot code and by guests), so they are mapped
+	 *  into memory even without the m: prefix. (Physical CD-ROM devices
+	 *  are not regular files, and are read normally.)
+	 */
+	d->use_mmap = prefix_m || d->is_a_cdrom;
+	d->write_back = prefix_w;
+
+	if (!diskimage__open(d, fname, d->writable && !prefix_R)) {
 		debugmsg(SUBSYS_DISK, "", VERBOSITY_ERROR,
 		    "could not open '%s' for reading%s: %s",
 		    fname,
@@ -1036,6 +1953,10 @@ int diskimage_add(struct machine *machine, char *fname)
 		return -1;
 	}
 
+	/*  A sparse image's disk size is in its header, not the file size:  */
+	if (d->sparse != NULL)
+		diskimage_recalc_size(d);
+
 	/*  Calculate which ID to use:  */
 	if (prefix_id == -1) {
 		int start = 0;
@@ -1213,6 +2134,26 @@ int diskimage_is_a_cdrom(struct machine *machine, int id, int type)
 }
 
 
+/*
+ *  diskimage_has_write_cache():
+ *
+ *  Returns 1 if guest writes to a disk image may be held in the block
+ *  cache until the guest flushes them (the 'w' prefix), 0 otherwise.
+ */
+int diskimage_has_write_cache(struct machine *machine, int id, int type)
+{
+	struct diskimage *d = machine->first_diskimage;
+
+	while (d != NULL) {
+		if (d->type == type && d->id == id)
+			return d->write_back && d->writable &&
+			    cache_enabled(d);
+		d = d->next;
+	}
+	return 0;
+}
+
+
 /*
  *  diskimage_is_a_tape():
  *
@@ -1266,6 +2207,8 @@ void diskimage_dump_info(struct machine *machine)
 			(d->is_a_cdrom? "CD-ROM" : "DISK"));
 		debug(" id %i, ", d->id);
 		debug("%s, ", d->writable? "read/write" : "read-only");
+		if (d->mmap_base != NULL)
+			debug("mapped, ");
 
 		int64_t s = d->nr_of_logical_blocks * d->logical_block_size;
 
@@ -0,0 +1,278 @@
+/*
+ *  Copyright (C) 2003-2021  Anders Gavare.  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright  
+ *     notice, this list of conditions and the following disclaimer in the 
+ *     documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE   
+ *  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ *  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ *  OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ *  OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ *  SUCH DAMAGE.
+ *
+ *
+ *  Disk image support: asynchronous access.
+ *
+ *  A controller which can tell the guest that it is busy (e.g. an IDE
+ *  controller with its BSY bit) may start a read with diskimage_access_async(),
+ *  let the guest continue running, and then poll for completion from its
+ *  tick function or status register, raising its interrupt once the data
+ *  is there.
+ *
+ *  When GXemul is built with pthreads, eligible reads are carried out by a
+ *  small pool of worker threads. Everything else (writes, tapes, sparse
+ *  images, images with overlays, or builds without pthreads) is performed
+ *  synchronously before diskimage_access_async() returns, so callers don't
+ *  need to care.
+ *
+ *  Only plain reads are eligible, since those touch nothing in struct
+ *  diskimage but the file descriptor (pread() is thread-safe); overlay
+ *  bitmaps and tape positions are only ever modified by the emulation
+ *  thread.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "diskimage.h"
+#include "machine.h"
+#include "misc.h"
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
+
+#define	DISKIMAGE_ASYNC_WORKERS		2
+
+struct diskimage_request {
+	struct diskimage_request *next;
+
+	struct diskimage *d;
+	off_t		offset;
+	unsigned char	*buf;
+	size_t		len;
+
+	int		done;		/*  protected by async_lock  */
+	int		result;		/*  as for diskimage_access()  */
+};
+
+
+#ifdef HAVE_PTHREAD
+
+static pthread_mutex_t async_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t async_queued = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t async_done = PTHREAD_COND_INITIALIZER;
+static struct diskimage_request *async_first, *async_last;
+static int async_nr_of_workers = 0;
+
+
+/*
+ *  diskimage_async_worker():
+ *
+ *  Worker thread: takes requests from the queue, in order, and performs them.
+ */
+static void *diskimage_async_worker(void *arg)
+{
+	(void) arg;
+
+	pthread_mutex_lock(&async_lock);
+
+	for (;;) {
+		struct diskimage_request *req;
+		int result;
+
+		while (async_first == NULL)
+			pthread_cond_wait(&async_queued, &async_lock);
+
+		req = async_first;
+		async_first = req->next;
+		if (async_first == NULL)
+			async_last = NULL;
+
+		pthread_mutex_unlock(&async_lock);
+		result = diskimage__uncached_read(req->d, req->offset,
+		    req->buf, req->len);
+		pthread_mutex_lock(&async_lock);
+
+		req->result = result;
+		req->done = 1;
+		pthread_cond_broadcast(&async_done);
+	}
+
+	return NULL;
+}
+
+
+/*
+ *  diskimage_async_start_workers():
+ *
+ *  Starts the worker threads, the first time an asynchronous request is
+ *  made. Returns false if no worker could be started.
+ */
+static bool diskimage_async_start_workers(void)
+{
+	pthread_attr_t attr;
+	int i;
+
+	if (async_nr_of_workers > 0)
+		return true;
+
+	pthread_attr_init(&attr);
+	pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+	for (i = 0; i < DISKIMAGE_ASYNC_WORKERS; i++) {
+		pthread_t thread;
+		if (pthread_create(&thread, &attr, diskimage_async_worker,
+		    NULL) != 0)
+			break;
+		async_nr_of_workers ++;
+	}
+
+	pthread_attr_destroy(&attr);
+
+	if (async_nr_of_workers == 0) {
+		debugmsg(SUBSYS_DISK, "async", VERBOSITY_WARNING,
+		    "could not start any worker threads; disk image "
+		    "reads will be synchronous");
+		async_nr_of_workers = -1;
+	}
+
+	return async_nr_of_workers > 0;
+}
+
+#endif	/*  HAVE_PTHREAD  */
+
+
+/*
+ *  diskimage_access_async():
+ *
+ *  Starts a read from (writeflag = 0) or write to (writeflag = 1) a disk
+ *  image on a machine. buf must stay valid until the request has completed.
+ *
+ *  Returns a request handle, which must be passed to diskimage_request_poll()
+ *  or diskimage_request_wait() until they report that the request is done.
+ */
+struct diskimage_request *diskimage_access_async(struct machine *machine,
+	int id, int type, int writeflag, off_t offset, unsigned char *buf,
+	size_t len)
+{
+	struct diskimage_request *req;
+	struct diskimage *d = machine->first_diskimage;
+
+	while (d != NULL) {
+		if (d->type == type && d->id == id)
+			break;
+		d = d->next;
+	}
+
+	CHECK_ALLOCATION(req = (struct diskimage_request *)
+	    malloc(sizeof(struct diskimage_request)));
+	memset(req, 0, sizeof(struct diskimage_request));
+
+	req->d = d;
+	req->offset = offset;
+	req->buf = buf;
+	req->len = len;
+
+#ifdef HAVE_PTHREAD
+	if (d != NULL && !writeflag && d->nr_of_overlays == 0 &&
+	    d->sparse == NULL && !d->is_a_tape &&
+	    offset >= d->override_base_offset &&
+	    diskimage_async_start_workers()) {
+		req->offset -= d->override_base_offset;
+
+		/*
+		 *  Served from the block cache? Otherwise, the cache has
+		 *  written back anything it had dirty in this range, and
+		 *  the worker can read from the image file.
+		 */
+		if (diskimage__cache_try_read(d, req->offset, buf, len)) {
+			req->result = 1;
+			req->done = 1;
+			return req;
+		}
+
+		pthread_mutex_lock(&async_lock);
+		if (async_last != NULL)
+			async_last->next = req;
+		else
+			async_first = req;
+		async_last = req;
+		pthread_cond_signal(&async_queued);
+		pthread_mutex_unlock(&async_lock);
+
+		return req;
+	}
+#endif
+
+	/*  Not eligible for a worker thread. Do it right away:  */
+	req->result = diskimage_access(machine, id, type, writeflag,
+	    offset, buf, len);
+	req->done = 1;
+
+	return req;
+}
+
+
+/*
+ *  diskimage_request_poll():
+ *
+ *  Returns 0 if the request is still in progress. Otherwise the request is
+ *  freed, and the return value is 1 if the access completed successfully,
+ *  or -1 if it failed.
+ */
+int diskimage_request_poll(struct diskimage_request *req)
+{
+	int done, result;
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&async_lock);
+	done = req->done;
+	pthread_mutex_unlock(&async_lock);
+#else
+	done = req->done;
+#endif
+
+	if (!done)
+		return 0;
+
+	result = req->result? 1 : -1;
+	free(req);
+
+	return result;
+}
+
+
+/*
+ *  diskimage_request_wait():
+ *
+ *  Blocks until a request has completed, and then frees it. Returns 1 if
+ *  the access completed successfully, -1 if it failed.
+ */
+int diskimage_request_wait(struct diskimage_request *req)
+{
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&async_lock);
+	while (!req->done)
+		pthread_cond_wait(&async_done, &async_lock);
+	pthread_mutex_unlock(&async_lock);
+#endif
+
+	return diskimage_request_poll(req);
+}
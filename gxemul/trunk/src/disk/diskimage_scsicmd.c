@@ -99,6 +99,9 @@ void scsi_transfer_free(struct scsi_transfer *p)
 		exit(1);
 	}
 
+	/*  data_in must not be freed while it is still being read into:  */
+	diskimage_scsi_wait(p);
+
 	if (p->msg_out != NULL)
 		free(p->msg_out);
 	if (p->cmd != NULL)
@@ -185,11 +188,7 @@ static void diskimage__switch_tape(struct diskimage *d)
 	    d->fname, d->tape_filenr);
 	tmpfname[sizeof(tmpfname)-1] = '\0';
 
-	if (d->f != NULL)
-		fclose(d->f);
-
-	d->f = fopen(tmpfname, d->writable? "r+" : "r");
-	if (d->f == NULL) {
+	if (!diskimage__open(d, tmpfname, d->writable)) {
 		debugmsg(SUBSYS_DISK, "scsi", VERBOSITY_ERROR,
 		    "diskimage__switch_tape(): could not "
 		    "(re)open '%s'", tmpfname);
@@ -200,6 +199,134 @@ static void diskimage__switch_tape(struct diskimage *d)
 }
 
 
+/*
+ *  diskimage__scsi_decode_rw():
+ *
+ *  If xferp holds a READ or WRITE (6, 10, 12, or 16 byte) command, then the
+ *  logical block address and number of blocks are returned in *lbap and
+ *  *nblocksp, *writep is set to non-zero for writes, and true is returned.
+ */
+static bool diskimage__scsi_decode_rw(const struct scsi_transfer *xferp,
+	int *writep, uint64_t *lbap, uint64_t *nblocksp)
+{
+	const unsigned char *cmd = xferp->cmd;
+	int i;
+
+	if (cmd == NULL || xferp->cmd_len < 6)
+		return false;
+
+	switch (cmd[0]) {
+
+	case SCSICMD_READ:
+	case SCSICMD_WRITE:
+		/*
+		 *  bits 4..0 of cmd[1], and cmd[2] and cmd[3] hold the
+		 *  logical block address.
+		 *
+		 *  cmd[4] holds the number of logical blocks to transfer.
+		 *  (Special case if the value is 0, actually means 256.)
+		 */
+		*lbap = ((cmd[1] & 0x1f) << 16) + (cmd[2] << 8) + cmd[3];
+		*nblocksp = cmd[4] == 0? 256 : cmd[4];
+		break;
+
+	case SCSICMD_READ_10:
+	case SCSICMD_WRITE_10:
+		/*
+		 *  cmd[2..5] hold the logical block address.
+		 *  cmd[7..8] holds the number of logical blocks to transfer.
+		 *  (NOTE: If the value is 0, this means 0, not 65536. :-)
+		 */
+		if (xferp->cmd_len < 10)
+			return false;
+		*lbap = ((uint64_t)cmd[2] << 24) + (cmd[3] << 16) +
+		    (cmd[4] << 8) + cmd[5];
+		*nblocksp = (cmd[7] << 8) + cmd[8];
+		break;
+
+	case SCSICMD_READ_12:
+	case SCSICMD_WRITE_12:
+		/*  cmd[2..5] = logical block address, cmd[6..9] = length.  */
+		if (xferp->cmd_len < 12)
+			return false;
+		*lbap = ((uint64_t)cmd[2] << 24) + (cmd[3] << 16) +
+		    (cmd[4] << 8) + cmd[5];
+		*nblocksp = ((uint64_t)cmd[6] << 24) + (cmd[7] << 16) +
+		    (cmd[8] << 8) + cmd[9];
+		break;
+
+	case SCSICMD_READ_16:
+	case SCSICMD_WRITE_16:
+		/*  cmd[2..9] = logical block address, cmd[10..13] = length.  */
+		if (xferp->cmd_len < 16)
+			return false;
+		*lbap = 0;
+		for (i=2; i<10; i++)
+			*lbap = (*lbap << 8) + cmd[i];
+		*nblocksp = ((uint64_t)cmd[10] << 24) + (cmd[11] << 16) +
+		    (cmd[12] << 8) + cmd[13];
+		break;
+
+	default:
+		return false;
+	}
+
+	*writep = cmd[0] == SCSICMD_WRITE || cmd[0] == SCSICMD_WRITE_10 ||
+	    cmd[0] == SCSICMD_WRITE_12 || cmd[0] == SCSICMD_WRITE_16;
+
+	return true;
+}
+
+
+/*
+ *  diskimage__scsi_fua():
+ *
+ *  Returns true if xferp holds a WRITE (10, 12, or 16 byte) command with the
+ *  FUA (Force Unit Access) bit set, i.e. the data must be on the medium
+ *  before the command completes.
+ */
+static bool diskimage__scsi_fua(const struct scsi_transfer *xferp)
+{
+	if (xferp->cmd == NULL || xferp->cmd_len < 10)
+		return false;
+
+	switch (xferp->cmd[0]) {
+	case SCSICMD_WRITE_10:
+	case SCSICMD_WRITE_12:
+	case SCSICMD_WRITE_16:
+		return (xferp->cmd[1] & 0x08) != 0;
+	}
+
+	return false;
+}
+
+
+/*
+ *  diskimage_scsi_wait():
+ *
+ *  If the controller set xferp->async_read before calling
+ *  diskimage_scsicommand(), a READ from a disk image may still be in
+ *  progress when it returns (xferp->read_req is then non-NULL). The
+ *  controller should then not let the guest see the data or the status
+ *  until it has called this function, which blocks until the read is done.
+ *  Controllers call it at a scheduled point in emulated time (usually
+ *  DISKIMAGE_ASYNC_READ_NINSTRS after the command; see cpu_event_schedule()),
+ *  so that guests see the same timing however fast the host is.
+ *
+ *  If the read failed, the status is changed to CHECK CONDITION.
+ */
+void diskimage_scsi_wait(struct scsi_transfer *xferp)
+{
+	if (xferp->read_req == NULL)
+		return;
+
+	if (diskimage_request_wait(xferp->read_req) < 0)
+		xferp->status[0] = 0x02;	/*  CHECK CONDITION  */
+
+	xferp->read_req = NULL;
+}
+
+
 /**************************************************************************/
 
 
@@ -325,6 +452,11 @@ xferp->data_in[3] = 0x02;	/*  Response data format = SCSI-2  */
 		xferp->data_in[4] = retlen - 4;	/*  Additional length  */
 xferp->data_in[4] = 0x2c - 4;	/*  Additional length  */
 		xferp->data_in[6] = 0x04;  /*  ACKREQQ  */
+		/*
+		 *  CmdQue (0x02) is not set: none of the emulated SCSI
+		 *  controllers can disconnect and reselect, so there can
+		 *  never be more than one command outstanding per target.
+		 */
 		xferp->data_in[7] = 0x60;  /*  WBus32, WBus16  */
 
 		/*  These are padded with spaces:  */
@@ -427,7 +559,10 @@ xferp->data_in[4] = 0x2c - 4;	/*  Additional length  */
 
 		diskimage_recalc_size(d);
 
+		/*  Too large? Then the guest should use READ_CAPACITY(16).  */
 		size = d->nr_of_logical_blocks - 1;
+		if (size > 0xffffffffULL)
+			size = 0xffffffffULL;
 
 		xferp->data_in[0] = (size >> 24) & 255;
 		xferp->data_in[1] = (size >> 16) & 255;
@@ -442,6 +577,43 @@ xferp->data_in[4] = 0x2c - 4;	/*  Additional length  */
 		diskimage__return_default_status_and_message(xferp);
 		break;
 
+	case SCSIBLOCKCMD_SERVICE_ACTION_IN:
+		if ((xferp->cmd[1] & 0x1f) != SCSI_SAI_READ_CAPACITY_16 ||
+		    xferp->cmd_len != 16) {
+			fatal("[ SCSI SERVICE ACTION IN 0x%02x, len=%i: not yet"
+			    " implemented ]\n", xferp->cmd[1] & 0x1f,
+			    (int)xferp->cmd_len);
+			diskimage__return_default_status_and_message(xferp);
+			xferp->status[0] = 0x02;	/*  CHECK CONDITION  */
+			break;
+		}
+
+		debug("READ_CAPACITY_16");
+
+		/*  Allocation length in cmd[10..13], but at most 32 bytes:  */
+		retlen = (xferp->cmd[10] << 24) + (xferp->cmd[11] << 16) +
+		    (xferp->cmd[12] << 8) + xferp->cmd[13];
+		if (retlen > 32 || retlen < 0)
+			retlen = 32;
+
+		scsi_transfer_allocbuf(&xferp->data_in_len, &xferp->data_in,
+		    32, 1);
+		xferp->data_in_len = retlen;
+
+		diskimage_recalc_size(d);
+
+		size = d->nr_of_logical_blocks - 1;
+		for (i=0; i<8; i++)
+			xferp->data_in[i] = (size >> (56 - i*8)) & 255;
+
+		xferp->data_in[8] = (d->logical_block_size >> 24) & 255;
+		xferp->data_in[9] = (d->logical_block_size >> 16) & 255;
+		xferp->data_in[10] = (d->logical_block_size >> 8) & 255;
+		xferp->data_in[11] = d->logical_block_size & 255;
+
+		diskimage__return_default_status_and_message(xferp);
+		break;
+
 	case SCSICMD_MODE_SENSE:
 	case SCSICMD_MODE_SENSE10:	
 		debug("MODE_SENSE");
@@ -556,6 +728,14 @@ xferp->data_in[4] = 0x2c - 4;	/*  Additional length  */
 			xferp->data_in[q + 28] = (d->rpms >> 8) & 255;
 			xferp->data_in[q + 29] = d->rpms & 255;
 			break;
+		case 8:		/*  caching page  */
+			xferp->data_in[q + 0] = pagecode;
+			xferp->data_in[q + 1] = 0x12;
+
+			/*  2 = flags. 0x04 = WCE (write cache enabled)  */
+			if (diskimage_has_write_cache(machine, id, type))
+				xferp->data_in[q + 2] = 0x04;
+			break;
 		default:
 			debugmsg(SUBSYS_DISK, "scsi", VERBOSITY_WARNING,
 			    "MODE_SENSE for page %i is not yet "
@@ -566,6 +746,8 @@ xferp->data_in[4] = 0x2c - 4;	/*  Additional length  */
 
 	case SCSICMD_READ:
 	case SCSICMD_READ_10:
+	case SCSICMD_READ_12:
+	case SCSICMD_READ_16:
 		debug("READ");
 
 		/*
@@ -604,43 +786,14 @@ xferp->data_in[4] = 0x2c - 4;	/*  Additional length  */
 			    ", ofs=%lli ]\n", id, d->tape_filenr,
 			    xferp->cmd[1], (int)size, (long long)ofs);
 		} else {
-			if (xferp->cmd[0] == SCSICMD_READ) {
-				if (xferp->cmd_len != 6)
-					debug(" (weird len=%i)",
-					    xferp->cmd_len);
+			uint64_t lba = 0, nblocks = 0;
+			int writeflag;
 
-				/*
-				 *  bits 4..0 of cmd[1], and cmd[2] and cmd[3]
-				 *  hold the logical block address.
-				 *
-				 *  cmd[4] holds the number of logical blocks
-				 *  to transfer. (Special case if the value is
-				 *  0, actually means 256.)
-				 */
-				ofs = ((xferp->cmd[1] & 0x1f) << 16) +
-				      (xferp->cmd[2] << 8) + xferp->cmd[3];
-				retlen = xferp->cmd[4];
-				if (retlen == 0)
-					retlen = 256;
-			} else {
-				if (xferp->cmd_len != 10)
-					debug(" (weird len=%i)",
-					    xferp->cmd_len);
+			diskimage__scsi_decode_rw(xferp, &writeflag, &lba,
+			    &nblocks);
 
-				/*
-				 *  cmd[2..5] hold the logical block address.
-				 *  cmd[7..8] holds the number of logical
-				 *  blocks to transfer. (NOTE: If the value is
-				 *  0, this means 0, not 65536. :-)
-				 */
-				ofs = ((uint64_t)xferp->cmd[2] << 24) +
-				    (xferp->cmd[3] << 16) + (xferp->cmd[4] << 8)
-				    + xferp->cmd[5];
-				retlen = (xferp->cmd[7] << 8) + xferp->cmd[8];
-			}
-
-			size = retlen * d->logical_block_size;
-			ofs *= d->logical_block_size;
+			size = nblocks * d->logical_block_size;
+			ofs = lba * d->logical_block_size;
 		}
 
 		/*  Return data:  */
@@ -663,62 +816,43 @@ xferp->data_in[4] = 0x2c - 4;	/*  Additional length  */
 		 *   set to one in the sense data. The sense key shall
 		 *   be set to NO SENSE"..
 		 */
-		if (d->is_a_tape && d->f != NULL && feof(d->f)) {
+		if (d->is_a_tape && d->fd >= 0 && d->tape_eof) {
 			debug(" feof id=%i\n", id);
 			xferp->status[0] = 0x02;	/*  CHECK CONDITION  */
 
 			d->filemark = 1;
+		} else if (xferp->async_read && !d->is_a_tape) {
+			/*  (diskimage_access_async() takes a machine-wide
+			    offset.)  */
+			xferp->read_req = diskimage_access_async(machine, id,
+			    type, 0, ofs + d->override_base_offset,
+			    xferp->data_in, size);
 		} else {
+			/*  (This also updates tape_offset and tape_eof.)  */
 			/* int result = */  diskimage__internal_access(d, 0, ofs, xferp->data_in, size);
 		}
 
-		if (d->is_a_tape && d->f != NULL)
-			d->tape_offset = ftello(d->f);
-
 		/*  TODO: other errors?  */
 		break;
 
 	case SCSICMD_WRITE:
 	case SCSICMD_WRITE_10:
+	case SCSICMD_WRITE_12:
+	case SCSICMD_WRITE_16:
 		debug("WRITE");
 
 		/*  TODO: tape  */
 
-		if (xferp->cmd[0] == SCSICMD_WRITE) {
-			if (xferp->cmd_len != 6)
-				debug(" (weird len=%i)", xferp->cmd_len);
-
-			/*
-			 *  bits 4..0 of cmd[1], and cmd[2] and cmd[3] hold the
-			 *  logical block address.
-			 *
-			 *  cmd[4] holds the number of logical blocks to
-			 *  transfer. (Special case if the value is 0, actually
-			 *  means 256.)
-			 */
-			ofs = ((xferp->cmd[1] & 0x1f) << 16) +
-			      (xferp->cmd[2] << 8) + xferp->cmd[3];
-			retlen = xferp->cmd[4];
-			if (retlen == 0)
-				retlen = 256;
-		} else {
-			if (xferp->cmd_len != 10)
-				debug(" (weird len=%i)", xferp->cmd_len);
-
-			/*
-			 *  cmd[2..5] hold the logical block address.
-			 *  cmd[7..8] holds the number of logical blocks to
-			 *  transfer. (NOTE: If the value is 0 this means 0,
-			 *  not 65536.)
-			 */
-			ofs = ((uint64_t)xferp->cmd[2] << 24) +
-			    (xferp->cmd[3] << 16) + (xferp->cmd[4] << 8) +
-			    xferp->cmd[5];
-			retlen = (xferp->cmd[7] << 8) + xferp->cmd[8];
-		}
+		{
+			uint64_t lba = 0, nblocks = 0;
+			int writeflag;
 
-		size = retlen * d->logical_block_size;
-		ofs *= d->logical_block_size;
+			diskimage__scsi_decode_rw(xferp, &writeflag, &lba,
+			    &nblocks);
+
+			size = nblocks * d->logical_block_size;
+			ofs = lba * d->logical_block_size;
+		}
 
 		if (xferp->data_out_offset != size) {
 			debug(", data_out == NULL, wanting %i bytes, \n\n",
@@ -734,6 +868,9 @@ xferp->data_in[4] = 0x2c - 4;	/*  Additional length  */
 
 		/*  TODO: how about return code?  */
 
+		if (diskimage__scsi_fua(xferp))
+			diskimage__sync(d);
+
 		diskimage__return_default_status_and_message(xferp);
 		break;
 
@@ -743,11 +880,8 @@ xferp->data_in[4] = 0x2c - 4;	/*  Additional length  */
 		if (xferp->cmd_len != 10)
 			debug(" (weird len=%i)", xferp->cmd_len);
 
-		/*  TODO: actualy care about cmd[]  */
-		/*  TODO: Move to diskimage.cc and make sure that both
-			d->f is fsynced AND any overlays and overlay bitmap
-			files are fsynced too!  */
-		fsync(fileno(d->f));
+		/*  TODO: actualy care about cmd[] (the block range)  */
+		diskimage__sync(d);
 
 		diskimage__return_default_status_and_message(xferp);
 		break;
@@ -847,11 +981,7 @@ xferp->data_in[4] = 0x2c - 4;	/*  Additional length  */
 
 		/*  Close and reopen.  */
 
-		if (d->f != NULL)
-			fclose(d->f);
-
-		d->f = fopen(d->fname, d->writable? "r+" : "r");
-		if (d->f == NULL) {
+		if (!diskimage__open(d, d->fname, d->writable)) {
 			fprintf(stderr, "[ diskimage: could not (re)open "
 			    "'%s' ]\n", d->fname);
 			/*  TODO: return error  */
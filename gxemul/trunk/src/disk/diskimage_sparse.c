@@ -0,0 +1,473 @@
+/*
+ *  Copyright (C) 2003-2021  Anders Gavare.  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright  
+ *     notice, this list of conditions and the following disclaimer in the 
+ *     documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE   
+ *  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ *  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ *  OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ *  OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ *  SUCH DAMAGE.
+ *
+ *
+ *  Disk image support: GXemul's native sparse disk image format.
+ *
+ *  A sparse image stores only the clusters of a disk that actually contain
+ *  something. Clusters that were never written come from an optional
+ *  backing file (a raw disk image, or another sparse image), or read as
+ *  zeros if there is no backing file. Writes are copy-on-write: the first
+ *  write to such a cluster copies it into the sparse image. Several sparse
+ *  images can therefore share one read-only base installation.
+ *
+ *  File layout (all integers are big-endian):
+ *
+ *	 0	"GXSPARSE"
+ *	 8	uint32_t  version (SPARSE_VERSION)
+ *	12	uint32_t  cluster size in bytes (a power of two, >= 512)
+ *	16	uint64_t  virtual disk size in bytes
+ *	24	uint64_t  offset of the cluster table
+ *	32	uint32_t  flags (must be 0)
+ *	36	uint32_t  length of the backing file name (0 = no backing file)
+ *	64	backing file name (not NUL-terminated). A relative name is
+ *		relative to the directory of the sparse image itself.
+ *
+ *  The cluster table has one uint64_t per cluster:
+ *
+ *	0	not present; read from the backing file (or zeros)
+ *	1	zero-filled (hides the backing file's data)
+ *	other	offset of the cluster's data in the sparse image file
+ *
+ *  Cluster data is appended at the end of the file as clusters are
+ *  allocated. experiments/make_sparse_image.c creates sparse images from
+ *  raw images, or empty ones on top of a backing file.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include "diskimage.h"
+#include "misc.h"
+
+
+#define	SPARSE_MAGIC		"GXSPARSE"
+#define	SPARSE_VERSION		1
+#define	SPARSE_HEADER_SIZE	64
+#define	SPARSE_MAX_NAME_LEN	4096
+#define	SPARSE_MAX_CHAIN	16
+
+#define	SPARSE_NOT_PRESENT	0
+#define	SPARSE_ZERO		1
+
+struct diskimage_sparse {
+	int		fd;
+	int		writable;
+
+	uint32_t	cluster_size;
+	uint64_t	virtual_size;
+	uint64_t	nr_of_clusters;
+	uint64_t	table_offset;
+	uint64_t	*table;
+	off_t		file_end;
+
+	/*  Backing file: either another sparse image, or a raw image:  */
+	struct diskimage_sparse *backing;
+	int		backing_fd;		/*  -1 if none  */
+};
+
+
+static uint32_t get_be32(const unsigned char *p)
+{
+	return ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static uint64_t get_be64(const unsigned char *p)
+{
+	return ((uint64_t)get_be32(p) << 32) | get_be32(p + 4);
+}
+
+static void put_be64(unsigned char *p, uint64_t x)
+{
+	int i;
+	for (i = 7; i >= 0; i--) {
+		p[i] = x;
+		x >>= 8;
+	}
+}
+
+
+/*
+ *  diskimage_sparse_probe():
+ *
+ *  Returns true if the open file fd starts with the sparse image magic.
+ */
+bool diskimage_sparse_probe(int fd)
+{
+	unsigned char magic[8];
+
+	return diskimage_pread(fd, magic, sizeof(magic), 0) == sizeof(magic)
+	    && memcmp(magic, SPARSE_MAGIC, sizeof(magic)) == 0;
+}
+
+
+/*
+ *  sparse_open():
+ *
+ *  Reads the header and cluster table of a sparse image, and opens its
+ *  backing file chain. depth guards against backing files which (directly
+ *  or indirectly) refer to themselves.
+ */
+static struct diskimage_sparse *sparse_open(int fd, const char *fname,
+	int writable, int depth)
+{
+	struct diskimage_sparse *s;
+	unsigned char hdr[SPARSE_HEADER_SIZE], *tbl;
+	uint32_t name_len;
+	uint64_t i;
+	struct stat st;
+
+	if (depth >= SPARSE_MAX_CHAIN) {
+		debugmsg(SUBSYS_DISK, "sparse", VERBOSITY_ERROR,
+		    "%s: backing file chain too long (loop?)", fname);
+		return NULL;
+	}
+
+	if (diskimage_pread(fd, hdr, sizeof(hdr), 0) != sizeof(hdr) ||
+	    memcmp(hdr, SPARSE_MAGIC, 8) != 0 || fstat(fd, &st) != 0) {
+		debugmsg(SUBSYS_DISK, "sparse", VERBOSITY_ERROR,
+		    "%s: could not read sparse image header", fname);
+		return NULL;
+	}
+
+	CHECK_ALLOCATION(s = (struct diskimage_sparse *)
+	    malloc(sizeof(struct diskimage_sparse)));
+	memset(s, 0, sizeof(struct diskimage_sparse));
+	s->fd = fd;
+	s->writable = writable;
+	s->backing_fd = -1;
+	s->cluster_size = get_be32(hdr + 12);
+	s->virtual_size = get_be64(hdr + 16);
+	s->table_offset = get_be64(hdr + 24);
+	name_len = get_be32(hdr + 36);
+
+	if (get_be32(hdr + 8) != SPARSE_VERSION || get_be32(hdr + 32) != 0 ||
+	    s->cluster_size < 512 || (s->cluster_size & (s->cluster_size-1))
+	    || name_len > SPARSE_MAX_NAME_LEN) {
+		debugmsg(SUBSYS_DISK, "sparse", VERBOSITY_ERROR,
+		    "%s: unsupported sparse image version, flags, or cluster"
+		    " size", fname);
+		free(s);
+		return NULL;
+	}
+
+	s->nr_of_clusters = (s->virtual_size + s->cluster_size - 1)
+	    / s->cluster_size;
+
+	/*  Read the cluster table:  */
+	CHECK_ALLOCATION(s->table = (uint64_t *) malloc(
+	    (s->nr_of_clusters + 1) * sizeof(uint64_t)));
+	CHECK_ALLOCATION(tbl = (unsigned char *) malloc(
+	    s->nr_of_clusters * 8 + 1));
+	if (diskimage_pread(fd, tbl, s->nr_of_clusters * 8, s->table_offset)
+	    != (ssize_t) (s->nr_of_clusters * 8)) {
+		debugmsg(SUBSYS_DISK, "sparse", VERBOSITY_ERROR,
+		    "%s: could not read the cluster table", fname);
+		free(tbl);
+		diskimage_sparse_close(s);
+		return NULL;
+	}
+	for (i = 0; i < s->nr_of_clusters; i++)
+		s->table[i] = get_be64(tbl + 8 * i);
+	free(tbl);
+
+	/*  New clusters are appended at the end, at a cluster boundary:  */
+	s->file_end = (st.st_size + s->cluster_size - 1) &
+	    ~(off_t) (s->cluster_size - 1);
+
+	/*  Open the backing file, if any. It is never written to.  */
+	if (name_len > 0) {
+		char *name, *bname;
+		const char *slash = strrchr(fname, '/');
+		size_t dirlen = slash == NULL? 0 : slash - fname + 1;
+
+		CHECK_ALLOCATION(name = (char *) malloc(name_len + 1));
+		if (diskimage_pread(fd, (unsigned char *) name, name_len,
+		    SPARSE_HEADER_SIZE) != (ssize_t) name_len) {
+			debugmsg(SUBSYS_DISK, "sparse", VERBOSITY_ERROR,
+			    "%s: could not read backing file name", fname);
+			free(name);
+			diskimage_sparse_close(s);
+			return NULL;
+		}
+		name[name_len] = '\0';
+
+		CHECK_ALLOCATION(bname = (char *) malloc(dirlen + name_len + 1));
+		if (name[0] == '/')
+			dirlen = 0;
+		memcpy(bname, fname, dirlen);
+		strcpy(bname + dirlen, name);
+		free(name);
+
+		s->backing_fd = open(bname, O_RDONLY);
+		if (s->backing_fd < 0) {
+			debugmsg(SUBSYS_DISK, "sparse", VERBOSITY_ERROR,
+			    "%s: could not open backing file '%s': %s",
+			    fname, bname, strerror(errno));
+			free(bname);
+			diskimage_sparse_close(s);
+			return NULL;
+		}
+
+		if (diskimage_sparse_probe(s->backing_fd)) {
+			s->backing = sparse_open(s->backing_fd, bname, 0,
+			    depth + 1);
+			if (s->backing == NULL) {
+				free(bname);
+				diskimage_sparse_close(s);
+				return NULL;
+			}
+		}
+
+		free(bname);
+	}
+
+	return s;
+}
+
+
+/*
+ *  diskimage_sparse_open():
+ *
+ *  Opens the sparse image which has already been opened as fd. The caller
+ *  keeps ownership of fd, but must not close it before the sparse image.
+ *  Returns NULL, after printing an error message, on failure.
+ */
+struct diskimage_sparse *diskimage_sparse_open(int fd, const char *fname,
+	int writable)
+{
+	return sparse_open(fd, fname, writable, 0);
+}
+
+
+/*
+ *  diskimage_sparse_close():
+ *
+ *  Frees a sparse image, and closes its backing file chain. (The image's
+ *  own fd is left to the caller.)
+ */
+void diskimage_sparse_close(struct diskimage_sparse *s)
+{
+	if (s->backing != NULL)
+		diskimage_sparse_close(s->backing);
+	if (s->backing_fd >= 0)
+		close(s->backing_fd);
+
+	free(s->table);
+	free(s);
+}
+
+
+/*
+ *  diskimage_sparse_size():
+ *
+ *  Returns the virtual size, in bytes, of the disk stored in a sparse image.
+ */
+int64_t diskimage_sparse_size(struct diskimage_sparse *s)
+{
+	return s->virtual_size;
+}
+
+
+/*
+ *  diskimage_sparse_pread():
+ *
+ *  Reads from the virtual disk of a sparse image. Like pread(), a read
+ *  which goes past the end of the disk is short. Returns the number of bytes
+ *  read, or -1 on error.
+ */
+ssize_t diskimage_sparse_pread(struct diskimage_sparse *s, unsigned char *buf,
+	size_t len, off_t offset)
+{
+	size_t done = 0;
+
+	if (offset < 0 || (uint64_t) offset >= s->virtual_size)
+		return 0;
+	if (offset + len > s->virtual_size)
+		len = s->virtual_size - offset;
+
+	while (done < len) {
+		uint64_t cluster = (offset + done) / s->cluster_size;
+		size_t inofs = (offset + done) & (s->cluster_size - 1);
+		size_t chunk = s->cluster_size - inofs;
+		uint64_t entry = s->table[cluster];
+		ssize_t res;
+
+		if (chunk > len - done)
+			chunk = len - done;
+
+		/*  Extend over clusters which are stored consecutively:  */
+		if (entry > SPARSE_ZERO)
+			while (done + chunk < len && cluster + 1 <
+			    s->nr_of_clusters && s->table[cluster + 1] ==
+			    s->table[cluster] + s->cluster_size) {
+				size_t more = len - done - chunk;
+				if (more > s->cluster_size)
+					more = s->cluster_size;
+				chunk += more;
+				cluster ++;
+			}
+
+		if (entry > SPARSE_ZERO) {
+			res = diskimage_pread(s->fd, buf + done, chunk,
+			    entry + inofs);
+		} else if (entry == SPARSE_NOT_PRESENT && s->backing != NULL) {
+			res = diskimage_sparse_pread(s->backing, buf + done,
+			    chunk, offset + done);
+		} else if (entry == SPARSE_NOT_PRESENT && s->backing_fd >= 0) {
+			res = diskimage_pread(s->backing_fd, buf + done, chunk,
+			    offset + done);
+		} else {
+			memset(buf + done, 0, chunk);
+			res = chunk;
+		}
+
+		if (res < 0)
+			return done > 0? (ssize_t) done : -1;
+
+		/*  Data missing at the end of a file reads as zeros:  */
+		if ((size_t) res < chunk)
+			memset(buf + done + res, 0, chunk - res);
+
+		done += chunk;
+	}
+
+	return done;
+}
+
+
+/*
+ *  sparse_set_entry():
+ *
+ *  Updates a cluster table entry, both in memory and in the file.
+ */
+static bool sparse_set_entry(struct diskimage_sparse *s, uint64_t cluster,
+	uint64_t entry)
+{
+	unsigned char b[8];
+
+	put_be64(b, entry);
+	if (diskimage_pwrite(s->fd, b, 8, s->table_offset + 8 * cluster) != 8)
+		return false;
+
+	s->table[cluster] = entry;
+	return true;
+}
+
+
+/*
+ *  diskimage_sparse_pwrite():
+ *
+ *  Writes to the virtual disk of a sparse image, allocating (and filling in
+ *  from the backing file) clusters as needed. Writes past the end of the
+ *  disk are truncated. Returns the number of bytes written, or -1 on error.
+ */
+ssize_t diskimage_sparse_pwrite(struct diskimage_sparse *s,
+	const unsigned char *buf, size_t len, off_t offset)
+{
+	unsigned char *cbuf = NULL;
+	size_t done = 0;
+
+	if (!s->writable)
+		return -1;
+	if (offset < 0 || (uint64_t) offset >= s->virtual_size)
+		return 0;
+	if (offset + len > s->virtual_size)
+		len = s->virtual_size - offset;
+
+	while (done < len) {
+		uint64_t cluster = (offset + done) / s->cluster_size;
+		off_t cluster_ofs = (off_t) cluster * s->cluster_size;
+		size_t inofs = (offset + done) & (s->cluster_size - 1);
+		size_t chunk = s->cluster_size - inofs;
+		uint64_t entry = s->table[cluster];
+
+		if (chunk > len - done)
+			chunk = len - done;
+
+		if (entry <= SPARSE_ZERO) {
+			size_t i;
+			bool all_zero = true;
+
+			for (i = 0; i < chunk && all_zero; i++)
+				if (buf[done + i] != 0)
+					all_zero = false;
+
+			/*  Zeros written over zeros change nothing:  */
+			if (all_zero && (entry == SPARSE_ZERO || (s->backing
+			    == NULL && s->backing_fd < 0))) {
+				done += chunk;
+				continue;
+			}
+
+			/*  A whole cluster of zeros needs no storage:  */
+			if (all_zero && chunk == s->cluster_size) {
+				if (!sparse_set_entry(s, cluster, SPARSE_ZERO))
+					break;
+				done += chunk;
+				continue;
+			}
+
+			/*  Copy-on-write: allocate a new cluster.  */
+			if (cbuf == NULL)
+				CHECK_ALLOCATION(cbuf = (unsigned char *)
+				    malloc(s->cluster_size));
+			memset(cbuf, 0, s->cluster_size);
+
+			if (diskimage_sparse_pread(s, cbuf, s->cluster_size,
+			    cluster_ofs) < 0)
+				break;
+			memcpy(cbuf + inofs, buf + done, chunk);
+
+			if (diskimage_pwrite(s->fd, cbuf, s->cluster_size,
+			    s->file_end) != (ssize_t) s->cluster_size)
+				break;
+
+			/*  The data is in place; now point the table at it.  */
+			if (!sparse_set_entry(s, cluster, s->file_end))
+				break;
+
+			s->file_end += s->cluster_size;
+		} else {
+			if (diskimage_pwrite(s->fd, buf + done, chunk,
+			    entry + inofs) != (ssize_t) chunk)
+				break;
+		}
+
+		done += chunk;
+	}
+
+	free(cbuf);
+
+	return done > 0 || len == 0? (ssize_t) done : -1;
+}
+
@@ -56,6 +56,14 @@
  *  "nullify" (skip) the delay-slot. If the end-of-page slot is skipped, then
  *  we end up one step after that. That's where the end_of_page2 slot is. :)
  *
+ *  Each instruction call is a function pointer plus ARCH_N_IC_ARGS args, so
+ *  on 64-bit hosts a physpage is roughly 8 * (ARCH_N_IC_ARGS + 1) times the
+ *  number of instructions in a page. ARCH_N_IC_ARGS should therefore be no
+ *  larger than what the architecture's instruction functions actually use.
+ *  (Moving the args to a separate pool does not help: for a fully translated
+ *  page, a pointer to the args plus the args themselves take more space than
+ *  the args inline, and every arg access becomes an extra dependent load.)
+ *
  *  next_ofs points to the next page in a chain of possible pages. (Several
  *  pages can be in the same chain, but only one matches the specific physaddr.)
  *
@@ -185,15 +193,33 @@ struct physpage_ranges {
  *
  *  The VPH32EXTENDED variant adds an additional postfix to the array
  *  names. Used so far only for usermode addresses in M88K emulation.
+ *
+ *  The arrays are part of the cpu struct, which is allocated using
+ *  zeroed_alloc(), so host memory is only used for the parts that have
+ *  actually been touched. vph32_chunk_used is a bitmap of which chunks
+ *  (of VPH32_CHUNK_ENTRIES entries each) have been written to since the
+ *  last time the arrays were released; once more than VPH32_RELEASE_CHUNKS
+ *  chunks are in use, the next invalidation of all translations gives the
+ *  memory back to the host OS (see cpu_dyntrans.c). The bitmap is only
+ *  updated when translations are inserted, never on lookups.
  */
 #define	N_VPH32_ENTRIES		1048576
+#define	VPH32_CHUNK_SHIFT	9
+#define	VPH32_CHUNK_ENTRIES	(1 << VPH32_CHUNK_SHIFT)
+#define	N_VPH32_CHUNKS		(N_VPH32_ENTRIES / VPH32_CHUNK_ENTRIES)
+#define	VPH32_RELEASE_CHUNKS	256
+#define	VPH32_CHUNK_BITMAP						\
+	uint32_t		vph32_chunk_used[N_VPH32_CHUNKS / 32];	\
+	int			vph32_n_chunks_used;
 #define	VPH32(arch,ARCH)						\
+	VPH32_CHUNK_BITMAP						\
 	unsigned char		*host_load[N_VPH32_ENTRIES];		\
 	unsigned char		*host_store[N_VPH32_ENTRIES];		\
 	uint32_t		phys_addr[N_VPH32_ENTRIES];		\
 	struct arch ## _tc_physpage  *phys_page[N_VPH32_ENTRIES];	\
 	uint8_t			vaddr_to_tlbindex[N_VPH32_ENTRIES];
 #define	VPH32_16BITVPHENTRIES(arch,ARCH)				\
+	VPH32_CHUNK_BITMAP						\
 	unsigned char		*host_load[N_VPH32_ENTRIES];		\
 	unsigned char		*host_store[N_VPH32_ENTRIES];		\
 	uint32_t		phys_addr[N_VPH32_ENTRIES];		\
@@ -360,6 +386,39 @@ struct cpu_family {
  *  The generic CPU struct:
  */
 
+/*
+ *  Load-linked/store-conditional reservation (MIPS ll/sc, ARM ldrex/strex):
+ *
+ *  host points to the host memory of the reserved word, if it was reachable
+ *  through the fast load translation tables when it was loaded (otherwise
+ *  NULL, and only vaddr is used). value holds the loaded bytes, in guest
+ *  memory order. A store-conditional to host memory is a compare-and-swap
+ *  against value, so it fails if any other CPU or device has changed the
+ *  word, even through the fast store paths which bypass memory_rw().
+ *
+ *  Stores which do go through memory_rw() (from any CPU, and DMA) clear all
+ *  reservations within the same granule. (See cpu_reservation_*() in cpu.c.)
+ */
+struct cpu_reservation {
+	bool		active;
+	int		len;
+	uint64_t	vaddr;
+	uint64_t	granule;	/*  size in bytes, a power of two  */
+	unsigned char	*host;
+	uint64_t	value;
+};
+
+/*
+ *  Device event, scheduled to run at a specific instruction count on a CPU,
+ *  e.g. the completion of a disk read. (See cpu_event_schedule() in cpu.c.)
+ */
+struct cpu_event {
+	struct cpu_event *next;
+	int64_t		ninstrs;
+	void		(*f)(struct cpu *, void *);
+	void		*extra;
+};
+
 struct cpu {
 	/*  Pointer back to the machine this CPU is in:  */
 	struct machine	*machine;
@@ -380,6 +439,26 @@ struct cpu {
 	int64_t		ninstrs;
 	int64_t		ninstrs_at_last_status_printout;
 
+	/*
+	 *  CPU-internal timers (MIPS COUNT/COMPARE, PPC time base and
+	 *  decrementer) are not updated as instructions run, but derived
+	 *  from ninstrs when read; see cpu_ninstrs_now(). The next timer
+	 *  interrupt is due when ninstrs reaches timer_event_ninstrs, and
+	 *  the dyntrans slice during which that happens is cut short there.
+	 *  n_translated_base is the value of n_translated_instrs which
+	 *  corresponds to ninstrs.
+	 *
+	 *  Device events are kept in first_event, sorted by instruction
+	 *  count; event_ninstrs is the count of the first one (or INT64_MAX),
+	 *  and cuts slices short in the same way.
+	 */
+	int64_t		timer_event_ninstrs;
+	struct cpu_event *first_event;
+	int64_t		event_ninstrs;
+	int		n_translated_base;
+	int64_t		ninstrs_polled_at;
+	int		n_polls;
+
 	/*  EMUL_LITTLE_ENDIAN or EMUL_BIG_ENDIAN.  */
 	uint8_t		byte_order;
 
@@ -418,6 +497,7 @@ struct cpu {
 	void		(*useremul_syscall)(struct cpu *cpu, uint32_t code);
 	int		(*instruction_has_delayslot)(struct cpu *cpu,
 			    unsigned char *ib);
+	bool		(*interrupt_check)(struct cpu *cpu);
 
 	/*  The program counter. (For 32-bit modes, not all bits are used.)  */
 	uint64_t	pc;
@@ -425,6 +505,22 @@ struct cpu {
 	/*  The current depth of function call tracing.  */
 	int		trace_tree_depth;
 
+	/*  Load-linked/store-conditional reservation:  */
+	struct cpu_reservation reservation;
+
+	/*  Dyntrans slices run, and how many of them ended in spin-waits:  */
+	int64_t		n_slices;
+	int64_t		n_spin_slices;
+
+	/*
+	 *  interrupt_pending is true when an interrupt is both asserted and
+	 *  enabled, as computed by the interrupt_check function. It is kept
+	 *  up to date by cpu_interrupt_update(), which should be called
+	 *  whenever an interrupt line changes or the CPU changes its
+	 *  interrupt enable state.
+	 */
+	bool		interrupt_pending;
+
 	/*
 	 *  If wants_to_idle is set to true, when the dyntrans loop exits,
 	 *  attempt is made to "idle the host". (Actually, the host only idles
@@ -512,6 +608,27 @@ void cpu_functioncall_trace_return(struct cpu *);
 void cpu_create_or_reset_tc(struct cpu *);
 void cpu_break_out_of_dyntrans_loop(struct cpu *);
 
+bool cpu_spin_wait(struct cpu *cpu);
+void cpu_interrupt_update(struct cpu *cpu);
+int64_t cpu_ninstrs_now(struct cpu *cpu);
+void cpu_timer_schedule(struct cpu *cpu, int64_t when);
+void cpu_event_schedule(struct cpu *cpu, int64_t when,
+	void (*f)(struct cpu *, void *), void *extra);
+void cpu_event_cancel(struct machine *machine,
+	void (*f)(struct cpu *, void *), void *extra);
+void cpu_event_run(struct cpu *cpu);
+
+void cpu_reservation_set(struct cpu *cpu, uint64_t vaddr,
+	const unsigned char *data, int len, uint64_t granule,
+	unsigned char *host);
+void cpu_reservation_clear(struct cpu *cpu);
+void cpu_reservation_invalidate(struct machine *machine,
+	unsigned char *host, uint64_t vaddr, int len);
+int cpu_reservation_store(struct cpu *cpu, uint64_t vaddr,
+	unsigned char *data, int len, unsigned char *host);
+void cpu_host_atomic_exchange(struct cpu *cpu, uint64_t vaddr,
+	unsigned char *host, unsigned char *data, int len);
+
 void cpu_run_init(struct machine *machine);
 
 void cpu_dumpinfo(struct machine *m, struct cpu *cpu, bool verbose);
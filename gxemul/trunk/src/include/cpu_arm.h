@@ -83,6 +83,13 @@ struct arm_cpu_type_def {
 #define	ARM_ADDR_TO_PAGENR(a)		((a) >> (ARM_IC_ENTRIES_SHIFT \
 					+ ARM_INSTR_ALIGNMENT_SHIFT))
 
+/*
+ *  LDREX/STREX reservation granule: 8-2048 bytes, implementation dependent.
+ *  (https://stackoverflow.com/questions/11383125/do-the-arm-instructions-
+ *  ldrex-strex-have-to-operate-on-cache-aligned-data)  A cache line:
+ */
+#define	ARM_RESERVATION_GRANULE		64
+
 #define	ARM_F_N		8	/*  Same as ARM_FLAG_*, but        */
 #define	ARM_F_Z		4	/*  for the 'flags' field instead  */
 #define	ARM_F_C		2	/*  of cpsr.                       */
@@ -234,11 +241,6 @@ struct arm_cpu {
 	 */
 	int			irq_asserted;
 
-	/*  Read-Modify-Write (LDREX/STREX):  */
-	int			rmw;		/*  1 = currently active  */
-	uint32_t		rmw_len;	/*  Length of rmw modification  */
-	uint32_t		rmw_addr;	/*  Address of rmw modification  */
-
 
 	/*
 	 *  Instruction translation cache, and 32-bit virtual -> physical ->
@@ -38,7 +38,7 @@
 struct cpu_family;
 
 
-#define	I960_N_IC_ARGS			3
+#define	I960_N_IC_ARGS			1
 #define	I960_INSTR_ALIGNMENT_SHIFT	2
 #define	I960_IC_ENTRIES_SHIFT		10
 #define	I960_IC_ENTRIES_PER_PAGE	(1 << I960_IC_ENTRIES_SHIFT)
@@ -218,12 +218,28 @@ DYNTRANS_MISC_DECLARATIONS(m88k,M88K,uint32_t)
 #define	N_M88200_PATC_ENTRIES		56
 #define	M8820X_PATC_SUPERVISOR_BIT	0x00000001
 
+/*
+ *  PATC index:
+ *
+ *  Each PATC entry is linked into a hash chain selected by its virtual page
+ *  number and supervisor bit. patc_hash[] contains the first entry (plus one)
+ *  of each chain, and patc_hash_next[] the entry (plus one) following each
+ *  entry; 0 means end of chain. Entries are re-linked whenever their address
+ *  fields are rewritten (m8820x_patc_set_entry()). Invalidation only clears
+ *  PG_V, so the chains stay correct without any extra work.
+ */
+#define	M8820X_PATC_HASH_SIZE		64
+#define	M8820X_PATC_HASH(vaddr,s)	((((vaddr) >> 12) ^ ((s) << 5)) \
+					& (M8820X_PATC_HASH_SIZE - 1))
+
 struct m8820x_cmmu {
 	uint32_t	reg[M8820X_LENGTH / sizeof(uint32_t)];
 	uint32_t	batc[N_M88200_BATC_REGS];
 	uint32_t	patc_v_and_control[N_M88200_PATC_ENTRIES];
 	uint32_t	patc_p_and_supervisorbit[N_M88200_PATC_ENTRIES];
 	int		patc_update_index;
+	uint8_t		patc_hash[M8820X_PATC_HASH_SIZE];
+	uint8_t		patc_hash_next[N_M88200_PATC_ENTRIES];
 };
 
 
@@ -292,6 +308,8 @@ void m88k_fstcr(struct cpu *cpu, uint32_t value, int fcr);
 void m88k_exception(struct cpu *cpu, int vector, int is_trap);
 
 /*  memory_m88k.c:  */
+int m8820x_patc_lookup(struct m8820x_cmmu *cmmu, uint32_t vaddr,
+	int supervisor);
 int m88k_translate_v2p(struct cpu *cpu, uint64_t vaddr,
 	uint64_t *return_addr, int flags);
 
@@ -94,6 +94,11 @@ struct mips_tlb {
 #define	MIPS_FPU_FCSR			31
 #define	   MIPS_FCSR_FCC0_SHIFT		   23
 #define	   MIPS_FCSR_FCC1_SHIFT		   25
+#define	   MIPS_FCSR_RM_MASK		   0x00000003
+#define	   MIPS_FCSR_ENABLES_MASK	   0x00000f80
+
+/*  Divisors this close to zero are treated as division by zero:  */
+#define	MIPS_FPU_DIV_ZERO_LIMIT		0.00000000001
 
 #define	N_VADDR_TO_TLB_INDEX_ENTRIES	(1 << 20)
 
@@ -202,6 +207,51 @@ DYNTRANS_MISC_DECLARATIONS(mips,MIPS,uint64_t)
 DYNTRANS_MISC64_DECLARATIONS(mips,MIPS,uint8_t)
 
 
+/*
+ *  ASID cache:
+ *
+ *  When the ASID in EntryHi changes, the dyntrans translations for the old
+ *  ASID are saved in one of these sets instead of just being thrown away.
+ *  If the guest switches back to that ASID later on (i.e. back to a recently
+ *  run process), the saved translations are re-inserted into the VPH tables
+ *  directly, without going through the TLB lookup slow path again.
+ *
+ *  Saved translations are always re-inserted as read-only, so that the first
+ *  write to each page still goes through memory_rw() and invalidates code
+ *  translations / updates device dirty ranges as usual.
+ */
+#define	MIPS_N_ASID_CACHE_SETS		8
+#define	MIPS_ASID_CACHE_ENTRIES		96
+
+struct mips_asid_cache_entry {
+	uint64_t	vaddr_page;
+	uint64_t	paddr_page;
+	unsigned char	*host_page;
+};
+
+struct mips_asid_cache_set {
+	bool		in_use;
+	unsigned int	asid;
+	int		n_entries;
+	uint64_t	last_used;
+	struct mips_asid_cache_entry entry[MIPS_ASID_CACHE_ENTRIES];
+};
+
+
+/*
+ *  Host-native replacements of well-known guest functions. When the first
+ *  instruction of a function with a registered symbol name is translated,
+ *  it is replaced by a call to native code (see mips_cpu_native_function()).
+ *  More names can be added with mips_cpu_register_native_function().
+ *  Arguments are passed in a0..a2, and results are returned in v0.
+ */
+#define	MIPS_NATIVE_BZERO		0	/*  bzero(dst, len)  */
+#define	MIPS_NATIVE_MEMSET		1	/*  memset(dst, c, len)  */
+#define	MIPS_NATIVE_BCOPY		2	/*  bcopy(src, dst, len)  */
+#define	MIPS_NATIVE_MEMCPY		3	/*  memcpy(dst, src, len)  */
+#define	MIPS_NATIVE_STRLEN		4	/*  strlen(s)  */
+
+
 struct mips_cpu {
 	struct mips_cpu_type_def cpu_type;
 
@@ -221,17 +271,21 @@ struct mips_cpu {
 
 	int		last_written_tlb_index;
 
-	/*  Count/compare timer:  */
+	/*  Saved translations for recently used ASIDs (see above):  */
+	unsigned int	vph_asid;	/*  ASID of the current VPH contents  */
+	uint64_t	asid_cache_clock;
+	struct mips_asid_cache_set asid_cache[MIPS_N_ASID_CACHE_SETS];
+
+	/*  Count/compare timer:  (COUNT was count_base at count_base_ninstrs)  */
+	uint32_t	count_base;
+	int64_t		count_base_ninstrs;
 	int		compare_register_set;
 	int		compare_interrupts_pending;
-	int32_t		count_register_read_count;
 	struct interrupt irq_compare;
 	struct timer	*timer;
 
-	/*  Read-Modify-Write (LL/SC):  */
-	int		rmw;		/*  1 = currently active  */
-	uint64_t	rmw_len;	/*  Length of rmw modification  */
-	uint64_t	rmw_addr;	/*  Address of rmw modification  */
+	/*  Set while running the guest code of a native function:  */
+	int		native_fallback;
 
 	/*
 	 *  NOTE:  The R5900 has 128-bit registers. I'm not really sure
@@ -284,9 +338,12 @@ struct mips_cpu {
 
 
 /*  cpu_mips.c:  */
+bool mips_cpu_interrupt_check(struct cpu *cpu);
 void mips_cpu_interrupt_assert(struct interrupt *interrupt);
 void mips_cpu_interrupt_deassert(struct interrupt *interrupt);
 int mips_cpu_instruction_has_delayslot(struct cpu *cpu, unsigned char *ib);
+void mips_cpu_register_native_function(const char *name, int func);
+int mips_cpu_native_function(struct cpu *cpu, uint64_t addr);
 void mips_cpu_tlbdump(struct cpu* cpu, int rawflag);
 void mips_cpu_register_match(struct machine *m, char *name, 
 	int writeflag, uint64_t *valuep, int *match_register);
@@ -313,12 +370,16 @@ void coproc_register_read(struct cpu *cpu,
 void coproc_register_write(struct cpu *cpu,
         struct mips_coproc *cp, int reg_nr, uint64_t *ptr, int flag64,
 	int select);
+void mips_asid_cache_invalidate(struct cpu *cpu, uint64_t paddr, int flags);
 void coproc_tlbpr(struct cpu *cpu, int readflag);
 void coproc_tlbwri(struct cpu *cpu, int randomflag);
 void coproc_rfe(struct cpu *cpu);
 void coproc_eret(struct cpu *cpu);
 void coproc_function(struct cpu *cpu, struct mips_coproc *cp, int cpnr,
         uint32_t function, int unassemble_only, int running);
+uint32_t mips_count_read(struct cpu *cpu);
+void mips_count_write(struct cpu *cpu, uint32_t value);
+void mips_timer_event(struct cpu *cpu);
 
 
 /*  memory_mips.c:  */
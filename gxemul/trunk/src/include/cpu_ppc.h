@@ -106,6 +106,34 @@ DYNTRANS_MISC64_DECLARATIONS(ppc,PPC,uint8_t)
 
 #define	PPC_MAX_VPH_TLB_ENTRIES		128
 
+/*
+ *  Software TLB for hashed page table lookups:
+ *
+ *  The low PTE word found when walking the page table is cached, tagged by
+ *  VSID and page index, so segment register writes do not need to flush it.
+ *  Like a real TLB, it is only flushed on tlbie/tlbia, and on SDR1 writes.
+ *  All 16 segments map a given page index to the same slot, so tlbie (which
+ *  invalidates a page index in all segments) only needs to clear one slot.
+ */
+#define	PPC_N_PTE_CACHE			512
+#define	PPC_PTE_CACHE_INDEX(vaddr)	(((vaddr) >> 12) & (PPC_N_PTE_CACHE-1))
+#define	PPC_PTE_CACHE_TAG(vsid,vaddr)	((1ULL << 63) | ((uint64_t)(vsid) \
+					<< 16) | (((vaddr) >> 12) & 0xffff))
+
+struct ppc_pte_cache_entry {
+	uint64_t	tag;		/*  0 = invalid  */
+	uint32_t	lower_pte;
+};
+
+/*  BATs, pre-decoded into range checks:  */
+struct ppc_decoded_bat {
+	uint32_t	vmask;		/*  Address bits to compare  */
+	uint32_t	vbase;		/*  Effective base address  */
+	uint32_t	pbase;		/*  Physical base address  */
+	uint8_t		valid[2];	/*  Indexed by "user"  */
+	uint8_t		pp;
+};
+
 
 struct ppc_cpu {
 	struct ppc_cpu_type_def cpu_type;
@@ -117,6 +145,7 @@ struct ppc_cpu {
 
 	int		irq_asserted;	/*  External Interrupt flag  */
 	int		dec_intr_pending;/* Decrementer interrupt pending  */
+	int64_t		timer_base_ninstrs; /*  see ppc_timer_read()  */
 	uint64_t	zero;		/*  A zero register  */
 
 	uint32_t	cr;		/*  Condition Register  */
@@ -136,6 +165,11 @@ struct ppc_cpu {
 	uint64_t	ll_addr;	/*  Load-linked / store-conditional  */
 	int		ll_bit;
 
+	/*  See memory_ppc.c:  */
+	struct ppc_pte_cache_entry pte_cache[PPC_N_PTE_CACHE];
+	struct ppc_decoded_bat decoded_bat[8];
+	bool		decoded_bat_ok;
+
 
 	/*
 	 *  Instruction translation cache and Virtual->Physical->Host
@@ -200,6 +234,10 @@ struct ppc_cpu {
 
 
 /*  cpu_ppc.c:  */
+bool ppc_cpu_interrupt_check(struct cpu *cpu);
+uint64_t ppc_timer_read(struct cpu *cpu, int spr);
+void ppc_timer_write(struct cpu *cpu, int spr, uint64_t value);
+void ppc_timer_event(struct cpu *cpu);
 int ppc_run_instr(struct cpu *cpu);
 int ppc32_run_instr(struct cpu *cpu);
 void ppc_exception(struct cpu *cpu, int exception_nr);
@@ -217,6 +255,7 @@ int ppc_memory_rw(struct cpu *cpu, struct memory *mem, uint64_t vaddr,
 void ppc_cpu_family_init(struct cpu_family *);
 
 /*  memory_ppc.c:  */
+void ppc_pte_cache_invalidate(struct cpu *cpu, uint64_t vaddr, int flags);
 int ppc_translate_v2p(struct cpu *cpu, uint64_t vaddr,
 	uint64_t *return_addr, int flags);
 
@@ -88,6 +88,17 @@ DYNTRANS_MISC_DECLARATIONS(sh,SH,uint32_t)
 #define	SH_N_ITLB_ENTRIES	4
 #define	SH_N_UTLB_ENTRIES	64
 
+/*
+ *  UTLB lookup hints: A direct-mapped table, indexed by a hash of the 4 KB
+ *  virtual page number and the current ASID, containing the UTLB index plus
+ *  one of the entry which matched last time (0 = no hint). Hints are always
+ *  verified against the real UTLB entry, so they never need to be
+ *  invalidated when the UTLB is modified.
+ */
+#define	SH_N_UTLB_HINTS		256
+#define	SH_UTLB_HINT_INDEX(vaddr,asid)	((((vaddr) >> 12) ^ ((asid) * 0x9d)) \
+					& (SH_N_UTLB_HINTS - 1))
+
 /*  An instruction with an invalid encoding; used for software
     emulation of PROM calls within GXemul:  */
 #define	SH_INVALID_INSTR	0x00fb
@@ -133,6 +144,7 @@ struct sh_cpu {
 	uint32_t	itlb_lo[SH_N_ITLB_ENTRIES];
 	uint32_t	utlb_hi[SH_N_UTLB_ENTRIES];
 	uint32_t	utlb_lo[SH_N_UTLB_ENTRIES];
+	uint8_t		utlb_hint[SH_N_UTLB_HINTS];
 
 	/*  Exception handling:  */
 	uint32_t	tra;		/*  TRAPA Exception Register  */
@@ -224,6 +236,7 @@ struct sh_cpu {
 #define	SH_INT_PRIO_MASK	0x0f
 
 /*  cpu_sh.c:  */
+bool sh_cpu_interrupt_check(struct cpu *cpu);
 void sh_cpu_interrupt_assert(struct interrupt *interrupt);
 void sh_cpu_interrupt_deassert(struct interrupt *interrupt);
 int sh_cpu_instruction_has_delayslot(struct cpu *cpu, unsigned char *ib);
@@ -46,15 +46,43 @@
 #define	DISKIMAGE_TYPES		{ "(NONE)", "SCSI", "IDE", "FLOPPY" }
 
 
+/*  Block cache (see diskimage.c):  */
+#define	DISKIMAGE_CACHE_BLOCK_SIZE	32768
+#define	DISKIMAGE_CACHE_MAX_READAHEAD	8	/*  in cache blocks  */
+#define	DEFAULT_DISKIMAGE_CACHE_SIZE	(16*1048576)
+
+/*
+ *  Asynchronous reads (see diskimage_async.c) are reported as complete by
+ *  the disk controllers this many instructions after they were started. If
+ *  the host has not finished the read by then, the emulator waits for it.
+ */
+#define	DISKIMAGE_ASYNC_READ_NINSTRS(len)	(10000 + (len) / 8)
+
+
 /*  512 bytes per overlay block. Don't change this.  */
 #define	OVERLAY_BLOCK_SIZE	512
 
+/*
+ *  The allocation bitmap of an overlay (one bit per OVERLAY_BLOCK_SIZE block,
+ *  in the .map file) is kept in memory, in 64-bit words with block b at bit
+ *  b%64 of word b/64. Words in [dirty_lo, dirty_hi) have not been written
+ *  back to the map file yet.
+ */
 struct diskimage_overlay {
 	char		*overlay_basename;
-	FILE		*f_data;
-	FILE		*f_bitmap;
+	int		fd_data;
+	int		fd_bitmap;
+
+	uint64_t	*bitmap;
+	size_t		bitmap_words;
+	size_t		dirty_lo;
+	size_t		dirty_hi;
+
+	int		unsynced;	/*  written since the last sync?  */
 };
 
+struct diskimage_sparse;
+
 struct diskimage {
 	struct diskimage *next;
 	int		type;		/*  DISKIMAGE_SCSI, etc  */
@@ -62,7 +90,8 @@ struct diskimage {
 
 	/*  Filename in host's file system:  */
 	char		*fname;
-	FILE		*f;
+	int		fd;		/*  -1 if not open  */
+	struct diskimage_sparse *sparse;	/*  if in sparse format  */
 
 	/*  Overlays:  */
 	int		nr_of_overlays;
@@ -85,10 +114,26 @@ struct diskimage {
 	int		is_a_cdrom;
 	int		is_boot_device;
 
+	/*  Read-only raw images may be mapped into memory ('m' prefix):  */
+	int		use_mmap;
+	unsigned char	*mmap_base;	/*  NULL if not mapped  */
+	size_t		mmap_len;
+
 	int		is_a_tape;
 	uint64_t	tape_offset;
 	int		tape_filenr;
+	int		tape_eof;	/*  like feof() on the tape file  */
 	int		filemark;
+
+	/*  Guest writes stay in the block cache until flushed ('w' prefix):  */
+	int		write_back;
+
+	/*  Sequential read detection, for block cache readahead:  */
+	int64_t		cache_next_offset;
+	int		cache_readahead;	/*  in cache blocks  */
+
+	/*  The image file has been written since the last diskimage_sync():  */
+	int		unsynced;
 };
 
 
@@ -102,6 +147,10 @@ struct scsi_transfer {
 	unsigned char		*cmd;
 	size_t			cmd_len;
 
+	/*  Set by a controller which can wait for data_in to arrive; READ
+	    is then started asynchronously (see diskimage_scsi_wait()):  */
+	int			async_read;
+
 	/*  data_out_len is set by the SCSI disk, if it needs data_out,
 	    which is then filled in during a second pass in the controller.  */
 	unsigned char		*data_out;
@@ -115,10 +164,14 @@ struct scsi_transfer {
 	size_t			msg_in_len;
 	unsigned char		*status;
 	size_t			status_len;
+
+	/*  Non-NULL while data_in is still being read:  */
+	struct diskimage_request *read_req;
 };
 
 
 struct machine;
+struct diskimage_request;
 
 
 /*  diskimage_scsicmd.c:  */
@@ -128,18 +181,57 @@ void scsi_transfer_allocbuf(size_t *lenp, unsigned char **pp,
 	size_t want_len, int clearflag);
 int diskimage_scsicommand(struct cpu *cpu, int id, int type,
 	struct scsi_transfer *);
+void diskimage_scsi_wait(struct scsi_transfer *xferp);
+
+
+/*  diskimage_async.c:  */
+struct diskimage_request *diskimage_access_async(struct machine *machine,
+	int id, int type, int writeflag, off_t offset, unsigned char *buf,
+	size_t len);
+int diskimage_request_poll(struct diskimage_request *req);
+int diskimage_request_wait(struct diskimage_request *req);
+
+
+/*  diskimage_sparse.c:  */
+bool diskimage_sparse_probe(int fd);
+struct diskimage_sparse *diskimage_sparse_open(int fd, const char *fname,
+	int writable);
+void diskimage_sparse_close(struct diskimage_sparse *s);
+int64_t diskimage_sparse_size(struct diskimage_sparse *s);
+ssize_t diskimage_sparse_pread(struct diskimage_sparse *s, unsigned char *buf,
+	size_t len, off_t offset);
+ssize_t diskimage_sparse_pwrite(struct diskimage_sparse *s,
+	const unsigned char *buf, size_t len, off_t offset);
 
 
 /*  diskimage.c:  */
+extern int64_t diskimage_cache_size;
+extern int diskimage_sync_on_flush;
+ssize_t diskimage_pread(int fd, unsigned char *buf, size_t len,
+	off_t offset);
+ssize_t diskimage_pwrite(int fd, const unsigned char *buf, size_t len,
+	off_t offset);
+void diskimage_init(void);
+void diskimage_deinit(void);
+void diskimage_cache_flush(struct diskimage *d);
+void diskimage__sync(struct diskimage *d);
+bool diskimage__cache_try_read(struct diskimage *d, off_t offset,
+	unsigned char *buf, size_t len);
+int diskimage__uncached_read(struct diskimage *d, off_t offset,
+	unsigned char *buf, size_t len);
 int64_t diskimage_getsize(struct machine *machine, int id, int type);
 int64_t diskimage_get_baseoffset(struct machine *machine, int id, int type);
 void diskimage_set_baseoffset(struct machine *machine, int id, int type, int64_t offset);
 void diskimage_getchs(struct machine *machine, int id, int type,
 	int *c, int *h, int *s);
+bool diskimage__open(struct diskimage *d, const char *fname, int writable);
 int diskimage__internal_access(struct diskimage *d, int writeflag,
 	off_t offset, unsigned char *buf, size_t len);
 int diskimage_access(struct machine *machine, int id, int type, int writeflag,
 	off_t offset, unsigned char *buf, size_t len);
+int diskimage_sync(struct machine *machine, int id, int type);
+const unsigned char *diskimage_map(struct machine *machine, int id, int type,
+	off_t offset, size_t len);
 bool diskimage_add_overlay(struct diskimage *d, char *overlay_basename,
 	bool remove_after_open);
 bool diskimage_recalc_size(struct diskimage *d);
@@ -149,6 +241,7 @@ int diskimage_add(struct machine *machine, char *fname);
 int diskimage_getname(struct machine *machine, int id, int type,
 	char *buf, size_t bufsize);
 int diskimage_is_a_cdrom(struct machine *machine, int id, int type);
+int diskimage_has_write_cache(struct machine *machine, int id, int type);
 int diskimage_is_a_tape(struct machine *machine, int id, int type);
 void diskimage_dump_info(struct machine *machine);
 
@@ -162,8 +255,12 @@ void diskimage_dump_info(struct machine *machine);
 
 #define	SCSICMD_READ			0x08
 #define	SCSICMD_READ_10			0x28
+#define	SCSICMD_READ_12			0xa8
+#define	SCSICMD_READ_16			0x88
 #define	SCSICMD_WRITE			0x0a
 #define	SCSICMD_WRITE_10		0x2a
+#define	SCSICMD_WRITE_12		0xaa
+#define	SCSICMD_WRITE_16		0x8a
 #define	SCSICMD_MODE_SELECT		0x15
 #define	SCSICMD_MODE_SENSE		0x1a
 #define	SCSICMD_START_STOP_UNIT		0x1b
@@ -174,6 +271,8 @@ void diskimage_dump_info(struct machine *machine);
 
 /*  SCSI block device commands:  */
 #define	SCSIBLOCKCMD_READ_CAPACITY	0x25
+#define	SCSIBLOCKCMD_SERVICE_ACTION_IN	0x9e
+#define	SCSI_SAI_READ_CAPACITY_16	0x10
 
 /*  SCSI CD-ROM commands:  */
 #define	SCSICDROM_READ_SUBCHANNEL	0x42
@@ -32,6 +32,8 @@
  */
 
 #include <math.h>
+#include <stdbool.h>
+#include <string.h>
 
 #include "misc.h"
 
@@ -48,4 +50,77 @@ struct ieee_float_value {
 void ieee_interpret_float_value(uint64_t x, struct ieee_float_value *fvp, int fmt);
 uint64_t ieee_store_float_value(double nf, int fmt);
 
+
+/*
+ *  Host-native helpers:
+ *
+ *  The host is assumed to use IEEE 754 single and double precision formats,
+ *  with the same byte order as for integers. Values which are normal
+ *  numbers or zeroes can then be used directly in host arithmetic. NaNs,
+ *  infinities and denormals should go through the functions above instead.
+ */
+static inline double ieee_d_from_bits(uint64_t x)
+{
+	double d;
+	memcpy(&d, &x, sizeof(d));
+	return d;
+}
+
+static inline uint64_t ieee_d_to_bits(double d)
+{
+	uint64_t x;
+	memcpy(&x, &d, sizeof(x));
+	return x;
+}
+
+static inline float ieee_s_from_bits(uint32_t x)
+{
+	float f;
+	memcpy(&f, &x, sizeof(f));
+	return f;
+}
+
+static inline uint32_t ieee_s_to_bits(float f)
+{
+	uint32_t x;
+	memcpy(&x, &f, sizeof(x));
+	return x;
+}
+
+static inline bool ieee_d_is_normal_or_zero(uint64_t x)
+{
+	uint32_t e = (x >> 52) & 0x7ff;
+	return (e != 0 && e != 0x7ff) || (x << 1) == 0;
+}
+
+static inline bool ieee_s_is_normal_or_zero(uint32_t x)
+{
+	uint32_t e = (x >> 23) & 0xff;
+	return (e != 0 && e != 0xff) || (uint32_t)(x << 1) == 0;
+}
+
+/*
+ *  ieee_s_truncate_d():
+ *
+ *  Converts a normal (or zero) double, given as bits, to a single by
+ *  truncating the fraction. This is what ieee_store_float_value() does for
+ *  IEEE_FMT_S. Returns false if the exponent does not fit in a single.
+ */
+static inline bool ieee_s_truncate_d(uint64_t x, uint32_t *sp)
+{
+	int e = ((x >> 52) & 0x7ff) - 1023 + 127;
+
+	if ((x << 1) == 0) {
+		*sp = (x >> 32) & 0x80000000;
+		return true;
+	}
+
+	if (e < 1 || e > 254)
+		return false;
+
+	*sp = ((x >> 32) & 0x80000000) | ((uint32_t)e << 23) |
+	    ((x >> 29) & 0x7fffff);
+	return true;
+}
+
 #endif	/*  FLOAT_EMUL_H  */
@@ -130,6 +130,9 @@ struct machine {
 	int	ncpus;
 	struct cpu **cpus;
 
+	/*  Number of CPUs with an active LL/SC reservation:  */
+	int	n_reservations;
+
 	struct diskimage *first_diskimage;
 
 	struct symbol_context symbol_context;
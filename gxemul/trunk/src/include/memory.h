@@ -101,6 +101,7 @@ void memory_writemax64(struct cpu *cpu, unsigned char *buf, int len,
 	uint64_t data);
 
 void *zeroed_alloc(size_t s);
+void zeroed_release(void *p, size_t s);
 
 struct memory *memory_new(uint64_t physical_max);
 
@@ -59,6 +59,8 @@ int get_symbol_addr(struct symbol_context *, const char *symbol, uint64_t *addr)
 char *get_symbol_name_and_n_args(struct symbol_context *, uint64_t addr,
 	uint64_t *offset, int *n_argsp);
 char *get_symbol_name(struct symbol_context *, uint64_t addr, uint64_t *offset);
+int get_symbol_name_index(struct symbol_context *, uint64_t addr,
+	const char **names);
 void add_symbol_name(struct symbol_context *, uint64_t addr,
 	uint64_t len, const char *name, int type, int n_args);
 void symbol_readfile(struct symbol_context *, char *fname);
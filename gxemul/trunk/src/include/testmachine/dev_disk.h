@@ -14,6 +14,10 @@
 #define	    DEV_DISK_ID			    0x0010
 #define	    DEV_DISK_START_OPERATION	    0x0020
 #define	    DEV_DISK_STATUS		    0x0030
+#define	    DEV_DISK_DMA_ADDRESS	    0x0040
+#define	    DEV_DISK_DMA_ADDRESS_HIGH32	    0x0048
+#define	    DEV_DISK_DMA_COUNT		    0x0050
+#define	    DEV_DISK_INTERRUPT		    0x0060
 #define	    DEV_DISK_BUFFER		    0x4000
 
 #define	    DEV_DISK_BUFFER_LEN		0x200
@@ -21,6 +25,19 @@
 /*  Operations:  */
 #define	DEV_DISK_OPERATION_READ		0
 #define	DEV_DISK_OPERATION_WRITE	1
+#define	DEV_DISK_OPERATION_DMA_READ	2
+#define	DEV_DISK_OPERATION_DMA_WRITE	3
+#define	DEV_DISK_OPERATION_SG_READ	4
+#define	DEV_DISK_OPERATION_SG_WRITE	5
+
+/*
+ *  Scatter-gather descriptor, in emulated physical memory (DMA_COUNT of
+ *  them, starting at DMA_ADDRESS). Both fields are 64-bit words in the
+ *  emulated machine's byte order. The length must be a multiple of 512.
+ */
+#define	DEV_DISK_SG_ADDRESS		0x00
+#define	DEV_DISK_SG_LENGTH		0x08
+#define	DEV_DISK_SG_DESCRIPTOR_LEN	0x10
 
 
 #endif	/*  TESTMACHINE_DISK_H  */
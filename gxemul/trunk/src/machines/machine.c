@@ -636,6 +636,7 @@ bool machine_run(struct machine *machine)
 	for (int i=0; i<ncpus; i++) {
 		if (cpus[i]->running) {
 			any_running = true;
+			cpus[i]->n_slices ++;
 			cpus[i]->run_instr(cpus[i]);
 		}
 	}
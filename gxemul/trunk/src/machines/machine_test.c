@@ -128,8 +128,8 @@ static void default_test(struct machine *machine, struct cpu *cpu)
 	    (uint64_t) DEV_FBCTRL_ADDRESS);
 	device_add(machine, tmpstr);
 
-	snprintf(tmpstr, sizeof(tmpstr), "disk addr=0x%" PRIx64,
-	    (uint64_t) DEV_DISK_ADDRESS);
+	snprintf(tmpstr, sizeof(tmpstr), "disk addr=0x%" PRIx64" irq=%s.irqc.5",
+	    (uint64_t) DEV_DISK_ADDRESS, base_irq);
 	device_add(machine, tmpstr);
 
 	snprintf(tmpstr, sizeof(tmpstr), "ether addr=0x%" PRIx64" irq=%s.irqc.3",
@@ -287,7 +287,7 @@ MACHINE_SETUP(testmips)
 	 *  IRQ map:
 	 *      7       CPU counter
 	 *      6       SMP IPIs
-	 *      5       not used yet
+	 *      5       disk
 	 *      4       rtc
 	 *      3       ethernet  
 	 *      2       serial console
@@ -311,8 +311,9 @@ MACHINE_SETUP(testmips)
 	    (uint64_t) DEV_FBCTRL_ADDRESS);
 	device_add(machine, tmpstr);
 
-	snprintf(tmpstr, sizeof(tmpstr), "disk addr=0x%" PRIx64,
-	    (uint64_t) DEV_DISK_ADDRESS);
+	snprintf(tmpstr, sizeof(tmpstr), "disk addr=0x%" PRIx64" irq=%s."
+	    "cpu[%i].5", (uint64_t) DEV_DISK_ADDRESS, machine->path,
+	    machine->bootstrap_cpu);
 	device_add(machine, tmpstr);
 
 	snprintf(tmpstr, sizeof(tmpstr), "ether addr=0x%" PRIx64" irq=%s."
@@ -197,6 +197,61 @@ char *get_symbol_name(struct symbol_context *sc, uint64_t addr, uint64_t *offs)
 }
 
 
+/*
+ *  get_symbol_name_index():
+ *
+ *  Checks whether any of the symbols which start exactly at addr has one of
+ *  the names in the NULL-terminated names array. (Several symbols may share
+ *  the same address, e.g. memcpy and memmove.)
+ *
+ *  Returns the index into names of the first match, or -1 if there was no
+ *  match.
+ */
+int get_symbol_name_index(struct symbol_context *sc, uint64_t addr,
+	const char **names)
+{
+	struct symbol *s;
+	int i, first, last;
+
+	if (sc->n_symbols == 0)
+		return -1;
+
+	if ((addr >> 32) == 0 && (addr & 0x80000000ULL))
+		addr |= 0xffffffff00000000ULL;
+
+	if (!sc->sorted_array) {
+		/*  Slow, linear O(n) search:  */
+		for (s = sc->first_symbol; s != NULL; s = s->next)
+			if (s->addr == addr)
+				for (i=0; names[i] != NULL; i++)
+					if (strcmp(s->name, names[i]) == 0)
+						return i;
+		return -1;
+	}
+
+	/*  Find the first symbol at addr, O(log n):  */
+	first = 0, last = sc->n_symbols;
+	while (first < last) {
+		int ofs = (first + last) / 2;
+		if (sc->first_symbol[ofs].addr < addr)
+			first = ofs + 1;
+		else
+			last = ofs;
+	}
+
+	for (; first < sc->n_symbols; first++) {
+		s = sc->first_symbol + first;
+		if (s->addr != addr)
+			break;
+		for (i=0; names[i] != NULL; i++)
+			if (strcmp(s->name, names[i]) == 0)
+				return i;
+	}
+
+	return -1;
+}
+
+
 /*
  *  add_symbol_name():
  *
@@ -0,0 +1,253 @@
+#
+#  GXemul floating point test: MIPS add/sub/mul/div fast path
+#
+#  This file is in the Public Domain.
+#
+#  Every operation is executed twice on the same operands: once with FCSR
+#  cleared, which lets the emulator use its host-native fast path, and once
+#  with an exception enable bit set in FCSR, which forces the emulator's old
+#  coprocessor code path. The two results must be bit for bit identical.
+#  Both FR=0 and FR=1 register modes are tested.
+#
+#  The program prints each mismatch, followed by a summary line, e.g.
+#
+#	fpfast: 000000f8 tests, 00000000 mismatches
+#
+#  Build and run instructions are in the Makefile (target fpfast_mips64).
+#
+
+	.set	noreorder
+	.set	noat
+	.text
+	.globl	f
+
+#  Single precision: table of operand pairs, 8 bytes per entry
+	.macro	SBLOCK insn, id
+	daddiu	$16, $21, %lo(stable - base)
+	addiu	$17, $0, %lo((stable_end - stable) / 8)
+1:	lwc1	$f2, 0($16)
+	lwc1	$f4, 4($16)
+	lwc1	$f0, 16($18)
+	ctc1	$0, $31
+	\insn	$f0, $f2, $f4
+	swc1	$f0, 0($18)
+	lwc1	$f0, 16($18)
+	ctc1	$23, $31
+	\insn	$f0, $f2, $f4
+	swc1	$f0, 8($18)
+	ctc1	$0, $31
+	lwu	$6, 0($18)
+	lwu	$7, 8($18)
+	li	$4, \id
+	bal	check
+	li	$5, 0
+	daddiu	$16, $16, 8
+	addiu	$17, $17, -1
+	bnez	$17, 1b
+	nop
+	.endm
+
+#  Double precision: table of operand pairs, 16 bytes per entry
+	.macro	DBLOCK insn, id
+	daddiu	$16, $21, %lo(dtable - base)
+	addiu	$17, $0, %lo((dtable_end - dtable) / 16)
+1:	ldc1	$f2, 0($16)
+	ldc1	$f4, 8($16)
+	ldc1	$f0, 16($18)
+	ctc1	$0, $31
+	\insn	$f0, $f2, $f4
+	sdc1	$f0, 0($18)
+	ldc1	$f0, 16($18)
+	ctc1	$23, $31
+	\insn	$f0, $f2, $f4
+	sdc1	$f0, 8($18)
+	ctc1	$0, $31
+	ld	$6, 0($18)
+	ld	$7, 8($18)
+	li	$4, \id
+	bal	check
+	li	$5, 1
+	daddiu	$16, $16, 16
+	addiu	$17, $17, -1
+	bnez	$17, 1b
+	nop
+	.endm
+
+	.macro	PUTC ch
+	li	$8, \ch
+	sb	$8, 0($22)
+	.endm
+
+	.macro	PUTS label
+	bal	putstr
+	daddiu	$2, $21, %lo(\label - base)
+	.endm
+
+f:
+	bal	base
+	nop
+base:	move	$21, $31			# base address
+	dli	$22, 0xffffffffb0000000		# console
+	daddiu	$18, $21, 0x4000		# scratch area
+	dli	$8, 0x5555555555555555		# sentinel, stored in fd first
+	sd	$8, 16($18)
+	li	$23, 0x80			# FCSR: Inexact exception enable
+	move	$19, $0				# number of mismatches
+	move	$20, $0				# number of tests
+	li	$30, 2				# pass 2 = FR clear, 1 = FR set
+
+pass:	mfc0	$8, $12
+	lui	$9, 0x2000			# CU1
+	or	$8, $8, $9
+	lui	$9, 0x0400			# FR
+	nor	$9, $9, $0
+	and	$8, $8, $9
+	li	$9, 1
+	bne	$30, $9, 1f
+	nop
+	lui	$9, 0x0400
+	or	$8, $8, $9
+1:	mtc0	$8, $12
+	nop
+	nop
+
+	SBLOCK	add.s, 0
+	SBLOCK	sub.s, 1
+	SBLOCK	mul.s, 2
+	SBLOCK	div.s, 3
+	DBLOCK	add.d, 4
+	DBLOCK	sub.d, 5
+	DBLOCK	mul.d, 6
+	DBLOCK	div.d, 7
+
+	addiu	$30, $30, -1
+	bnez	$30, pass
+	nop
+
+	PUTS	str_summary
+	move	$2, $20
+	bal	puthex
+	li	$3, 28
+	PUTS	str_tests
+	move	$2, $19
+	bal	puthex
+	li	$3, 28
+	PUTS	str_mismatches
+	sb	$0, 0x10($22)			# halt
+2:	b	2b
+	nop
+
+
+#  check: a0 = op id, a1 = 0 for single, 1 for double,
+#  a2 = fast path result, a3 = slow path result
+check:	move	$11, $31
+	addiu	$20, $20, 1
+	beq	$6, $7, 9f
+	nop
+	addiu	$19, $19, 1
+	PUTS	str_mismatch
+	move	$2, $4
+	bal	puthex
+	li	$3, 4
+	PUTC	' '
+	bnez	$5, 1f
+	nop
+	lwu	$2, 0($16)
+	bal	puthex
+	li	$3, 28
+	PUTC	' '
+	lwu	$2, 4($16)
+	bal	puthex
+	li	$3, 28
+	b	2f
+	nop
+1:	ld	$2, 0($16)
+	bal	puthex
+	li	$3, 60
+	PUTC	' '
+	ld	$2, 8($16)
+	bal	puthex
+	li	$3, 60
+2:	PUTS	str_fast
+	move	$2, $6
+	bal	puthex
+	li	$3, 60
+	PUTS	str_slow
+	move	$2, $7
+	bal	puthex
+	li	$3, 60
+	PUTC	10
+9:	jr	$11
+	nop
+
+
+#  puthex: v0 = value, v1 = shift count of the first (leftmost) digit
+puthex:	dsrlv	$8, $2, $3
+	andi	$8, $8, 15
+	sltiu	$9, $8, 10
+	bnez	$9, 1f
+	addiu	$8, $8, 48
+	addiu	$8, $8, 39
+1:	sb	$8, 0($22)
+	addiu	$3, $3, -4
+	bgez	$3, puthex
+	nop
+	jr	$31
+	nop
+
+
+#  putstr: v0 = pointer to a nul-terminated string
+putstr:	lbu	$8, 0($2)
+	beqz	$8, 1f
+	nop
+	sb	$8, 0($22)
+	b	putstr
+	daddiu	$2, $2, 1
+1:	jr	$31
+	nop
+
+
+str_summary:	.asciiz	"fpfast: "
+str_tests:	.asciiz	" tests, "
+str_mismatches:	.asciiz	" mismatches\n"
+str_mismatch:	.asciiz	"mismatch op "
+str_fast:	.asciiz	": fast="
+str_slow:	.asciiz	" slow="
+
+	.align	3
+stable:
+	.word	0x3f800000, 0x40400000		# 1.0, 3.0
+	.word	0x3dcccccd, 0x3e4ccccd		# 0.1, 0.2
+	.word	0x40490fdb, 0x402df854		# pi, e
+	.word	0x447a0000, 0xc2c80000		# 1000.0, -100.0
+	.word	0x12345678, 0x9abcdef0
+	.word	0x3eaaaaab, 0x3f2aaaab		# 1/3, 2/3
+	.word	0x4b800001, 0x3f800000		# 2^24 + 2, 1.0
+	.word	0x7f000000, 0x7f000000		# large: overflows single
+	.word	0x00800000, 0x3f000000		# smallest normal, 0.5
+	.word	0x3f800000, 0x2b8cbccc		# 1.0, 1e-12
+	.word	0x3f800000, 0x2d2febff		# 1.0, 1e-11
+	.word	0x3f800000, 0x2d400000		# 1.0, just above 1e-11
+	.word	0x3f800000, 0x00000000		# 1.0, 0.0
+	.word	0x80000000, 0x80000000		# -0.0, -0.0
+	.word	0x00000000, 0x80000000		# 0.0, -0.0
+	.word	0x00000001, 0x3f800000		# denormal, 1.0
+	.word	0x7f800000, 0x3f800000		# inf, 1.0
+	.word	0x7fc00000, 0x3f800000		# NaN, 1.0
+stable_end:
+
+dtable:
+	.dword	0x3ff0000000000000, 0x4008000000000000	# 1.0, 3.0
+	.dword	0x3fb999999999999a, 0x3fc999999999999a	# 0.1, 0.2
+	.dword	0x400921fb54442d18, 0x4005bf0a8b145769	# pi, e
+	.dword	0x123456789abcdef0, 0x9abcdef012345678
+	.dword	0x7fe0000000000000, 0x7fe0000000000000	# large: overflows
+	.dword	0x0010000000000000, 0x3fe0000000000000	# smallest normal, 0.5
+	.dword	0x3ff0000000000000, 0x3d719799812dea11	# 1.0, 1e-12
+	.dword	0x3ff0000000000000, 0x3da5fd7fe1796495	# 1.0, 1e-11
+	.dword	0x3ff0000000000000, 0x0000000000000000	# 1.0, 0.0
+	.dword	0x8000000000000000, 0x8000000000000000	# -0.0, -0.0
+	.dword	0x0000000000000001, 0x3ff0000000000000	# denormal, 1.0
+	.dword	0x7ff0000000000000, 0x3ff0000000000000	# inf, 1.0
+	.dword	0x7ff8000000000000, 0x3ff0000000000000	# NaN, 1.0
+dtable_end: